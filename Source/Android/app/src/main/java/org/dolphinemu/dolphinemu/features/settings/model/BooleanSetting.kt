@@ -92,6 +92,12 @@ enum class BooleanSetting(
         "AccurateCPUCache",
         false
     ),
+    MAIN_HYBRID_CPU_CACHE(
+        Settings.FILE_DOLPHIN,
+        Settings.SECTION_INI_CORE,
+        "HybridCPUCache",
+        false
+    ),
     MAIN_SYNC_GPU(Settings.FILE_DOLPHIN, Settings.SECTION_INI_CORE, "SyncGPU", false),
     MAIN_FAST_DISC_SPEED(Settings.FILE_DOLPHIN, Settings.SECTION_INI_CORE, "FastDiscSpeed", false),
     MAIN_OVERCLOCK_ENABLE(
@@ -707,6 +713,12 @@ enum class BooleanSetting(
         "EnableGPUTextureDecoding",
         false
     ),
+    GFX_DYNAMIC_RESOLUTION(
+        Settings.FILE_GFX,
+        Settings.SECTION_GFX_SETTINGS,
+        "DynamicResolution",
+        false
+    ),
     GFX_ENABLE_PIXEL_LIGHTING(
         Settings.FILE_GFX,
         Settings.SECTION_GFX_SETTINGS,
@@ -987,6 +987,14 @@ class SettingsFragmentPresenter(
                 R.string.enable_cpu_cache_description
             )
         )
+        sl.add(
+            SwitchSetting(
+                context,
+                BooleanSetting.MAIN_HYBRID_CPU_CACHE,
+                R.string.hybrid_cpu_cache,
+                R.string.hybrid_cpu_cache_description
+            )
+        )
 
         sl.add(HeaderSetting(context, R.string.clock_override, 0))
         sl.add(
@@ -1344,6 +1352,14 @@ class SettingsFragmentPresenter(
                 R.array.internalResolutionValues
             )
         )
+        sl.add(
+            SwitchSetting(
+                context,
+                BooleanSetting.GFX_DYNAMIC_RESOLUTION,
+                R.string.dynamic_resolution,
+                R.string.dynamic_resolution_description
+            )
+        )
         sl.add(
             SingleChoiceSetting(
                 context,
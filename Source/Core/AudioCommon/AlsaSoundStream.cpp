@@ -3,11 +3,14 @@
 
 #include "AudioCommon/AlsaSoundStream.h"
 
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Core/Config/MainSettings.h"
 
 AlsaSound::AlsaSound()
     : m_thread_status(ALSAThreadStatus::STOPPED), handle(nullptr),
@@ -31,6 +34,7 @@ AlsaSound::~AlsaSound()
 
 bool AlsaSound::Init()
 {
+  m_low_latency = Config::Get(Config::MAIN_AUDIO_LOW_LATENCY);
   m_thread_status.store(ALSAThreadStatus::PAUSED);
   if (!AlsaInit())
   {
@@ -46,6 +50,9 @@ bool AlsaSound::Init()
 void AlsaSound::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - alsa");
+  if (m_low_latency && !Common::SetCurrentThreadRealtimePriority())
+    INFO_LOG_FMT(AUDIO, "Could not give the ALSA thread realtime priority");
+
   while (m_thread_status.load() != ALSAThreadStatus::STOPPING)
   {
     while (m_thread_status.load() == ALSAThreadStatus::RUNNING)
@@ -56,6 +63,7 @@ void AlsaSound::SoundLoop()
       {
         // Underrun
         snd_pcm_prepare(handle);
+        HandleUnderrun();
       }
       else if (rc < 0)
       {
@@ -73,10 +81,45 @@ void AlsaSound::SoundLoop()
       snd_pcm_prepare(handle);  // resume sound output
     }
   }
+  if (m_underruns != 0)
+    NOTICE_LOG_FMT(AUDIO, "ALSA had {} underruns", m_underruns);
   AlsaShutdown();
   m_thread_status.store(ALSAThreadStatus::STOPPED);
 }
 
+// Called on audio thread.
+void AlsaSound::HandleUnderrun()
+{
+  ++m_underruns;
+  if (!m_low_latency)
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_underrun_window_start > UNDERRUN_WINDOW)
+  {
+    m_underrun_window_start = now;
+    m_recent_underruns = 0;
+  }
+  if (++m_recent_underruns < UNDERRUNS_BEFORE_GROWING)
+    return;
+  m_recent_underruns = 0;
+
+  // The period is too short to be kept filled reliably, so give the device a larger one.
+  if (m_period_frames * 2 * LOW_LATENCY_PERIODS > BUFFER_SIZE_MAX)
+    return;
+  m_period_frames *= 2;
+
+  AlsaShutdown();
+  if (!AlsaInit())
+  {
+    ERROR_LOG_FMT(AUDIO, "Could not reinitialize ALSA with a larger period, stopping output");
+    m_thread_status.store(ALSAThreadStatus::STOPPING);
+    return;
+  }
+  NOTICE_LOG_FMT(AUDIO, "ALSA had {} underruns, raised the period to {} frames ({:.1f} ms)",
+                 m_underruns, m_period_frames, m_period_frames * 1000.0 / m_sample_rate);
+}
+
 bool AlsaSound::SetRunning(bool running)
 {
   m_thread_status.store(running ? ALSAThreadStatus::RUNNING : ALSAThreadStatus::PAUSED);
@@ -144,20 +187,45 @@ bool AlsaSound::AlsaInit()
     return false;
   }
 
-  periods = BUFFER_SIZE_MAX / FRAME_COUNT_MIN;
-  err = snd_pcm_hw_params_set_periods_max(handle, hwparams, &periods, &dir);
-  if (err < 0)
+  if (m_low_latency)
   {
-    ERROR_LOG_FMT(AUDIO, "Cannot set maximum periods per buffer: {}", snd_strerror(err));
-    return false;
-  }
+    // Ask for the smallest period that is known to work (or the device's minimum), and only
+    // enough periods to double buffer.
+    snd_pcm_uframes_t period_size = m_period_frames;
+    dir = 0;
+    err = snd_pcm_hw_params_set_period_size_near(handle, hwparams, &period_size, &dir);
+    if (err < 0)
+    {
+      ERROR_LOG_FMT(AUDIO, "Cannot set period size: {}", snd_strerror(err));
+      return false;
+    }
 
-  buffer_size_max = BUFFER_SIZE_MAX;
-  err = snd_pcm_hw_params_set_buffer_size_max(handle, hwparams, &buffer_size_max);
-  if (err < 0)
+    periods = LOW_LATENCY_PERIODS;
+    dir = 0;
+    err = snd_pcm_hw_params_set_periods_near(handle, hwparams, &periods, &dir);
+    if (err < 0)
+    {
+      ERROR_LOG_FMT(AUDIO, "Cannot set periods per buffer: {}", snd_strerror(err));
+      return false;
+    }
+  }
+  else
   {
-    ERROR_LOG_FMT(AUDIO, "Cannot set maximum buffer size: {}", snd_strerror(err));
-    return false;
+    periods = BUFFER_SIZE_MAX / FRAME_COUNT_MIN;
+    err = snd_pcm_hw_params_set_periods_max(handle, hwparams, &periods, &dir);
+    if (err < 0)
+    {
+      ERROR_LOG_FMT(AUDIO, "Cannot set maximum periods per buffer: {}", snd_strerror(err));
+      return false;
+    }
+
+    buffer_size_max = BUFFER_SIZE_MAX;
+    err = snd_pcm_hw_params_set_buffer_size_max(handle, hwparams, &buffer_size_max);
+    if (err < 0)
+    {
+      ERROR_LOG_FMT(AUDIO, "Cannot set maximum buffer size: {}", snd_strerror(err));
+      return false;
+    }
   }
 
   err = snd_pcm_hw_params(handle, hwparams);
@@ -181,15 +249,32 @@ bool AlsaSound::AlsaInit()
     return false;
   }
 
-  // periods is the number of fragments alsa can wait for during one
-  // buffer_size
-  frames_to_deliver = buffer_size / periods;
-  // limit the minimum size. pulseaudio advertises a minimum of 32 samples.
-  if (frames_to_deliver < FRAME_COUNT_MIN)
-    frames_to_deliver = FRAME_COUNT_MIN;
-  // it is probably a bad idea to try to send more than one buffer of data
-  if ((unsigned int)frames_to_deliver > buffer_size)
-    frames_to_deliver = buffer_size;
+  if (m_low_latency)
+  {
+    // Deliver one period at a time.
+    snd_pcm_uframes_t period_size;
+    err = snd_pcm_hw_params_get_period_size(hwparams, &period_size, &dir);
+    if (err < 0)
+    {
+      ERROR_LOG_FMT(AUDIO, "Cannot get period size: {}", snd_strerror(err));
+      return false;
+    }
+    m_period_frames = std::clamp<snd_pcm_uframes_t>(period_size, 1, BUFFER_SIZE_MAX);
+    frames_to_deliver = static_cast<unsigned int>(std::min(m_period_frames, buffer_size));
+  }
+  else
+  {
+    // periods is the number of fragments alsa can wait for during one
+    // buffer_size
+    frames_to_deliver = buffer_size / periods;
+    // limit the minimum size. pulseaudio advertises a minimum of 32 samples.
+    if (frames_to_deliver < FRAME_COUNT_MIN)
+      frames_to_deliver = FRAME_COUNT_MIN;
+    // it is probably a bad idea to try to send more than one buffer of data
+    if ((unsigned int)frames_to_deliver > buffer_size)
+      frames_to_deliver = buffer_size;
+  }
+  m_sample_rate = sample_rate;
   NOTICE_LOG_FMT(AUDIO,
                  "ALSA gave us a {} sample \"hardware\" buffer with {} periods. Will send {} "
                  "samples per fragments.",
@@ -224,7 +309,8 @@ bool AlsaSound::AlsaInit()
     ERROR_LOG_FMT(AUDIO, "Unable to prepare: {}", snd_strerror(err));
     return false;
   }
-  NOTICE_LOG_FMT(AUDIO, "ALSA successfully initialized.");
+  NOTICE_LOG_FMT(AUDIO, "ALSA successfully initialized, output latency {:.1f} ms.",
+                 buffer_size * 1000.0 / sample_rate);
   return true;
 }
 
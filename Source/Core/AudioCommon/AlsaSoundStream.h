@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -39,6 +40,13 @@ private:
   // number of channels per frame
   static constexpr u32 CHANNEL_COUNT = 2;
 
+  // Low latency mode: the period size to start negotiating from, the number of periods in the
+  // buffer, and how many underruns within UNDERRUN_WINDOW make the period size double.
+  static constexpr snd_pcm_uframes_t LOW_LATENCY_MIN_PERIOD = 64;
+  static constexpr unsigned int LOW_LATENCY_PERIODS = 2;
+  static constexpr u32 UNDERRUNS_BEFORE_GROWING = 3;
+  static constexpr std::chrono::seconds UNDERRUN_WINDOW{5};
+
   enum class ALSAThreadStatus
   {
     RUNNING,
@@ -50,6 +58,8 @@ private:
   bool AlsaInit();
   void AlsaShutdown();
 
+  void HandleUnderrun();
+
   s16 mix_buffer[BUFFER_SIZE_MAX * CHANNEL_COUNT];
   std::thread thread;
   std::atomic<ALSAThreadStatus> m_thread_status;
@@ -58,5 +68,12 @@ private:
 
   snd_pcm_t* handle;
   unsigned int frames_to_deliver;
+
+  bool m_low_latency = false;
+  snd_pcm_uframes_t m_period_frames = LOW_LATENCY_MIN_PERIOD;
+  unsigned int m_sample_rate = 0;
+  u32 m_underruns = 0;
+  u32 m_recent_underruns = 0;
+  std::chrono::steady_clock::time_point m_underrun_window_start;
 #endif
 };
@@ -18,6 +18,19 @@ AudioStretcher::AudioStretcher(unsigned int sample_rate) : m_sample_rate(sample_
   m_sound_touch.setSampleRate(sample_rate);
   m_sound_touch.setPitch(1.0);
   m_sound_touch.setTempo(1.0);
+  ApplySettings(Config::Get(Config::MAIN_AUDIO_STRETCH_FAST));
+}
+
+void AudioStretcher::ApplySettings(bool fast)
+{
+  // Most of SoundTouch's time goes into searching for the best overlap position. The fast mode
+  // uses its quick (hierarchical) search over a short fixed window instead of a full search over
+  // a window sized automatically from the tempo, which costs a fraction of the CPU at the expense
+  // of occasional audible artifacts.
+  m_fast = fast;
+  m_sound_touch.setSetting(SETTING_USE_QUICKSEEK, fast ? 1 : 0);
+  m_sound_touch.setSetting(SETTING_SEQUENCE_MS, fast ? 40 : 0);
+  m_sound_touch.setSetting(SETTING_SEEKWINDOW_MS, fast ? 10 : 0);
 }
 
 void AudioStretcher::Clear()
@@ -32,6 +45,10 @@ void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsign
   // We were given actual_samples number of samples, and num_samples were requested from us.
   double current_ratio = static_cast<double>(num_in) / static_cast<double>(num_out);
 
+  const bool fast = Config::Get(Config::MAIN_AUDIO_STRETCH_FAST);
+  if (fast != m_fast)
+    ApplySettings(fast);
+
   const double max_latency = Config::Get(Config::MAIN_AUDIO_STRETCH_LATENCY);
   const double max_backlog = m_sample_rate * max_latency / 1000.0 / m_stretch_ratio;
   const double backlog_fullness = m_sound_touch.numSamples() / max_backlog;
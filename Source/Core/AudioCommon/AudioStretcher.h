@@ -18,10 +18,13 @@ public:
   void Clear();
 
 private:
+  void ApplySettings(bool fast);
+
   unsigned int m_sample_rate;
   std::array<short, 2> m_last_stretched_sample = {};
   soundtouch::SoundTouch m_sound_touch;
   double m_stretch_ratio = 1.0;
+  bool m_fast = false;
 };
 
 }  // namespace AudioCommon
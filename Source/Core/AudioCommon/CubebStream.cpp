@@ -19,6 +19,7 @@
 
 // ~10 ms - needs to be at least 240 for surround
 constexpr u32 BUFFER_SAMPLES = 512;
+constexpr u32 SURROUND_MIN_SAMPLES = 240;
 
 long CubebStream::DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                                void* output_buffer, long num_frames)
@@ -91,10 +92,24 @@ bool CubebStream::Init()
         ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
       INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
-      return_value =
-          cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                            nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
-                            DataCallback, StateCallback, this) == CUBEB_OK;
+      // In low latency mode, use the smallest buffer the device reports it can handle.
+      u32 latency_frames = std::max(BUFFER_SAMPLES, minimum_latency);
+      if (Config::Get(Config::MAIN_AUDIO_LOW_LATENCY) && minimum_latency != 0)
+      {
+        latency_frames =
+            m_stereo ? minimum_latency : std::max(SURROUND_MIN_SAMPLES, minimum_latency);
+      }
+
+      return_value = cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr,
+                                       nullptr, nullptr, &params, latency_frames, DataCallback,
+                                       StateCallback, this) == CUBEB_OK;
+
+      u32 output_latency = 0;
+      if (return_value && cubeb_stream_get_latency(m_stream, &output_latency) == CUBEB_OK)
+      {
+        NOTICE_LOG_FMT(AUDIO, "Cubeb output latency: {} frames ({:.1f} ms)", output_latency,
+                       output_latency * 1000.0 / params.rate);
+      }
     }
 
 #ifdef _WIN32
@@ -58,7 +58,7 @@ void Mixer::DoState(PointerWrap& p)
 }
 
 // Executed from sound stream thread
-unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
+unsigned int Mixer::MixerFifo::Mix(s32* samples, unsigned int numSamples,
                                    bool consider_framelimit, float emulationspeed,
                                    int timing_variance)
 {
@@ -116,15 +116,13 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
     s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
     int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
     sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
+    samples[currentSample + 1] += sampleL;
 
     s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
     s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
     int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
     sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
+    samples[currentSample] += sampleR;
 
     m_frac += ratio;
     indexR += 2 * (u16)(m_frac >> 16);
@@ -142,11 +140,8 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s[1] = (s[1] * lvolume) >> 8;
   for (; currentSample < numSamples * 2; currentSample += 2)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
-
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+    samples[currentSample + 0] += s[0];
+    samples[currentSample + 1] += s[1];
   }
 
   // Flush cached variable
@@ -155,13 +150,19 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   return actual_sample_count;
 }
 
+// All sources are added up in 32 bits and clamped once at the end, so that
+// loud sources don't clip each other halfway through the mix.
+static void ClampMixBus(short* out, const s32* in, unsigned int num_samples)
+{
+  for (unsigned int i = 0; i < num_samples * 2; ++i)
+    out[i] = static_cast<short>(std::clamp(in[i], -32767, 32767));
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
     return 0;
 
-  memset(samples, 0, num_samples * 2 * sizeof(short));
-
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
@@ -176,21 +177,16 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
                m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
                available_samples, MAX_SAMPLES, num_samples);
 
-    m_scratch_buffer.fill(0);
-
-    m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
-    m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
-    m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
+    s32* const mix_bus = GetMixBus(available_samples);
+    m_dma_mixer.Mix(mix_bus, available_samples, false, emulation_speed, timing_variance);
+    m_streaming_mixer.Mix(mix_bus, available_samples, false, emulation_speed, timing_variance);
+    m_wiimote_speaker_mixer.Mix(mix_bus, available_samples, false, emulation_speed,
                                 timing_variance);
-    m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
+    m_skylander_portal_mixer.Mix(mix_bus, available_samples, false, emulation_speed,
                                  timing_variance);
     for (auto& mixer : m_gba_mixers)
-    {
-      mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
-    }
+      mixer.Mix(mix_bus, available_samples, false, emulation_speed, timing_variance);
+    ClampMixBus(m_scratch_buffer.data(), mix_bus, available_samples);
 
     if (!m_is_stretching)
     {
@@ -202,18 +198,29 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    s32* const mix_bus = GetMixBus(num_samples);
+    m_dma_mixer.Mix(mix_bus, num_samples, true, emulation_speed, timing_variance);
+    m_streaming_mixer.Mix(mix_bus, num_samples, true, emulation_speed, timing_variance);
+    m_wiimote_speaker_mixer.Mix(mix_bus, num_samples, true, emulation_speed, timing_variance);
+    m_skylander_portal_mixer.Mix(mix_bus, num_samples, true, emulation_speed, timing_variance);
     for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+      mixer.Mix(mix_bus, num_samples, true, emulation_speed, timing_variance);
+    ClampMixBus(samples, mix_bus, num_samples);
     m_is_stretching = false;
   }
 
   return num_samples;
 }
 
+s32* Mixer::GetMixBus(unsigned int num_samples)
+{
+  // Only grows, so the audio thread doesn't allocate once it has seen its largest request.
+  if (m_mix_bus.size() < num_samples * 2)
+    m_mix_bus.resize(num_samples * 2);
+  std::fill_n(m_mix_bus.begin(), num_samples * 2, 0);
+  return m_mix_bus.data();
+}
+
 unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 {
   if (!num_samples)
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
 #include "AudioCommon/SurroundDecoder.h"
@@ -72,7 +73,8 @@ private:
     }
     void DoState(PointerWrap& p);
     void PushSamples(const short* samples, unsigned int num_samples);
-    unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
+    // Adds the samples to a 32-bit mix bus, which is clamped by Mixer::Mix.
+    unsigned int Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
                      float emulationspeed, int timing_variance);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
@@ -96,6 +98,9 @@ private:
 
   void RefreshConfig();
 
+  // Returns a zeroed mix bus that is large enough for num_samples stereo samples.
+  s32* GetMixBus(unsigned int num_samples);
+
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
   MixerFifo m_wiimote_speaker_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 3000, true};
@@ -110,6 +115,7 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  std::vector<s32> m_mix_bus;
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
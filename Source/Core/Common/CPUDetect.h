@@ -14,6 +14,9 @@ enum class CPUVendor
   Other,
 };
 
+// The JITs and the asm routines check these flags while emitting each instruction, and pick the
+// best sequence the host supports there. There is no separate emitter per feature level, so
+// every sequence is emitted for exactly one feature level and there is nothing to dispatch.
 struct CPUInfo
 {
   CPUVendor vendor = CPUVendor::Other;
@@ -46,14 +46,26 @@ public:
     Verify,
   };
 
+  // An array that was left out of the buffer while gathering. It belongs at offset in the buffer,
+  // in front of whatever was written there.
+  struct GatheredArray
+  {
+    size_t offset;
+    const u8* data;
+    size_t size;
+  };
+
 private:
   u8** m_ptr_current;
+  u8* m_ptr_start;
   u8* m_ptr_end;
   Mode m_mode;
+  bool m_incremental = false;
+  std::vector<GatheredArray>* m_gathered_arrays = nullptr;
 
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
-      : m_ptr_current(ptr), m_ptr_end(*ptr + size), m_mode(mode)
+      : m_ptr_current(ptr), m_ptr_start(*ptr), m_ptr_end(*ptr + size), m_mode(mode)
   {
   }
 
@@ -64,6 +76,19 @@ public:
   bool IsMeasureMode() const { return m_mode == Mode::Measure; }
   bool IsVerifyMode() const { return m_mode == Mode::Verify; }
 
+  // Incremental states leave out the parts of emulated memory that haven't changed since a base
+  // state, and can only be loaded on top of that base state.
+  void SetIncremental(bool incremental) { m_incremental = incremental; }
+  bool IsIncremental() const { return m_incremental; }
+
+  // While gathering, arrays passed to DoLiveArray aren't copied into the buffer in write mode but
+  // recorded in gathered_arrays, which saves copying most of emulated memory when the state can be
+  // consumed before emulation resumes. Measure mode has to gather too, so that it leaves them out.
+  void SetGatherTarget(std::vector<GatheredArray>* gathered_arrays)
+  {
+    m_gathered_arrays = gathered_arrays;
+  }
+
   template <typename K, class V>
   void Do(std::map<K, V>& x)
   {
@@ -214,6 +239,24 @@ public:
     DoArray(arr, static_cast<u32>(N));
   }
 
+  // Like DoArray, but when gathering, x is referred to instead of copied. It has to stay unchanged
+  // until the gathered state has been consumed.
+  template <typename T, typename std::enable_if_t<std::is_trivially_copyable_v<T>, int> = 0>
+  void DoLiveArray(T* x, u32 count)
+  {
+    if (m_gathered_arrays && (IsWriteMode() || IsMeasureMode()))
+    {
+      if (IsWriteMode())
+      {
+        m_gathered_arrays->push_back({static_cast<size_t>(*m_ptr_current - m_ptr_start),
+                                      reinterpret_cast<const u8*>(x), count * sizeof(T)});
+      }
+      return;
+    }
+
+    DoArray(x, count);
+  }
+
   // The caller is required to inspect the mode of this PointerWrap
   // and deal with the pointer returned from this function themself.
   [[nodiscard]] u8* DoExternal(u32& count)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <vector>
 
 #include "Common/Assert.h"
@@ -97,6 +98,12 @@ public:
   {
     Common::UnWriteProtectMemory(region, region_size, allow_execute);
   }
+  // Covers the children too, since they share our allocation.
+  bool AdviseHugePages() { return Common::AdviseHugePages(region, total_region_size); }
+  std::optional<size_t> GetHugePageBackedSize() const
+  {
+    return Common::GetHugePageBackedSize(region, total_region_size);
+  }
   void ResetCodePtr() { T::SetCodePtr(region, region + region_size); }
   size_t GetSpaceLeft() const
   {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -38,25 +39,109 @@ struct CachedValue
   u64 config_version;
 };
 
+namespace detail
+{
+template <typename T>
+struct IsAlwaysLockFree : std::bool_constant<std::atomic<T>::is_always_lock_free>
+{
+};
+
+// Only instantiates std::atomic<T> for trivially copyable types.
+template <typename T>
+constexpr bool IsAtomicCacheable =
+    std::conjunction_v<std::is_trivially_copyable<T>, IsAlwaysLockFree<T>>;
+
+template <typename T, bool = IsAtomicCacheable<T>>
+class ValueCache
+{
+public:
+  explicit ValueCache(const T& value) : m_cached_value{value, 0} {}
+
+  CachedValue<T> Get() const
+  {
+    std::shared_lock lock(m_mutex);
+    return m_cached_value;
+  }
+
+  void Set(const CachedValue<T>& cached_value)
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_cached_value.config_version < cached_value.config_version)
+      m_cached_value = cached_value;
+  }
+
+  void Reset(const CachedValue<T>& cached_value)
+  {
+    std::unique_lock lock(m_mutex);
+    m_cached_value = cached_value;
+  }
+
+private:
+  CachedValue<T> m_cached_value;
+  mutable std::shared_mutex m_mutex;
+};
+
+// Reading this is two atomic loads, so that Config::Get costs about as much as a plain load.
+//
+// Writers are serialized, and store the value before its version. A reader that sees a version
+// therefore sees that value or a newer one, which Config::Get is fine with.
+template <typename T>
+class ValueCache<T, true>
+{
+public:
+  explicit ValueCache(const T& value) : m_value{value} {}
+
+  CachedValue<T> Get() const
+  {
+    const u64 config_version = m_config_version.load(std::memory_order_acquire);
+    return {m_value.load(std::memory_order_relaxed), config_version};
+  }
+
+  void Set(const CachedValue<T>& cached_value)
+  {
+    std::lock_guard lock(m_write_mutex);
+    if (m_config_version.load(std::memory_order_relaxed) < cached_value.config_version)
+      Store(cached_value);
+  }
+
+  void Reset(const CachedValue<T>& cached_value)
+  {
+    std::lock_guard lock(m_write_mutex);
+    Store(cached_value);
+  }
+
+private:
+  void Store(const CachedValue<T>& cached_value)
+  {
+    m_value.store(cached_value.value, std::memory_order_relaxed);
+    m_config_version.store(cached_value.config_version, std::memory_order_release);
+  }
+
+  std::atomic<T> m_value;
+  std::atomic<u64> m_config_version{0};
+  std::mutex m_write_mutex;
+};
+}  // namespace detail
+
 template <typename T>
 class Info
 {
 public:
   constexpr Info(const Location& location, const T& default_value)
-      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value, 0}
+      : m_location{location}, m_default_value{default_value}, m_cache{default_value}
   {
   }
 
-  Info(const Info<T>& other) { *this = other; }
+  Info(const Info<T>& other) : m_cache{other.GetDefaultValue()} { *this = other; }
 
   // Not thread-safe
-  Info(Info<T>&& other) { *this = std::move(other); }
+  Info(Info<T>&& other) : m_cache{other.GetDefaultValue()} { *this = std::move(other); }
 
   // Make it easy to convert Info<Enum> into Info<UnderlyingType<Enum>>
   // so that enum settings can still easily work with code that doesn't care about the enum values.
   template <typename Enum,
             std::enable_if_t<std::is_same<T, detail::UnderlyingType<Enum>>::value>* = nullptr>
-  Info(const Info<Enum>& other)
+  Info(const Info<Enum>& other) : m_cache{static_cast<T>(other.GetDefaultValue())}
   {
     *this = other;
   }
@@ -65,7 +150,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = other.GetDefaultValue();
-    m_cached_value = other.GetCachedValue();
+    m_cache.Reset(other.GetCachedValue());
     return *this;
   }
 
@@ -74,7 +159,7 @@ public:
   {
     m_location = std::move(other.m_location);
     m_default_value = std::move(other.m_default_value);
-    m_cached_value = std::move(other.m_cached_value);
+    m_cache.Reset(other.GetCachedValue());
     return *this;
   }
 
@@ -86,38 +171,29 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = static_cast<T>(other.GetDefaultValue());
-    m_cached_value = other.template GetCachedValueCasted<T>();
+    m_cache.Reset(other.template GetCachedValueCasted<T>());
     return *this;
   }
 
   constexpr const Location& GetLocation() const { return m_location; }
   constexpr const T& GetDefaultValue() const { return m_default_value; }
 
-  CachedValue<T> GetCachedValue() const
-  {
-    std::shared_lock lock(m_cached_value_mutex);
-    return m_cached_value;
-  }
+  CachedValue<T> GetCachedValue() const { return m_cache.Get(); }
 
   template <typename U>
   CachedValue<U> GetCachedValueCasted() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
+    const CachedValue<T> cached_value = m_cache.Get();
+    return CachedValue<U>{static_cast<U>(cached_value.value), cached_value.config_version};
   }
 
-  void SetCachedValue(const CachedValue<T>& cached_value) const
-  {
-    std::unique_lock lock(m_cached_value_mutex);
-    if (m_cached_value.config_version < cached_value.config_version)
-      m_cached_value = cached_value;
-  }
+  // Only replaces the cached value with a newer one.
+  void SetCachedValue(const CachedValue<T>& cached_value) const { m_cache.Set(cached_value); }
 
 private:
   Location m_location;
   T m_default_value;
 
-  mutable CachedValue<T> m_cached_value;
-  mutable std::shared_mutex m_cached_value_mutex;
+  mutable detail::ValueCache<T> m_cache;
 };
 }  // namespace Config
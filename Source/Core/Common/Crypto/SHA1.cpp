@@ -51,6 +51,7 @@ public:
     ASSERT(!mbedtls_sha1_finish_ret(&ctx, digest.data()));
     return digest;
   }
+  virtual void Reset() override { ASSERT(!mbedtls_sha1_starts_ret(&ctx)); }
   virtual bool HwAccelerated() const override { return false; }
 
 private:
@@ -66,6 +67,14 @@ protected:
 
   virtual void ProcessBlock(const u8* msg) = 0;
   virtual Digest GetDigest() = 0;
+  virtual void ResetState() = 0;
+
+  virtual void Reset() override
+  {
+    block_used = 0;
+    msg_len = 0;
+    ResetState();
+  }
 
   virtual void Update(const u8* msg, size_t len) override
   {
@@ -159,13 +168,15 @@ private:
 class ContextX64SHA1 final : public BlockContext
 {
 public:
-  ContextX64SHA1()
+  ContextX64SHA1() { ResetState(); }
+
+private:
+  virtual void ResetState() override
   {
     state[0] = _mm_set_epi32(H[0], H[1], H[2], H[3]);
     state[1] = _mm_set_epi32(H[4], 0, 0, 0);
   }
 
-private:
   struct XmmReg
   {
     // Allows aliasing attributes to be respected in the
@@ -267,13 +278,15 @@ private:
 class ContextNeon final : public BlockContext
 {
 public:
-  ContextNeon()
+  ContextNeon() { ResetState(); }
+
+private:
+  virtual void ResetState() override
   {
     state.abcd = vld1q_u32(&H[0]);
     state.e = H[4];
   }
 
-private:
   using WorkBlock = CyclicArray<uint32x4_t, 4>;
 
   struct State
@@ -386,6 +399,18 @@ Digest CalculateDigest(const u8* msg, size_t len)
   return ctx->Finish();
 }
 
+void CalculateDigests(const u8* msg, size_t len, size_t count, Digest* out)
+{
+  auto ctx = CreateContext();
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i != 0)
+      ctx->Reset();
+    ctx->Update(msg + i * len, len);
+    out[i] = ctx->Finish();
+  }
+}
+
 std::string DigestToString(const Digest& digest)
 {
   static constexpr std::array<char, 16> lookup = {'0', '1', '2', '3', '4', '5', '6', '7',
@@ -30,6 +30,8 @@ public:
     return Update(reinterpret_cast<const u8*>(msg.data()), msg.size());
   }
   virtual Digest Finish() = 0;
+  // Starts a new message, so that one context can be used for many digests.
+  virtual void Reset() = 0;
   virtual bool HwAccelerated() const = 0;
 };
 
@@ -37,6 +39,10 @@ std::unique_ptr<Context> CreateContext();
 
 Digest CalculateDigest(const u8* msg, size_t len);
 
+// Calculates the digests of count consecutive messages of len bytes each, using one context.
+// This is much cheaper than calling CalculateDigest for each message when the messages are small.
+void CalculateDigests(const u8* msg, size_t len, size_t count, Digest* out);
+
 template <typename T>
 inline Digest CalculateDigest(const std::vector<T>& msg)
 {
@@ -0,0 +1,381 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/DRMDisplay.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <gbm.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+
+#include <fmt/format.h>
+
+#include "Common/Logging/Log.h"
+
+namespace Common
+{
+struct DRMDisplay::SavedCrtc
+{
+  u32 buffer_id;
+  u32 x;
+  u32 y;
+  drmModeModeInfo mode;
+};
+
+std::unique_ptr<DRMDisplay> DRMDisplay::Create()
+{
+  for (int i = 0; i < 4; ++i)
+  {
+    std::unique_ptr<DRMDisplay> display(new DRMDisplay());
+    if (display->Open(fmt::format("/dev/dri/card{}", i)))
+      return display;
+  }
+
+  ERROR_LOG_FMT(VIDEO, "No DRM device with a connected display was found");
+  return nullptr;
+}
+
+DRMDisplay::~DRMDisplay()
+{
+  DestroySurface();
+
+  if (m_saved_crtc)
+  {
+    drmModeSetCrtc(m_fd, m_crtc_id, m_saved_crtc->buffer_id, m_saved_crtc->x, m_saved_crtc->y,
+                   &m_connector_id, 1, &m_saved_crtc->mode);
+  }
+  if (m_mode_blob_id)
+    drmModeDestroyPropertyBlob(m_fd, m_mode_blob_id);
+  if (m_gbm_device)
+    gbm_device_destroy(m_gbm_device);
+  if (m_fd >= 0)
+    close(m_fd);
+}
+
+bool DRMDisplay::Open(const std::string& path)
+{
+  m_fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+  if (m_fd < 0)
+    return false;
+
+  if (drmSetClientCap(m_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) != 0 ||
+      drmSetClientCap(m_fd, DRM_CLIENT_CAP_ATOMIC, 1) != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "{} does not support atomic modesetting", path);
+    return false;
+  }
+
+  if (!FindPipe())
+    return false;
+
+  m_gbm_device = gbm_create_device(m_fd);
+  if (!m_gbm_device)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create a GBM device for {}", path);
+    return false;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Using {} at {}x{} {:.2f} Hz", path, m_width, m_height, m_refresh_rate);
+  return true;
+}
+
+// Picks the first connected connector with its preferred mode, and a CRTC and primary plane that
+// can drive it.
+bool DRMDisplay::FindPipe()
+{
+  drmModeRes* resources = drmModeGetResources(m_fd);
+  if (!resources)
+    return false;
+
+  drmModeConnector* connector = nullptr;
+  for (int i = 0; i < resources->count_connectors && !connector; ++i)
+  {
+    connector = drmModeGetConnector(m_fd, resources->connectors[i]);
+    if (connector &&
+        (connector->connection != DRM_MODE_CONNECTED || connector->count_modes == 0))
+    {
+      drmModeFreeConnector(connector);
+      connector = nullptr;
+    }
+  }
+  if (!connector)
+  {
+    drmModeFreeResources(resources);
+    return false;
+  }
+
+  const drmModeModeInfo* mode = &connector->modes[0];
+  for (int i = 0; i < connector->count_modes; ++i)
+  {
+    if (connector->modes[i].type & DRM_MODE_TYPE_PREFERRED)
+    {
+      mode = &connector->modes[i];
+      break;
+    }
+  }
+
+  // Prefer the CRTC that already drives the connector, so that the console doesn't flicker.
+  int crtc_index = -1;
+  if (drmModeEncoder* encoder = drmModeGetEncoder(m_fd, connector->encoder_id))
+  {
+    for (int i = 0; i < resources->count_crtcs; ++i)
+    {
+      if (resources->crtcs[i] == encoder->crtc_id)
+        crtc_index = i;
+    }
+    drmModeFreeEncoder(encoder);
+  }
+  for (int i = 0; i < connector->count_encoders && crtc_index < 0; ++i)
+  {
+    drmModeEncoder* encoder = drmModeGetEncoder(m_fd, connector->encoders[i]);
+    if (!encoder)
+      continue;
+    for (int j = 0; j < resources->count_crtcs && crtc_index < 0; ++j)
+    {
+      if (encoder->possible_crtcs & (1u << j))
+        crtc_index = j;
+    }
+    drmModeFreeEncoder(encoder);
+  }
+
+  if (crtc_index >= 0)
+  {
+    m_connector_id = connector->connector_id;
+    m_crtc_id = resources->crtcs[crtc_index];
+    m_width = mode->hdisplay;
+    m_height = mode->vdisplay;
+    m_refresh_rate = mode->htotal && mode->vtotal ?
+                         mode->clock * 1000.0 / (mode->htotal * mode->vtotal) :
+                         mode->vrefresh;
+    drmModeCreatePropertyBlob(m_fd, mode, sizeof(*mode), &m_mode_blob_id);
+  }
+  drmModeFreeConnector(connector);
+  drmModeFreeResources(resources);
+  if (!m_mode_blob_id)
+    return false;
+
+  if (drmModeCrtc* crtc = drmModeGetCrtc(m_fd, m_crtc_id))
+  {
+    m_saved_crtc = std::make_unique<SavedCrtc>(
+        SavedCrtc{crtc->buffer_id, crtc->x, crtc->y, crtc->mode});
+    drmModeFreeCrtc(crtc);
+  }
+
+  drmModePlaneRes* planes = drmModeGetPlaneResources(m_fd);
+  if (!planes)
+    return false;
+  for (u32 i = 0; i < planes->count_planes && !m_plane_id; ++i)
+  {
+    drmModePlane* plane = drmModeGetPlane(m_fd, planes->planes[i]);
+    if (!plane)
+      continue;
+    if (plane->possible_crtcs & (1u << crtc_index))
+    {
+      drmModeObjectProperties* props =
+          drmModeObjectGetProperties(m_fd, plane->plane_id, DRM_MODE_OBJECT_PLANE);
+      for (u32 j = 0; props && j < props->count_props; ++j)
+      {
+        drmModePropertyRes* prop = drmModeGetProperty(m_fd, props->props[j]);
+        if (prop && std::string_view(prop->name) == "type" &&
+            props->prop_values[j] == DRM_PLANE_TYPE_PRIMARY)
+        {
+          m_plane_id = plane->plane_id;
+        }
+        drmModeFreeProperty(prop);
+      }
+      drmModeFreeObjectProperties(props);
+    }
+    drmModeFreePlane(plane);
+  }
+  drmModeFreePlaneResources(planes);
+
+  return m_plane_id != 0;
+}
+
+u32 DRMDisplay::GetPropertyID(u32 object_id, u32 object_type, const char* name) const
+{
+  u32 id = 0;
+  drmModeObjectProperties* props = drmModeObjectGetProperties(m_fd, object_id, object_type);
+  for (u32 i = 0; props && i < props->count_props && !id; ++i)
+  {
+    drmModePropertyRes* prop = drmModeGetProperty(m_fd, props->props[i]);
+    if (prop && std::string_view(prop->name) == name)
+      id = prop->prop_id;
+    drmModeFreeProperty(prop);
+  }
+  drmModeFreeObjectProperties(props);
+  return id;
+}
+
+gbm_surface* DRMDisplay::CreateSurface(u32 format)
+{
+  DestroySurface();
+  m_gbm_surface = gbm_surface_create(m_gbm_device, m_width, m_height, format,
+                                     GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+  if (!m_gbm_surface)
+    ERROR_LOG_FMT(VIDEO, "Failed to create a {}x{} GBM surface", m_width, m_height);
+  return m_gbm_surface;
+}
+
+void DRMDisplay::DestroySurface()
+{
+  if (!m_gbm_surface)
+    return;
+
+  while (m_pending_bo && HandleEvents(true))
+  {
+  }
+  if (m_pending_bo)
+    gbm_surface_release_buffer(m_gbm_surface, m_pending_bo);
+  if (m_scanout_bo)
+    gbm_surface_release_buffer(m_gbm_surface, m_scanout_bo);
+  m_pending_bo = nullptr;
+  m_scanout_bo = nullptr;
+
+  gbm_surface_destroy(m_gbm_surface);
+  m_gbm_surface = nullptr;
+}
+
+void DRMDisplay::SetPageFlipCallback(PageFlipCallback callback)
+{
+  m_page_flip_callback = std::move(callback);
+}
+
+// Framebuffers are created once per buffer of the surface, and removed along with the buffer.
+u32 DRMDisplay::GetFramebuffer(gbm_bo* bo)
+{
+  if (void* data = gbm_bo_get_user_data(bo))
+    return static_cast<u32>(reinterpret_cast<uintptr_t>(data));
+
+  const u32 handles[4] = {gbm_bo_get_handle(bo).u32};
+  const u32 pitches[4] = {gbm_bo_get_stride(bo)};
+  const u32 offsets[4] = {};
+  u32 framebuffer = 0;
+  if (drmModeAddFB2(m_fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo), gbm_bo_get_format(bo),
+                    handles, pitches, offsets, &framebuffer, 0) != 0)
+  {
+    ERROR_LOG_FMT(VIDEO, "drmModeAddFB2 failed: {}", errno);
+    return 0;
+  }
+
+  gbm_bo_set_user_data(bo, reinterpret_cast<void*>(static_cast<uintptr_t>(framebuffer)),
+                       [](gbm_bo* destroyed_bo, void* data) {
+                         const int fd = gbm_device_get_fd(gbm_bo_get_device(destroyed_bo));
+                         drmModeRmFB(fd, static_cast<u32>(reinterpret_cast<uintptr_t>(data)));
+                       });
+  return framebuffer;
+}
+
+bool DRMDisplay::Commit(u32 framebuffer)
+{
+  drmModeAtomicReq* req = drmModeAtomicAlloc();
+  if (!req)
+    return false;
+
+  const auto add = [&](u32 object_id, u32 object_type, const char* name, u64 value) {
+    drmModeAtomicAddProperty(req, object_id, GetPropertyID(object_id, object_type, name), value);
+  };
+
+  u32 flags = DRM_MODE_PAGE_FLIP_EVENT;
+  if (!m_modeset_done)
+  {
+    add(m_connector_id, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID", m_crtc_id);
+    add(m_crtc_id, DRM_MODE_OBJECT_CRTC, "MODE_ID", m_mode_blob_id);
+    add(m_crtc_id, DRM_MODE_OBJECT_CRTC, "ACTIVE", 1);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_ID", m_crtc_id);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_X", 0);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_Y", 0);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_W", u64(m_width) << 16);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_H", u64(m_height) << 16);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_X", 0);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_Y", 0);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_W", m_width);
+    add(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_H", m_height);
+    flags |= DRM_MODE_ATOMIC_ALLOW_MODESET;
+  }
+  else
+  {
+    flags |= DRM_MODE_ATOMIC_NONBLOCK;
+  }
+  add(m_plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID", framebuffer);
+
+  const int result = drmModeAtomicCommit(m_fd, req, flags, this);
+  drmModeAtomicFree(req);
+  if (result != 0)
+  {
+    ERROR_LOG_FMT(VIDEO, "Atomic commit failed: {}", -result);
+    return false;
+  }
+
+  m_modeset_done = true;
+  return true;
+}
+
+void DRMDisplay::Present(bool vsync)
+{
+  if (!m_gbm_surface)
+    return;
+
+  gbm_bo* bo = gbm_surface_lock_front_buffer(m_gbm_surface);
+  if (!bo)
+    return;
+
+  // Pick up a page flip that has completed in the meantime.
+  HandleEvents(false);
+  while (vsync && m_pending_bo && HandleEvents(true))
+  {
+  }
+
+  const u32 framebuffer = m_pending_bo ? 0 : GetFramebuffer(bo);
+  if (!framebuffer || !Commit(framebuffer))
+  {
+    gbm_surface_release_buffer(m_gbm_surface, bo);
+    return;
+  }
+
+  m_pending_bo = bo;
+}
+
+// Returns false if no events could be read.
+bool DRMDisplay::HandleEvents(bool wait)
+{
+  pollfd fd = {m_fd, POLLIN, 0};
+  int result;
+  while ((result = poll(&fd, 1, wait ? -1 : 0)) < 0 && errno == EINTR)
+  {
+  }
+  if (result <= 0)
+    return false;
+
+  drmEventContext context = {};
+  context.version = 2;
+  context.page_flip_handler = [](int, unsigned int, unsigned int tv_sec, unsigned int tv_usec,
+                                 void* user_data) {
+    static_cast<DRMDisplay*>(user_data)->OnPageFlip(tv_sec, tv_usec);
+  };
+  return drmHandleEvent(m_fd, &context) == 0;
+}
+
+void DRMDisplay::OnPageFlip(unsigned int tv_sec, unsigned int tv_usec)
+{
+  if (m_scanout_bo)
+    gbm_surface_release_buffer(m_gbm_surface, m_scanout_bo);
+  m_scanout_bo = m_pending_bo;
+  m_pending_bo = nullptr;
+
+  // Page flip timestamps are taken from CLOCK_MONOTONIC, like steady_clock.
+  if (m_page_flip_callback)
+  {
+    m_page_flip_callback(TimePoint(std::chrono::duration_cast<DT>(
+        std::chrono::seconds(tv_sec) + std::chrono::microseconds(tv_usec))));
+  }
+}
+}  // namespace Common
@@ -0,0 +1,86 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+struct gbm_bo;
+struct gbm_device;
+struct gbm_surface;
+
+namespace Common
+{
+// Drives a display directly through DRM/KMS, without a display server.
+//
+// Rendering goes to the buffers of a GBM surface, which are allocated for scanout. Presenting one
+// of them is an atomic commit that points the primary plane at it, so no copy is made.
+class DRMDisplay
+{
+public:
+  using PageFlipCallback = std::function<void(TimePoint flip_time)>;
+
+  // Opens the first of /dev/dri/card* that has a connected display.
+  static std::unique_ptr<DRMDisplay> Create();
+
+  ~DRMDisplay();
+
+  DRMDisplay(const DRMDisplay&) = delete;
+  DRMDisplay& operator=(const DRMDisplay&) = delete;
+
+  gbm_device* GetGBMDevice() const { return m_gbm_device; }
+  u32 GetWidth() const { return m_width; }
+  u32 GetHeight() const { return m_height; }
+  double GetRefreshRate() const { return m_refresh_rate; }
+
+  // Creates the surface that gets scanned out, in the given GBM format.
+  gbm_surface* CreateSurface(u32 format);
+  void DestroySurface();
+
+  // Called on the presenting thread whenever a page flip has completed.
+  void SetPageFlipCallback(PageFlipCallback callback);
+
+  // Scans out the buffer that was last swapped to the surface. With vsync, this waits for the
+  // page flip of the previous buffer first. Otherwise, the buffer is dropped if that flip is still
+  // pending, so that rendering never waits for the display.
+  void Present(bool vsync);
+
+private:
+  DRMDisplay() = default;
+
+  bool Open(const std::string& path);
+  bool FindPipe();
+  u32 GetPropertyID(u32 object_id, u32 object_type, const char* name) const;
+  u32 GetFramebuffer(gbm_bo* bo);
+  bool Commit(u32 framebuffer);
+  bool HandleEvents(bool wait);
+  void OnPageFlip(unsigned int tv_sec, unsigned int tv_usec);
+
+  int m_fd = -1;
+  gbm_device* m_gbm_device = nullptr;
+  gbm_surface* m_gbm_surface = nullptr;
+
+  u32 m_connector_id = 0;
+  u32 m_crtc_id = 0;
+  u32 m_plane_id = 0;
+  u32 m_mode_blob_id = 0;
+  u32 m_width = 0;
+  u32 m_height = 0;
+  double m_refresh_rate = 0;
+  bool m_modeset_done = false;
+
+  // The CRTC configuration from before we took over, restored on destruction.
+  struct SavedCrtc;
+  std::unique_ptr<SavedCrtc> m_saved_crtc;
+
+  // The buffer on screen, and the one whose page flip is pending.
+  gbm_bo* m_scanout_bo = nullptr;
+  gbm_bo* m_pending_bo = nullptr;
+
+  PageFlipCallback m_page_flip_callback;
+};
+}  // namespace Common
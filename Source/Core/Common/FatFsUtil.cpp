@@ -6,12 +6,17 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <filesystem>
 #include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 // Does not compile if diskio.h is included first.
 // clang-format off
@@ -20,6 +25,7 @@
 // clang-format on
 
 #include "Common/Align.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
@@ -483,6 +489,97 @@ static bool Pack(const std::function<bool()>& cancelled, const File::FSTEntry& e
   return true;
 }
 
+// Describes the SD folder and image as they were after the last successful sync between them.
+// Whenever both still match it, they still have the same contents and the sync can be skipped.
+struct SyncState
+{
+  std::string folder_fingerprint;
+  u64 image_size = 0;
+  s64 image_time = 0;
+  u64 configured_image_size = 0;
+  bool deterministic = false;
+
+  bool operator==(const SyncState&) const = default;
+};
+
+static std::string GetSyncStatePath(const std::string& image_path)
+{
+  return image_path + ".sync";
+}
+
+// Hashes the names, sizes and modification times of everything in the folder. Returns an empty
+// string if the folder couldn't be scanned.
+static std::string GetFolderFingerprint(const std::string& folder)
+{
+  const std::filesystem::path root = StringToPath(folder);
+  std::vector<std::string> entries;
+  std::error_code error;
+  for (std::filesystem::recursive_directory_iterator it(root, error), end; !error && it != end;
+       it.increment(error))
+  {
+    const bool is_directory = it->is_directory(error);
+    const u64 size = is_directory || error ? 0 : it->file_size(error);
+    const auto time = error ? 0 : it->last_write_time(error).time_since_epoch().count();
+    if (error)
+      break;
+    const std::string name = PathToString(it->path().lexically_relative(root));
+    entries.push_back(fmt::format("{}\n{}\n{}\n{}", name, is_directory, size, time));
+  }
+  if (error)
+    return {};
+
+  std::sort(entries.begin(), entries.end());
+  const auto context = Common::SHA1::CreateContext();
+  for (const std::string& entry : entries)
+    context->Update(std::string_view(entry.c_str(), entry.size() + 1));
+  return fmt::format("{:02x}", fmt::join(context->Finish(), ""));
+}
+
+static bool GetImageStatus(const std::string& image_path, SyncState* state)
+{
+  std::error_code error;
+  const std::filesystem::path path = StringToPath(image_path);
+  state->image_size = std::filesystem::file_size(path, error);
+  if (!error)
+    state->image_time = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+  return !error;
+}
+
+static std::optional<SyncState> ReadSyncState(const std::string& image_path)
+{
+  std::string contents;
+  if (!File::ReadFileToString(GetSyncStatePath(image_path), contents))
+    return std::nullopt;
+
+  std::istringstream stream(contents);
+  std::string version;
+  SyncState state;
+  if (!(stream >> version >> state.folder_fingerprint >> state.image_size >> state.image_time >>
+        state.configured_image_size >> state.deterministic) ||
+      version != "v1")
+  {
+    return std::nullopt;
+  }
+  return state;
+}
+
+static void WriteSyncState(const std::string& image_path, const std::string& folder,
+                           u64 configured_image_size, bool deterministic)
+{
+  SyncState state;
+  state.folder_fingerprint = GetFolderFingerprint(folder);
+  state.configured_image_size = configured_image_size;
+  state.deterministic = deterministic;
+  if (state.folder_fingerprint.empty() || !GetImageStatus(image_path, &state))
+    return;
+
+  const std::string contents =
+      fmt::format("v1 {} {} {} {} {}\n", state.folder_fingerprint, state.image_size,
+                  state.image_time, state.configured_image_size, state.deterministic ? 1 : 0);
+  if (!File::WriteStringToFile(GetSyncStatePath(image_path), contents))
+    WARN_LOG_FMT(COMMON, "Failed to write SD sync state for {}", image_path);
+}
+
 static void SortFST(File::FSTEntry* root)
 {
   std::sort(root->children.begin(), root->children.end(),
@@ -509,13 +606,30 @@ bool SyncSDFolderToSDImage(const std::function<bool()>& cancelled, bool determin
     return false;
   }
 
+  const u64 configured_size = Config::Get(Config::MAIN_WII_SD_CARD_FILESIZE);
+  const std::optional<SyncState> sync_state = ReadSyncState(image_path);
+  if (sync_state)
+  {
+    SyncState current_state;
+    current_state.folder_fingerprint = GetFolderFingerprint(source_dir);
+    current_state.configured_image_size = configured_size;
+    current_state.deterministic = deterministic;
+    if (GetImageStatus(image_path, &current_state) && current_state == *sync_state)
+    {
+      INFO_LOG_FMT(COMMON, "SD image {} is already in sync with folder {}", image_path,
+                   source_dir);
+      return true;
+    }
+  }
+  File::Delete(GetSyncStatePath(image_path), File::IfAbsentBehavior::NoConsoleWarning);
+
   File::FSTEntry root = File::ScanDirectoryTree(source_dir, true);
   if (deterministic)
     SortFST(&root);
   if (!CheckIfFATCompatible(root))
     return false;
 
-  u64 size = Config::Get(Config::MAIN_WII_SD_CARD_FILESIZE);
+  u64 size = configured_size;
   if (size == 0)
   {
     size = GetSize(root);
@@ -601,6 +715,7 @@ bool SyncSDFolderToSDImage(const std::function<bool()>& cancelled, bool determin
   }
 
   image_delete_guard.Dismiss();  // no need to delete the temp file anymore after the rename
+  WriteSyncState(image_path, source_dir, configured_size, deterministic);
 
   INFO_LOG_FMT(COMMON, "Successfully packed folder {} to SD image at {}", source_dir, image_path);
   return true;
@@ -772,6 +887,21 @@ bool SyncSDImageToSDFolder(const std::function<bool()>& cancelled)
   if (image_path.empty() || target_dir.empty())
     return false;
 
+  // If neither has changed since the last sync, the folder already has the image's contents.
+  const std::optional<SyncState> sync_state = ReadSyncState(image_path);
+  if (sync_state)
+  {
+    SyncState current_state = *sync_state;
+    current_state.folder_fingerprint = GetFolderFingerprint(target_dir);
+    if (GetImageStatus(image_path, &current_state) && current_state == *sync_state)
+    {
+      INFO_LOG_FMT(COMMON, "SD folder {} is already in sync with image {}", target_dir,
+                   image_path);
+      return true;
+    }
+  }
+  File::Delete(GetSyncStatePath(image_path), File::IfAbsentBehavior::NoConsoleWarning);
+
   std::lock_guard lk(s_fatfs_mutex);
   SDCardFatFsCallbacks callbacks;
   s_callbacks = &callbacks;
@@ -839,6 +969,8 @@ bool SyncSDImageToSDFolder(const std::function<bool()>& cancelled)
   // even if this fails the conversion has already succeeded, so we still return true
   if (!image.Close())
     ERROR_LOG_FMT(COMMON, "Failed to close SD image {}", image_path);
+  else
+    WriteSyncState(image_path, target_dir, Config::Get(Config::MAIN_WII_SD_CARD_FILESIZE), false);
 
   INFO_LOG_FMT(COMMON, "Successfully unpacked SD image {} to {}", image_path, target_dir);
   return true;
@@ -40,6 +40,7 @@ enum
   D_COVERCACHE_IDX,
   D_REDUMPCACHE_IDX,
   D_SHADERCACHE_IDX,
+  D_JITCACHE_IDX,
   D_RETROACHIEVEMENTSCACHE_IDX,
   D_SHADERS_IDX,
   D_STATESAVES_IDX,
@@ -91,6 +92,7 @@ enum
   F_GCSRAM_IDX,
   F_MEMORYWATCHERLOCATIONS_IDX,
   F_MEMORYWATCHERSOCKET_IDX,
+  F_MEMORYWATCHERSHAREDMEMORY_IDX,
   F_WIISDCARDIMAGE_IDX,
   F_DUALSHOCKUDPCLIENTCONFIG_IDX,
   F_FREELOOKCONFIG_IDX,
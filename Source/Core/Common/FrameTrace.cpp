@@ -0,0 +1,221 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/FrameTrace.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace Common::FrameTrace
+{
+namespace
+{
+// Keeps a runaway event source from using up all memory. Anything past this is dropped.
+constexpr size_t MAX_EVENTS_PER_THREAD = 1 << 20;
+
+struct Event
+{
+  const char* name;
+  u64 start;
+  u64 end;
+};
+
+struct ThreadBuffer
+{
+  std::mutex mutex;
+  u32 id = 0;
+  std::string name;
+  std::vector<Event> events;
+  u64 dropped_count = 0;
+};
+
+// Guards everything below. Only taken when a capture starts or ends, or when a thread first
+// records something.
+std::mutex s_mutex;
+std::vector<std::shared_ptr<ThreadBuffer>> s_buffers;
+u32 s_next_thread_id = 1;
+std::string s_path;
+u32 s_frames_left = 0;
+u64 s_capture_start = 0;
+std::vector<u64> s_frame_times;
+
+thread_local std::shared_ptr<ThreadBuffer> t_buffer;
+
+ThreadBuffer& GetThreadBuffer()
+{
+  if (!t_buffer)
+  {
+    t_buffer = std::make_shared<ThreadBuffer>();
+
+    std::lock_guard lk(s_mutex);
+    t_buffer->id = s_next_thread_id++;
+    t_buffer->name = fmt::format("Thread {}", t_buffer->id);
+    s_buffers.push_back(t_buffer);
+  }
+  return *t_buffer;
+}
+
+void AppendEscaped(fmt::memory_buffer& out, std::string_view str)
+{
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      out.push_back('\\');
+    if (static_cast<unsigned char>(c) >= 0x20)
+      out.push_back(c);
+  }
+}
+
+double ToMicroseconds(u64 timestamp)
+{
+  return static_cast<double>(timestamp - s_capture_start) / 1000.0;
+}
+
+bool WriteTrace(const std::string& path)
+{
+  fmt::memory_buffer out;
+  fmt::format_to(std::back_inserter(out), "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  fmt::format_to(std::back_inserter(out),
+                 "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{{\"name\":"
+                 "\"Dolphin\"}}}},\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+                 "\"args\":{{\"name\":\"Frames\"}}}}");
+
+  for (size_t i = 1; i < s_frame_times.size(); ++i)
+  {
+    fmt::format_to(std::back_inserter(out),
+                   ",\n{{\"name\":\"Frame {}\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":{:.3f},"
+                   "\"dur\":{:.3f}}}",
+                   i, ToMicroseconds(s_frame_times[i - 1]),
+                   (s_frame_times[i] - s_frame_times[i - 1]) / 1000.0);
+  }
+
+  for (const auto& buffer : s_buffers)
+  {
+    std::lock_guard lk(buffer->mutex);
+
+    fmt::format_to(std::back_inserter(out),
+                   ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{"
+                   "\"name\":\"",
+                   buffer->id);
+    AppendEscaped(out, buffer->name);
+    fmt::format_to(std::back_inserter(out), "\"}}}}");
+
+    for (const Event& event : buffer->events)
+    {
+      fmt::format_to(std::back_inserter(out), ",\n{{\"name\":\"");
+      AppendEscaped(out, event.name);
+      fmt::format_to(std::back_inserter(out),
+                     "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                     buffer->id, ToMicroseconds(event.start), (event.end - event.start) / 1000.0);
+    }
+
+    if (buffer->dropped_count != 0)
+    {
+      WARN_LOG_FMT(COMMON, "Frame trace: dropped {} events of thread {}", buffer->dropped_count,
+                   buffer->name);
+    }
+  }
+
+  fmt::format_to(std::back_inserter(out), "\n]}}\n");
+
+  File::CreateFullPath(path);
+  File::IOFile file(path, "wb");
+  return file.WriteBytes(out.data(), out.size());
+}
+}  // namespace
+
+namespace detail
+{
+std::atomic<bool> s_capturing = false;
+
+u64 GetTimestamp()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void AddEvent(const char* name, u64 start, u64 end)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::lock_guard lk(buffer.mutex);
+
+  // The capture may have ended while this event was in progress.
+  if (!IsCapturing())
+    return;
+
+  if (buffer.events.size() < MAX_EVENTS_PER_THREAD)
+    buffer.events.push_back({name, start, end});
+  else
+    ++buffer.dropped_count;
+}
+}  // namespace detail
+
+bool StartCapture(std::string path, u32 frame_count)
+{
+  std::lock_guard lk(s_mutex);
+  if (IsCapturing() || frame_count == 0)
+    return false;
+
+  // Forget threads that have exited since the last capture.
+  std::erase_if(s_buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+  for (const auto& buffer : s_buffers)
+  {
+    std::lock_guard buffer_lk(buffer->mutex);
+    buffer->events.clear();
+    buffer->dropped_count = 0;
+  }
+
+  s_path = std::move(path);
+  s_frames_left = frame_count;
+  s_capture_start = detail::GetTimestamp();
+  s_frame_times.clear();
+  s_frame_times.push_back(s_capture_start);
+  detail::s_capturing.store(true, std::memory_order_relaxed);
+
+  NOTICE_LOG_FMT(COMMON, "Frame trace: capturing {} frames", frame_count);
+  return true;
+}
+
+std::optional<std::string> MarkFrame()
+{
+  if (!IsCapturing())
+    return std::nullopt;
+
+  std::lock_guard lk(s_mutex);
+  if (!IsCapturing())
+    return std::nullopt;
+
+  s_frame_times.push_back(detail::GetTimestamp());
+  if (--s_frames_left != 0)
+    return std::nullopt;
+
+  detail::s_capturing.store(false, std::memory_order_relaxed);
+
+  if (!WriteTrace(s_path))
+  {
+    ERROR_LOG_FMT(COMMON, "Frame trace: failed to write {}", s_path);
+    return std::string();
+  }
+
+  NOTICE_LOG_FMT(COMMON, "Frame trace: wrote {}", s_path);
+  return s_path;
+}
+
+void SetThreadName(const char* name)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::lock_guard lk(buffer.mutex);
+  buffer.name = name;
+}
+}  // namespace Common::FrameTrace
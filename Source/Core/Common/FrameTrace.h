@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Records which parts of the emulator each thread spent its time in over a number of frames, and
+// writes them out in the Chrome trace event format. The result can be opened in Perfetto
+// (https://ui.perfetto.dev) or chrome://tracing.
+//
+// Code marks the regions that should show up in a trace with TRACE_SCOPE. Outside of a capture
+// this costs a relaxed atomic load, and when USE_FRAME_TRACE isn't defined it costs nothing.
+namespace Common::FrameTrace
+{
+namespace detail
+{
+extern std::atomic<bool> s_capturing;
+
+u64 GetTimestamp();
+void AddEvent(const char* name, u64 start, u64 end);
+}  // namespace detail
+
+inline bool IsCapturing()
+{
+  return detail::s_capturing.load(std::memory_order_relaxed);
+}
+
+// Starts recording. The trace is written to path once frame_count frames have been presented.
+// Returns false if a capture is already in progress.
+bool StartCapture(std::string path, u32 frame_count);
+
+// Called by the presenter for every frame shown. When this frame completes a capture, returns the
+// path the trace was written to, or an empty string if writing it failed.
+std::optional<std::string> MarkFrame();
+
+// Names the calling thread in traces. Called by Common::SetCurrentThreadName.
+void SetThreadName(const char* name);
+
+// Records the time between construction and destruction as an event. name must outlive the
+// capture, which in practice means it has to be a string literal.
+class ScopedEvent
+{
+public:
+  explicit ScopedEvent(const char* name)
+      : m_name(name), m_start(IsCapturing() ? detail::GetTimestamp() : 0)
+  {
+  }
+  ~ScopedEvent()
+  {
+    if (m_start != 0)
+      detail::AddEvent(m_name, m_start, detail::GetTimestamp());
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+  const char* m_name;
+  u64 m_start;
+};
+}  // namespace Common::FrameTrace
+
+#ifdef USE_FRAME_TRACE
+#define TRACE_SCOPE_CONCAT_(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)                                                                          \
+  const Common::FrameTrace::ScopedEvent TRACE_SCOPE_CONCAT(trace_scope_, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name)                                                                          \
+  do                                                                                               \
+  {                                                                                                \
+  } while (0)
+#endif
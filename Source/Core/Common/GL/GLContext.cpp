@@ -22,6 +22,9 @@
 #if HAVE_X11
 #include "Common/GL/GLInterface/EGLX11.h"
 #endif
+#if HAVE_DRM
+#include "Common/GL/GLInterface/EGLDRM.h"
+#endif
 #if defined(ANDROID)
 #include "Common/GL/GLInterface/EGLAndroid.h"
 #endif
@@ -73,6 +76,10 @@ void GLContext::SwapInterval(int interval)
 {
 }
 
+void GLContext::SetPageFlipCallback(PageFlipCallback callback)
+{
+}
+
 void* GLContext::GetFuncAddress(const std::string& name)
 {
   return nullptr;
@@ -116,6 +123,10 @@ std::unique_ptr<GLContext> GLContext::Create(const WindowSystemInfo& wsi, bool s
 #if HAVE_EGL
   if (wsi.type == WindowSystemType::Headless || wsi.type == WindowSystemType::FBDev)
     context = std::make_unique<GLContextEGL>();
+#if HAVE_DRM
+  if (wsi.type == WindowSystemType::DRM)
+    context = std::make_unique<GLContextEGLDRM>();
+#endif
 #endif
 
   if (!context)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -42,6 +43,11 @@ public:
   virtual void Swap();
   virtual void SwapInterval(int interval);
 
+  // Sets a function that is called with the time at which each presented frame reached the
+  // display. Only contexts that present through page flips ever call it.
+  using PageFlipCallback = std::function<void(TimePoint flip_time)>;
+  virtual void SetPageFlipCallback(PageFlipCallback callback);
+
   virtual void* GetFuncAddress(const std::string& name);
 
   // Creates an instance of GLContext specific to the platform we are running on.
@@ -640,6 +640,7 @@ PFNDOLDRAWARRAYSINSTANCEDPROC dolDrawArraysInstanced;
 PFNDOLDRAWELEMENTSINSTANCEDPROC dolDrawElementsInstanced;
 PFNDOLPRIMITIVERESTARTINDEXPROC dolPrimitiveRestartIndex;
 PFNDOLTEXBUFFERPROC dolTexBuffer;
+PFNDOLCOPYBUFFERSUBDATAPROC dolCopyBufferSubData;
 
 // gl_3_2
 PFNDOLFRAMEBUFFERTEXTUREPROC dolFramebufferTexture;
@@ -1664,6 +1665,7 @@ const GLFunc gl_function_array[] = {
     GLFUNC_REQUIRES(glDrawArraysInstanced, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glDrawElementsInstanced, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glTexBuffer, "VERSION_3_1 |VERSION_GLES_3_2"),
+    GLFUNC_REQUIRES(glCopyBufferSubData, "VERSION_3_1 |VERSION_GLES_3"),
 
     // gl_3_2
     GLFUNC_REQUIRES(glGetBufferParameteri64v, "VERSION_3_2 |VERSION_GLES_3"),
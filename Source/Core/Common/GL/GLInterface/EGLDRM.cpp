@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/GL/GLInterface/EGLDRM.h"
+
+#include <gbm.h>
+
+#include "Common/DRMDisplay.h"
+
+#ifndef EGL_KHR_platform_gbm
+#define EGL_KHR_platform_gbm 1
+#define EGL_PLATFORM_GBM_KHR 0x31D7
+#endif /* EGL_KHR_platform_gbm */
+
+GLContextEGLDRM::~GLContextEGLDRM()
+{
+  // The context must be destroyed before the surface.
+  DestroyWindowSurface();
+  DestroyContext();
+  GetDisplay()->DestroySurface();
+}
+
+Common::DRMDisplay* GLContextEGLDRM::GetDisplay() const
+{
+  return static_cast<Common::DRMDisplay*>(m_wsi.display_connection);
+}
+
+void GLContextEGLDRM::Swap()
+{
+  GLContextEGL::Swap();
+  GetDisplay()->Present(m_vsync);
+}
+
+void GLContextEGLDRM::SwapInterval(int interval)
+{
+  // Buffers are handed to KMS by Present, so the EGL swap interval has no effect.
+  m_vsync = interval != 0;
+}
+
+void GLContextEGLDRM::SetPageFlipCallback(PageFlipCallback callback)
+{
+  GetDisplay()->SetPageFlipCallback(std::move(callback));
+}
+
+EGLDisplay GLContextEGLDRM::OpenEGLDisplay()
+{
+  const auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  if (get_platform_display)
+    return get_platform_display(EGL_PLATFORM_GBM_KHR, GetDisplay()->GetGBMDevice(), nullptr);
+
+  return eglGetDisplay(reinterpret_cast<EGLNativeDisplayType>(GetDisplay()->GetGBMDevice()));
+}
+
+EGLNativeWindowType GLContextEGLDRM::GetEGLNativeWindow(EGLConfig config)
+{
+  // The surface has to be in the format of the config's visual.
+  EGLint format = 0;
+  if (!eglGetConfigAttrib(m_egl_display, config, EGL_NATIVE_VISUAL_ID, &format) || format == 0)
+    format = GBM_FORMAT_XRGB8888;
+
+  return reinterpret_cast<EGLNativeWindowType>(GetDisplay()->CreateSurface(format));
+}
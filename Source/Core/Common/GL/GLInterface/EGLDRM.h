@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/GL/GLInterface/EGL.h"
+
+namespace Common
+{
+class DRMDisplay;
+}
+
+// Renders to a GBM surface whose buffers are scanned out directly by DRM/KMS. The display
+// connection of the WindowSystemInfo is the Common::DRMDisplay.
+class GLContextEGLDRM final : public GLContextEGL
+{
+public:
+  ~GLContextEGLDRM() override;
+
+  void Swap() override;
+  void SwapInterval(int interval) override;
+
+  void SetPageFlipCallback(PageFlipCallback callback) override;
+
+protected:
+  EGLDisplay OpenEGLDisplay() override;
+  EGLNativeWindowType GetEGLNativeWindow(EGLConfig config) override;
+
+private:
+  Common::DRMDisplay* GetDisplay() const;
+
+  bool m_vsync = true;
+};
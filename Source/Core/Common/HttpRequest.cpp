@@ -3,6 +3,7 @@
 
 #include "Common/HttpRequest.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <mutex>
@@ -41,7 +42,14 @@ public:
   std::string EscapeComponent(const std::string& string);
 
 private:
+  static void CurlShareLock(CURL*, curl_lock_data data, curl_lock_access, void*);
+  static void CurlShareUnlock(CURL*, curl_lock_data data, void*);
+
   static inline std::once_flag s_curl_was_initialized;
+  // Shared by every HttpRequest, so that requests made by separate instances (such as one per
+  // cover or badge download) can reuse connections, DNS lookups and TLS sessions.
+  static inline CURLSH* s_curl_share = nullptr;
+  static inline std::array<std::mutex, CURL_LOCK_DATA_LAST> s_curl_share_mutexes;
   ProgressCallback m_callback;
   Headers m_response_headers;
   std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> m_curl{nullptr, curl_easy_cleanup};
@@ -120,12 +128,26 @@ int HttpRequest::Impl::CurlProgressCallback(Impl* impl, curl_off_t dltotal, curl
 HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback callback)
     : m_callback(std::move(callback))
 {
-  std::call_once(s_curl_was_initialized, [] { curl_global_init(CURL_GLOBAL_DEFAULT); });
+  std::call_once(s_curl_was_initialized, [] {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    s_curl_share = curl_share_init();
+    if (!s_curl_share)
+      return;
+    curl_share_setopt(s_curl_share, CURLSHOPT_LOCKFUNC, CurlShareLock);
+    curl_share_setopt(s_curl_share, CURLSHOPT_UNLOCKFUNC, CurlShareUnlock);
+    curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  });
 
   m_curl.reset(curl_easy_init());
   if (!m_curl)
     return;
 
+  if (s_curl_share)
+    curl_easy_setopt(m_curl.get(), CURLOPT_SHARE, s_curl_share);
+
   curl_easy_setopt(m_curl.get(), CURLOPT_NOPROGRESS, m_callback == nullptr);
 
   if (m_callback)
@@ -153,6 +175,16 @@ HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback c
 #endif
 }
 
+void HttpRequest::Impl::CurlShareLock(CURL*, curl_lock_data data, curl_lock_access, void*)
+{
+  s_curl_share_mutexes[data].lock();
+}
+
+void HttpRequest::Impl::CurlShareUnlock(CURL*, curl_lock_data data, void*)
+{
+  s_curl_share_mutexes[data].unlock();
+}
+
 bool HttpRequest::Impl::IsValid() const
 {
   return m_curl != nullptr;
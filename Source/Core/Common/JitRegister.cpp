@@ -7,12 +7,14 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 
 #ifdef _WIN32
@@ -21,6 +23,13 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
 #if defined USE_OPROFILE && USE_OPROFILE
 #include <opagent.h>
 #endif
@@ -40,7 +49,202 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+#ifdef __linux__
+// The jitdump format is described in tools/perf/Documentation/jitdump-specification.txt in the
+// Linux source tree.
+namespace JitDump
+{
+constexpr u32 MAGIC = 0x4A695444;
+constexpr u32 VERSION = 1;
+
+enum RecordType : u32
+{
+  CODE_LOAD = 0,
+  CODE_DEBUG_INFO = 2,
+  CODE_CLOSE = 3,
+};
+
+struct FileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 total_size;
+  u32 elf_mach;
+  u32 pad1;
+  u32 pid;
+  u64 timestamp;
+  u64 flags;
+};
+
+struct RecordHeader
+{
+  u32 id;
+  u32 total_size;
+  u64 timestamp;
+};
+
+// Followed by the null-terminated name and the code.
+struct CodeLoad
+{
+  RecordHeader header;
+  u32 pid;
+  u32 tid;
+  u64 vma;
+  u64 code_addr;
+  u64 code_size;
+  u64 code_index;
+};
+
+// Followed by nr_entry entries.
+struct DebugInfo
+{
+  RecordHeader header;
+  u64 code_addr;
+  u64 nr_entry;
+};
+
+// Followed by the null-terminated file name, or "\xff" for the same one as the previous entry.
+struct DebugEntry
+{
+  u64 code_addr;
+  u32 line;
+  u32 discrim;
+};
+
+// Records can come from the CPU and GPU threads.
+static std::mutex s_mutex;
+static File::IOFile s_file;
+static void* s_marker = nullptr;
+static long s_marker_size = 0;
+static u64 s_code_index = 0;
+
+// The listing of guest code that the line tables point into.
+static File::IOFile s_source_file;
+static std::string s_source_path;
+static u32 s_source_line_count = 0;
+
+static u64 GetTimestamp()
+{
+  // perf record has to be run with -k mono to match these up with its samples.
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + static_cast<u64>(ts.tv_nsec);
+}
+
+static void Open(const std::string& dir)
+{
+  const std::string path = fmt::format("{}/jit-{}.dump", dir, getpid());
+  if (!s_file.Open(path, "w+b"))
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to create the jitdump file {}", path);
+    return;
+  }
+
+#if defined(_M_X86_64)
+  constexpr u32 elf_mach = EM_X86_64;
+#elif defined(_M_ARM_64)
+  constexpr u32 elf_mach = EM_AARCH64;
+#else
+  constexpr u32 elf_mach = EM_NONE;
+#endif
+
+  const FileHeader header{MAGIC, VERSION, sizeof(FileHeader), elf_mach, 0,
+                          static_cast<u32>(getpid()), GetTimestamp(), 0};
+  s_file.WriteBytes(&header, sizeof(header));
+  s_file.Flush();
+
+  // perf only looks at a jitdump that the process has mapped as executable, which it sees in the
+  // mmap events it records.
+  s_marker_size = sysconf(_SC_PAGESIZE);
+  s_marker = mmap(nullptr, s_marker_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                  fileno(s_file.GetHandle()), 0);
+  if (s_marker == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map the jitdump file {}", path);
+    s_marker = nullptr;
+    s_file.Close();
+    return;
+  }
+
+  s_source_path = fmt::format("{}/jit-{}.ppc", dir, getpid());
+  s_source_file.Open(s_source_path, "w");
+  s_source_line_count = 0;
+  s_code_index = 0;
+}
+
+static void Close()
+{
+  if (!s_file.IsOpen())
+    return;
+
+  const RecordHeader header{CODE_CLOSE, sizeof(RecordHeader), GetTimestamp()};
+  s_file.WriteBytes(&header, sizeof(header));
+
+  munmap(s_marker, s_marker_size);
+  s_marker = nullptr;
+  s_file.Close();
+  s_source_file.Close();
+}
+
+static void WriteDebugInfo(const void* base_address, std::span<const SourceLine> source_lines)
+{
+  if (source_lines.empty() || !s_source_file.IsOpen())
+    return;
+
+  u32 total_size = sizeof(DebugInfo);
+  for (size_t i = 0; i < source_lines.size(); ++i)
+    total_size += sizeof(DebugEntry) + (i == 0 ? s_source_path.size() + 1 : 2);
+
+  const u64 timestamp = GetTimestamp();
+  const DebugInfo info{{CODE_DEBUG_INFO, total_size, timestamp},
+                       reinterpret_cast<u64>(base_address),
+                       source_lines.size()};
+  s_file.WriteBytes(&info, sizeof(info));
+
+  for (size_t i = 0; i < source_lines.size(); ++i)
+  {
+    const std::string line = source_lines[i].text + '\n';
+    s_source_file.WriteBytes(line.data(), line.size());
+
+    const DebugEntry entry{reinterpret_cast<u64>(source_lines[i].host_address),
+                           ++s_source_line_count, 0};
+    s_file.WriteBytes(&entry, sizeof(entry));
+    if (i == 0)
+      s_file.WriteBytes(s_source_path.c_str(), s_source_path.size() + 1);
+    else
+      s_file.WriteBytes("\xff", 2);
+  }
+}
+
+static void WriteCodeLoad(const void* base_address, u32 code_size, const std::string& symbol_name,
+                          std::span<const SourceLine> source_lines)
+{
+  std::lock_guard lk(s_mutex);
+  if (!s_file.IsOpen())
+    return;
+
+  // The line table has to come before the code it describes.
+  WriteDebugInfo(base_address, source_lines);
+
+  const u64 address = reinterpret_cast<u64>(base_address);
+  const CodeLoad load{
+      {CODE_LOAD, static_cast<u32>(sizeof(CodeLoad) + symbol_name.size() + 1 + code_size),
+       GetTimestamp()},
+      static_cast<u32>(getpid()),
+      static_cast<u32>(syscall(SYS_gettid)),
+      address,
+      address,
+      code_size,
+      s_code_index++,
+  };
+  s_file.WriteBytes(&load, sizeof(load));
+  s_file.WriteBytes(symbol_name.c_str(), symbol_name.size() + 1);
+  s_file.WriteBytes(base_address, code_size);
+}
+}  // namespace JitDump
+#endif
+
+void Init(const std::string& perf_dir, bool jit_dump)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
   s_agent = op_open_agent();
@@ -57,6 +261,14 @@ void Init(const std::string& perf_dir)
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
     s_is_enabled = true;
   }
+
+#ifdef __linux__
+  if (jit_dump)
+  {
+    JitDump::Open(perf_dir.empty() ? "/tmp" : perf_dir);
+    s_is_enabled |= JitDump::s_file.IsOpen();
+  }
+#endif
 }
 
 void Shutdown()
@@ -73,6 +285,13 @@ void Shutdown()
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  {
+    std::lock_guard lk(JitDump::s_mutex);
+    JitDump::Close();
+  }
+#endif
+
   s_is_enabled = false;
 }
 
@@ -81,8 +300,28 @@ bool IsEnabled()
   return s_is_enabled;
 }
 
+bool IsJitDumpEnabled()
+{
+#ifdef __linux__
+  return JitDump::s_file.IsOpen();
+#else
+  return false;
+#endif
+}
+
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name)
 {
+  RegisterWithSourceLines(base_address, code_size, symbol_name, {});
+}
+
+void RegisterWithSourceLines(const void* base_address, u32 code_size,
+                             const std::string& symbol_name,
+                             std::span<const SourceLine> source_lines)
+{
+#ifdef __linux__
+  JitDump::WriteCodeLoad(base_address, code_size, symbol_name, source_lines);
+#endif
+
 #if !(defined USE_OPROFILE && USE_OPROFILE) && !defined(USE_VTUNE)
   if (!s_perf_map_file.IsOpen())
     return;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 
 #include <fmt/format.h>
@@ -11,10 +12,25 @@
 
 namespace Common::JitRegister
 {
-void Init(const std::string& perf_dir);
+// Maps the host code starting at host_address to a line of guest code, e.g. "80003100 addi ...".
+struct SourceLine
+{
+  const void* host_address;
+  std::string text;
+};
+
+// Writes a perf map to perf_dir if it isn't empty or PERF_BUILDID_DIR is set. If jit_dump is set,
+// also writes a jitdump (jit-<pid>.dump) for "perf inject --jit", along with a listing of the
+// guest code that its line tables refer to, so "perf annotate" can show it next to the host code.
+void Init(const std::string& perf_dir, bool jit_dump = false);
 void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
+// Like Register, but also records which guest instruction each part of the code came from.
+void RegisterWithSourceLines(const void* base_address, u32 code_size,
+                             const std::string& symbol_name,
+                             std::span<const SourceLine> source_lines);
 bool IsEnabled();
+bool IsJitDumpEnabled();
 
 template <typename... Args>
 inline void Register(const void* base_address, u32 code_size, fmt::format_string<Args...> format,
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -37,13 +38,16 @@ public:
 };
 
 // Dead simple unsorted key-value store with append functionality.
-// No random read functionality, all reading is done in OpenAndRead.
+// Reading is done in OpenAndRead, single entries can be read again later with ReadEntry.
 // Keys and values can contain any characters, including \0.
 //
 // Suitable for caching generated shader bytecode between executions.
 // Not tuned for extreme performance but should be reasonably fast.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
+//
+// Several Dolphin processes can have the same file open. Their reads share the OS page cache, but
+// appends aren't synchronized between processes, so only one of them should be adding entries.
 
 // K and V are some POD type
 // K : the key type
@@ -74,26 +78,31 @@ public:
       // good header, read some key/value pairs
       K key;
 
-      std::unique_ptr<V[]> value = nullptr;
+      // Reused for every entry, so only entries larger than all previous ones allocate.
+      std::vector<V> value;
       u32 value_size = 0;
       u32 entry_number = 0;
       u64 last_valid_value_start = m_file.Tell();
 
+      m_current_entry_offset = last_valid_value_start;
       while (m_file.ReadArray(&value_size, 1))
       {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
+        // Checked before allocating, so a torn or corrupted size can't request a huge buffer.
+        const u64 next_extent = m_file.Tell() + sizeof(K) + u64{value_size} * sizeof(V) +
+                                sizeof(entry_number);
         if (next_extent > file_size)
           break;
 
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
+        if (value.size() < value_size)
+          value.resize(value_size);
 
         // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
+        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.data(), value_size) &&
             m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
         {
+          reader.Read(key, value.data(), value_size);
           last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
+          m_current_entry_offset = last_valid_value_start;
         }
         else
         {
@@ -103,15 +112,20 @@ public:
         m_num_entries++;
       }
       m_file.ClearError();
+
+      // Drop whatever an interrupted Append left behind, so that new entries don't end up
+      // followed by stale bytes and the file only ever contains complete entries.
+      if (last_valid_value_start != file_size)
+        m_file.Resize(last_valid_value_start);
       m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
 
       return m_num_entries;
     }
 
     // failed to open file for reading or bad header
-    // close and recreate file
+    // close and recreate file, keeping it readable for ReadEntry
     Close();
-    m_file.Open(filename, "wb");
+    m_file.Open(filename, "w+b");
     WriteHeader();
     return 0;
   }
@@ -123,16 +137,39 @@ public:
       m_file.Close();
   }
 
-  // Appends a key-value pair to the store.
-  void Append(const K& key, const V* value, u32 value_size)
+  // Offset of the entry currently being passed to LinearDiskCacheReader::Read, for ReadEntry.
+  u64 GetCurrentEntryOffset() const { return m_current_entry_offset; }
+
+  // Reads the entry at offset again. The file position is restored afterwards, so appending
+  // continues where it left off.
+  bool ReadEntry(u64 offset, K* key, std::vector<V>* value)
+  {
+    const u64 position = m_file.Tell();
+    u32 value_size;
+    bool result = m_file.Seek(offset, File::SeekOrigin::Begin) &&
+                  m_file.ReadArray(&value_size, 1) && m_file.ReadArray(key, 1);
+    if (result)
+    {
+      value->resize(value_size);
+      result = m_file.ReadArray(value->data(), value_size);
+    }
+    m_file.ClearError();
+    m_file.Seek(position, File::SeekOrigin::Begin);
+    return result;
+  }
+
+  // Appends a key-value pair to the store. Returns the offset of the entry, for ReadEntry.
+  u64 Append(const K& key, const V* value, u32 value_size)
   {
     // TODO: Should do a check that we don't already have "key"? (I think each caller does that
     // already.)
+    const u64 offset = m_file.Tell();
     m_file.WriteArray(&value_size, 1);
     m_file.WriteArray(&key, 1);
     m_file.WriteArray(value, value_size);
     m_num_entries++;
     m_file.WriteArray(&m_num_entries, 1);
+    return offset;
   }
 
 private:
@@ -164,5 +201,6 @@ private:
 
   File::IOFile m_file;
   u32 m_num_entries = 0;
+  u64 m_current_entry_offset = 0;
 };
 }  // namespace Common
@@ -11,16 +11,21 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 
 #include "Common/CommonPaths.h"
 #include "Common/Config/Config.h"
+#include "Common/Event.h"
 #include "Common/FileUtil.h"
+#include "Common/Flag.h"
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
+#include "Common/MPSCQueue.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
@@ -32,6 +37,28 @@ const Config::Info<bool> LOGGER_WRITE_TO_WINDOW{
     {Config::System::Logger, "Options", "WriteToWindow"}, true};
 const Config::Info<LogLevel> LOGGER_VERBOSITY{{Config::System::Logger, "Options", "Verbosity"},
                                               LogLevel::LNOTICE};
+const Config::Info<bool> LOGGER_ASYNC{{Config::System::Logger, "Options", "Async"}, false};
+
+struct LogManager::AsyncLogger
+{
+  struct Record
+  {
+    LogLevel level{};
+    LogType type{};
+    const char* file = nullptr;
+    int line = 0;
+    std::chrono::system_clock::time_point time;
+    std::string message;
+  };
+
+  MPSCQueue<Record, 4096> queue;
+  // Records that have been queued but not written yet.
+  std::atomic<size_t> pending_count = 0;
+  std::atomic<u64> dropped_count = 0;
+  Common::Event wakeup_event;
+  Common::Flag running{true};
+  std::thread thread;
+};
 
 class FileLogListener : public LogListener
 {
@@ -161,6 +188,7 @@ LogManager::LogManager()
   EnableListener(LogListener::FILE_LISTENER, Config::Get(LOGGER_WRITE_TO_FILE));
   EnableListener(LogListener::CONSOLE_LISTENER, Config::Get(LOGGER_WRITE_TO_CONSOLE));
   EnableListener(LogListener::LOG_WINDOW_LISTENER, Config::Get(LOGGER_WRITE_TO_WINDOW));
+  SetAsync(Config::Get(LOGGER_ASYNC));
 
   for (auto& container : m_log)
   {
@@ -173,6 +201,13 @@ LogManager::LogManager()
 
 LogManager::~LogManager()
 {
+  if (m_async_logger)
+  {
+    m_async_logger->running.Clear();
+    m_async_logger->wakeup_event.Set();
+    m_async_logger->thread.join();
+  }
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -188,6 +223,7 @@ void LogManager::SaveSettings()
   Config::SetBaseOrCurrent(LOGGER_WRITE_TO_WINDOW,
                            IsListenerEnabled(LogListener::LOG_WINDOW_LISTENER));
   Config::SetBaseOrCurrent(LOGGER_VERBOSITY, GetLogLevel());
+  Config::SetBaseOrCurrent(LOGGER_ASYNC, IsAsync());
 
   for (const auto& container : m_log)
   {
@@ -206,30 +242,129 @@ void LogManager::Log(LogLevel level, LogType type, const char* file, int line, c
   LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
 }
 
-std::string LogManager::GetTimestamp()
+std::string LogManager::GetTimestamp(std::chrono::system_clock::time_point time)
 {
   // NOTE: the Qt LogWidget hardcodes the expected length of the timestamp portion of the log line,
   // so ensure they stay in sync
 
   // We want milliseconds *and not hours*, so can't directly use STL formatters
-  const auto now = std::chrono::system_clock::now();
-  const auto now_s = std::chrono::floor<std::chrono::seconds>(now);
-  const auto now_ms = std::chrono::floor<std::chrono::milliseconds>(now);
-  return fmt::format("{:%M:%S}:{:03}", now_s, (now_ms - now_s).count());
+  const auto time_s = std::chrono::floor<std::chrono::seconds>(time);
+  const auto time_ms = std::chrono::floor<std::chrono::milliseconds>(time);
+  return fmt::format("{:%M:%S}:{:03}", time_s, (time_ms - time_s).count());
 }
 
-void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
-                                 const char* message)
+std::string LogManager::FormatLine(std::chrono::system_clock::time_point time, LogLevel level,
+                                   LogType type, const char* file, int line,
+                                   const char* message) const
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  return fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(time), file, line,
+                     LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+}
 
+void LogManager::WriteToListeners(LogLevel level, const char* line)
+{
   for (const auto listener_id : m_listener_ids)
   {
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(level, line);
+  }
+}
+
+void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
+                                 const char* message)
+{
+  const auto now = std::chrono::system_clock::now();
+  if (!m_async.load(std::memory_order_acquire))
+  {
+    WriteToListeners(level, FormatLine(now, level, type, file, line, message).c_str());
+    return;
+  }
+
+  AsyncLogger& logger = *m_async_logger;
+  if (!logger.queue.TryPush(AsyncLogger::Record{level, type, file, line, now, message}))
+  {
+    logger.dropped_count.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  logger.pending_count.fetch_add(1, std::memory_order_relaxed);
+  logger.wakeup_event.Set();
+}
+
+void LogManager::AsyncThread()
+{
+  Common::SetCurrentThreadName("Logger");
+
+  AsyncLogger& logger = *m_async_logger;
+  AsyncLogger::Record record;
+  u64 reported_dropped_count = 0;
+  while (true)
+  {
+    const bool running = logger.running.IsSet();
+
+    while (logger.queue.Pop(record))
+    {
+      const std::string line = FormatLine(record.time, record.level, record.type, record.file,
+                                          record.line, record.message.c_str());
+      {
+        std::lock_guard lk(m_listener_mutex);
+        WriteToListeners(record.level, line.c_str());
+      }
+      logger.pending_count.fetch_sub(1, std::memory_order_release);
+    }
+
+    const u64 dropped_count = logger.dropped_count.load(std::memory_order_relaxed);
+    if (dropped_count != reported_dropped_count)
+    {
+      const std::string message =
+          fmt::format("{} log messages were dropped because the log queue was full",
+                      dropped_count - reported_dropped_count);
+      const std::string line =
+          FormatLine(std::chrono::system_clock::now(), LogLevel::LWARNING, LogType::COMMON,
+                     __FILE__ + m_path_cutoff_point, __LINE__, message.c_str());
+      std::lock_guard lk(m_listener_mutex);
+      WriteToListeners(LogLevel::LWARNING, line.c_str());
+      reported_dropped_count = dropped_count;
+    }
+
+    if (!running)
+      break;
+
+    logger.wakeup_event.WaitFor(std::chrono::milliseconds(100));
+  }
+}
+
+void LogManager::SetAsync(bool async)
+{
+  if (async == IsAsync())
+    return;
+
+  if (!async)
+  {
+    m_async.store(false, std::memory_order_relaxed);
+    // Messages that are still queued would otherwise end up after newer, synchronous ones.
+    while (m_async_logger->pending_count.load(std::memory_order_acquire) != 0)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return;
+  }
+
+  if (!m_async_logger)
+  {
+    m_async_logger = std::make_unique<AsyncLogger>();
+    m_async_logger->thread = std::thread(&LogManager::AsyncThread, this);
   }
+  m_async.store(true, std::memory_order_release);
+}
+
+bool LogManager::IsAsync() const
+{
+  return m_async.load(std::memory_order_relaxed);
+}
+
+u64 LogManager::GetDroppedMessageCount() const
+{
+  if (!m_async_logger)
+    return 0;
+  return m_async_logger->dropped_count.load(std::memory_order_relaxed);
 }
 
 LogLevel LogManager::GetLogLevel() const
@@ -274,6 +409,7 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, LogListener* listener)
 {
+  std::lock_guard lk(m_listener_mutex);
   m_listeners[id] = listener;
 }
 
@@ -4,11 +4,16 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "Common/Logging/Log.h"
 
@@ -57,6 +62,13 @@ public:
   void EnableListener(LogListener::LISTENER id, bool enable);
   bool IsListenerEnabled(LogListener::LISTENER id) const;
 
+  // In asynchronous mode, messages are queued and passed to the listeners by a separate thread,
+  // so that logging barely affects the timing of the thread that logs. If the queue is full,
+  // messages are dropped. Disabling it waits for the queued messages to be written.
+  void SetAsync(bool async);
+  bool IsAsync() const;
+  u64 GetDroppedMessageCount() const;
+
   void SaveSettings();
 
 private:
@@ -75,12 +87,24 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
-  static std::string GetTimestamp();
+  struct AsyncLogger;
+
+  static std::string GetTimestamp(std::chrono::system_clock::time_point time);
+  std::string FormatLine(std::chrono::system_clock::time_point time, LogLevel level, LogType type,
+                         const char* file, int line, const char* message) const;
+  void WriteToListeners(LogLevel level, const char* line);
+  void AsyncThread();
 
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Created the first time asynchronous mode is enabled, and kept until shutdown.
+  std::unique_ptr<AsyncLogger> m_async_logger;
+  std::atomic<bool> m_async = false;
+  // Held by the logging thread while it calls listeners, so that they can be unregistered safely.
+  std::mutex m_listener_mutex;
 };
 }  // namespace Common::Log
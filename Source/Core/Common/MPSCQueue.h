@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a bounded, lockless and allocation-free
+// multiple producer, single consumer queue
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace Common
+{
+template <typename T, std::size_t Capacity>
+class MPSCQueue
+{
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  MPSCQueue()
+  {
+    for (std::size_t i = 0; i < Capacity; ++i)
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // Can be called from any thread. Returns false if the queue is full.
+  template <typename Arg>
+  bool TryPush(Arg&& t)
+  {
+    std::size_t pos = m_write_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Slot& slot = m_slots[pos & (Capacity - 1)];
+      const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0)
+      {
+        // The slot is free, try to claim it.
+        if (m_write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.value = std::forward<Arg>(t);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        // The consumer hasn't popped the element that was written to this slot one lap ago.
+        return false;
+      }
+      else
+      {
+        // Another producer claimed this slot first.
+        pos = m_write_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Must only be called from the consumer thread. An element whose producer has claimed a slot
+  // but not finished writing it yet is not visible, and neither are the elements behind it.
+  bool Pop(T& t)
+  {
+    Slot& slot = m_slots[m_read_pos & (Capacity - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != m_read_pos + 1)
+      return false;
+
+    t = std::move(slot.value);
+    slot.sequence.store(m_read_pos + Capacity, std::memory_order_release);
+    ++m_read_pos;
+    return true;
+  }
+
+  // Must only be called from the consumer thread.
+  bool Empty() const
+  {
+    const Slot& slot = m_slots[m_read_pos & (Capacity - 1)];
+    return slot.sequence.load(std::memory_order_acquire) != m_read_pos + 1;
+  }
+
+  static constexpr std::size_t GetCapacity() { return Capacity; }
+
+private:
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence;
+    T value{};
+  };
+
+  // Keep the producer and consumer positions on separate cache lines.
+  alignas(64) std::atomic<std::size_t> m_write_pos = 0;
+  alignas(64) std::size_t m_read_pos = 0;
+  alignas(64) std::array<Slot, Capacity> m_slots;
+};
+}  // namespace Common
@@ -0,0 +1,102 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace File
+{
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+bool MappedFile::Map(IOFile& file)
+{
+  Unmap();
+
+  const u64 size = file.GetSize();
+  if (!file.IsOpen() || size == 0)
+    return false;
+
+#ifdef _WIN32
+  const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file.GetHandle())));
+  m_mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_mapping)
+  {
+    WARN_LOG_FMT(COMMON, "CreateFileMapping failed: {}", Common::GetLastErrorString());
+    return false;
+  }
+
+  void* const data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    WARN_LOG_FMT(COMMON, "MapViewOfFile failed: {}", Common::GetLastErrorString());
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+    return false;
+  }
+#else
+  void* const data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(file.GetHandle()), 0);
+  if (data == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "mmap failed: {}", Common::LastStrerrorString());
+    return false;
+  }
+#endif
+
+  m_data = static_cast<const u8*>(data);
+  m_size = size;
+  return true;
+}
+
+void MappedFile::Unmap()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  m_mapping = nullptr;
+#else
+  munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+
+void MappedFile::WillNeed(u64 offset, u64 size) const
+{
+  if (offset >= m_size)
+    return;
+  size = std::min(size, m_size - offset);
+
+#ifdef _WIN32
+  WIN32_MEMORY_RANGE_ENTRY range{const_cast<u8*>(m_data + offset), static_cast<SIZE_T>(size)};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+  // madvise needs a page-aligned address.
+  static const u64 page_size = sysconf(_SC_PAGESIZE);
+  const u64 aligned_offset = offset - offset % page_size;
+  madvise(const_cast<u8*>(m_data + aligned_offset), size + (offset - aligned_offset),
+          MADV_WILLNEED);
+#endif
+}
+}  // namespace File
@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// A read-only view of a whole file. Reading from it copies straight out of the page cache,
+// instead of making a system call and a copy for every read.
+// Reading a mapped file that shrinks or goes away (such as one on removed storage) crashes,
+// rather than failing the read.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+  ~MappedFile();
+
+  // The view stays valid even if the file is closed afterwards.
+  bool Map(IOFile& file);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+
+  // Hints that the given range will be read soon, so that the OS can start reading it in.
+  void WillNeed(u64 offset, u64 size) const;
+
+private:
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+#ifdef _WIN32
+  void* m_mapping = nullptr;
+#endif
+};
+}  // namespace File
@@ -3,8 +3,12 @@
 
 #include "Common/MemoryUtil.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cstddef>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <string>
 
 #include "Common/CommonFuncs.h"
@@ -20,6 +24,7 @@
 #include <stdio.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <unistd.h>
 #if defined __APPLE__ || defined __FreeBSD__ || defined __OpenBSD__ || defined __NetBSD__
 #include <sys/sysctl.h>
 #elif defined __HAIKU__
@@ -289,4 +294,91 @@ size_t MemPhysical()
 #endif
 }
 
+size_t GetPageSize()
+{
+#ifdef _WIN32
+  static const size_t page_size = [] {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+  }();
+#else
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+  return page_size;
+}
+
+size_t GetHugePageSize()
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  static const size_t huge_page_size = [] {
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    size_t size = 0;
+    if (!(file >> size))
+      return size_t(0);
+
+    std::ifstream enabled_file("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string enabled;
+    std::getline(enabled_file, enabled);
+    // The active mode is in brackets, e.g. "always [madvise] never".
+    return enabled.find("[never]") == std::string::npos ? size : 0;
+  }();
+  return huge_page_size;
+#else
+  return 0;
+#endif
+}
+
+bool AdviseHugePages(void* ptr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (GetHugePageSize() == 0)
+    return false;
+
+  if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+  {
+    WARN_LOG_FMT(MEMMAP, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::optional<size_t> GetHugePageBackedSize(const void* ptr, size_t size)
+{
+#ifdef __linux__
+  std::ifstream smaps("/proc/self/smaps");
+  if (!smaps)
+    return std::nullopt;
+
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t end = begin + size;
+
+  size_t backed_size = 0;
+  bool in_range = false;
+  std::string line;
+  while (std::getline(smaps, line))
+  {
+    uintptr_t vma_begin, vma_end;
+    if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR " ", &vma_begin, &vma_end) == 2)
+    {
+      in_range = vma_begin < end && vma_end > begin;
+      continue;
+    }
+
+    size_t kib;
+    if (in_range && (std::sscanf(line.c_str(), "AnonHugePages: %zu kB", &kib) == 1 ||
+                     std::sscanf(line.c_str(), "ShmemPmdMapped: %zu kB", &kib) == 1))
+    {
+      backed_size += kib * 1024;
+    }
+  }
+  return std::min(backed_size, size);
+#else
+  return std::nullopt;
+#endif
+}
+
 }  // namespace Common
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <string>
 
 namespace Common
@@ -34,5 +35,17 @@ bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
 size_t MemPhysical();
+// Returns the granularity of the protection functions above.
+size_t GetPageSize();
+
+// Returns the size of the huge pages that AdviseHugePages can give us, or 0 if the host doesn't
+// support transparent huge pages.
+size_t GetHugePageSize();
+// Asks the OS to back the given range with transparent huge pages when it's touched. Only the
+// parts of the range which are aligned to GetHugePageSize() can be affected. Returns false if the
+// request was rejected.
+bool AdviseHugePages(void* ptr, size_t size);
+// Returns how much of the given range is currently backed by huge pages, if the OS reports it.
+std::optional<size_t> GetHugePageBackedSize(const void* ptr, size_t size);
 
 }  // namespace Common
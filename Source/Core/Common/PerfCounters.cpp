@@ -0,0 +1,219 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/PerfCounters.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#ifdef __linux__
+#include <cerrno>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Common/Logging/Log.h"
+
+namespace Common::PerfCounters
+{
+const char* GetCounterName(Counter counter)
+{
+  static constexpr std::array<const char*, NUM_COUNTERS> names = {
+      "instructions", "cycles",        "l1i_misses",  "l1d_misses",
+      "llc_misses",   "branch_misses", "itlb_misses", "dtlb_misses",
+  };
+  return names[static_cast<size_t>(counter)];
+}
+
+#ifdef __linux__
+namespace
+{
+struct Thread
+{
+  pid_t tid;
+  std::string name;
+  std::array<int, NUM_COUNTERS> fds;
+};
+
+std::mutex s_mutex;
+std::vector<std::unique_ptr<Thread>> s_threads;
+int s_users = 0;
+bool s_reported_error = false;
+
+constexpr u64 CacheMissConfig(u64 cache)
+{
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+constexpr std::array<std::pair<u32, u64>, NUM_COUNTERS> EVENTS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_L1I)},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_ITLB)},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_DTLB)},
+}};
+
+void OpenCounters(Thread& thread)
+{
+  for (size_t i = 0; i < NUM_COUNTERS; ++i)
+  {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = EVENTS[i].first;
+    attr.config = EVENTS[i].second;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // More counters are requested than most CPUs have, so the kernel multiplexes them. The times
+    // let Read() scale the values up to the whole period.
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    thread.fds[i] = static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, thread.tid, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    if (thread.fds[i] < 0 && !s_reported_error)
+    {
+      s_reported_error = true;
+      WARN_LOG_FMT(COMMON,
+                   "Failed to open the {} performance counter of {}: {}. Counting may need a "
+                   "lower /proc/sys/kernel/perf_event_paranoid.",
+                   GetCounterName(static_cast<Counter>(i)), thread.name, errno);
+    }
+  }
+}
+
+void CloseCounters(Thread& thread)
+{
+  for (int& fd : thread.fds)
+  {
+    if (fd >= 0)
+      close(fd);
+    fd = -1;
+  }
+}
+
+// Removes the thread from the registry when it exits.
+struct Registration
+{
+  Thread* thread = nullptr;
+
+  ~Registration()
+  {
+    if (!thread)
+      return;
+
+    std::lock_guard lk(s_mutex);
+    CloseCounters(*thread);
+    std::erase_if(s_threads, [this](const auto& other) { return other.get() == thread; });
+  }
+};
+
+thread_local Registration t_registration;
+}  // namespace
+
+bool IsSupported()
+{
+  return true;
+}
+
+void Enable()
+{
+  std::lock_guard lk(s_mutex);
+  if (s_users++ != 0)
+    return;
+
+  s_reported_error = false;
+  for (const auto& thread : s_threads)
+    OpenCounters(*thread);
+}
+
+void Disable()
+{
+  std::lock_guard lk(s_mutex);
+  if (--s_users != 0)
+    return;
+
+  for (const auto& thread : s_threads)
+    CloseCounters(*thread);
+}
+
+void RegisterCurrentThread(std::string name)
+{
+  std::lock_guard lk(s_mutex);
+  if (t_registration.thread)
+  {
+    t_registration.thread->name = std::move(name);
+    return;
+  }
+
+  auto thread = std::make_unique<Thread>();
+  thread->tid = static_cast<pid_t>(syscall(SYS_gettid));
+  thread->name = std::move(name);
+  thread->fds.fill(-1);
+  if (s_users != 0)
+    OpenCounters(*thread);
+
+  t_registration.thread = thread.get();
+  s_threads.push_back(std::move(thread));
+}
+
+std::vector<ThreadValues> Read()
+{
+  std::lock_guard lk(s_mutex);
+
+  std::vector<ThreadValues> result;
+  if (s_users == 0)
+    return result;
+
+  result.reserve(s_threads.size());
+  for (const auto& thread : s_threads)
+  {
+    ThreadValues& values = result.emplace_back();
+    values.thread_name = thread->name;
+    for (size_t i = 0; i < NUM_COUNTERS; ++i)
+    {
+      struct
+      {
+        u64 value;
+        u64 time_enabled;
+        u64 time_running;
+      } data;
+      if (thread->fds[i] < 0 || read(thread->fds[i], &data, sizeof(data)) != sizeof(data))
+        continue;
+      if (data.time_running == 0)
+        values.values[i] = 0;
+      else
+        values.values[i] = static_cast<u64>(static_cast<double>(data.value) * data.time_enabled /
+                                            data.time_running);
+    }
+  }
+  return result;
+}
+#else
+bool IsSupported()
+{
+  return false;
+}
+
+void Enable()
+{
+}
+
+void Disable()
+{
+}
+
+void RegisterCurrentThread(std::string)
+{
+}
+
+std::vector<ThreadValues> Read()
+{
+  return {};
+}
+#endif
+}  // namespace Common::PerfCounters
@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Hardware performance counters for a few of the emulator's threads, read with perf_event_open.
+// They tell apart code that executes too many instructions from code that stalls on memory.
+//
+// Threads register themselves once. Counters are only opened while at least one user has called
+// Enable(). Only Linux is supported; elsewhere, and when the kernel doesn't allow counting
+// (perf_event_paranoid), no values are returned.
+namespace Common::PerfCounters
+{
+enum class Counter
+{
+  Instructions,
+  Cycles,
+  L1IMisses,
+  L1DMisses,
+  LLCMisses,
+  BranchMisses,
+  ITLBMisses,
+  DTLBMisses,
+};
+constexpr size_t NUM_COUNTERS = 8;
+
+// A short name that is usable as a key, e.g. "l1d_misses".
+const char* GetCounterName(Counter counter);
+
+struct ThreadValues
+{
+  std::string thread_name;
+  // Totals since the counters were opened. Empty for counters the CPU or kernel doesn't provide.
+  std::array<std::optional<u64>, NUM_COUNTERS> values;
+};
+
+bool IsSupported();
+
+// Counters are opened by the first Enable() and closed by the matching last Disable().
+void Enable();
+void Disable();
+
+// Counts the calling thread under the given name from now until it exits.
+void RegisterCurrentThread(std::string name);
+
+std::vector<ThreadValues> Read();
+}  // namespace Common::PerfCounters
@@ -0,0 +1,179 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a bounded and lockless single producer, single consumer queue,
+// which doesn't allocate after it has been constructed
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Common
+{
+template <typename T, std::size_t Capacity>
+class SPSCRingQueue
+{
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  SPSCRingQueue() = default;
+
+  SPSCRingQueue(const SPSCRingQueue&) = delete;
+  SPSCRingQueue& operator=(const SPSCRingQueue&) = delete;
+
+  // Must only be called from the producer thread. Returns false if the queue is full.
+  template <typename Arg>
+  bool TryPush(Arg&& t)
+  {
+    const std::size_t write_pos = m_write_pos.load(std::memory_order_relaxed);
+    if (!HasSpace(write_pos))
+      return false;
+
+    m_slots[write_pos & (Capacity - 1)] = std::forward<Arg>(t);
+    PublishWrite(write_pos + 1);
+    return true;
+  }
+
+  // Must only be called from the producer thread. Waits for the consumer if the queue is full.
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    const std::size_t write_pos = m_write_pos.load(std::memory_order_relaxed);
+    while (!HasSpace(write_pos))
+      WaitForChange(m_read_pos, m_cached_read_pos, m_producer_waiting);
+
+    m_slots[write_pos & (Capacity - 1)] = std::forward<Arg>(t);
+    PublishWrite(write_pos + 1);
+  }
+
+  // Must only be called from the producer thread. Moves as many elements from [first, last) as
+  // there is space for, makes them visible to the consumer at once, and returns how many it took.
+  template <typename It>
+  std::size_t TryPushRange(It first, It last)
+  {
+    const std::size_t write_pos = m_write_pos.load(std::memory_order_relaxed);
+    m_cached_read_pos = m_read_pos.load(std::memory_order_acquire);
+    const std::size_t space = Capacity - (write_pos - m_cached_read_pos);
+
+    std::size_t count = 0;
+    for (; first != last && count < space; ++first, ++count)
+      m_slots[(write_pos + count) & (Capacity - 1)] = std::move(*first);
+
+    if (count != 0)
+      PublishWrite(write_pos + count);
+    return count;
+  }
+
+  // Must only be called from the consumer thread.
+  bool Pop(T& t)
+  {
+    const std::size_t read_pos = m_read_pos.load(std::memory_order_relaxed);
+    if (!HasData(read_pos))
+      return false;
+
+    t = std::move(m_slots[read_pos & (Capacity - 1)]);
+    PublishRead(read_pos + 1);
+    return true;
+  }
+
+  // Must only be called from the consumer thread. Passes every element that is currently queued
+  // to func, frees their slots at once, and returns how many there were.
+  template <typename Func>
+  std::size_t PopAll(Func&& func)
+  {
+    const std::size_t read_pos = m_read_pos.load(std::memory_order_relaxed);
+    m_cached_write_pos = m_write_pos.load(std::memory_order_acquire);
+    const std::size_t count = m_cached_write_pos - read_pos;
+    if (count == 0)
+      return 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+      func(std::move(m_slots[(read_pos + i) & (Capacity - 1)]));
+
+    PublishRead(read_pos + count);
+    return count;
+  }
+
+  // Must only be called from the consumer thread. Waits until there is something to pop.
+  void WaitForData()
+  {
+    const std::size_t read_pos = m_read_pos.load(std::memory_order_relaxed);
+    while (!HasData(read_pos))
+      WaitForChange(m_write_pos, m_cached_write_pos, m_consumer_waiting);
+  }
+
+  // Can be called from either thread.
+  bool Empty() const
+  {
+    return m_read_pos.load(std::memory_order_acquire) ==
+           m_write_pos.load(std::memory_order_acquire);
+  }
+
+  // Not thread-safe.
+  void Clear()
+  {
+    T t;
+    while (Pop(t))
+    {
+    }
+  }
+
+  static constexpr std::size_t GetCapacity() { return Capacity; }
+
+private:
+  // Each side keeps a copy of the other side's position, and only reloads it (which moves the
+  // cache line over) when the copy says the queue is full or empty.
+  bool HasSpace(std::size_t write_pos)
+  {
+    if (write_pos - m_cached_read_pos != Capacity)
+      return true;
+    m_cached_read_pos = m_read_pos.load(std::memory_order_acquire);
+    return write_pos - m_cached_read_pos != Capacity;
+  }
+
+  bool HasData(std::size_t read_pos)
+  {
+    if (m_cached_write_pos != read_pos)
+      return true;
+    m_cached_write_pos = m_write_pos.load(std::memory_order_acquire);
+    return m_cached_write_pos != read_pos;
+  }
+
+  // Notifying is expensive even when nobody waits, so the waiting side announces itself first.
+  // With both sides using sequentially consistent accesses, either the waiter sees the new
+  // position or the other side sees the flag.
+  static void WaitForChange(const std::atomic<std::size_t>& pos, std::size_t old_pos,
+                            std::atomic<bool>& waiting)
+  {
+    waiting.store(true);
+    pos.wait(old_pos);
+    waiting.store(false, std::memory_order_relaxed);
+  }
+
+  static void Publish(std::atomic<std::size_t>& pos, std::size_t new_pos,
+                      const std::atomic<bool>& waiting)
+  {
+    pos.store(new_pos);
+    if (waiting.load())
+      pos.notify_one();
+  }
+
+  void PublishWrite(std::size_t write_pos) { Publish(m_write_pos, write_pos, m_consumer_waiting); }
+  void PublishRead(std::size_t read_pos) { Publish(m_read_pos, read_pos, m_producer_waiting); }
+
+  // Keep the producer and consumer state on separate cache lines. The flags are only read by the
+  // other side while nobody waits, so they get a line of their own.
+  alignas(64) std::atomic<std::size_t> m_write_pos = 0;
+  std::size_t m_cached_read_pos = 0;
+  alignas(64) std::atomic<std::size_t> m_read_pos = 0;
+  std::size_t m_cached_write_pos = 0;
+  alignas(64) std::atomic<bool> m_producer_waiting = false;
+  std::atomic<bool> m_consumer_waiting = false;
+  // Allocated once up front. This also lets T be a nested type of the class that owns the queue.
+  std::unique_ptr<T[]> m_slots = std::make_unique<T[]>(Capacity);
+};
+}  // namespace Common
@@ -3,16 +3,28 @@
 
 #include "Common/Thread.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <processthreadsapi.h>
 #else
+#include <cerrno>
+#include <ctime>
+
 #include <pthread.h>
 #include <unistd.h>
 #endif
 
 #ifdef __APPLE__
 #include <mach/mach.h>
+#include <pthread/qos.h>
+#elif defined __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
 #include <pthread_np.h>
 #elif defined __NetBSD__
@@ -28,6 +40,7 @@
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FrameTrace.h"
 #include "Common/StringUtil.h"
 
 namespace Common
@@ -61,6 +74,11 @@ void SleepCurrentThread(int ms)
   Sleep(ms);
 }
 
+void SleepUntil(TimePoint deadline)
+{
+  std::this_thread::sleep_until(deadline);
+}
+
 void SwitchCurrentThread()
 {
   SwitchToThread();
@@ -114,6 +132,17 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  FrameTrace::SetThreadName(name);
+}
+
+bool SetCurrentThreadRealtimePriority()
+{
+  return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+}
+
+void SetCurrentThreadBackgroundPriority()
+{
+  SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -160,6 +189,23 @@ void SleepCurrentThread(int ms)
   usleep(1000 * ms);
 }
 
+void SleepUntil(TimePoint deadline)
+{
+#ifdef __linux__
+  // std::chrono::steady_clock is CLOCK_MONOTONIC on Linux, so its time points can be passed to
+  // clock_nanosleep directly.
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch());
+  timespec ts;
+  ts.tv_sec = static_cast<time_t>(ns.count() / 1000000000);
+  ts.tv_nsec = static_cast<long>(ns.count() % 1000000000);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+  {
+  }
+#else
+  std::this_thread::sleep_until(deadline);
+#endif
+}
+
 void SwitchCurrentThread()
 {
   usleep(1000 * 1);
@@ -183,6 +229,24 @@ void SetCurrentThreadName(const char* name)
   // VTune uses OS thread names by default but probably supports longer names when set via its own
   // API.
   __itt_thread_set_name(name);
+#endif
+  FrameTrace::SetThreadName(name);
+}
+
+bool SetCurrentThreadRealtimePriority()
+{
+  sched_param param{};
+  param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+  return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+}
+
+void SetCurrentThreadBackgroundPriority()
+{
+#ifdef __APPLE__
+  pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined __linux__
+  // Linux applies nice values to individual threads rather than the whole process.
+  setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
 #endif
 }
 
@@ -223,4 +287,22 @@ std::tuple<void*, size_t> GetCurrentThreadStack()
 
 #endif
 
+void ParallelFor(size_t count, const std::function<void(size_t)>& function)
+{
+  const size_t thread_count =
+      std::min<size_t>(count, std::max(std::thread::hardware_concurrency(), 1u));
+  std::atomic<size_t> next_index = 0;
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < count; i = next_index++)
+      function(i);
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
 }  // namespace Common
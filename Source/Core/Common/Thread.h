@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <thread>
 
 #ifndef _WIN32
@@ -29,6 +30,10 @@ void SetCurrentThreadAffinity(u32 mask);
 void SleepCurrentThread(int ms);
 void SwitchCurrentThread();  // On Linux, this is equal to sleep 1ms
 
+// Sleeps until the given time. Uses an absolute timer where the OS has one, so that the time
+// spent between reading the clock and going to sleep isn't added to the sleep.
+void SleepUntil(TimePoint deadline);
+
 // Use this function during a spin-wait to make the current thread
 // relax while another thread is working. This may be more efficient
 // than using events because event functions use kernel calls.
@@ -39,6 +44,18 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// Runs function for every index in [0, count), spread over as many threads as there are cores.
+void ParallelFor(size_t count, const std::function<void(size_t)>& function);
+
+// Gives the current thread realtime scheduling (SCHED_FIFO on POSIX systems), for threads that
+// have to meet short deadlines such as audio output. Returns false if the OS doesn't allow it,
+// which is common for unprivileged processes.
+bool SetCurrentThreadRealtimePriority();
+
+// Lowers the priority of the current thread, for workers whose results aren't needed right away,
+// so that they don't take cores away from the CPU and GPU threads on machines with few cores.
+void SetCurrentThreadBackgroundPriority();
+
 #ifndef _WIN32
 // Returns the lowest address of the stack and the size of the stack
 std::tuple<void*, size_t> GetCurrentThreadStack();
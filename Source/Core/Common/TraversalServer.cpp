@@ -2,6 +2,7 @@
 
 // The central server implementation.
 #include <arpa/inet.h>
+#include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
@@ -31,6 +32,11 @@
 #define NUMBER_OF_TRIES 5
 #define PORT 6262
 #define PORT_ALT 6226
+// Resends are due in multiples of 300 ms, so the outgoing packets don't need to be scanned after
+// every single received packet.
+#define RESEND_CHECK_INTERVAL_US 10000
+// How many packets are read from a socket with one call, where recvmmsg is available.
+#define RECV_BATCH_SIZE 32
 
 static u64 currentTime;
 
@@ -268,6 +274,71 @@ static void ResendPackets()
   }
 }
 
+static void UpdateCurrentTime()
+{
+  currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+}
+
+static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bool toAlt);
+
+static void HandleReceivedPacket(Common::TraversalPacket* packet, size_t size, sockaddr_in6* addr,
+                                 bool toAlt)
+{
+  if (size < sizeof(*packet))
+    fmt::print(stderr, "received short packet from {}\n", SenderName(addr));
+  else
+    HandlePacket(packet, addr, toAlt);
+}
+
+// Reads the packets that are waiting on a socket which select() reported as readable.
+// Returns false on a fatal error.
+static bool ReceivePackets(int recvsock)
+{
+  const bool toAlt = recvsock == sockAlt;
+#ifdef __linux__
+  static std::array<Common::TraversalPacket, RECV_BATCH_SIZE> packets;
+  static std::array<sockaddr_in6, RECV_BATCH_SIZE> addrs;
+  static std::array<iovec, RECV_BATCH_SIZE> iovecs;
+  static std::array<mmsghdr, RECV_BATCH_SIZE> msgs;
+  for (size_t i = 0; i < RECV_BATCH_SIZE; i++)
+  {
+    packets[i] = {};
+    iovecs[i] = {&packets[i], sizeof(packets[i])};
+    msgs[i] = {};
+    msgs[i].msg_hdr.msg_name = &addrs[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    msgs[i].msg_hdr.msg_iov = &iovecs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  const int rv = recvmmsg(recvsock, msgs.data(), RECV_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+#else
+  sockaddr_in6 raddr;
+  socklen_t addrLen = sizeof(raddr);
+  Common::TraversalPacket packet{};
+  const int rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
+#endif
+  UpdateCurrentTime();
+  if (rv < 0)
+  {
+    if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+      perror("recvfrom");
+      return false;
+    }
+    return true;
+  }
+
+#ifdef __linux__
+  for (int i = 0; i < rv; i++)
+    HandleReceivedPacket(&packets[i], msgs[i].msg_len, &addrs[i], toAlt);
+#else
+  HandleReceivedPacket(&packet, rv, &raddr, toAlt);
+#endif
+  return true;
+}
+
 static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bool toAlt)
 {
 #if DEBUG
@@ -465,6 +536,7 @@ int main()
   sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d (alt port: %d)", PORT, PORT_ALT);
 #endif
 
+  u64 lastResendCheck = 0;
   while (true)
   {
     tv.tv_sec = 0;
@@ -483,46 +555,24 @@ int main()
       }
     }
 
-    int recvsock;
-    if (FD_ISSET(sock, &readSet))
-    {
-      recvsock = sock;
-    }
-    else if (FD_ISSET(sockAlt, &readSet))
-    {
-      recvsock = sockAlt;
-    }
-    else
+    // Both sockets are read when both are ready, so that a busy main port can't starve the
+    // alt port.
+    const bool sockReady = rv > 0 && FD_ISSET(sock, &readSet);
+    const bool sockAltReady = rv > 0 && FD_ISSET(sockAlt, &readSet);
+    if (sockReady && !ReceivePackets(sock))
+      return 1;
+    if (sockAltReady && !ReceivePackets(sockAlt))
+      return 1;
+
+    // Without this, a timed out select() would check the resends against a stale time.
+    if (!sockReady && !sockAltReady)
+      UpdateCurrentTime();
+
+    if (currentTime - lastResendCheck >= RESEND_CHECK_INTERVAL_US)
     {
+      lastResendCheck = currentTime;
       ResendPackets();
-      continue;
-    }
-    sockaddr_in6 raddr;
-    socklen_t addrLen = sizeof(raddr);
-    Common::TraversalPacket packet{};
-    // note: switch to recvmmsg (yes, mmsg) if this becomes
-    // expensive
-    rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
-    currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::system_clock::now().time_since_epoch())
-                      .count();
-    if (rv < 0)
-    {
-      if (errno != EINTR && errno != EAGAIN)
-      {
-        perror("recvfrom");
-        return 1;
-      }
-    }
-    else if ((size_t)rv < sizeof(packet))
-    {
-      fmt::print(stderr, "received short packet from {}\n", SenderName(&raddr));
-    }
-    else
-    {
-      HandlePacket(&packet, &raddr, recvsock == sockAlt);
     }
-    ResendPackets();
 #ifdef HAVE_LIBSYSTEMD
     sd_notify(0, "WATCHDOG=1");
 #endif
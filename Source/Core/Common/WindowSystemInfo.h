@@ -13,6 +13,7 @@ enum class WindowSystemType
   Wayland,
   FBDev,
   Haiku,
+  DRM,
 };
 
 struct WindowSystemInfo
@@ -28,7 +29,8 @@ struct WindowSystemInfo
   // Window system type. Determines which GL context or Vulkan WSI is used.
   WindowSystemType type = WindowSystemType::Headless;
 
-  // Connection to a display server. This is used on X11 and Wayland platforms.
+  // Connection to a display server. This is used on X11 and Wayland platforms. With DRM, this is
+  // the Common::DRMDisplay.
   void* display_connection = nullptr;
 
   // Render window. This is a pointer to the native window handle, which depends
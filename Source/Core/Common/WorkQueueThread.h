@@ -22,19 +22,23 @@ class WorkQueueThread
 {
 public:
   WorkQueueThread() = default;
-  WorkQueueThread(const std::string_view name, std::function<void(T)> function)
+  WorkQueueThread(const std::string_view name, std::function<void(T)> function,
+                  bool background = false)
   {
-    Reset(name, std::move(function));
+    Reset(name, std::move(function), background);
   }
   ~WorkQueueThread() { Shutdown(); }
 
   // Shuts the current work thread down (if any) and starts a new thread with the given function
   // Note: Some consumers of this API push items to the queue before starting the thread.
-  void Reset(const std::string_view name, std::function<void(T)> function)
+  // Background threads run at a lower priority, see SetCurrentThreadBackgroundPriority.
+  void Reset(const std::string_view name, std::function<void(T)> function,
+             bool background = false)
   {
     Shutdown();
     std::lock_guard lg(m_lock);
     m_thread_name = name;
+    m_background = background;
     m_shutdown = false;
     m_function = std::move(function);
     m_thread = std::thread(&WorkQueueThread::ThreadLoop, this);
@@ -134,6 +138,8 @@ private:
   void ThreadLoop()
   {
     Common::SetCurrentThreadName(m_thread_name.c_str());
+    if (m_background)
+      Common::SetCurrentThreadBackgroundPriority();
 
     while (true)
     {
@@ -167,6 +173,7 @@ private:
   std::atomic<bool> m_cancelling = false;
   bool m_idle = true;
   bool m_shutdown = false;
+  bool m_background = false;
 };
 
 }  // namespace Common
@@ -5,7 +5,9 @@
 
 #include "Core/AchievementManager.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <memory>
 
 #include <fmt/format.h>
@@ -31,6 +33,7 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
 #include "UICommon/DiscordPresence.h"
@@ -1156,7 +1159,26 @@ u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_
     return 0;
   }
   Core::CPUThreadGuard threadguard(system);
-  for (u32 num_read = 0; num_read < num_bytes; num_read++)
+  u32 num_read = 0;
+
+  // Without data cache emulation, physical reads of MEM1 and MEM2 come straight from memory, so
+  // the whole range can be copied at once instead of going through the MMU for every byte.
+  if (!system.GetPPCState().m_enable_dcache)
+  {
+    auto& memory = system.GetMemory();
+    const u32 segment = address >> 28;
+    const bool is_ram = (segment == 0x0 && address < memory.GetRamSizeReal()) ||
+                        (segment == 0x1 && memory.GetEXRAM() &&
+                         (address & 0x0FFFFFFF) < memory.GetExRamSizeReal());
+    if (is_ram)
+    {
+      const std::span<u8> span = memory.GetSpanForAddress(address);
+      num_read = static_cast<u32>(std::min<size_t>(span.size(), num_bytes));
+      std::memcpy(buffer, span.data(), num_read);
+    }
+  }
+
+  for (; num_read < num_bytes; num_read++)
   {
     auto value = system.GetMMU().HostTryReadU8(threadguard, address + num_read,
                                                PowerPC::RequestedAddressSpace::Physical);
@@ -87,6 +87,15 @@ bool BootCore(Core::System& system, std::unique_ptr<BootParameters> boot,
     }
   }
 
+  // Rendering is most of the time spent on playing back a movie, and nothing has to be watched
+  // when it is only played back to check that it syncs. The determinism settings that playback
+  // always uses keep the result the same as with any other backend.
+  if (movie.IsPlayingInput() && Config::Get(Config::MAIN_MOVIE_TURBO_PLAYBACK))
+  {
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Null");
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  }
+
   if (NetPlay::IsNetPlayRunning())
   {
     const NetPlay::NetSettings* netplay_settings = boot->boot_session_data.GetNetplaySettings();
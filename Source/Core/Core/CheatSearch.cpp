@@ -3,18 +3,23 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
 #include <bit>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "Common/Thread.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -198,6 +203,112 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 {
   return PowerPC::MMU::HostTryReadF64(guard, addr, space);
 }
+
+// Bulk searches keep their results as bitsets until there are few enough of them to list.
+constexpr size_t MAX_LISTED_BULK_RESULTS = 0x10000;
+// The number of bitset words that each task of a bulk search filters.
+constexpr size_t BULK_WORDS_PER_TASK = 0x1000;
+
+struct HostRange
+{
+  const u8* data;
+  bool translated;
+};
+
+// Returns where the given range is in host memory, if all of it is in one contiguous range of RAM.
+std::optional<HostRange> GetHostRange(const Core::CPUThreadGuard& guard, u32 address, u64 length,
+                                      PowerPC::RequestedAddressSpace space)
+{
+  auto& system = guard.GetSystem();
+  auto& mmu = system.GetMMU();
+  const bool translated =
+      space == PowerPC::RequestedAddressSpace::Virtual ||
+      (space == PowerPC::RequestedAddressSpace::Effective && system.GetPPCState().msr.DR);
+
+  const std::optional<u32> physical_address =
+      translated ? mmu.GetTranslatedAddress(address) : std::optional<u32>(address);
+  if (!physical_address)
+    return std::nullopt;
+
+  if (translated)
+  {
+    // Every page has to be mapped right after the one before it.
+    for (u64 offset = PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK); offset < length;
+         offset += PowerPC::HW_PAGE_SIZE)
+    {
+      const std::optional<u32> page = mmu.GetTranslatedAddress(static_cast<u32>(address + offset));
+      if (!page || *page != *physical_address + offset)
+        return std::nullopt;
+    }
+  }
+
+  auto& memory = system.GetMemory();
+  const u64 start = *physical_address;
+  if (start + length <= memory.GetRamSizeReal())
+    return HostRange{memory.GetRAM() + start, translated};
+  if (memory.GetEXRAM() && (start >> 28) == 1 &&
+      (start & 0x0fffffff) + length <= memory.GetExRamSizeReal())
+  {
+    return HostRange{memory.GetEXRAM() + (start & 0x0fffffff), translated};
+  }
+  return std::nullopt;
+}
+
+template <typename T>
+T ReadBigEndianValue(const u8* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+// Clears the bits of the candidates that keep doesn't return true for. All candidates of a word
+// are compared even if only some of them are still set, so that the compiler can vectorize the
+// comparisons, and the words are spread over all cores.
+template <typename Keep>
+void FilterMatches(std::vector<u64>& matches, size_t candidate_count, const Keep& keep)
+{
+  const size_t task_count = (matches.size() + BULK_WORDS_PER_TASK - 1) / BULK_WORDS_PER_TASK;
+  Common::ParallelFor(task_count, [&](size_t task) {
+    const size_t end = std::min(matches.size(), (task + 1) * BULK_WORDS_PER_TASK);
+    for (size_t word = task * BULK_WORDS_PER_TASK; word < end; ++word)
+    {
+      if (matches[word] == 0)
+        continue;
+
+      const size_t first = word * 64;
+      const size_t count = std::min<size_t>(64, candidate_count - first);
+      u64 kept = 0;
+      for (size_t i = 0; i < count; ++i)
+        kept |= u64(keep(first + i)) << i;
+      matches[word] &= kept;
+    }
+  });
+}
+
+// Calls function with the function object that implements the comparison.
+template <typename T, typename Function>
+void VisitComparison(Cheats::CompareType op, const Function& function)
+{
+  switch (op)
+  {
+  case Cheats::CompareType::Equal:
+    return function(std::equal_to<T>());
+  case Cheats::CompareType::NotEqual:
+    return function(std::not_equal_to<T>());
+  case Cheats::CompareType::Less:
+    return function(std::less<T>());
+  case Cheats::CompareType::LessOrEqual:
+    return function(std::less_equal<T>());
+  case Cheats::CompareType::Greater:
+    return function(std::greater<T>());
+  case Cheats::CompareType::GreaterOrEqual:
+    return function(std::greater_equal<T>());
+  default:
+    DEBUG_ASSERT(false);
+    return;
+  }
+}
 }  // namespace
 
 template <typename T>
@@ -372,6 +483,8 @@ void Cheats::CheatSearchSession<T>::ResetResults()
 {
   m_first_search_done = false;
   m_search_results.clear();
+  m_bulk_ranges.clear();
+  m_bulk_result_count = 0;
 }
 
 template <typename T>
@@ -422,11 +535,217 @@ MakeCompareFunctionForLastValue(Cheats::CompareType op)
   }
 }
 
+template <typename T>
+std::optional<Cheats::SearchErrorCode>
+Cheats::CheatSearchSession<T>::RunBulkSearch(const Core::CPUThreadGuard& guard)
+{
+  const bool new_search = !m_first_search_done;
+  if (new_search ? m_filter_type == FilterType::CompareAgainstLastValue : m_bulk_ranges.empty())
+    return std::nullopt;
+
+  // The regular search takes over from here, so it needs the results as a list.
+  const auto fall_back = [this]() -> std::optional<SearchErrorCode> {
+    if (!m_bulk_ranges.empty())
+    {
+      m_search_results = GetBulkResults(0, m_bulk_result_count);
+      m_bulk_ranges.clear();
+      m_bulk_result_count = 0;
+    }
+    return std::nullopt;
+  };
+
+  auto& system = guard.GetSystem();
+  const Core::State core_state = Core::GetState(system);
+  const auto& ppc_state = system.GetPPCState();
+  if ((m_filter_type == FilterType::CompareAgainstSpecificValue && !m_value) ||
+      (core_state != Core::State::Running && core_state != Core::State::Paused) ||
+      (m_address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR) ||
+      ppc_state.m_enable_dcache)
+  {
+    return fall_back();
+  }
+
+  const size_t step = m_aligned ? sizeof(T) : 1;
+  std::vector<BulkRange> new_ranges;
+  if (new_search)
+  {
+    for (const MemoryRange& range : m_memory_ranges)
+    {
+      if (range.m_length < sizeof(T))
+        continue;
+
+      const u32 start_address =
+          m_aligned ? Common::AlignUp(range.m_start, sizeof(T)) : range.m_start;
+      const u64 aligned_length = range.m_length - (start_address - range.m_start);
+      if (aligned_length < sizeof(T))
+        continue;
+
+      BulkRange& bulk = new_ranges.emplace_back();
+      bulk.m_address = start_address;
+      bulk.m_candidate_count = (aligned_length - sizeof(T)) / step + 1;
+      bulk.m_matches.assign((bulk.m_candidate_count + 63) / 64, ~u64(0));
+      if (bulk.m_candidate_count % 64 != 0)
+        bulk.m_matches.back() = (u64(1) << (bulk.m_candidate_count % 64)) - 1;
+    }
+  }
+  std::vector<BulkRange>& ranges = new_search ? new_ranges : m_bulk_ranges;
+
+  std::vector<HostRange> host_ranges;
+  for (const BulkRange& bulk : ranges)
+  {
+    const u64 length = (bulk.m_candidate_count - 1) * step + sizeof(T);
+    const std::optional<HostRange> host_range =
+        GetHostRange(guard, bulk.m_address, length, m_address_space);
+    if (!host_range)
+      return fall_back();
+    host_ranges.push_back(*host_range);
+  }
+
+  size_t result_count = 0;
+  for (size_t i = 0; i < ranges.size(); ++i)
+  {
+    BulkRange& bulk = ranges[i];
+    const u8* const current = host_ranges[i].data;
+
+    // A constant step lets the compiler vectorize the comparisons.
+    const auto filter = [&](auto constant_step) {
+      constexpr size_t STEP = decltype(constant_step)::value;
+      const auto value_at = [](const u8* data, size_t candidate) {
+        return ReadBigEndianValue<T>(data + candidate * STEP);
+      };
+
+      if (m_filter_type == FilterType::CompareAgainstSpecificValue)
+      {
+        VisitComparison<T>(m_compare_type, [&](auto compare) {
+          FilterMatches(bulk.m_matches, bulk.m_candidate_count, [&](size_t candidate) {
+            return compare(value_at(current, candidate), *m_value);
+          });
+        });
+      }
+      else if (m_filter_type == FilterType::CompareAgainstLastValue)
+      {
+        const u8* const last = bulk.m_values.data();
+        VisitComparison<T>(m_compare_type, [&](auto compare) {
+          FilterMatches(bulk.m_matches, bulk.m_candidate_count, [&](size_t candidate) {
+            return compare(value_at(current, candidate), value_at(last, candidate));
+          });
+        });
+      }
+    };
+    if (m_aligned)
+      filter(std::integral_constant<size_t, sizeof(T)>());
+    else
+      filter(std::integral_constant<size_t, 1>());
+
+    bulk.m_value_state = host_ranges[i].translated ?
+                             Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                             Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+    bulk.m_values.assign(current, current + (bulk.m_candidate_count - 1) * step + sizeof(T));
+
+    bulk.m_ranks.resize(bulk.m_matches.size());
+    u32 rank = 0;
+    for (size_t word = 0; word < bulk.m_matches.size(); ++word)
+    {
+      bulk.m_ranks[word] = rank;
+      rank += std::popcount(bulk.m_matches[word]);
+    }
+    bulk.m_match_count = rank;
+    result_count += rank;
+  }
+
+  if (new_search)
+    m_bulk_ranges = std::move(new_ranges);
+  m_bulk_result_count = result_count;
+  m_first_search_done = true;
+
+  m_search_results.clear();
+  if (m_bulk_result_count <= MAX_LISTED_BULK_RESULTS)
+  {
+    m_search_results = GetBulkResults(0, m_bulk_result_count);
+    m_bulk_ranges.clear();
+    m_bulk_result_count = 0;
+  }
+
+  return Cheats::SearchErrorCode::Success;
+}
+
+template <typename T>
+std::vector<Cheats::SearchResult<T>>
+Cheats::CheatSearchSession<T>::GetBulkResults(size_t begin_index, size_t end_index) const
+{
+  const size_t step = m_aligned ? sizeof(T) : 1;
+  std::vector<SearchResult<T>> results;
+  results.reserve(end_index - begin_index);
+
+  size_t index = 0;
+  for (const BulkRange& bulk : m_bulk_ranges)
+  {
+    if (index + bulk.m_match_count <= begin_index)
+    {
+      index += bulk.m_match_count;
+      continue;
+    }
+
+    for (size_t word = 0; word < bulk.m_matches.size() && index < end_index; ++word)
+    {
+      u64 bits = bulk.m_matches[word];
+      const size_t count = std::popcount(bits);
+      if (index + count <= begin_index)
+      {
+        index += count;
+        continue;
+      }
+
+      for (; bits != 0 && index < end_index; bits &= bits - 1, ++index)
+      {
+        if (index < begin_index)
+          continue;
+
+        const size_t candidate = word * 64 + std::countr_zero(bits);
+        auto& r = results.emplace_back();
+        r.m_value = ReadBigEndianValue<T>(bulk.m_values.data() + candidate * step);
+        r.m_value_state = bulk.m_value_state;
+        r.m_address = static_cast<u32>(bulk.m_address + candidate * step);
+      }
+    }
+  }
+
+  return results;
+}
+
+template <typename T>
+std::pair<const typename Cheats::CheatSearchSession<T>::BulkRange*, size_t>
+Cheats::CheatSearchSession<T>::FindBulkResult(size_t index) const
+{
+  for (const BulkRange& bulk : m_bulk_ranges)
+  {
+    if (index >= bulk.m_match_count)
+    {
+      index -= bulk.m_match_count;
+      continue;
+    }
+
+    // The last word with fewer matches before it than the index is the one with the result.
+    const size_t word = std::upper_bound(bulk.m_ranks.begin(), bulk.m_ranks.end(), index) -
+                        bulk.m_ranks.begin() - 1;
+    u64 bits = bulk.m_matches[word];
+    for (size_t skipped = bulk.m_ranks[word]; skipped < index; ++skipped)
+      bits &= bits - 1;
+    return {&bulk, word * 64 + std::countr_zero(bits)};
+  }
+
+  DEBUG_ASSERT(false);
+  return {nullptr, 0};
+}
+
 template <typename T>
 Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPUThreadGuard& guard)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
+  if (const std::optional<SearchErrorCode> error_code = RunBulkSearch(guard))
+    return *error_code;
+
   Common::Result<SearchErrorCode, std::vector<SearchResult<T>>> result =
       Cheats::SearchErrorCode::InvalidParameters;
   if (m_filter_type == FilterType::CompareAgainstSpecificValue)
@@ -523,12 +842,16 @@ bool Cheats::CheatSearchSession<T>::IsFloatingType() const
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetResultCount() const
 {
-  return m_search_results.size();
+  return m_bulk_ranges.empty() ? m_search_results.size() : m_bulk_result_count;
 }
 
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetValidValueCount() const
 {
+  // The values of bulk results are all read straight from RAM.
+  if (!m_bulk_ranges.empty())
+    return m_bulk_result_count;
+
   const auto& results = m_search_results;
   size_t count = 0;
   for (const auto& r : results)
@@ -542,19 +865,31 @@ size_t Cheats::CheatSearchSession<T>::GetValidValueCount() const
 template <typename T>
 u32 Cheats::CheatSearchSession<T>::GetResultAddress(size_t index) const
 {
+  if (!m_bulk_ranges.empty())
+  {
+    const auto [bulk, candidate] = FindBulkResult(index);
+    return static_cast<u32>(bulk->m_address + candidate * (m_aligned ? sizeof(T) : 1));
+  }
+
   return m_search_results[index].m_address;
 }
 
 template <typename T>
 T Cheats::CheatSearchSession<T>::GetResultValue(size_t index) const
 {
+  if (!m_bulk_ranges.empty())
+  {
+    const auto [bulk, candidate] = FindBulkResult(index);
+    return ReadBigEndianValue<T>(bulk->m_values.data() + candidate * (m_aligned ? sizeof(T) : 1));
+  }
+
   return m_search_results[index].m_value;
 }
 
 template <typename T>
 Cheats::SearchValue Cheats::CheatSearchSession<T>::GetResultValueAsSearchValue(size_t index) const
 {
-  return Cheats::SearchValue{m_search_results[index].m_value};
+  return Cheats::SearchValue{GetResultValue(index)};
 }
 
 template <typename T>
@@ -563,31 +898,34 @@ std::string Cheats::CheatSearchSession<T>::GetResultValueAsString(size_t index,
   if (GetResultValueState(index) == Cheats::SearchResultValueState::AddressNotAccessible)
     return "(inaccessible)";
 
+  const T value = GetResultValue(index);
   if (hex)
   {
     if constexpr (std::is_same_v<T, float>)
     {
-      return fmt::format("0x{0:08x}", std::bit_cast<s32>(m_search_results[index].m_value));
+      return fmt::format("0x{0:08x}", std::bit_cast<s32>(value));
     }
     else if constexpr (std::is_same_v<T, double>)
     {
-      return fmt::format("0x{0:016x}", std::bit_cast<s64>(m_search_results[index].m_value));
+      return fmt::format("0x{0:016x}", std::bit_cast<s64>(value));
     }
     else
     {
-      return fmt::format("0x{0:0{1}x}",
-                         std::bit_cast<std::make_unsigned_t<T>>(m_search_results[index].m_value),
+      return fmt::format("0x{0:0{1}x}", std::bit_cast<std::make_unsigned_t<T>>(value),
                          sizeof(T) * 2);
     }
   }
 
-  return fmt::format("{}", m_search_results[index].m_value);
+  return fmt::format("{}", value);
 }
 
 template <typename T>
 Cheats::SearchResultValueState
 Cheats::CheatSearchSession<T>::GetResultValueState(size_t index) const
 {
+  if (!m_bulk_ranges.empty())
+    return FindBulkResult(index).first->m_value_state;
+
   return m_search_results[index].m_value_state;
 }
 
@@ -612,8 +950,15 @@ Cheats::CheatSearchSession<T>::ClonePartial(const size_t begin_index, const size
 
   auto c =
       std::make_unique<Cheats::CheatSearchSession<T>>(m_memory_ranges, m_address_space, m_aligned);
-  c->m_search_results.assign(m_search_results.begin() + begin_index,
-                             m_search_results.begin() + end_index);
+  if (!m_bulk_ranges.empty())
+  {
+    c->m_search_results = GetBulkResults(begin_index, end_index);
+  }
+  else
+  {
+    c->m_search_results.assign(m_search_results.begin() + begin_index,
+                               m_search_results.begin() + end_index);
+  }
   c->m_compare_type = this->m_compare_type;
   c->m_filter_type = this->m_filter_type;
   c->m_value = this->m_value;
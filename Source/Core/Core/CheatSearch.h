@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -217,7 +218,30 @@ public:
                                                        size_t end_index) const override;
 
 private:
+  // The results of a search over a range that is contiguous in emulated RAM, as a bitset of the
+  // candidate addresses that matched and a copy of the range as it was read by the search.
+  struct BulkRange
+  {
+    u32 m_address;
+    SearchResultValueState m_value_state;
+    size_t m_candidate_count;
+    std::vector<u64> m_matches;
+    // The number of matches in the words of m_matches before each word.
+    std::vector<u32> m_ranks;
+    size_t m_match_count;
+    std::vector<u8> m_values;
+  };
+
+  // Searches the RAM behind the memory ranges directly instead of value by value, as long as
+  // every range is contiguous in RAM. Returns std::nullopt if the regular search has to be used.
+  std::optional<SearchErrorCode> RunBulkSearch(const Core::CPUThreadGuard& guard);
+  std::vector<SearchResult<T>> GetBulkResults(size_t begin_index, size_t end_index) const;
+  std::pair<const BulkRange*, size_t> FindBulkResult(size_t index) const;
+
   std::vector<SearchResult<T>> m_search_results;
+  // Used instead of m_search_results while there are too many results to keep them as a list.
+  std::vector<BulkRange> m_bulk_ranges;
+  size_t m_bulk_result_count = 0;
   std::vector<MemoryRange> m_memory_ranges;
   PowerPC::RequestedAddressSpace m_address_space;
   CompareType m_compare_type = CompareType::Equal;
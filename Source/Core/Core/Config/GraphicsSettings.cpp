@@ -16,6 +16,9 @@ namespace Config
 
 const Info<bool> GFX_VSYNC{{System::GFX, "Hardware", "VSync"}, false};
 const Info<int> GFX_ADAPTER{{System::GFX, "Hardware", "Adapter"}, 0};
+const Info<bool> GFX_LATENCY_REDUCTION{{System::GFX, "Hardware", "LatencyReduction"}, false};
+const Info<int> GFX_LATENCY_REDUCTION_MARGIN{{System::GFX, "Hardware", "LatencyReductionMargin"},
+                                             2000};
 
 // Graphics.Settings
 
@@ -38,10 +41,14 @@ const Info<float> GFX_WIDESCREEN_HEURISTIC_WIDESCREEN_RATIO{
 const Info<bool> GFX_CROP{{System::GFX, "Settings", "Crop"}, false};
 const Info<int> GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES{
     {System::GFX, "Settings", "SafeTextureCacheColorSamples"}, 128};
+const Info<u32> GFX_TEXTURE_CACHE_MEMORY_BUDGET{
+    {System::GFX, "Settings", "TextureCacheMemoryBudget"}, 0};
 const Info<bool> GFX_SHOW_FPS{{System::GFX, "Settings", "ShowFPS"}, false};
 const Info<bool> GFX_SHOW_FTIMES{{System::GFX, "Settings", "ShowFTimes"}, false};
 const Info<bool> GFX_SHOW_VPS{{System::GFX, "Settings", "ShowVPS"}, false};
 const Info<bool> GFX_SHOW_VTIMES{{System::GFX, "Settings", "ShowVTimes"}, false};
+const Info<bool> GFX_SHOW_FRAME_PACING{{System::GFX, "Settings", "ShowFramePacing"}, false};
+const Info<bool> GFX_SHOW_PERF_COUNTERS{{System::GFX, "Settings", "ShowPerfCounters"}, false};
 const Info<bool> GFX_SHOW_GRAPHS{{System::GFX, "Settings", "ShowGraphs"}, false};
 const Info<bool> GFX_SHOW_SPEED{{System::GFX, "Settings", "ShowSpeed"}, false};
 const Info<bool> GFX_SHOW_SPEED_COLORS{{System::GFX, "Settings", "ShowSpeedColors"}, true};
@@ -60,6 +67,8 @@ const Info<int> GFX_TEXTURE_PNG_COMPRESSION_LEVEL{
     {System::GFX, "Settings", "TexturePNGCompressionLevel"}, 6};
 const Info<bool> GFX_HIRES_TEXTURES{{System::GFX, "Settings", "HiresTextures"}, false};
 const Info<bool> GFX_CACHE_HIRES_TEXTURES{{System::GFX, "Settings", "CacheHiresTextures"}, false};
+const Info<bool> GFX_TRANSCODE_HIRES_TEXTURES{{System::GFX, "Settings", "TranscodeHiresTextures"},
+                                               false};
 const Info<bool> GFX_DUMP_EFB_TARGET{{System::GFX, "Settings", "DumpEFBTarget"}, false};
 const Info<bool> GFX_DUMP_XFB_TARGET{{System::GFX, "Settings", "DumpXFBTarget"}, false};
 const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES{{System::GFX, "Settings", "DumpFramesAsImages"}, false};
@@ -82,6 +91,7 @@ const Info<u32> GFX_MSAA{{System::GFX, "Settings", "MSAA"}, 1};
 const Info<bool> GFX_SSAA{{System::GFX, "Settings", "SSAA"}, false};
 const Info<int> GFX_EFB_SCALE{{System::GFX, "Settings", "InternalResolution"}, 1};
 const Info<int> GFX_MAX_EFB_SCALE{{System::GFX, "Settings", "MaxInternalResolution"}, 12};
+const Info<bool> GFX_DYNAMIC_RESOLUTION{{System::GFX, "Settings", "DynamicResolution"}, false};
 const Info<bool> GFX_TEXFMT_OVERLAY_ENABLE{{System::GFX, "Settings", "TexFmtOverlayEnable"}, false};
 const Info<bool> GFX_TEXFMT_OVERLAY_CENTER{{System::GFX, "Settings", "TexFmtOverlayCenter"}, false};
 const Info<bool> GFX_ENABLE_WIREFRAME{{System::GFX, "Settings", "WireFrame"}, false};
@@ -104,21 +114,30 @@ const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE{
 const Info<int> GFX_SHADER_COMPILER_THREADS{{System::GFX, "Settings", "ShaderCompilerThreads"}, 1};
 const Info<int> GFX_SHADER_PRECOMPILER_THREADS{
     {System::GFX, "Settings", "ShaderPrecompilerThreads"}, -1};
+const Info<int> GFX_SHADER_COMPILE_FRAME_BUDGET{
+    {System::GFX, "Settings", "ShaderCompileFrameBudget"}, 0};
+const Info<bool> GFX_SPECIALIZE_UBERSHADERS{{System::GFX, "Settings", "SpecializeUberShaders"},
+                                            false};
 const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE{
     {System::GFX, "Settings", "SaveTextureCacheToState"}, true};
 const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION{
     {System::GFX, "Settings", "PreferVSForLinePointExpansion"}, false};
 const Info<bool> GFX_CPU_CULL{{System::GFX, "Settings", "CPUCull"}, false};
+const Info<bool> GFX_CPU_CULL_TRIANGLES{{System::GFX, "Settings", "CPUCullTriangles"}, false};
+const Info<bool> GFX_LOW_MEMORY{{System::GFX, "Settings", "LowMemory"}, false};
 
 const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS{
     {System::GFX, "Settings", "ManuallyUploadBuffers"}, TriState::Auto};
 const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE{
     {System::GFX, "Settings", "MTLUsePresentDrawable"}, TriState::Auto};
 
+const Info<bool> GFX_NULL_THROUGHPUT_MODE{{System::GFX, "Settings", "NullThroughputMode"}, false};
+
 const Info<bool> GFX_SW_DUMP_OBJECTS{{System::GFX, "Settings", "SWDumpObjects"}, false};
 const Info<bool> GFX_SW_DUMP_TEV_STAGES{{System::GFX, "Settings", "SWDumpTevStages"}, false};
 const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES{{System::GFX, "Settings", "SWDumpTevTexFetches"},
                                              false};
+const Info<int> GFX_SW_RASTERIZER_THREADS{{System::GFX, "Settings", "SWRasterizerThreads"}, 1};
 
 const Info<bool> GFX_PREFER_GLES{{System::GFX, "Settings", "PreferGLES"}, false};
 
@@ -181,7 +200,10 @@ const Info<bool> GFX_HACK_EFB_ACCESS_ENABLE{{System::GFX, "Hacks", "EFBAccessEna
 const Info<bool> GFX_HACK_EFB_DEFER_INVALIDATION{
     {System::GFX, "Hacks", "EFBAccessDeferInvalidation"}, false};
 const Info<int> GFX_HACK_EFB_ACCESS_TILE_SIZE{{System::GFX, "Hacks", "EFBAccessTileSize"}, 64};
+const Info<int> GFX_HACK_EFB_ACCESS_STALE_FRAMES{
+    {System::GFX, "Hacks", "EFBAccessStaleFrames"}, 0};
 const Info<bool> GFX_HACK_BBOX_ENABLE{{System::GFX, "Hacks", "BBoxEnable"}, false};
+const Info<int> GFX_HACK_BBOX_READBACK_LATENCY{{System::GFX, "Hacks", "BBoxReadbackLatency"}, 0};
 const Info<bool> GFX_HACK_FORCE_PROGRESSIVE{{System::GFX, "Hacks", "ForceProgressive"}, true};
 const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM{{System::GFX, "Hacks", "EFBToTextureEnable"}, true};
 const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM{{System::GFX, "Hacks", "XFBToTextureEnable"}, true};
@@ -199,6 +221,8 @@ const Info<u32> GFX_HACK_MISSING_COLOR_VALUE{{System::GFX, "Hacks", "MissingColo
                                              0xFFFFFFFF};
 const Info<bool> GFX_HACK_FAST_TEXTURE_SAMPLING{{System::GFX, "Hacks", "FastTextureSampling"},
                                                 true};
+const Info<bool> GFX_HACK_ASYNC_TEXTURE_LOADING{{System::GFX, "Hacks", "AsyncTextureLoading"},
+                                                false};
 #ifdef __APPLE__
 const Info<bool> GFX_HACK_NO_MIPMAPPING{{System::GFX, "Hacks", "NoMipmapping"}, false};
 #endif
@@ -206,5 +230,7 @@ const Info<bool> GFX_HACK_NO_MIPMAPPING{{System::GFX, "Hacks", "NoMipmapping"},
 // Graphics.GameSpecific
 
 const Info<bool> GFX_PERF_QUERIES_ENABLE{{System::GFX, "GameSpecific", "PerfQueriesEnable"}, false};
+const Info<int> GFX_PERF_QUERIES_STALE_FRAMES{
+    {System::GFX, "GameSpecific", "PerfQueriesStaleFrames"}, 0};
 
 }  // namespace Config
@@ -25,6 +25,9 @@ namespace Config
 
 extern const Info<bool> GFX_VSYNC;
 extern const Info<int> GFX_ADAPTER;
+extern const Info<bool> GFX_LATENCY_REDUCTION;
+// In microseconds.
+extern const Info<int> GFX_LATENCY_REDUCTION_MARGIN;
 
 // Graphics.Settings
 
@@ -39,10 +42,13 @@ extern const Info<float> GFX_WIDESCREEN_HEURISTIC_STANDARD_RATIO;
 extern const Info<float> GFX_WIDESCREEN_HEURISTIC_WIDESCREEN_RATIO;
 extern const Info<bool> GFX_CROP;
 extern const Info<int> GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES;
+extern const Info<u32> GFX_TEXTURE_CACHE_MEMORY_BUDGET;
 extern const Info<bool> GFX_SHOW_FPS;
 extern const Info<bool> GFX_SHOW_FTIMES;
 extern const Info<bool> GFX_SHOW_VPS;
 extern const Info<bool> GFX_SHOW_VTIMES;
+extern const Info<bool> GFX_SHOW_FRAME_PACING;
+extern const Info<bool> GFX_SHOW_PERF_COUNTERS;
 extern const Info<bool> GFX_SHOW_GRAPHS;
 extern const Info<bool> GFX_SHOW_SPEED;
 extern const Info<bool> GFX_SHOW_SPEED_COLORS;
@@ -59,6 +65,7 @@ extern const Info<bool> GFX_DUMP_BASE_TEXTURES;
 extern const Info<int> GFX_TEXTURE_PNG_COMPRESSION_LEVEL;
 extern const Info<bool> GFX_HIRES_TEXTURES;
 extern const Info<bool> GFX_CACHE_HIRES_TEXTURES;
+extern const Info<bool> GFX_TRANSCODE_HIRES_TEXTURES;
 extern const Info<bool> GFX_DUMP_EFB_TARGET;
 extern const Info<bool> GFX_DUMP_XFB_TARGET;
 extern const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES;
@@ -78,6 +85,7 @@ extern const Info<u32> GFX_MSAA;
 extern const Info<bool> GFX_SSAA;
 extern const Info<int> GFX_EFB_SCALE;
 extern const Info<int> GFX_MAX_EFB_SCALE;
+extern const Info<bool> GFX_DYNAMIC_RESOLUTION;
 extern const Info<bool> GFX_TEXFMT_OVERLAY_ENABLE;
 extern const Info<bool> GFX_TEXFMT_OVERLAY_CENTER;
 extern const Info<bool> GFX_ENABLE_WIREFRAME;
@@ -91,16 +99,23 @@ extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
 extern const Info<int> GFX_SHADER_COMPILER_THREADS;
 extern const Info<int> GFX_SHADER_PRECOMPILER_THREADS;
+extern const Info<int> GFX_SHADER_COMPILE_FRAME_BUDGET;
+extern const Info<bool> GFX_SPECIALIZE_UBERSHADERS;
 extern const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE;
 extern const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION;
 extern const Info<bool> GFX_CPU_CULL;
+extern const Info<bool> GFX_CPU_CULL_TRIANGLES;
+extern const Info<bool> GFX_LOW_MEMORY;
 
 extern const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS;
 extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
 
+extern const Info<bool> GFX_NULL_THROUGHPUT_MODE;
+
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+extern const Info<int> GFX_SW_RASTERIZER_THREADS;
 
 extern const Info<bool> GFX_PREFER_GLES;
 
@@ -157,7 +172,9 @@ static constexpr int GFX_STEREO_CONVERGENCE_MAXIMUM = 200;
 extern const Info<bool> GFX_HACK_EFB_ACCESS_ENABLE;
 extern const Info<bool> GFX_HACK_EFB_DEFER_INVALIDATION;
 extern const Info<int> GFX_HACK_EFB_ACCESS_TILE_SIZE;
+extern const Info<int> GFX_HACK_EFB_ACCESS_STALE_FRAMES;
 extern const Info<bool> GFX_HACK_BBOX_ENABLE;
+extern const Info<int> GFX_HACK_BBOX_READBACK_LATENCY;
 extern const Info<bool> GFX_HACK_FORCE_PROGRESSIVE;
 extern const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM;
 extern const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM;
@@ -172,6 +189,7 @@ extern const Info<bool> GFX_HACK_VERTEX_ROUNDING;
 extern const Info<bool> GFX_HACK_VI_SKIP;
 extern const Info<u32> GFX_HACK_MISSING_COLOR_VALUE;
 extern const Info<bool> GFX_HACK_FAST_TEXTURE_SAMPLING;
+extern const Info<bool> GFX_HACK_ASYNC_TEXTURE_LOADING;
 #ifdef __APPLE__
 extern const Info<bool> GFX_HACK_NO_MIPMAPPING;
 #endif
@@ -179,6 +197,7 @@ extern const Info<bool> GFX_HACK_NO_MIPMAPPING;
 // Graphics.GameSpecific
 
 extern const Info<bool> GFX_PERF_QUERIES_ENABLE;
+extern const Info<int> GFX_PERF_QUERIES_STALE_FRAMES;
 
 // Android custom GPU drivers
 
@@ -38,13 +38,26 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_TRACE_FORMATION{{System::Main, "Core", "JITTraceFormation"}, false};
+const Info<std::string> MAIN_IDLE_LOOP_ADDRESSES{{System::Main, "Core", "IdleLoopAddresses"}, ""};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
+const Info<bool> MAIN_HUGE_PAGES{{System::Main, "Core", "HugePages"}, false};
+const Info<bool> MAIN_JIT_BLOCK_DISK_CACHE{{System::Main, "Core", "JITBlockDiskCache"}, false};
+const Info<bool> MAIN_JIT_TIERED_COMPILATION{{System::Main, "Core", "JITTieredCompilation"},
+                                             false};
+const Info<u32> MAIN_JIT_TIER_UP_THRESHOLD{{System::Main, "Core", "JITTierUpThreshold"}, 16};
+const Info<bool> MAIN_JIT_BACKGROUND_ANALYSIS{{System::Main, "Core", "JITBackgroundAnalysis"},
+                                              false};
+const Info<std::string> MAIN_JIT_PROFILE_EXPORT_PATH{
+    {System::Main, "Core", "JITProfileExportPath"}, ""};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
+const Info<bool> MAIN_HYBRID_CPU_CACHE{{System::Main, "Core", "HybridCPUCache"}, false};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_MAX_FALLBACK{{System::Main, "Core", "MaxFallback"}, 100};
 const Info<int> MAIN_TIMING_VARIANCE{{System::Main, "Core", "TimingVariance"}, 40};
+const Info<bool> MAIN_PRECISE_THROTTLE{{System::Main, "Core", "PreciseThrottle"}, false};
 const Info<bool> MAIN_CPU_THREAD{{System::Main, "Core", "CPUThread"}, true};
 const Info<bool> MAIN_SYNC_ON_SKIP_IDLE{{System::Main, "Core", "SyncOnSkipIdle"}, true};
 const Info<std::string> MAIN_DEFAULT_ISO{{System::Main, "Core", "DefaultISO"}, ""};
@@ -56,8 +69,15 @@ const Info<bool> MAIN_DPL2_DECODER{{System::Main, "Core", "DPL2Decoder"}, false}
 const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY{{System::Main, "Core", "DPL2Quality"},
                                                        AudioCommon::GetDefaultDPL2Quality()};
 const Info<int> MAIN_AUDIO_LATENCY{{System::Main, "Core", "AudioLatency"}, 20};
+const Info<bool> MAIN_AUDIO_LOW_LATENCY{{System::Main, "Core", "AudioLowLatency"}, false};
 const Info<bool> MAIN_AUDIO_STRETCH{{System::Main, "Core", "AudioStretch"}, false};
 const Info<int> MAIN_AUDIO_STRETCH_LATENCY{{System::Main, "Core", "AudioStretchMaxLatency"}, 80};
+const Info<bool> MAIN_AUDIO_STRETCH_FAST{{System::Main, "Core", "AudioStretchFast"}, false};
+const Info<bool> MAIN_STATE_COMPRESSION_ZSTD{{System::Main, "Core", "StateCompressionZstd"},
+                                             false};
+const Info<bool> MAIN_REWIND_ENABLED{{System::Main, "Core", "RewindEnabled"}, false};
+const Info<int> MAIN_REWIND_INTERVAL{{System::Main, "Core", "RewindInterval"}, 30};
+const Info<int> MAIN_REWIND_BUFFER_SIZE{{System::Main, "Core", "RewindBufferSize"}, 512};
 const Info<std::string> MAIN_MEMCARD_A_PATH{{System::Main, "Core", "MemcardAPath"}, ""};
 const Info<std::string> MAIN_MEMCARD_B_PATH{{System::Main, "Core", "MemcardBPath"}, ""};
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot)
@@ -193,11 +213,23 @@ const Info<bool> MAIN_CONNECT_WIIMOTES_FOR_CONTROLLER_INTERFACE{
 const Info<bool> MAIN_MMU{{System::Main, "Core", "MMU"}, false};
 const Info<bool> MAIN_PAUSE_ON_PANIC{{System::Main, "Core", "PauseOnPanic"}, false};
 const Info<int> MAIN_BB_DUMP_PORT{{System::Main, "Core", "BBDumpPort"}, -1};
+const Info<u32> MAIN_FRAME_TRACE_LENGTH{{System::Main, "Core", "FrameTraceLength"}, 10};
 const Info<bool> MAIN_SYNC_GPU{{System::Main, "Core", "SyncGPU"}, false};
 const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE{{System::Main, "Core", "SyncGpuMaxDistance"}, 200000};
 const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE{{System::Main, "Core", "SyncGpuMinDistance"}, -200000};
 const Info<float> MAIN_SYNC_GPU_OVERCLOCK{{System::Main, "Core", "SyncGpuOverclock"}, 1.0f};
+const Info<bool> MAIN_BOUNDED_GPU_LATENCY{{System::Main, "Core", "BoundedGPULatency"}, false};
+const Info<int> MAIN_BOUNDED_GPU_LATENCY_MAX_CYCLES{
+    {System::Main, "Core", "BoundedGPULatencyMaxCycles"}, 4000000};
+const Info<int> MAIN_BOUNDED_GPU_LATENCY_MAX_BYTES{
+    {System::Main, "Core", "BoundedGPULatencyMaxBytes"}, 256 * 1024};
 const Info<bool> MAIN_FAST_DISC_SPEED{{System::Main, "Core", "FastDiscSpeed"}, false};
+const Info<u32> MAIN_WIA_CHUNK_CACHE_SIZE{{System::Main, "Core", "WIAChunkCacheSize"}, 16};
+const Info<bool> MAIN_WIA_READ_AHEAD{{System::Main, "Core", "WIAReadAhead"}, true};
+const Info<bool> MAIN_MEMORY_MAP_DISC_IMAGES{{System::Main, "Core", "MemoryMapDiscImages"},
+                                             false};
+const Info<bool> MAIN_WII_CLUSTER_CACHE{{System::Main, "Core", "WiiClusterCache"}, false};
+const Info<u32> MAIN_WII_CLUSTER_CACHE_SIZE{{System::Main, "Core", "WiiClusterCacheSize"}, 1024};
 const Info<bool> MAIN_LOW_DCBZ_HACK{{System::Main, "Core", "LowDCBZHack"}, false};
 const Info<bool> MAIN_FLOAT_EXCEPTIONS{{System::Main, "Core", "FloatExceptions"}, false};
 const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS{{System::Main, "Core", "DivByZeroExceptions"},
@@ -236,6 +268,7 @@ GPUDeterminismMode GetGPUDeterminismMode()
 }
 
 const Info<std::string> MAIN_PERF_MAP_DIR{{System::Main, "Core", "PerfMapDir"}, ""};
+const Info<bool> MAIN_PERF_JIT_DUMP{{System::Main, "Core", "PerfJitDump"}, false};
 const Info<bool> MAIN_CUSTOM_RTC_ENABLE{{System::Main, "Core", "EnableCustomRTC"}, false};
 // Measured in seconds since the unix epoch (1.1.1970).  Default is 1.1.2000; there are 7 leap years
 // between those dates.
@@ -271,6 +304,7 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 // Main.DSP
 
 const Info<bool> MAIN_DSP_THREAD{{System::Main, "DSP", "DSPThread"}, false};
+const Info<bool> MAIN_DSP_THREAD_DECOUPLED{{System::Main, "DSP", "DSPThreadDecoupled"}, false};
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
@@ -297,6 +331,7 @@ const Info<std::string> MAIN_DUMP_PATH{{System::Main, "General", "DumpPath"}, ""
 const Info<std::string> MAIN_LOAD_PATH{{System::Main, "General", "LoadPath"}, ""};
 const Info<std::string> MAIN_RESOURCEPACK_PATH{{System::Main, "General", "ResourcePackPath"}, ""};
 const Info<std::string> MAIN_FS_PATH{{System::Main, "General", "NANDRootPath"}, ""};
+const Info<bool> MAIN_NAND_PACK_FILE{{System::Main, "General", "NANDPackFile"}, false};
 const Info<std::string> MAIN_WII_SD_CARD_IMAGE_PATH{{System::Main, "General", "WiiSDCardPath"}, ""};
 const Info<std::string> MAIN_WII_SD_CARD_SYNC_FOLDER_PATH{
     {System::Main, "General", "WiiSDCardSyncFolder"}, ""};
@@ -306,6 +341,8 @@ const Info<bool> MAIN_SHOW_FRAME_COUNT{{System::Main, "General", "ShowFrameCount
 const Info<std::string> MAIN_WIRELESS_MAC{{System::Main, "General", "WirelessMac"}, ""};
 const Info<std::string> MAIN_GDB_SOCKET{{System::Main, "General", "GDBSocket"}, ""};
 const Info<int> MAIN_GDB_PORT{{System::Main, "General", "GDBPort"}, -1};
+const Info<bool> MAIN_MEMORY_WATCHER_SHARED_MEMORY{
+    {System::Main, "General", "MemoryWatcherSharedMemory"}, false};
 const Info<int> MAIN_ISO_PATH_COUNT{{System::Main, "General", "ISOPaths"}, 0};
 const Info<std::string> MAIN_SKYLANDERS_PATH{{System::Main, "General", "SkylandersCollectionPath"},
                                              ""};
@@ -483,10 +520,13 @@ const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT{{System::Main, "Movie", "DumpFram
 const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY{{System::Main, "Movie", "ShowInputDisplay"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RTC{{System::Main, "Movie", "ShowRTC"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RERECORD{{System::Main, "Movie", "ShowRerecord"}, false};
+const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL{{System::Main, "Movie", "CheckpointInterval"}, 600};
+const Info<bool> MAIN_MOVIE_TURBO_PLAYBACK{{System::Main, "Movie", "TurboPlayback"}, false};
 
 // Main.Input
 
 const Info<bool> MAIN_INPUT_BACKGROUND_INPUT{{System::Main, "Input", "BackgroundInput"}, false};
+const Info<bool> MAIN_INPUT_LATENCY_TRACING{{System::Main, "Input", "LatencyTracing"}, false};
 
 // Main.Debug
 
@@ -513,6 +553,9 @@ const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF{{System::Main, "Debug", "JitR
                                                    false};
 const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING{{System::Main, "Debug", "JitEnableProfiling"},
                                                  false};
+const Info<bool> MAIN_DEBUG_MMIO_PROFILING{{System::Main, "Debug", "MMIOProfiling"}, false};
+const Info<int> MAIN_DEBUG_GUEST_PROFILER_SAMPLE_RATE{
+    {System::Main, "Debug", "GuestProfilerSampleRate"}, 0};
 
 // Main.BluetoothPassthrough
 
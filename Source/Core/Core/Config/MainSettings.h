@@ -55,14 +55,24 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_TRACE_FORMATION;
+extern const Info<std::string> MAIN_IDLE_LOOP_ADDRESSES;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
+extern const Info<bool> MAIN_HUGE_PAGES;
+extern const Info<bool> MAIN_JIT_BLOCK_DISK_CACHE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<u32> MAIN_JIT_TIER_UP_THRESHOLD;
+extern const Info<bool> MAIN_JIT_BACKGROUND_ANALYSIS;
+extern const Info<std::string> MAIN_JIT_PROFILE_EXPORT_PATH;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
+extern const Info<bool> MAIN_HYBRID_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_MAX_FALLBACK;
 extern const Info<int> MAIN_TIMING_VARIANCE;
+extern const Info<bool> MAIN_PRECISE_THROTTLE;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
@@ -72,8 +82,17 @@ extern const Info<bool> MAIN_OVERRIDE_REGION_SETTINGS;
 extern const Info<bool> MAIN_DPL2_DECODER;
 extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
+extern const Info<bool> MAIN_AUDIO_LOW_LATENCY;
 extern const Info<bool> MAIN_AUDIO_STRETCH;
 extern const Info<int> MAIN_AUDIO_STRETCH_LATENCY;
+extern const Info<bool> MAIN_AUDIO_STRETCH_FAST;
+// Savestates are compressed with LZ4 if this is false.
+extern const Info<bool> MAIN_STATE_COMPRESSION_ZSTD;
+extern const Info<bool> MAIN_REWIND_ENABLED;
+// In emulated fields.
+extern const Info<int> MAIN_REWIND_INTERVAL;
+// In MiB.
+extern const Info<int> MAIN_REWIND_BUFFER_SIZE;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -111,11 +130,23 @@ extern const Info<bool> MAIN_CONNECT_WIIMOTES_FOR_CONTROLLER_INTERFACE;
 extern const Info<bool> MAIN_MMU;
 extern const Info<bool> MAIN_PAUSE_ON_PANIC;
 extern const Info<int> MAIN_BB_DUMP_PORT;
+// Number of frames recorded by the Capture Frame Trace hotkey.
+extern const Info<u32> MAIN_FRAME_TRACE_LENGTH;
 extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<bool> MAIN_BOUNDED_GPU_LATENCY;
+extern const Info<int> MAIN_BOUNDED_GPU_LATENCY_MAX_CYCLES;
+extern const Info<int> MAIN_BOUNDED_GPU_LATENCY_MAX_BYTES;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+// Memory budget for decompressed WIA/RVZ chunks, in MiB.
+extern const Info<u32> MAIN_WIA_CHUNK_CACHE_SIZE;
+extern const Info<bool> MAIN_WIA_READ_AHEAD;
+extern const Info<bool> MAIN_MEMORY_MAP_DISC_IMAGES;
+extern const Info<bool> MAIN_WII_CLUSTER_CACHE;
+// Maximum size of the decrypted cluster cache of each Wii partition, in MiB.
+extern const Info<u32> MAIN_WII_CLUSTER_CACHE_SIZE;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -145,6 +176,7 @@ extern const Info<std::string> MAIN_GPU_DETERMINISM_MODE;
 GPUDeterminismMode GetGPUDeterminismMode();
 
 extern const Info<std::string> MAIN_PERF_MAP_DIR;
+extern const Info<bool> MAIN_PERF_JIT_DUMP;
 extern const Info<bool> MAIN_CUSTOM_RTC_ENABLE;
 extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
@@ -159,6 +191,7 @@ extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
+extern const Info<bool> MAIN_DSP_THREAD_DECOUPLED;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
 extern const Info<bool> MAIN_DUMP_AUDIO;
@@ -193,6 +226,8 @@ extern const Info<std::string> MAIN_DUMP_PATH;
 extern const Info<std::string> MAIN_LOAD_PATH;
 extern const Info<std::string> MAIN_RESOURCEPACK_PATH;
 extern const Info<std::string> MAIN_FS_PATH;
+// Store the NAND in a single pack file rather than as a directory tree.
+extern const Info<bool> MAIN_NAND_PACK_FILE;
 extern const Info<std::string> MAIN_WII_SD_CARD_IMAGE_PATH;
 extern const Info<std::string> MAIN_WII_SD_CARD_SYNC_FOLDER_PATH;
 extern const Info<std::string> MAIN_WFS_PATH;
@@ -201,6 +236,8 @@ extern const Info<bool> MAIN_SHOW_FRAME_COUNT;
 extern const Info<std::string> MAIN_WIRELESS_MAC;
 extern const Info<std::string> MAIN_GDB_SOCKET;
 extern const Info<int> MAIN_GDB_PORT;
+// Publish MemoryWatcher values to a shared memory file instead of a socket.
+extern const Info<bool> MAIN_MEMORY_WATCHER_SHARED_MEMORY;
 extern const Info<int> MAIN_ISO_PATH_COUNT;
 extern const Info<std::string> MAIN_SKYLANDERS_PATH;
 std::vector<std::string> GetIsoPaths();
@@ -316,10 +353,16 @@ extern const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT;
 extern const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY;
 extern const Info<bool> MAIN_MOVIE_SHOW_RTC;
 extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
+// Number of frames between the state hashes that recordings are checked against on playback, or
+// 0 to not record any.
+extern const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL;
+// Plays movies back as fast as possible without rendering.
+extern const Info<bool> MAIN_MOVIE_TURBO_PLAYBACK;
 
 // Main.Input
 
 extern const Info<bool> MAIN_INPUT_BACKGROUND_INPUT;
+extern const Info<bool> MAIN_INPUT_LATENCY_TRACING;
 
 // Main.Debug
 
@@ -337,6 +380,9 @@ extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING;
+extern const Info<bool> MAIN_DEBUG_MMIO_PROFILING;
+// Samples per emulated second taken by Core::GuestProfiler, 0 to disable it.
+extern const Info<int> MAIN_DEBUG_GUEST_PROFILER_SAMPLE_RATE;
 
 // Main.BluetoothPassthrough
 
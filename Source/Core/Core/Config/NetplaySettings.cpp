@@ -57,5 +57,10 @@ const Info<std::string> NETPLAY_NETWORK_MODE{{System::Main, "NetPlay", "NetworkM
                                              "fixeddelay"};
 const Info<bool> NETPLAY_GOLF_MODE_OVERLAY{{System::Main, "NetPlay", "GolfModeOverlay"}, true};
 const Info<bool> NETPLAY_HIDE_REMOTE_GBAS{{System::Main, "NetPlay", "HideRemoteGBAs"}, false};
+const Info<bool> NETPLAY_ROLLBACK{{System::Main, "NetPlay", "Rollback"}, false};
+const Info<u32> NETPLAY_ROLLBACK_MAX_PREDICTED_POLLS{
+    {System::Main, "NetPlay", "RollbackMaxPredictedPolls"}, 8};
+const Info<u32> NETPLAY_ROLLBACK_CHECKPOINT_INTERVAL{
+    {System::Main, "NetPlay", "RollbackCheckpointInterval"}, 2};
 
 }  // namespace Config
@@ -61,6 +61,7 @@ public:
 
     layer->Set(Config::GFX_HACK_EFB_ACCESS_ENABLE, m_settings.efb_access_enable);
     layer->Set(Config::GFX_HACK_BBOX_ENABLE, m_settings.bbox_enable);
+    layer->Set(Config::GFX_HACK_BBOX_READBACK_LATENCY, m_settings.bbox_readback_latency);
     layer->Set(Config::GFX_HACK_FORCE_PROGRESSIVE, m_settings.force_progressive);
     layer->Set(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM, m_settings.efb_to_texture_enable);
     layer->Set(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM, m_settings.xfb_to_texture_enable);
@@ -70,6 +71,7 @@ public:
     layer->Set(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES,
                m_settings.safe_texture_cache_color_samples);
     layer->Set(Config::GFX_PERF_QUERIES_ENABLE, m_settings.perf_queries_enable);
+    layer->Set(Config::GFX_PERF_QUERIES_STALE_FRAMES, m_settings.perf_queries_stale_frames);
     layer->Set(Config::MAIN_FLOAT_EXCEPTIONS, m_settings.float_exceptions);
     layer->Set(Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS, m_settings.divide_by_zero_exceptions);
     layer->Set(Config::MAIN_FPRF, m_settings.fprf);
@@ -91,6 +93,7 @@ public:
     layer->Set(Config::GFX_HACK_DEFER_EFB_COPIES, m_settings.defer_efb_copies);
     layer->Set(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE, m_settings.efb_access_tile_size);
     layer->Set(Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_settings.efb_access_defer_invalidation);
+    layer->Set(Config::GFX_HACK_EFB_ACCESS_STALE_FRAMES, m_settings.efb_access_stale_frames);
 
     layer->Set(Config::SESSION_USE_FMA, m_settings.use_fma);
 
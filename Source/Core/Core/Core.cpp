@@ -7,8 +7,10 @@
 #include <atomic>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <queue>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -30,9 +32,11 @@
 #include "Common/FatFsUtil.h"
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
+#include "Common/FrameTrace.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/PerfCounters.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
@@ -72,6 +76,7 @@
 #include "Core/PowerPC/GDBStub.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiRoot.h"
@@ -90,6 +95,8 @@
 #include "VideoCommon/AsyncRequests.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FrameDumper.h"
+#include "VideoCommon/DynamicResolution.h"
+#include "VideoCommon/LatencyLimiter.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/Present.h"
@@ -375,12 +382,15 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::PerfCounters::RegisterCurrentThread(system.IsDualCoreMode() ? "CPU" : "CPU-GPU");
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
 
   // Clear performance data collected from previous threads.
   g_perf_metrics.Reset();
+  g_latency_limiter.Reset();
+  g_dynamic_resolution.Reset();
 
   // The JIT need to be able to intercept faults, both for fastmem and for the BLR optimization.
   const bool exception_handler = EMM::IsExceptionHandlerSupported();
@@ -430,6 +440,8 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   // Enter CPU run loop. When we leave it - we are done.
   system.GetCPU().Run();
 
+  system.GetJitInterface().WriteConfiguredProfileExport(CPUThreadGuard{system});
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher.reset();
 #endif
@@ -454,6 +466,7 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
     Common::SetCurrentThreadName("FIFO player thread");
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
+  Common::PerfCounters::RegisterCurrentThread(system.IsDualCoreMode() ? "CPU" : "CPU-GPU");
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = system.GetFifoPlayer().GetCPUCore())
@@ -483,9 +496,32 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
 // Initialize and create emulation thread
 // Call browser: Init():s_emu_thread().
 // See the BootManager.cpp file description for a complete call schedule.
+// Logs how long each step of starting the emulation takes, to keep track of startup regressions.
+class StartupTimer
+{
+public:
+  void EndStep(std::string_view step)
+  {
+    const u64 now = Common::Timer::NowUs();
+    INFO_LOG_FMT(BOOT, "Startup: {} took {:.1f} ms", step, (now - m_step_start) / 1000.0);
+    m_step_start = now;
+  }
+
+  void End()
+  {
+    const u64 now = Common::Timer::NowUs();
+    INFO_LOG_FMT(BOOT, "Startup: Done after {:.1f} ms", (now - m_start) / 1000.0);
+  }
+
+private:
+  u64 m_start = Common::Timer::NowUs();
+  u64 m_step_start = m_start;
+};
+
 static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot,
                       WindowSystemInfo wsi)
 {
+  StartupTimer startup_timer;
   CallOnStateChangedCallbacks(State::Starting);
   Common::ScopeGuard flag_guard{[] {
     s_state.store(State::Uninitialized);
@@ -520,28 +556,21 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   const bool delete_savestate =
       boot_session_data.GetDeleteSavestate() == DeleteSavestateAfterBoot::Yes;
 
-  bool sync_sd_folder = system.IsWii() && Config::Get(Config::MAIN_WII_SD_CARD) &&
-                        Config::Get(Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC);
-  if (sync_sd_folder)
+  // Nothing reads the SD card image before HW::Init, so it can be synced while the rest of the
+  // setup runs.
+  std::future<bool> sd_folder_sync;
+  if (system.IsWii() && Config::Get(Config::MAIN_WII_SD_CARD) &&
+      Config::Get(Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC))
   {
-    sync_sd_folder =
-        Common::SyncSDFolderToSDImage([]() { return false; }, Core::WantsDeterminism());
+    sd_folder_sync = std::async(std::launch::async, [deterministic = Core::WantsDeterminism()] {
+      const u64 start = Common::Timer::NowUs();
+      const bool result = Common::SyncSDFolderToSDImage([]() { return false; }, deterministic);
+      INFO_LOG_FMT(BOOT, "Startup: SD card sync took {:.1f} ms",
+                   (Common::Timer::NowUs() - start) / 1000.0);
+      return result;
+    });
   }
 
-  Common::ScopeGuard sd_folder_sync_guard{[sync_sd_folder] {
-    if (sync_sd_folder && Config::Get(Config::MAIN_ALLOW_SD_WRITES))
-    {
-      const bool sync_ok = Common::SyncSDImageToSDFolder([]() { return false; });
-      if (!sync_ok)
-      {
-        PanicAlertFmtT(
-            "Failed to sync SD card with folder. All changes made this session will be "
-            "discarded on next boot if you do not manually re-issue a resync in Config > "
-            "Wii > SD Card Settings > Convert File to Folder Now!");
-      }
-    }
-  }};
-
   // Load Wiimotes - only if we are booting in Wii mode
   if (system.IsWii() && !Config::Get(Config::MAIN_BLUETOOTH_PASSTHROUGH_ENABLED))
   {
@@ -549,6 +578,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   FreeLook::LoadInputConfig();
+  startup_timer.EndStep("Input configuration");
 
   system.GetCustomAssetLoader().Init();
   Common::ScopeGuard asset_loader_guard([&system] { system.GetCustomAssetLoader().Shutdown(); });
@@ -558,9 +588,28 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   AudioCommon::InitSoundStream(system);
   Common::ScopeGuard audio_guard([&system] { AudioCommon::ShutdownSoundStream(system); });
+  startup_timer.EndStep("Audio");
+
+  const bool sync_sd_folder = sd_folder_sync.valid() && sd_folder_sync.get();
+  startup_timer.EndStep("Waiting for the SD card sync");
+
+  Common::ScopeGuard sd_folder_sync_guard{[sync_sd_folder] {
+    if (sync_sd_folder && Config::Get(Config::MAIN_ALLOW_SD_WRITES))
+    {
+      const bool sync_ok = Common::SyncSDImageToSDFolder([]() { return false; });
+      if (!sync_ok)
+      {
+        PanicAlertFmtT(
+            "Failed to sync SD card with folder. All changes made this session will be "
+            "discarded on next boot if you do not manually re-issue a resync in Config > "
+            "Wii > SD Card Settings > Convert File to Folder Now!");
+      }
+    }
+  }};
 
   HW::Init(system,
            NetPlay::IsNetPlayRunning() ? &(boot_session_data.GetNetplaySettings()->sram) : nullptr);
+  startup_timer.EndStep("HW");
 
   Common::ScopeGuard hw_guard{[&system] {
     INFO_LOG_FMT(CONSOLE, "{}", StopMessage(false, "Shutting down HW"));
@@ -589,6 +638,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
     g_video_backend->Shutdown();
   }};
+  startup_timer.EndStep("Video backend");
 
   if (cpu_info.HTT)
     Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
@@ -603,6 +653,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   AudioCommon::PostInitSoundStream(system);
+  startup_timer.EndStep("DSP");
 
   // Set execution state to known values (CPU/FIFO/Audio Paused)
   system.GetCPU().Break();
@@ -628,6 +679,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     if (!CBoot::BootUp(system, guard, std::move(boot)))
       return;
   }
+  startup_timer.EndStep("Boot");
 
   // Initialise Wii filesystem contents.
   // This is done here after Boot and not in BootManager to ensure that we operate
@@ -640,6 +692,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     Core::InitializeWiiFileSystemContents(savegame_redirect, boot_session_data);
   else
     wiifs_guard.Dismiss();
+  startup_timer.EndStep("Wii file system");
 
   // This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
   system.GetFifo().Prepare();
@@ -655,6 +708,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   UpdateTitle(system);
+  startup_timer.End();
 
   // ENTER THE VIDEO THREAD LOOP
   if (system.IsDualCoreMode())
@@ -662,6 +716,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    Common::PerfCounters::RegisterCurrentThread("GPU");
     UndeclareAsCPUThread();
     Common::FPU::LoadDefaultSIMDState();
 
@@ -792,6 +847,20 @@ void SaveScreenShot(std::string_view name)
   g_frame_dumper->SaveScreenshot(fmt::format("{}{}.png", GenerateScreenshotFolderPath(), name));
 }
 
+void CaptureFrameTrace()
+{
+  const std::time_t cur_time = std::time(nullptr);
+  std::string path = fmt::format("{}Traces/{}_{:%Y-%m-%d_%H-%M-%S}.json",
+                                 File::GetUserPath(D_DUMP_IDX), SConfig::GetInstance().GetGameID(),
+                                 fmt::localtime(cur_time));
+  const u32 frame_count = std::max(Config::Get(Config::MAIN_FRAME_TRACE_LENGTH), 1u);
+
+  if (Common::FrameTrace::StartCapture(std::move(path), frame_count))
+    DisplayMessage(fmt::format("Capturing a trace of {} frames", frame_count), 2000);
+  else
+    DisplayMessage("A frame trace is already being captured", 2000);
+}
+
 static bool PauseAndLock(Core::System& system, bool do_lock, bool unpause_on_unlock)
 {
   // WARNING: PauseAndLock is not fully threadsafe so is only valid on the Host Thread
@@ -903,6 +972,7 @@ void Callback_NewField(Core::System& system)
   }
 
   AchievementManager::GetInstance().DoFrame();
+  Rewind::OnNewField();
 }
 
 void UpdateTitle(Core::System& system)
@@ -155,6 +155,9 @@ State GetState(Core::System& system);
 void SaveScreenShot();
 void SaveScreenShot(std::string_view name);
 
+// Records a trace of the next MAIN_FRAME_TRACE_LENGTH frames to the Dump/Traces directory.
+void CaptureFrameTrace();
+
 // This displays messages in a user-visible way.
 void DisplayMessage(std::string message, int time_in_ms);
 
@@ -13,8 +13,10 @@
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
+#include "Common/FrameTrace.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
+#include "Common/Thread.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -25,6 +27,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/LatencyLimiter.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -33,6 +36,7 @@
 namespace CoreTiming
 {
 static constexpr int MAX_SLICE_LENGTH = 20000;
+static constexpr size_t INITIAL_EVENT_QUEUE_CAPACITY = 256;
 
 static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
@@ -92,6 +96,7 @@ void CoreTimingManager::Init()
   m_globals.slice_length = MAX_SLICE_LENGTH;
   m_globals.global_timer = 0;
   m_idled_cycles = 0;
+  m_idle_count = 0;
 
   // The time between CoreTiming being intialized and the first call to Advance() is considered
   // the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -102,13 +107,20 @@ void CoreTimingManager::Init()
   // Reset data used by the throttling system
   ResetThrottle(0);
 
+  m_event_queue.reserve(INITIAL_EVENT_QUEUE_CAPACITY);
   m_event_fifo_id = 0;
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
 }
 
 void CoreTimingManager::Shutdown()
 {
-  std::lock_guard lk(m_ts_write_lock);
+  if (m_idle_count != 0)
+  {
+    INFO_LOG_FMT(POWERPC, "Idle skipping: {} times, {} cycles in total", m_idle_count,
+                 m_idled_cycles);
+  }
+  g_perf_metrics.LogFramePacing();
+
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -121,6 +133,7 @@ void CoreTimingManager::RefreshConfig()
       Config::Get(Config::MAIN_OVERCLOCK_ENABLE) ? Config::Get(Config::MAIN_OVERCLOCK) : 1.0f;
   m_config_oc_inv_factor = 1.0f / m_config_oc_factor;
   m_config_sync_on_skip_idle = Config::Get(Config::MAIN_SYNC_ON_SKIP_IDLE);
+  m_config_precise_throttle = Config::Get(Config::MAIN_PRECISE_THROTTLE);
 
   // A maximum fallback is used to prevent the system from sleeping for
   // too long or going full speed in an attempt to catch up to timings.
@@ -142,7 +155,6 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -265,8 +277,13 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
-    m_ts_queue.Push(Event{m_globals.global_timer + cycles_into_future, 0, userdata, event_type});
+    const Event event{m_globals.global_timer + cycles_into_future, 0, userdata, event_type};
+    if (!m_ts_queue.TryPush(event))
+    {
+      std::lock_guard lk(m_ts_overflow_lock);
+      m_ts_overflow.push_back(event);
+      m_ts_has_overflow.store(true, std::memory_order_release);
+    }
   }
 }
 
@@ -309,10 +326,25 @@ void CoreTimingManager::MoveEvents()
     m_event_queue.emplace_back(std::move(ev));
     std::ranges::push_heap(m_event_queue, std::ranges::greater{});
   }
+
+  if (!m_ts_has_overflow.load(std::memory_order_acquire))
+    return;
+
+  std::lock_guard lk(m_ts_overflow_lock);
+  for (Event& ev : m_ts_overflow)
+  {
+    ev.fifo_order = m_event_fifo_id++;
+    m_event_queue.emplace_back(std::move(ev));
+    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+  }
+  m_ts_overflow.clear();
+  m_ts_has_overflow.store(false, std::memory_order_relaxed);
 }
 
 void CoreTimingManager::Advance()
 {
+  TRACE_SCOPE("CoreTiming::Advance");
+
   CPUThreadConfigCallback::CheckForConfigChanges();
 
   MoveEvents();
@@ -358,13 +390,32 @@ void CoreTimingManager::Advance()
 
 void CoreTimingManager::Throttle(const s64 target_cycle)
 {
-  // Based on number of cycles and emulation speed, increase the target deadline
-  const s64 cycles = target_cycle - m_throttle_last_cycle;
-
   // Prevent any throttling code if the amount of time passed is < ~0.122ms
-  if (cycles < m_throttle_min_clock_per_sleep)
+  if (target_cycle - m_throttle_last_cycle < m_throttle_min_clock_per_sleep)
     return;
 
+  ThrottleToCycle(target_cycle);
+}
+
+void CoreTimingManager::ThrottleFieldOutput(s64 field_cycle)
+{
+  if (field_cycle < m_throttle_last_cycle)
+    return;
+
+  // Changes to the latency limiter's delay shift all following deadlines, which moves the emulated
+  // frames relative to the refreshes of the display.
+  const DT latency_delay = g_latency_limiter.GetDelay();
+  m_throttle_deadline += latency_delay - m_latency_delay;
+  m_latency_delay = latency_delay;
+
+  if (ThrottleToCycle(field_cycle))
+    g_perf_metrics.CountFieldDeadline(Clock::now() - m_throttle_deadline);
+}
+
+bool CoreTimingManager::ThrottleToCycle(s64 target_cycle)
+{
+  // Based on number of cycles and emulation speed, increase the target deadline
+  const s64 cycles = target_cycle - m_throttle_last_cycle;
   m_throttle_last_cycle = target_cycle;
 
   const double speed = Core::GetIsThrottlerTempDisabled() ? 0.0 : m_emulation_speed;
@@ -397,12 +448,38 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // Only sleep if we are behind the deadline
   if (time < m_throttle_deadline)
   {
-    std::this_thread::sleep_until(m_throttle_deadline);
+    TRACE_SCOPE("CoreTiming::ThrottleSleep");
+    if (m_config_precise_throttle)
+      PreciseSleepUntil(m_throttle_deadline);
+    else
+      std::this_thread::sleep_until(m_throttle_deadline);
 
     // Count amount of time sleeping for analytics
     const TimePoint time_after_sleep = Clock::now();
     g_perf_metrics.CountThrottleSleep(time_after_sleep - time);
   }
+
+  return 0.0 < speed;
+}
+
+void CoreTimingManager::PreciseSleepUntil(TimePoint deadline)
+{
+  static constexpr DT MIN_SPIN_MARGIN = std::chrono::microseconds(50);
+  static constexpr DT MAX_SPIN_MARGIN = std::chrono::milliseconds(2);
+
+  // Sleep until shortly before the deadline, then spin for the rest. Sleeps on handhelds and other
+  // systems with coarse timers routinely wake up a good fraction of a millisecond late.
+  const TimePoint sleep_deadline = deadline - m_throttle_spin_margin;
+  if (Clock::now() < sleep_deadline)
+  {
+    Common::SleepUntil(sleep_deadline);
+
+    m_throttle_oversleep += (Clock::now() - sleep_deadline - m_throttle_oversleep) / 8;
+    m_throttle_spin_margin = std::clamp(m_throttle_oversleep * 2, MIN_SPIN_MARGIN, MAX_SPIN_MARGIN);
+  }
+
+  while (Clock::now() < deadline)
+    Common::YieldCPU();
 }
 
 void CoreTimingManager::ResetThrottle(s64 cycle)
@@ -464,6 +541,7 @@ void CoreTimingManager::Idle()
   auto& ppc_state = m_system.GetPPCState();
   PowerPC::UpdatePerformanceMonitor(ppc_state.downcount, 0, 0, ppc_state);
   m_idled_cycles += DowncountToCycles(ppc_state.downcount);
+  ++m_idle_count;
   ppc_state.downcount = 0;
 }
 
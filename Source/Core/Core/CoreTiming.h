@@ -16,6 +16,7 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <atomic>
 #include <compare>
 #include <mutex>
 #include <string>
@@ -24,7 +25,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Core/CPUThreadConfigCallback.h"
 
 class PointerWrap;
@@ -160,6 +161,10 @@ public:
   // in order to allow custom throttling implementations to be tested.
   void Throttle(const s64 target_cycle);
 
+  // Throttles to the cycle at which a VI field is output, even if that is closer to the last
+  // throttle than the usual minimum, so that frames are handed to the GPU at an even pace.
+  void ThrottleFieldOutput(s64 field_cycle);
+
   TimePoint GetCPUTimePoint(s64 cyclesLate) const;  // Used by Dolphin Analytics
   bool GetVISkip() const;                           // Used By VideoInterface
 
@@ -179,14 +184,24 @@ private:
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accomodated
   // by the standard adaptor class.
+  // Storage for INITIAL_EVENT_QUEUE_CAPACITY events is reserved up front, so scheduling doesn't
+  // allocate unless an unusually large number of events is pending.
   std::vector<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
-  Common::SPSCQueue<Event, false> m_ts_queue;
+
+  // Events scheduled from other threads wait here until the CPU thread moves them into
+  // m_event_queue. Producers don't take a lock or allocate unless the inbox is full, in which case
+  // they fall back to the locked overflow vector.
+  Common::MPSCQueue<Event, 256> m_ts_queue;
+  std::mutex m_ts_overflow_lock;
+  std::vector<Event> m_ts_overflow;
+  std::atomic<bool> m_ts_has_overflow = false;
 
   float m_last_oc_factor = 0.0f;
 
   s64 m_idled_cycles = 0;
+  // Number of times Idle() was called since Init(). Not part of savestates.
+  u64 m_idle_count = 0;
   u32 m_fake_dec_start_value = 0;
   u64 m_fake_dec_start_ticks = 0;
 
@@ -199,6 +214,7 @@ private:
   float m_config_oc_factor = 0.0f;
   float m_config_oc_inv_factor = 0.0f;
   bool m_config_sync_on_skip_idle = false;
+  bool m_config_precise_throttle = false;
 
   s64 m_throttle_last_cycle = 0;
   TimePoint m_throttle_deadline = Clock::now();
@@ -206,11 +222,22 @@ private:
   s64 m_throttle_min_clock_per_sleep = 0;
   bool m_throttle_disable_vi_int = false;
 
+  // How long before a deadline PreciseSleepUntil stops sleeping and starts spinning. Adapts to how
+  // late the OS has recently been waking the CPU thread up.
+  DT m_throttle_spin_margin = std::chrono::milliseconds(1);
+  DT m_throttle_oversleep = std::chrono::milliseconds(1);
+
+  // The part of the latency limiter's delay that has been applied to m_throttle_deadline.
+  DT m_latency_delay{};
+
   DT m_max_fallback = {};
   DT m_max_variance = {};
   double m_emulation_speed = 1.0;
 
   void ResetThrottle(s64 cycle);
+  // Returns false if the throttle is disabled.
+  bool ThrottleToCycle(s64 target_cycle);
+  void PreciseSleepUntil(TimePoint deadline);
 
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
@@ -160,6 +160,120 @@ u16 Accelerator::Read(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(const s16* coefs, s16* samples, size_t count)
+{
+  while (count > 0)
+  {
+    if (m_reads_stopped)
+    {
+      std::fill_n(samples, count, 0);
+      return;
+    }
+
+    const size_t samples_read = ReadSamplesFast(coefs, samples, count);
+    samples += samples_read;
+    count -= samples_read;
+
+    // Loop ends and anything else the fast path doesn't handle.
+    if (count > 0)
+    {
+      *samples++ = static_cast<s16>(Read(coefs));
+      --count;
+    }
+  }
+}
+
+// Decodes samples directly from memory for as long as none of the special cases around the end
+// address can come up. Returns the number of samples that were read.
+size_t Accelerator::ReadSamplesFast(const s16* coefs, s16* samples, size_t count)
+{
+  if (m_current_address >= m_end_address)
+    return 0;
+
+  switch (m_sample_format)
+  {
+  case 0x00:  // ADPCM audio
+  {
+    // Staying below end_address - 1 avoids both the loop check and the special cases for end
+    // addresses ending in 0 and 1.
+    if (m_end_address - m_current_address < 8)
+      return 0;
+    const u32 last_address = m_end_address - 3;
+    const u32 first_byte = m_current_address >> 1;
+    const u8* memory = GetMemoryPointer(first_byte, (last_address >> 1) - first_byte + 1);
+    if (!memory)
+      return 0;
+
+    u32 address = m_current_address;
+    s16 yn1 = m_yn1;
+    s16 yn2 = m_yn2;
+    u16 pred_scale = m_pred_scale;
+    size_t i = 0;
+    while (i < count)
+    {
+      const u32 next_address = address + 1;
+      const bool new_frame = (next_address & 15) == 0;
+      if ((new_frame ? next_address + 2 : next_address) > last_address)
+        break;
+
+      const int scale = 1 << (pred_scale & 0xF);
+      const int coef_idx = (pred_scale >> 4) & 0x7;
+      const s32 coef1 = coefs[coef_idx * 2 + 0];
+      const s32 coef2 = coefs[coef_idx * 2 + 1];
+
+      const u8 byte = memory[(address >> 1) - first_byte];
+      int temp = (address & 1) ? (byte & 0xF) : (byte >> 4);
+      if (temp >= 8)
+        temp -= 16;
+
+      const s32 val32 = (scale * temp) + ((0x400 + coef1 * yn1 + coef2 * yn2) >> 11);
+      const s16 val = static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+      yn2 = yn1;
+      yn1 = val;
+      samples[i++] = val;
+
+      address = next_address;
+      if (new_frame)
+      {
+        pred_scale = memory[(address >> 1) - first_byte];
+        address += 2;
+      }
+    }
+
+    m_current_address = address;
+    m_yn1 = yn1;
+    m_yn2 = yn2;
+    m_pred_scale = pred_scale;
+    return i;
+  }
+  case 0x0A:  // 16-bit PCM audio
+  case 0x19:  // 8-bit PCM audio
+  {
+    // The loop check is hit when the address reaches end_address + 1.
+    const bool pcm16 = m_sample_format == 0x0A;
+    const size_t n = std::min<size_t>(count, m_end_address - m_current_address);
+    const u32 bytes_per_sample = pcm16 ? 2 : 1;
+    const u8* memory = GetMemoryPointer(m_current_address * bytes_per_sample,
+                                        static_cast<u32>(n) * bytes_per_sample);
+    if (!memory)
+      return 0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      const u16 val = pcm16 ? (memory[i * 2] << 8) | memory[i * 2 + 1] : memory[i] << 8;
+      m_yn2 = m_yn1;
+      m_yn1 = val;
+      samples[i] = static_cast<s16>(val);
+    }
+
+    m_current_address += static_cast<u32>(n);
+    return n;
+  }
+  default:
+    return 0;
+  }
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -15,6 +17,8 @@ public:
   virtual ~Accelerator() = default;
 
   u16 Read(const s16* coefs);
+  // Same as calling Read count times, but decodes runs of samples in one go where possible.
+  void ReadSamples(const s16* coefs, s16* samples, size_t count);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadD3();
   void WriteD3(u16 value);
@@ -40,6 +44,11 @@ protected:
   virtual void OnEndException() = 0;
   virtual u8 ReadMemory(u32 address) = 0;
   virtual void WriteMemory(u32 address, u8 value) = 0;
+  // Returns a pointer that the given range can be read from directly, or nullptr if it needs to
+  // be read through ReadMemory.
+  virtual const u8* GetMemoryPointer(u32 address, u32 size) { return nullptr; }
+
+  size_t ReadSamplesFast(const s16* coefs, s16* samples, size_t count);
 
   // DSP accelerator registers.
   u32 m_start_address = 0;
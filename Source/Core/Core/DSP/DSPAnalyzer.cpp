@@ -18,7 +18,7 @@ namespace DSP
 // as well give up its time slice immediately, after executing once.
 
 // Max signature length is 6. A 0 in a signature is ignored.
-constexpr size_t NUM_IDLE_SIGS = 8;
+constexpr size_t NUM_IDLE_SIGS = 11;
 constexpr size_t MAX_IDLE_SIG_SIZE = 6;
 
 // 0xFFFF means ignore.
@@ -53,6 +53,20 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0x02c0, 0x8000,  // ANDCF $AC0.M, #0x8000
      0x029c, 0xFFFF,  // JLNZ 0x05cf
      0},
+    // The same mail wait loop written with the long form of LR, for the other accumulator and
+    // mailbox combinations.
+    {0x00df, 0xFFFE,  // LR    $AC1.M, @CMBH
+     0x03c0, 0x8000,  // ANDCF $AC1.M, #0x8000
+     0x029c, 0xFFFF,  // JLNZ 0x????
+     0},
+    {0x00de, 0xFFFC,  // LR    $AC0.M, @DMBH
+     0x02c0, 0x8000,  // ANDCF $AC0.M, #0x8000
+     0x029d, 0xFFFF,  // JLZ 0x????
+     0},
+    {0x00df, 0xFFFC,  // LR    $AC1.M, @DMBH
+     0x03c0, 0x8000,  // ANDCF $AC1.M, #0x8000
+     0x029d, 0xFFFF,  // JLZ 0x????
+     0},
     // From Zelda - experimental
     {0x00da, 0x0352,  // LR     $AX0.H, @0x0352
      0x8600,          // TSTAXH $AX0.H
@@ -406,8 +406,9 @@ struct SDSP
   // Advances the step counter used for debugging purposes.
   void AdvanceStepCounter() { ++m_step_counter; }
 
-  // Sets the calculated IRAM CRC for debugging purposes.
+  // Sets the calculated IRAM CRC. It is used for debugging and to find the JIT's cached blocks.
   void SetIRAMCRC(u32 crc) { m_iram_crc = crc; }
+  u32 GetIRAMCRC() const { return m_iram_crc; }
 
   // Saves and loads any necessary state.
   void DoState(PointerWrap& p);
@@ -0,0 +1,288 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Common/Assert.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::Arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t MAX_BLOCK_SIZE = 250;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+// Every call emitted for an instruction takes well under this many bytes, so a block of
+// MAX_BLOCK_SIZE instructions always fits if this much space is left.
+constexpr size_t MAX_BLOCK_CODE_SIZE = MAX_BLOCK_SIZE * 128;
+
+// Holds a pointer to the SDSP for the whole block. It is callee-saved, so the interpreter
+// handlers we call leave it alone.
+constexpr ARM64Reg STATE_REG = ARM64Reg::X19;
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+constexpr s32 PC_OFFSET = static_cast<s32>(offsetof(SDSP, pc));
+constexpr s32 EXCEPTIONS_OFFSET = static_cast<s32>(offsetof(SDSP, exceptions));
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+DSPEmitter::DSPEmitter(DSPCore& dsp) : m_blocks(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  auto& state = m_dsp_core.DSPState();
+
+  if (state.external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  while (true)
+  {
+    if (Host::OnThread() && state.external_interrupt_waiting.load(std::memory_order_relaxed))
+      break;
+
+    // DSP gave up the remaining cycles.
+    if ((state.control_reg & CR_HALT) != 0)
+      break;
+
+    if (!m_blocks[state.pc])
+    {
+      if (GetSpaceLeft() < MAX_BLOCK_CODE_SIZE)
+        ClearIRAMandDSPJITCodespaceReset();
+      Compile(state.pc);
+    }
+
+    // Same arithmetic as the x64 dispatcher: keep going while there are cycles left, and report
+    // any overshoot as a wrapped-around count, which the caller treats as no cycles left.
+    const u16 executed = static_cast<u16>(m_blocks[state.pc]());
+    const u16 cycles_before = m_cycles_left;
+    m_cycles_left -= executed;
+    if (cycles_before <= executed)
+      break;
+  }
+
+  if (state.reset_dspjit_codespace)
+    ClearIRAMandDSPJITCodespaceReset();
+
+  return m_cycles_left;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  std::fill(m_blocks.begin(), m_blocks.begin() + DSP_IRAM_SIZE, nullptr);
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+  ClearCodeSpace();
+
+  std::ranges::fill(m_blocks, nullptr);
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+static void CheckExceptionsThunk(DSPCore& dsp)
+{
+  dsp.CheckExceptions();
+}
+
+static void FallbackThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+}
+
+// Extended instructions go through a single call, as their three parts always run together.
+static void FallbackExtendedThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetExtOp(inst))(inst);
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+  interpreter.ApplyWriteBackLog();
+}
+
+// The looping hardware, as in Interpreter::HandleLoop. Returns nonzero if a loop was active, in
+// which case the block has to be left as the PC may have changed. (This returns a full register
+// rather than a bool, whose upper bits are unspecified in the AArch64 calling convention.)
+static u32 HandleLoopThunk(SDSP& state, u16 next_pc, u32 update_pc)
+{
+  if (state.r.st[2] == 0 || state.r.st[3] == 0)
+    return 0;
+
+  // Branch instructions have already updated the PC.
+  if (update_pc != 0)
+    state.pc = next_pc;
+
+  if (state.pc - 1 == state.r.st[2])
+  {
+    state.r.st[3]--;
+    if (state.r.st[3] > 0)
+    {
+      state.pc = state.r.st[0];
+    }
+    else
+    {
+      // end of loop
+      state.PopStack(StackRegister::Call);
+      state.PopStack(StackRegister::LoopAddress);
+      state.PopStack(StackRegister::LoopCounter);
+    }
+  }
+
+  return 1;
+}
+
+void DSPEmitter::StorePC(u16 value)
+{
+  MOVI2R(ARM64Reg::W0, value);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, PC_OFFSET);
+}
+
+void DSPEmitter::WriteBlockExit(u16 start_addr, u16 block_size)
+{
+  const auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+
+  if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
+    MOVI2R(ARM64Reg::W0, DSP_IDLE_SKIP_CYCLES);
+  else
+    MOVI2R(ARM64Reg::W0, block_size);
+
+  LDP(IndexType::Post, STATE_REG, ARM64Reg::X30, ARM64Reg::SP, 16);
+  RET();
+}
+
+void DSPEmitter::EmitInstruction(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+
+  // Fallbacks to interpreter need this for fetching immediate values
+  if (op_template->reads_pc)
+    StorePC(m_compile_pc + 1);
+
+  auto& interpreter = m_dsp_core.GetInterpreter();
+  ASSERT_MSG(DSPLLE, Interpreter::GetOp(inst) != nullptr, "No function for {:04x}", inst);
+  if (op_template->extended)
+    ABI_CallFunction(FallbackExtendedThunk, &interpreter, inst);
+  else
+    ABI_CallFunction(FallbackThunk, &interpreter, inst);
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+  auto& state = m_dsp_core.DSPState();
+  const auto& analyzer = state.GetAnalyzer();
+
+  const u8* entry_point = AlignCode16();
+  STP(IndexType::Pre, STATE_REG, ARM64Reg::X30, ARM64Reg::SP, -16);
+  MOVP2R(STATE_REG, &state);
+
+  m_compile_pc = start_addr;
+  bool fixup_pc = false;
+  u16 block_size = 0;
+
+  while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
+  {
+    // Must go out of block if an exception is detected
+    if (analyzer.IsCheckExceptions(m_compile_pc))
+    {
+      LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, EXCEPTIONS_OFFSET);
+      FixupBranch skip_check = CBZ(ARM64Reg::W0);
+      StorePC(m_compile_pc);
+      ABI_CallFunction(CheckExceptionsThunk, &m_dsp_core);
+      WriteBlockExit(start_addr, block_size);
+      SetJumpTarget(skip_check);
+    }
+
+    const UDSPInstruction inst = state.ReadIMEM(m_compile_pc);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    EmitInstruction(inst);
+
+    block_size++;
+    m_compile_pc += opcode->size;
+
+    fixup_pc = true;
+
+    // Handle loop condition, only if current instruction was flagged as a loop destination
+    // by the analyzer.
+    if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
+    {
+      ABI_CallFunction(HandleLoopThunk, &state, m_compile_pc, u32{!opcode->branch});
+      FixupBranch no_loop = CBZ(ARM64Reg::W0);
+      WriteBlockExit(start_addr, block_size);
+      SetJumpTarget(no_loop);
+    }
+
+    if (opcode->branch)
+    {
+      // don't update g_dsp.pc -- the branch insn already did
+      fixup_pc = false;
+      if (opcode->uncond_branch)
+        break;
+
+      // look at g_dsp.pc if we actually branched
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, PC_OFFSET);
+      CMPI2R(ARM64Reg::W0, m_compile_pc, ARM64Reg::W1);
+      FixupBranch no_branch = B(CC_EQ);
+      WriteBlockExit(start_addr, block_size);
+      SetJumpTarget(no_branch);
+    }
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(m_compile_pc))
+      break;
+  }
+
+  if (fixup_pc)
+    StorePC(m_compile_pc);
+
+  if (block_size == 0)
+  {
+    // just a safeguard, should never happen anymore.
+    // if it does we might get stuck over in RunCycles.
+    ERROR_LOG_FMT(DSPLLE, "Block at {:#06x} has zero size", start_addr);
+    block_size = 1;
+  }
+
+  WriteBlockExit(start_addr, block_size);
+  FlushIcache();
+
+  m_blocks[start_addr] = reinterpret_cast<DSPCompiledCode>(entry_point);
+}
+}  // namespace DSP::JIT::Arm64
@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP::JIT::Arm64
+{
+// A block recompiler for AArch64 hosts.
+//
+// Blocks are found with the same analyzer data and end conditions as the x64 recompiler, but each
+// instruction is compiled to a call into the interpreter's handler for it. This removes the
+// per-instruction decoding, dispatch and loop checks of the interpreter while keeping its exact
+// behaviour, and gives the native code generation for individual instructions a place to land.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  explicit DSPEmitter(DSPCore& dsp);
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void DoState(PointerWrap& p) override;
+  void ClearIRAM() override;
+
+private:
+  using DSPCompiledCode = u32 (*)();
+
+  void ClearIRAMandDSPJITCodespaceReset();
+
+  void Compile(u16 start_addr);
+  void EmitInstruction(UDSPInstruction inst);
+  void WriteBlockExit(u16 start_addr, u16 block_size);
+  void StorePC(u16 value);
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  u16 m_compile_pc = 0;
+
+  // A null entry means that the block hasn't been compiled yet.
+  std::vector<DSPCompiledCode> m_blocks;
+
+  u16 m_cycles_left = 0;
+
+  DSPCore& m_dsp_core;
+};
+}  // namespace DSP::JIT::Arm64
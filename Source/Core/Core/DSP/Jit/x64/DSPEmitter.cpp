@@ -25,7 +25,10 @@ using namespace Gen;
 
 namespace DSP::JIT::x64
 {
-constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t COMPILED_CODE_SIZE = 8388608;
+// Blocks of earlier ucodes are kept around, so the code space can fill up. Once less than this is
+// left, which is more than compiling all of IRAM and IROM takes, everything is thrown away.
+constexpr size_t MIN_CODE_SPACE_LEFT = 2097152;
 constexpr size_t MAX_BLOCK_SIZE = 250;
 constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
 
@@ -71,16 +74,77 @@ void DSPEmitter::DoState(PointerWrap& p)
   p.Do(m_cycles_left);
 }
 
+void DSPEmitter::ClearBlock(size_t address)
+{
+  m_blocks[address] = (DSPCompiledCode)m_stub_entry_point;
+  m_block_links[address] = nullptr;
+  m_block_size[address] = 0;
+  m_unresolved_jumps[address].clear();
+}
+
 void DSPEmitter::ClearIRAM()
 {
+  const auto& state = m_dsp_core.DSPState();
+
+  SaveUCodeBlocks();
+  m_ucode_crc = state.GetIRAMCRC();
+  m_ucode_iram.assign(state.iram, state.iram + DSP_IRAM_SIZE);
+
+  // IROM blocks can be linked directly to IRAM blocks of the old ucode, so they always have to be
+  // compiled again. Cached IRAM blocks only ever link to IROM blocks compiled for the same ucode,
+  // whose code is still around.
+  for (size_t i = DSP_IRAM_SIZE; i < MAX_BLOCKS; i++)
+    ClearBlock(i);
+
+  if (LoadUCodeBlocks())
+    return;
+
   for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
-  {
-    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-    m_block_links[i] = nullptr;
-    m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
-  }
-  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+    ClearBlock(i);
+}
+
+auto DSPEmitter::FindCachedUCode() -> std::multimap<u32, CachedUCode>::iterator
+{
+  // The CRC only covers the part of IRAM that was uploaded, so the contents have to be compared.
+  const auto [begin, end] = m_ucode_cache.equal_range(m_ucode_crc);
+  const auto it = std::find_if(
+      begin, end, [this](const auto& entry) { return entry.second.iram == m_ucode_iram; });
+  return it != end ? it : m_ucode_cache.end();
+}
+
+void DSPEmitter::SaveUCodeBlocks()
+{
+  if (m_ucode_iram.empty())
+    return;
+
+  auto it = FindCachedUCode();
+  if (it == m_ucode_cache.end())
+    it = m_ucode_cache.emplace(m_ucode_crc, CachedUCode{});
+
+  CachedUCode& cached = it->second;
+  cached.iram = std::move(m_ucode_iram);
+  cached.blocks.assign(m_blocks.begin(), m_blocks.begin() + DSP_IRAM_SIZE);
+  cached.block_size.assign(m_block_size.begin(), m_block_size.begin() + DSP_IRAM_SIZE);
+  cached.block_links.assign(m_block_links.begin(), m_block_links.begin() + DSP_IRAM_SIZE);
+  cached.unresolved_jumps.assign(m_unresolved_jumps.begin(),
+                                 m_unresolved_jumps.begin() + DSP_IRAM_SIZE);
+  m_ucode_iram.clear();
+}
+
+bool DSPEmitter::LoadUCodeBlocks()
+{
+  const auto it = FindCachedUCode();
+  if (it == m_ucode_cache.end())
+    return false;
+
+  INFO_LOG_FMT(DSPLLE, "Reusing compiled blocks for ucode {:08x}", m_ucode_crc);
+
+  const CachedUCode& cached = it->second;
+  std::ranges::copy(cached.blocks, m_blocks.begin());
+  std::ranges::copy(cached.block_size, m_block_size.begin());
+  std::ranges::copy(cached.block_links, m_block_links.begin());
+  std::ranges::copy(cached.unresolved_jumps, m_unresolved_jumps.begin());
+  return true;
 }
 
 void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
@@ -90,12 +154,8 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
   m_stub_entry_point = CompileStub();
 
   for (size_t i = 0; i < MAX_BLOCKS; i++)
-  {
-    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-    m_block_links[i] = nullptr;
-    m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
-  }
+    ClearBlock(i);
+  m_ucode_cache.clear();
   m_dsp_core.DSPState().reset_dspjit_codespace = false;
 }
 
@@ -394,6 +454,10 @@ void DSPEmitter::Compile(u16 start_addr)
 
 void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
 {
+  // The code can't be thrown away while it's running, so this waits for the dispatcher to exit.
+  if (emitter.GetSpaceLeft() < MIN_CODE_SPACE_LEFT)
+    emitter.m_dsp_core.DSPState().reset_dspjit_codespace = true;
+
   emitter.Compile(emitter.m_dsp_core.DSPState().pc);
 
   bool retry = true;
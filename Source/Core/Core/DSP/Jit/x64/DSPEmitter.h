@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <list>
+#include <map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -193,6 +194,17 @@ private:
   using DSPCompiledCode = u32 (*)();
   using Block = const u8*;
 
+  // The IRAM blocks compiled for a ucode, kept so that switching back to the ucode later doesn't
+  // have to compile them again. Valid until the code space is reset.
+  struct CachedUCode
+  {
+    std::vector<u16> iram;
+    std::vector<DSPCompiledCode> blocks;
+    std::vector<u16> block_size;
+    std::vector<Block> block_links;
+    std::vector<std::list<u16>> unresolved_jumps;
+  };
+
   // The emitter emits calls to this function. It's present here
   // within the class itself to allow access to member variables.
   static void CompileCurrent(DSPEmitter& emitter);
@@ -202,6 +214,10 @@ private:
 
   void EmitInstruction(UDSPInstruction inst);
   void ClearIRAMandDSPJITCodespaceReset();
+  void ClearBlock(size_t address);
+  std::multimap<u32, CachedUCode>::iterator FindCachedUCode();
+  void SaveUCodeBlocks();
+  bool LoadUCodeBlocks();
 
   void CompileDispatcher();
   Block CompileStub();
@@ -323,6 +339,11 @@ private:
 
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
 
+  // The IRAM contents that the current IRAM blocks were compiled for, keyed by the ucode CRC.
+  u32 m_ucode_crc = 0;
+  std::vector<u16> m_ucode_iram;
+  std::multimap<u32, CachedUCode> m_ucode_cache;
+
   u16 m_cycles_left = 0;
 
   // The index of the last stored ext value (compile time).
@@ -0,0 +1,185 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/GuestProfiler.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace Core
+{
+// Deep enough for any game's call stacks, and bounds the walk if the back chain is garbage.
+constexpr size_t MAX_STACK_DEPTH = 64;
+
+GuestProfiler::GuestProfiler(Core::System& system) : m_system(system)
+{
+}
+
+void GuestProfiler::Init()
+{
+  m_stacks.clear();
+  m_sample_count = 0;
+  m_sample_rate = std::max(Config::Get(Config::MAIN_DEBUG_GUEST_PROFILER_SAMPLE_RATE), 0);
+
+  // Registered even when disabled, so that savestates made while profiling can be loaded.
+  auto& core_timing = m_system.GetCoreTiming();
+  m_event_type_sample = core_timing.RegisterEvent("GuestProfilerSample", SampleCallback);
+  if (m_sample_rate != 0)
+    core_timing.ScheduleEvent(0, m_event_type_sample);
+}
+
+void GuestProfiler::Shutdown()
+{
+  if (m_sample_count == 0)
+    return;
+
+  LogHottestFunctions();
+
+  const std::string filename = fmt::format("{}GuestProfile_{}.folded",
+                                           File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  if (WriteFoldedStacks(filename))
+    NOTICE_LOG_FMT(POWERPC, "Wrote {} guest profiler samples to {}", m_sample_count, filename);
+  else
+    ERROR_LOG_FMT(POWERPC, "Failed to write guest profiler samples to {}", filename);
+
+  m_stacks.clear();
+  m_sample_count = 0;
+}
+
+void GuestProfiler::SampleCallback(Core::System& system, u64 userdata, s64 cycles_late)
+{
+  GuestProfiler& profiler = system.GetPowerPC().GetGuestProfiler();
+
+  // Can be scheduled by a savestate made while profiling was enabled.
+  if (profiler.m_sample_rate == 0)
+    return;
+
+  profiler.Sample();
+
+  const s64 period = system.GetSystemTimers().GetTicksPerSecond() / profiler.m_sample_rate;
+  system.GetCoreTiming().ScheduleEvent(std::max<s64>(period - cycles_late, 1),
+                                       profiler.m_event_type_sample);
+}
+
+void GuestProfiler::Sample()
+{
+  auto& power_pc = m_system.GetPowerPC();
+  const auto& ppc_state = power_pc.GetPPCState();
+  PPCSymbolDB& symbol_db = power_pc.GetSymbolDB();
+
+  const auto get_function = [&symbol_db](u32 address) {
+    const Common::Symbol* symbol = symbol_db.GetSymbolFromAddr(address);
+    return symbol ? symbol->address : address;
+  };
+
+  // Innermost first. Leaf functions may not have stored LR in the stack frame, so LR goes in
+  // before the back chain, and repeats of the same function are dropped.
+  std::vector<u32> stack;
+  const auto add_function = [&stack, &get_function](u32 address) {
+    const u32 function = get_function(address);
+    if (stack.empty() || stack.back() != function)
+      stack.push_back(function);
+  };
+  add_function(ppc_state.pc);
+  if (LR(ppc_state) != 0)
+    add_function(LR(ppc_state) - 4);
+
+  // This runs on the CPU thread, so the guard doesn't pause anything.
+  const Core::CPUThreadGuard guard(m_system);
+  const auto is_stack_bottom = [&guard](u32 address) {
+    return address == 0 || !PowerPC::MMU::HostIsRAMAddress(guard, address);
+  };
+  if (!is_stack_bottom(ppc_state.gpr[1]))
+  {
+    u32 frame = PowerPC::MMU::HostRead_U32(guard, ppc_state.gpr[1]);
+    while (stack.size() < MAX_STACK_DEPTH && !is_stack_bottom(frame) &&
+           !is_stack_bottom(frame + 4))
+    {
+      const u32 return_address = PowerPC::MMU::HostRead_U32(guard, frame + 4);
+      if (return_address == 0)
+        break;
+      add_function(return_address - 4);
+      frame = PowerPC::MMU::HostRead_U32(guard, frame);
+    }
+  }
+
+  std::reverse(stack.begin(), stack.end());
+  ++m_stacks[std::move(stack)];
+  ++m_sample_count;
+}
+
+bool GuestProfiler::WriteFoldedStacks(const std::string& filename) const
+{
+  File::CreateFullPath(filename);
+  File::IOFile file(filename, "w");
+  if (!file)
+    return false;
+
+  PPCSymbolDB& symbol_db = m_system.GetPowerPC().GetSymbolDB();
+  const auto get_name = [&symbol_db](u32 address) {
+    const Common::Symbol* symbol = symbol_db.GetSymbolFromAddr(address);
+    std::string name = symbol ? symbol->name : fmt::format("{:08x}", address);
+    // Semicolons separate the frames, and the last space separates the count.
+    std::replace(name.begin(), name.end(), ';', ':');
+    return name;
+  };
+
+  std::string line;
+  for (const auto& [stack, count] : m_stacks)
+  {
+    line.clear();
+    for (const u32 function : stack)
+    {
+      if (!line.empty())
+        line += ';';
+      line += get_name(function);
+    }
+    line += fmt::format(" {}\n", count);
+    if (!file.WriteString(line))
+      return false;
+  }
+  return true;
+}
+
+void GuestProfiler::LogHottestFunctions() const
+{
+  constexpr size_t MAX_LOGGED_FUNCTIONS = 16;
+
+  // The innermost function of each stack is the one that was running.
+  std::unordered_map<u32, u64> self_samples;
+  for (const auto& [stack, count] : m_stacks)
+    self_samples[stack.back()] += count;
+
+  std::vector<std::pair<u32, u64>> functions(self_samples.begin(), self_samples.end());
+  std::sort(functions.begin(), functions.end(),
+            [](const auto& a, const auto& b) { return a.second > b.second; });
+
+  PPCSymbolDB& symbol_db = m_system.GetPowerPC().GetSymbolDB();
+  NOTICE_LOG_FMT(POWERPC, "Hottest guest functions ({} samples):", m_sample_count);
+  for (size_t i = 0; i < functions.size() && i < MAX_LOGGED_FUNCTIONS; ++i)
+  {
+    const auto& [address, count] = functions[i];
+    const Common::Symbol* symbol = symbol_db.GetSymbolFromAddr(address);
+    NOTICE_LOG_FMT(POWERPC, "  {:08x} {}: {:.1f}%", address, symbol ? symbol->name : "",
+                   100.0 * count / m_sample_count);
+  }
+}
+}  // namespace Core
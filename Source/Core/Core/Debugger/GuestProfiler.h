@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class System;
+}
+namespace CoreTiming
+{
+struct EventType;
+}
+
+namespace Core
+{
+// Samples the guest PC and call stack at a fixed rate of emulated time, set with
+// MAIN_DEBUG_GUEST_PROFILER_SAMPLE_RATE. Unlike JIT profiling this doesn't change the generated
+// code, so it works with every CPU core. With the JITs, samples land on block boundaries. The
+// samples are written as folded stacks, which flamegraph tools read directly, when emulation
+// stops. The sampling event changes where CPU time slices end, so it isn't deterministic
+// against movies or netplay sessions recorded without it.
+class GuestProfiler
+{
+public:
+  explicit GuestProfiler(Core::System& system);
+
+  void Init();
+  void Shutdown();
+
+  // Writes one line for each distinct call stack, outermost function first, separated by
+  // semicolons and followed by the number of samples.
+  bool WriteFoldedStacks(const std::string& filename) const;
+
+private:
+  static void SampleCallback(Core::System& system, u64 userdata, s64 cycles_late);
+  void Sample();
+  void LogHottestFunctions() const;
+
+  Core::System& m_system;
+  CoreTiming::EventType* m_event_type_sample = nullptr;
+  u32 m_sample_rate = 0;
+
+  // Keyed by call stack, outermost function first. The entries are function start addresses, or
+  // the sampled address itself if no symbol covers it.
+  std::map<std::vector<u32>, u64> m_stacks;
+  u64 m_sample_count = 0;
+};
+}  // namespace Core
@@ -231,6 +231,7 @@ public:
     m_parent->m_system.GetCPU().SetStepping(false);
 
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
+    m_parent->m_loop_count.store(0, std::memory_order_relaxed);
     m_parent->LoadMemory();
   }
 
@@ -286,6 +287,7 @@ CPU::State FifoPlayer::AdvanceFrame()
     // This ensures that each time the first frame is played back, the state of the
     // GPU is the same for each playback loop.
     m_CurrentFrame = m_FrameRangeStart;
+    m_loop_count.fetch_add(1, std::memory_order_relaxed);
     LoadRegisters();
     LoadTextureMemory();
     FlushWGP();
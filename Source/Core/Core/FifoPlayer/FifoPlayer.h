@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <set>
@@ -119,6 +120,9 @@ public:
   u32 GetFrameObjectCount(u32 frame) const;
   u32 GetCurrentFrameObjectCount() const;
   u32 GetCurrentFrameNum() const { return m_CurrentFrame; }
+  // How many times playback has started over at the beginning of the frame range. Safe to call
+  // from any thread.
+  u32 GetLoopCount() const { return m_loop_count.load(std::memory_order_relaxed); }
   const AnalyzedFrameInfo& GetAnalyzedFrameInfo(u32 frame) const { return m_FrameInfo[frame]; }
   // Frame range
   u32 GetFrameRangeStart() const { return m_FrameRangeStart; }
@@ -188,6 +192,7 @@ private:
   bool m_EarlyMemoryUpdates = false;
 
   u32 m_CurrentFrame = 0;
+  std::atomic<u32> m_loop_count = 0;
   u32 m_FrameRangeStart = 0;
   u32 m_FrameRangeEnd = 0;
 
@@ -373,16 +373,26 @@ void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, boo
 
   if (!dynamicUpdate && memcmp(curData, newData, size) != 0)
   {
+    // Only record the part that changed. Games often update a few bytes of a large array or
+    // texture, and recording all of it every time makes long recordings huge.
+    const u32 first = static_cast<u32>(std::mismatch(curData, curData + size, newData).first -
+                                       curData);
+    const auto rcur = std::make_reverse_iterator(curData + size);
+    const auto rnew = std::make_reverse_iterator(newData + size);
+    const u32 last =
+        size - static_cast<u32>(std::mismatch(rcur, rcur + (size - first), rnew).first - rcur);
+    const u32 changed_size = last - first;
+
     // Update current memory
-    memcpy(curData, newData, size);
+    memcpy(curData + first, newData + first, changed_size);
 
     // Record memory update
     MemoryUpdate memUpdate;
-    memUpdate.address = address;
+    memUpdate.address = address + first;
     memUpdate.fifoPosition = (u32)(m_FifoData.size());
     memUpdate.type = type;
-    memUpdate.data.resize(size);
-    std::copy_n(newData, size, memUpdate.data.begin());
+    memUpdate.data.resize(changed_size);
+    std::copy_n(newData + first, changed_size, memUpdate.data.begin());
 
     m_CurrentFrame.memoryUpdates.push_back(std::move(memUpdate));
   }
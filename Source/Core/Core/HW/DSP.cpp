@@ -23,7 +23,9 @@
 
 #include "Core/HW/DSP.h"
 
+#include <algorithm>
 #include <memory>
+#include <span>
 
 #include "AudioCommon/AudioCommon.h"
 
@@ -79,7 +81,7 @@ constexpr int DSP_MAIL_SLICE = 72;
 void DSPManager::DoState(PointerWrap& p)
 {
   if (!m_aram.wii_mode)
-    p.DoArray(m_aram.ptr, m_aram.size);
+    p.DoLiveArray(m_aram.ptr, m_aram.size);
   p.Do(m_dsp_control);
   p.Do(m_audio_dma);
   p.Do(m_aram_dma);
@@ -211,7 +213,7 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   }
 
   // DSP mail MMIOs call DSP emulator functions to get results or write data.
-  mmio->Register(base | DSP_MAIL_TO_DSP_HI, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+  mmio->Register(base | DSP_MAIL_TO_DSP_HI, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
                    auto& dsp = system.GetDSP();
                    if (dsp.m_dsp_slice > DSP_MAIL_SLICE && dsp.m_is_lle)
                    {
@@ -220,41 +222,43 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    }
                    return dsp.m_dsp_emulator->DSP_ReadMailBoxHigh(true);
                  }),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& dsp = system.GetDSP();
                    dsp.m_dsp_emulator->DSP_WriteMailBoxHigh(true, val);
                  }));
-  mmio->Register(base | DSP_MAIL_TO_DSP_LO, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+  mmio->Register(base | DSP_MAIL_TO_DSP_LO, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
                    auto& dsp = system.GetDSP();
                    return dsp.m_dsp_emulator->DSP_ReadMailBoxLow(true);
                  }),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& dsp = system.GetDSP();
                    dsp.m_dsp_emulator->DSP_WriteMailBoxLow(true, val);
                  }));
-  mmio->Register(base | DSP_MAIL_FROM_DSP_HI, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
-                   auto& dsp = system.GetDSP();
-                   if (dsp.m_dsp_slice > DSP_MAIL_SLICE && dsp.m_is_lle)
-                   {
-                     dsp.m_dsp_emulator->DSP_Update(DSP_MAIL_SLICE);
-                     dsp.m_dsp_slice -= DSP_MAIL_SLICE;
-                   }
-                   return dsp.m_dsp_emulator->DSP_ReadMailBoxHigh(false);
-                 }),
-                 MMIO::InvalidWrite<u16>());
-  mmio->Register(base | DSP_MAIL_FROM_DSP_LO, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
-                   auto& dsp = system.GetDSP();
-                   return dsp.m_dsp_emulator->DSP_ReadMailBoxLow(false);
-                 }),
-                 MMIO::InvalidWrite<u16>());
+  mmio->Register(
+      base | DSP_MAIL_FROM_DSP_HI, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
+        auto& dsp = system.GetDSP();
+        if (dsp.m_dsp_slice > DSP_MAIL_SLICE && dsp.m_is_lle)
+        {
+          dsp.m_dsp_emulator->DSP_Update(DSP_MAIL_SLICE);
+          dsp.m_dsp_slice -= DSP_MAIL_SLICE;
+        }
+        return dsp.m_dsp_emulator->DSP_ReadMailBoxHigh(false);
+      }),
+      MMIO::InvalidWrite<u16>());
+  mmio->Register(
+      base | DSP_MAIL_FROM_DSP_LO, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
+        auto& dsp = system.GetDSP();
+        return dsp.m_dsp_emulator->DSP_ReadMailBoxLow(false);
+      }),
+      MMIO::InvalidWrite<u16>());
 
   mmio->Register(
-      base | DSP_CONTROL, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+      base | DSP_CONTROL, MMIO::FunctionRead<u16>([](Core::System& system, u32) -> u16 {
         auto& dsp = system.GetDSP();
         return (dsp.m_dsp_control.Hex & ~DSP_CONTROL_MASK) |
                (dsp.m_dsp_emulator->DSP_ReadControlRegister() & DSP_CONTROL_MASK);
       }),
-      MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+      MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
         auto& dsp = system.GetDSP();
 
         UDSPControl tmpControl;
@@ -304,7 +308,7 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // ARAM MMIO controlling the DMA start.
   mmio->Register(base | AR_DMA_CNT_L,
                  MMIO::DirectRead<u16>(MMIO::Utils::LowPart(&m_aram_dma.Cnt.Hex)),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& dsp = system.GetDSP();
                    dsp.m_aram_dma.Cnt.Hex =
                        (dsp.m_aram_dma.Cnt.Hex & 0xFFFF0000) | (val & WMASK_LO_ALIGN_32BIT);
@@ -313,7 +317,7 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   mmio->Register(base | AUDIO_DMA_START_HI,
                  MMIO::DirectRead<u16>(MMIO::Utils::HighPart(&m_audio_dma.SourceAddress)),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& dsp = system.GetDSP();
                    *MMIO::Utils::HighPart(&dsp.m_audio_dma.SourceAddress) =
                        val &
@@ -323,7 +327,7 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // Audio DMA MMIO controlling the DMA start.
   mmio->Register(
       base | AUDIO_DMA_CONTROL_LEN, MMIO::DirectRead<u16>(&m_audio_dma.AudioDMAControl.Hex),
-      MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+      MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
         auto& dsp = system.GetDSP();
         bool already_enabled = dsp.m_audio_dma.AudioDMAControl.Enable;
         dsp.m_audio_dma.AudioDMAControl.Hex = val;
@@ -350,7 +354,7 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // Audio DMA blocks remaining is invalid to write to, and requires logic on
   // the read side.
   mmio->Register(base | AUDIO_DMA_BLOCKS_LEFT,
-                 MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+                 MMIO::FunctionRead<u16>([](Core::System& system, u32) -> u16 {
                    // remaining_blocks_count is zero-based.  DreamMix World Fighters will hang if it
                    // never reaches zero.
                    auto& dsp = system.GetDSP();
@@ -453,6 +457,26 @@ void DSPManager::UpdateAudioDMA()
   }
 }
 
+// Returns how much of the remaining ARAM DMA can be done with a single copy, which is everything
+// up to the end of the RAM region or up to where ARAM (or the mirror, if used) wraps around.
+// Returns 0 if the RAM address is invalid, in which case the rest of the transfer is skipped.
+u32 DSPManager::GetARAMDMAChunkLength(bool mirror) const
+{
+  const std::span<u8> ram = m_system.GetMemory().GetSpanForAddress(m_aram_dma.MMAddr);
+  if (ram.empty())
+    return 0;
+
+  const u64 aram_wrap = u64{m_aram.mask} + 1;
+  u64 length = std::min<u64>(m_aram_dma.Cnt.count, ram.size());
+  length = std::min(length, aram_wrap - (m_aram_dma.ARAddr & m_aram.mask));
+  if (mirror)
+  {
+    length = std::min<u64>(length, 0x400000 - m_aram_dma.ARAddr);
+    length = std::min(length, aram_wrap - ((m_aram_dma.ARAddr + 0x400000) & m_aram.mask));
+  }
+  return static_cast<u32>(length);
+}
+
 void DSPManager::Do_ARAM_DMA()
 {
   auto& core_timing = m_system.GetCoreTiming();
@@ -478,29 +502,18 @@ void DSPManager::Do_ARAM_DMA()
 
     if (m_aram_dma.ARAddr < m_aram.size)
     {
+      // The data is copied the same way for all memory maps set up in AR_INFO.
       while (m_aram_dma.Cnt.count)
       {
-        // These are logically separated in code to show that a memory map has been set up
-        // See below in the write section for more information
-        if ((m_aram_info.Hex & 0xf) == 3)
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
-        else if ((m_aram_info.Hex & 0xf) == 4)
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
+        u32 length = GetARAMDMAChunkLength(false);
+        if (length != 0)
+          memory.CopyToEmu(m_aram_dma.MMAddr, &m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask], length);
         else
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
+          length = m_aram_dma.Cnt.count;
 
-        m_aram_dma.MMAddr += 8;
-        m_aram_dma.ARAddr += 8;
-        m_aram_dma.Cnt.count -= 8;
+        m_aram_dma.MMAddr += length;
+        m_aram_dma.ARAddr += length;
+        m_aram_dma.Cnt.count -= length;
       }
     }
     else if (!m_aram.wii_mode)
@@ -529,30 +542,27 @@ void DSPManager::Do_ARAM_DMA()
     {
       while (m_aram_dma.Cnt.count)
       {
-        if ((m_aram_info.Hex & 0xf) == 3)
-        {
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
-              Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
-        }
-        else if ((m_aram_info.Hex & 0xf) == 4)
+        // With this memory map, the lower 4 MiB of ARAM are mirrored to the next 4 MiB.
+        const bool mirror = (m_aram_info.Hex & 0xf) == 4 && m_aram_dma.ARAddr < 0x400000;
+        u32 length = GetARAMDMAChunkLength(mirror);
+        if (length != 0)
         {
-          if (m_aram_dma.ARAddr < 0x400000)
+          if (mirror)
           {
-            *(u64*)&m_aram.ptr[(m_aram_dma.ARAddr + 0x400000) & m_aram.mask] =
-                Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
+            memory.CopyFromEmu(&m_aram.ptr[(m_aram_dma.ARAddr + 0x400000) & m_aram.mask],
+                               m_aram_dma.MMAddr, length);
           }
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
-              Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
+          memory.CopyFromEmu(&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask], m_aram_dma.MMAddr,
+                             length);
         }
         else
         {
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
-              Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
+          length = m_aram_dma.Cnt.count;
         }
 
-        m_aram_dma.MMAddr += 8;
-        m_aram_dma.ARAddr += 8;
-        m_aram_dma.Cnt.count -= 8;
+        m_aram_dma.MMAddr += length;
+        m_aram_dma.ARAddr += length;
+        m_aram_dma.Cnt.count -= length;
       }
     }
     else if (!m_aram.wii_mode)
@@ -592,6 +602,24 @@ u8 DSPManager::ReadARAM(u32 address) const
   }
 }
 
+const u8* DSPManager::GetARAMPointerForRange(u32 address, u32 size) const
+{
+  if (m_aram.wii_mode && (address & 0x10000000) == 0)
+  {
+    auto& memory = m_system.GetMemory();
+    const u32 ram_offset = address & memory.GetRamMask();
+    if (u64{ram_offset} + size > u64{memory.GetRamMask()} + 1)
+      return nullptr;
+    const std::span<u8> ram = memory.GetSpanForAddress(ram_offset);
+    return ram.size() >= size ? ram.data() : nullptr;
+  }
+
+  const u32 aram_offset = address & m_aram.mask;
+  if (u64{aram_offset} + size > u64{m_aram.mask} + 1)
+    return nullptr;
+  return m_aram.ptr + aram_offset;
+}
+
 void DSPManager::WriteARAM(u8 value, u32 address)
 {
   // TODO: verify this on Wii
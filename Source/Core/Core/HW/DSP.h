@@ -93,6 +93,9 @@ public:
 
   // Audio/DSP Helper
   u8 ReadARAM(u32 address) const;
+  // Returns a pointer to size bytes that read the same as ReadARAM, or nullptr if they aren't
+  // contiguous in host memory.
+  const u8* GetARAMPointerForRange(u32 address, u32 size) const;
   void WriteARAM(u8 value, u32 address);
 
   // Debugger Helper
@@ -108,6 +111,7 @@ private:
   static void GlobalCompleteARAM(Core::System& system, u64 userdata, s64 cyclesLate);
   void UpdateInterrupts();
   void Do_ARAM_DMA();
+  u32 GetARAMDMAChunkLength(bool mirror) const;
 
   // UARAMCount
   union UARAMCount
@@ -462,6 +462,7 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   constexpr u32 spms = 32;
 
   AXPB pb;
+  u32 inaudible_voice_blocks = 0;
 
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
@@ -478,9 +479,12 @@ void AXUCode::ProcessPBList(u32 pb_addr)
     {
       ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
 
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                   ConvertMixerControl(pb.mixer_control),
-                   m_coeffs_checksum ? m_coeffs.data() : nullptr, false);
+      if (ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
+                       ConvertMixerControl(pb.mixer_control),
+                       m_coeffs_checksum ? m_coeffs.data() : nullptr, false))
+      {
+        ++inaudible_voice_blocks;
+      }
 
       // Forward the buffers
       for (auto& ptr : buffers.ptrs)
@@ -490,6 +494,9 @@ void AXUCode::ProcessPBList(u32 pb_addr)
     WritePB(memory, pb_addr, pb);
     pb_addr = HILO_TO_32(pb.next_pb);
   }
+
+  if (inaudible_voice_blocks != 0)
+    DEBUG_LOG_FMT(DSPHLE, "AX: Only decoded {} inaudible voice blocks", inaudible_voice_blocks);
 }
 
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
@@ -12,8 +12,8 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -35,6 +35,9 @@ namespace DSP::HLE
 #define MAX_SAMPLES_PER_FRAME 96
 #endif
 
+// Highest resampling ratio for which GetInputSamples decodes a voice's input in a single block.
+constexpr u32 MAX_DECODE_RATIO = 4;
+
 // Use an inline namespace to prevent stupid compilers and debuggers from merging
 // functions from AX GC and AX Wii.
 #ifdef AX_GC
@@ -167,6 +170,11 @@ protected:
 
   void WriteMemory(u32 address, u8 value) override { m_dsp.WriteARAM(value, address); }
 
+  const u8* GetMemoryPointer(u32 address, u32 size) override
+  {
+    return m_dsp.GetARAMPointerForRange(address, size);
+  }
+
 private:
   DSP::DSPManager& m_dsp;
 };
@@ -212,7 +220,11 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+//
+// <input_callback> is a template parameter rather than a std::function so that
+// reading an input sample can be inlined into the resampling loops.
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
@@ -324,6 +336,40 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   return curr_pos;
 }
 
+// Leaves last_samples and the position where ResampleAudio would, without computing any output.
+// input must hold the samples ResampleAudio would read.
+u32 SkipResampleAudio(const s16* input, u32 count, s16* last_samples, u32 curr_pos, u32 ratio,
+                      int srctype)
+{
+  // Without resampling, exactly count samples are read and the position is left alone.
+  const bool resampling = srctype == SRCTYPE_POLYPHASE || srctype == SRCTYPE_LINEAR;
+  const u64 end_pos = curr_pos + u64(ratio) * count;
+  const u32 input_count = resampling ? static_cast<u32>(end_pos >> 16) : count;
+
+  // The resampler keeps the last four samples it read, including ones from earlier frames.
+  if (input_count >= 4)
+  {
+    std::copy_n(input + input_count - 4, 4, last_samples);
+  }
+  else
+  {
+    std::copy(last_samples + input_count, last_samples + 4, last_samples);
+    std::copy_n(input, input_count, last_samples + 4 - input_count);
+  }
+
+  return resampling ? static_cast<u32>(end_pos & 0xFFFF) : curr_pos;
+}
+
+// Update current position, YN1, YN2 and pred scale in the PB.
+void StoreAcceleratorState(HLEAccelerator* accelerator, PB_TYPE& pb)
+{
+  pb.audio_addr.cur_addr_hi = static_cast<u16>(accelerator->GetCurrentAddress() >> 16);
+  pb.audio_addr.cur_addr_lo = static_cast<u16>(accelerator->GetCurrentAddress());
+  pb.adpcm.yn1 = accelerator->GetYn1();
+  pb.adpcm.yn2 = accelerator->GetYn2();
+  pb.adpcm.pred_scale = accelerator->GetPredScale();
+}
+
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
@@ -333,17 +379,54 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // Decode all of the input samples the resampler will use in one go, which keeps the
+  // accelerator's decoding loop separate from the resampling loop. Resampling reads
+  // `(frac + count * ratio) >> 16` input samples (or exactly `count` without resampling).
+  // Voices that are pitched up a lot are rare, and they are read on demand instead.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const bool resampling = pb.src_type == SRCTYPE_POLYPHASE || pb.src_type == SRCTYPE_LINEAR;
+  const u64 input_count =
+      resampling ? (pb.src.cur_addr_frac + u64(ratio) * count) >> 16 : u64(count);
+
+  u32 curr_pos;
+  if (ratio <= MAX_DECODE_RATIO << 16)
+  {
+    std::array<s16, MAX_SAMPLES_PER_FRAME * MAX_DECODE_RATIO + 1> input;
+    accelerator->ReadSamples(pb.adpcm.coefs, input.data(), input_count);
+    curr_pos = ResampleAudio([&input](u32 i) { return input[i]; }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, ratio, pb.src_type, coeffs);
+  }
+  else
+  {
+    curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
+                             samples, count, pb.src.last_samples, pb.src.cur_addr_frac, ratio,
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
-  // Update current position, YN1, YN2 and pred scale in the PB.
-  pb.audio_addr.cur_addr_hi = static_cast<u16>(accelerator->GetCurrentAddress() >> 16);
-  pb.audio_addr.cur_addr_lo = static_cast<u16>(accelerator->GetCurrentAddress());
-  pb.adpcm.yn1 = accelerator->GetYn1();
-  pb.adpcm.yn2 = accelerator->GetYn2();
-  pb.adpcm.pred_scale = accelerator->GetPredScale();
+  StoreAcceleratorState(accelerator, pb);
+}
+
+// Same as GetInputSamples, for a voice whose samples are thrown away: the input samples are
+// decoded so that the accelerator and the ADPCM state advance, but nothing is resampled.
+// Only valid if the ratio is at most MAX_DECODE_RATIO.
+void SkipInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, u16 count)
+{
+  AcceleratorSetup(accelerator, &pb);
+
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const bool resampling = pb.src_type == SRCTYPE_POLYPHASE || pb.src_type == SRCTYPE_LINEAR;
+  const u64 input_count =
+      resampling ? (pb.src.cur_addr_frac + u64(ratio) * count) >> 16 : u64(count);
+
+  std::array<s16, MAX_SAMPLES_PER_FRAME * MAX_DECODE_RATIO + 1> input;
+  accelerator->ReadSamples(pb.adpcm.coefs, input.data(), input_count);
+  pb.src.cur_addr_frac = SkipResampleAudio(input.data(), count, pb.src.last_samples,
+                                           pb.src.cur_addr_frac, ratio, pb.src_type) &
+                         0xFFFF;
+
+  StoreAcceleratorState(accelerator, pb);
 }
 
 s16 ClampS16(s64 sample)
@@ -363,18 +446,29 @@ void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bo
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  if (count == 0)
+    return;
+
+  // Many games leave most of the buses of a voice muted.
+  if (volume == 0 && volume_delta == 0)
   {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
+    *dpop = 0;
+    return;
+  }
 
-    out[i] += sample16;
-    volume += volume_delta;
+  // The volume for each sample is computed from the index rather than carried from one
+  // iteration to the next, and |s16 * u16| always fits in an s32, so compilers can
+  // vectorize this loop.
+  const auto mix_sample = [input, volume, volume_delta](u32 i) -> s16 {
+    const u16 sample_volume = static_cast<u16>(volume + i * volume_delta);
+    return std::clamp<s32>((s32(input[i]) * sample_volume) >> 15, -0x8000, 0x7FFF);
+  };
 
-    *dpop = sample16;
-  }
+  for (u32 i = 0; i < count; ++i)
+    out[i] += mix_sample(i);
+
+  *dpop = mix_sample(count - 1);
+  volume += static_cast<u16>(count * volume_delta);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -413,33 +507,77 @@ static void BiquadFilter(s16* samples, u32 count, PBBiquadFilter& f)
 }
 #endif
 
+#define MIX_ON(C) (0 != (mctrl & MIX_##C))
+#define RAMP_ON(C) (0 != (mctrl & MIX_##C##_RAMP))
+#define MIX_MUTED(C, V)                                                                            \
+  (!MIX_ON(C) || (pb.mixer.V.volume == 0 && (!RAMP_ON(C) || pb.mixer.V.volume_delta == 0)))
+
+// Whether nothing that depends on the voice's samples can be heard or carried over to the next
+// frame: every bus skips the voice in MixAdd, and no filter keeps history.
+bool IsVoiceInaudible(const PB_TYPE& pb, AXMixControl mctrl, bool new_filter)
+{
+  if (HILO_TO_32(pb.src.ratio) > MAX_DECODE_RATIO << 16 || pb.lpf.on != 0)
+    return false;
+
+#ifdef AX_WII
+  if ((new_filter && pb.biquad.on != 0) || pb.remote)
+    return false;
+  if (!MIX_MUTED(AUXC_L, auxC_left) || !MIX_MUTED(AUXC_R, auxC_right) ||
+      !MIX_MUTED(AUXC_S, auxC_surround))
+  {
+    return false;
+  }
+#endif
+
+  return MIX_MUTED(MAIN_L, main_left) && MIX_MUTED(MAIN_R, main_right) &&
+         MIX_MUTED(MAIN_S, main_surround) && MIX_MUTED(AUXA_L, auxA_left) &&
+         MIX_MUTED(AUXA_R, auxA_right) && MIX_MUTED(AUXA_S, auxA_surround) &&
+         MIX_MUTED(AUXB_L, auxB_left) && MIX_MUTED(AUXB_R, auxB_right) &&
+         MIX_MUTED(AUXB_S, auxB_surround);
+}
+
 // Process 1ms of audio (for AX GC) or 3ms of audio (for AX Wii) from a PB and
-// mix it to the output buffers.
-void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers, u16 count,
+// mix it to the output buffers. Returns true if the voice was running but inaudible,
+// in which case only its state was advanced.
+bool ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers, u16 count,
                   AXMixControl mctrl, const s16* coeffs, bool new_filter)
 {
   // If the voice is not running, nothing to do.
   if (pb.running != 1)
-    return;
+    return false;
 
-  // Read input samples, performing sample rate conversion if needed.
+  // Faded out voices are often left running. Their samples only need to be decoded, and the
+  // mixing below skips every bus for them, so they're passed on as silence.
   s16 samples[MAX_SAMPLES_PER_FRAME];
-  GetInputSamples(accelerator, pb, samples, count, coeffs);
-
-  // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
+  const bool inaudible = IsVoiceInaudible(pb, mctrl, new_filter);
+  const u16 start_volume = pb.vol_env.cur_volume;
+  const u16 volume_delta = pb.vol_env.cur_volume_delta;
+  if (inaudible)
+  {
+    SkipInputSamples(accelerator, pb, count);
+    std::fill_n(samples, count, 0);
+  }
+  else
   {
+    // Read input samples, performing sample rate conversion if needed.
+    GetInputSamples(accelerator, pb, samples, count, coeffs);
+
+    // Apply a global volume ramp using the volume envelope parameters.
+    // As in MixAdd, the volume is computed from the index so that this loop can be vectorized.
+    for (u32 i = 0; i < count; ++i)
+    {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+      // signed on GameCube
+      const s32 volume = static_cast<s16>(start_volume + i * volume_delta);
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+      // unsigned on Wii
+      const s32 volume = static_cast<u16>(start_volume + i * volume_delta);
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
+      const s32 sample = ((s32)samples[i] * volume) >> 15;
+      samples[i] = std::clamp<s32>(sample, -0x8000, 0x7FFF);
+    }
   }
+  pb.vol_env.cur_volume = static_cast<s16>(start_volume + count * volume_delta);
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -457,9 +595,6 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   // Mix LRS, AUXA and AUXB depending on mixer_control
   // TODO: Handle DPL2 on AUXB.
 
-#define MIX_ON(C) (0 != (mctrl & MIX_##C))
-#define RAMP_ON(C) (0 != (mctrl & MIX_##C##_RAMP))
-
   if (MIX_ON(MAIN_L))
   {
     MixAdd(buffers.main_left, samples, count, &pb.mixer.main_left, &pb.dpop.main_left,
@@ -526,6 +661,7 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   }
 #endif
 
+#undef MIX_MUTED
 #undef MIX_ON
 #undef RAMP_ON
 
@@ -600,6 +736,8 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #undef WMCHAN_MIX_RAMP
 #undef WMCHAN_MIX_ON
 #endif
+
+  return inaudible;
 }
 
 }  // namespace
@@ -438,6 +438,7 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   constexpr u32 spms = 32;
 
   AXPBWii pb;
+  u32 inaudible_voice_blocks = 0;
 
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
@@ -459,9 +460,12 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
       for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
       {
         ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
-        ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                     ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
-                     m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
+        if (ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
+                         ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
+                         m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter))
+        {
+          ++inaudible_voice_blocks;
+        }
 
         // Forward the buffers
         for (auto& ptr : buffers.regular_ptrs)
@@ -472,14 +476,22 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
     }
     else
     {
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, 96,
-                   ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
-                   m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
+      if (ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, 96,
+                       ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
+                       m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter))
+      {
+        ++inaudible_voice_blocks;
+      }
     }
 
     WritePB(memory, pb_addr, pb);
     pb_addr = HILO_TO_32(pb.next_pb);
   }
+
+  if (inaudible_voice_blocks != 0)
+  {
+    DEBUG_LOG_FMT(DSPHLE, "AXWii: Only decoded {} inaudible voice blocks", inaudible_voice_blocks);
+  }
 }
 
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
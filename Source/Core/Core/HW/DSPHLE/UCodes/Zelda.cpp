@@ -1115,15 +1115,19 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
         (*last8_samples_buffers[rpb_idx])[i] = buffer[0x50 + i];
 
       auto ApplyFilter = [&]() {
-        // Filter the buffer using provided coefficients.
+        // Filter the buffer using provided coefficients. The output goes to a separate
+        // buffer first, so that the filter taps of each sample are independent of the
+        // previous outputs and the loop can be vectorized.
+        std::array<s16, 0x50> filtered;
         for (u16 i = 0; i < 0x50; ++i)
         {
           s32 sample = 0;
           for (u16 j = 0; j < 8; ++j)
             sample += (s32)buffer[i + j] * rpb.filter_coeffs[j];
           sample >>= 15;
-          buffer[i] = std::clamp(sample, -0x8000, 0x7FFF);
+          filtered[i] = std::clamp(sample, -0x8000, 0x7FFF);
         }
+        std::ranges::copy(filtered, buffer.begin());
       };
 
       // LSB set -> pre-filtering.
@@ -14,6 +14,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/PerfCounters.h"
 #include "Common/Thread.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -30,6 +31,10 @@
 
 namespace DSP::LLE
 {
+// How many DSP cycles the DSP thread may lag behind the CPU in the decoupled mode. This is a
+// few update slices, or around 0.2 ms of emulated time.
+constexpr u32 MAX_DECOUPLED_CYCLES = 16384;
+
 DSPLLE::DSPLLE() = default;
 
 DSPLLE::~DSPLLE()
@@ -57,6 +62,7 @@ void DSPLLE::DoState(PointerWrap& p)
 void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
+  Common::PerfCounters::RegisterCurrentThread("DSP");
 
   while (dsp_lle->m_is_running.IsSet())
   {
@@ -74,7 +80,10 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
         {
           dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
         }
-        dsp_lle->m_cycle_count.store(0);
+        // In the decoupled mode, the CPU may have added more cycles in the meantime.
+        dsp_lle->m_cycle_count.fetch_sub(static_cast<u32>(cycles));
+        if (dsp_lle->m_is_dsp_thread_decoupled)
+          dsp_lle->m_ppc_event.Set();
         continue;
       }
     }
@@ -120,7 +129,7 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CoreType::Interpreter;
-#ifdef _M_X86_64
+#if defined(_M_X86_64) || defined(_M_ARM_64)
   if (Config::Get(Config::MAIN_DSP_JIT))
     opts->core_type = DSPInitOptions::CoreType::JIT64;
 #endif
@@ -150,6 +159,7 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   m_wii = wii;
   m_is_dsp_on_thread = dsp_thread;
+  m_is_dsp_thread_decoupled = dsp_thread && Config::Get(Config::MAIN_DSP_THREAD_DECOUPLED);
 
   m_dsp_core.Reset();
 
@@ -212,6 +222,17 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  // Mail is how the CPU and the DSP synchronize, so let the DSP catch up before reporting a
+  // mailbox state that it could still change: the DSP mailbox being empty, or the CPU mailbox
+  // being full.
+  if (m_is_dsp_thread_decoupled)
+  {
+    const Mailbox mailbox = cpu_mailbox ? Mailbox::CPU : Mailbox::DSP;
+    const bool has_mail = (m_dsp_core.PeekMailbox(mailbox) & 0x80000000) != 0;
+    if (has_mail == cpu_mailbox)
+      WaitForDSPThread();
+  }
+
   return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
@@ -263,6 +284,7 @@ void DSPLLE::DSP_Update(int cycles)
     {
       DSP_StopSoundStream();
       m_is_dsp_on_thread = false;
+      m_is_dsp_thread_decoupled = false;
       m_request_disable_thread = false;
       Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, false);
     }
@@ -274,6 +296,17 @@ void DSPLLE::DSP_Update(int cycles)
     // ~1/6th as many cycles as the period PPC-side.
     m_dsp_core.RunCycles(dsp_cycles);
   }
+  else if (m_is_dsp_thread_decoupled)
+  {
+    m_cycle_count.fetch_add(dsp_cycles);
+    m_dsp_event.Set();
+
+    while (m_cycle_count.load() > MAX_DECOUPLED_CYCLES && m_is_running.IsSet())
+    {
+      m_dsp_event.Set();
+      m_ppc_event.Wait();
+    }
+  }
   else
   {
     // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
@@ -283,6 +316,15 @@ void DSPLLE::DSP_Update(int cycles)
   }
 }
 
+void DSPLLE::WaitForDSPThread()
+{
+  while (m_cycle_count.load() != 0 && m_is_running.IsSet())
+  {
+    m_dsp_event.Set();
+    m_ppc_event.Wait();
+  }
+}
+
 u32 DSPLLE::DSP_UpdateRate()
 {
   return 12600;  // TO BE TWEAKED
@@ -40,11 +40,15 @@ public:
 
 private:
   static void DSPThread(DSPLLE* dsp_lle);
+  void WaitForDSPThread();
 
   DSPCore m_dsp_core;
   std::thread m_dsp_thread;
   std::mutex m_dsp_thread_mutex;
   bool m_is_dsp_on_thread = false;
+  // If set, the CPU only waits for the DSP thread when it falls too far behind or when the CPU
+  // looks at a mailbox, instead of after every slice.
+  bool m_is_dsp_thread_decoupled = false;
   Common::Flag m_is_running;
   std::atomic<u32> m_cycle_count{};
 
@@ -3,6 +3,9 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -13,14 +16,17 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/FrameTrace.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -32,7 +38,9 @@
 #include "Core/System.h"
 
 #include "DiscIO/Enums.h"
+#include "DiscIO/Filesystem.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/WiiClusterCache.h"
 
 namespace DVD
 {
@@ -69,6 +77,8 @@ void DVDThread::Stop()
 {
   StopDVDThread();
   m_disc.reset();
+  ClearPrefetch();
+  m_cluster_caches.clear();
 }
 
 void DVDThread::StopDVDThread()
@@ -92,7 +102,7 @@ void DVDThread::DoState(PointerWrap& p)
   WaitUntilIdle();
 
   // Move all results from result_queue to result_map because
-  // PointerWrap::Do supports std::map but not Common::SPSCQueue.
+  // PointerWrap::Do supports std::map but not Common::SPSCRingQueue.
   // This won't affect the behavior of FinishRead.
   ReadResult result;
   while (m_result_queue.Pop(result))
@@ -132,6 +142,8 @@ void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   m_disc = std::move(disc);
+  ClearPrefetch();
+  m_cluster_caches.clear();
 }
 
 bool DVDThread::HasDisc() const
@@ -342,13 +354,25 @@ void DVDThread::DVDThreadMain()
     ReadRequest request;
     while (m_request_queue.Pop(request))
     {
+      TRACE_SCOPE("DVDThread::Read");
+
       m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
-
-      request.realtime_done_us = Common::Timer::NowUs();
+      if (request.reply_type == ReplyType::DTK)
+      {
+        // Keep streamed audio from interrupting the detection of sequential reads.
+        if (!ReadStreamingAudio(request, buffer.data()))
+          buffer.resize(0);
+        request.realtime_done_us = Common::Timer::NowUs();
+      }
+      else
+      {
+        if (!ReadDisc(request, buffer.data()))
+          buffer.resize(0);
+        request.realtime_done_us = Common::Timer::NowUs();
+        UpdatePrefetchTarget(request);
+      }
 
       m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
       m_result_queue_expanded.Set();
@@ -356,6 +380,198 @@ void DVDThread::DVDThreadMain()
       if (m_dvd_thread_exiting.IsSet())
         return;
     }
+
+    // Read ahead while no requests are queued. A request that arrives in the meantime has to wait
+    // for the prefetch to finish, which is why prefetches are kept small.
+    TRACE_SCOPE("DVDThread::Prefetch");
+    Prefetch();
+    PrefetchStreamingAudio();
+  }
+}
+
+bool DVDThread::ReadDisc(const ReadRequest& request, u8* out_ptr)
+{
+  u64 offset = request.dvd_offset;
+  u64 length = request.length;
+
+  const u64 prefetch_end = m_prefetch_offset + m_prefetch_buffer.size();
+  if (request.partition == m_prefetch_partition && offset >= m_prefetch_offset &&
+      offset < prefetch_end)
+  {
+    const u64 bytes_to_copy = std::min(length, prefetch_end - offset);
+    std::memcpy(out_ptr, m_prefetch_buffer.data() + (offset - m_prefetch_offset), bytes_to_copy);
+    offset += bytes_to_copy;
+    length -= bytes_to_copy;
+    out_ptr += bytes_to_copy;
   }
+
+  return length == 0 || ReadVolume(offset, length, out_ptr, request.partition);
+}
+
+void DVDThread::UpdatePrefetchTarget(const ReadRequest& request)
+{
+  constexpr u64 MIN_PREFETCH_SIZE = 0x8000;
+  constexpr u64 MAX_PREFETCH_SIZE = 0x100000;
+
+  const u64 request_end = request.dvd_offset + request.length;
+  const bool sequential =
+      request.partition == m_last_read_partition && request.dvd_offset == m_last_read_end;
+  m_last_read_partition = request.partition;
+  m_last_read_end = request_end;
+  m_prefetch_target_end = 0;
+
+  if (!sequential || request.length == 0)
+    return;
+
+  u64 target_end =
+      request_end + std::clamp<u64>(u64{request.length} * 2, MIN_PREFETCH_SIZE, MAX_PREFETCH_SIZE);
+
+  // Games rarely continue past the end of a file into whatever happens to be stored next.
+  if (const DiscIO::FileSystem* file_system = m_disc->GetFileSystem(request.partition))
+  {
+    const std::unique_ptr<DiscIO::FileInfo> file_info = file_system->FindFileInfo(request_end - 1);
+    if (file_info)
+      target_end = std::min(target_end, file_info->GetOffset() + file_info->GetSize());
+  }
+
+  m_prefetch_target_end = target_end;
+}
+
+void DVDThread::Prefetch()
+{
+  const u64 start = m_last_read_end;
+  const u64 end = m_prefetch_target_end;
+  if (end <= start)
+    return;
+  m_prefetch_target_end = 0;
+
+  // Keep what has already been read, and only read the rest.
+  const u64 old_end = m_prefetch_offset + m_prefetch_buffer.size();
+  u64 read_start = start;
+  if (m_last_read_partition == m_prefetch_partition && start >= m_prefetch_offset &&
+      start < old_end)
+  {
+    m_prefetch_buffer.erase(m_prefetch_buffer.begin(),
+                            m_prefetch_buffer.begin() + (start - m_prefetch_offset));
+    read_start = std::min(old_end, end);
+  }
+  else
+  {
+    m_prefetch_buffer.clear();
+  }
+  m_prefetch_partition = m_last_read_partition;
+  m_prefetch_offset = start;
+
+  if (read_start >= end)
+    return;
+
+  m_prefetch_buffer.resize(end - start);
+  if (!ReadVolume(read_start, end - read_start, m_prefetch_buffer.data() + (read_start - start),
+                  m_prefetch_partition))
+  {
+    m_prefetch_buffer.resize(read_start - start);
+  }
+}
+
+void DVDThread::ClearPrefetch()
+{
+  m_last_read_partition = DiscIO::Partition();
+  m_last_read_end = std::numeric_limits<u64>::max();
+  m_prefetch_target_end = 0;
+  m_prefetch_buffer.clear();
+  m_dtk_prefetch_pending = false;
+  m_dtk_buffer.clear();
+}
+
+// About 4.5 seconds of 48 kHz audio.
+constexpr u64 DTK_WINDOW_SIZE = 0x40000;
+
+u64 DVDThread::GetStreamingAudioWindowEnd(u64 offset)
+{
+  u64 end = offset + DTK_WINDOW_SIZE;
+
+  // Don't read past the end of the track, as that can be the end of the disc.
+  if (const DiscIO::FileSystem* file_system = m_disc->GetFileSystem(DiscIO::PARTITION_NONE))
+  {
+    const std::unique_ptr<DiscIO::FileInfo> file_info = file_system->FindFileInfo(offset);
+    if (file_info)
+      end = std::min(end, file_info->GetOffset() + file_info->GetSize());
+  }
+
+  return end;
+}
+
+bool DVDThread::ReadStreamingAudio(const ReadRequest& request, u8* out_ptr)
+{
+  const u64 offset = request.dvd_offset;
+  const u64 end = offset + request.length;
+
+  if (request.partition != DiscIO::PARTITION_NONE || offset < m_dtk_offset ||
+      end > m_dtk_offset + m_dtk_buffer.size())
+  {
+    // The track is starting or has looped, or the window ran dry. Start a new window here.
+    m_dtk_offset = offset;
+    m_dtk_buffer.resize(std::max(GetStreamingAudioWindowEnd(offset), end) - offset);
+    if (request.partition != DiscIO::PARTITION_NONE ||
+        !ReadVolume(offset, m_dtk_buffer.size(), m_dtk_buffer.data(), DiscIO::PARTITION_NONE))
+    {
+      m_dtk_buffer.clear();
+      return ReadVolume(offset, request.length, out_ptr, request.partition);
+    }
+  }
+
+  std::memcpy(out_ptr, m_dtk_buffer.data() + (offset - m_dtk_offset), request.length);
+
+  m_dtk_read_end = end;
+  m_dtk_prefetch_pending = true;
+  return true;
+}
+
+void DVDThread::PrefetchStreamingAudio()
+{
+  if (!m_dtk_prefetch_pending)
+    return;
+  m_dtk_prefetch_pending = false;
+
+  // Top the window back up once half of it has been played.
+  const u64 old_end = m_dtk_offset + m_dtk_buffer.size();
+  if (old_end - m_dtk_read_end >= DTK_WINDOW_SIZE / 2)
+    return;
+  const u64 end = GetStreamingAudioWindowEnd(m_dtk_read_end);
+  if (end <= old_end)
+    return;
+
+  m_dtk_buffer.erase(m_dtk_buffer.begin(),
+                     m_dtk_buffer.begin() + (m_dtk_read_end - m_dtk_offset));
+  m_dtk_offset = m_dtk_read_end;
+  m_dtk_buffer.resize(end - m_dtk_offset);
+  if (!ReadVolume(old_end, end - old_end, m_dtk_buffer.data() + (old_end - m_dtk_offset),
+                  DiscIO::PARTITION_NONE))
+  {
+    m_dtk_buffer.resize(old_end - m_dtk_offset);
+  }
+}
+
+bool DVDThread::ReadVolume(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition)
+{
+  if (partition != DiscIO::PARTITION_NONE)
+  {
+    auto it = m_cluster_caches.find(partition);
+    if (it == m_cluster_caches.end())
+    {
+      std::unique_ptr<DiscIO::WiiClusterCache> cache;
+      if (Config::Get(Config::MAIN_WII_CLUSTER_CACHE))
+      {
+        const u64 max_size = u64{Config::Get(Config::MAIN_WII_CLUSTER_CACHE_SIZE)} * 1024 * 1024;
+        cache = DiscIO::WiiClusterCache::Open(*m_disc, partition, max_size);
+      }
+      it = m_cluster_caches.emplace(partition, std::move(cache)).first;
+    }
+
+    if (it->second)
+      return it->second->Read(*m_disc, offset, length, out_ptr);
+  }
+
+  return m_disc->Read(offset, length, out_ptr, partition);
 }
 }  // namespace DVD
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -13,7 +14,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
-#include "Common/SPSCQueue.h"
+#include "Common/SPSCRingQueue.h"
 
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/DVD/FileMonitor.h"
@@ -38,6 +39,7 @@ namespace DiscIO
 {
 enum class Platform;
 class Volume;
+class WiiClusterCache;
 }  // namespace DiscIO
 
 namespace IOS::ES
@@ -126,6 +128,15 @@ private:
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+  bool ReadDisc(const ReadRequest& request, u8* out_ptr);
+  void UpdatePrefetchTarget(const ReadRequest& request);
+  void Prefetch();
+  void ClearPrefetch();
+  bool ReadStreamingAudio(const ReadRequest& request, u8* out_ptr);
+  void PrefetchStreamingAudio();
+  u64 GetStreamingAudioWindowEnd(u64 offset);
+  bool ReadVolume(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition);
+
   CoreTiming::EventType* m_finish_read = nullptr;
 
   u64 m_next_id = 0;
@@ -135,12 +146,35 @@ private:
   Common::Event m_result_queue_expanded;                    // Is set by DVD thread
   Common::Flag m_dvd_thread_exiting = Common::Flag(false);  // Is set by CPU thread
 
-  Common::SPSCQueue<ReadRequest, false> m_request_queue;
-  Common::SPSCQueue<ReadResult, false> m_result_queue;
+  // Every request is finished by a CoreTiming event on the CPU thread, and the drive only has a
+  // few of them in flight, so Push never has to wait for the other thread in practice.
+  Common::SPSCRingQueue<ReadRequest, 64> m_request_queue;
+  Common::SPSCRingQueue<ReadResult, 64> m_result_queue;
   std::map<u64, ReadResult> m_result_map;
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  // When the game reads sequentially, the data after its last read is read ahead of time while
+  // the DVD thread would otherwise be idle, so that slow storage overlaps with emulation.
+  // Only used by the DVD thread, except while it is idle.
+  DiscIO::Partition m_last_read_partition;
+  u64 m_last_read_end = std::numeric_limits<u64>::max();
+  u64 m_prefetch_target_end = 0;
+  DiscIO::Partition m_prefetch_partition;
+  u64 m_prefetch_offset = 0;
+  std::vector<u8> m_prefetch_buffer;
+
+  // Streamed audio is read in tiny pieces every few milliseconds, interleaved with whatever else
+  // the game reads, so it gets a separate read-ahead window that is refilled while idle.
+  // Only used by the DVD thread, except while it is idle.
+  u64 m_dtk_offset = 0;
+  u64 m_dtk_read_end = 0;
+  bool m_dtk_prefetch_pending = false;
+  std::vector<u8> m_dtk_buffer;
+
+  // Opened on the first read from each partition. Null if the cache is disabled or unavailable.
+  std::map<DiscIO::Partition, std::unique_ptr<DiscIO::WiiClusterCache>> m_cluster_caches;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
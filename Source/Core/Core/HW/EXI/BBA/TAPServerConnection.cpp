@@ -16,9 +16,11 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #include "Common/CommonFuncs.h"
 #include "Common/Logging/Log.h"
+#include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
 #include "Core/HW/EXI/EXI_Device.h"
 
@@ -177,11 +179,33 @@ void TAPServerConnection::RecvStop()
   m_read_enabled.Clear();
 }
 
+bool TAPServerConnection::SendWithSize(const u8* data, std::size_t size)
+{
+  // Sending the size field together with the data takes one system call instead of two.
+  m_send_buffer.resize(size + 2);
+  m_send_buffer[0] = static_cast<u8>(size);
+  m_send_buffer[1] = static_cast<u8>(size >> 8);
+  std::memcpy(m_send_buffer.data() + 2, data, size);
+
+  const ws_ssize_t written_bytes =
+      send(m_fd, reinterpret_cast<const char*>(m_send_buffer.data()),
+           static_cast<ws_ssize_t>(m_send_buffer.size()), SEND_FLAGS);
+  if (written_bytes < 0 || static_cast<std::size_t>(written_bytes) != m_send_buffer.size())
+  {
+    ERROR_LOG_FMT(SP1, "Expected to write {} bytes, instead wrote {}", m_send_buffer.size(),
+                  written_bytes);
+    return false;
+  }
+  return true;
+}
+
 bool TAPServerConnection::SendAndRemoveAllHDLCFrames(std::string* send_buf)
 {
-  while (!send_buf->empty())
+  std::size_t sent_size = 0;
+  bool success = true;
+  while (sent_size < send_buf->size())
   {
-    const std::size_t start_offset = send_buf->find(0x7E);
+    const std::size_t start_offset = send_buf->find(0x7E, sent_size);
     if (start_offset == std::string::npos)
     {
       break;
@@ -194,45 +218,30 @@ bool TAPServerConnection::SendAndRemoveAllHDLCFrames(std::string* send_buf)
     const std::size_t end_offset = end_sentinel_offset + 1;
     const std::size_t size = end_offset - start_offset;
 
-    const u8 size_bytes[2] = {static_cast<u8>(size), static_cast<u8>(size >> 8)};
-    if (send(m_fd, reinterpret_cast<const char*>(size_bytes), 2, SEND_FLAGS) != 2)
+    if (!SendWithSize(reinterpret_cast<const u8*>(send_buf->data()) + start_offset, size))
     {
-      ERROR_LOG_FMT(SP1, "SendAndRemoveAllHDLCFrames(): could not write size field");
-      return false;
-    }
-    const int written_bytes =
-        send(m_fd, send_buf->data() + start_offset, static_cast<int>(size), SEND_FLAGS);
-    if (u32(written_bytes) != size)
-    {
-      ERROR_LOG_FMT(SP1,
-                    "SendAndRemoveAllHDLCFrames(): expected to write {} bytes, instead wrote {}",
-                    size, written_bytes);
-      return false;
+      ERROR_LOG_FMT(SP1, "SendAndRemoveAllHDLCFrames(): could not write frame");
+      success = false;
+      break;
     }
-    *send_buf = send_buf->substr(end_offset);
+    sent_size = end_offset;
   }
-  return true;
+  // Drop everything that has been sent at once, rather than after every frame.
+  send_buf->erase(0, sent_size);
+  return success;
 }
 
 bool TAPServerConnection::SendFrame(const u8* frame, u32 size)
 {
-  INFO_LOG_FMT(SP1, "SendFrame {}\n{}", size, ArrayToString(frame, size, 0x10));
-
-  // On Windows, the data pointer is of type const char*; on other systems it is
-  // of type const void*. This is the reason for the reinterpret_cast here and
-  // in the other send/recv calls in this file.
-  const u8 size_bytes[2] = {static_cast<u8>(size), static_cast<u8>(size >> 8)};
-  if (send(m_fd, reinterpret_cast<const char*>(size_bytes), 2, SEND_FLAGS) != 2)
+  if (Common::Log::LogManager::GetInstance()->IsEnabled(Common::Log::LogType::SP1,
+                                                        Common::Log::LogLevel::LINFO))
   {
-    ERROR_LOG_FMT(SP1, "SendFrame(): could not write size field");
-    return false;
+    INFO_LOG_FMT(SP1, "SendFrame {}\n{}", size, ArrayToString(frame, size, 0x10));
   }
-  const int written_bytes =
-      send(m_fd, reinterpret_cast<const char*>(frame), static_cast<ws_ssize_t>(size), SEND_FLAGS);
-  if (u32(written_bytes) != size)
+
+  if (!SendWithSize(frame, size))
   {
-    ERROR_LOG_FMT(SP1, "SendFrame(): expected to write {} bytes, instead wrote {}", size,
-                  written_bytes);
+    ERROR_LOG_FMT(SP1, "SendFrame(): could not write frame");
     return false;
   }
   return true;
@@ -240,18 +249,12 @@ bool TAPServerConnection::SendFrame(const u8* frame, u32 size)
 
 void TAPServerConnection::ReadThreadHandler()
 {
-  enum class ReadState
-  {
-    SIZE,
-    SIZE_HIGH,
-    DATA,
-    SKIP,
-  };
-  ReadState read_state = ReadState::SIZE;
-
-  std::size_t frame_bytes_received = 0;
-  std::size_t frame_bytes_expected = 0;
-  std::string frame_data;
+  // The tapserver protocol is very simple: there is a 16-bit little-endian
+  // size field, followed by that many bytes of packet data.
+  // As much data as is available is read at once, so frames that arrive together only take one
+  // recv call. The buffer can always hold at least one whole frame.
+  std::vector<u8> buffer(0x10000 + 2);
+  std::size_t buffer_size = 0;
 
   while (!m_read_shutdown.IsSet())
   {
@@ -271,94 +274,40 @@ void TAPServerConnection::ReadThreadHandler()
     if (select_res == 0)
       continue;
 
-    // The tapserver protocol is very simple: there is a 16-bit little-endian
-    // size field, followed by that many bytes of packet data
-    switch (read_state)
-    {
-    case ReadState::SIZE:
+    const ws_ssize_t bytes_read =
+        recv(m_fd, reinterpret_cast<char*>(buffer.data() + buffer_size),
+             static_cast<ws_ssize_t>(buffer.size() - buffer_size), 0);
+    if (bytes_read <= 0)
     {
-      u8 size_bytes[2];
-      const ws_ssize_t bytes_read = recv(m_fd, reinterpret_cast<char*>(size_bytes), 2, 0);
-      if (bytes_read == 1)
-      {
-        read_state = ReadState::SIZE_HIGH;
-        frame_bytes_expected = size_bytes[0];
-      }
-      else if (bytes_read == 2)
-      {
-        frame_bytes_expected = size_bytes[0] | (size_bytes[1] << 8);
-        frame_data.resize(frame_bytes_expected, '\0');
-        if (frame_bytes_expected > m_max_frame_size)
-        {
-          ERROR_LOG_FMT(SP1, "Packet is too large ({} bytes); dropping it", frame_bytes_expected);
-          read_state = ReadState::SKIP;
-        }
-        else
-        {
-          // If read is disabled, we still need to actually read the frame in
-          // order to avoid applying backpressure on the remote end, but we
-          // should drop the frame instead of forwarding it to the client.
-          read_state = m_read_enabled.IsSet() ? ReadState::DATA : ReadState::SKIP;
-        }
-      }
-      else
-      {
-        ERROR_LOG_FMT(SP1, "Failed to read size field from destination: {}",
-                      Common::StrNetworkError());
-      }
-      break;
+      ERROR_LOG_FMT(SP1, "Failed to read data from destination: {}", Common::StrNetworkError());
+      continue;
     }
-    case ReadState::SIZE_HIGH:
+    buffer_size += bytes_read;
+
+    std::size_t offset = 0;
+    while (buffer_size - offset >= 2)
     {
-      // This handles the annoying case where only one byte of the size field
-      // was available earlier.
-      u8 size_high = 0;
-      const ws_ssize_t bytes_read = recv(m_fd, reinterpret_cast<char*>(&size_high), 1, 0);
-      if (bytes_read != 1)
-      {
-        ERROR_LOG_FMT(SP1, "Failed to read split size field from destination: {}",
-                      Common::StrNetworkError());
+      const std::size_t frame_size = buffer[offset] | (buffer[offset + 1] << 8);
+      if (buffer_size - offset - 2 < frame_size)
         break;
-      }
-      frame_bytes_expected |= (size_high << 8);
-      frame_data.resize(frame_bytes_expected, '\0');
-      if (frame_bytes_expected > m_max_frame_size)
-      {
-        ERROR_LOG_FMT(SP1, "Packet is too large ({} bytes); dropping it", frame_bytes_expected);
-        read_state = ReadState::SKIP;
-      }
-      else
-      {
-        read_state = m_read_enabled.IsSet() ? ReadState::DATA : ReadState::SKIP;
-      }
-      break;
-    }
-    case ReadState::DATA:
-    case ReadState::SKIP:
-    {
-      const std::size_t bytes_to_read = frame_data.size() - frame_bytes_received;
-      const ws_ssize_t bytes_read = recv(m_fd, frame_data.data() + frame_bytes_received,
-                                         static_cast<ws_ssize_t>(bytes_to_read), 0);
-      if (bytes_read <= 0)
+
+      const char* frame = reinterpret_cast<const char*>(buffer.data() + offset + 2);
+      if (frame_size > m_max_frame_size)
       {
-        ERROR_LOG_FMT(SP1, "Failed to read data from destination: {}", Common::StrNetworkError());
-        break;
+        ERROR_LOG_FMT(SP1, "Packet is too large ({} bytes); dropping it", frame_size);
       }
-      frame_bytes_received += bytes_read;
-      if (frame_bytes_received == frame_bytes_expected)
+      else if (m_read_enabled.IsSet())
       {
-        if (read_state == ReadState::DATA)
-        {
-          m_recv_cb(std::move(frame_data));
-        }
-        frame_data.clear();
-        frame_bytes_received = 0;
-        frame_bytes_expected = 0;
-        read_state = ReadState::SIZE;
+        // If read is disabled, we still need to actually read the frame in
+        // order to avoid applying backpressure on the remote end, but we
+        // should drop the frame instead of forwarding it to the client.
+        m_recv_cb(std::string(frame, frame_size));
       }
-      break;
-    }
+      offset += 2 + frame_size;
     }
+
+    std::memmove(buffer.data(), buffer.data() + offset, buffer_size - offset);
+    buffer_size -= offset;
   }
 }
 
@@ -6,7 +6,9 @@
 #include <functional>
 #include <string>
 #include <thread>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/SocketContext.h"
 
@@ -40,7 +42,9 @@ private:
   std::thread m_read_thread;
   Common::Flag m_read_enabled;
   Common::Flag m_read_shutdown;
+  std::vector<u8> m_send_buffer;
 
+  bool SendWithSize(const u8* data, std::size_t size);
   bool StartReadThread();
   void ReadThreadHandler();
 };
@@ -4,6 +4,7 @@
 #include "Core/HW/EXI/EXI_DeviceEthernet.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
@@ -565,10 +566,13 @@ bool CEXIETHERNET::RecvHandlePacket()
   descriptor = (Descriptor*)write_ptr;
   current_rwp = page_ptr(BBA_RWP);
   DEBUG_LOG_FMT(SP1, "Frame recv: {:x}", mRecvBufferLength);
-  for (u32 i = 0; i < mRecvBufferLength; i++)
+  // Copy as much as fits into each page at once.
+  for (u32 i = 0; i < mRecvBufferLength;)
   {
-    write_ptr[off] = mRecvBuffer[i];
-    off++;
+    const u32 chunk_size = std::min(mRecvBufferLength - i, 0x100 - off);
+    std::memcpy(write_ptr + off, &mRecvBuffer[i], chunk_size);
+    i += chunk_size;
+    off += chunk_size;
     if (off == 0x100)
     {
       off = 0;
@@ -497,6 +497,8 @@ std::vector<u8> Core::GetJoybusResponse()
   {
     std::unique_lock<std::mutex> lock(m_response_mutex);
     m_response_cv.wait(lock, [&] { return m_response_ready; });
+    m_response_ready = false;
+    return m_response;
   }
   m_response_ready = false;
   return m_response;
@@ -538,22 +540,26 @@ void Core::RunCommand(Command& command)
   RunUntil(command.ticks);
   if (!command.sync_only)
   {
-    m_response.clear();
+    // Build the response separately, as the CPU thread may still be copying the previous one
+    // out of m_response in GetJoybusResponse.
+    std::vector<u8> response;
     if (m_link_enabled && !m_force_disconnect)
     {
       int recvd = GBASIOJOYSendCommand(
           &m_sio_driver, static_cast<GBASIOJOYCommand>(command.buffer[0]), &command.buffer[1]);
-      std::copy_n(command.buffer.begin() + 1, recvd, std::back_inserter(m_response));
+      std::copy_n(command.buffer.begin() + 1, recvd, std::back_inserter(response));
     }
 
-    if (m_thread && !m_response_ready)
+    if (m_thread)
     {
       std::lock_guard<std::mutex> response_lock(m_response_mutex);
+      m_response = std::move(response);
       m_response_ready = true;
       m_response_cv.notify_one();
     }
     else
     {
+      m_response = std::move(response);
       m_response_ready = true;
     }
   }
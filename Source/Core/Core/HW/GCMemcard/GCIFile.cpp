@@ -5,6 +5,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
@@ -29,6 +30,21 @@ bool GCIFile::LoadHeader()
   return true;
 }
 
+bool GCIFile::HasValidFileSize() const
+{
+  const u64 size = static_cast<u64>(m_gci_header.m_block_count) * BLOCK_SIZE + DENTRY_SIZE;
+  const u64 file_size = File::GetSize(m_filename);
+  if (file_size != size)
+  {
+    ERROR_LOG_FMT(EXPANSIONINTERFACE,
+                  "{}\nwas not loaded because it is an invalid GCI.\n File size ({:#x}) does not "
+                  "match the size recorded in the header ({:#x})",
+                  m_filename, file_size, size);
+    return false;
+  }
+  return true;
+}
+
 bool GCIFile::LoadSaveBlocks()
 {
   if (m_save_data.empty())
@@ -92,5 +108,7 @@ void GCIFile::DoState(PointerWrap& p)
   p.Do(m_filename);
   p.Do(m_save_data);
   p.Do(m_used_blocks);
+  if (p.IsReadMode())
+    m_dirty_blocks.clear();
 }
 }  // namespace Memcard
@@ -17,6 +17,8 @@ class GCIFile
 {
 public:
   bool LoadHeader();
+  // Checks that the file is as large as its header says, without reading its data.
+  bool HasValidFileSize() const;
   bool LoadSaveBlocks();
   bool HasCopyProtection() const;
   void DoState(PointerWrap& p);
@@ -26,6 +28,9 @@ public:
   std::vector<GCMBlock> m_save_data;
   std::vector<u16> m_used_blocks;
   bool m_dirty = false;
+  // Which save blocks have been written to since the last flush. If the save is dirty and this is
+  // empty, the whole file has to be rewritten.
+  std::vector<bool> m_dirty_blocks;
   std::string m_filename;
 };
 }  // namespace Memcard
@@ -62,7 +62,32 @@ static std::string GenerateDefaultGCIFilename(const Memcard::DEntry& entry,
                                             strip_null(string_decoder(filename))));
 }
 
-bool GCMemcardDirectory::LoadGCI(Memcard::GCIFile gci)
+// Only writes the header and the blocks that have been written to since the last flush. This
+// requires the file on disk to still have the layout of the save.
+static bool WriteDirtyBlocks(const Memcard::GCIFile& save)
+{
+  if (save.m_dirty_blocks.empty() || save.m_filename.empty())
+    return false;
+
+  File::IOFile gci(save.m_filename, "r+b");
+  const u64 size = Memcard::DENTRY_SIZE + u64{Memcard::BLOCK_SIZE} * save.m_save_data.size();
+  if (!gci || gci.GetSize() != size || !gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE))
+    return false;
+
+  for (size_t i = 0; i < save.m_save_data.size() && i < save.m_dirty_blocks.size(); ++i)
+  {
+    if (!save.m_dirty_blocks[i])
+      continue;
+    if (!gci.Seek(Memcard::DENTRY_SIZE + u64{Memcard::BLOCK_SIZE} * i, File::SeekOrigin::Begin) ||
+        !gci.WriteBytes(save.m_save_data[i].m_block.data(), Memcard::BLOCK_SIZE))
+    {
+      return false;
+    }
+  }
+  return gci.Close();
+}
+
+bool GCMemcardDirectory::LoadGCI(Memcard::GCIFile gci, bool load_data)
 {
   // check if any already loaded file has the same internal name as the new file
   for (const Memcard::GCIFile& already_loaded_gci : m_saves)
@@ -90,9 +115,17 @@ bool GCMemcardDirectory::LoadGCI(Memcard::GCIFile gci)
     return false;
   }
 
-  if (!gci.LoadSaveBlocks())
+  // Saves with copy protection have to be patched right away.
+  if (load_data || gci.HasCopyProtection())
+  {
+    if (!gci.LoadSaveBlocks())
+    {
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load data of {}", gci.m_filename);
+      return false;
+    }
+  }
+  else if (!gci.HasValidFileSize())
   {
-    ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load data of {}", gci.m_filename);
     return false;
   }
 
@@ -219,7 +252,7 @@ GCMemcardDirectory::GCMemcardDirectory(const std::string& directory, ExpansionIn
   size_t failed_loads_current_game = 0;
   for (Memcard::GCIFile& gci : gci_current_game)
   {
-    if (!LoadGCI(std::move(gci)))
+    if (!LoadGCI(std::move(gci), true))
     {
       // keep track of how many files failed to load for the current game so we can display a
       // message to the user informing them why some of their saves may not be loaded
@@ -244,7 +277,8 @@ GCMemcardDirectory::GCMemcardDirectory(const std::string& directory, ExpansionIn
     if (free_blocks - gci_blocks < reserved_blocks)
       continue;
 
-    LoadGCI(std::move(gci));
+    // The data of saves for other games is only read once something accesses it.
+    LoadGCI(std::move(gci), false);
   }
 
   if (failed_loads_current_game > 0)
@@ -488,6 +522,7 @@ inline void GCMemcardDirectory::SyncSaves()
                           Memcard::DENTRY_SIZE))
       {
         m_saves[i].m_dirty = true;
+        m_saves[i].m_dirty_blocks.clear();
         const u32 gamecode = Common::swap32(m_saves[i].m_gci_header.m_gamecode.data());
         const u32 new_gamecode = Common::swap32(current->m_dir_entries[i].m_gamecode.data());
         const u32 old_start = m_saves[i].m_gci_header.m_first_block;
@@ -522,6 +557,7 @@ inline void GCMemcardDirectory::SyncSaves()
       m_saves[i].m_save_data.clear();
       m_saves[i].m_used_blocks.clear();
       m_saves[i].m_dirty = true;
+      m_saves[i].m_dirty_blocks.clear();
     }
   }
 }
@@ -551,7 +587,13 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
 
         if (writing)
         {
-          m_saves[i].m_dirty = true;
+          // Saves that only had blocks written to can be updated in place.
+          Memcard::GCIFile& save = m_saves[i];
+          if (!save.m_dirty)
+            save.m_dirty_blocks.assign(save.m_save_data.size(), false);
+          if (!save.m_dirty_blocks.empty())
+            save.m_dirty_blocks[idx] = true;
+          save.m_dirty = true;
         }
 
         m_last_block = block;
@@ -657,8 +699,11 @@ void GCMemcardDirectory::FlushToFile()
           }
           save.m_filename = default_save_name;
         }
-        File::IOFile gci(save.m_filename, "wb");
-        if (gci)
+        if (WriteDirtyBlocks(save))
+        {
+          Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
+        }
+        else if (File::IOFile gci(save.m_filename, "wb"); gci)
         {
           gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
           for (const Memcard::GCMBlock& block : save.m_save_data)
@@ -682,6 +727,7 @@ void GCMemcardDirectory::FlushToFile()
           ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing",
                         save.m_filename);
         }
+        save.m_dirty_blocks.clear();
       }
       else if (save.m_filename.length() != 0)
       {
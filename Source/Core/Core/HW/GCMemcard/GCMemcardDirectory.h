@@ -42,7 +42,8 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
-  bool LoadGCI(Memcard::GCIFile gci);
+  // If load_data is false, the save blocks are only read from the file once they are accessed.
+  bool LoadGCI(Memcard::GCIFile gci, bool load_data);
   inline s32 SaveAreaRW(u32 block, bool writing = false);
   // s32 DirectoryRead(u32 offset, u32 length, u8* dest_address);
   s32 DirectoryWrite(u32 dest_address, u32 length, const u8* src_address);
@@ -3,6 +3,7 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -88,27 +89,52 @@ void GPFifoManager::UpdateGatherPipe()
   auto& memory = system.GetMemory();
   auto& processor_interface = system.GetProcessorInterface();
 
-  size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  const size_t pipe_count = GetGatherPipeCount();
+  size_t processed = 0;
+  while (pipe_count - processed >= GATHER_PIPE_SIZE)
   {
-    // copy the GatherPipe
-    memory.CopyToEmu(processor_interface.m_fifo_cpu_write_pointer, m_gather_pipe + processed,
-                     GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
-
-    // increase the CPUWritePointer
-    if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
-      processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
+    // Copy all the bursts that fit in front of the end of the FIFO in one go. They go straight
+    // into the FIFO in RAM, without looking it up again for each one.
+    const u32 write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+    const u32 fifo_end = processor_interface.m_fifo_cpu_end;
+    size_t num_bursts = (pipe_count - processed) / GATHER_PIPE_SIZE;
+    if (fifo_end >= write_pointer)
+      num_bursts = std::min<size_t>(num_bursts, (fifo_end - write_pointer) / GATHER_PIPE_SIZE + 1);
     else
-      processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
+      num_bursts = 1;
 
-    system.GetCommandProcessor().GatherPipeBursted();
+    const size_t size = num_bursts * GATHER_PIPE_SIZE;
+    if (u8* fifo = memory.GetPointerForRange(write_pointer, size))
+    {
+      std::memcpy(fifo, m_gather_pipe + processed, size);
+    }
+    else
+    {
+      num_bursts = 1;
+      memory.CopyToEmu(write_pointer, m_gather_pipe + processed, GATHER_PIPE_SIZE);
+    }
+
+    for (size_t i = 1; i <= num_bursts; ++i)
+    {
+      processed += GATHER_PIPE_SIZE;
+
+      // increase the CPUWritePointer
+      if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
+        processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
+      else
+        processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
+
+      system.GetCommandProcessor().GatherPipeBursted();
+
+      // If the FIFO was moved, the rest of the bursts have to be copied again.
+      if (processor_interface.m_fifo_cpu_write_pointer != write_pointer + i * GATHER_PIPE_SIZE)
+        break;
+    }
   }
 
   // move back the spill bytes
-  memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count);
-  SetGatherPipeCount(pipe_count);
+  memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count - processed);
+  SetGatherPipeCount(pipe_count - processed);
 }
 
 void GPFifoManager::FastCheckGatherPipe()
@@ -25,6 +25,8 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
 #include "Core/IOS/IOS.h"
+#include "Core/InputLatency.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 
@@ -79,6 +81,8 @@ void Shutdown(Core::System& system)
   system.GetAudioInterface().Shutdown();
 
   State::Shutdown();
+  Rewind::Shutdown();
+  InputLatency::Shutdown();
   system.GetCoreTiming().Shutdown();
 }
 
@@ -3,6 +3,7 @@
 
 #include "Core/HW/MMIO.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "Common/Assert.h"
@@ -167,6 +168,48 @@ WriteHandlingMethod<T>* ComplexWrite(std::function<void(Core::System&, u32, T)>
   return new ComplexHandlingMethod<T>(lambda);
 }
 
+// Function: holds a plain function pointer that is called when a read or a
+// write is executed.
+template <typename T>
+class FunctionHandlingMethod : public ReadHandlingMethod<T>, public WriteHandlingMethod<T>
+{
+public:
+  explicit FunctionHandlingMethod(T (*read_function)(Core::System&, u32))
+      : read_function_(read_function)
+  {
+  }
+
+  explicit FunctionHandlingMethod(void (*write_function)(Core::System&, u32, T))
+      : write_function_(write_function)
+  {
+  }
+
+  virtual ~FunctionHandlingMethod() = default;
+  void AcceptReadVisitor(ReadHandlingMethodVisitor<T>& v) const override
+  {
+    v.VisitFunction(read_function_);
+  }
+
+  void AcceptWriteVisitor(WriteHandlingMethodVisitor<T>& v) const override
+  {
+    v.VisitFunction(write_function_);
+  }
+
+private:
+  T (*read_function_)(Core::System&, u32) = nullptr;
+  void (*write_function_)(Core::System&, u32, T) = nullptr;
+};
+template <typename T>
+ReadHandlingMethod<T>* FunctionRead(T (*function)(Core::System&, u32))
+{
+  return new FunctionHandlingMethod<T>(function);
+}
+template <typename T>
+WriteHandlingMethod<T>* FunctionWrite(void (*function)(Core::System&, u32, T))
+{
+  return new FunctionHandlingMethod<T>(function);
+}
+
 // Invalid: specialization of the complex handling type with lambdas that
 // display error messages.
 template <typename T>
@@ -328,6 +371,8 @@ void ReadHandler<T>::ResetMethod(ReadHandlingMethod<T>* method)
     {
       ret = *lambda;
     }
+
+    void VisitFunction(T (*function)(Core::System&, u32)) override { ret = function; }
   };
 
   FuncCreatorVisitor v;
@@ -403,6 +448,8 @@ void WriteHandler<T>::ResetMethod(WriteHandlingMethod<T>* method)
     {
       ret = *lambda;
     }
+
+    void VisitFunction(void (*function)(Core::System&, u32, T)) override { ret = function; }
   };
 
   FuncCreatorVisitor v;
@@ -416,6 +463,38 @@ void WriteHandler<T>::InitializeInvalid()
   ResetMethod(InvalidWrite<T>());
 }
 
+void Mapping::SetProfilingEnabled(bool enabled)
+{
+  if (enabled)
+    m_access_counts.resize(NUM_MMIOS);
+  else
+    m_access_counts = {};
+}
+
+void Mapping::ClearProfile()
+{
+  std::ranges::fill(m_access_counts, AccessCounts{});
+}
+
+std::vector<std::pair<u32, Mapping::AccessCounts>> Mapping::GetProfile() const
+{
+  std::vector<std::pair<u32, AccessCounts>> profile;
+  for (u32 id = 0; id < m_access_counts.size(); ++id)
+  {
+    const AccessCounts& counts = m_access_counts[id];
+    if (counts.reads == 0 && counts.writes == 0)
+      continue;
+
+    const u32 block = id / BLOCK_SIZE;
+    profile.emplace_back(0x0C000000 | (block << 24) | (id % BLOCK_SIZE), counts);
+  }
+
+  std::ranges::stable_sort(profile, std::ranges::greater{}, [](const auto& entry) {
+    return entry.second.reads + entry.second.writes;
+  });
+  return profile;
+}
+
 // Define all the public specializations that are exported in MMIOHandlers.h.
 #define MaybeExtern
 MMIO_PUBLIC_SPECIALIZATIONS()
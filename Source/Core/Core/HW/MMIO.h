@@ -9,6 +9,8 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -136,15 +138,38 @@ public:
   template <typename Unit>
   Unit Read(Core::System& system, u32 addr)
   {
+    if (!m_access_counts.empty()) [[unlikely]]
+      ++m_access_counts[UniqueID(addr)].reads;
     return GetHandlerForRead<Unit>(addr).Read(system, addr);
   }
 
   template <typename Unit>
   void Write(Core::System& system, u32 addr, Unit val)
   {
+    if (!m_access_counts.empty()) [[unlikely]]
+      ++m_access_counts[UniqueID(addr)].writes;
     GetHandlerForWrite<Unit>(addr).Write(system, addr, val);
   }
 
+  // Access profiling interface.
+  //
+  // While profiling is enabled, every access made through Read() and Write()
+  // is counted per register address. The JITs must not inline MMIO accesses
+  // while profiling, or those accesses won't be counted.
+  struct AccessCounts
+  {
+    u64 reads = 0;
+    u64 writes = 0;
+  };
+
+  void SetProfilingEnabled(bool enabled);
+  bool IsProfilingEnabled() const { return !m_access_counts.empty(); }
+  void ClearProfile();
+
+  // Returns the counts of all accessed registers, the most accessed first.
+  // Addresses are in the 0x0C00xxxx and 0x0D00xxxx ranges.
+  std::vector<std::pair<u32, AccessCounts>> GetProfile() const;
+
   // Handlers access interface.
   //
   // Use when you care more about how to access the MMIO register for an
@@ -186,6 +211,9 @@ private:
   HandlerArray<u16>::Write m_write_handlers16;
   HandlerArray<u32>::Write m_write_handlers32;
 
+  // Indexed by UniqueID(addr). Empty while profiling is disabled.
+  std::vector<AccessCounts> m_access_counts;
+
   // Getter functions for the handler arrays.
   template <typename Unit>
   ReadHandler<Unit>& GetReadHandler(size_t index)
@@ -59,6 +59,14 @@ ReadHandlingMethod<T>* ComplexRead(std::function<T(Core::System&, u32)>);
 template <typename T>
 WriteHandlingMethod<T>* ComplexWrite(std::function<void(Core::System&, u32, T)>);
 
+// Function: same as Complex, for handlers that do not need any captured state.
+// The JIT can call these directly instead of going through std::function, so
+// prefer them for registers that games poll in tight loops.
+template <typename T>
+ReadHandlingMethod<T>* FunctionRead(T (*function)(Core::System&, u32));
+template <typename T>
+WriteHandlingMethod<T>* FunctionWrite(void (*function)(Core::System&, u32, T));
+
 // Invalid: log an error and return -1 in case of a read. These are the default
 // handlers set for all MMIO types.
 template <typename T>
@@ -102,6 +110,7 @@ public:
   virtual void VisitConstant(T value) = 0;
   virtual void VisitDirect(const T* addr, u32 mask) = 0;
   virtual void VisitComplex(const std::function<T(Core::System&, u32)>* lambda) = 0;
+  virtual void VisitFunction(T (*function)(Core::System&, u32)) = 0;
 };
 template <typename T>
 class WriteHandlingMethodVisitor
@@ -110,6 +119,7 @@ public:
   virtual void VisitNop() = 0;
   virtual void VisitDirect(T* addr, u32 mask) = 0;
   virtual void VisitComplex(const std::function<void(Core::System&, u32, T)>* lambda) = 0;
+  virtual void VisitFunction(void (*function)(Core::System&, u32, T)) = 0;
 };
 
 // These classes are INTERNAL. Do not use outside of the MMIO implementation
@@ -190,6 +200,8 @@ private:
       std::function<T(Core::System&, u32)>);                                                       \
   MaybeExtern template WriteHandlingMethod<T>* ComplexWrite<T>(                                    \
       std::function<void(Core::System&, u32, T)>);                                                 \
+  MaybeExtern template ReadHandlingMethod<T>* FunctionRead<T>(T (*)(Core::System&, u32));          \
+  MaybeExtern template WriteHandlingMethod<T>* FunctionWrite<T>(void (*)(Core::System&, u32, T));  \
   MaybeExtern template ReadHandlingMethod<T>* InvalidRead<T>();                                    \
   MaybeExtern template WriteHandlingMethod<T>* InvalidWrite<T>();                                  \
   MaybeExtern template class ReadHandler<T>;                                                       \
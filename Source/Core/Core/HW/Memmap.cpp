@@ -12,13 +12,18 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <span>
 #include <tuple>
 
+#include <xxhash.h>
+
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -50,6 +55,7 @@ MemoryManager::~MemoryManager() = default;
 void MemoryManager::InitMMIO(bool is_wii)
 {
   m_mmio_mapping = std::make_unique<MMIO::Mapping>();
+  m_mmio_mapping->SetProfilingEnabled(Config::Get(Config::MAIN_DEBUG_MMIO_PROFILING));
 
   m_system.GetCommandProcessor().RegisterMMIO(m_mmio_mapping.get(), 0x0C000000);
   m_system.GetPixelEngine().RegisterMMIO(m_mmio_mapping.get(), 0x0C001000);
@@ -109,6 +115,14 @@ void MemoryManager::Init()
   // If MMU is turned off in GameCube mode, turn on fake VMEM hack.
   const bool fake_vmem = !wii && !mmu;
 
+  m_huge_page_size = 0;
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+  {
+    m_huge_page_size = Common::GetHugePageSize();
+    if (m_huge_page_size == 0)
+      WARN_LOG_FMT(MEMMAP, "Huge pages were requested, but this host doesn't provide them");
+  }
+
   u32 mem_size = 0;
   for (PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -117,6 +131,10 @@ void MemoryManager::Init()
     if (!fake_vmem && (region.flags & PhysicalMemoryRegion::FAKE_VMEM))
       continue;
 
+    // A huge page can only back a view if its offset in the segment is aligned as well.
+    if (m_huge_page_size != 0)
+      mem_size = Common::AlignUp(mem_size, m_huge_page_size);
+
     region.shm_position = mem_size;
     region.active = true;
     mem_size += region.size;
@@ -141,6 +159,9 @@ void MemoryManager::Init()
       exit(0);
     }
 
+    if (m_huge_page_size != 0)
+      Common::AdviseHugePages(*region.out_pointer, region.size);
+
     for (u32 i = 0; i < region.size; i += PowerPC::BAT_PAGE_SIZE)
     {
       const size_t index = (i + region.physical_address) >> PowerPC::BAT_INDEX_SHIFT;
@@ -199,7 +220,8 @@ bool MemoryManager::InitFastmemArena()
 
   constexpr size_t ppc_view_size = 0x1'0000'0000;
   constexpr size_t guard_size = 0x8000'0000;
-  constexpr size_t memory_size = ppc_view_size * 2 + guard_size * 3;
+  // With huge pages, the views must be aligned to the huge page size, so reserve room for that.
+  const size_t memory_size = ppc_view_size * 2 + guard_size * 3 + m_huge_page_size;
 
   m_fastmem_arena = m_arena.ReserveMemoryRegion(memory_size);
   if (!m_fastmem_arena)
@@ -209,7 +231,12 @@ bool MemoryManager::InitFastmemArena()
   }
 
   m_physical_base = m_fastmem_arena + guard_size;
-  m_logical_base = m_fastmem_arena + ppc_view_size + guard_size * 2;
+  if (m_huge_page_size != 0)
+  {
+    m_physical_base = reinterpret_cast<u8*>(
+        Common::AlignUp(reinterpret_cast<uintptr_t>(m_physical_base), m_huge_page_size));
+  }
+  m_logical_base = m_physical_base + ppc_view_size + guard_size;
 
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -226,10 +253,21 @@ bool MemoryManager::InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+
+    if (m_huge_page_size != 0)
+      Common::AdviseHugePages(view, region.size);
   }
 
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (region.active)
+      ProtectDCacheTrackedPages(m_physical_base + region.physical_address,
+                                region.physical_address, region.size);
+  }
+
   return true;
 }
 
@@ -279,7 +317,9 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
+            ProtectDCacheTrackedPages(static_cast<u8*>(mapped_pointer), intersection_start,
+                                      mapped_size);
           }
 
           m_logical_page_mappings[i] =
@@ -290,6 +330,121 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+void MemoryManager::SetDCacheTrackingEnabled(bool enabled)
+{
+  if (enabled == m_dcache_tracking_enabled)
+    return;
+
+  if (!enabled)
+  {
+    for (size_t i = 0; i < m_dcache_tracked_pages.size(); ++i)
+    {
+      if (m_dcache_tracked_pages[i])
+        SetFastmemPageAccessible(GetDCacheTrackedPageAddress(i), true);
+    }
+  }
+
+  m_dcache_tracking_enabled = enabled;
+  const size_t num_pages = (m_ram_size + m_exram_size) / DCACHE_TRACKING_PAGE_SIZE;
+  m_dcache_tracked_pages.assign(enabled ? num_pages : 0, false);
+  m_num_dcache_tracked_pages = 0;
+}
+
+size_t MemoryManager::GetDCacheTrackingIndex(u32 address) const
+{
+  if ((address & 0xF8000000) == 0x00000000)
+    return (address & m_ram_mask) / DCACHE_TRACKING_PAGE_SIZE;
+  if (m_exram && (address >> 28) == 0x1 && (address & 0x0FFFFFFF) < m_exram_size_real)
+    return (m_ram_size + (address & 0x0FFFFFFF)) / DCACHE_TRACKING_PAGE_SIZE;
+  return NOT_DCACHE_TRACKABLE;
+}
+
+u32 MemoryManager::GetDCacheTrackedPageAddress(size_t index) const
+{
+  const u32 offset = static_cast<u32>(index * DCACHE_TRACKING_PAGE_SIZE);
+  return offset < m_ram_size ? offset : 0x10000000 + (offset - m_ram_size);
+}
+
+bool MemoryManager::IsDCacheTrackedPage(u32 address) const
+{
+  const size_t index = GetDCacheTrackingIndex(address);
+  return index < m_dcache_tracked_pages.size() && m_dcache_tracked_pages[index];
+}
+
+void MemoryManager::TrackDCachePage(u32 address)
+{
+  const size_t index = GetDCacheTrackingIndex(address);
+  if (index >= m_dcache_tracked_pages.size() || m_dcache_tracked_pages[index])
+    return;
+
+  m_dcache_tracked_pages[index] = true;
+  ++m_num_dcache_tracked_pages;
+  SetFastmemPageAccessible(GetDCacheTrackedPageAddress(index), false);
+}
+
+void MemoryManager::TrackDCacheRange(u32 address, size_t size)
+{
+  const u32 end = address + static_cast<u32>(size);
+  for (u32 page = Common::AlignDown(address, DCACHE_TRACKING_PAGE_SIZE); page < end;
+       page += DCACHE_TRACKING_PAGE_SIZE)
+  {
+    TrackDCachePage(page);
+  }
+}
+
+size_t MemoryManager::GetFastmemProtectionPageSize()
+{
+  // If the host's pages are larger than ours, the neighbours of a tracked page take the slow path
+  // as well. That's only slower, since they don't use the data cache there.
+  return std::max<size_t>(Common::GetPageSize(), DCACHE_TRACKING_PAGE_SIZE);
+}
+
+void MemoryManager::ProtectDCacheTrackedPages(u8* view, u32 physical_address, u32 size)
+{
+  if (m_num_dcache_tracked_pages == 0)
+    return;
+
+  // Newly mapped views have the default protection, so the tracked pages in them have to be made
+  // inaccessible again.
+  const size_t page_size = GetFastmemProtectionPageSize();
+  for (u32 offset = 0; offset < size; offset += page_size)
+  {
+    for (u32 i = 0; i < page_size; i += DCACHE_TRACKING_PAGE_SIZE)
+    {
+      if (IsDCacheTrackedPage(physical_address + offset + i))
+      {
+        Common::ReadProtectMemory(view + offset, page_size);
+        break;
+      }
+    }
+  }
+}
+
+void MemoryManager::SetFastmemPageAccessible(u32 address, bool accessible)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  const size_t page_size = GetFastmemProtectionPageSize();
+  const u32 page_address = Common::AlignDown(address, page_size);
+  const auto apply = [&](u8* pointer) {
+    if (accessible)
+      Common::UnWriteProtectMemory(pointer, page_size);
+    else
+      Common::ReadProtectMemory(pointer, page_size);
+  };
+
+  apply(m_physical_base + page_address);
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    if (page_address >= entry.physical_address &&
+        page_address - entry.physical_address < entry.mapped_size)
+    {
+      apply(static_cast<u8*>(entry.mapped_pointer) + (page_address - entry.physical_address));
+    }
+  }
+}
+
 void MemoryManager::DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -328,21 +483,129 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  // A full state replaces whatever the current base was.
+  if (p.IsReadMode() && !p.IsIncremental())
+  {
+    for (PageTracker& tracker : m_page_trackers)
+      tracker.base_hashes.clear();
+  }
+
+  // The video backend can write to RAM earlier in DoState, so the changed pages can't be found
+  // any sooner than this. Saving always measures the state before writing it, and both passes
+  // have to see the same pages.
+  if (p.IsIncremental() && p.IsMeasureMode())
+    FindChangedPages();
+
+  const auto regions = GetTrackedRegions();
+  const auto do_region = [&](size_t index) {
+    if (p.IsIncremental())
+      DoIncrementalArray(p, regions[index], m_page_trackers[index]);
+    else
+      p.DoLiveArray(regions[index].data(), static_cast<u32>(regions[index].size()));
+  };
+
+  do_region(0);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
-    p.DoArray(m_fake_vmem, current_fake_vmem_size);
+    do_region(1);
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+    do_region(2);
   p.DoMarker("Memory EXRAM");
 }
 
+std::array<std::span<u8>, 3> MemoryManager::GetTrackedRegions() const
+{
+  return {std::span<u8>(m_ram, GetRamSize()),
+          std::span<u8>(m_fake_vmem, m_fake_vmem ? GetFakeVMemSize() : 0),
+          std::span<u8>(m_exram, m_exram ? GetExRamSize() : 0)};
+}
+
+void MemoryManager::SetIncrementalBase()
+{
+  const auto regions = GetTrackedRegions();
+  for (size_t i = 0; i < regions.size(); ++i)
+  {
+    PageTracker& tracker = m_page_trackers[i];
+    tracker.base_hashes.resize(regions[i].size() / INCREMENTAL_PAGE_SIZE);
+    for (size_t page = 0; page < tracker.base_hashes.size(); ++page)
+    {
+      tracker.base_hashes[page] =
+          XXH3_64bits(regions[i].data() + page * INCREMENTAL_PAGE_SIZE, INCREMENTAL_PAGE_SIZE);
+    }
+  }
+}
+
+void MemoryManager::FindChangedPages()
+{
+  const auto regions = GetTrackedRegions();
+  for (size_t i = 0; i < regions.size(); ++i)
+  {
+    PageTracker& tracker = m_page_trackers[i];
+    const u32 page_count = static_cast<u32>(regions[i].size() / INCREMENTAL_PAGE_SIZE);
+    const bool has_base = tracker.base_hashes.size() == page_count;
+
+    // Without a base, every page has to be included.
+    tracker.changed_pages.clear();
+    for (u32 page = 0; page < page_count; ++page)
+    {
+      if (!has_base || XXH3_64bits(regions[i].data() + page * INCREMENTAL_PAGE_SIZE,
+                                   INCREMENTAL_PAGE_SIZE) != tracker.base_hashes[page])
+      {
+        tracker.changed_pages.push_back(page);
+      }
+    }
+  }
+}
+
+void MemoryManager::DoIncrementalArray(PointerWrap& p, std::span<u8> region, PageTracker& tracker)
+{
+  std::vector<u32> pages = tracker.changed_pages;
+  p.Do(pages);
+
+  for (const u32 page : pages)
+  {
+    if (page >= region.size() / INCREMENTAL_PAGE_SIZE)
+    {
+      p.SetVerifyMode();
+      return;
+    }
+    p.DoArray(region.data() + page * INCREMENTAL_PAGE_SIZE, INCREMENTAL_PAGE_SIZE);
+  }
+}
+
+void MemoryManager::LogHugePageUsage(bool fastmem) const
+{
+  size_t total_size = 0;
+  size_t backed_size = 0;
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active)
+      continue;
+
+    const u8* view = fastmem ? m_physical_base + region.physical_address : *region.out_pointer;
+    const std::optional<size_t> region_backed_size =
+        Common::GetHugePageBackedSize(view, region.size);
+    if (!region_backed_size)
+      return;
+
+    total_size += region.size;
+    backed_size += *region_backed_size;
+  }
+
+  NOTICE_LOG_FMT(MEMMAP, "Huge pages backed {} of {} MiB of the {} views of emulated memory",
+                 backed_size >> 20, total_size >> 20, fastmem ? "fastmem" : "regular");
+}
+
 void MemoryManager::Shutdown()
 {
+  SetDCacheTrackingEnabled(false);
   ShutdownFastmemArena();
 
+  if (m_huge_page_size != 0)
+    LogHugePageUsage(false);
+
   m_is_initialized = false;
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -353,15 +616,33 @@ void MemoryManager::Shutdown()
     *region.out_pointer = nullptr;
   }
   m_arena.ReleaseSHMSegment();
+  if (m_mmio_mapping && m_mmio_mapping->IsProfilingEnabled())
+    LogMMIOProfile();
   m_mmio_mapping.reset();
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
 
+void MemoryManager::LogMMIOProfile() const
+{
+  constexpr size_t MAX_LOGGED_REGISTERS = 16;
+
+  const auto profile = m_mmio_mapping->GetProfile();
+  NOTICE_LOG_FMT(MEMMAP, "Most accessed MMIO registers:");
+  for (size_t i = 0; i < profile.size() && i < MAX_LOGGED_REGISTERS; ++i)
+  {
+    const auto& [address, counts] = profile[i];
+    NOTICE_LOG_FMT(MEMMAP, "  {:08x}: {} reads, {} writes", address, counts.reads, counts.writes);
+  }
+}
+
 void MemoryManager::ShutdownFastmemArena()
 {
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  if (m_huge_page_size != 0)
+    LogHugePageUsage(true);
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -446,6 +727,9 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+
+  if (m_dcache_tracking_enabled)
+    TrackDCacheRange(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -460,6 +744,9 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+
+  if (m_dcache_tracking_enabled)
+    TrackDCacheRange(address, size);
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
@@ -54,6 +54,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -99,8 +100,22 @@ public:
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
 
+  // Incremental savestates only contain the pages of RAM, EXRAM and FakeVMem that changed since
+  // the state that was saved or loaded last time SetIncrementalBase was called.
+  void SetIncrementalBase();
+
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // With hybrid data cache emulation, the data cache is only emulated for the pages of RAM and
+  // EXRAM that cache maintenance instructions or DMA have been seen on. Those pages stay tracked
+  // until tracking is disabled, and are made inaccessible in the fastmem arena, so that fastmem
+  // accesses to them fault and get backpatched to the slow path. Addresses are physical.
+  void SetDCacheTrackingEnabled(bool enabled);
+  bool IsDCacheTrackingEnabled() const { return m_dcache_tracking_enabled; }
+  bool IsDCacheTrackedPage(u32 address) const;
+  void TrackDCachePage(u32 address);
+  size_t GetNumDCacheTrackedPages() const { return m_num_dcache_tracked_pages; }
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -156,6 +171,28 @@ public:
   }
 
 private:
+  static constexpr u32 INCREMENTAL_PAGE_SIZE = 0x1000;
+
+  struct PageTracker
+  {
+    std::vector<u64> base_hashes;
+    std::vector<u32> changed_pages;
+  };
+
+  std::array<std::span<u8>, 3> GetTrackedRegions() const;
+  void FindChangedPages();
+  void DoIncrementalArray(PointerWrap& p, std::span<u8> region, PageTracker& tracker);
+
+  static constexpr u32 DCACHE_TRACKING_PAGE_SIZE = 0x1000;
+  static constexpr size_t NOT_DCACHE_TRACKABLE = ~size_t(0);
+
+  static size_t GetFastmemProtectionPageSize();
+  size_t GetDCacheTrackingIndex(u32 address) const;
+  u32 GetDCacheTrackedPageAddress(size_t index) const;
+  void TrackDCacheRange(u32 address, size_t size);
+  void ProtectDCacheTrackedPages(u8* view, u32 physical_address, u32 size);
+  void SetFastmemPageAccessible(u32 address, bool accessible);
+
   // Base is a pointer to the base of the memory map. Yes, some MMU tricks
   // are used to set up a full GC or Wii memory map in process memory.
   // In 64-bit, this might point to "high memory" (above the 32-bit limit),
@@ -196,11 +233,22 @@ private:
 
   bool m_is_fastmem_arena_initialized = false;
 
+  // Non-zero if the MemArena views are backed by transparent huge pages of this size.
+  size_t m_huge_page_size = 0;
+
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
   bool m_is_initialized = false;
   // END STATE_TO_SAVE
 
+  // One for each of GetTrackedRegions.
+  std::array<PageTracker, 3> m_page_trackers;
+
+  bool m_dcache_tracking_enabled = false;
+  // Indexed by GetDCacheTrackingIndex.
+  std::vector<bool> m_dcache_tracked_pages;
+  size_t m_num_dcache_tracked_pages = 0;
+
   // MMIO mapping object.
   std::unique_ptr<MMIO::Mapping> m_mmio_mapping;
 
@@ -255,5 +303,7 @@ private:
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void LogHugePageUsage(bool fastmem) const;
+  void LogMMIOProfile() const;
 };
 }  // namespace Memory
@@ -10,6 +10,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/GCPad.h"
+#include "Core/InputLatency.h"
 #include "Core/NetPlayProto.h"
 #include "Core/System.h"
 #include "InputCommon/GCAdapter.h"
@@ -36,10 +37,13 @@ GCPadStatus CSIDevice_GCAdapter::GetPadStatus()
   // the remote controllers receive their status there as well
   if (!NetPlay::IsNetPlayRunning())
   {
+    // The adapter is read continuously on its own thread, so its input is as new as it gets.
     pad_status = GCAdapter::Input(m_device_number);
+    InputLatency::OnLocalInput(m_device_number, pad_status, InputLatency::Clock::now());
   }
 
   HandleMoviePadStatus(m_system.GetMovie(), m_device_number, &pad_status);
+  InputLatency::OnPoll(m_device_number, pad_status);
 
   // Our GCAdapter code sets PAD_GET_ORIGIN when a new device has been connected.
   // Watch for this to calibrate real controllers on connection.
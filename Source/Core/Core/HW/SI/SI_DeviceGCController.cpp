@@ -17,9 +17,11 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SI/SI_Device.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/InputLatency.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/System.h"
+#include "InputCommon/ControllerInterface/ControllerInterface.h"
 #include "InputCommon/GCPadStatus.h"
 
 namespace SerialInterface
@@ -152,9 +154,12 @@ GCPadStatus CSIDevice_GCController::GetPadStatus()
   if (!NetPlay::IsNetPlayRunning())
   {
     pad_status = Pad::GetStatus(m_device_number);
+    InputLatency::OnLocalInput(m_device_number, pad_status,
+                               g_controller_interface.GetLastInputUpdateTime());
   }
 
   HandleMoviePadStatus(m_system.GetMovie(), m_device_number, &pad_status);
+  InputLatency::OnPoll(m_device_number, pad_status);
 
   // Our GCAdapter code sets PAD_GET_ORIGIN when a new device has been connected.
   // Watch for this to calibrate real controllers on connection.
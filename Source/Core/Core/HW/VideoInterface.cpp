@@ -26,11 +26,13 @@
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/InputLatency.h"
 #include "Core/Movie.h"
 #include "Core/System.h"
 
 #include "DiscIO/Enums.h"
 
+#include "VideoCommon/LatencyLimiter.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -262,28 +264,28 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   // XFB related MMIOs that require special handling on writes.
   mmio->Register(base | VI_FB_LEFT_TOP_HI, MMIO::DirectRead<u16>(&m_xfb_info_top.Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_xfb_info_top.Hi = val;
                    if (vi.m_xfb_info_top.CLRPOFF)
                      vi.m_xfb_info_top.POFF = 0;
                  }));
   mmio->Register(base | VI_FB_LEFT_BOTTOM_HI, MMIO::DirectRead<u16>(&m_xfb_info_bottom.Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_xfb_info_bottom.Hi = val;
                    if (vi.m_xfb_info_bottom.CLRPOFF)
                      vi.m_xfb_info_bottom.POFF = 0;
                  }));
   mmio->Register(base | VI_FB_RIGHT_TOP_HI, MMIO::DirectRead<u16>(&m_xfb_3d_info_top.Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_xfb_3d_info_top.Hi = val;
                    if (vi.m_xfb_3d_info_top.CLRPOFF)
                      vi.m_xfb_3d_info_top.POFF = 0;
                  }));
   mmio->Register(base | VI_FB_RIGHT_BOTTOM_HI, MMIO::DirectRead<u16>(&m_xfb_3d_info_bottom.Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_xfb_3d_info_bottom.Hi = val;
                    if (vi.m_xfb_3d_info_bottom.CLRPOFF)
@@ -292,17 +294,17 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   // MMIOs with unimplemented writes that trigger warnings.
   mmio->Register(
-      base | VI_VERTICAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+      base | VI_VERTICAL_BEAM_POSITION, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
         auto& vi = system.GetVideoInterface();
-        return 1 + (vi.m_half_line_count) / 2;
+        return static_cast<u16>(1 + (vi.m_half_line_count) / 2);
       }),
-      MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+      MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
         WARN_LOG_FMT(
             VIDEOINTERFACE,
             "Changing vertical beam position to {:#06x} - not documented or implemented yet", val);
       }));
   mmio->Register(
-      base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+      base | VI_HORIZONTAL_BEAM_POSITION, MMIO::FunctionRead<u16>([](Core::System& system, u32) {
         auto& vi = system.GetVideoInterface();
         u16 value = static_cast<u16>(
             1 + vi.m_h_timing_0.HLW *
@@ -310,7 +312,7 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                     (vi.GetTicksPerHalfLine()));
         return std::clamp<u16>(value, 1, vi.m_h_timing_0.HLW * 2);
       }),
-      MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+      MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
         WARN_LOG_FMT(
             VIDEOINTERFACE,
             "Changing horizontal beam position to {:#06x} - not documented or implemented yet",
@@ -320,27 +322,27 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // The following MMIOs are interrupts related and update interrupt status
   // on writes.
   mmio->Register(base | VI_PRERETRACE_HI, MMIO::DirectRead<u16>(&m_interrupt_register[0].Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_interrupt_register[0].Hi = val;
                    vi.UpdateInterrupts();
                  }));
   mmio->Register(base | VI_POSTRETRACE_HI, MMIO::DirectRead<u16>(&m_interrupt_register[1].Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_interrupt_register[1].Hi = val;
                    vi.UpdateInterrupts();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_2_HI,
                  MMIO::DirectRead<u16>(&m_interrupt_register[2].Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_interrupt_register[2].Hi = val;
                    vi.UpdateInterrupts();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_3_HI,
                  MMIO::DirectRead<u16>(&m_interrupt_register[3].Hi),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
                    vi.m_interrupt_register[3].Hi = val;
                    vi.UpdateInterrupts();
@@ -371,7 +373,7 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // Control register writes only updates some select bits, and additional
   // processing needs to be done if a reset is requested.
   mmio->Register(base | VI_CONTROL_REGISTER, MMIO::DirectRead<u16>(&m_display_control_register.Hex),
-                 MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
+                 MMIO::FunctionWrite<u16>([](Core::System& system, u32, u16 val) {
                    auto& vi = system.GetVideoInterface();
 
                    UVIDisplayControlRegister tmpConfig(val);
@@ -757,6 +759,8 @@ void VideoInterfaceManager::LogField(FieldType field, u32 xfb_address) const
 
 void VideoInterfaceManager::OutputField(FieldType field, u64 ticks)
 {
+  m_system.GetCoreTiming().ThrottleFieldOutput(static_cast<s64>(ticks));
+
   // Could we fit a second line of data in the stride?
   // (Datel's Wii FreeLoaders are the only titles known to set WPL to 0)
   bool potentially_interlaced_xfb =
@@ -819,7 +823,11 @@ void VideoInterfaceManager::OutputField(FieldType field, u64 ticks)
   // can change the register values during scanout. To correctly emulate the scanout process, we
   // would need to collate all changes to the VI registers during scanout.
   if (xfbAddr)
+  {
+    g_latency_limiter.OnFieldOutput(ticks);
     g_video_backend->Video_OutputXFB(xfbAddr, fbWidth, fbStride, fbHeight, ticks);
+    InputLatency::OnFieldOutput();
+  }
 }
 
 void VideoInterfaceManager::BeginField(FieldType field, u64 ticks)
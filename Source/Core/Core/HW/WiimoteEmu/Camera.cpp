@@ -97,6 +97,20 @@ CameraLogic::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 fie
   return camera_points;
 }
 
+const std::array<CameraPoint, CameraLogic::NUM_POINTS>&
+CameraPointsCache::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 field_of_view)
+{
+  if (!m_is_valid || transform.data != m_transform.data || field_of_view != m_field_of_view)
+  {
+    m_camera_points = CameraLogic::GetCameraPoints(transform, field_of_view);
+    m_transform = transform;
+    m_field_of_view = field_of_view;
+    m_is_valid = true;
+  }
+
+  return m_camera_points;
+}
+
 void CameraLogic::Update(const std::array<CameraPoint, NUM_POINTS>& camera_points)
 {
   // IR data is read from offset 0x37 on real hardware.
@@ -185,4 +185,19 @@ private:
   // Change is triggered by wiimote report 0x13.
   bool m_is_enabled = false;
 };
+
+// Remembers the last result of CameraLogic::GetCameraPoints.
+// The points don't change while the Wiimote is held still, so the projection can be skipped.
+class CameraPointsCache
+{
+public:
+  const std::array<CameraPoint, CameraLogic::NUM_POINTS>&
+  GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 field_of_view);
+
+private:
+  Common::Matrix44 m_transform{};
+  Common::Vec2 m_field_of_view{};
+  std::array<CameraPoint, CameraLogic::NUM_POINTS> m_camera_points{};
+  bool m_is_valid = false;
+};
 }  // namespace WiimoteEmu
@@ -508,7 +508,7 @@ void Wiimote::BuildDesiredWiimoteState(DesiredWiimoteState* target_state,
   }
   else if (sensor_bar_state == SensorBarState::Enabled)
   {
-    target_state->camera_points = CameraLogic::GetCameraPoints(
+    target_state->camera_points = m_camera_points_cache.GetCameraPoints(
         GetTotalTransformation(),
         Common::Vec2(m_fov_x_setting.GetValue(), m_fov_y_setting.GetValue()) / 360 *
             float(MathUtil::TAU));
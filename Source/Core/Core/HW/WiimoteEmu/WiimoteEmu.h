@@ -315,6 +315,7 @@ private:
   SpeakerLogic m_speaker_logic;
   MotionPlus m_motion_plus;
   CameraLogic m_camera_logic;
+  CameraPointsCache m_camera_points_cache;
 
   I2CBus m_i2c_bus;
 
@@ -237,7 +237,7 @@ void Wiimote::ResetDataReporting()
 
 void Wiimote::ClearReadQueue()
 {
-  Report rpt;
+  InputReport rpt;
 
   // The "Clear" function isn't thread-safe :/
   while (m_read_reports.Pop(rpt))
@@ -250,12 +250,14 @@ void Wiimote::EventLinked()
   m_is_linked = true;
 
   ClearReadQueue();
+  ResetReportStats();
   ResetDataReporting();
   EnablePowerAssertionInternal();
 }
 
 void Wiimote::EventUnlinked()
 {
+  LogReportStats();
   if (m_really_disconnect)
     DisconnectInternal();
   else
@@ -324,31 +326,35 @@ void Wiimote::Read()
 
     // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+    m_read_reports.Push(InputReport{std::move(rpt), Clock::now()});
+    m_input_report_count.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
 bool Wiimote::Write()
 {
-  // nothing written, but this is not an error
-  if (m_write_reports.Empty())
-    return true;
-
-  Report const& rpt = m_write_reports.Front();
-
-  if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+  // Send everything that has been queued, so that reports queued together don't each need
+  // another pass through the thread loop and a wakeup of the read.
+  while (!m_write_reports.Empty())
   {
-    static sf::UdpSocket Socket;
-    Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost, m_balance_board_dump_port);
-  }
-  int ret = IOWrite(rpt.data(), rpt.size());
+    Report const& rpt = m_write_reports.Front();
+
+    if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+    {
+      static sf::UdpSocket Socket;
+      Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost,
+                  m_balance_board_dump_port);
+    }
+    int ret = IOWrite(rpt.data(), rpt.size());
 
-  m_write_reports.Pop();
+    m_write_reports.Pop();
 
-  if (!m_write_reports.Empty())
-    IOWakeup();
+    if (ret == 0)
+      return false;
+    m_output_report_count.fetch_add(1, std::memory_order_relaxed);
+  }
 
-  return ret != 0;
+  return true;
 }
 
 bool Wiimote::IsBalanceBoard()
@@ -435,7 +441,63 @@ static bool IsDataReport(const Report& rpt)
 
 bool Wiimote::GetNextReport(Report* report)
 {
-  return m_read_reports.Pop(*report);
+  InputReport input_report;
+  if (!m_read_reports.Pop(input_report))
+    return false;
+
+  const u64 latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                             Clock::now() - input_report.time)
+                             .count();
+  m_consumed_report_count.fetch_add(1, std::memory_order_relaxed);
+  m_total_latency_us.fetch_add(latency_us, std::memory_order_relaxed);
+  if (latency_us > m_max_latency_us.load(std::memory_order_relaxed))
+    m_max_latency_us.store(latency_us, std::memory_order_relaxed);
+
+  *report = std::move(input_report.report);
+  return true;
+}
+
+double ReportStats::GetInputReportRate() const
+{
+  return seconds_linked > 0 ? input_reports / seconds_linked : 0;
+}
+
+double ReportStats::GetAverageLatencyUs() const
+{
+  return consumed_reports ? double(total_latency_us) / consumed_reports : 0;
+}
+
+ReportStats Wiimote::GetReportStats() const
+{
+  ReportStats stats;
+  stats.input_reports = m_input_report_count.load(std::memory_order_relaxed);
+  stats.output_reports = m_output_report_count.load(std::memory_order_relaxed);
+  stats.consumed_reports = m_consumed_report_count.load(std::memory_order_relaxed);
+  stats.total_latency_us = m_total_latency_us.load(std::memory_order_relaxed);
+  stats.max_latency_us = m_max_latency_us.load(std::memory_order_relaxed);
+  const Clock::time_point linked_time{Clock::duration{m_linked_time.load()}};
+  stats.seconds_linked = std::chrono::duration<double>(Clock::now() - linked_time).count();
+  return stats;
+}
+
+void Wiimote::ResetReportStats()
+{
+  m_input_report_count = 0;
+  m_output_report_count = 0;
+  m_consumed_report_count = 0;
+  m_total_latency_us = 0;
+  m_max_latency_us = 0;
+  m_linked_time = Clock::now().time_since_epoch().count();
+}
+
+void Wiimote::LogReportStats() const
+{
+  const ReportStats stats = GetReportStats();
+  INFO_LOG_FMT(WIIMOTE,
+               "Wii Remote {}: {} input reports ({:.1f} per second), {} output reports, "
+               "{:.0f} us average and {} us max input latency",
+               m_index + 1, stats.input_reports, stats.GetInputReportRate(), stats.output_reports,
+               stats.GetAverageLatencyUs(), stats.max_latency_us);
 }
 
 // Returns the next report that should be sent
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -44,6 +45,21 @@ constexpr u8 WR_SET_REPORT = 0xA0;
 constexpr u8 BT_INPUT = 0x01;
 constexpr u8 BT_OUTPUT = 0x02;
 
+struct ReportStats
+{
+  // Input reports received from the remote and output reports sent to it since it was linked.
+  u64 input_reports = 0;
+  u64 output_reports = 0;
+  double seconds_linked = 0;
+  // How long input reports waited between being received and being consumed.
+  u64 consumed_reports = 0;
+  u64 total_latency_us = 0;
+  u64 max_latency_us = 0;
+
+  double GetInputReportRate() const;
+  double GetAverageLatencyUs() const;
+};
+
 class Wiimote : public WiimoteCommon::HIDWiimote
 {
 public:
@@ -60,6 +76,9 @@ public:
 
   bool GetNextReport(Report* report);
 
+  // Can be called from any thread.
+  ReportStats GetReportStats() const;
+
   bool IsBalanceBoard();
 
   void InterruptDataOutput(const u8* data, const u32 size) override;
@@ -108,8 +127,17 @@ protected:
   u8 m_bt_device_index = 0;
 
 private:
+  using Clock = std::chrono::steady_clock;
+  struct InputReport
+  {
+    Report report;
+    Clock::time_point time;
+  };
+
   void Read();
   bool Write();
+  void ResetReportStats();
+  void LogReportStats() const;
 
   void StartThread();
   void StopThread();
@@ -153,9 +181,16 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
+  Common::SPSCQueue<InputReport> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
 
+  std::atomic<u64> m_input_report_count = 0;
+  std::atomic<u64> m_output_report_count = 0;
+  std::atomic<u64> m_consumed_report_count = 0;
+  std::atomic<u64> m_total_latency_us = 0;
+  std::atomic<u64> m_max_latency_us = 0;
+  std::atomic<Clock::rep> m_linked_time = 0;
+
   bool m_speaker_enabled_in_dolphin_config = false;
   int m_balance_board_dump_port = 0;
 
@@ -27,6 +27,7 @@ enum Hotkey
   HK_RESET,
   HK_FULLSCREEN,
   HK_SCREENSHOT,
+  HK_CAPTURE_FRAME_TRACE,
   HK_EXIT,
   HK_UNLOCK_CURSOR,
   HK_CENTER_MOUSE,
@@ -169,6 +170,7 @@ enum Hotkey
   HK_LOAD_STATE_FILE,
   HK_INCREMENT_SELECTED_STATE_SLOT,
   HK_DECREMENT_SELECTED_STATE_SLOT,
+  HK_REWIND,
 
   HK_GBA_LOAD,
   HK_GBA_UNLOAD,
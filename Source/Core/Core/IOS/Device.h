@@ -211,6 +211,12 @@ public:
   virtual DeviceType GetDeviceType() const { return m_device_type; }
   virtual bool IsOpened() const { return m_is_active; }
 
+  const IPCStats& GetIPCStats() const { return m_ipc_stats; }
+  void AddToIPCStats(IPCCommandType command, u64 host_time_us)
+  {
+    m_ipc_stats.Add(command, host_time_us);
+  }
+
 protected:
   Kernel& m_ios;
 
@@ -221,6 +227,8 @@ protected:
 
 private:
   std::optional<IPCReply> Unsupported(const Request& request);
+
+  IPCStats m_ipc_stats;
 };
 
 // Helper class for Devices that we know are only ever instantiated under an EmulationKernel.
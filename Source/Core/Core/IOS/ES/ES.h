@@ -103,6 +103,10 @@ public:
   std::vector<ES::Content>
   GetStoredContentsFromTMD(const ES::TMDReader& tmd,
                            CheckContentHashes check_content_hashes = CheckContentHashes::No) const;
+  // Forgets which installed contents GetStoredContentsFromTMD has found to match their hashes.
+  // This happens automatically when ES changes any contents, but has to be done manually when the
+  // NAND is changed in some other way.
+  static void InvalidateVerifiedContents();
   u32 GetSharedContentsCount() const;
   std::vector<std::array<u8, 20>> GetSharedContents() const;
 
@@ -7,6 +7,9 @@
 #include <array>
 #include <cctype>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -15,6 +18,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/NandPaths.h"
 #include "Common/ScopeGuard.h"
@@ -25,6 +29,46 @@
 
 namespace IOS::HLE
 {
+namespace
+{
+// Contents that have been hashed and found to match their TMD, so that checking the same title
+// again (e.g. every time a WAD is booted) doesn't have to read and hash all of it again. This is
+// shared by all kernels, as temporary ones are created for WAD installs. Only host-side work is
+// skipped; nothing here affects emulated timings.
+struct VerifiedContent
+{
+  Common::SHA1::Digest sha1;
+  u64 size;
+};
+std::mutex s_verified_contents_mutex;
+std::map<std::string, VerifiedContent> s_verified_contents;
+
+std::string GetVerifiedContentKey(const std::string& path)
+{
+  return File::GetUserPath(D_SESSION_WIIROOT_IDX) + path;
+}
+
+bool IsVerifiedContent(const std::string& path, const ES::Content& content, u64 size)
+{
+  std::lock_guard lk(s_verified_contents_mutex);
+  const auto it = s_verified_contents.find(GetVerifiedContentKey(path));
+  return it != s_verified_contents.end() && it->second.sha1 == content.sha1 &&
+         it->second.size == size;
+}
+
+void AddVerifiedContent(const std::string& path, const ES::Content& content, u64 size)
+{
+  std::lock_guard lk(s_verified_contents_mutex);
+  s_verified_contents[GetVerifiedContentKey(path)] = {content.sha1, size};
+}
+}  // namespace
+
+void ESCore::InvalidateVerifiedContents()
+{
+  std::lock_guard lk(s_verified_contents_mutex);
+  s_verified_contents.clear();
+}
+
 static ES::TMDReader FindTMD(FSCore& fs, const std::string& tmd_path, Ticks ticks)
 {
   const auto fd = fs.Open(PID_KERNEL, PID_KERNEL, tmd_path, FS::Mode::Read, {}, ticks);
@@ -189,11 +233,20 @@ ESCore::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
 
   std::vector<ES::Content> stored_contents;
 
-  std::copy_if(contents.begin(), contents.end(), std::back_inserter(stored_contents),
-               [this, &tmd, check_content_hashes](const ES::Content& content) {
-                 const auto fs = m_ios.GetFS();
+  // Only read the shared content map once, rather than once for every shared content.
+  std::optional<ES::SharedContentMap> shared_content_map;
+  const auto get_content_path = [&](const ES::Content& content) -> std::string {
+    if (!content.IsShared())
+      return GetContentPath(tmd.GetTitleId(), content);
+    if (!shared_content_map)
+      shared_content_map.emplace(m_ios.GetFSCore());
+    return shared_content_map->GetFilenameFromSHA1(content.sha1).value_or("");
+  };
 
-                 const std::string path = GetContentPath(tmd.GetTitleId(), content);
+  const auto fs = m_ios.GetFS();
+  std::copy_if(contents.begin(), contents.end(), std::back_inserter(stored_contents),
+               [&](const ES::Content& content) {
+                 const std::string path = get_content_path(content);
                  if (path.empty())
                    return false;
 
@@ -207,10 +260,19 @@ ESCore::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
                    return true;
 
                  // Otherwise, check whether the installed content SHA1 matches the expected hash.
-                 std::vector<u8> content_data(file->GetStatus()->size);
+                 const auto status = file->GetStatus();
+                 if (!status)
+                   return false;
+                 if (IsVerifiedContent(path, content, status->size))
+                   return true;
+
+                 std::vector<u8> content_data(status->size);
                  if (!file->Read(content_data.data(), content_data.size()))
                    return false;
-                 return Common::SHA1::CalculateDigest(content_data) == content.sha1;
+                 if (Common::SHA1::CalculateDigest(content_data) != content.sha1)
+                   return false;
+                 AddVerifiedContent(path, content, status->size);
+                 return true;
                });
 
   return stored_contents;
@@ -322,6 +384,7 @@ bool ESCore::InitImport(const ES::TMDReader& tmd)
 
 bool ESCore::FinishImport(const ES::TMDReader& tmd)
 {
+  InvalidateVerifiedContents();
   const auto fs = m_ios.GetFS();
   const u64 title_id = tmd.GetTitleId();
   const std::string import_content_dir = Common::GetImportTitlePath(title_id) + "/content";
@@ -435,6 +435,7 @@ ReturnCode ESCore::ImportContentEnd(Context& context, u32 content_fd)
     }
   }
 
+  InvalidateVerifiedContents();
   const FS::ResultCode rename_result = fs->Rename(PID_KERNEL, PID_KERNEL, temp_path, content_path);
   if (rename_result != FS::ResultCode::Success)
   {
@@ -558,6 +559,7 @@ ReturnCode ESCore::DeleteTitle(u64 title_id)
   if (!CanDeleteTitle(title_id))
     return ES_EINVAL;
 
+  InvalidateVerifiedContents();
   const std::string title_dir = Common::GetTitlePath(title_id);
   return FS::ConvertResult(m_ios.GetFS()->Delete(PID_KERNEL, PID_KERNEL, title_dir));
 }
@@ -644,6 +646,7 @@ ReturnCode ESCore::DeleteTitleContent(u64 title_id) const
   if (!files)
     return FS::ConvertResult(files.Error());
 
+  InvalidateVerifiedContents();
   for (const std::string& file_name : *files)
   {
     if (file_name.size() == 12 && file_name.compare(8, 4, ".app") == 0)
@@ -678,6 +681,7 @@ ReturnCode ESCore::DeleteContent(u64 title_id, u32 content_id) const
 
   const std::string path =
       fmt::format("{}/{:08x}.app", Common::GetTitleContentPath(title_id), content_id);
+  InvalidateVerifiedContents();
   return FS::ConvertResult(m_ios.GetFS()->Delete(PID_KERNEL, PID_KERNEL, path));
 }
 
@@ -896,6 +900,7 @@ ReturnCode ESCore::DeleteSharedContent(const std::array<u8, 20>& sha1) const
     return ES_EINVAL;
 
   // Delete the shared content and update the content map.
+  InvalidateVerifiedContents();
   const auto delete_result = m_ios.GetFS()->Delete(PID_KERNEL, PID_KERNEL, *content_path);
   if (delete_result != FS::ResultCode::Success)
     return FS::ConvertResult(delete_result);
@@ -281,6 +281,9 @@ public:
   virtual Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) = 0;
 
   virtual void SetNandRedirects(std::vector<NandRedirect> nand_redirects) = 0;
+
+  /// Writes out changes that are only kept in memory so far.
+  virtual void Flush() {}
 };
 
 template <typename T>
@@ -314,6 +317,10 @@ enum class Location
 std::unique_ptr<FileSystem> MakeFileSystem(Location location = Location::Session,
                                            std::vector<NandRedirect> nand_redirects = {});
 
+/// Copies every file and directory, including their metadata, from source to destination.
+/// Returns false if anything couldn't be copied.
+bool CopyFileSystem(FileSystem& source, FileSystem& destination);
+
 /// Convert a FS result code to an IOS error code.
 IOS::HLE::ReturnCode ConvertResult(ResultCode code);
 
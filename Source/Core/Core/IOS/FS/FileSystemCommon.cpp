@@ -6,9 +6,14 @@
 #include <algorithm>
 
 #include "Common/Assert.h"
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/FS/HostBackend/FS.h"
+#include "Core/IOS/FS/PackBackend/FS.h"
+#include "Core/WiiRoot.h"
 
 namespace IOS::HLE::FS
 {
@@ -41,9 +46,84 @@ std::unique_ptr<FileSystem> MakeFileSystem(Location location,
 {
   const std::string nand_root =
       File::GetUserPath(location == Location::Session ? D_SESSION_WIIROOT_IDX : D_WIIROOT_IDX);
+
+  // Temporary NANDs are thrown away after use, so there's no point in packing them.
+  if (location == Location::Session && Core::WiiRootIsTemporary())
+    return std::make_unique<HostFileSystem>(nand_root, std::move(nand_redirects));
+
+  if (Config::Get(Config::MAIN_NAND_PACK_FILE))
+  {
+    auto fs = std::make_unique<PackFileSystem>(nand_root);
+    fs->SetNandRedirects(std::move(nand_redirects));
+    return fs;
+  }
+
+  // Switching back to directories takes the changes made in the pack along.
+  if (File::Exists(PackFileSystem::GetPackPath(nand_root)))
+    PackFileSystem::ExportToDirectory(nand_root);
+
   return std::make_unique<HostFileSystem>(nand_root, std::move(nand_redirects));
 }
 
+static bool CopyDirectoryContents(FileSystem& source, FileSystem& destination,
+                                  const std::string& path)
+{
+  const Result<std::vector<std::string>> names = source.ReadDirectory(0, 0, path);
+  if (!names)
+    return false;
+
+  bool success = true;
+  // ReadDirectory lists the newest entries first, so they are created the other way around to
+  // keep the order.
+  for (auto it = names->rbegin(); it != names->rend(); ++it)
+  {
+    const std::string child_path = (path == "/" ? "/" : path + '/') + *it;
+    const Result<Metadata> metadata = source.GetMetadata(0, 0, child_path);
+    if (!metadata)
+    {
+      success = false;
+      continue;
+    }
+
+    const ResultCode result =
+        metadata->is_file ?
+            destination.CreateFile(0, 0, child_path, metadata->attribute, metadata->modes) :
+            destination.CreateDirectory(0, 0, child_path, metadata->attribute, metadata->modes);
+    // The owner of a file can only be changed while it is empty.
+    if (result != ResultCode::Success ||
+        destination.SetMetadata(0, child_path, metadata->uid, metadata->gid, metadata->attribute,
+                                metadata->modes) != ResultCode::Success)
+    {
+      ERROR_LOG_FMT(IOS_FS, "Failed to copy {}", child_path);
+      success = false;
+      continue;
+    }
+
+    if (!metadata->is_file)
+    {
+      success &= CopyDirectoryContents(source, destination, child_path);
+      continue;
+    }
+
+    const Result<FileHandle> source_file = source.OpenFile(0, 0, child_path, Mode::Read);
+    const Result<FileHandle> destination_file =
+        destination.OpenFile(0, 0, child_path, Mode::Write);
+    std::vector<u8> contents(metadata->size);
+    if (!source_file || !destination_file || !source_file->Read(contents.data(), contents.size()) ||
+        !destination_file->Write(contents.data(), contents.size()))
+    {
+      ERROR_LOG_FMT(IOS_FS, "Failed to copy the contents of {}", child_path);
+      success = false;
+    }
+  }
+  return success;
+}
+
+bool CopyFileSystem(FileSystem& source, FileSystem& destination)
+{
+  return CopyDirectoryContents(source, destination, "/");
+}
+
 IOS::HLE::ReturnCode ConvertResult(ResultCode code)
 {
   if (code == ResultCode::Success)
@@ -233,6 +233,15 @@ s32 FSCore::Close(u64 fd, Ticks ticks)
     const ResultCode result = m_ios.GetFS()->Close(handle.fs_fd);
     LogResult(result, "Close({})", handle.name.data());
     m_fd_map.erase(fd);
+
+    // Once the last file is closed, the emulated software is most likely done saving for now.
+    if (std::ranges::none_of(m_fd_map, [](const auto& entry) {
+          return entry.second.fs_fd != INVALID_FD;
+        }))
+    {
+      m_ios.GetFS()->Flush();
+    }
+
     if (result != ResultCode::Success)
       return ConvertResult(result);
   }
@@ -155,7 +155,10 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   LoadFst();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  Flush();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -168,6 +171,7 @@ void HostFileSystem::ResetFst()
   m_root_entry.name = "/";
   // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
   m_root_entry.data.modes = {Mode::None, Mode::Read, Mode::Read};
+  InvalidateFstIndex();
 }
 
 void HostFileSystem::LoadFst()
@@ -206,6 +210,7 @@ void HostFileSystem::LoadFst()
     return;
   }
   m_root_entry = *root_entry;
+  InvalidateFstIndex();
 }
 
 void HostFileSystem::SaveFst()
@@ -249,6 +254,14 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (!host_file_info.Exists())
     return nullptr;
 
+  if (const auto it = m_fst_index.find(path); it != m_fst_index.end())
+  {
+    FstEntry* entry = it->second;
+    // The host file may have been replaced with a directory (or vice versa) behind our back.
+    if (entry->data.is_file == host_file_info.IsFile())
+      return entry;
+  }
+
   FstEntry* entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
   std::string complete_path = "";
   for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
@@ -267,6 +280,7 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
       // proper metadata is filled in later.
       INFO_LOG_FMT(IOS_FS, "Creating a default entry for {} ({})", complete_path,
                    host_file.is_redirect ? "redirect" : "NAND");
+      InvalidateFstIndex();
       entry = &entry->children.emplace_back();
       entry->name = component;
       entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
@@ -277,12 +291,19 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (entry->data.is_file && !entry->children.empty())
   {
     WARN_LOG_FMT(IOS_FS, "{} is a file but also has children; clearing children", path);
+    InvalidateFstIndex();
     entry->children.clear();
   }
 
+  m_fst_index.insert_or_assign(path, entry);
   return entry;
 }
 
+void HostFileSystem::InvalidateFstIndex()
+{
+  m_fst_index.clear();
+}
+
 void HostFileSystem::DoStateRead(PointerWrap& p, std::string start_directory_path)
 {
   std::string path = BuildFilename(start_directory_path).host_path;
@@ -374,6 +395,8 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 void HostFileSystem::DoState(PointerWrap& p)
 {
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
+  Flush();
+  m_recent_files.clear();
   for (Handle& handle : m_handles)
     handle.host_file.reset();
 
@@ -449,10 +472,13 @@ ResultCode HostFileSystem::Format(Uid uid)
   if (m_root_path.empty())
     return ResultCode::AccessDenied;
   const std::string root = BuildFilename("/").host_path;
+  m_recent_files.clear();
+  m_unsynced_files.clear();
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
   ResetFst();
   SaveFst();
+  m_fst_dirty = false;
   // Reset and close all handles.
   m_handles = {};
   return ResultCode::Success;
@@ -498,7 +524,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   child->data.uid = uid;
   child->data.gid = gid;
   child->data.attribute = attr;
-  SaveFst();
+  m_fst_dirty = true;
   return ResultCode::Success;
 }
 
@@ -546,6 +572,7 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   if (!File::Exists(host_path))
     return ResultCode::NotFound;
 
+  ReleaseHostFiles(host_path);
   if (File::IsFile(host_path) && !IsFileOpened(path))
     File::Delete(host_path);
   else if (File::IsDirectory(host_path) && !IsDirectoryInUse(path))
@@ -556,8 +583,11 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   const auto it = std::find_if(parent->children.begin(), parent->children.end(),
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
+  {
+    InvalidateFstIndex();
     parent->children.erase(it);
-  SaveFst();
+  }
+  m_fst_dirty = true;
 
   return ResultCode::Success;
 }
@@ -600,6 +630,8 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const auto host_new_info = BuildFilename(new_path);
   const std::string& host_old_path = host_old_info.host_path;
   const std::string& host_new_path = host_new_info.host_path;
+  ReleaseHostFiles(host_old_path);
+  ReleaseHostFiles(host_new_path);
 
   // If there is already something of the same type at the new path, delete it.
   if (File::Exists(host_new_path))
@@ -650,10 +682,11 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     new_entry->data = it->data;
     new_entry->children = it->children;
 
+    InvalidateFstIndex();
     old_parent->children.erase(it);
   }
 
-  SaveFst();
+  m_fst_dirty = true;
 
   return ResultCode::Success;
 }
@@ -767,7 +800,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
     entry->data.uid = uid;
     entry->data.attribute = attr;
     entry->data.modes = modes;
-    SaveFst();
+    m_fst_dirty = true;
   }
 
   return ResultCode::Success;
@@ -848,5 +881,6 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  InvalidateFstIndex();
 }
 }  // namespace IOS::HLE::FS
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -59,6 +60,11 @@ public:
 
   void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
 
+  /// Writes out metadata changes and waits for the host to store all files written to so far.
+  ///
+  /// This also happens on savestates and when the file system is destroyed.
+  void Flush() override;
+
 private:
   void DoStateWriteOrMeasure(PointerWrap& p, std::string start_directory_path);
   void DoStateRead(PointerWrap& p, std::string start_directory_path);
@@ -95,6 +101,8 @@ private:
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
   std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  /// Closes the cached host files for a path and everything under it, so it can be changed.
+  void ReleaseHostFiles(const std::string& host_path);
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
@@ -109,6 +117,9 @@ private:
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
   FstEntry* GetFstEntryForPath(const std::string& path);
+  /// Must be called whenever entries are added to or removed from the FST, since that may move
+  /// the other entries.
+  void InvalidateFstIndex();
 
   /// FST entry for the filesystem root.
   ///
@@ -119,8 +130,19 @@ private:
   /// and we do not want FS to break if the user adds or removes files in their
   /// filesystem root manually.
   FstEntry m_root_entry{};
+  /// Wii path -> FST entry, for the entries that have been looked up since the last change to
+  /// the structure of the FST.
+  std::unordered_map<std::string, FstEntry*> m_fst_index;
+  /// Whether the FST has changed since it was last saved.
+  bool m_fst_dirty = false;
+
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
+  /// The most recently used host files, which are kept open after their last handle is closed
+  /// because games tend to open the same files over and over. Most recently used first.
+  std::vector<std::pair<std::string, std::shared_ptr<File::IOFile>>> m_recent_files;
+  /// Host files written to since the last Flush.
+  std::vector<std::pair<std::string, std::shared_ptr<File::IOFile>>> m_unsynced_files;
   std::array<Handle, 16> m_handles{};
 
   FstEntry m_redirect_fst{};
@@ -13,6 +13,8 @@
 
 namespace IOS::HLE::FS
 {
+constexpr size_t MAX_RECENT_HOST_FILES = 16;
+
 // This isn't theadsafe, but it's only called from the CPU thread.
 std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
 {
@@ -32,12 +34,25 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   //    - Wii System Menu (Can't access the system settings, gets stuck on blank screen)
   //    - The Beatles: Rock Band (saving doesn't work)
 
+  // Opening host files can be slow, so the recently used ones are kept open.
+  const auto recent = std::ranges::find(m_recent_files, host_path,
+                                        &decltype(m_recent_files)::value_type::first);
+  if (recent != m_recent_files.end())
+  {
+    std::rotate(m_recent_files.begin(), recent, recent + 1);
+    return m_recent_files.front().second;
+  }
+
   // Check if the file has already been opened.
   auto search = m_open_files.find(host_path);
   if (search != m_open_files.end())
   {
     // Lock a shared pointer to use.
-    return search->second.lock();
+    std::shared_ptr<File::IOFile> file_ptr = search->second.lock();
+    m_recent_files.emplace(m_recent_files.begin(), host_path, file_ptr);
+    if (m_recent_files.size() > MAX_RECENT_HOST_FILES)
+      m_recent_files.pop_back();
+    return file_ptr;
   }
 
   // All files are opened read/write. Actual access rights will be controlled per handle by the
@@ -71,9 +86,44 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   // Store a weak pointer to our newly opened file in the cache.
   m_open_files[host_path] = std::weak_ptr<File::IOFile>(file_ptr);
 
+  m_recent_files.emplace(m_recent_files.begin(), host_path, file_ptr);
+  if (m_recent_files.size() > MAX_RECENT_HOST_FILES)
+    m_recent_files.pop_back();
+
   return file_ptr;
 }
 
+void HostFileSystem::ReleaseHostFiles(const std::string& host_path)
+{
+  const auto is_affected = [&host_path](const auto& entry) {
+    return entry.first.starts_with(host_path) &&
+           (entry.first.size() == host_path.size() || entry.first[host_path.size()] == '/');
+  };
+  std::erase_if(m_recent_files, is_affected);
+  std::erase_if(m_unsynced_files, [&is_affected](const auto& entry) {
+    if (!is_affected(entry))
+      return false;
+    entry.second->Sync();
+    return true;
+  });
+}
+
+void HostFileSystem::Flush()
+{
+  if (m_fst_dirty)
+  {
+    SaveFst();
+    m_fst_dirty = false;
+  }
+
+  for (const auto& [host_path, file] : m_unsynced_files)
+  {
+    if (!file->Sync())
+      ERROR_LOG_FMT(IOS_FS, "Failed to sync {}", host_path);
+  }
+  m_unsynced_files.clear();
+}
+
 Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
 {
   Handle* handle = AssignFreeHandle();
@@ -113,8 +163,9 @@ ResultCode HostFileSystem::Close(Fd fd)
     return ResultCode::Invalid;
 
   // Let go of our pointer to the file, it will automatically close if we are the last handle
-  // accessing it.
+  // accessing it and it isn't one of the recently used files.
   *handle = Handle{};
+
   return ResultCode::Success;
 }
 
@@ -159,6 +210,12 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
   if (!handle->host_file->WriteBytes(ptr, count))
     return ResultCode::AccessDenied;
 
+  if (std::ranges::find(m_unsynced_files, handle->host_file,
+                        &decltype(m_unsynced_files)::value_type::second) == m_unsynced_files.end())
+  {
+    m_unsynced_files.emplace_back(BuildFilename(handle->wii_path).host_path, handle->host_file);
+  }
+
   handle->file_offset += count;
   return count;
 }
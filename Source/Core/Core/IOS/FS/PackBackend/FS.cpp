@@ -0,0 +1,797 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/PackBackend/FS.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Align.h"
+#include "Common/ChunkFile.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
+
+namespace IOS::HLE::FS
+{
+namespace
+{
+constexpr u32 PACK_MAGIC = 0x4B504E44;  // "DNPK"
+constexpr u32 PACK_VERSION = 1;
+
+// Rewriting the pack is only worth it once a good part of it is outdated.
+constexpr u64 MIN_RECLAIMABLE_SIZE = 0x400000;
+
+struct PackHeader
+{
+  u32 magic;
+  u32 version;
+  u64 index_offset;
+  u64 index_count;
+};
+static_assert(std::is_trivially_copyable_v<PackHeader>);
+static_assert(sizeof(PackHeader) == 0x18);
+
+struct SerializedNode
+{
+  std::string_view GetName() const { return {name.data(), strnlen(name.data(), name.size())}; }
+  void SetName(std::string_view new_name)
+  {
+    std::memcpy(name.data(), new_name.data(), std::min(name.size(), new_name.length()));
+  }
+
+  std::array<char, 12> name{};
+  Uid uid = 0;
+  Gid gid = 0;
+  FileAttribute attribute = 0;
+  u8 is_file = 0;
+  Modes modes{};
+  u8 padding = 0;
+  u32 size = 0;
+  u32 num_children = 0;
+  u64 offset = 0;
+};
+static_assert(std::is_trivially_copyable_v<SerializedNode>);
+static_assert(sizeof(SerializedNode) == 0x28);
+
+auto GetNamePredicate(const std::string& name)
+{
+  return [&name](const auto& node) { return node->name == name; };
+}
+
+template <typename Node>
+u64 CountNodes(const Node& node)
+{
+  u64 count = 1;
+  for (const auto& child : node.children)
+    count += CountNodes(*child);
+  return count;
+}
+
+template <typename Node>
+u64 ComputeUsedClusters(const Node& node)
+{
+  if (node.data.is_file)
+    return Common::AlignUp<u64>(node.data.size, CLUSTER_SIZE) / CLUSTER_SIZE;
+
+  u64 clusters = 0;
+  for (const auto& child : node.children)
+    clusters += ComputeUsedClusters(*child);
+  return clusters;
+}
+}  // namespace
+
+bool PackFileSystem::Node::CheckPermission(Uid caller_uid, Gid caller_gid,
+                                           Mode requested_mode) const
+{
+  if (caller_uid == 0)
+    return true;
+  Mode file_mode = data.modes.other;
+  if (data.uid == caller_uid)
+    file_mode = data.modes.owner;
+  else if (data.gid == caller_gid)
+    file_mode = data.modes.group;
+  return (u8(requested_mode) & u8(file_mode)) == u8(requested_mode);
+}
+
+PackFileSystem::PackFileSystem(const std::string& root_path)
+    : m_root_path{root_path}, m_root{MakeRootNode()}
+{
+  while (m_root_path.ends_with('/'))
+    m_root_path.pop_back();
+  m_pack_path = GetPackPath(m_root_path);
+  File::CreateFullPath(m_root_path + '/');
+
+  if (!File::Exists(m_pack_path))
+  {
+    Import();
+    return;
+  }
+
+  if (!Load())
+  {
+    const std::string bad_path = m_pack_path + ".bad";
+    PanicAlertFmt("IOS_FS: Failed to load the NAND pack. It has been moved to {}, and will be "
+                  "recreated from the NAND directory.",
+                  bad_path);
+    m_mapping.Unmap();
+    m_file.Close();
+    File::Rename(m_pack_path, bad_path);
+    Import();
+  }
+}
+
+PackFileSystem::~PackFileSystem()
+{
+  Flush();
+}
+
+std::string PackFileSystem::GetPackPath(const std::string& root_path)
+{
+  std::string_view root = root_path;
+  while (root.ends_with('/'))
+    root.remove_suffix(1);
+  return fmt::format("{}/nand.pack", root);
+}
+
+std::unique_ptr<PackFileSystem::Node> PackFileSystem::MakeRootNode() const
+{
+  auto root = std::make_unique<Node>();
+  root->name = "/";
+  // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
+  root->data.modes = {Mode::None, Mode::Read, Mode::Read};
+  return root;
+}
+
+bool PackFileSystem::Load()
+{
+  if (!m_file.Open(m_pack_path, "r+b"))
+    return false;
+
+  const u64 file_size = m_file.GetSize();
+  PackHeader header;
+  if (!m_file.ReadArray(&header, 1) || header.magic != PACK_MAGIC ||
+      header.version != PACK_VERSION || header.index_offset > file_size ||
+      header.index_count > (file_size - header.index_offset) / sizeof(SerializedNode))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Invalid NAND pack header");
+    return false;
+  }
+
+  std::vector<SerializedNode> index(header.index_count);
+  if (!m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadArray(index.data(), index.size()))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to read the NAND pack index");
+    return false;
+  }
+  m_used_size = sizeof(PackHeader) + index.size() * sizeof(SerializedNode);
+
+  size_t position = 0;
+  const auto parse_node = [&](const auto& parse, size_t depth) -> std::unique_ptr<Node> {
+    if (depth > MaxPathDepth || position >= index.size())
+      return nullptr;
+
+    const SerializedNode& serialized = index[position++];
+    auto node = std::make_unique<Node>();
+    node->name = serialized.GetName();
+    node->data.uid = serialized.uid;
+    node->data.gid = serialized.gid;
+    node->data.attribute = serialized.attribute;
+    node->data.modes = serialized.modes;
+    node->data.is_file = serialized.is_file != 0;
+    if (node->data.is_file)
+    {
+      if (serialized.offset > file_size || serialized.size > file_size - serialized.offset)
+        return nullptr;
+      node->data.size = serialized.size;
+      node->offset = serialized.offset;
+      m_used_size += serialized.size;
+    }
+
+    for (u32 i = 0; i < serialized.num_children; ++i)
+    {
+      std::unique_ptr<Node> child = parse(parse, depth + 1);
+      if (!child)
+        return nullptr;
+      node->children.push_back(std::move(child));
+    }
+    return node;
+  };
+
+  std::unique_ptr<Node> root = parse_node(parse_node, 0);
+  if (!root || root->data.is_file || position != index.size())
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to parse the NAND pack index");
+    return false;
+  }
+  m_root = std::move(root);
+
+  if (!m_mapping.Map(m_file))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to map the NAND pack");
+    return false;
+  }
+  return true;
+}
+
+bool PackFileSystem::Save(bool rewrite)
+{
+  File::IOFile temp_file;
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(m_pack_path);
+  if (rewrite)
+  {
+    if (!temp_file.Open(temp_path, "w+b"))
+      return false;
+    const PackHeader placeholder{};
+    if (!temp_file.WriteArray(&placeholder, 1))
+      return false;
+  }
+  else if (!m_file.Seek(0, File::SeekOrigin::End))
+  {
+    return false;
+  }
+  File::IOFile& file = rewrite ? temp_file : m_file;
+
+  // Nothing in memory changes until the new index is in place, so that a failure keeps
+  // everything as it was.
+  std::vector<SerializedNode> index;
+  std::vector<std::pair<Node*, u64>> new_offsets;
+  u64 used_size = sizeof(PackHeader);
+  const auto collect = [&](const auto& self, Node& node) -> bool {
+    SerializedNode serialized;
+    serialized.SetName(node.name);
+    serialized.uid = node.data.uid;
+    serialized.gid = node.data.gid;
+    serialized.attribute = node.data.attribute;
+    serialized.is_file = node.data.is_file;
+    serialized.modes = node.data.modes;
+    serialized.num_children = static_cast<u32>(node.children.size());
+    if (node.data.is_file)
+    {
+      serialized.size = node.data.size;
+      serialized.offset = node.offset;
+      if (rewrite || node.modified_contents)
+      {
+        const std::span<const u8> contents = GetContents(node);
+        serialized.offset = file.Tell();
+        if (!file.WriteBytes(contents.data(), contents.size()))
+          return false;
+        new_offsets.emplace_back(&node, serialized.offset);
+      }
+      used_size += node.data.size;
+    }
+    index.push_back(serialized);
+
+    return std::ranges::all_of(node.children,
+                               [&](const auto& child) { return self(self, *child); });
+  };
+
+  if (!collect(collect, *m_root))
+    return false;
+  const u64 index_offset = file.Tell();
+  if (!file.WriteArray(index.data(), index.size()) || !file.Sync())
+    return false;
+  used_size += index.size() * sizeof(SerializedNode);
+
+  const PackHeader header{PACK_MAGIC, PACK_VERSION, index_offset, index.size()};
+  if (!file.Seek(0, File::SeekOrigin::Begin) || !file.WriteArray(&header, 1) || !file.Sync())
+    return false;
+
+  if (rewrite)
+  {
+    temp_file.Close();
+    m_mapping.Unmap();
+    m_file.Close();
+    if (!File::Rename(temp_path, m_pack_path) || !m_file.Open(m_pack_path, "r+b"))
+    {
+      // The contents that were only in the old pack are gone from the mapping now.
+      PanicAlertFmt("IOS_FS: Failed to replace the NAND pack with {}", temp_path);
+      return false;
+    }
+  }
+
+  for (const auto& [node, offset] : new_offsets)
+  {
+    node->offset = offset;
+    node->modified_contents.reset();
+  }
+  m_used_size = used_size;
+  m_mapping.Map(m_file);
+  return true;
+}
+
+bool PackFileSystem::Import()
+{
+  INFO_LOG_FMT(IOS_FS, "Creating NAND pack {} from the NAND directory", m_pack_path);
+  {
+    HostFileSystem host_fs(m_root_path);
+    if (!CopyFileSystem(host_fs, *this))
+      ERROR_LOG_FMT(IOS_FS, "Failed to import parts of the NAND directory into the NAND pack");
+  }
+
+  if (!Save(true))
+  {
+    PanicAlertFmt("IOS_FS: Failed to create the NAND pack {}", m_pack_path);
+    return false;
+  }
+  m_dirty = false;
+  return true;
+}
+
+bool PackFileSystem::ExportToDirectory(const std::string& root_path)
+{
+  const std::string pack_path = GetPackPath(root_path);
+  INFO_LOG_FMT(IOS_FS, "Exporting NAND pack {} to the NAND directory", pack_path);
+  {
+    PackFileSystem pack_fs(root_path);
+    HostFileSystem host_fs(root_path);
+    const Result<std::vector<std::string>> old_entries = host_fs.ReadDirectory(0, 0, "/");
+    if (old_entries)
+    {
+      for (const std::string& name : *old_entries)
+        host_fs.Delete(0, 0, "/" + name);
+    }
+    if (!CopyFileSystem(pack_fs, host_fs))
+    {
+      PanicAlertFmt("IOS_FS: Failed to export the NAND pack {}", pack_path);
+      return false;
+    }
+  }
+
+  return File::Rename(pack_path, pack_path + ".old");
+}
+
+void PackFileSystem::Flush()
+{
+  if (!m_dirty)
+    return;
+
+  const u64 pack_size = m_file.IsOpen() ? m_file.GetSize() : 0;
+  const bool rewrite = !m_file.IsOpen() || pack_size > m_used_size * 2 + MIN_RECLAIMABLE_SIZE;
+  if (!Save(rewrite))
+  {
+    PanicAlertFmt("IOS_FS: Failed to write changes to the NAND pack");
+    return;
+  }
+  m_dirty = false;
+}
+
+PackFileSystem::Node* PackFileSystem::GetNodeForPath(const std::string& path)
+{
+  if (path == "/")
+    return m_root.get();
+
+  if (!IsValidNonRootPath(path))
+    return nullptr;
+
+  Node* node = m_root.get();
+  for (const std::string& component : SplitString(path.substr(1), '/'))
+  {
+    const auto next = std::ranges::find_if(node->children, GetNamePredicate(component));
+    if (next == node->children.end())
+      return nullptr;
+    node = next->get();
+  }
+  return node;
+}
+
+std::span<const u8> PackFileSystem::GetContents(const Node& node) const
+{
+  if (node.modified_contents)
+    return *node.modified_contents;
+  if (node.data.size == 0)
+    return {};
+  return {m_mapping.GetData() + node.offset, node.data.size};
+}
+
+std::vector<u8>& PackFileSystem::GetModifiableContents(Node& node)
+{
+  if (!node.modified_contents)
+  {
+    const std::span<const u8> contents = GetContents(node);
+    node.modified_contents = std::make_unique<std::vector<u8>>(contents.begin(), contents.end());
+  }
+  m_dirty = true;
+  return *node.modified_contents;
+}
+
+void PackFileSystem::DoState(PointerWrap& p)
+{
+  // Only "/tmp" is part of the state. HostFileSystem also saves the rest of the NAND for movies
+  // that use a temporary NAND, but those never use this backend.
+  const auto do_node = [&p, this](const auto& self, Node& node) -> void {
+    p.Do(node.name);
+    p.Do(node.data.uid);
+    p.Do(node.data.gid);
+    p.Do(node.data.attribute);
+    p.Do(node.data.modes);
+    p.Do(node.data.is_file);
+    if (node.data.is_file)
+    {
+      std::vector<u8> contents;
+      if (!p.IsReadMode())
+      {
+        const std::span<const u8> span = GetContents(node);
+        contents.assign(span.begin(), span.end());
+      }
+      p.Do(contents);
+      if (p.IsReadMode())
+      {
+        node.data.size = static_cast<u32>(contents.size());
+        node.modified_contents = std::make_unique<std::vector<u8>>(std::move(contents));
+      }
+    }
+
+    u32 num_children = static_cast<u32>(node.children.size());
+    p.Do(num_children);
+    if (p.IsReadMode())
+    {
+      node.children.clear();
+      // Stop early if the state turns out to be broken.
+      for (u32 i = 0; i < num_children && p.IsReadMode(); ++i)
+      {
+        auto child = std::make_unique<Node>();
+        self(self, *child);
+        node.children.push_back(std::move(child));
+      }
+    }
+    else
+    {
+      for (const auto& child : node.children)
+        self(self, *child);
+    }
+  };
+
+  const auto tmp = std::ranges::find_if(m_root->children, GetNamePredicate("tmp"));
+  bool has_tmp = tmp != m_root->children.end();
+  p.Do(has_tmp);
+  if (p.IsReadMode())
+  {
+    auto loaded_tmp = std::make_unique<Node>();
+    if (has_tmp)
+      do_node(do_node, *loaded_tmp);
+
+    if (!has_tmp && tmp != m_root->children.end())
+      m_root->children.erase(tmp);
+    else if (has_tmp && tmp != m_root->children.end())
+      *tmp = std::move(loaded_tmp);
+    else if (has_tmp)
+      m_root->children.push_back(std::move(loaded_tmp));
+    m_dirty = true;
+  }
+  else if (has_tmp)
+  {
+    do_node(do_node, **tmp);
+  }
+
+  for (Handle& handle : m_handles)
+  {
+    p.Do(handle.opened);
+    p.Do(handle.mode);
+    p.Do(handle.wii_path);
+    p.Do(handle.file_offset);
+    if (p.IsReadMode())
+    {
+      handle.node = handle.opened ? GetNodeForPath(handle.wii_path) : nullptr;
+      if (handle.opened && (!handle.node || !handle.node->data.is_file))
+      {
+        ERROR_LOG_FMT(IOS_FS, "{} is missing from the loaded state", handle.wii_path);
+        handle = Handle{};
+      }
+    }
+  }
+}
+
+ResultCode PackFileSystem::Format(Uid uid)
+{
+  if (uid != 0)
+    return ResultCode::AccessDenied;
+
+  m_root = MakeRootNode();
+  // Reset and close all handles.
+  m_handles = {};
+  m_dirty = true;
+  Flush();
+  return ResultCode::Success;
+}
+
+ResultCode PackFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                                 FileAttribute attr, Modes modes, bool is_file)
+{
+  if (!IsValidNonRootPath(path) ||
+      !std::all_of(path.begin(), path.end(), Common::IsPrintableCharacter))
+  {
+    return ResultCode::Invalid;
+  }
+
+  if (!is_file && std::ranges::count(path, '/') > int(MaxPathDepth))
+    return ResultCode::TooManyPathComponents;
+
+  const auto split_path = SplitPathAndBasename(path);
+  if (!IsValidFilename(split_path.file_name))
+    return ResultCode::Invalid;
+
+  Node* parent = GetNodeForPath(split_path.parent);
+  if (!parent || parent->data.is_file)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  if (std::ranges::any_of(parent->children, GetNamePredicate(split_path.file_name)))
+    return ResultCode::AlreadyExists;
+
+  auto child = std::make_unique<Node>();
+  child->name = split_path.file_name;
+  child->data.is_file = is_file;
+  child->data.modes = modes;
+  child->data.uid = uid;
+  child->data.gid = gid;
+  child->data.attribute = attr;
+  parent->children.push_back(std::move(child));
+  m_dirty = true;
+  return ResultCode::Success;
+}
+
+ResultCode PackFileSystem::CreateFile(Uid uid, Gid gid, const std::string& path, FileAttribute attr,
+                                      Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, true);
+}
+
+ResultCode PackFileSystem::CreateDirectory(Uid uid, Gid gid, const std::string& path,
+                                           FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, false);
+}
+
+bool PackFileSystem::IsFileOpened(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path == path;
+  });
+}
+
+bool PackFileSystem::IsDirectoryInUse(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path.starts_with(path);
+  });
+}
+
+ResultCode PackFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
+{
+  if (!IsValidNonRootPath(path))
+    return ResultCode::Invalid;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Node* parent = GetNodeForPath(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  const auto it = std::ranges::find_if(parent->children, GetNamePredicate(split_path.file_name));
+  if (it == parent->children.end())
+    return ResultCode::NotFound;
+
+  if ((*it)->data.is_file ? IsFileOpened(path) : IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  parent->children.erase(it);
+  m_dirty = true;
+  return ResultCode::Success;
+}
+
+ResultCode PackFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
+                                  const std::string& new_path)
+{
+  if (!IsValidNonRootPath(old_path) || !IsValidNonRootPath(new_path))
+    return ResultCode::Invalid;
+
+  const auto split_old_path = SplitPathAndBasename(old_path);
+  const auto split_new_path = SplitPathAndBasename(new_path);
+  if (!IsValidFilename(split_new_path.file_name))
+    return ResultCode::Invalid;
+
+  Node* old_parent = GetNodeForPath(split_old_path.parent);
+  Node* new_parent = GetNodeForPath(split_new_path.parent);
+  if (!old_parent || !new_parent || new_parent->data.is_file)
+    return ResultCode::NotFound;
+
+  if (!old_parent->CheckPermission(uid, gid, Mode::Write) ||
+      !new_parent->CheckPermission(uid, gid, Mode::Write))
+  {
+    return ResultCode::AccessDenied;
+  }
+
+  const auto it =
+      std::ranges::find_if(old_parent->children, GetNamePredicate(split_old_path.file_name));
+  if (it == old_parent->children.end())
+    return ResultCode::NotFound;
+  const bool is_file = (*it)->data.is_file;
+
+  // For files, the file name is not allowed to change.
+  if (is_file && split_old_path.file_name != split_new_path.file_name)
+    return ResultCode::Invalid;
+
+  if ((!is_file && IsDirectoryInUse(old_path)) || (is_file && IsFileOpened(old_path)))
+    return ResultCode::InUse;
+
+  if (old_path == new_path)
+    return ResultCode::Success;
+
+  // A directory can't be moved into itself.
+  if (new_path.starts_with(old_path) && new_path[old_path.size()] == '/')
+    return ResultCode::Invalid;
+
+  // If there is already something of the same type at the new path, delete it.
+  const auto existing =
+      std::ranges::find_if(new_parent->children, GetNamePredicate(split_new_path.file_name));
+  if (existing != new_parent->children.end())
+  {
+    if ((*existing)->data.is_file != is_file)
+      return ResultCode::Invalid;
+    if (is_file ? IsFileOpened(new_path) : IsDirectoryInUse(new_path))
+      return ResultCode::InUse;
+    new_parent->children.erase(existing);
+  }
+
+  // Erasing from new_parent may have moved the node in old_parent's vector.
+  const auto source =
+      std::ranges::find_if(old_parent->children, GetNamePredicate(split_old_path.file_name));
+  std::unique_ptr<Node> node = std::move(*source);
+  old_parent->children.erase(source);
+  node->name = split_new_path.file_name;
+  new_parent->children.push_back(std::move(node));
+  m_dirty = true;
+  return ResultCode::Success;
+}
+
+Result<std::vector<std::string>> PackFileSystem::ReadDirectory(Uid uid, Gid gid,
+                                                               const std::string& path)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  const Node* node = GetNodeForPath(path);
+  if (!node)
+    return ResultCode::NotFound;
+
+  if (!node->CheckPermission(uid, gid, Mode::Read))
+    return ResultCode::AccessDenied;
+
+  if (node->data.is_file)
+    return ResultCode::Invalid;
+
+  // Newest first, because Nintendo traverses a linked list in which new elements are inserted
+  // at the front (issue 10234).
+  std::vector<std::string> output;
+  output.reserve(node->children.size());
+  for (auto it = node->children.rbegin(); it != node->children.rend(); ++it)
+    output.push_back((*it)->name);
+  return output;
+}
+
+Result<Metadata> PackFileSystem::GetMetadata(Uid uid, Gid gid, const std::string& path)
+{
+  const Node* node = nullptr;
+  if (path == "/")
+  {
+    node = m_root.get();
+  }
+  else
+  {
+    if (!IsValidNonRootPath(path))
+      return ResultCode::Invalid;
+
+    const auto split_path = SplitPathAndBasename(path);
+    const Node* parent = GetNodeForPath(split_path.parent);
+    if (!parent)
+      return ResultCode::NotFound;
+    if (!parent->CheckPermission(uid, gid, Mode::Read))
+      return ResultCode::AccessDenied;
+    node = GetNodeForPath(path);
+  }
+
+  if (!node)
+    return ResultCode::NotFound;
+
+  return node->data;
+}
+
+ResultCode PackFileSystem::SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                                       FileAttribute attr, Modes modes)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Node* node = GetNodeForPath(path);
+  if (!node)
+    return ResultCode::NotFound;
+
+  if (caller_uid != 0 && caller_uid != node->data.uid)
+    return ResultCode::AccessDenied;
+  if (caller_uid != 0 && uid != node->data.uid)
+    return ResultCode::AccessDenied;
+
+  if (node->data.uid != uid && node->data.is_file && node->data.size != 0)
+    return ResultCode::FileNotEmpty;
+
+  if (node->data.gid != gid || node->data.uid != uid || node->data.attribute != attr ||
+      node->data.modes != modes)
+  {
+    node->data.gid = gid;
+    node->data.uid = uid;
+    node->data.attribute = attr;
+    node->data.modes = modes;
+    m_dirty = true;
+  }
+
+  return ResultCode::Success;
+}
+
+Result<NandStats> PackFileSystem::GetNandStats()
+{
+  const auto root_stats = GetDirectoryStats("/");
+  if (!root_stats)
+    return root_stats.Error();
+
+  NandStats stats{};
+  stats.cluster_size = CLUSTER_SIZE;
+  stats.free_clusters = USABLE_CLUSTERS - root_stats->used_clusters;
+  stats.used_clusters = root_stats->used_clusters;
+  stats.bad_clusters = 0;
+  stats.reserved_clusters = RESERVED_CLUSTERS;
+  stats.free_inodes = TOTAL_INODES - root_stats->used_inodes;
+  stats.used_inodes = root_stats->used_inodes;
+
+  return stats;
+}
+
+Result<DirectoryStats> PackFileSystem::GetDirectoryStats(const std::string& wii_path)
+{
+  const auto result = GetExtendedDirectoryStats(wii_path);
+  if (!result)
+    return result.Error();
+
+  DirectoryStats stats{};
+  stats.used_inodes = static_cast<u32>(std::min<u64>(result->used_inodes, TOTAL_INODES));
+  stats.used_clusters = static_cast<u32>(std::min<u64>(result->used_clusters, USABLE_CLUSTERS));
+  return stats;
+}
+
+Result<ExtendedDirectoryStats>
+PackFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
+{
+  if (!IsValidPath(wii_path))
+    return ResultCode::Invalid;
+
+  const Node* node = GetNodeForPath(wii_path);
+  if (!node)
+    return ResultCode::NotFound;
+  if (node->data.is_file)
+    return ResultCode::Invalid;
+
+  ExtendedDirectoryStats stats{};
+  stats.used_inodes = CountNodes(*node);
+  stats.used_clusters = ComputeUsedClusters(*node);
+  return stats;
+}
+
+void PackFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
+{
+  if (!nand_redirects.empty())
+    WARN_LOG_FMT(IOS_FS, "NAND redirects are not supported with a NAND pack; ignoring them");
+}
+}  // namespace IOS::HLE::FS
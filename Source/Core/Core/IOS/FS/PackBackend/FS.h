@@ -0,0 +1,136 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+#include "Core/IOS/FS/FileSystem.h"
+
+namespace IOS::HLE::FS
+{
+/// Backend that stores the whole file system in a single pack file.
+///
+/// The pack is a header followed by file contents and, at its end, an index of every file and
+/// directory with its metadata. Reads come straight from a memory mapping of the pack. Files that
+/// are written to get a copy of their contents in memory, which is appended to the pack together
+/// with a new index when the file system is flushed. Only once all of that has reached the
+/// storage device does the header get pointed at the new index, so a pack that was interrupted in
+/// the middle of a flush still has the previous state. The space taken by outdated contents and
+/// indices is reclaimed by rewriting the pack once it outgrows what is still in use.
+///
+/// Unlike HostFileSystem, NAND redirects are not supported.
+class PackFileSystem final : public FileSystem
+{
+public:
+  /// Opens the pack in root_path. If it doesn't exist yet, it is created from the NAND directory
+  /// that HostFileSystem would use for the same root.
+  explicit PackFileSystem(const std::string& root_path);
+  ~PackFileSystem();
+
+  /// Returns the path of the pack used for root_path.
+  static std::string GetPackPath(const std::string& root_path);
+  /// Replaces the NAND directory of root_path with the contents of its pack, then moves the pack
+  /// out of the way so that the directory is what gets imported the next time a pack is used.
+  static bool ExportToDirectory(const std::string& root_path);
+
+  void DoState(PointerWrap& p) override;
+
+  ResultCode Format(Uid uid) override;
+
+  Result<FileHandle> OpenFile(Uid uid, Gid gid, const std::string& path, Mode mode) override;
+  ResultCode Close(Fd fd) override;
+  Result<u32> ReadBytesFromFile(Fd fd, u8* ptr, u32 size) override;
+  Result<u32> WriteBytesToFile(Fd fd, const u8* ptr, u32 size) override;
+  Result<u32> SeekFile(Fd fd, u32 offset, SeekMode mode) override;
+  Result<FileStatus> GetFileStatus(Fd fd) override;
+
+  ResultCode CreateFile(Uid caller_uid, Gid caller_gid, const std::string& path,
+                        FileAttribute attribute, Modes modes) override;
+
+  ResultCode CreateDirectory(Uid caller_uid, Gid caller_gid, const std::string& path,
+                             FileAttribute attribute, Modes modes) override;
+
+  ResultCode Delete(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode Rename(Uid caller_uid, Gid caller_gid, const std::string& old_path,
+                    const std::string& new_path) override;
+
+  Result<std::vector<std::string>> ReadDirectory(Uid caller_uid, Gid caller_gid,
+                                                 const std::string& path) override;
+
+  Result<Metadata> GetMetadata(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                         FileAttribute attribute, Modes modes) override;
+
+  Result<NandStats> GetNandStats() override;
+  Result<DirectoryStats> GetDirectoryStats(const std::string& path) override;
+  Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) override;
+
+  void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
+
+  /// Writes all changes to the pack.
+  ///
+  /// This also happens on savestates and when the file system is destroyed.
+  void Flush() override;
+
+private:
+  struct Node
+  {
+    bool CheckPermission(Uid uid, Gid gid, Mode requested_mode) const;
+
+    std::string name;
+    /// data.size is the size of the file's contents.
+    Metadata data{};
+    /// Where the contents are in the pack, unless the file has been written to since the
+    /// last flush.
+    u64 offset = 0;
+    std::unique_ptr<std::vector<u8>> modified_contents;
+    /// Children of this node, oldest first. Only valid for directories.
+    std::vector<std::unique_ptr<Node>> children;
+  };
+
+  struct Handle
+  {
+    bool opened = false;
+    Mode mode = Mode::None;
+    std::string wii_path;
+    Node* node = nullptr;
+    u32 file_offset = 0;
+  };
+  Handle* AssignFreeHandle();
+  Handle* GetHandleFromFd(Fd fd);
+  Fd ConvertHandleToFd(const Handle* handle) const;
+
+  ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                   FileAttribute attribute, Modes modes, bool is_file);
+  bool IsFileOpened(const std::string& path) const;
+  bool IsDirectoryInUse(const std::string& path) const;
+
+  std::unique_ptr<Node> MakeRootNode() const;
+  Node* GetNodeForPath(const std::string& path);
+  std::span<const u8> GetContents(const Node& node) const;
+  std::vector<u8>& GetModifiableContents(Node& node);
+
+  bool Load();
+  bool Save(bool rewrite);
+  bool Import();
+
+  std::string m_root_path;
+  std::string m_pack_path;
+  File::IOFile m_file;
+  File::MappedFile m_mapping;
+  /// How much of the pack is used by the current contents and index.
+  u64 m_used_size = 0;
+
+  std::unique_ptr<Node> m_root;
+  bool m_dirty = false;
+  std::array<Handle, 16> m_handles{};
+};
+}  // namespace IOS::HLE::FS
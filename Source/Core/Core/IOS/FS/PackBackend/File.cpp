@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/PackBackend/FS.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace IOS::HLE::FS
+{
+Result<FileHandle> PackFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
+{
+  Handle* handle = AssignFreeHandle();
+  if (!handle)
+    return ResultCode::NoFreeHandle;
+
+  Node* node = GetNodeForPath(path);
+  if (!node)
+  {
+    *handle = Handle{};
+    return ResultCode::NotFound;
+  }
+
+  if (!node->data.is_file)
+  {
+    *handle = Handle{};
+    return ResultCode::Invalid;
+  }
+
+  handle->node = node;
+  handle->wii_path = path;
+  handle->mode = mode;
+  handle->file_offset = 0;
+  return FileHandle{this, ConvertHandleToFd(handle)};
+}
+
+ResultCode PackFileSystem::Close(Fd fd)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  *handle = Handle{};
+
+  return ResultCode::Success;
+}
+
+Result<u32> PackFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Read)) == 0)
+    return ResultCode::AccessDenied;
+
+  const std::span<const u8> contents = GetContents(*handle->node);
+  // IOS has this check in the read request handler.
+  if (count + handle->file_offset > contents.size())
+    count = static_cast<u32>(contents.size()) - handle->file_offset;
+
+  if (count != 0)
+    std::memcpy(ptr, contents.data() + handle->file_offset, count);
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> PackFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Write)) == 0)
+    return ResultCode::AccessDenied;
+
+  std::vector<u8>& contents = GetModifiableContents(*handle->node);
+  if (handle->file_offset + count > contents.size())
+    contents.resize(handle->file_offset + count);
+  std::memcpy(contents.data() + handle->file_offset, ptr, count);
+  handle->node->data.size = static_cast<u32>(contents.size());
+
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> PackFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  const u32 size = handle->node->data.size;
+  u32 new_position = 0;
+  switch (mode)
+  {
+  case SeekMode::Set:
+    new_position = offset;
+    break;
+  case SeekMode::Current:
+    new_position = handle->file_offset + offset;
+    break;
+  case SeekMode::End:
+    new_position = size + offset;
+    break;
+  default:
+    return ResultCode::Invalid;
+  }
+
+  // This differs from POSIX behaviour which allows seeking past the end of the file.
+  if (size < new_position)
+    return ResultCode::Invalid;
+
+  handle->file_offset = new_position;
+  return handle->file_offset;
+}
+
+Result<FileStatus> PackFileSystem::GetFileStatus(Fd fd)
+{
+  const Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  FileStatus status;
+  status.size = handle->node->data.size;
+  status.offset = handle->file_offset;
+  return status;
+}
+
+PackFileSystem::Handle* PackFileSystem::AssignFreeHandle()
+{
+  const auto it =
+      std::ranges::find_if(m_handles, [](const Handle& handle) { return !handle.opened; });
+  if (it == m_handles.end())
+    return nullptr;
+
+  *it = Handle{};
+  it->opened = true;
+  return &*it;
+}
+
+PackFileSystem::Handle* PackFileSystem::GetHandleFromFd(Fd fd)
+{
+  if (fd >= m_handles.size() || !m_handles[fd].opened)
+    return nullptr;
+  return &m_handles[fd];
+}
+
+Fd PackFileSystem::ConvertHandleToFd(const Handle* handle) const
+{
+  return handle - m_handles.data();
+}
+}  // namespace IOS::HLE::FS
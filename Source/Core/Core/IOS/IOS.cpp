@@ -337,6 +337,8 @@ EmulationKernel::~EmulationKernel()
 {
   m_system.GetCoreTiming().RemoveAllEvents(s_event_enqueue);
 
+  LogIPCStats();
+
   m_device_map.clear();
   m_socket_manager.reset();
 }
@@ -699,7 +701,9 @@ std::optional<IPCReply> EmulationKernel::OpenDevice(OpenRequest& request)
     return IPCReply{IPC_ENOENT, 3700_tbticks};
   }
 
+  const u64 wall_time_before = Common::Timer::NowUs();
   std::optional<IPCReply> result = device->Open(request);
+  device->AddToIPCStats(IPC_CMD_OPEN, Common::Timer::NowUs() - wall_time_before);
   if (result && result->return_value >= IPC_SUCCESS)
   {
     m_fdmap[new_fd] = device;
@@ -719,10 +723,14 @@ std::optional<IPCReply> EmulationKernel::HandleIPCCommand(const Request& request
     return OpenDevice(open_request);
   }
 
-  const auto device = GetDeviceByFileDescriptor(request.fd);
+  // Devices can only go away when their descriptor is closed, so there is no need to hold a
+  // reference to them for any other command.
+  Device* const device = request.fd < IPC_MAX_FDS ? m_fdmap[request.fd].get() :
+                                                    GetDeviceByFileDescriptor(request.fd).get();
   if (!device)
     return IPCReply{IPC_EINVAL, 550_tbticks};
 
+  std::shared_ptr<Device> closed_device;
   std::optional<IPCReply> ret;
   const u64 wall_time_before = Common::Timer::NowUs();
 
@@ -731,7 +739,7 @@ std::optional<IPCReply> EmulationKernel::HandleIPCCommand(const Request& request
   case IPC_CMD_CLOSE:
     // if the fd is not a special IOS FD, we need to reset it too
     if (request.fd < IPC_MAX_FDS)
-      m_fdmap[request.fd].reset();
+      closed_device = std::move(m_fdmap[request.fd]);
     ret = device->Close(request.fd);
     break;
   case IPC_CMD_READ:
@@ -756,6 +764,7 @@ std::optional<IPCReply> EmulationKernel::HandleIPCCommand(const Request& request
   }
 
   const u64 wall_time_after = Common::Timer::NowUs();
+  device->AddToIPCStats(request.command, wall_time_after - wall_time_before);
   constexpr u64 BLOCKING_IPC_COMMAND_THRESHOLD_US = 2000;
   if (wall_time_after - wall_time_before > BLOCKING_IPC_COMMAND_THRESHOLD_US)
   {
@@ -843,6 +852,58 @@ void EmulationKernel::UpdateIPC()
   }
 }
 
+u64 IPCStats::GetRequestCount() const
+{
+  u64 count = 0;
+  for (const u64 command_count : request_counts)
+    count += command_count;
+  return count;
+}
+
+void IPCStats::Add(IPCCommandType command, u64 time_us)
+{
+  if (command < request_counts.size())
+    ++request_counts[command];
+  host_time_us += time_us;
+  max_host_time_us = std::max(max_host_time_us, time_us);
+}
+
+std::vector<EmulationKernel::DeviceIPCStats> EmulationKernel::GetIPCStats() const
+{
+  std::vector<DeviceIPCStats> result;
+  const auto add_device = [&result](const Device& device) {
+    if (device.GetIPCStats().GetRequestCount() != 0)
+      result.push_back({device.GetDeviceName(), device.GetIPCStats()});
+  };
+
+  for (const auto& entry : m_device_map)
+    add_device(*entry.second);
+  // Dynamically created devices are only reachable through their descriptor.
+  for (const auto& device : m_fdmap)
+  {
+    if (device && device->GetDeviceType() != Device::DeviceType::Static)
+      add_device(*device);
+  }
+  return result;
+}
+
+void EmulationKernel::LogIPCStats() const
+{
+  for (const DeviceIPCStats& entry : GetIPCStats())
+  {
+    const IPCStats& stats = entry.stats;
+    const u64 count = stats.GetRequestCount();
+    INFO_LOG_FMT(IOS,
+                 "{}: {} requests ({} opens, {} closes, {} reads, {} writes, {} seeks, "
+                 "{} ioctls, {} ioctlvs), {} us average and {} us max host time",
+                 entry.device_name, count, stats.request_counts[IPC_CMD_OPEN],
+                 stats.request_counts[IPC_CMD_CLOSE], stats.request_counts[IPC_CMD_READ],
+                 stats.request_counts[IPC_CMD_WRITE], stats.request_counts[IPC_CMD_SEEK],
+                 stats.request_counts[IPC_CMD_IOCTL], stats.request_counts[IPC_CMD_IOCTLV],
+                 stats.host_time_us / count, stats.max_host_time_us);
+  }
+}
+
 void EmulationKernel::UpdateDevices()
 {
   // Check if a hardware device must be updated
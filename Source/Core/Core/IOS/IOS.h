@@ -101,6 +101,18 @@ enum IPCCommandType : u32
   IPC_REPLY = 8,
 };
 
+// Host-side statistics about the requests that have been handled by a device.
+struct IPCStats
+{
+  // Indexed by IPCCommandType.
+  std::array<u64, IPC_REPLY> request_counts{};
+  u64 host_time_us = 0;
+  u64 max_host_time_us = 0;
+
+  u64 GetRequestCount() const;
+  void Add(IPCCommandType command, u64 time_us);
+};
+
 enum class MemorySetupType
 {
   IOSReload,
@@ -169,6 +181,16 @@ public:
 
   std::shared_ptr<WiiSockMan> GetSocketManager();
 
+  struct DeviceIPCStats
+  {
+    std::string device_name;
+    IPCStats stats;
+  };
+  // Returns the statistics of every device that has handled requests. Must be called on the CPU
+  // thread.
+  std::vector<DeviceIPCStats> GetIPCStats() const;
+  void LogIPCStats() const;
+
   void HandleIPCEvent(u64 userdata);
   void UpdateIPC();
 
@@ -261,7 +261,7 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+void WiiSocket::Update()
 {
   auto& system = m_socket_manager.m_ios.GetSystem();
   auto& memory = system.GetMemory();
@@ -996,51 +996,21 @@ void WiiSockMan::EnqueueIPCReply(const Request& request, s32 return_value) const
 
 void WiiSockMan::Update()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
-
-  auto socket_iter = WiiSockets.begin();
-  auto end_socks = WiiSockets.end();
-
-  while (socket_iter != end_socks)
+  // Pending operations are retried without blocking, so there is no need to find out which
+  // sockets are ready beforehand. Only sockets with pending operations have anything to do.
+  for (auto socket_iter = WiiSockets.begin(); socket_iter != WiiSockets.end();)
   {
-    const WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
-    {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
-      ++socket_iter;
-    }
-    else
+    WiiSocket& sock = socket_iter->second;
+    if (!sock.IsValid())
     {
       // Good time to clean up invalid sockets.
       socket_iter = WiiSockets.erase(socket_iter);
+      continue;
     }
-  }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
-  {
-    for (auto& pair : WiiSockets)
-    {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
-    }
+    if (!sock.pending_sockops.empty())
+      sock.Update();
+    ++socket_iter;
   }
   UpdatePollCommands();
 }
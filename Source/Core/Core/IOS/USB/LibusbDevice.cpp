@@ -4,6 +4,7 @@
 #include "Core/IOS/USB/LibusbDevice.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <functional>
@@ -50,6 +51,9 @@ LibusbDevice::LibusbDevice(EmulationKernel& ios, libusb_device* device,
 
 LibusbDevice::~LibusbDevice()
 {
+  for (auto& [endpoint, transfer_endpoint] : m_transfer_endpoints)
+    transfer_endpoint.LogLatencyStats(*this, endpoint);
+
   if (m_handle != nullptr)
   {
     ReleaseAllInterfacesForCurrentConfig();
@@ -256,8 +260,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   libusb_transfer* transfer = libusb_alloc_transfer(0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   libusb_fill_control_transfer(transfer, m_handle, buffer.release(), CtrlTransferCallback, this, 0);
-  m_transfer_endpoints[0].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return m_transfer_endpoints[0].SubmitTransfer(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
@@ -273,8 +276,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
                             cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
                             this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return m_transfer_endpoints[transfer->endpoint].SubmitTransfer(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
@@ -290,8 +292,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
                                  cmd->MakeBuffer(cmd->length).release(), cmd->length,
                                  TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return m_transfer_endpoints[transfer->endpoint].SubmitTransfer(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
@@ -316,8 +317,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return m_transfer_endpoints[transfer->endpoint].SubmitTransfer(std::move(cmd), transfer);
 }
 
 void LibusbDevice::CtrlTransferCallback(libusb_transfer* transfer)
@@ -360,11 +360,21 @@ static const std::map<u8, const char*> s_transfer_types = {
     {LIBUSB_TRANSFER_TYPE_INTERRUPT, "Interrupt"},
 };
 
-void LibusbDevice::TransferEndpoint::AddTransfer(std::unique_ptr<TransferCommand> command,
-                                                 libusb_transfer* transfer)
+int LibusbDevice::TransferEndpoint::SubmitTransfer(std::unique_ptr<TransferCommand> command,
+                                                   libusb_transfer* transfer)
 {
+  // The lock is held across the submission so that the callback, which may run on the event
+  // thread as soon as the transfer is submitted, always finds the transfer in the map.
   std::lock_guard lk{m_transfers_mutex};
-  m_transfers.emplace(transfer, std::move(command));
+  m_transfers.emplace(transfer, PendingTransfer{std::move(command), Clock::now()});
+  const int ret = libusb_submit_transfer(transfer);
+  if (ret != LIBUSB_SUCCESS)
+  {
+    m_transfers.erase(transfer);
+    const std::unique_ptr<u8[]> buffer(transfer->buffer);
+    libusb_free_transfer(transfer);
+  }
+  return ret;
 }
 
 void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
@@ -378,8 +388,13 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     return;
   }
 
+  const Clock::duration latency = Clock::now() - iterator->second.submit_time;
+  ++m_completed_transfers;
+  m_total_latency += latency;
+  m_max_latency = std::max(m_max_latency, latency);
+
   const std::unique_ptr<u8[]> buffer(transfer->buffer);
-  const auto& cmd = *iterator->second.get();
+  const auto& cmd = *iterator->second.command;
   const auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   s32 return_value = LIBUSB_SUCCESS;
   switch (transfer->status)
@@ -416,6 +431,21 @@ void LibusbDevice::TransferEndpoint::CancelTransfers()
     libusb_cancel_transfer(pending_transfer.first);
 }
 
+void LibusbDevice::TransferEndpoint::LogLatencyStats(const LibusbDevice& device, u8 endpoint)
+{
+  std::lock_guard lk(m_transfers_mutex);
+  if (m_completed_transfers == 0)
+    return;
+
+  using std::chrono::microseconds;
+  const auto average = std::chrono::duration_cast<microseconds>(m_total_latency).count() /
+                       static_cast<s64>(m_completed_transfers);
+  const auto max = std::chrono::duration_cast<microseconds>(m_max_latency).count();
+  INFO_LOG_FMT(IOS_USB,
+               "[{:04x}:{:04x}] Endpoint {:#04x}: {} transfer(s), average latency {} us, max {} us",
+               device.m_vid, device.m_pid, endpoint, m_completed_transfers, average, max);
+}
+
 int LibusbDevice::GetNumberOfAltSettings(const u8 interface_number)
 {
   return m_config_descriptors[0]->interface[interface_number].num_altsetting;
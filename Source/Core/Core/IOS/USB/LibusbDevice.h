@@ -4,6 +4,7 @@
 #pragma once
 
 #if defined(__LIBUSB__)
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <map>
@@ -60,13 +61,29 @@ private:
   class TransferEndpoint final
   {
   public:
-    void AddTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
+    // Tracks and submits the transfer. If submitting fails, the transfer and its buffer
+    // are freed here, as libusb never calls back for a transfer that was not submitted.
+    int SubmitTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
     void HandleTransfer(libusb_transfer* tr, std::function<s32(const TransferCommand&)> function);
     void CancelTransfers();
+    void LogLatencyStats(const LibusbDevice& device, u8 endpoint);
 
   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PendingTransfer
+    {
+      std::unique_ptr<TransferCommand> command;
+      Clock::time_point submit_time;
+    };
+
     std::mutex m_transfers_mutex;
-    std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
+    std::map<libusb_transfer*, PendingTransfer> m_transfers;
+
+    // Time from submission to completion, for transfers that have completed.
+    u64 m_completed_transfers = 0;
+    Clock::duration m_total_latency{};
+    Clock::duration m_max_latency{};
   };
   std::map<u8, TransferEndpoint> m_transfer_endpoints;
   static void CtrlTransferCallback(libusb_transfer* transfer);
@@ -0,0 +1,172 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/InputLatency.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
+#include "InputCommon/GCPadStatus.h"
+#include "VideoCommon/LatencyLimiter.h"
+#include "VideoCommon/OnScreenDisplay.h"
+
+namespace InputLatency
+{
+namespace
+{
+constexpr u16 TRACED_BUTTONS = PAD_BUTTON_LEFT | PAD_BUTTON_RIGHT | PAD_BUTTON_DOWN |
+                               PAD_BUTTON_UP | PAD_TRIGGER_Z | PAD_TRIGGER_R | PAD_TRIGGER_L |
+                               PAD_BUTTON_A | PAD_BUTTON_B | PAD_BUTTON_X | PAD_BUTTON_Y |
+                               PAD_BUTTON_START;
+
+// A press that hasn't reached the game by then was most likely dropped, e.g. by movie playback.
+constexpr auto TRACE_TIMEOUT = std::chrono::seconds(1);
+constexpr auto REPORT_INTERVAL = std::chrono::seconds(2);
+
+enum class TraceState
+{
+  None,
+  Sampled,
+  Polled,
+};
+
+struct Trace
+{
+  TraceState state = TraceState::None;
+  u16 buttons = 0;
+  Clock::time_point sample_time;
+  Clock::time_point poll_time;
+};
+
+std::array<u16, 4> s_last_buttons{};
+std::array<Trace, 4> s_traces;
+
+std::mutex s_stats_mutex;
+Stats s_stats;
+u64 s_reported_count = 0;
+Clock::time_point s_last_report;
+
+double ToMs(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void AddSample(StageStats& stage, double ms)
+{
+  ++stage.count;
+  stage.total_ms += ms;
+  stage.max_ms = std::max(stage.max_ms, ms);
+}
+
+void Report(Clock::time_point now)
+{
+  std::lock_guard lk(s_stats_mutex);
+  if (s_stats.total.count == s_reported_count || now - s_last_report < REPORT_INTERVAL)
+    return;
+
+  s_reported_count = s_stats.total.count;
+  s_last_report = now;
+  std::string message = fmt::format("Input latency: {:.1f} ms average, {:.1f} ms max "
+                                    "({:.1f} ms to SI poll, {:.1f} ms to field output)",
+                                    s_stats.total.GetAverageMs(), s_stats.total.max_ms,
+                                    s_stats.host_to_poll.GetAverageMs(),
+                                    s_stats.poll_to_field.GetAverageMs());
+  if (s_stats.total_to_display.count != 0)
+  {
+    message += fmt::format("\nInput to photon: {:.1f} ms average, {:.1f} ms max",
+                           s_stats.total_to_display.GetAverageMs(),
+                           s_stats.total_to_display.max_ms);
+  }
+  OSD::AddMessage(std::move(message), OSD::Duration::NORMAL);
+}
+}  // namespace
+
+void Shutdown()
+{
+  s_last_buttons = {};
+  s_traces = {};
+
+  std::lock_guard lk(s_stats_mutex);
+  s_stats = {};
+  s_reported_count = 0;
+}
+
+void OnLocalInput(int pad, const GCPadStatus& status, Clock::time_point sample_time)
+{
+  if (!Config::Get(Config::MAIN_INPUT_LATENCY_TRACING))
+    return;
+
+  const u16 buttons = status.button & TRACED_BUTTONS;
+  const u16 pressed = buttons & ~s_last_buttons[pad];
+  s_last_buttons[pad] = buttons;
+
+  Trace& trace = s_traces[pad];
+  if (trace.state != TraceState::None && sample_time - trace.sample_time > TRACE_TIMEOUT)
+    trace.state = TraceState::None;
+
+  // Only one press per pad is followed at a time, so they can't be mixed up.
+  if (!pressed || trace.state != TraceState::None)
+    return;
+
+  trace.state = TraceState::Sampled;
+  trace.buttons = pressed;
+  trace.sample_time = sample_time;
+}
+
+void OnPoll(int pad, const GCPadStatus& status)
+{
+  Trace& trace = s_traces[pad];
+  if (trace.state != TraceState::Sampled || (status.button & trace.buttons) != trace.buttons)
+    return;
+
+  trace.state = TraceState::Polled;
+  trace.poll_time = Clock::now();
+}
+
+void OnFieldOutput()
+{
+  const Clock::time_point now = Clock::now();
+  const double field_to_display = ToMs(g_latency_limiter.GetFieldToDisplayLatency());
+  bool any_finished = false;
+  for (size_t pad = 0; pad < s_traces.size(); ++pad)
+  {
+    Trace& trace = s_traces[pad];
+    if (trace.state != TraceState::Polled)
+      continue;
+    trace.state = TraceState::None;
+    any_finished = true;
+
+    const double host_to_poll = ToMs(trace.poll_time - trace.sample_time);
+    const double poll_to_field = ToMs(now - trace.poll_time);
+    DEBUG_LOG_FMT(SERIALINTERFACE,
+                  "Input latency of pad {}: {:.2f} ms to SI poll, {:.2f} ms to field output", pad,
+                  host_to_poll, poll_to_field);
+
+    std::lock_guard lk(s_stats_mutex);
+    AddSample(s_stats.host_to_poll, host_to_poll);
+    AddSample(s_stats.poll_to_field, poll_to_field);
+    AddSample(s_stats.total, host_to_poll + poll_to_field);
+    if (field_to_display != 0)
+    {
+      AddSample(s_stats.field_to_display, field_to_display);
+      AddSample(s_stats.total_to_display, host_to_poll + poll_to_field + field_to_display);
+    }
+  }
+
+  if (any_finished)
+    Report(now);
+}
+
+Stats GetStats()
+{
+  std::lock_guard lk(s_stats_mutex);
+  return s_stats;
+}
+}  // namespace InputLatency
@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Input latency tracing follows button presses on GameCube controllers from the host devices to
+// the emulated field that is output after the game has read them.
+//
+// A press is timestamped when the host devices are polled, and again when the emulated SI hands it
+// to the game. With NetPlay, the time in between includes the time the input spent in the pad
+// buffer. The field output after that is the earliest one that can show the effect of the press,
+// so the totals are a lower bound of what the player sees. The time from the field output to the
+// display, as measured by the latency limiter, is added on top of that for input-to-photon totals.
+
+#pragma once
+
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+
+struct GCPadStatus;
+
+namespace InputLatency
+{
+using Clock = std::chrono::steady_clock;
+
+struct StageStats
+{
+  u64 count = 0;
+  double total_ms = 0;
+  double max_ms = 0;
+
+  double GetAverageMs() const { return count ? total_ms / count : 0; }
+};
+
+struct Stats
+{
+  // From polling the host devices to the SI poll that handed the input to the game.
+  StageStats host_to_poll;
+  // From the SI poll to the next field that is output.
+  StageStats poll_to_field;
+  StageStats total;
+  // From the field output to its display, as measured by the latency limiter. Only counted once
+  // something has been presented.
+  StageStats field_to_display;
+  // Input-to-photon: from polling the host devices to the display.
+  StageStats total_to_display;
+};
+
+void Shutdown();
+
+// These are all called on the CPU thread.
+
+// Called when the input of a local pad has been read. pad is the in-game pad, and sample_time is
+// when the host devices it comes from were last polled.
+void OnLocalInput(int pad, const GCPadStatus& status, Clock::time_point sample_time);
+// Called when the emulated SI hands the input of a pad to the game.
+void OnPoll(int pad, const GCPadStatus& status);
+// Called when the VI outputs a field.
+void OnFieldOutput();
+
+Stats GetStats();
+}  // namespace InputLatency
@@ -3,23 +3,104 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <new>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
+#include <unordered_set>
 
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+static_assert(std::atomic<u32>::is_always_lock_free && std::atomic<u64>::is_always_lock_free,
+              "The shared memory counters must be usable from other processes");
+
+namespace
+{
+// Returns the host memory backing the page that address is in, or nullptr if reads from it have
+// to go through the MMU.
+const u8* GetHostPage(Core::System& system, u32 address)
+{
+  auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache)
+    return nullptr;
+
+  u32 physical = address;
+  if (ppc_state.msr.DR)
+  {
+    const std::optional<u32> translated = system.GetMMU().GetTranslatedAddress(address);
+    if (!translated)
+      return nullptr;
+    physical = *translated;
+  }
+  physical &= ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+
+  auto& memory = system.GetMemory();
+  if (physical < memory.GetRamSizeReal())
+    return memory.GetRAM() + physical;
+  const u32 exram_offset = physical & 0x0FFFFFFF;
+  if (memory.GetEXRAM() && (physical >> 28) == 0x1 && exram_offset < memory.GetExRamSizeReal())
+    return memory.GetEXRAM() + exram_offset;
+  return nullptr;
+}
+
+// Remembers the last page that was looked up, which is all the reuse there is when the addresses
+// are looked up in order.
+class PageCache
+{
+public:
+  explicit PageCache(Core::System& system) : m_system(system) {}
+
+  const u8* Get(u32 address)
+  {
+    const u32 page = address & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    if (!m_valid || page != m_page)
+    {
+      m_valid = true;
+      m_page = page;
+      m_host = GetHostPage(m_system, page);
+    }
+    return m_host;
+  }
+
+private:
+  Core::System& m_system;
+  bool m_valid = false;
+  u32 m_page = 0;
+  const u8* m_host = nullptr;
+};
+}  // namespace
 
 MemoryWatcher::MemoryWatcher()
 {
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+
+  m_use_shared_memory = Config::Get(Config::MAIN_MEMORY_WATCHER_SHARED_MEMORY);
+  if (m_use_shared_memory)
+  {
+    if (!OpenSharedMemory(File::GetUserPath(F_MEMORYWATCHERSHAREDMEMORY_IDX)))
+      return;
+  }
+  else if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  {
     return;
+  }
   m_running = true;
 }
 
@@ -29,6 +110,8 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
+  if (m_shared_header)
+    munmap(m_shared_header, m_shared_size);
   close(m_fd);
 }
 
@@ -39,23 +122,27 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  std::unordered_set<std::string> seen;
   std::string line;
   while (std::getline(locations, line))
-    ParseLine(line);
+  {
+    if (seen.insert(line).second)
+      ParseLine(line);
+  }
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch& watch = m_watches.emplace_back();
+  watch.line = line;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,46 +154,145 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+bool MemoryWatcher::OpenSharedMemory(const std::string& path)
 {
-  u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (m_fd < 0)
+  {
+    ERROR_LOG_FMT(CORE, "MemoryWatcher: Failed to create {}", path);
+    return false;
+  }
+
+  m_shared_size = sizeof(SharedMemoryHeader) + m_watches.size() * sizeof(SharedMemoryEntry);
+  void* const data = ftruncate(m_fd, m_shared_size) == 0 ?
+                         mmap(nullptr, m_shared_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0) :
+                         MAP_FAILED;
+  if (data == MAP_FAILED)
   {
-    value = PowerPC::MMU::HostRead_U32(guard, value + offset);
-    if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
-      break;
+    ERROR_LOG_FMT(CORE, "MemoryWatcher: Failed to map {}", path);
+    close(m_fd);
+    return false;
   }
-  return value;
+
+  // The file was just truncated, so the entries are already zeroed.
+  m_shared_header = new (data) SharedMemoryHeader{SHARED_MEMORY_MAGIC, SHARED_MEMORY_VERSION,
+                                                   static_cast<u32>(m_watches.size()), 0, 0};
+  m_shared_entries = reinterpret_cast<SharedMemoryEntry*>(m_shared_header + 1);
+  return true;
 }
 
-std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
+void MemoryWatcher::ReadValues(const Core::CPUThreadGuard& guard)
 {
-  std::ostringstream message_stream;
-  message_stream << std::hex;
+  Core::System& system = guard.GetSystem();
 
-  for (auto& entry : m_values)
+  m_new_values.assign(m_watches.size(), 0);
+  m_pending_reads.clear();
+  for (u32 i = 0; i < m_watches.size(); ++i)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
+    if (!m_watches[i].offsets.empty())
+      m_pending_reads.push_back({m_watches[i].offsets[0], 0, i});
+  }
 
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+  // Follow all of the pointer chains one step at a time. That way, the reads of each step can be
+  // sorted so that each page only has to be translated once.
+  for (size_t depth = 0; !m_pending_reads.empty(); ++depth)
+  {
+    std::sort(m_pending_reads.begin(), m_pending_reads.end(),
+              [](const PendingRead& a, const PendingRead& b) { return a.address < b.address; });
+
+    PageCache pages(system);
+    PageCache bases(system);
+    size_t next_count = 0;
+    for (size_t i = 0; i < m_pending_reads.size(); ++i)
+    {
+      const PendingRead read = m_pending_reads[i];
+
+      // A pointer that doesn't point to RAM ends the chain, and is the watched value itself.
+      if (depth > 0 && !bases.Get(read.base) &&
+          !PowerPC::MMU::HostIsRAMAddress(guard, read.base))
+      {
+        continue;
+      }
+
+      const u8* const page = pages.Get(read.address);
+      const u32 page_offset = read.address & PowerPC::HW_PAGE_MASK;
+      u32 value;
+      if (page && page_offset <= PowerPC::HW_PAGE_SIZE - sizeof(u32))
+      {
+        std::memcpy(&value, page + page_offset, sizeof(u32));
+        value = Common::swap32(value);
+      }
+      else
+      {
+        value = PowerPC::MMU::HostRead_U32(guard, read.address);
+      }
+      m_new_values[read.watch] = value;
+
+      const std::vector<u32>& offsets = m_watches[read.watch].offsets;
+      if (depth + 1 < offsets.size())
+        m_pending_reads[next_count++] = {value + offsets[depth + 1], value, read.watch};
+    }
+    m_pending_reads.resize(next_count);
+  }
+
+  m_changed.clear();
+  for (u32 i = 0; i < m_watches.size(); ++i)
+  {
+    if (m_new_values[i] != m_watches[i].value)
     {
-      // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      m_watches[i].value = m_new_values[i];
+      m_changed.push_back(i);
     }
   }
+}
+
+std::string MemoryWatcher::ComposeMessages()
+{
+  std::ostringstream message_stream;
+  message_stream << std::hex;
+
+  for (u32 i : m_changed)
+    message_stream << m_watches[i].line << '\n' << m_watches[i].value << '\n';
 
   return message_stream.str();
 }
 
+void MemoryWatcher::PublishValues()
+{
+  ++m_frame;
+
+  if (!m_changed.empty())
+  {
+    const u32 sequence = m_shared_header->sequence.load(std::memory_order_relaxed);
+    m_shared_header->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (u32 i : m_changed)
+      m_shared_entries[i] = {m_watches[i].value, static_cast<u32>(m_frame)};
+
+    m_shared_header->sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  m_shared_header->frame.store(m_frame, std::memory_order_release);
+}
+
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
 {
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages(guard);
+  ReadValues(guard);
+
+  if (m_use_shared_memory)
+  {
+    PublishValues();
+    return;
+  }
+
+  if (m_changed.empty())
+    return;
+
+  std::string message = ComposeMessages();
   sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
          sizeof(m_addr));
 }
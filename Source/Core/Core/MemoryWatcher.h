@@ -5,7 +5,7 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
+#include <atomic>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -24,28 +24,82 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// If MAIN_MEMORY_WATCHER_SHARED_MEMORY is enabled, the values are instead published to a file
+// that other processes can map, which doesn't cost them a syscall per value. The file starts with
+// a SharedMemoryHeader, followed by one SharedMemoryEntry per unique line of the input file, in
+// the order they first appear in it. All fields are in host byte order.
+//
+// The entries are guarded by the header's sequence counter, which is odd while they are being
+// written. To get a consistent snapshot, read the sequence, copy the entries, and read the
+// sequence again; retry if it was odd or has changed.
 class MemoryWatcher final
 {
 public:
+  static constexpr u32 SHARED_MEMORY_MAGIC = 0x5357444D;  // "MDWS"
+  static constexpr u32 SHARED_MEMORY_VERSION = 1;
+
+  struct SharedMemoryHeader
+  {
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    std::atomic<u32> sequence;
+    // Incremented every frame, whether or not any value changed.
+    std::atomic<u64> frame;
+  };
+
+  struct SharedMemoryEntry
+  {
+    u32 value;
+    // The low 32 bits of the frame counter when the value last changed.
+    u32 changed_frame;
+  };
+
   MemoryWatcher();
   ~MemoryWatcher();
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  struct Watch
+  {
+    // Address as stored in the file
+    std::string line;
+    // List of offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  bool OpenSharedMemory(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
-  std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  void ReadValues(const Core::CPUThreadGuard& guard);
+  std::string ComposeMessages();
+  void PublishValues();
 
   bool m_running = false;
+  bool m_use_shared_memory = false;
 
-  int m_fd;
+  int m_fd = -1;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  SharedMemoryHeader* m_shared_header = nullptr;
+  SharedMemoryEntry* m_shared_entries = nullptr;
+  size_t m_shared_size = 0;
+  u64 m_frame = 0;
+
+  std::vector<Watch> m_watches;
+
+  // Scratch space for ReadValues, kept around to avoid allocating every frame.
+  struct PendingRead
+  {
+    u32 address;
+    u32 base;
+    u32 watch;
+  };
+  std::vector<u32> m_new_values;
+  std::vector<PendingRead> m_pending_reads;
+  std::vector<u32> m_changed;
 };
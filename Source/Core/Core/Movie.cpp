@@ -20,6 +20,7 @@
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
@@ -46,10 +47,12 @@
 #include "Core/CoreTiming.h"
 #include "Core/DSP/DSPCore.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/DSP.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 #include "Core/HW/EXI/EXI_DeviceMemoryCard.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SI/SI_Device.h"
@@ -65,6 +68,7 @@
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
 #include "Core/NetPlayProto.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiUtils.h"
@@ -84,6 +88,21 @@ namespace Movie
 using namespace WiimoteCommon;
 using namespace WiimoteEmu;
 
+// Checkpoints are kept next to the recording rather than in it, so that other programs that parse
+// DTM files aren't affected by them.
+#pragma pack(push, 1)
+struct CheckpointsHeader
+{
+  std::array<char, 4> magic;
+  u32 version;
+  u32 interval;  // Frames between two checkpoints
+  u32 count;
+};
+#pragma pack(pop)
+
+constexpr std::array<char, 4> CHECKPOINTS_MAGIC{'D', 'T', 'M', 'C'};
+constexpr u32 CHECKPOINTS_VERSION = 1;
+
 static bool IsMovieHeader(const std::array<u8, 4>& magic)
 {
   return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
@@ -195,9 +214,114 @@ void MovieManager::FrameUpdate()
     m_total_lag_count = m_current_lag_count;
   }
 
+  UpdateCheckpoints();
+
   m_polled = false;
 }
 
+// NOTE: CPU Thread
+u64 MovieManager::HashEmulatedState() const
+{
+  // Memory and the CPU registers are enough to catch a desync within a few frames of it happening,
+  // and hashing them is cheap enough to do every few seconds without a savestate.
+  XXH3_state_t* const state = XXH3_createState();
+  XXH3_64bits_reset(state);
+
+  auto& memory = m_system.GetMemory();
+  XXH3_64bits_update(state, memory.GetRAM(), memory.GetRamSizeReal());
+  if (m_system.IsWii())
+  {
+    // On the Wii, ARAM is part of EXRAM.
+    XXH3_64bits_update(state, memory.GetEXRAM(), memory.GetExRamSizeReal());
+  }
+  else
+  {
+    XXH3_64bits_update(state, m_system.GetDSP().GetARAMPtr(), DSP::ARAM_SIZE);
+  }
+
+  const auto& ppc_state = m_system.GetPPCState();
+  XXH3_64bits_update(state, ppc_state.gpr, sizeof(ppc_state.gpr));
+  XXH3_64bits_update(state, &ppc_state.pc, sizeof(ppc_state.pc));
+
+  const u64 hash = XXH3_64bits_digest(state);
+  XXH3_freeState(state);
+  return hash;
+}
+
+// NOTE: CPU Thread
+void MovieManager::UpdateCheckpoints()
+{
+  if (m_checkpoint_interval == 0 || m_current_frame % m_checkpoint_interval != 0)
+    return;
+
+  const auto checkpoint = std::ranges::lower_bound(m_checkpoints, m_current_frame, {},
+                                                   &Checkpoint::frame);
+  if (IsRecordingInput())
+  {
+    // Anything from this frame on belongs to a timeline that a rerecord is replacing.
+    m_checkpoints.erase(checkpoint, m_checkpoints.end());
+    m_checkpoints.push_back({m_current_frame, HashEmulatedState()});
+    return;
+  }
+
+  if (!IsPlayingInput() || checkpoint == m_checkpoints.end() ||
+      checkpoint->frame != m_current_frame)
+  {
+    return;
+  }
+
+  if (checkpoint->hash == HashEmulatedState())
+  {
+    ++m_checkpoints_verified;
+    return;
+  }
+
+  if (m_checkpoints_mismatched++ == 0)
+  {
+    Core::DisplayMessage(fmt::format("Movie desynced before frame {}", m_current_frame), 5000);
+  }
+  ERROR_LOG_FMT(CORE, "Movie: State doesn't match the recording at frame {}", m_current_frame);
+}
+
+// NOTE: Host Thread
+bool MovieManager::LoadCheckpoints(const std::string& path)
+{
+  m_checkpoints.clear();
+  m_checkpoint_interval = 0;
+  m_checkpoints_verified = 0;
+  m_checkpoints_mismatched = 0;
+
+  File::IOFile file(path, "rb");
+  CheckpointsHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != CHECKPOINTS_MAGIC ||
+      header.version != CHECKPOINTS_VERSION)
+  {
+    return false;
+  }
+
+  m_checkpoints.resize(header.count);
+  if (!file.ReadArray(m_checkpoints.data(), m_checkpoints.size()))
+  {
+    m_checkpoints.clear();
+    return false;
+  }
+
+  m_checkpoint_interval = header.interval;
+  return true;
+}
+
+// NOTE: Save State + Host Thread
+bool MovieManager::SaveCheckpoints(const std::string& path) const
+{
+  if (m_checkpoints.empty())
+    return !File::Exists(path) || File::Delete(path);
+
+  const CheckpointsHeader header{CHECKPOINTS_MAGIC, CHECKPOINTS_VERSION, m_checkpoint_interval,
+                                 static_cast<u32>(m_checkpoints.size())};
+  File::IOFile file(path, "wb");
+  return file.WriteArray(&header, 1) && file.WriteArray(m_checkpoints.data(), m_checkpoints.size());
+}
+
 // called when game is booting up, even if no movie is active,
 // but potentially after BeginRecordingInput or PlayInput has been called.
 // NOTE: EmuThread
@@ -528,6 +652,8 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
     }
 
     m_rerecords = 0;
+    m_checkpoint_interval = Config::Get(Config::MAIN_MOVIE_CHECKPOINT_INTERVAL);
+    m_checkpoints.clear();
 
     for (int i = 0; i < SerialInterface::MAX_SI_CHANNELS; ++i)
     {
@@ -964,6 +1090,8 @@ bool MovieManager::PlayInput(const std::string& movie_path,
   m_current_byte = 0;
   recording_file.Close();
 
+  LoadCheckpoints(movie_path + ".chk");
+
   // Load savestate (and skip to frame data)
   if (m_temp_header.bFromSaveState && savestate_path)
   {
@@ -1346,6 +1474,13 @@ void MovieManager::EndPlayInput(bool cont)
     m_current_byte = 0;
     m_play_mode = PlayMode::None;
     Core::DisplayMessage("Movie End.", 2000);
+    if (m_checkpoints_verified != 0 || m_checkpoints_mismatched != 0)
+    {
+      Core::DisplayMessage(fmt::format("{} of {} checkpoints matched the recording",
+                                       m_checkpoints_verified,
+                                       m_checkpoints_verified + m_checkpoints_mismatched),
+                           5000);
+    }
     m_recording_from_save_state = false;
     Config::RemoveLayer(Config::LayerType::Movie);
     // we don't clear these things because otherwise we can't resume playback if we load a movie
@@ -1354,7 +1489,12 @@ void MovieManager::EndPlayInput(bool cont)
     // delete tmpInput;
     // tmpInput = nullptr;
 
-    Core::QueueHostJob([](Core::System& system) { Core::UpdateWantDeterminism(system); });
+    Core::QueueHostJob([](Core::System& system) {
+      // Stop fast-forwarding, though the video backend can't be switched back until the next boot.
+      if (Config::Get(Config::MAIN_MOVIE_TURBO_PLAYBACK))
+        Config::DeleteKey(Config::LayerType::CurrentRun, Config::MAIN_EMULATION_SPEED);
+      Core::UpdateWantDeterminism(system);
+    });
   }
 }
 
@@ -1419,6 +1559,9 @@ void MovieManager::SaveRecording(const std::string& filename)
     success = File::CopyRegularFile(File::GetUserPath(D_STATESAVES_IDX) + "dtm.sav", stateFilename);
   }
 
+  if (success)
+    success = SaveCheckpoints(filename + ".chk");
+
   if (success)
     Core::DisplayMessage(fmt::format("DTM {} saved", filename), 2000);
   else
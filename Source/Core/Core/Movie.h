@@ -226,9 +226,21 @@ public:
   std::string GetRerecords() const;
 
 private:
+  // A hash of the emulated state at a frame of the recording, which playback is checked against.
+  struct Checkpoint
+  {
+    u64 frame;
+    u64 hash;
+  };
+
   void GetSettings();
   void CheckInputEnd();
 
+  u64 HashEmulatedState() const;
+  void UpdateCheckpoints();
+  bool LoadCheckpoints(const std::string& path);
+  bool SaveCheckpoints(const std::string& path) const;
+
   void CheckMD5();
   void GetMD5();
 
@@ -268,6 +280,11 @@ private:
   bool m_recording_from_save_state = false;
   bool m_polled = false;
 
+  u32 m_checkpoint_interval = 0;
+  std::vector<Checkpoint> m_checkpoints;
+  u64 m_checkpoints_verified = 0;
+  u64 m_checkpoints_mismatched = 0;
+
   std::string m_current_file_name;
 
   // m_input_display is used by both CPU and GPU (is mutable).
@@ -6,8 +6,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <deque>
 #include <fstream>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <span>
@@ -34,6 +36,7 @@
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
+#include "Core/AchievementManager.h"
 #include "Core/ActionReplay.h"
 #include "Core/Boot/Boot.h"
 #include "Core/Config/MainSettings.h"
@@ -63,14 +66,17 @@
 #include "Core/IOS/FS/HostBackend/FS.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/Uids.h"
+#include "Core/InputLatency.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayRollback.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
 
 #include "InputCommon/ControllerEmu/ControlGroup/Attachments.h"
+#include "InputCommon/ControllerInterface/ControllerInterface.h"
 #include "InputCommon/GCAdapter.h"
 #include "InputCommon/InputConfig.h"
 #include "UICommon/GameFile.h"
@@ -85,6 +91,64 @@ static std::mutex crit_netplay_client;
 static NetPlayClient* netplay_client = nullptr;
 static bool s_si_poll_batching = false;
 
+// Blocks of chunked data that were received before. Save data and such is usually the same every
+// time it is synced, and a transfer that failed can pick up where it left off.
+static std::mutex s_chunked_data_cache_mutex;
+static std::map<Common::SHA1::Digest, std::vector<u8>> s_chunked_data_cache;
+static std::deque<Common::SHA1::Digest> s_chunked_data_cache_order;
+static size_t s_chunked_data_cache_size = 0;
+constexpr size_t CHUNKED_DATA_CACHE_MAX_SIZE = 256 * 1024 * 1024;
+
+static bool ReadCachedChunkedDataBlock(const Common::SHA1::Digest& digest, std::span<u8> block)
+{
+  std::lock_guard lk(s_chunked_data_cache_mutex);
+  const auto it = s_chunked_data_cache.find(digest);
+  if (it == s_chunked_data_cache.end() || it->second.size() != block.size())
+    return false;
+
+  std::ranges::copy(it->second, block.begin());
+  return true;
+}
+
+// Adds the blocks that were received completely to the cache. Returns false if any of them doesn't
+// match its digest.
+static bool CacheChunkedDataBlocks(std::span<const u8> data,
+                                   std::span<const Common::SHA1::Digest> digests,
+                                   std::span<const size_t> block_bytes_received)
+{
+  bool valid = true;
+  std::lock_guard lk(s_chunked_data_cache_mutex);
+  for (size_t i = 0; i < digests.size(); ++i)
+  {
+    const size_t offset = i * CHUNKED_DATA_BLOCK_SIZE;
+    const size_t size = std::min(CHUNKED_DATA_BLOCK_SIZE, data.size() - offset);
+    if (block_bytes_received[i] != size)
+      continue;
+
+    const std::span<const u8> block = data.subspan(offset, size);
+    if (Common::SHA1::CalculateDigest(block.data(), block.size()) != digests[i])
+    {
+      valid = false;
+      continue;
+    }
+
+    if (s_chunked_data_cache.contains(digests[i]))
+      continue;
+
+    s_chunked_data_cache.emplace(digests[i], std::vector<u8>(block.begin(), block.end()));
+    s_chunked_data_cache_order.push_back(digests[i]);
+    s_chunked_data_cache_size += size;
+    while (s_chunked_data_cache_size > CHUNKED_DATA_CACHE_MAX_SIZE)
+    {
+      const auto oldest = s_chunked_data_cache.find(s_chunked_data_cache_order.front());
+      s_chunked_data_cache_size -= oldest->second.size();
+      s_chunked_data_cache.erase(oldest);
+      s_chunked_data_cache_order.pop_front();
+    }
+  }
+  return valid;
+}
+
 // called from ---GUI--- thread
 NetPlayClient::~NetPlayClient()
 {
@@ -101,6 +165,9 @@ NetPlayClient::~NetPlayClient()
     m_do_loop.Clear();
     m_thread.join();
 
+    // Keep what was received, so that it won't have to be sent again after reconnecting.
+    for (const auto& [cid, receive] : m_chunked_data_receive_queue)
+      CacheChunkedDataBlocks(receive.data, receive.block_digests, receive.block_bytes_received);
     m_chunked_data_receive_queue.clear();
     m_dialog->HideChunkedProgressDialog();
   }
@@ -545,14 +612,56 @@ void NetPlayClient::OnChunkedDataStart(sf::Packet& packet)
   std::string title;
   packet >> title;
   const u64 data_size = Common::PacketReadU64(packet);
+  u32 block_count;
+  packet >> block_count;
 
   INFO_LOG_FMT(NETPLAY, "Starting data chunk {}.", cid);
 
-  m_chunked_data_receive_queue.emplace(cid, sf::Packet{});
+  ChunkedDataReceive& receive = m_chunked_data_receive_queue[cid];
+  receive = {};
+  receive.data.resize(data_size);
+  receive.block_digests.resize(block_count);
+  for (Common::SHA1::Digest& digest : receive.block_digests)
+  {
+    for (u8& byte : digest)
+      packet >> byte;
+  }
+
+  if (block_count != (data_size + CHUNKED_DATA_BLOCK_SIZE - 1) / CHUNKED_DATA_BLOCK_SIZE)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Data chunk {} has {} blocks for {} bytes.", cid, block_count,
+                  data_size);
+    receive.block_digests.clear();
+  }
+  receive.block_bytes_received.resize(receive.block_digests.size());
+
+  // Tell the server which blocks we have from earlier transfers, so that only the others are sent.
+  sf::Packet have_packet;
+  have_packet << MessageID::ChunkedDataHave;
+  have_packet << cid << static_cast<u32>(receive.block_digests.size());
+  for (size_t i = 0; i < receive.block_digests.size(); ++i)
+  {
+    const size_t offset = i * CHUNKED_DATA_BLOCK_SIZE;
+    const size_t size = std::min<size_t>(CHUNKED_DATA_BLOCK_SIZE, data_size - offset);
+    const bool had = ReadCachedChunkedDataBlock(receive.block_digests[i],
+                                                std::span(receive.data).subspan(offset, size));
+    if (had)
+    {
+      receive.block_bytes_received[i] = size;
+      receive.bytes_received += size;
+    }
+    have_packet << u8{had};
+  }
+  Send(have_packet, CHUNKED_DATA_CHANNEL);
+
+  INFO_LOG_FMT(NETPLAY, "Already have {} of {} bytes of data chunk {}.", receive.bytes_received,
+               data_size, cid);
 
   std::vector<int> players;
   players.push_back(m_local_player->pid);
   m_dialog->ShowChunkedProgressDialog(title, data_size, players);
+  if (receive.bytes_received != 0)
+    SendChunkedDataProgress(cid, receive);
 }
 
 void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
@@ -569,8 +678,19 @@ void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
 
   INFO_LOG_FMT(NETPLAY, "Ending data chunk {}.", cid);
 
-  auto& data_packet = data_packet_iter->second;
-  OnData(data_packet);
+  const ChunkedDataReceive& receive = data_packet_iter->second;
+  if (receive.bytes_received != receive.data.size() ||
+      !CacheChunkedDataBlocks(receive.data, receive.block_digests, receive.block_bytes_received))
+  {
+    ERROR_LOG_FMT(NETPLAY, "Data chunk {} is incomplete or corrupted.", cid);
+    m_dialog->AppendChat(Common::GetStringT("Received data is corrupted."));
+  }
+  else
+  {
+    sf::Packet data_packet;
+    data_packet.append(receive.data.data(), receive.data.size());
+    OnData(data_packet);
+  }
   m_chunked_data_receive_queue.erase(data_packet_iter);
   m_dialog->HideChunkedProgressDialog();
 
@@ -592,22 +712,35 @@ void NetPlayClient::OnChunkedDataPayload(sf::Packet& packet)
     return;
   }
 
-  auto& data_packet = data_packet_iter->second;
-  while (!packet.endOfPacket())
+  ChunkedDataReceive& receive = data_packet_iter->second;
+  const u64 offset = Common::PacketReadU64(packet);
+  u64 end = offset;
+  while (!packet.endOfPacket() && end < receive.data.size())
+    packet >> receive.data[end++];
+
+  if (!packet.endOfPacket())
   {
-    u8 byte;
-    packet >> byte;
-    data_packet << byte;
+    ERROR_LOG_FMT(NETPLAY, "Data chunk {} payload at {} is out of bounds.", cid, offset);
+    return;
   }
 
-  INFO_LOG_FMT(NETPLAY, "Received {} bytes of data chunk {}.", data_packet.getDataSize(), cid);
+  receive.bytes_received += end - offset;
+  if (end != offset && !receive.block_bytes_received.empty())
+    receive.block_bytes_received[offset / CHUNKED_DATA_BLOCK_SIZE] += end - offset;
 
-  m_dialog->SetChunkedProgress(m_local_player->pid, data_packet.getDataSize());
+  INFO_LOG_FMT(NETPLAY, "Received {} bytes of data chunk {}.", receive.bytes_received, cid);
+
+  SendChunkedDataProgress(cid, receive);
+}
+
+void NetPlayClient::SendChunkedDataProgress(u32 cid, const ChunkedDataReceive& receive)
+{
+  m_dialog->SetChunkedProgress(m_local_player->pid, receive.bytes_received);
 
   sf::Packet progress_packet;
   progress_packet << MessageID::ChunkedDataProgress;
   progress_packet << cid;
-  progress_packet << sf::Uint64{data_packet.getDataSize()};
+  progress_packet << sf::Uint64{receive.bytes_received};
   Send(progress_packet, CHUNKED_DATA_CHANNEL);
 }
 
@@ -625,6 +758,9 @@ void NetPlayClient::OnChunkedDataAbort(sf::Packet& packet)
 
   INFO_LOG_FMT(NETPLAY, "Aborting data chunk {}.", cid);
 
+  // Keep the blocks that made it, so that retrying only has to send the rest.
+  const ChunkedDataReceive& receive = iter->second;
+  CacheChunkedDataBlocks(receive.data, receive.block_digests, receive.block_bytes_received);
   m_chunked_data_receive_queue.erase(iter);
   m_dialog->HideChunkedProgressDialog();
 }
@@ -870,6 +1006,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
 
     packet >> m_net_settings.efb_access_enable;
     packet >> m_net_settings.bbox_enable;
+    packet >> m_net_settings.bbox_readback_latency;
     packet >> m_net_settings.force_progressive;
     packet >> m_net_settings.efb_to_texture_enable;
     packet >> m_net_settings.xfb_to_texture_enable;
@@ -878,6 +1015,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.efb_emulate_format_changes;
     packet >> m_net_settings.safe_texture_cache_color_samples;
     packet >> m_net_settings.perf_queries_enable;
+    packet >> m_net_settings.perf_queries_stale_frames;
     packet >> m_net_settings.float_exceptions;
     packet >> m_net_settings.divide_by_zero_exceptions;
     packet >> m_net_settings.fprf;
@@ -911,6 +1049,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.defer_efb_copies;
     packet >> m_net_settings.efb_access_tile_size;
     packet >> m_net_settings.efb_access_defer_invalidation;
+    packet >> m_net_settings.efb_access_stale_frames;
     packet >> m_net_settings.savedata_load;
     packet >> m_net_settings.savedata_write;
     packet >> m_net_settings.savedata_sync_all_wii;
@@ -1531,7 +1670,13 @@ void NetPlayClient::DisplayPlayersPing()
   if (!g_ActiveConfig.bShowNetPlayPing)
     return;
 
-  OSD::AddTypedMessage(OSD::MessageType::NetPlayPing, fmt::format("Ping: {}", GetPlayersMaxPing()),
+  // ENet keeps a running mean of how many reliable packets to the server had to be resent.
+  // Lost pad data stalls every later input until it arrives, so this explains hitches that the
+  // ping alone doesn't.
+  const double packet_loss =
+      m_server ? 100.0 * m_server->packetLoss / ENET_PEER_PACKET_LOSS_SCALE : 0.0;
+  OSD::AddTypedMessage(OSD::MessageType::NetPlayPing,
+                       fmt::format("Ping: {} | Loss: {:.1f}%", GetPlayersMaxPing(), packet_loss),
                        OSD::Duration::SHORT, OSD::Color::CYAN);
 }
 
@@ -1762,6 +1907,14 @@ bool NetPlayClient::StartGame(const std::string& path)
 
   m_first_pad_status_received.fill(false);
 
+  // Rollback can't replay Wii Remote or GBA inputs, and would record replayed polls twice.
+  m_rollback.reset();
+  m_rollback_requested =
+      Config::Get(Config::NETPLAY_ROLLBACK) && !m_host_input_authority &&
+      !m_dialog->IsRecording() && !AchievementManager::GetInstance().IsHardcoreModeActive() &&
+      std::ranges::none_of(m_wiimote_map, [](PlayerId pid) { return pid > 0; }) &&
+      std::ranges::none_of(m_gba_config, [](const GBAConfig& config) { return config.enabled; });
+
   if (m_dialog->IsRecording())
   {
     auto& movie = Core::System::GetInstance().GetMovie();
@@ -2041,8 +2194,26 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
+  if (m_rollback_requested)
+  {
+    m_rollback_requested = false;
+
+    // Wii games keep state outside of savestates, in the NAND, which rolling back would desync.
+    auto& system = Core::System::GetInstance();
+    if (!system.IsWii())
+    {
+      m_rollback = std::make_shared<Rollback>(
+          system, Config::Get(Config::NETPLAY_ROLLBACK_MAX_PREDICTED_POLLS),
+          Config::Get(Config::NETPLAY_ROLLBACK_CHECKPOINT_INTERVAL));
+      INFO_LOG_FMT(NETPLAY, "Rollback enabled");
+    }
+  }
+
   if (IsFirstInGamePad(pad_nb) && batching)
   {
+    if (m_rollback)
+      m_rollback->OnBatchedPoll();
+
     sf::Packet packet;
     packet << MessageID::PadData;
 
@@ -2102,19 +2273,35 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
   }
 
-  // Now, we either use the data pushed earlier, or wait for the
-  // other clients to send it to us
-  while (m_pad_buffer[pad_nb].Size() == 0)
+  if (m_rollback)
   {
-    if (!m_is_running.IsSet())
+    // Remote inputs that haven't arrived yet are predicted, unless we're too far ahead already.
+    while (!m_rollback->GetInput(pad_nb, m_pad_buffer[pad_nb], pad_status))
     {
-      return false;
-    }
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
 
-    m_gc_pad_event.Wait();
+      m_gc_pad_event.Wait();
+    }
   }
+  else
+  {
+    // Now, we either use the data pushed earlier, or wait for the
+    // other clients to send it to us
+    while (m_pad_buffer[pad_nb].Size() == 0)
+    {
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
 
-  m_pad_buffer[pad_nb].Pop(*pad_status);
+      m_gc_pad_event.Wait();
+    }
+
+    m_pad_buffer[pad_nb].Pop(*pad_status);
+  }
 
   auto& movie = Core::System::GetInstance().GetMovie();
   if (movie.IsRecordingInput())
@@ -2188,13 +2375,27 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
            SerialInterface::SIDEVICE_WIIU_ADAPTER)
   {
     pad_status = GCAdapter::Input(local_pad);
+    InputLatency::OnLocalInput(ingame_pad, pad_status, InputLatency::Clock::now());
   }
   else
   {
     pad_status = Pad::GetStatus(local_pad);
+    InputLatency::OnLocalInput(ingame_pad, pad_status,
+                               g_controller_interface.GetLastInputUpdateTime());
   }
 
-  if (m_host_input_authority)
+  if (m_rollback)
+  {
+    // Rollback replays earlier polls with the inputs it kept, so only new polls get an input, and
+    // always exactly one.
+    if (m_rollback->NeedsLocalInput(ingame_pad, m_pad_buffer[ingame_pad].Size()))
+    {
+      m_pad_buffer[ingame_pad].Push(pad_status);
+      AddPadStateToPacket(ingame_pad, pad_status, packet);
+      data_added = true;
+    }
+  }
+  else if (m_host_input_authority)
   {
     if (m_local_player->pid != m_current_golfer)
     {
@@ -2334,6 +2535,18 @@ bool NetPlayClient::StopGame()
 
   NetPlay_Disable();
 
+  // The CPU thread can't be using it anymore now that NetPlay is disabled.
+  if (m_rollback)
+  {
+    const Rollback::Stats stats = m_rollback->GetStats();
+    m_dialog->AppendChat(fmt::format(
+        "Rollback: {} rollbacks for {} mispredicted inputs, {} polls resimulated in {:.2f} s "
+        "(longest {:.0f} ms)",
+        stats.rollbacks, stats.mispredicted_inputs, stats.resimulated_polls, stats.resim_seconds,
+        stats.max_resim_seconds * 1000));
+    m_rollback.reset();
+  }
+
   // stop game
   m_dialog->StopGame();
 
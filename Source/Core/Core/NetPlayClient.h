@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/Event.h"
 #include "Common/SPSCQueue.h"
 #include "Common/TraversalClient.h"
@@ -43,6 +44,8 @@ struct SerializedWiimoteState;
 
 namespace NetPlay
 {
+class Rollback;
+
 class NetPlayUI
 {
 public:
@@ -224,6 +227,11 @@ protected:
   bool m_host_input_authority = false;
   PlayerId m_current_golfer = 1;
 
+  // Whether rollback was enabled when the game was started. It is set up at the first poll, when
+  // it is known whether the game is a GameCube game.
+  bool m_rollback_requested = false;
+  std::shared_ptr<Rollback> m_rollback;
+
   // This bool will stall the client at the start of GetNetPads, used for switching input control
   // without deadlocking. Use the correspondingly named Event to wake it up.
   bool m_wait_on_input;
@@ -250,6 +258,14 @@ private:
     Failure
   };
 
+  struct ChunkedDataReceive
+  {
+    std::vector<u8> data;
+    std::vector<Common::SHA1::Digest> block_digests;
+    std::vector<size_t> block_bytes_received;
+    u64 bytes_received = 0;
+  };
+
   void SendStartGamePacket();
   void SendStopGamePacket();
 
@@ -282,6 +298,7 @@ private:
   void OnChunkedDataEnd(sf::Packet& packet);
   void OnChunkedDataPayload(sf::Packet& packet);
   void OnChunkedDataAbort(sf::Packet& packet);
+  void SendChunkedDataProgress(u32 cid, const ChunkedDataReceive& receive);
   void OnPadMapping(sf::Packet& packet);
   void OnWiimoteMapping(sf::Packet& packet);
   void OnGBAConfig(sf::Packet& packet);
@@ -342,7 +359,7 @@ private:
   u16 m_sync_ar_codes_count = 0;
   u16 m_sync_ar_codes_success_count = 0;
   bool m_sync_ar_codes_complete = false;
-  std::unordered_map<u32, sf::Packet> m_chunked_data_receive_queue;
+  std::unordered_map<u32, ChunkedDataReceive> m_chunked_data_receive_queue;
 
   u64 m_initial_rtc = 0;
   u32 m_timebase_frame = 0;
@@ -12,6 +12,7 @@
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
+#include "Core/NetPlayProto.h"
 
 namespace NetPlay
 {
@@ -297,4 +298,16 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
 
   return out_buffer;
 }
+
+std::vector<Common::SHA1::Digest> HashChunkedDataBlocks(std::span<const u8> data)
+{
+  std::vector<Common::SHA1::Digest> digests;
+  digests.reserve((data.size() + CHUNKED_DATA_BLOCK_SIZE - 1) / CHUNKED_DATA_BLOCK_SIZE);
+  for (size_t offset = 0; offset < data.size(); offset += CHUNKED_DATA_BLOCK_SIZE)
+  {
+    const size_t size = std::min(CHUNKED_DATA_BLOCK_SIZE, data.size() - offset);
+    digests.push_back(Common::SHA1::CalculateDigest(data.data() + offset, size));
+  }
+  return digests;
+}
 }  // namespace NetPlay
@@ -8,10 +8,12 @@
 #include <array>
 #include <chrono>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 
 namespace NetPlay
 {
@@ -26,4 +28,7 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
 bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+// Returns the digest of every CHUNKED_DATA_BLOCK_SIZE block of data.
+std::vector<Common::SHA1::Digest> HashChunkedDataBlocks(std::span<const u8> data);
 }  // namespace NetPlay
@@ -53,6 +53,7 @@ struct NetSettings
 
   bool efb_access_enable = false;
   bool bbox_enable = false;
+  int bbox_readback_latency = 0;
   bool force_progressive = false;
   bool efb_to_texture_enable = false;
   bool xfb_to_texture_enable = false;
@@ -61,6 +62,7 @@ struct NetSettings
   bool efb_emulate_format_changes = false;
   int safe_texture_cache_color_samples = 0;
   bool perf_queries_enable = false;
+  int perf_queries_stale_frames = 0;
   bool float_exceptions = false;
   bool divide_by_zero_exceptions = false;
   bool fprf = false;
@@ -94,6 +96,7 @@ struct NetSettings
   bool defer_efb_copies = false;
   int efb_access_tile_size = 0;
   bool efb_access_defer_invalidation = false;
+  int efb_access_stale_frames = 0;
 
   bool savedata_load = false;
   bool savedata_write = false;
@@ -144,6 +147,7 @@ enum class MessageID : u8
   ChunkedDataProgress = 0x43,
   ChunkedDataComplete = 0x44,
   ChunkedDataAbort = 0x45,
+  ChunkedDataHave = 0x46,
 
   PadData = 0x60,
   PadMapping = 0x61,
@@ -222,6 +226,9 @@ enum class SyncCodeID : u8
 
 constexpr u32 MAX_NAME_LENGTH = 30;
 constexpr size_t CHUNKED_DATA_UNIT_SIZE = 16384;
+// Chunked data is hashed in blocks of this size, so that clients can skip the blocks they already
+// have from an earlier transfer and verify the ones they receive.
+constexpr size_t CHUNKED_DATA_BLOCK_SIZE = 64 * CHUNKED_DATA_UNIT_SIZE;
 constexpr u32 MAX_ENET_MTU = 1392;  // see https://github.com/lsalzman/enet/issues/132
 
 enum : u8
@@ -0,0 +1,275 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayRollback.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "Common/Logging/Log.h"
+#include "Core/Core.h"
+#include "Core/State.h"
+
+namespace NetPlay
+{
+// Incremental checkpoints grow as emulation drifts away from their base, so it gets replaced
+// every so often.
+constexpr u32 CHECKPOINTS_PER_BASE = 30;
+
+static bool IsSameInput(const GCPadStatus& a, const GCPadStatus& b)
+{
+  return a.button == b.button && a.stickX == b.stickX && a.stickY == b.stickY &&
+         a.substickX == b.substickX && a.substickY == b.substickY &&
+         a.triggerLeft == b.triggerLeft && a.triggerRight == b.triggerRight &&
+         a.analogA == b.analogA && a.analogB == b.analogB && a.isConnected == b.isConnected;
+}
+
+Rollback::Rollback(Core::System& system, u32 max_predicted_polls, u32 checkpoint_interval)
+    : m_system(system), m_max_predicted_polls(max_predicted_polls),
+      m_checkpoint_interval(std::max<u32>(checkpoint_interval, 1)),
+      m_polls_since_checkpoint(m_checkpoint_interval)
+{
+}
+
+Rollback::~Rollback()
+{
+  if (m_resimulating)
+    Core::SetIsThrottlerTempDisabled(false);
+}
+
+bool Rollback::GetInput(int pad, Common::SPSCQueue<GCPadStatus>& buffer, GCPadStatus* status)
+{
+  PadHistory& history = m_pads[pad];
+
+  GCPadStatus input;
+  while (buffer.Pop(input))
+    AddInput(history, input);
+
+  if (history.poll_index < history.InputsEnd())
+  {
+    *status = history.inputs[history.poll_index - history.first_index];
+  }
+  else if (CanPredict(history))
+  {
+    history.predictions.push_back(history.last_input);
+    *status = history.last_input;
+  }
+  else
+  {
+    return false;
+  }
+
+  if (history.poll_index++ < history.resim_end)
+  {
+    std::lock_guard lk(m_stats_mutex);
+    ++m_stats.resimulated_polls;
+  }
+  UpdateResimulation();
+  return true;
+}
+
+bool Rollback::NeedsLocalInput(int pad, size_t buffered) const
+{
+  const PadHistory& history = m_pads[pad];
+  return history.poll_index >= history.InputsEnd() + buffered;
+}
+
+void Rollback::OnBatchedPoll()
+{
+  if (++m_polls_since_checkpoint < m_checkpoint_interval)
+    return;
+
+  m_checkpoint_due = true;
+  ScheduleJob();
+}
+
+Rollback::Stats Rollback::GetStats() const
+{
+  std::lock_guard lk(m_stats_mutex);
+  return m_stats;
+}
+
+void Rollback::AddInput(PadHistory& history, const GCPadStatus& input)
+{
+  if (!history.predictions.empty())
+  {
+    if (!IsSameInput(history.predictions.front(), input))
+    {
+      history.rollback_index = std::min(history.rollback_index, history.InputsEnd());
+      m_rollback_due = true;
+      ScheduleJob();
+
+      std::lock_guard lk(m_stats_mutex);
+      ++m_stats.mispredicted_inputs;
+    }
+    history.predictions.pop_front();
+  }
+
+  history.inputs.push_back(input);
+  history.last_input = input;
+  history.has_input = true;
+}
+
+bool Rollback::CanPredict(const PadHistory& history) const
+{
+  // Without a checkpoint from before the first prediction, a misprediction couldn't be undone.
+  return !m_checkpoints.empty() && history.has_input &&
+         history.predictions.size() < m_max_predicted_polls;
+}
+
+void Rollback::ScheduleJob()
+{
+  if (m_job_pending)
+    return;
+  m_job_pending = true;
+
+  // Pads are polled in the middle of CoreTiming events, which aren't points that savestates can
+  // be saved or loaded at. Let the host thread get the CPU thread to a safe point first.
+  Core::QueueHostJob([weak = weak_from_this()](Core::System& system) {
+    if (const std::shared_ptr<Rollback> rollback = weak.lock())
+      Core::RunOnCPUThread(system, [&rollback] { rollback->RunJob(); }, true);
+  });
+}
+
+void Rollback::RunJob()
+{
+  m_job_pending = false;
+
+  if (m_rollback_due)
+    RollBack();
+  if (m_checkpoint_due)
+    TakeCheckpoint();
+}
+
+void Rollback::TakeCheckpoint()
+{
+  m_checkpoint_due = false;
+  m_polls_since_checkpoint = 0;
+
+  Checkpoint checkpoint;
+  if (!m_base || m_checkpoints_since_base >= CHECKPOINTS_PER_BASE)
+  {
+    m_base = std::make_shared<std::vector<u8>>();
+    State::SaveIncrementalBaseToBuffer(m_system, *m_base);
+    m_checkpoints_since_base = 0;
+  }
+  else
+  {
+    State::SaveIncrementalToBuffer(m_system, checkpoint.state);
+    ++m_checkpoints_since_base;
+  }
+
+  checkpoint.base = m_base;
+  for (size_t i = 0; i < m_pads.size(); ++i)
+    checkpoint.poll_indices[i] = m_pads[i].poll_index;
+  m_checkpoints.push_back(std::move(checkpoint));
+
+  TrimCheckpoints();
+}
+
+void Rollback::TrimCheckpoints()
+{
+  // Nothing before a checkpoint that only depends on known inputs will ever be rolled back to.
+  const auto is_known = [this](const Checkpoint& checkpoint) {
+    for (size_t i = 0; i < m_pads.size(); ++i)
+    {
+      if (checkpoint.poll_indices[i] > m_pads[i].InputsEnd())
+        return false;
+    }
+    return true;
+  };
+  while (m_checkpoints.size() > 1 && is_known(m_checkpoints[1]))
+    m_checkpoints.pop_front();
+
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadHistory& history = m_pads[i];
+    while (!history.inputs.empty() && history.first_index < m_checkpoints.front().poll_indices[i])
+    {
+      history.inputs.pop_front();
+      ++history.first_index;
+    }
+  }
+}
+
+void Rollback::RollBack()
+{
+  m_rollback_due = false;
+
+  const auto checkpoint = std::find_if(
+      m_checkpoints.rbegin(), m_checkpoints.rend(), [this](const Checkpoint& candidate) {
+        for (size_t i = 0; i < m_pads.size(); ++i)
+        {
+          if (candidate.poll_indices[i] > m_pads[i].rollback_index)
+            return false;
+        }
+        return true;
+      });
+  if (checkpoint == m_checkpoints.rend())
+  {
+    // Predictions are only made after a checkpoint is taken, so this can't happen.
+    ERROR_LOG_FMT(NETPLAY, "Rollback: No checkpoint from before the misprediction");
+    for (PadHistory& history : m_pads)
+      history.rollback_index = UINT64_MAX;
+    return;
+  }
+
+  // The newer checkpoints are of a timeline that is about to be replaced.
+  m_checkpoints.erase(checkpoint.base(), m_checkpoints.end());
+  Checkpoint& target = m_checkpoints.back();
+  State::LoadIncrementalFromBuffer(m_system, *target.base, target.state);
+  m_base = target.base;
+  m_checkpoint_due = false;
+  m_polls_since_checkpoint = 0;
+
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadHistory& history = m_pads[i];
+    history.resim_end = std::max(history.resim_end, history.poll_index);
+    history.poll_index = target.poll_indices[i];
+    history.rollback_index = UINT64_MAX;
+
+    // Keep only the predictions that the checkpoint was taken with; the later polls will be
+    // predicted again if their inputs still haven't arrived.
+    const u64 inputs_end = history.InputsEnd();
+    history.predictions.resize(history.poll_index > inputs_end ? history.poll_index - inputs_end :
+                                                                 0);
+  }
+
+  {
+    std::lock_guard lk(m_stats_mutex);
+    ++m_stats.rollbacks;
+  }
+
+  if (!m_resimulating)
+  {
+    m_resimulating = true;
+    m_resim_start = std::chrono::steady_clock::now();
+    Core::SetIsThrottlerTempDisabled(true);
+  }
+
+  DEBUG_LOG_FMT(NETPLAY, "Rollback: Rolled back to polls [{}, {}, {}, {}]", target.poll_indices[0],
+                target.poll_indices[1], target.poll_indices[2], target.poll_indices[3]);
+}
+
+void Rollback::UpdateResimulation()
+{
+  if (!m_resimulating)
+    return;
+
+  for (const PadHistory& history : m_pads)
+  {
+    if (history.poll_index < history.resim_end)
+      return;
+  }
+
+  m_resimulating = false;
+  Core::SetIsThrottlerTempDisabled(false);
+
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - m_resim_start;
+  std::lock_guard lk(m_stats_mutex);
+  m_stats.resim_seconds += duration.count();
+  m_stats.max_resim_seconds = std::max(m_stats.max_resim_seconds, duration.count());
+}
+}  // namespace NetPlay
@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Rollback lets a NetPlay client run ahead of the remote players' inputs instead of waiting for
+// them to arrive.
+//
+// Every pad has a stream of inputs, one per poll, which all clients consume in the same order.
+// When the next input of a remote pad hasn't arrived yet, it is predicted to be the same as the
+// last one, and a checkpoint of the emulated state is taken every few batched polls. Once an input
+// arrives that doesn't match what was predicted for its poll, the latest checkpoint from before
+// that poll is loaded and the polls since then are replayed unthrottled with the real inputs.
+// Checkpoints are incremental savestates, so taking them is cheap enough to do this often.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/SPSCQueue.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace Core
+{
+class System;
+}
+
+namespace NetPlay
+{
+class Rollback final : public std::enable_shared_from_this<Rollback>
+{
+public:
+  struct Stats
+  {
+    u64 rollbacks = 0;
+    u64 mispredicted_inputs = 0;
+    u64 resimulated_polls = 0;
+    double resim_seconds = 0;
+    double max_resim_seconds = 0;
+  };
+
+  // max_predicted_polls limits how far a pad may get ahead of its inputs before polls wait again.
+  Rollback(Core::System& system, u32 max_predicted_polls, u32 checkpoint_interval);
+  ~Rollback();
+
+  // These are all called on the CPU thread.
+
+  // Returns false if the pad's next input is neither known nor can be predicted, in which case the
+  // caller has to wait for more inputs to arrive in buffer.
+  bool GetInput(int pad, Common::SPSCQueue<GCPadStatus>& buffer, GCPadStatus* status);
+  // Whether a local pad needs a new input for its next poll, rather than replaying one it already
+  // has. buffered is the number of inputs waiting in its buffer.
+  bool NeedsLocalInput(int pad, size_t buffered) const;
+  // Called at the start of every batched poll. Schedules a checkpoint when one is due.
+  void OnBatchedPoll();
+
+  // May be called from any thread.
+  Stats GetStats() const;
+
+private:
+  struct PadHistory
+  {
+    // Inputs known for polls starting at first_index.
+    std::deque<GCPadStatus> inputs;
+    u64 first_index = 0;
+    // Inputs predicted for the polls right after the known ones.
+    std::deque<GCPadStatus> predictions;
+    GCPadStatus last_input;
+    bool has_input = false;
+
+    u64 poll_index = 0;
+    // Where rollback has to go back to because of a misprediction, if anywhere.
+    u64 rollback_index = UINT64_MAX;
+    // How far the pad had gotten before the last rollback.
+    u64 resim_end = 0;
+
+    u64 InputsEnd() const { return first_index + inputs.size(); }
+  };
+
+  struct Checkpoint
+  {
+    std::shared_ptr<std::vector<u8>> base;
+    // Empty if the checkpoint is the base itself.
+    std::vector<u8> state;
+    std::array<u64, 4> poll_indices;
+  };
+
+  void AddInput(PadHistory& history, const GCPadStatus& input);
+  bool CanPredict(const PadHistory& history) const;
+  void ScheduleJob();
+  void RunJob();
+  void TakeCheckpoint();
+  void TrimCheckpoints();
+  void RollBack();
+  void UpdateResimulation();
+
+  Core::System& m_system;
+  const u32 m_max_predicted_polls;
+  const u32 m_checkpoint_interval;
+
+  std::array<PadHistory, 4> m_pads;
+
+  std::deque<Checkpoint> m_checkpoints;
+  std::shared_ptr<std::vector<u8>> m_base;
+  u32 m_checkpoints_since_base = 0;
+
+  u32 m_polls_since_checkpoint = 0;
+  bool m_checkpoint_due = false;
+  bool m_rollback_due = false;
+  bool m_job_pending = false;
+
+  bool m_resimulating = false;
+  std::chrono::steady_clock::time_point m_resim_start;
+
+  mutable std::mutex m_stats_mutex;
+  Stats m_stats;
+};
+}  // namespace NetPlay
@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -21,6 +22,7 @@
 #include <fmt/ranges.h>
 
 #include "Common/CommonPaths.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
 #include "Common/HttpRequest.h"
@@ -783,6 +785,28 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   }
   break;
 
+  case MessageID::ChunkedDataHave:
+  {
+    u32 cid;
+    u32 block_count;
+    packet >> cid >> block_count;
+
+    std::vector<bool> blocks(block_count);
+    for (u32 i = 0; i < block_count; ++i)
+    {
+      u8 had;
+      packet >> had;
+      blocks[i] = had != 0;
+    }
+
+    {
+      std::lock_guard lk(m_crit.chunked_data_have);
+      m_chunked_data_have[cid][player.pid] = std::move(blocks);
+    }
+    m_chunked_data_have_event.Set();
+  }
+  break;
+
   case MessageID::ChunkedDataComplete:
   {
     u32 cid;
@@ -1399,6 +1423,7 @@ bool NetPlayServer::SetupNetSettings()
 
   settings.efb_access_enable = Config::Get(Config::GFX_HACK_EFB_ACCESS_ENABLE);
   settings.bbox_enable = Config::Get(Config::GFX_HACK_BBOX_ENABLE);
+  settings.bbox_readback_latency = Config::Get(Config::GFX_HACK_BBOX_READBACK_LATENCY);
   settings.force_progressive = Config::Get(Config::GFX_HACK_FORCE_PROGRESSIVE);
   settings.efb_to_texture_enable = Config::Get(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   settings.xfb_to_texture_enable = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
@@ -1408,6 +1433,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.safe_texture_cache_color_samples =
       Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
   settings.perf_queries_enable = Config::Get(Config::GFX_PERF_QUERIES_ENABLE);
+  settings.perf_queries_stale_frames = Config::Get(Config::GFX_PERF_QUERIES_STALE_FRAMES);
   settings.float_exceptions = Config::Get(Config::MAIN_FLOAT_EXCEPTIONS);
   settings.divide_by_zero_exceptions = Config::Get(Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS);
   settings.fprf = Config::Get(Config::MAIN_FPRF);
@@ -1442,6 +1468,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.defer_efb_copies = Config::Get(Config::GFX_HACK_DEFER_EFB_COPIES);
   settings.efb_access_tile_size = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   settings.efb_access_defer_invalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
+  settings.efb_access_stale_frames = Config::Get(Config::GFX_HACK_EFB_ACCESS_STALE_FRAMES);
 
   settings.savedata_load = Config::Get(Config::NETPLAY_SAVEDATA_LOAD);
   settings.savedata_write = settings.savedata_load && Config::Get(Config::NETPLAY_SAVEDATA_WRITE);
@@ -1608,6 +1635,7 @@ bool NetPlayServer::StartGame()
 
   spac << m_settings.efb_access_enable;
   spac << m_settings.bbox_enable;
+  spac << m_settings.bbox_readback_latency;
   spac << m_settings.force_progressive;
   spac << m_settings.efb_to_texture_enable;
   spac << m_settings.xfb_to_texture_enable;
@@ -1616,6 +1644,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.efb_emulate_format_changes;
   spac << m_settings.safe_texture_cache_color_samples;
   spac << m_settings.perf_queries_enable;
+  spac << m_settings.perf_queries_stale_frames;
   spac << m_settings.float_exceptions;
   spac << m_settings.divide_by_zero_exceptions;
   spac << m_settings.fprf;
@@ -1649,6 +1678,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.defer_efb_copies;
   spac << m_settings.efb_access_tile_size;
   spac << m_settings.efb_access_defer_invalidation;
+  spac << m_settings.efb_access_stale_frames;
   spac << m_settings.savedata_load;
   spac << m_settings.savedata_write;
   spac << m_settings.savedata_sync_all_wii;
@@ -2373,11 +2403,13 @@ void NetPlayServer::ChunkedDataThreadFunc()
         break;
       auto& e = m_chunked_data_queue.Front();
       const u32 id = m_next_chunked_data_id++;
+      const std::span<const u8> data(static_cast<const u8*>(e.packet.getData()),
+                                     e.packet.getDataSize());
+      const std::vector<Common::SHA1::Digest> block_digests = HashChunkedDataBlocks(data);
 
       m_chunked_data_complete_count[id] = 0;
-      size_t player_count;
+      std::vector<int> players;
       {
-        std::vector<int> players;
         if (e.target_mode == TargetMode::Only)
         {
           players.push_back(e.target_pid);
@@ -2390,7 +2422,6 @@ void NetPlayServer::ChunkedDataThreadFunc()
               players.push_back(pl.second.pid);
           }
         }
-        player_count = players.size();
 
         INFO_LOG_FMT(NETPLAY, "Informing players {} of data chunk {} start.",
                      fmt::join(players, ", "), id);
@@ -2398,6 +2429,9 @@ void NetPlayServer::ChunkedDataThreadFunc()
         sf::Packet pac;
         pac << MessageID::ChunkedDataStart;
         pac << id << e.title << sf::Uint64{e.packet.getDataSize()};
+        pac << static_cast<u32>(block_digests.size());
+        for (const Common::SHA1::Digest& digest : block_digests)
+          pac.append(digest.data(), digest.size());
 
         ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
 
@@ -2405,6 +2439,29 @@ void NetPlayServer::ChunkedDataThreadFunc()
           m_dialog->ShowChunkedProgressDialog(e.title, e.packet.getDataSize(), players);
       }
 
+      // Every player answers with the blocks it already has, which it won't be sent again. The
+      // players each get their own stream of the blocks they're missing.
+      std::map<PlayerId, std::vector<bool>> blocks_had;
+      while (m_do_loop && !m_abort_chunked_data)
+      {
+        {
+          std::lock_guard lk(m_crit.chunked_data_have);
+          auto& reported = m_chunked_data_have[id];
+          if (std::ranges::all_of(players, [&](int pid) {
+                return reported.contains(pid) || !m_players.contains(pid);
+              }))
+          {
+            blocks_had = std::move(reported);
+            break;
+          }
+        }
+        m_chunked_data_have_event.WaitFor(std::chrono::milliseconds(100));
+      }
+      {
+        std::lock_guard lk(m_crit.chunked_data_have);
+        m_chunked_data_have.erase(id);
+      }
+
       const bool enable_limit = Config::Get(Config::NETPLAY_ENABLE_CHUNKED_UPLOAD_LIMIT);
       const float bytes_per_second =
           (std::max(Config::Get(Config::NETPLAY_CHUNKED_UPLOAD_LIMIT), 1u) / 8.0f) * 1024.0f;
@@ -2438,22 +2495,31 @@ void NetPlayServer::ChunkedDataThreadFunc()
 
         sf::Packet pac;
         pac << MessageID::ChunkedDataPayload;
-        pac << id;
-        size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, e.packet.getDataSize() - index);
-        pac.append(static_cast<const u8*>(e.packet.getData()) + index, len);
-
-        INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} ({} bytes at {}/{}).", id, len, index,
-                     e.packet.getDataSize());
+        pac << id << sf::Uint64{index};
+        size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, data.size() - index);
+        pac.append(data.data() + index, len);
 
-        ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
+        const size_t block = index / CHUNKED_DATA_BLOCK_SIZE;
+        bool sent = false;
+        for (const int pid : players)
+        {
+          const auto had = blocks_had.find(pid);
+          if (had != blocks_had.end() && block < had->second.size() && had->second[block])
+            continue;
+
+          INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} to player {} ({} bytes at {}/{}).", id,
+                       pid, len, index, data.size());
+          SendAsync(sf::Packet(pac), pid, CHUNKED_DATA_CHANNEL);
+          sent = true;
+        }
         index += CHUNKED_DATA_UNIT_SIZE;
 
-        if (enable_limit)
+        if (enable_limit && sent)
         {
           std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
           std::this_thread::sleep_for(send_interval - delta);
         }
-      } while (index < e.packet.getDataSize());
+      } while (index < data.size());
 
       if (!m_abort_chunked_data)
       {
@@ -2465,7 +2531,7 @@ void NetPlayServer::ChunkedDataThreadFunc()
         ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
       }
 
-      while (m_chunked_data_complete_count[id] < player_count && m_do_loop &&
+      while (m_chunked_data_complete_count[id] < players.size() && m_do_loop &&
              !m_abort_chunked_data && !skip_wait)
         m_chunked_data_complete_event.Wait();
       m_chunked_data_complete_count.erase(id);
@@ -2496,6 +2562,7 @@ void NetPlayServer::ChunkedDataAbort()
 {
   m_abort_chunked_data = true;
   m_chunked_data_event.Set();
+  m_chunked_data_have_event.Set();
   m_chunked_data_complete_event.Set();
 }
 }  // namespace NetPlay
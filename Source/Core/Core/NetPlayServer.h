@@ -195,6 +195,7 @@ private:
     std::recursive_mutex players;
     std::recursive_mutex async_queue_write;
     std::recursive_mutex chunked_data_queue_write;
+    std::recursive_mutex chunked_data_have;
   } m_crit;
 
   Common::SPSCQueue<AsyncQueueEntry, false> m_async_queue;
@@ -204,9 +205,11 @@ private:
   std::string m_selected_game_name;
   std::thread m_thread;
   Common::Event m_chunked_data_event;
+  Common::Event m_chunked_data_have_event;
   Common::Event m_chunked_data_complete_event;
   std::thread m_chunked_data_thread;
   u32 m_next_chunked_data_id = 0;
+  std::unordered_map<u32, std::map<PlayerId, std::vector<bool>>> m_chunked_data_have;
   std::unordered_map<u32, unsigned int> m_chunked_data_complete_count;
   bool m_abort_chunked_data = false;
 
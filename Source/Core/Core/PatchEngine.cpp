@@ -202,6 +202,9 @@ void LoadPatches()
   }
 }
 
+// Patches are rewritten through the MMU every frame. Host writes don't invalidate JIT blocks (only
+// the first frames of the Gecko code handler flush the icache), so rewriting a value that is
+// already in memory costs no more than the address translation that a read would need as well.
 static void ApplyPatches(const Core::CPUThreadGuard& guard, const std::vector<Patch>& patches)
 {
   for (const Patch& patch : patches)
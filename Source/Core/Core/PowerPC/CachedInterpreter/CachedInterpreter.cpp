@@ -206,6 +206,57 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                                     const LoadImmediateOperands& operands)
+{
+  const auto& [rd, imm] = operands;
+  ppc_state.gpr[rd] = imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(PowerPC::PowerPCState& ppc_state,
+                                    const AddImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm] = operands;
+  ppc_state.gpr[rd] = ppc_state.gpr[ra] + imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::MoveRegister(PowerPC::PowerPCState& ppc_state,
+                                    const MoveRegisterOperands& operands)
+{
+  const auto& [ra, rs] = operands;
+  ppc_state.gpr[ra] = ppc_state.gpr[rs];
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+bool CachedInterpreter::WriteSpecializedInstruction(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 14:  // addi
+  case 15:  // addis
+  {
+    const u32 imm = inst.OPCD == 14 ? u32(inst.SIMM_16) : u32(inst.SIMM_16 << 16);
+    if (inst.RA == 0)
+      Write(LoadImmediate, {inst.RD, imm});
+    else
+      Write(AddImmediate, {inst.RD, inst.RA, imm});
+    return true;
+  }
+  case 31:
+    // mr is or with both source registers being the same.
+    if (inst.SUBOP10 == 444 && inst.RS == inst.RB && !inst.Rc)
+    {
+      Write(MoveRegister, {inst.RA, inst.RS});
+      return true;
+    }
+    return false;
+  default:
+    return false;
+  }
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -277,6 +328,7 @@ void CachedInterpreter::Jit(u32 em_address, bool clear_cache_and_retry_on_failur
 
   const u32 nextPC =
       analyzer.Analyze(em_address, &code_block, &m_code_buffer, m_code_buffer.size());
+  ReportPossibleIdleLoop();
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -384,7 +436,7 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                CallbackCast(InterpretAndCheckExceptions<false>),
               operands);
       }
-      else
+      else if (op.canEndBlock || !WriteSpecializedInstruction(op.inst))
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
                                             js.compilerPC, op.inst};
@@ -58,9 +58,10 @@ public:
   const char* GetName() const override { return "Cached Interpreter"; }
   const CommonAsmRoutinesBase* GetAsmRoutines() override { return nullptr; }
 
-private:
+  // Also used by JitInterface when the CachedInterpreter is the cold tier of tiered compilation.
   void ExecuteOneBlock();
 
+private:
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
 
@@ -82,6 +83,9 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct LoadImmediateOperands;
+  struct AddImmediateOperands;
+  struct MoveRegisterOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -112,6 +116,16 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Specialized forms of common instructions, which don't have to go through the interpreter.
+  bool WriteSpecializedInstruction(UGeckoInstruction inst);
+  static s32 LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                           const LoadImmediateOperands& operands);
+  static s32 LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands);
+  static s32 AddImmediate(PowerPC::PowerPCState& ppc_state, const AddImmediateOperands& operands);
+  static s32 AddImmediate(std::ostream& stream, const AddImmediateOperands& operands);
+  static s32 MoveRegister(PowerPC::PowerPCState& ppc_state, const MoveRegisterOperands& operands);
+  static s32 MoveRegister(std::ostream& stream, const MoveRegisterOperands& operands);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -175,3 +189,23 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+struct CachedInterpreter::LoadImmediateOperands
+{
+  u32 rd;
+  u32 imm;
+};
+
+struct CachedInterpreter::AddImmediateOperands
+{
+  u32 rd;
+  u32 ra;
+  u32 imm;
+  u32 : 32;
+};
+
+struct CachedInterpreter::MoveRegisterOperands
+{
+  u32 ra;
+  u32 rs;
+};
@@ -90,6 +90,27 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands)
+{
+  const auto& [rd, imm] = operands;
+  fmt::println(stream, "LoadImmediate(rd={}, imm=0x{:08x})", rd, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(std::ostream& stream, const AddImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm] = operands;
+  fmt::println(stream, "AddImmediate(rd={}, ra={}, imm=0x{:08x})", rd, ra, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::MoveRegister(std::ostream& stream, const MoveRegisterOperands& operands)
+{
+  const auto& [ra, rs] = operands;
+  fmt::println(stream, "MoveRegister(ra={}, rs={})", ra, rs);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +136,9 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::LoadImmediate),
+      LOOKUP_KV(CachedInterpreter::AddImmediate),
+      LOOKUP_KV(CachedInterpreter::MoveRegister),
   });
 
 #undef LOOKUP_KV
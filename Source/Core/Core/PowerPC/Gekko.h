@@ -939,6 +939,8 @@ enum CPUEmuFeatureFlags : u32
   FEATURE_FLAG_MSR_DR = 1 << 0,
   FEATURE_FLAG_MSR_IR = 1 << 1,
   FEATURE_FLAG_PERFMON = 1 << 2,
+  // FPSCR.NI. Lets the JIT assume that denormals aren't flushed to zero when this is clear.
+  FEATURE_FLAG_FPSCR_NI = 1 << 3,
   FEATURE_FLAG_END_OF_ENUMERATION,
 };
 
@@ -20,6 +20,7 @@ class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
 class PPCSymbolDB;
+struct GekkoOPInfo;
 
 class Interpreter : public CPUCoreBase
 {
@@ -295,6 +296,17 @@ public:
   static u32 Helper_Carry(u32 value1, u32 value2);
 
 private:
+  struct DecodedInstruction
+  {
+    UGeckoInstruction inst;
+    Instruction handler;
+    const GekkoOPInfo* opinfo;
+  };
+
+  // Looks up the handler and info for an instruction, going through the subtables only if the
+  // instruction fetched from the address has changed since it was last decoded.
+  DecodedInstruction Decode(UGeckoInstruction inst, u32 address);
+
   void CheckExceptions();
 
   bool HandleFunctionHooking(u32 address);
@@ -321,6 +333,10 @@ private:
   PPCSymbolDB& m_ppc_symbol_db;
 
   UGeckoInstruction m_prev_inst{};
+  // Direct-mapped by address. Entries are checked against the fetched instruction, so there is
+  // nothing to invalidate when code changes.
+  static constexpr size_t DECODE_CACHE_SIZE = 0x1000;
+  std::array<DecodedInstruction, DECODE_CACHE_SIZE> m_decode_cache{};
   u32 m_last_pc = 0;
   bool m_end_block = false;
   bool m_start_trace = false;
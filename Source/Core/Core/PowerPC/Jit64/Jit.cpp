@@ -4,6 +4,7 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 
 #include <map>
+#include <optional>
 #include <span>
 #include <sstream>
 #include <string>
@@ -17,14 +18,17 @@
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/EnumUtils.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/HostDisassembler.h"
 #include "Common/IOFile.h"
+#include "Common/JitRegister.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -274,6 +278,8 @@ void Jit64::Init()
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
   AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  if (Config::Get(Config::MAIN_HUGE_PAGES) && !AdviseHugePages())
+    WARN_LOG_FMT(DYNA_REC, "Huge pages were requested, but can't be used for the JIT code space");
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -338,6 +344,15 @@ void Jit64::ResetFreeMemoryRanges()
 
 void Jit64::Shutdown()
 {
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+  {
+    if (const std::optional<size_t> backed_size = GetHugePageBackedSize())
+    {
+      NOTICE_LOG_FMT(DYNA_REC, "Huge pages backed {} of {} MiB of the JIT code space",
+                     *backed_size >> 20, total_region_size >> 20);
+    }
+  }
+
   FreeCodeSpace();
 
   auto& memory = m_system.GetMemory();
@@ -352,6 +367,7 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
 {
   gpr.Flush();
   fpr.Flush();
+  FlushGatherPipeOffset();
 
   if (js.op->canEndBlock)
   {
@@ -448,6 +464,10 @@ bool Jit64::Cleanup()
 {
   bool did_something = false;
 
+  // An exit between combined gather pipe stores still has to advance the pipe pointer.
+  if (js.gatherPipeOffset != 0)
+    ADD(64, PPCSTATE(gather_pipe_ptr), Imm8(js.gatherPipeOffset));
+
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
   {
     MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
@@ -626,6 +646,72 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
   }
 }
 
+void Jit64::WriteIndirectExitDestInRSCRATCH(bool bl, u32 after)
+{
+  if (!jo.enableBlocklink || IsDebuggingEnabled())
+  {
+    WriteExitDestInRSCRATCH(bl, after);
+    return;
+  }
+  if (!m_enable_blr_optimization)
+    bl = false;
+
+  IndirectBranchCache* const cache = blocks.AllocateIndirectBranchCache(*js.curBlock);
+
+  MOV(32, PPCSTATE(pc), R(RSCRATCH));
+  bool disturbed = Cleanup();
+  if (disturbed)
+    MOV(32, R(RSCRATCH), PPCSTATE(pc));
+  if (m_ppc_state.feature_flags != 0)
+  {
+    MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32));
+    OR(64, R(RSCRATCH), R(RSCRATCH2));
+  }
+
+  MOV(64, R(RSCRATCH2), ImmPtr(cache));
+  CMP(64, R(RSCRATCH), MDisp(RSCRATCH2, offsetof(IndirectBranchCache, target)));
+  FixupBranch target_mismatch = J_CC(CC_NE, Jump::Near);
+  MOV(64, R(RSCRATCH), ImmPtr(blocks.GetIndirectBranchGenerationPtr()));
+  MOV(64, R(RSCRATCH), MatR(RSCRATCH));
+  CMP(64, R(RSCRATCH), MDisp(RSCRATCH2, offsetof(IndirectBranchCache, generation)));
+  FixupBranch generation_mismatch = J_CC(CC_NE, Jump::Near);
+
+  ADD(64, MDisp(RSCRATCH2, offsetof(IndirectBranchCache, hits)), Imm8(1));
+  MOV(64, R(RSCRATCH), MDisp(RSCRATCH2, offsetof(IndirectBranchCache, entry)));
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+  FixupBranch hit = J_CC(CC_G);
+
+  // The dispatcher takes care of the timing check with the flags of the downcount update.
+  const u8* to_dispatcher = GetCodePtr();
+  MOV(64, R(RSCRATCH), ImmPtr(asm_routines.dispatcher));
+  SetJumpTarget(hit);
+  if (bl)
+  {
+    MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32 | after));
+    PUSH(RSCRATCH2);
+    CALLptr(R(RSCRATCH));
+    POP(RSCRATCH);
+    JustWriteExit(after, false, 0);
+  }
+  else
+  {
+    JMPptr(R(RSCRATCH));
+  }
+
+  SwitchToFarCode();
+  SetJumpTarget(target_mismatch);
+  SetJumpTarget(generation_mismatch);
+  CMP(32, MDisp(RSCRATCH2, offsetof(IndirectBranchCache, disabled)), Imm8(0));
+  FixupBranch disabled = J_CC(CC_NE);
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionPP(JitBaseBlockCache::UpdateIndirectBranchCache, &blocks, cache);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  SetJumpTarget(disabled);
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+  JMP(to_dispatcher, Jump::Near);
+  SwitchToNearCode();
+}
+
 void Jit64::WriteBLRExit()
 {
   if (!m_enable_blr_optimization)
@@ -764,6 +850,11 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     ClearCache();
   }
   FreeRanges();
+  if (IsCodeSpaceLow())
+  {
+    blocks.EvictOldestBlocks();
+    FreeRanges();
+  }
 
   std::size_t block_size = m_code_buffer.size();
 
@@ -794,7 +885,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
 
   if (code_block.m_memory_exception)
   {
@@ -856,6 +947,18 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   std::exit(-1);
 }
 
+bool Jit64::IsCodeSpaceLow()
+{
+  const auto free_near = m_free_ranges_near.by_size_begin();
+  const auto free_far = m_free_ranges_far.by_size_begin();
+  return free_near == m_free_ranges_near.by_size_end() ||
+         free_far == m_free_ranges_far.by_size_end() ||
+         static_cast<size_t>(free_near.to() - free_near.from()) <
+             JitBaseBlockCache::MIN_FREE_CODE_SPACE ||
+         static_cast<size_t>(free_far.to() - free_far.from()) <
+             JitBaseBlockCache::MIN_FREE_CODE_SPACE;
+}
+
 bool Jit64::SetEmitterStateToFreeCodeRegion()
 {
   // Find the largest free memory blocks and set code emitters to point at them.
@@ -885,6 +988,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.isLastInstruction = false;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
+  js.gatherPipeOffset = 0;
   js.mustCheckFifo = false;
   js.curBlock = b;
   js.numLoadStoreInst = 0;
@@ -958,9 +1062,13 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   }
 
   // Translate instructions
+  const bool record_host_addresses = Common::JitRegister::IsJitDumpEnabled();
+  js.instruction_host_addresses.clear();
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
+    if (record_host_addresses)
+      js.instruction_host_addresses.push_back(GetCodePtr());
 
     js.compilerPC = op.address;
     js.op = &op;
@@ -75,6 +75,8 @@ public:
   // Finds a free memory region and sets the near and far code emitters to point at that region.
   // Returns false if no free memory region can be found for either of the two.
   bool SetEmitterStateToFreeCodeRegion();
+  // Whether old blocks should be evicted before compiling more.
+  bool IsCodeSpaceLow();
 
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
@@ -100,6 +102,8 @@ public:
   void WriteExit(u32 destination, bool bl = false, u32 after = 0);
   void JustWriteExit(u32 destination, bool bl, u32 after);
   void WriteExitDestInRSCRATCH(bool bl = false, u32 after = 0);
+  // Like WriteExitDestInRSCRATCH, but jumps straight to the last target if it is taken again.
+  void WriteIndirectExitDestInRSCRATCH(bool bl, u32 after);
   void WriteBLRExit();
   void WriteExceptionExit();
   void WriteExternalExceptionExit();
@@ -16,6 +16,7 @@
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -218,9 +219,20 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // With tiered compilation, JitTrampoline may have run a block in the cold tier.
+  const bool has_cold_tier = system.GetJitInterface().HasColdTier();
+  FixupBranch cold_tier_bail;
+  if (has_cold_tier)
+  {
+    CMP(32, PPCSTATE(downcount), Imm8(0));
+    cold_tier_bail = J_CC(CC_LE, Jump::Near);
+  }
+
   JMP(dispatcher_no_check, Jump::Near);
 
   SetJumpTarget(bail);
+  if (has_cold_tier)
+    SetJumpTarget(cold_tier_bail);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
@@ -225,6 +225,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(T (*function)(Core::System&, u32)) override
+  {
+    CallFunction(8 * sizeof(T), function);
+  }
 
 private:
   // Generates code to load a constant to the destination register. In
@@ -278,6 +282,15 @@ private:
     MoveOpArgToReg(sbits, R(ABI_RETURN));
   }
 
+  void CallFunction(int sbits, T (*function)(Core::System&, u32))
+  {
+    // Calling the function directly skips the std::function trampoline.
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallFunctionPC(function, m_system, m_address);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+    MoveOpArgToReg(sbits, R(ABI_RETURN));
+  }
+
   Core::System* m_system;
   Gen::X64CodeBlock* m_code;
   BitSet32 m_registers_in_use;
@@ -629,6 +642,15 @@ bool EmuCodeBlock::WriteClobbersRegValue(int accessSize, bool swap)
   return swap && !cpu_info.bMOVBE && accessSize > 8;
 }
 
+void EmuCodeBlock::FlushGatherPipeOffset()
+{
+  if (m_jit.js.gatherPipeOffset == 0)
+    return;
+
+  ADD(64, PPCSTATE(gather_pipe_ptr), Imm8(m_jit.js.gatherPipeOffset));
+  m_jit.js.gatherPipeOffset = 0;
+}
+
 bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
                                        BitSet32 registersInUse)
 {
@@ -647,16 +669,25 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     if (!arg.IsSimpleReg(arg_reg))
       MOV(accessSize, R(arg_reg), arg);
 
-    // And store it in the gather pipe
+    // And store it in the gather pipe. A run of stores to it only advances the pointer after the
+    // last of them.
+    auto& js = m_jit.js;
     MOV(64, R(RSCRATCH2), PPCSTATE(gather_pipe_ptr));
-    SwapAndStore(accessSize, MatR(RSCRATCH2), arg_reg);
-    ADD(64, R(RSCRATCH2), Imm8(accessSize >> 3));
-    MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
+    SwapAndStore(accessSize, MDisp(RSCRATCH2, js.gatherPipeOffset), arg_reg);
+    js.gatherPipeOffset += accessSize >> 3;
+    js.fifoBytesSinceCheck += accessSize >> 3;
 
-    m_jit.js.fifoBytesSinceCheck += accessSize >> 3;
+    if (!m_jit.CanCombineNextGatherPipeStore())
+    {
+      ADD(64, R(RSCRATCH2), Imm8(js.gatherPipeOffset));
+      MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
+      js.gatherPipeOffset = 0;
+    }
     return false;
   }
-  else if (m_jit.jo.fastmem_arena && m_jit.m_mmu.IsOptimizableRAMAddress(address, accessSize))
+
+  FlushGatherPipeOffset();
+  if (m_jit.jo.fastmem_arena && m_jit.m_mmu.IsOptimizableRAMAddress(address, accessSize))
   {
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
@@ -101,6 +101,8 @@ public:
 
   // returns true if an exception could have been caused
   bool WriteToConstAddress(int accessSize, Gen::OpArg arg, u32 address, BitSet32 registersInUse);
+  // Advances gather_pipe_ptr past what combined gather pipe stores have written.
+  void FlushGatherPipeOffset();
   void WriteToConstRamAddress(int accessSize, Gen::OpArg arg, u32 address, bool swap = true);
 
   void JitGetAndClearCAOV(bool oe);
@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/JitArm64/Jit.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <optional>
 #include <span>
@@ -16,11 +17,13 @@
 #include "Common/EnumUtils.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/HostDisassembler.h"
+#include "Common/JitRegister.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -66,6 +69,8 @@ void JitArm64::Init()
   // AddChildCodeSpace grabs space from the end of the parent region,
   // so we have to call AddChildCodeSpace in reverse order.
   AllocCodeSpace(TOTAL_CODE_SIZE);
+  if (Config::Get(Config::MAIN_HUGE_PAGES) && !AdviseHugePages())
+    WARN_LOG_FMT(DYNA_REC, "Huge pages were requested, but can't be used for the JIT code space");
   AddChildCodeSpace(&m_far_code_1, FAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_1, NEAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_0, NEAR_CODE_SIZE);
@@ -81,6 +86,8 @@ void JitArm64::Init()
   fpr.Init(this);
   blocks.Init();
 
+  m_block_disk_cache_enabled = Config::Get(Config::MAIN_JIT_BLOCK_DISK_CACHE);
+
   code_block.m_stats = &js.st;
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
@@ -247,10 +254,20 @@ void JitArm64::ResetFreeMemoryRanges(size_t routines_near_size, size_t routines_
 
 void JitArm64::Shutdown()
 {
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+  {
+    if (const std::optional<size_t> backed_size = GetHugePageBackedSize())
+    {
+      NOTICE_LOG_FMT(DYNA_REC, "Huge pages backed {} of {} MiB of the JIT code space",
+                     *backed_size >> 20, total_region_size >> 20);
+    }
+  }
+
   auto& memory = m_system.GetMemory();
   memory.ShutdownFastmemArena();
   FreeCodeSpace();
   blocks.Shutdown();
+  m_block_disk_cache.LoadForGame("");
 }
 
 void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
@@ -258,6 +275,7 @@ void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
   FlushCarry();
   gpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
   fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+  FlushGatherPipeOffset();
 
   if (js.op->canEndBlock)
   {
@@ -306,6 +324,10 @@ void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
     WriteConditionalExceptionExit(EXCEPTION_PROGRAM);
   }
 
+  // mtfsf and friends may have changed FPSCR.NI.
+  if (js.op->opinfo->type == ::OpType::SystemFP)
+    WriteFeatureFlagsChangedExit();
+
   if (jo.memcheck && (js.op->opinfo->flags & FL_LOADSTORE))
   {
     WriteConditionalExceptionExit(EXCEPTION_DSI);
@@ -332,8 +354,29 @@ void JitArm64::Break(UGeckoInstruction inst)
   std::exit(0);
 }
 
+void JitArm64::FlushGatherPipeOffset()
+{
+  if (js.gatherPipeOffset == 0)
+    return;
+
+  auto WA = gpr.GetScopedReg();
+  const ARM64Reg XA = EncodeRegTo64(WA);
+  LDR(IndexType::Unsigned, XA, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+  ADD(XA, XA, js.gatherPipeOffset);
+  STR(IndexType::Unsigned, XA, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+  js.gatherPipeOffset = 0;
+}
+
 void JitArm64::Cleanup()
 {
+  // An exit between combined gather pipe stores still has to advance the pipe pointer.
+  if (js.gatherPipeOffset != 0)
+  {
+    LDR(IndexType::Unsigned, ARM64Reg::X0, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+    ADD(ARM64Reg::X0, ARM64Reg::X0, js.gatherPipeOffset);
+    STR(IndexType::Unsigned, ARM64Reg::X0, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+  }
+
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
   {
     static_assert(PPCSTATE_OFF(gather_pipe_ptr) <= 504);
@@ -342,7 +385,24 @@ void JitArm64::Cleanup()
     SUB(ARM64Reg::X0, ARM64Reg::X0, ARM64Reg::X1);
     CMP(ARM64Reg::X0, GPFifo::GATHER_PIPE_SIZE);
     FixupBranch exit = B(CC_LT);
+
+    const bool switch_to_far_code = !IsInFarCode();
+    if (switch_to_far_code)
+    {
+      FixupBranch update = B();
+      SwitchToFarCode();
+      SetJumpTarget(update);
+    }
+
     ABI_CallFunction(&GPFifo::UpdateGatherPipe, &m_system.GetGPFifo());
+
+    if (switch_to_far_code)
+    {
+      FixupBranch back = B();
+      SwitchToNearCode();
+      SetJumpTarget(back);
+    }
+
     SetJumpTarget(exit);
   }
 
@@ -738,6 +798,105 @@ void JitArm64::FakeLKExit(u32 exit_address_after_return, ARM64Reg exit_address_a
   SetJumpTarget(skip_exit);
 }
 
+void JitArm64::WriteIndirectExit(Arm64Gen::ARM64Reg dest, bool LK, u32 exit_address_after_return)
+{
+  if (!jo.enableBlocklink || IsDebuggingEnabled() || IsInFarCode())
+  {
+    WriteExit(dest, LK, exit_address_after_return);
+    return;
+  }
+
+  IndirectBranchCache* const cache = blocks.AllocateIndirectBranchCache(*js.curBlock);
+
+  if (dest != DISPATCHER_PC)
+    MOV(DISPATCHER_PC, dest);
+
+  Cleanup();
+  if (IsProfilingEnabled())
+  {
+    ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+                     js.downcountAmount);
+  }
+
+  LK &= m_enable_blr_optimization;
+
+  // X0 = {PPC_PC, feature_flags}, X1 = cache
+  const u64 feature_flags = m_ppc_state.feature_flags;
+  if (feature_flags == 0)
+    MOV(ARM64Reg::W0, DISPATCHER_PC);
+  else
+    ORRI2R(ARM64Reg::X0, EncodeRegTo64(DISPATCHER_PC), feature_flags << 32, ARM64Reg::X0);
+  MOVP2R(ARM64Reg::X1, cache);
+  LDR(IndexType::Unsigned, ARM64Reg::X2, ARM64Reg::X1, offsetof(IndirectBranchCache, target));
+  CMP(ARM64Reg::X0, ARM64Reg::X2);
+  FixupBranch target_mismatch = B(CC_NEQ);
+  MOVP2R(ARM64Reg::X0, blocks.GetIndirectBranchGenerationPtr());
+  LDR(IndexType::Unsigned, ARM64Reg::X0, ARM64Reg::X0, 0);
+  LDR(IndexType::Unsigned, ARM64Reg::X2, ARM64Reg::X1, offsetof(IndirectBranchCache, generation));
+  CMP(ARM64Reg::X0, ARM64Reg::X2);
+  FixupBranch generation_mismatch = B(CC_NEQ);
+
+  LDR(IndexType::Unsigned, ARM64Reg::X0, ARM64Reg::X1, offsetof(IndirectBranchCache, hits));
+  ADD(ARM64Reg::X0, ARM64Reg::X0, 1);
+  STR(IndexType::Unsigned, ARM64Reg::X0, ARM64Reg::X1, offsetof(IndirectBranchCache, hits));
+  LDR(IndexType::Unsigned, ARM64Reg::X2, ARM64Reg::X1, offsetof(IndirectBranchCache, entry));
+  DoDownCount();  // overwrites X0 + X1
+  FixupBranch hit = B(CC_GT);
+
+  // The dispatcher takes care of the timing check with the flags of the downcount update.
+  const u8* to_dispatcher = GetCodePtr();
+  MOVP2R(ARM64Reg::X2, dispatcher);
+  SetJumpTarget(hit);
+
+  if (!LK)
+  {
+    BR(ARM64Reg::X2);
+  }
+  else
+  {
+    // Push {ARM_PC (64-bit); PPC_PC (32-bit); feature_flags (32-bit)} on the stack
+    MOVI2R(ARM64Reg::X1, feature_flags << 32 | exit_address_after_return);
+    constexpr s32 adr_offset = sizeof(u32) * 3;
+    const u8* host_address_after_return = GetCodePtr() + adr_offset;
+    ADR(ARM64Reg::X0, adr_offset);
+    STP(IndexType::Pre, ARM64Reg::X0, ARM64Reg::X1, ARM64Reg::SP, -16);
+
+    BLR(ARM64Reg::X2);
+    DEBUG_ASSERT(GetCodePtr() == host_address_after_return || HasWriteFailed());
+
+    // Write the regular exit node after the return.
+    JitBlock* b = js.curBlock;
+    JitBlock::LinkData linkData;
+    linkData.exitAddress = exit_address_after_return;
+    linkData.exitPtrs = GetWritableCodePtr();
+    linkData.linkStatus = false;
+    linkData.call = false;
+    SwitchToFarCode();
+    linkData.exitFarcode = GetCodePtr();
+    SwitchToNearCode();
+    b->linkData.push_back(linkData);
+
+    blocks.WriteLinkBlock(*this, linkData);
+
+    SwitchToFarCode();
+    MOVI2R(DISPATCHER_PC, exit_address_after_return);
+    B(GetAsmRoutines()->do_timing);
+    SwitchToNearCode();
+  }
+
+  SwitchToFarCode();
+  SetJumpTarget(target_mismatch);
+  SetJumpTarget(generation_mismatch);
+  LDR(IndexType::Unsigned, ARM64Reg::W0, ARM64Reg::X1, offsetof(IndirectBranchCache, disabled));
+  FixupBranch disabled = CBNZ(ARM64Reg::W0);
+  STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+  ABI_CallFunction(&JitBaseBlockCache::UpdateIndirectBranchCache, &blocks, cache);
+  SetJumpTarget(disabled);
+  DoDownCount();
+  B(to_dispatcher);
+  SwitchToNearCode();
+}
+
 void JitArm64::WriteBLRExit(Arm64Gen::ARM64Reg dest)
 {
   if (!m_enable_blr_optimization)
@@ -796,12 +955,21 @@ void JitArm64::WriteExceptionExit(ARM64Reg dest, bool only_external, bool always
 
   Cleanup();
 
+  // Exceptions are rarely pending when this is only a check, so keep the code that handles them
+  // out of the way of the near code.
   FixupBranch no_exceptions;
+  const bool switch_to_far_code = !always_exception && !IsInFarCode();
   if (!always_exception)
   {
     LDR(IndexType::Unsigned, ARM64Reg::W30, PPC_REG, PPCSTATE_OFF(Exceptions));
     no_exceptions = CBZ(ARM64Reg::W30);
   }
+  if (switch_to_far_code)
+  {
+    FixupBranch handle_exceptions = B();
+    SwitchToFarCode();
+    SetJumpTarget(handle_exceptions);
+  }
 
   static_assert(PPCSTATE_OFF(pc) <= 252);
   static_assert(PPCSTATE_OFF(pc) + 4 == PPCSTATE_OFF(npc));
@@ -815,6 +983,12 @@ void JitArm64::WriteExceptionExit(ARM64Reg dest, bool only_external, bool always
 
   LDR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(npc));
 
+  if (switch_to_far_code)
+  {
+    FixupBranch back = B();
+    SwitchToNearCode();
+    SetJumpTarget(back);
+  }
   if (!always_exception)
     SetJumpTarget(no_exceptions);
 
@@ -949,6 +1123,15 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   if (SConfig::GetInstance().bJITNoBlockCache)
     ClearCache();
   FreeRanges();
+  if (IsCodeSpaceLow())
+  {
+    blocks.EvictOldestBlocks();
+    FreeRanges();
+  }
+
+  const bool use_block_disk_cache = m_block_disk_cache_enabled && !IsDebuggingEnabled();
+  if (use_block_disk_cache)
+    m_block_disk_cache.LoadForGame(SConfig::GetInstance().GetGameID());
 
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
 
@@ -979,7 +1162,7 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
 
   if (code_block.m_memory_exception)
   {
@@ -992,44 +1175,11 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     return;
   }
 
-  if (std::optional<size_t> code_region_index = SetEmitterStateToFreeCodeRegion())
+  if (JitBlock* b = CompileBlock(em_address, nextPC))
   {
-    u8* near_start = GetWritableCodePtr();
-    u8* far_start = m_far_code.GetWritableCodePtr();
-
-    JitBlock* b = blocks.AllocateBlock(em_address);
-    if (DoJit(em_address, b, nextPC))
-    {
-      // Code generation succeeded.
-
-      // Mark the memory regions that this code block uses as used in the local rangesets.
-      u8* near_end = GetWritableCodePtr();
-      if (near_start != near_end)
-      {
-        (code_region_index == 0 ? m_free_ranges_near_0 : m_free_ranges_near_1)
-            .erase(near_start, near_end);
-      }
-      u8* far_end = m_far_code.GetWritableCodePtr();
-      if (far_start != far_end)
-      {
-        (code_region_index == 0 ? m_free_ranges_far_0 : m_free_ranges_far_1)
-            .erase(far_start, far_end);
-      }
-
-      // Store the used memory regions in the block so we know what to mark as unused when the
-      // block gets invalidated.
-      b->near_begin = near_start;
-      b->near_end = near_end;
-      b->far_begin = far_start;
-      b->far_end = far_end;
-
-      blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
-
-#ifdef JIT_LOG_GENERATED_CODE
-      LogGeneratedCode();
-#endif
-      return;
-    }
+    if (use_block_disk_cache && m_block_disk_cache.HasPendingEntries())
+      PrewarmBlocksFromDiskCache(b->physicalAddress);
+    return;
   }
 
   if (clear_cache_and_retry_on_failure)
@@ -1047,6 +1197,85 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   exit(-1);
 }
 
+JitBlock* JitArm64::CompileBlock(u32 em_address, u32 nextPC)
+{
+  std::optional<size_t> code_region_index = SetEmitterStateToFreeCodeRegion();
+  if (!code_region_index)
+    return nullptr;
+
+  u8* near_start = GetWritableCodePtr();
+  u8* far_start = m_far_code.GetWritableCodePtr();
+
+  JitBlock* b = blocks.AllocateBlock(em_address);
+  if (!DoJit(em_address, b, nextPC))
+    return nullptr;
+
+  // Code generation succeeded.
+
+  // Mark the memory regions that this code block uses as used in the local rangesets.
+  u8* near_end = GetWritableCodePtr();
+  if (near_start != near_end)
+  {
+    (code_region_index == 0 ? m_free_ranges_near_0 : m_free_ranges_near_1)
+        .erase(near_start, near_end);
+  }
+  u8* far_end = m_far_code.GetWritableCodePtr();
+  if (far_start != far_end)
+  {
+    (code_region_index == 0 ? m_free_ranges_far_0 : m_free_ranges_far_1)
+        .erase(far_start, far_end);
+  }
+
+  // Store the used memory regions in the block so we know what to mark as unused when the
+  // block gets invalidated.
+  b->near_begin = near_start;
+  b->near_end = near_end;
+  b->far_begin = far_start;
+  b->far_end = far_end;
+
+  blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+
+  if (m_block_disk_cache_enabled && !IsDebuggingEnabled())
+  {
+    m_block_disk_cache.RecordBlock(*b,
+                                   std::span(m_code_buffer.data(), code_block.m_num_instructions));
+  }
+
+#ifdef JIT_LOG_GENERATED_CODE
+  LogGeneratedCode();
+#endif
+  return b;
+}
+
+void JitArm64::PrewarmBlocksFromDiskCache(u32 physical_address)
+{
+  // Compile every block that a previous session compiled in this region of memory, as long as the
+  // analyzer still produces the exact same instruction stream for it.
+  const std::vector<JitBlockDiskCache::Entry> entries =
+      m_block_disk_cache.TakePendingEntries(physical_address, m_ppc_state.feature_flags);
+  for (const JitBlockDiskCache::Entry& entry : entries)
+  {
+    if (blocks.GetBlockFromStartAddress(entry.effective_address, m_ppc_state.feature_flags))
+      continue;
+
+    const u32 nextPC = analyzer.Analyze(entry.effective_address, &code_block, &m_code_buffer,
+                                        m_code_buffer.size());
+    if (code_block.m_memory_exception || code_block.m_num_instructions != entry.num_instructions)
+      continue;
+    const std::span code(m_code_buffer.data(), code_block.m_num_instructions);
+    if (JitBlockDiskCache::HashCode(code) != entry.code_hash)
+      continue;
+
+    if (!CompileBlock(entry.effective_address, nextPC))
+    {
+      // Out of code space. The block allocated for this entry was never finalized, so it must not
+      // stay in the block cache. The dispatcher will recompile the block it was looking for.
+      ClearCache();
+      break;
+    }
+  }
+}
+
 void JitArm64::EraseSingleBlock(const JitBlock& block)
 {
   blocks.EraseSingleBlock(block);
@@ -1071,6 +1300,20 @@ std::size_t JitArm64::DisassembleFarCode(const JitBlock& block, std::ostream& st
   return m_disassembler->Disassemble(block.far_begin, block.far_end, stream);
 }
 
+bool JitArm64::IsCodeSpaceLow()
+{
+  const auto largest_free_size = [](HyoutaUtilities::RangeSizeSet<u8*>& ranges) -> size_t {
+    const auto largest = ranges.by_size_begin();
+    return largest != ranges.by_size_end() ? largest.to() - largest.from() : 0;
+  };
+  // New blocks can go into either region, as long as both its near and far code have room.
+  const size_t free_0 =
+      std::min(largest_free_size(m_free_ranges_near_0), largest_free_size(m_free_ranges_far_0));
+  const size_t free_1 =
+      std::min(largest_free_size(m_free_ranges_near_1), largest_free_size(m_free_ranges_far_1));
+  return std::max(free_0, free_1) < JitBaseBlockCache::MIN_FREE_CODE_SPACE;
+}
+
 std::optional<size_t> JitArm64::SetEmitterStateToFreeCodeRegion()
 {
   // Find some large free memory blocks and set code emitters to point at them. If we can't find
@@ -1128,6 +1371,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.assumeNoPairedQuantize = false;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
+  js.gatherPipeOffset = 0;
   js.mustCheckFifo = false;
   js.downcountAmount = 0;
   js.skipInstructions = 0;
@@ -1172,9 +1416,13 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   }
 
   // Translate instructions
+  const bool record_host_addresses = Common::JitRegister::IsJitDumpEnabled();
+  js.instruction_host_addresses.clear();
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
+    if (record_host_addresses)
+      js.instruction_host_addresses.push_back(GetCodePtr());
 
     js.compilerPC = op.address;
     js.op = &op;
@@ -1205,18 +1453,40 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.fifoBytesSinceCheck = 0;
         js.mustCheckFifo = false;
 
-        gpr.Lock(ARM64Reg::W30);
-        BitSet32 regs_in_use = gpr.GetCallerSavedUsed();
-        BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
-        regs_in_use[DecodeReg(ARM64Reg::W30)] = 0;
+        {
+          auto WA = gpr.GetScopedReg();
+          gpr.Lock(ARM64Reg::W30);
+
+          // Check the gather pipe inline, and only call into GPFifo from far code when it's full.
+          static_assert(PPCSTATE_OFF(gather_pipe_ptr) <= 504);
+          static_assert(PPCSTATE_OFF(gather_pipe_ptr) + 8 == PPCSTATE_OFF(gather_pipe_base_ptr));
+          LDP(IndexType::Signed, ARM64Reg::X30, EncodeRegTo64(WA), PPC_REG,
+              PPCSTATE_OFF(gather_pipe_ptr));
+          SUB(ARM64Reg::X30, ARM64Reg::X30, EncodeRegTo64(WA));
+          CMP(ARM64Reg::X30, GPFifo::GATHER_PIPE_SIZE);
+          FixupBranch not_full = B(CC_LT);
+          FixupBranch full = B();
+          SwitchToFarCode();
+          SetJumpTarget(full);
+
+          BitSet32 regs_in_use = gpr.GetCallerSavedUsed();
+          BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
+          regs_in_use[DecodeReg(ARM64Reg::W30)] = 0;
+          regs_in_use[DecodeReg(WA)] = 0;
 
-        ABI_PushRegisters(regs_in_use);
-        m_float_emit.ABI_PushRegisters(fprs_in_use, ARM64Reg::X30);
-        ABI_CallFunction(&GPFifo::FastCheckGatherPipe, &m_system.GetGPFifo());
-        m_float_emit.ABI_PopRegisters(fprs_in_use, ARM64Reg::X30);
-        ABI_PopRegisters(regs_in_use);
+          ABI_PushRegisters(regs_in_use);
+          m_float_emit.ABI_PushRegisters(fprs_in_use, ARM64Reg::X30);
+          ABI_CallFunction(&GPFifo::UpdateGatherPipe, &m_system.GetGPFifo());
+          m_float_emit.ABI_PopRegisters(fprs_in_use, ARM64Reg::X30);
+          ABI_PopRegisters(regs_in_use);
 
-        gpr.Unlock(ARM64Reg::W30);
+          FixupBranch back = B();
+          SwitchToNearCode();
+          SetJumpTarget(not_full);
+          SetJumpTarget(back);
+
+          gpr.Unlock(ARM64Reg::W30);
+        }
         gatherPipeIntCheck = true;
       }
       // Gather pipe writes can generate an exception; add an exception check.
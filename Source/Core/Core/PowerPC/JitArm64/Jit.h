@@ -18,6 +18,7 @@
 #include "Core/PowerPC/JitArmCommon/BackPatch.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class HostDisassembler;
@@ -290,6 +291,10 @@ protected:
                                            Arm64Gen::ARM64Reg tmp2);
 
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
+  // Emits the block currently held in code_block/m_code_buffer. Returns nullptr if there was not
+  // enough free code space.
+  JitBlock* CompileBlock(u32 em_address, u32 nextPC);
+  void PrewarmBlocksFromDiskCache(u32 physical_address);
 
   void Trace();
 
@@ -297,9 +302,13 @@ protected:
   // On success, returns the index of the memory region (either 0 or 1).
   // If either near code or far code is full, returns std::nullopt.
   std::optional<size_t> SetEmitterStateToFreeCodeRegion();
+  // Whether old blocks should be evicted before compiling more.
+  bool IsCodeSpaceLow();
 
   void DoDownCount();
   void Cleanup();
+  // Advances gather_pipe_ptr past what combined gather pipe stores have written.
+  void FlushGatherPipeOffset();
   void ResetStack();
 
   void FreeRanges();
@@ -354,11 +363,16 @@ protected:
   FakeLKExit(u32 exit_address_after_return,
              Arm64Gen::ARM64Reg exit_address_after_return_reg = Arm64Gen::ARM64Reg::INVALID_REG);
   void WriteBLRExit(Arm64Gen::ARM64Reg dest);
+  // Like WriteExit, but jumps straight to the last target if it is taken again.
+  void WriteIndirectExit(Arm64Gen::ARM64Reg dest, bool LK, u32 exit_address_after_return);
 
   Arm64Gen::FixupBranch JumpIfCRFieldBit(int field, int bit, bool jump_if_set);
   void FixGTBeforeSettingCRFieldBit(Arm64Gen::ARM64Reg reg);
   void UpdateFPExceptionSummary(Arm64Gen::ARM64Reg fpscr);
   void UpdateRoundingMode();
+  // Leaves the block if an FPSCR write changed feature flags that the rest of the block was
+  // compiled for. The registers must be flushed or in a state that can be flushed.
+  void WriteFeatureFlagsChangedExit();
 
   void ComputeRC0(Arm64Gen::ARM64Reg reg);
   void ComputeRC0(u32 imm);
@@ -383,6 +397,8 @@ protected:
   Arm64FPRCache fpr;
 
   JitArm64BlockCache blocks{*this};
+  JitBlockDiskCache m_block_disk_cache;
+  bool m_block_disk_cache_enabled = false;
 
   Arm64Gen::ARM64FloatEmitter m_float_emit;
 
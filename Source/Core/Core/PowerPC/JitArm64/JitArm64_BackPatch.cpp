@@ -59,7 +59,8 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
 {
   const u32 access_size = BackPatchInfo::GetFlagSize(flags);
 
-  if (m_accurate_cpu_cache_enabled)
+  // Only fastmem accesses fault on the pages that hybrid data cache emulation tracks.
+  if (m_accurate_cpu_cache_enabled && !(m_hybrid_cpu_cache_enabled && jo.fastmem))
     mode = MemAccessMode::AlwaysSlowAccess;
 
   const bool emit_fast_access = mode != MemAccessMode::AlwaysSlowAccess;
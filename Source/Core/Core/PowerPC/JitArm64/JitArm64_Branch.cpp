@@ -347,7 +347,7 @@ void JitArm64::bcctrx(UGeckoInstruction inst)
     gpr_caller_save &= CALLER_SAVED_GPRS;
     WriteBranchWatchDestInRegister(js.compilerPC, WA, inst, WC, WD, gpr_caller_save, {});
   }
-  WriteExit(WA, inst.LK_3, js.compilerPC + 4, WB);
+  WriteIndirectExit(WA, inst.LK_3, js.compilerPC + 4);
 }
 
 void JitArm64::bclrx(UGeckoInstruction inst)
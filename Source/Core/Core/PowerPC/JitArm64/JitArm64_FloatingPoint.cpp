@@ -724,17 +724,29 @@ void JitArm64::ConvertSingleToDoubleLower(size_t guest_reg, ARM64Reg dest_reg, A
 
   const bool switch_to_farcode = !IsInFarCode();
 
+  // FPSCR.NI is part of the block's feature flags, so if it's clear, we know that FPCR.FZ is clear.
+  const bool no_flush_to_zero = !(m_ppc_state.feature_flags & FEATURE_FLAG_FPSCR_NI);
+  const bool has_fast_path = no_flush_to_zero || scratch_reg != ARM64Reg::INVALID_REG;
+
   FlushCarry();
 
   // Do we know that the input isn't NaN, and that the input isn't denormal or FPCR.FZ is not set?
-  // (This check unfortunately also catches zeroes)
 
   FixupBranch fast;
-  if (scratch_reg != ARM64Reg::INVALID_REG)
+  if (has_fast_path)
   {
-    m_float_emit.FABS(EncodeRegToSingle(scratch_reg), EncodeRegToSingle(src_reg));
-    m_float_emit.FCMP(EncodeRegToSingle(scratch_reg));
-    fast = B(CCFlags::CC_GT);
+    if (no_flush_to_zero)
+    {
+      m_float_emit.FCMP(EncodeRegToSingle(src_reg));
+      fast = B(CCFlags::CC_VC);
+    }
+    else
+    {
+      // (This check unfortunately also catches zeroes)
+      m_float_emit.FABS(EncodeRegToSingle(scratch_reg), EncodeRegToSingle(src_reg));
+      m_float_emit.FCMP(EncodeRegToSingle(scratch_reg));
+      fast = B(CCFlags::CC_GT);
+    }
 
     if (switch_to_farcode)
     {
@@ -758,7 +770,7 @@ void JitArm64::ConvertSingleToDoubleLower(size_t guest_reg, ARM64Reg dest_reg, A
 
   // If yes, do a fast conversion with FCVT
 
-  if (scratch_reg != ARM64Reg::INVALID_REG)
+  if (has_fast_path)
   {
     FixupBranch continue1 = B();
 
@@ -789,26 +801,38 @@ void JitArm64::ConvertSingleToDoublePair(size_t guest_reg, ARM64Reg dest_reg, AR
   FlushCarry();
 
   // Do we know that neither input is NaN, and that neither input is denormal or FPCR.FZ is not set?
-  // (This check unfortunately also catches zeroes)
 
   FixupBranch fast;
   if (scratch_reg != ARM64Reg::INVALID_REG)
   {
-    // Set each 32-bit element of scratch_reg to 0x0000'0000 or 0xFFFF'FFFF depending on whether
-    // the absolute value of the corresponding element in src_reg compares greater than 0
-    m_float_emit.MOVI(64, EncodeRegToDouble(scratch_reg), 0);
-    m_float_emit.FACGT(32, EncodeRegToDouble(scratch_reg), EncodeRegToDouble(src_reg),
-                       EncodeRegToDouble(scratch_reg));
-
-    // 0x0000'0000'0000'0000 (zero)     -> 0x0000'0000'0000'0000 (zero)
-    // 0x0000'0000'FFFF'FFFF (denormal) -> 0xFF00'0000'FFFF'FFFF (normal)
-    // 0xFFFF'FFFF'0000'0000 (NaN)      -> 0x00FF'FFFF'0000'0000 (normal)
-    // 0xFFFF'FFFF'FFFF'FFFF (NaN)      -> 0xFFFF'FFFF'FFFF'FFFF (NaN)
-    m_float_emit.INS(8, EncodeRegToDouble(scratch_reg), 7, EncodeRegToDouble(scratch_reg), 0);
-
-    // Is scratch_reg a NaN (0xFFFF'FFFF'FFFF'FFFF)?
-    m_float_emit.FCMP(EncodeRegToDouble(scratch_reg));
-    fast = B(CCFlags::CC_VS);
+    if (!(m_ppc_state.feature_flags & FEATURE_FLAG_FPSCR_NI))
+    {
+      // FPSCR.NI is part of the block's feature flags, so we know that FPCR.FZ is clear and only
+      // have to check for NaNs. FMAXP returns NaN if either input is NaN.
+      m_float_emit.FMAXP(EncodeRegToSingle(scratch_reg), EncodeRegToDouble(src_reg));
+      m_float_emit.FCMP(EncodeRegToSingle(scratch_reg));
+      fast = B(CCFlags::CC_VC);
+    }
+    else
+    {
+      // (This check unfortunately also catches zeroes)
+
+      // Set each 32-bit element of scratch_reg to 0x0000'0000 or 0xFFFF'FFFF depending on whether
+      // the absolute value of the corresponding element in src_reg compares greater than 0
+      m_float_emit.MOVI(64, EncodeRegToDouble(scratch_reg), 0);
+      m_float_emit.FACGT(32, EncodeRegToDouble(scratch_reg), EncodeRegToDouble(src_reg),
+                         EncodeRegToDouble(scratch_reg));
+
+      // 0x0000'0000'0000'0000 (zero)     -> 0x0000'0000'0000'0000 (zero)
+      // 0x0000'0000'FFFF'FFFF (denormal) -> 0xFF00'0000'FFFF'FFFF (normal)
+      // 0xFFFF'FFFF'0000'0000 (NaN)      -> 0x00FF'FFFF'0000'0000 (normal)
+      // 0xFFFF'FFFF'FFFF'FFFF (NaN)      -> 0xFFFF'FFFF'FFFF'FFFF (NaN)
+      m_float_emit.INS(8, EncodeRegToDouble(scratch_reg), 7, EncodeRegToDouble(scratch_reg), 0);
+
+      // Is scratch_reg a NaN (0xFFFF'FFFF'FFFF'FFFF)?
+      m_float_emit.FCMP(EncodeRegToDouble(scratch_reg));
+      fast = B(CCFlags::CC_VS);
+    }
 
     if (switch_to_farcode)
     {
@@ -9,6 +9,7 @@
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/ScopeGuard.h"
+#include "Common/Swap.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -181,8 +182,6 @@ void JitArm64::SafeStoreFromReg(s32 dest, u32 value, s32 regOffset, u32 flags, s
   if (!jo.fastmem)
     gpr.Lock(ARM64Reg::W0);
 
-  ARM64Reg RS = gpr.R(value);
-
   ARM64Reg reg_dest = ARM64Reg::INVALID_REG;
   ARM64Reg reg_off = ARM64Reg::INVALID_REG;
 
@@ -262,6 +261,35 @@ void JitArm64::SafeStoreFromReg(s32 dest, u32 value, s32 regOffset, u32 flags, s
       MOVI2R(XA, imm_addr);
   };
 
+  const u32 access_size = BackPatchInfo::GetFlagSize(flags);
+  const bool gather_pipe_write =
+      is_immediate && jo.optimizeGatherPipe && m_mmu.IsOptimizableGatherPipeWrite(imm_addr);
+  const bool unchecked_ram_write = !gather_pipe_write && is_immediate &&
+                                   m_mmu.IsOptimizableRAMAddress(imm_addr, access_size);
+
+  // If both the address and the value are known, we can byteswap the value at compile time and
+  // store it directly. The value doesn't have to be put in a register in that case.
+  const bool imm_value =
+      gpr.IsImm(value) &&
+      (gather_pipe_write || (unchecked_ram_write && jo.fastmem && !m_accurate_cpu_cache_enabled));
+  const ARM64Reg RS = imm_value ? ARM64Reg::INVALID_REG : gpr.R(value);
+  const auto imm_value_to_reg = [&](ARM64Reg tmp) {
+    u32 swapped = gpr.GetImm(value);
+    if (!(flags & BackPatchInfo::FLAG_REVERSE))
+    {
+      if (access_size == 32)
+        swapped = Common::swap32(swapped);
+      else if (access_size == 16)
+        swapped = Common::swap16(static_cast<u16>(swapped));
+    }
+    swapped &= 0xFFFFFFFFU >> (32 - access_size);
+
+    if (swapped == 0)
+      return ARM64Reg::WZR;
+    MOVI2R(tmp, swapped);
+    return tmp;
+  };
+
   const bool early_update = !jo.memcheck && value != static_cast<u32>(dest);
   if (update && early_update)
   {
@@ -278,38 +306,50 @@ void JitArm64::SafeStoreFromReg(s32 dest, u32 value, s32 regOffset, u32 flags, s
   if (!jo.fastmem)
     regs_in_use[DecodeReg(ARM64Reg::W0)] = 0;
 
-  u32 access_size = BackPatchInfo::GetFlagSize(flags);
   u32 mmio_address = 0;
   if (is_immediate)
     mmio_address = m_mmu.IsOptimizableMMIOAccess(imm_addr, access_size);
 
-  if (is_immediate && jo.optimizeGatherPipe && m_mmu.IsOptimizableGatherPipeWrite(imm_addr))
+  if (gather_pipe_write)
   {
-    int accessSize;
-    if (flags & BackPatchInfo::FLAG_SIZE_32)
-      accessSize = 32;
-    else if (flags & BackPatchInfo::FLAG_SIZE_16)
-      accessSize = 16;
-    else
-      accessSize = 8;
-
     LDR(IndexType::Unsigned, ARM64Reg::X2, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
 
     ARM64Reg temp = ARM64Reg::W1;
-    temp = ByteswapBeforeStore(this, &m_float_emit, temp, RS, flags, true);
+    if (imm_value)
+      temp = imm_value_to_reg(temp);
+    else
+      temp = ByteswapBeforeStore(this, &m_float_emit, temp, RS, flags, true);
 
-    if (accessSize == 32)
-      STR(IndexType::Post, temp, ARM64Reg::X2, 4);
-    else if (accessSize == 16)
-      STRH(IndexType::Post, temp, ARM64Reg::X2, 2);
+    // A run of stores to the gather pipe only advances the pointer after the last of them.
+    if (access_size == 32)
+      STUR(temp, ARM64Reg::X2, js.gatherPipeOffset);
+    else if (access_size == 16)
+      STURH(temp, ARM64Reg::X2, js.gatherPipeOffset);
     else
-      STRB(IndexType::Post, temp, ARM64Reg::X2, 1);
+      STURB(temp, ARM64Reg::X2, js.gatherPipeOffset);
+    js.gatherPipeOffset += access_size >> 3;
+    js.fifoBytesSinceCheck += access_size >> 3;
 
-    STR(IndexType::Unsigned, ARM64Reg::X2, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+    if (!CanCombineNextGatherPipeStore())
+    {
+      ADD(ARM64Reg::X2, ARM64Reg::X2, js.gatherPipeOffset);
+      STR(IndexType::Unsigned, ARM64Reg::X2, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+      js.gatherPipeOffset = 0;
+    }
+  }
+  else if (unchecked_ram_write && imm_value)
+  {
+    set_addr_reg_if_needed();
+    const ARM64Reg temp = imm_value_to_reg(ARM64Reg::W1);
 
-    js.fifoBytesSinceCheck += accessSize >> 3;
+    if (access_size == 32)
+      STR(temp, MEM_REG, XA);
+    else if (access_size == 16)
+      STRH(temp, MEM_REG, XA);
+    else
+      STRB(temp, MEM_REG, XA);
   }
-  else if (is_immediate && m_mmu.IsOptimizableRAMAddress(imm_addr, access_size))
+  else if (unchecked_ram_write)
   {
     set_addr_reg_if_needed();
     EmitBackpatchRoutine(flags, MemAccessMode::AlwaysFastAccess, RS, XA, regs_in_use, fprs_in_use);
@@ -1049,8 +1089,12 @@ void JitArm64::dcbz(UGeckoInstruction inst)
   if (!jo.fastmem)
     gprs_to_push[DecodeReg(ARM64Reg::W0)] = 0;
 
-  EmitBackpatchRoutine(BackPatchInfo::FLAG_ZERO_256, MemAccessMode::Auto, ARM64Reg::W1,
-                       EncodeRegTo64(addr_reg), gprs_to_push, fprs_to_push);
+  // With the data cache emulated, dcbz has to go through the MMU, which also starts tracking the
+  // page for hybrid data cache emulation.
+  const MemAccessMode mode =
+      m_accurate_cpu_cache_enabled ? MemAccessMode::AlwaysSlowAccess : MemAccessMode::Auto;
+  EmitBackpatchRoutine(BackPatchInfo::FLAG_ZERO_256, mode, ARM64Reg::W1, EncodeRegTo64(addr_reg),
+                       gprs_to_push, fprs_to_push);
 
   if (using_dcbz_hack)
     SetJumpTarget(end_dcbz_hack);
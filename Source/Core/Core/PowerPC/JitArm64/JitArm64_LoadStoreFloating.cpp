@@ -393,11 +393,17 @@ void JitArm64::stfXX(UGeckoInstruction inst)
       else if (flags & BackPatchInfo::FLAG_SIZE_32)
         m_float_emit.REV32(8, ARM64Reg::D0, V0);
 
-      m_float_emit.STR(accessSize, IndexType::Post, accessSize == 64 ? ARM64Reg::Q0 : ARM64Reg::D0,
-                       ARM64Reg::X2, accessSize >> 3);
-
-      STR(IndexType::Unsigned, ARM64Reg::X2, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+      m_float_emit.STUR(accessSize, accessSize == 64 ? ARM64Reg::Q0 : ARM64Reg::D0, ARM64Reg::X2,
+                        js.gatherPipeOffset);
+      js.gatherPipeOffset += accessSize >> 3;
       js.fifoBytesSinceCheck += accessSize >> 3;
+
+      if (!CanCombineNextGatherPipeStore())
+      {
+        ADD(ARM64Reg::X2, ARM64Reg::X2, js.gatherPipeOffset);
+        STR(IndexType::Unsigned, ARM64Reg::X2, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+        js.gatherPipeOffset = 0;
+      }
     }
     else if (m_mmu.IsOptimizableRAMAddress(imm_addr, BackPatchInfo::GetFlagSize(flags)))
     {
@@ -82,6 +82,30 @@ void JitArm64::UpdateRoundingMode()
   ABI_CallFunction(&PowerPC::RoundingModeUpdated, &m_ppc_state);
   m_float_emit.ABI_PopRegisters(fprs_to_save, ARM64Reg::X8);
   ABI_PopRegisters(gprs_to_save);
+
+  WriteFeatureFlagsChangedExit();
+}
+
+void JitArm64::WriteFeatureFlagsChangedExit()
+{
+  auto WA = gpr.GetScopedReg();
+  LDR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF(feature_flags));
+  CMP(WA, m_ppc_state.feature_flags);
+  FixupBranch unchanged = B(CC_EQ);
+  FixupBranch changed = B();
+
+  SwitchToFarCode();
+  SetJumpTarget(changed);
+
+  gpr.Flush(FlushMode::MaintainState, WA);
+  fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
+
+  // Go through the dispatcher, since a linked exit would stay with the old feature flags.
+  MOVI2R(DISPATCHER_PC, js.compilerPC + 4);
+  WriteExit(DISPATCHER_PC);
+
+  SwitchToNearCode();
+  SetJumpTarget(unchanged);
 }
 
 void JitArm64::mtmsr(UGeckoInstruction inst)
@@ -21,6 +21,7 @@
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -185,9 +186,21 @@ void JitArm64::GenerateAsm()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   EmitUpdateMembase();
 
+  // With tiered compilation, JitTrampoline may have run a block in the cold tier.
+  const bool has_cold_tier = m_system.GetJitInterface().HasColdTier();
+  FixupBranch cold_tier_bail;
+  if (has_cold_tier)
+  {
+    LDR(IndexType::Unsigned, ARM64Reg::W8, PPC_REG, PPCSTATE_OFF(downcount));
+    CMP(ARM64Reg::W8, 0);
+    cold_tier_bail = B(CC_LE);
+  }
+
   B(dispatcher_no_check);
 
   SetJumpTarget(bail);
+  if (has_cold_tier)
+    SetJumpTarget(cold_tier_bail);
   do_timing = GetCodePtr();
   // Write the current PC out to PPCSTATE
   static_assert(PPCSTATE_OFF(pc) <= 252);
@@ -32,6 +32,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(void (*function)(Core::System&, u32, T)) override
+  {
+    CallFunction(8 * sizeof(T), function);
+  }
 
 private:
   void StoreFromRegister(int sbits, ARM64Reg reg, s32 offset)
@@ -72,19 +76,31 @@ private:
     }
   }
 
-  void CallLambda(int sbits, const std::function<void(Core::System&, u32, T)>* lambda)
+  template <typename EmitCall>
+  void CallHandler(EmitCall emit_call)
   {
     ARM64FloatEmitter float_emit(m_emit);
 
     m_emit->ABI_PushRegisters(m_gprs_in_use);
     float_emit.ABI_PushRegisters(m_fprs_in_use, ARM64Reg::X1);
 
-    m_emit->ABI_CallLambdaFunction(lambda, m_system, m_address, m_src_reg);
+    emit_call();
 
     float_emit.ABI_PopRegisters(m_fprs_in_use, ARM64Reg::X1);
     m_emit->ABI_PopRegisters(m_gprs_in_use);
   }
 
+  void CallLambda(int sbits, const std::function<void(Core::System&, u32, T)>* lambda)
+  {
+    CallHandler([&] { m_emit->ABI_CallLambdaFunction(lambda, m_system, m_address, m_src_reg); });
+  }
+
+  void CallFunction(int sbits, void (*function)(Core::System&, u32, T))
+  {
+    // Calling the function directly skips the std::function trampoline.
+    CallHandler([&] { m_emit->ABI_CallFunction(function, m_system, m_address, m_src_reg); });
+  }
+
   Core::System* m_system;
   ARM64XEmitter* m_emit;
   BitSet32 m_gprs_in_use;
@@ -113,6 +129,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(T (*function)(Core::System&, u32)) override
+  {
+    CallFunction(8 * sizeof(T), function);
+  }
 
 private:
   void LoadConstantToReg(int sbits, u32 value)
@@ -168,14 +188,15 @@ private:
     }
   }
 
-  void CallLambda(int sbits, const std::function<T(Core::System&, u32)>* lambda)
+  template <typename EmitCall>
+  void CallHandler(int sbits, EmitCall emit_call)
   {
     ARM64FloatEmitter float_emit(m_emit);
 
     m_emit->ABI_PushRegisters(m_gprs_in_use);
     float_emit.ABI_PushRegisters(m_fprs_in_use, ARM64Reg::X1);
 
-    m_emit->ABI_CallLambdaFunction(lambda, m_system, m_address);
+    emit_call();
 
     if (m_sign_extend)
       m_emit->SBFM(m_dst_reg, ARM64Reg::W0, 0, sbits - 1);
@@ -186,6 +207,17 @@ private:
     m_emit->ABI_PopRegisters(m_gprs_in_use);
   }
 
+  void CallLambda(int sbits, const std::function<T(Core::System&, u32)>* lambda)
+  {
+    CallHandler(sbits, [&] { m_emit->ABI_CallLambdaFunction(lambda, m_system, m_address); });
+  }
+
+  void CallFunction(int sbits, T (*function)(Core::System&, u32))
+  {
+    // Calling the function directly skips the std::function trampoline.
+    CallHandler(sbits, [&] { m_emit->ABI_CallFunction(function, m_system, m_address); });
+  }
+
   Core::System* m_system;
   ARM64XEmitter* m_emit;
   BitSet32 m_gprs_in_use;
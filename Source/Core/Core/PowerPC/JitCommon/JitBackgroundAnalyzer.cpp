@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBackgroundAnalyzer.h"
+
+#include <algorithm>
+#include <utility>
+
+JitBackgroundAnalyzer::JitBackgroundAnalyzer() = default;
+
+JitBackgroundAnalyzer::~JitBackgroundAnalyzer()
+{
+  m_worker.Shutdown(true);
+}
+
+JitBackgroundAnalyzer::Status JitBackgroundAnalyzer::GetStatus(u32 address,
+                                                               CPUEmuFeatureFlags feature_flags) const
+{
+  if (!m_has_entries.load(std::memory_order_relaxed))
+    return Status::None;
+
+  std::lock_guard lk(m_lock);
+  const auto it = m_entries.find(MakeKey(address, feature_flags));
+  if (it == m_entries.end())
+    return Status::None;
+  return it->second.prepared ? Status::Ready : Status::Pending;
+}
+
+bool JitBackgroundAnalyzer::Submit(const PPCAnalyst::PPCAnalyzer& analyzer,
+                                   const PPCAnalyst::CodeBlock& block,
+                                   std::span<const PPCAnalyst::CodeOp> code, u32 next_address,
+                                   CPUEmuFeatureFlags feature_flags)
+{
+  Job job{.key = MakeKey(block.m_address, feature_flags),
+          .serial = 0,
+          .analyzer = analyzer,
+          .prepared = {.block = block,
+                       .stats = *block.m_stats,
+                       .gpa = *block.m_gpa,
+                       .fpa = *block.m_fpa,
+                       .code = PPCAnalyst::CodeBuffer(code.begin(), code.end()),
+                       .next_address = next_address}};
+
+  {
+    std::lock_guard lk(m_lock);
+    if (m_entries.size() >= MAX_QUEUED_BLOCKS)
+      return false;
+
+    job.serial = m_next_serial++;
+    m_entries.insert_or_assign(job.key, Entry{job.serial, block.m_physical_addresses, {}});
+    m_has_entries.store(true, std::memory_order_relaxed);
+  }
+
+  if (!std::exchange(m_worker_started, true))
+    m_worker.Reset("JIT Analysis", [this](Job j) { AnalyzeBlock(std::move(j)); }, true);
+
+  m_worker.Push(std::move(job));
+  return true;
+}
+
+void JitBackgroundAnalyzer::AnalyzeBlock(Job job)
+{
+  PreparedBlock& prepared = job.prepared;
+  prepared.block.m_stats = &prepared.stats;
+  prepared.block.m_gpa = &prepared.gpa;
+  prepared.block.m_fpa = &prepared.fpa;
+  job.analyzer.AnalyzeFetchedBlock(&prepared.block, &prepared.code);
+
+  std::lock_guard lk(m_lock);
+  const auto it = m_entries.find(job.key);
+  // The block may have been invalidated or compiled synchronously in the meantime.
+  if (it != m_entries.end() && it->second.serial == job.serial)
+    it->second.prepared = std::move(prepared);
+}
+
+std::optional<u32> JitBackgroundAnalyzer::Take(u32 address, CPUEmuFeatureFlags feature_flags,
+                                               PPCAnalyst::CodeBlock* block,
+                                               PPCAnalyst::CodeBuffer* buffer)
+{
+  if (!m_has_entries.load(std::memory_order_relaxed))
+    return std::nullopt;
+
+  std::optional<PreparedBlock> prepared;
+  {
+    std::lock_guard lk(m_lock);
+    const auto it = m_entries.find(MakeKey(address, feature_flags));
+    if (it == m_entries.end())
+      return std::nullopt;
+    prepared = std::move(it->second.prepared);
+    m_entries.erase(it);
+    m_has_entries.store(!m_entries.empty(), std::memory_order_relaxed);
+  }
+
+  if (!prepared || prepared->code.size() > buffer->size())
+    return std::nullopt;
+
+  // Keep the statistics pointers of the destination block, which point into the JIT's state.
+  PPCAnalyst::BlockStats* const stats = block->m_stats;
+  PPCAnalyst::BlockRegStats* const gpa = block->m_gpa;
+  PPCAnalyst::BlockRegStats* const fpa = block->m_fpa;
+  *block = std::move(prepared->block);
+  block->m_stats = stats;
+  block->m_gpa = gpa;
+  block->m_fpa = fpa;
+  *stats = prepared->stats;
+  *gpa = prepared->gpa;
+  *fpa = prepared->fpa;
+  std::ranges::copy(prepared->code, buffer->begin());
+
+  return prepared->next_address;
+}
+
+void JitBackgroundAnalyzer::Discard()
+{
+  if (!m_has_entries.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard lk(m_lock);
+  m_entries.clear();
+  m_has_entries.store(false, std::memory_order_relaxed);
+}
+
+void JitBackgroundAnalyzer::Discard(u32 physical_address, u32 length)
+{
+  if (!m_has_entries.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard lk(m_lock);
+  std::erase_if(m_entries, [physical_address, length](const auto& pair) {
+    const std::set<u32>& addresses = pair.second.physical_addresses;
+    const auto it = addresses.lower_bound(physical_address);
+    return it != addresses.end() && *it - physical_address < length;
+  });
+  m_has_entries.store(!m_entries.empty(), std::memory_order_relaxed);
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+// Runs the expensive part of block analysis (instruction reordering and the register and flag
+// liveness scans) on a worker thread, for blocks that the JIT is expected to compile soon.
+//
+// The instructions are fetched on the CPU thread by PPCAnalyzer::FetchBlock, since that depends on
+// the MMU, HLE hooks and breakpoints. When the JIT later compiles the block, it picks up the
+// finished analysis instead of analyzing the block again. Code emission itself stays on the CPU
+// thread: the emitters, register caches and block cache are not thread-safe, and emitted code
+// refers to the asm routines and block links of the JIT that emitted it.
+class JitBackgroundAnalyzer
+{
+public:
+  enum class Status
+  {
+    None,
+    Pending,
+    Ready,
+  };
+
+  JitBackgroundAnalyzer();
+  ~JitBackgroundAnalyzer();
+
+  Status GetStatus(u32 address, CPUEmuFeatureFlags feature_flags) const;
+
+  // Queues the analysis of a block fetched with analyzer.FetchBlock. Returns false if too many
+  // blocks are already queued.
+  bool Submit(const PPCAnalyst::PPCAnalyzer& analyzer, const PPCAnalyst::CodeBlock& block,
+              std::span<const PPCAnalyst::CodeOp> code, u32 next_address,
+              CPUEmuFeatureFlags feature_flags);
+
+  // If the analysis of the block at address is finished, copies it into block and buffer and
+  // returns the address following the block. Any analysis of that block which is still running
+  // is discarded.
+  std::optional<u32> Take(u32 address, CPUEmuFeatureFlags feature_flags,
+                          PPCAnalyst::CodeBlock* block, PPCAnalyst::CodeBuffer* buffer);
+
+  void Discard();
+  void Discard(u32 physical_address, u32 length);
+
+private:
+  static constexpr size_t MAX_QUEUED_BLOCKS = 64;
+
+  struct PreparedBlock
+  {
+    PPCAnalyst::CodeBlock block;
+    PPCAnalyst::BlockStats stats;
+    PPCAnalyst::BlockRegStats gpa;
+    PPCAnalyst::BlockRegStats fpa;
+    PPCAnalyst::CodeBuffer code;
+    u32 next_address;
+  };
+
+  struct Job
+  {
+    u64 key;
+    u64 serial;
+    PPCAnalyst::PPCAnalyzer analyzer;
+    PreparedBlock prepared;
+  };
+
+  struct Entry
+  {
+    u64 serial;
+    std::set<u32> physical_addresses;
+    std::optional<PreparedBlock> prepared;
+  };
+
+  static u64 MakeKey(u32 address, CPUEmuFeatureFlags feature_flags)
+  {
+    return (u64{feature_flags} << 32) | address;
+  }
+
+  void AnalyzeBlock(Job job);
+
+  mutable std::mutex m_lock;
+  std::unordered_map<u64, Entry> m_entries;
+  std::atomic<bool> m_has_entries = false;
+  u64 m_next_serial = 0;
+  bool m_worker_started = false;
+
+  // Declared last so that the worker is stopped before the state it uses is destroyed.
+  Common::WorkQueueThread<Job> m_worker;
+};
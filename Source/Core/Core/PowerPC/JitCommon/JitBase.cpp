@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <array>
+#include <optional>
+#include <span>
 #include <utility>
 
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
 #include "Core/CPUThreadConfigCallback.h"
@@ -18,7 +22,9 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/GPFifo.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +63,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,6 +80,7 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_trace_formation, &Config::MAIN_JIT_TRACE_FORMATION},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
@@ -81,6 +88,7 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_hybrid_cpu_cache_enabled, &Config::MAIN_HYBRID_CPU_CACHE},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -90,6 +98,9 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  if (jit.m_system.GetJitInterface().ExecuteInColdTier(em_address))
+    return;
+
   jit.Jit(em_address);
 }
 
@@ -112,9 +123,10 @@ JitBase::~JitBase()
 
 bool JitBase::DoesConfigNeedRefresh()
 {
-  return std::any_of(JIT_SETTINGS.begin(), JIT_SETTINGS.end(), [this](const auto& pair) {
-    return this->*pair.first != Config::Get(*pair.second);
-  });
+  return m_idle_loop_addresses != Config::Get(Config::MAIN_IDLE_LOOP_ADDRESSES) ||
+         std::any_of(JIT_SETTINGS.begin(), JIT_SETTINGS.end(), [this](const auto& pair) {
+           return this->*pair.first != Config::Get(*pair.second);
+         });
 }
 
 void JitBase::RefreshConfig()
@@ -124,16 +136,33 @@ void JitBase::RefreshConfig()
 
   if (m_accurate_cpu_cache_enabled)
   {
-    m_fastmem_enabled = false;
+    // With hybrid data cache emulation, the pages the data cache is emulated for are inaccessible
+    // in the fastmem arena, so fastmem accesses to them end up on the slow path.
+    if (!m_hybrid_cpu_cache_enabled)
+      m_fastmem_enabled = false;
     // This hack is unneeded if the data cache is being emulated.
     m_low_dcbz_hack = false;
   }
 
   analyzer.SetDebuggingEnabled(m_enable_debugging);
   analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
+  // With tiered compilation, only blocks the cold tier has found to be hot reach this JIT, so
+  // it's worth spending more code on them.
+  analyzer.SetTraceFormationEnabled(m_enable_trace_formation &&
+                                    m_system.GetJitInterface().HasColdTier());
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
+  m_idle_loop_addresses = Config::Get(Config::MAIN_IDLE_LOOP_ADDRESSES);
+  std::vector<u32> idle_loop_addresses;
+  if (!m_idle_loop_addresses.empty() &&
+      !TryParseVector(m_idle_loop_addresses, &idle_loop_addresses))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring invalid idle loop addresses \"{}\"", m_idle_loop_addresses);
+    idle_loop_addresses.clear();
+  }
+  analyzer.SetIdleLoopAddresses(std::move(idle_loop_addresses));
+
   bool any_watchpoints = m_system.GetPowerPC().GetMemChecks().HasAny();
   jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
                EMM::IsExceptionHandlerSupported();
@@ -260,6 +289,58 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+bool JitBase::PrepareBlockInBackground(u32 em_address)
+{
+  switch (m_background_analyzer.GetStatus(em_address, m_ppc_state.feature_flags))
+  {
+  case JitBackgroundAnalyzer::Status::Pending:
+    return true;
+  case JitBackgroundAnalyzer::Status::Ready:
+    return false;
+  case JitBackgroundAnalyzer::Status::None:
+    break;
+  }
+
+  const u32 next_address =
+      analyzer.FetchBlock(em_address, &code_block, &m_code_buffer, m_code_buffer.size());
+  if (code_block.m_memory_exception)
+    return false;
+
+  return m_background_analyzer.Submit(
+      analyzer, code_block, std::span(m_code_buffer.data(), code_block.m_num_instructions),
+      next_address, m_ppc_state.feature_flags);
+}
+
+u32 JitBase::AnalyzeBlock(u32 em_address, std::size_t block_size)
+{
+  if (block_size == m_code_buffer.size())
+  {
+    if (const std::optional<u32> next_address = m_background_analyzer.Take(
+            em_address, m_ppc_state.feature_flags, &code_block, &m_code_buffer))
+    {
+      ReportPossibleIdleLoop();
+      return *next_address;
+    }
+  }
+
+  const u32 next_address = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  ReportPossibleIdleLoop();
+  return next_address;
+}
+
+void JitBase::ReportPossibleIdleLoop()
+{
+  if (!code_block.m_possible_idle_loop)
+    return;
+  if (!m_reported_idle_loops.insert(code_block.m_address).second)
+    return;
+
+  NOTICE_LOG_FMT(DYNA_REC,
+                 "Possible idle loop at {:#010x}. If the game waits there for an interrupt, add "
+                 "the address to Core/IdleLoopAddresses in its game INI to skip the loop.",
+                 code_block.m_address);
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
@@ -276,6 +357,14 @@ bool JitBase::CanMergeNextInstructions(int count) const
   return true;
 }
 
+bool JitBase::CanCombineNextGatherPipeStore() const
+{
+  // The FIFO check between the stores reads gather_pipe_ptr.
+  return CanMergeNextInstructions(1) && js.op[1].isStoreRunContinuation &&
+         !js.op[1].isHookedOrBreakpoint && !js.mustCheckFifo &&
+         js.fifoBytesSinceCheck < GPFifo::GATHER_PIPE_SIZE;
+}
+
 bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op)
 {
   if (jo.fp_exceptions)
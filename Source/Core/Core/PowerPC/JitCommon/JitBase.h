@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <iosfwd>
 #include <map>
+#include <set>
+#include <string>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -21,6 +23,7 @@
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
+#include "Core/PowerPC/JitCommon/JitBackgroundAnalyzer.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
@@ -118,6 +121,8 @@ protected:
 
     bool mustCheckFifo;
     u32 fifoBytesSinceCheck;
+    // Bytes that gather pipe stores have written past gather_pipe_ptr without advancing it yet.
+    u32 gatherPipeOffset;
 
     PPCAnalyst::BlockStats st;
     PPCAnalyst::BlockRegStats gpa;
@@ -130,11 +135,16 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+
+    // Where the host code of each guest instruction of the block starts. Only filled in while a
+    // jitdump is being written.
+    std::vector<const u8*> instruction_host_addresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
   PPCAnalyst::CodeBuffer m_code_buffer;
   PPCAnalyst::PPCAnalyzer analyzer;
+  JitBackgroundAnalyzer m_background_analyzer;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
   bool bJITOff = false;
@@ -153,6 +163,7 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_trace_formation = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -160,12 +171,14 @@ protected:
   bool m_accurate_nans = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_hybrid_cpu_cache_enabled = false;
+  std::string m_idle_loop_addresses;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh();
   void RefreshConfig();
@@ -177,6 +190,14 @@ protected:
   void UnprotectStack();
   void CleanUpAfterStackFault();
 
+  // Analyzes the block at em_address into code_block and m_code_buffer, reusing the result of
+  // PrepareBlockInBackground if there is one. Returns the address following the block.
+  u32 AnalyzeBlock(u32 em_address, std::size_t block_size);
+
+  // Logs once per address that code_block could be added to the idle loop addresses.
+  void ReportPossibleIdleLoop();
+  std::set<u32> m_reported_idle_loops;
+
   bool CanMergeNextInstructions(int count) const;
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
@@ -192,11 +213,24 @@ public:
   bool IsProfilingEnabled() const { return m_enable_profiling; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
 
+  // Whether the gather pipe store being compiled can leave advancing gather_pipe_ptr to the next
+  // instruction, which stores to the gather pipe as well.
+  bool CanCombineNextGatherPipeStore() const;
+
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Starts analyzing the block at em_address on a worker thread, if that hasn't been done yet.
+  // Returns true as long as the analysis is still running.
+  bool PrepareBlockInBackground(u32 em_address);
+  void DiscardPreparedBlocks() { m_background_analyzer.Discard(); }
+  void DiscardPreparedBlocks(u32 physical_address, u32 length)
+  {
+    m_background_analyzer.Discard(physical_address, length);
+  }
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -0,0 +1,165 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+namespace
+{
+constexpr u32 CACHE_FILE_MAGIC = 0x43424A44;  // "DJBC"
+constexpr u32 CACHE_FILE_VERSION = 1;
+
+struct CacheFileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 num_entries;
+  u32 entry_size;
+};
+static_assert(std::is_trivially_copyable_v<CacheFileHeader>);
+static_assert(std::is_trivially_copyable_v<JitBlockDiskCache::Entry>);
+}  // namespace
+
+JitBlockDiskCache::JitBlockDiskCache() = default;
+
+JitBlockDiskCache::~JitBlockDiskCache()
+{
+  Save();
+}
+
+std::string JitBlockDiskCache::GetPath() const
+{
+  return fmt::format("{}{}.jitblocks", File::GetUserPath(D_JITCACHE_IDX), m_game_id);
+}
+
+void JitBlockDiskCache::LoadForGame(const std::string& game_id)
+{
+  if (game_id == m_game_id)
+    return;
+
+  Save();
+  Clear();
+  m_game_id = game_id;
+  if (m_game_id.empty())
+    return;
+
+  File::IOFile file(GetPath(), "rb");
+  if (!file)
+    return;
+
+  CacheFileHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != CACHE_FILE_MAGIC ||
+      header.version != CACHE_FILE_VERSION || header.entry_size != sizeof(Entry))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring incompatible JIT block cache {}", GetPath());
+    return;
+  }
+
+  std::vector<Entry> entries(std::min(header.num_entries, MAX_ENTRIES));
+  if (!file.ReadArray(entries.data(), entries.size()))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring truncated JIT block cache {}", GetPath());
+    return;
+  }
+
+  for (const Entry& entry : entries)
+  {
+    m_entries.emplace(Key{entry.effective_address, entry.feature_flags}, StoredEntry{entry});
+    m_pending[entry.physical_address >> REGION_SHIFT].push_back(entry);
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} entries from JIT block cache {}", entries.size(), GetPath());
+}
+
+void JitBlockDiskCache::Save()
+{
+  if (!m_dirty || m_game_id.empty())
+    return;
+
+  // Keep the blocks that were actually used in this session if we have to drop entries.
+  std::vector<const StoredEntry*> stored;
+  stored.reserve(m_entries.size());
+  for (const auto& [key, stored_entry] : m_entries)
+    stored.push_back(&stored_entry);
+  std::ranges::stable_partition(stored, &StoredEntry::used);
+
+  std::vector<Entry> entries;
+  entries.reserve(std::min<size_t>(stored.size(), MAX_ENTRIES));
+  for (size_t i = 0; i < stored.size() && i < MAX_ENTRIES; ++i)
+    entries.push_back(stored[i]->entry);
+
+  const std::string path = GetPath();
+  File::CreateFullPath(path);
+  File::IOFile file(path, "wb");
+  const CacheFileHeader header{CACHE_FILE_MAGIC, CACHE_FILE_VERSION,
+                               static_cast<u32>(entries.size()), sizeof(Entry)};
+  if (!file.WriteArray(&header, 1) || !file.WriteArray(entries.data(), entries.size()))
+  {
+    ERROR_LOG_FMT(DYNA_REC, "Failed to write JIT block cache {}", path);
+    return;
+  }
+
+  m_dirty = false;
+}
+
+void JitBlockDiskCache::Clear()
+{
+  m_entries.clear();
+  m_pending.clear();
+  m_dirty = false;
+}
+
+void JitBlockDiskCache::RecordBlock(const JitBlock& block, std::span<const PPCAnalyst::CodeOp> code)
+{
+  if (m_game_id.empty())
+    return;
+
+  const Entry entry{block.effectiveAddress, block.physicalAddress, block.feature_flags,
+                    block.originalSize, HashCode(code)};
+  StoredEntry& stored = m_entries[Key{entry.effective_address, entry.feature_flags}];
+  stored.entry = entry;
+  stored.used = true;
+  m_dirty = true;
+}
+
+std::vector<JitBlockDiskCache::Entry>
+JitBlockDiskCache::TakePendingEntries(u32 physical_address, CPUEmuFeatureFlags feature_flags)
+{
+  std::vector<Entry> result;
+
+  const auto it = m_pending.find(physical_address >> REGION_SHIFT);
+  if (it == m_pending.end())
+    return result;
+
+  std::vector<Entry>& entries = it->second;
+  const auto remaining = std::ranges::partition(
+      entries, [feature_flags](const Entry& e) { return e.feature_flags != feature_flags; });
+  result.assign(remaining.begin(), remaining.end());
+  entries.erase(remaining.begin(), remaining.end());
+  if (entries.empty())
+    m_pending.erase(it);
+
+  return result;
+}
+
+u64 JitBlockDiskCache::HashCode(std::span<const PPCAnalyst::CodeOp> code)
+{
+  u64 hash = code.size();
+  for (const PPCAnalyst::CodeOp& op : code)
+  {
+    const u32 data[] = {op.address, op.inst.hex};
+    hash = XXH3_64bits_withSeed(data, sizeof(data), hash);
+  }
+  return hash;
+}
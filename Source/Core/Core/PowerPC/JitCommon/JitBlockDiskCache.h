@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+struct JitBlock;
+
+// Persists a description of every block the JIT compiled during a session, so that the next
+// session for the same game can compile those blocks in bulk as soon as execution reaches the
+// memory region they live in, instead of taking one JIT miss per block spread over gameplay.
+//
+// Host code is never stored: emitted code embeds absolute host pointers (ppcState, MMU and
+// interpreter fallbacks, fastmem trampolines), so persisting it would require relocating every
+// emitted immediate. Instead, each entry identifies a guest block by its entry point, feature
+// flags and a hash of the analyzed instruction stream. A block is only re-emitted if the analyzer
+// produces an identical instruction stream from the current guest memory, and the resulting
+// blocks are regular JitBlocks, so InvalidateICache and ErasePhysicalRange handle them as usual.
+class JitBlockDiskCache
+{
+public:
+  struct Entry
+  {
+    u32 effective_address;
+    u32 physical_address;
+    u32 feature_flags;
+    u32 num_instructions;
+    u64 code_hash;
+  };
+
+  // Size of the guest physical memory regions that are prewarmed together.
+  static constexpr u32 REGION_SHIFT = 16;
+  static constexpr u32 MAX_ENTRIES = 0x20000;
+
+  JitBlockDiskCache();
+  ~JitBlockDiskCache();
+
+  // Loads the cache for the given game unless it's already loaded. The previously loaded cache
+  // (if any) is written back to disk first. Passing an empty game ID unloads the cache.
+  void LoadForGame(const std::string& game_id);
+  void Save();
+  void Clear();
+
+  const std::string& GetGameID() const { return m_game_id; }
+  bool HasPendingEntries() const { return !m_pending.empty(); }
+
+  void RecordBlock(const JitBlock& block, std::span<const PPCAnalyst::CodeOp> code);
+
+  // Removes and returns all not yet prewarmed entries in the region containing physical_address
+  // which can be compiled with the given feature flags. Each entry is handed out at most once per
+  // session, so entries for code that is no longer in memory are only ever analyzed once.
+  std::vector<Entry> TakePendingEntries(u32 physical_address, CPUEmuFeatureFlags feature_flags);
+
+  static u64 HashCode(std::span<const PPCAnalyst::CodeOp> code);
+
+private:
+  using Key = std::pair<u32, u32>;  // (effective_address, feature_flags)
+
+  struct StoredEntry
+  {
+    Entry entry;
+    // Whether this entry was compiled during the current session. Entries which weren't are
+    // dropped first when the cache is full.
+    bool used = false;
+  };
+
+  std::string GetPath() const;
+
+  std::string m_game_id;
+  std::map<Key, StoredEntry> m_entries;
+  std::unordered_map<u32, std::vector<Entry>> m_pending;  // physical region -> entries
+  bool m_dirty = false;
+};
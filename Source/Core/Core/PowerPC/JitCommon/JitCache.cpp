@@ -7,13 +7,14 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
+#include <optional>
 #include <ranges>
-#include <set>
 #include <span>
+#include <string>
 #include <utility>
 
 #include "Common/CommonTypes.h"
+#include "Common/GekkoDisassembler.h"
 #include "Common/JitRegister.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
@@ -31,8 +32,8 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  const auto first = std::ranges::lower_bound(physical_addresses, address);
+  return first != physical_addresses.end() && *first - address < length;
 }
 
 void JitBlock::ProfileData::BeginProfiling(ProfileData* data)
@@ -55,7 +56,8 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR),
+                            Config::Get(Config::MAIN_PERF_JIT_DUMP));
 
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
@@ -83,13 +85,20 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
+  m_jit.DiscardPreparedBlocks();
+  for (auto& [page, entries] : block_map)
   {
-    DestroyBlock(e.second);
+    for (const BlockMapEntry& entry : entries)
+      DestroyBlock(*entry.block);
   }
   block_map.clear();
+  m_block_count = 0;
   links_to.clear();
   block_range_map.clear();
+  m_block_pool.clear();
+  m_free_blocks.clear();
+  m_indirect_branch_caches.clear();
+  m_free_indirect_branch_caches.clear();
 
   valid_block.ClearAll();
 
@@ -116,32 +125,113 @@ JitBlock** JitBaseBlockCache::GetFastBlockMapFallback()
 void JitBaseBlockCache::RunOnBlocks(const Core::CPUThreadGuard&,
                                     std::function<void(const JitBlock&)> f) const
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  for (const auto& [page, entries] : block_map)
+  {
+    for (const BlockMapEntry& entry : entries)
+      f(*entry.block);
+  }
 }
 
 void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 {
-  for (const auto& kv : block_map)
+  for (const auto& [page, entries] : block_map)
   {
-    if (JitBlock::ProfileData* const profile_data = kv.second.profile_data.get())
-      *profile_data = {};
+    for (const BlockMapEntry& entry : entries)
+    {
+      if (JitBlock::ProfileData* const profile_data = entry.block->profile_data.get())
+        *profile_data = {};
+      for (IndirectBranchCache* cache : entry.block->indirect_branch_caches)
+        cache->hits = cache->misses = 0;
+    }
   }
+  m_statistics = {};
+  m_invalidation_counts.clear();
   Host_JitProfileDataWiped();
 }
 
+JitBlock* JitBaseBlockCache::NewBlock()
+{
+  const bool profiling_enabled = m_jit.IsProfilingEnabled();
+  if (m_free_blocks.empty())
+    return &m_block_pool.emplace_back(profiling_enabled);
+
+  JitBlock* b = m_free_blocks.back();
+  m_free_blocks.pop_back();
+  if (profiling_enabled)
+    b->profile_data = std::make_unique<JitBlock::ProfileData>();
+  return b;
+}
+
+void JitBaseBlockCache::FreeBlock(JitBlock& block)
+{
+  block.linkData.clear();
+  for (IndirectBranchCache* cache : block.indirect_branch_caches)
+    m_free_indirect_branch_caches.push_back(cache);
+  block.indirect_branch_caches.clear();
+  block.physical_addresses.clear();
+  block.original_buffer.clear();
+  block.profile_data.reset();
+  m_free_blocks.push_back(&block);
+}
+
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
+  JitBlock& b = *NewBlock();
   b.effectiveAddress = em_address;
   b.physicalAddress = physical_address;
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.compile_order = m_next_compile_order++;
+  block_map[physical_address >> BLOCK_MAP_SHIFT].push_back(
+      {physical_address, em_address, b.feature_flags, &b});
+  ++m_block_count;
+  if (b.profile_data)
+    m_compile_start = JitBlock::ProfileData::Clock::now();
   return &b;
 }
 
+IndirectBranchCache* JitBaseBlockCache::AllocateIndirectBranchCache(JitBlock& block)
+{
+  IndirectBranchCache* cache;
+  if (m_free_indirect_branch_caches.empty())
+  {
+    cache = &m_indirect_branch_caches.emplace_back();
+  }
+  else
+  {
+    cache = m_free_indirect_branch_caches.back();
+    m_free_indirect_branch_caches.pop_back();
+    *cache = {};
+  }
+  block.indirect_branch_caches.push_back(cache);
+  return cache;
+}
+
+void JitBaseBlockCache::UpdateIndirectBranchCache(JitBaseBlockCache& block_cache,
+                                                  IndirectBranchCache& cache)
+{
+  ++cache.misses;
+  // Sites that jump somewhere else most of the time are only slowed down by the updates.
+  if (cache.misses >= IndirectBranchCache::MIN_MISSES_BEFORE_GIVING_UP && cache.misses > cache.hits)
+  {
+    cache.disabled = 1;
+    cache.generation = 0;
+    return;
+  }
+
+  const PowerPC::PowerPCState& ppc_state = block_cache.m_jit.m_ppc_state;
+  const JitBlock* block =
+      block_cache.GetBlockFromStartAddress(ppc_state.pc, ppc_state.feature_flags);
+  if (!block)
+    return;
+
+  cache.target = u64{block->feature_flags} << 32 | block->effectiveAddress;
+  cache.entry = block->normalEntry;
+  cache.generation = block_cache.m_indirect_branch_generation;
+}
+
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                       const PPCAnalyst::CodeBlock& code_block,
                                       const PPCAnalyst::CodeBuffer& code_buffer)
@@ -158,7 +248,8 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
   block.fast_block_map_index = index;
 
-  block.physical_addresses = code_block.m_physical_addresses;
+  block.physical_addresses.assign(code_block.m_physical_addresses.begin(),
+                                  code_block.m_physical_addresses.end());
 
   block.originalSize = code_block.m_num_instructions;
   if (m_jit.IsDebuggingEnabled())
@@ -171,34 +262,78 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                  original_buffer_transform_view.end());
   }
 
+  std::optional<u32> previous_range;
   for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
+
+    // physical_addresses is sorted, so each range shows up in one contiguous run.
+    const u32 range = addr >> BLOCK_RANGE_MAP_SHIFT;
+    if (range != previous_range)
+    {
+      block_range_map[range].push_back(&block);
+      previous_range = range;
+    }
   }
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      std::vector<JitBlock*>& sources = links_to[e.exitAddress];
+      if (std::ranges::find(sources, &block) == sources.end())
+        sources.push_back(&block);
     }
 
     LinkBlock(block);
   }
 
+  RegisterBlock(block, code_block, code_buffer);
+
+  ++m_statistics.blocks_compiled;
+  if (block.profile_data)
+    block.profile_data->compile_time = JitBlock::ProfileData::Clock::now() - m_compile_start;
+}
+
+void JitBaseBlockCache::RegisterBlock(const JitBlock& block,
+                                      const PPCAnalyst::CodeBlock& code_block,
+                                      const PPCAnalyst::CodeBuffer& code_buffer)
+{
   Common::Symbol* symbol = nullptr;
-  if (Common::JitRegister::IsEnabled() &&
-      (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
+  if (Common::JitRegister::IsEnabled())
+    symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress);
+  const std::string name =
+      symbol ? fmt::format("JIT_PPC_{}_{:08x}", symbol->function_name, block.physicalAddress) :
+               fmt::format("JIT_PPC_{:08x}", block.physicalAddress);
+  const u32 near_size = static_cast<u32>(block.near_end - block.normalEntry);
+
+  if (!Common::JitRegister::IsJitDumpEnabled())
   {
-    Common::JitRegister::Register(block.normalEntry, block.near_end - block.normalEntry,
-                                  "JIT_PPC_{}_{:08x}", symbol->function_name,
-                                  block.physicalAddress);
+    Common::JitRegister::Register(block.normalEntry, near_size, name);
+    return;
   }
-  else
+
+  // Map the host code back to the guest instructions it was emitted for, so that perf annotate
+  // can show them next to the host instructions and their samples.
+  const std::vector<const u8*>& host_addresses = m_jit.js.instruction_host_addresses;
+  const u32 count = std::min<u32>(code_block.m_num_instructions,
+                                  static_cast<u32>(host_addresses.size()));
+  std::vector<Common::JitRegister::SourceLine> lines;
+  lines.reserve(count);
+  for (u32 i = 0; i < count; ++i)
+  {
+    const PPCAnalyst::CodeOp& op = code_buffer[i];
+    lines.push_back({host_addresses[i],
+                     fmt::format("{:08x}  {}", op.address,
+                                 Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address))});
+  }
+  Common::JitRegister::RegisterWithSourceLines(block.normalEntry, near_size, name, lines);
+
+  // Slow paths are emitted out of line, and are otherwise left without a symbol.
+  if (block.far_end != block.far_begin)
   {
-    Common::JitRegister::Register(block.normalEntry, block.near_end - block.normalEntry,
-                                  "JIT_PPC_{:08x}", block.physicalAddress);
+    const u32 far_size = static_cast<u32>(block.far_end - block.far_begin);
+    Common::JitRegister::Register(block.far_begin, far_size, name + "_far");
   }
 }
 
@@ -215,12 +350,17 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFla
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  const auto it = block_map.find(translated_addr >> BLOCK_MAP_SHIFT);
+  if (it == block_map.end())
+    return nullptr;
+
+  for (const BlockMapEntry& entry : it->second)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.feature_flags == feature_flags)
-      return &b;
+    if (entry.physical_address == translated_addr && entry.effective_address == addr &&
+        entry.feature_flags == feature_flags)
+    {
+      return entry.block;
+    }
   }
 
   return nullptr;
@@ -303,6 +443,9 @@ void JitBaseBlockCache::InvalidateICache(u32 initial_address, u32 initial_length
 void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 address, u32 length,
                                                  bool forced)
 {
+  // Blocks being analyzed in the background aren't tracked by valid_block.
+  m_jit.DiscardPreparedBlocks(physical_address, length);
+
   // Optimization for the case of invalidating a single cache line, which is used by the dcb*
   // instructions. If the valid_block bit for that cacheline is not set, we can safely skip
   // the remaining invalidation logic.
@@ -348,67 +491,135 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
+  if (length == 0)
+    return;
+
   // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  const u32 first_range = address >> BLOCK_RANGE_MAP_SHIFT;
+  const u32 last_range = (address + (length - 1)) >> BLOCK_RANGE_MAP_SHIFT;
+  for (u32 range = first_range; range - first_range <= last_range - first_range; ++range)
   {
+    const auto range_iter = block_range_map.find(range);
+    if (range_iter == block_range_map.end())
+      continue;
+
     // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    std::vector<JitBlock*>& blocks_in_range = range_iter->second;
+    for (size_t i = 0; i < blocks_in_range.size();)
     {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
+      JitBlock* block = blocks_in_range[i];
+      if (!block->OverlapsPhysicalRange(address, length))
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
-        {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
+        ++i;
+        continue;
       }
+
+      // If the block overlaps, also remove all other occupied slots in the other macro blocks.
+      RemoveFromBlockRangeMap(*block, range);
+      blocks_in_range[i] = blocks_in_range.back();
+      blocks_in_range.pop_back();
+
+      ++m_statistics.blocks_invalidated;
+      if (m_jit.IsProfilingEnabled())
+        ++m_invalidation_counts[(u64{block->feature_flags} << 32) | block->effectiveAddress];
+
+      // And remove the block.
+      DestroyBlock(*block);
+      RemoveFromBlockMap(*block);
+      FreeBlock(*block);
     }
 
     // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
+    if (blocks_in_range.empty())
+      block_range_map.erase(range_iter);
   }
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 {
-  const auto equal_range = block_map.equal_range(block.physicalAddress);
-  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
-                                                [](const auto& kv) { return &kv.second; });
-  if (block_map_iter == equal_range.second) [[unlikely]]
+  const auto it = block_map.find(block.physicalAddress >> BLOCK_MAP_SHIFT);
+  if (it == block_map.end()) [[unlikely]]
+    return;
+  const auto entry = std::ranges::find(it->second, &block, &BlockMapEntry::block);
+  if (entry == it->second.end()) [[unlikely]]
+    return;
+
+  JitBlock& mutable_block = *entry->block;
+  RemoveFromBlockRangeMap(mutable_block, std::nullopt);
+  DestroyBlock(mutable_block);
+  RemoveFromBlockMap(mutable_block);
+  FreeBlock(mutable_block);  // The original JitBlock reference now refers to a free block.
+}
+
+std::size_t JitBaseBlockCache::EvictOldestBlocks()
+{
+  std::vector<JitBlock*> blocks;
+  blocks.reserve(m_block_count);
+  for (const auto& [page, entries] : block_map)
+  {
+    for (const BlockMapEntry& entry : entries)
+      blocks.push_back(entry.block);
+  }
+  if (blocks.empty())
+    return 0;
+
+  // Blocks that were compiled a long time ago are less likely to still be part of what the game
+  // is running, and blocks compiled one after another sit next to each other in the code space,
+  // so freeing them leaves large free ranges behind.
+  const auto middle = blocks.begin() + (blocks.size() + 1) / 2;
+  std::ranges::nth_element(blocks, middle, {}, &JitBlock::compile_order);
+  for (auto it = blocks.begin(); it != middle; ++it)
+    EraseSingleBlock(**it);
+
+  const std::size_t evicted = static_cast<std::size_t>(middle - blocks.begin());
+  ++m_statistics.evictions;
+  m_statistics.blocks_evicted += evicted;
+  return evicted;
+}
+
+void JitBaseBlockCache::RemoveFromBlockMap(const JitBlock& block)
+{
+  const auto it = block_map.find(block.physicalAddress >> BLOCK_MAP_SHIFT);
+  if (it == block_map.end())
     return;
 
-  JitBlock& mutable_block = block_map_iter->second;
+  std::vector<BlockMapEntry>& entries = it->second;
+  const auto entry = std::ranges::find(entries, &block, &BlockMapEntry::block);
+  if (entry == entries.end())
+    return;
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+  *entry = entries.back();
+  entries.pop_back();
+  if (entries.empty())
+    block_map.erase(it);
+  --m_block_count;
+}
 
-  DestroyBlock(mutable_block);
-  block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
+void JitBaseBlockCache::RemoveFromBlockRangeMap(const JitBlock& block,
+                                                std::optional<u32> skipped_range)
+{
+  std::optional<u32> previous_range;
+  for (const u32 addr : block.physical_addresses)
+  {
+    const u32 range = addr >> BLOCK_RANGE_MAP_SHIFT;
+    if (range == previous_range || range == skipped_range)
+      continue;
+    previous_range = range;
+
+    const auto it = block_range_map.find(range);
+    if (it == block_range_map.end())
+      continue;
+
+    std::vector<JitBlock*>& blocks_in_range = it->second;
+    const auto block_iter = std::ranges::find(blocks_in_range, &block);
+    if (block_iter == blocks_in_range.end())
+      continue;
+
+    *block_iter = blocks_in_range.back();
+    blocks_in_range.pop_back();
+    if (blocks_in_range.empty())
+      block_range_map.erase(it);
+  }
 }
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
@@ -437,6 +648,9 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
       {
         WriteLinkBlock(e, destinationBlock);
         e.linkStatus = true;
+        ++m_statistics.links_written;
+        if (block.profile_data)
+          ++block.profile_data->link_count;
       }
     }
   }
@@ -479,6 +693,9 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
       {
         WriteLinkBlock(e, nullptr);
         e.linkStatus = false;
+        ++m_statistics.links_removed;
+        if (sourceBlock->profile_data)
+          ++sourceBlock->profile_data->unlink_count;
       }
     }
   }
@@ -486,6 +703,9 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 {
+  // Indirect branch caches could be pointing at this block.
+  ++m_indirect_branch_generation;
+
   if (m_entry_points_ptr)
   {
     if (m_entry_points_ptr[block.fast_block_map_index] == block.normalEntry)
@@ -509,8 +729,13 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     auto it = links_to.find(e.exitAddress);
     if (it == links_to.end())
       continue;
-    it->second.erase(&block);
-    if (it->second.empty())
+    std::vector<JitBlock*>& sources = it->second;
+    const auto source = std::ranges::find(sources, &block);
+    if (source == sources.end())
+      continue;
+    *source = sources.back();
+    sources.pop_back();
+    if (sources.empty())
       links_to.erase(it);
   }
 
@@ -7,13 +7,12 @@
 #include <bitset>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <functional>
-#include <map>
 #include <memory>
-#include <set>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -54,6 +53,26 @@ struct JitBlockData
 };
 static_assert(std::is_standard_layout_v<JitBlockData>, "JitBlockData must have a standard layout");
 
+// A per-site cache of the last target taken by an indirect branch (bcctr), which lets the JITs
+// jump straight to the target's block while the target stays the same instead of going through
+// the dispatcher. An entry is only valid while its generation matches the block cache's, which
+// changes whenever a block is destroyed.
+struct IndirectBranchCache
+{
+  // Once a site has missed this often, and more often than it hit, it stops being updated.
+  static constexpr u32 MIN_MISSES_BEFORE_GIVING_UP = 64;
+
+  // (feature_flags << 32) | effective address of the target. No block has all bits set.
+  u64 target = ~u64{0};
+  const u8* entry = nullptr;
+  u64 generation = 0;
+  // Non-zero once the site changes targets too often for the cache to help.
+  u32 disabled = 0;
+  u64 hits = 0;
+  u64 misses = 0;
+};
+static_assert(std::is_standard_layout_v<IndirectBranchCache>);
+
 // A JitBlock is a block of compiled code which corresponds to the PowerPC
 // code at a given address.
 //
@@ -74,6 +93,11 @@ struct JitBlock : public JitBlockData
     std::size_t run_count = 0;
     u64 cycles_spent = 0;
     Clock::duration time_spent = {};
+    // Time spent emitting the block, from AllocateBlock to FinalizeBlock.
+    Clock::duration compile_time = {};
+    // How often exits of this block were linked to and unlinked from other blocks.
+    u64 link_count = 0;
+    u64 unlink_count = 0;
 
   private:
     Clock::time_point time_start;
@@ -100,13 +124,19 @@ struct JitBlock : public JitBlockData
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // The caches of the indirect branches in this block, owned by the block cache.
+  std::vector<IndirectBranchCache*> indirect_branch_caches;
+
+  // The sorted physical addresses of all occupied instructions.
+  std::vector<u32> physical_addresses;
 
   // This is only available when debugging is enabled. It is a trimmed-down copy of the
   // PPCAnalyst::CodeBuffer used to recompile this block, including repeat instructions.
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
+  // Counts up with every block compiled, so that the oldest blocks can be evicted first.
+  u64 compile_order = 0;
+
   std::unique_ptr<ProfileData> profile_data;
 };
 
@@ -145,9 +175,25 @@ public:
 class JitBaseBlockCache
 {
 public:
+  // Cache-wide counters, kept even when profiling is disabled.
+  struct Statistics
+  {
+    u64 blocks_compiled = 0;
+    u64 blocks_invalidated = 0;
+    u64 links_written = 0;
+    u64 links_removed = 0;
+    // How often old blocks were evicted to make room for new code, and how many.
+    u64 evictions = 0;
+    u64 blocks_evicted = 0;
+  };
+
+  // When the largest free range of a code region is smaller than this, the JITs evict old blocks
+  // before compiling more, rather than running out of space and clearing the whole cache.
+  static constexpr size_t MIN_FREE_CODE_SPACE = 256 * 1024;
+
   // The size of the fast map is determined like this:
-  // ((4 GiB guest memory space) / (4-byte alignment) * sizeof(JitBlock*)) << (3 feature flag bits)
-  static constexpr u64 FAST_BLOCK_MAP_SIZE = 0x10'0000'0000;
+  // ((4 GiB guest memory space) / (4-byte alignment) * sizeof(JitBlock*)) << (4 feature flag bits)
+  static constexpr u64 FAST_BLOCK_MAP_SIZE = 0x20'0000'0000;
   static constexpr u32 FAST_BLOCK_MAP_FALLBACK_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_FALLBACK_MASK = FAST_BLOCK_MAP_FALLBACK_ELEMENTS - 1;
 
@@ -164,9 +210,22 @@ public:
   JitBlock** GetFastBlockMapFallback();
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
-  std::size_t GetBlockCount() const { return block_map.size(); }
+  std::size_t GetBlockCount() const { return m_block_count; }
+  const Statistics& GetStatistics() const { return m_statistics; }
+  // Number of times blocks at each (feature_flags << 32 | effective address) were invalidated.
+  // Only tracked when profiling is enabled.
+  const std::unordered_map<u64, u64>& GetInvalidationCounts() const
+  {
+    return m_invalidation_counts;
+  }
 
   JitBlock* AllocateBlock(u32 em_address);
+  // Gets an empty indirect branch cache that stays allocated for as long as the block exists.
+  IndirectBranchCache* AllocateIndirectBranchCache(JitBlock& block);
+  const u64* GetIndirectBranchGenerationPtr() const { return &m_indirect_branch_generation; }
+  // Called by the JITs when an indirect branch missed its cache. Points the cache at the block
+  // for the current PC, if there is one.
+  static void UpdateIndirectBranchCache(JitBaseBlockCache& block_cache, IndirectBranchCache& cache);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
                      const PPCAnalyst::CodeBuffer& code_buffer);
 
@@ -185,6 +244,9 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
   void EraseSingleBlock(const JitBlock& block);
+  // Erases the older half of the blocks, in the order they were compiled. Returns how many blocks
+  // were erased.
+  std::size_t EvictOldestBlocks();
 
   u32* GetBlockBitSet() const;
 
@@ -197,6 +259,10 @@ private:
   virtual void WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest) = 0;
   virtual void WriteDestroyBlock(const JitBlock& block);
 
+  // Names the block's code for the profilers that JitRegister writes symbols for.
+  void RegisterBlock(const JitBlock& block, const PPCAnalyst::CodeBlock& code_block,
+                     const PPCAnalyst::CodeBuffer& code_buffer);
+
   void LinkBlockExits(JitBlock& block);
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
@@ -207,19 +273,48 @@ private:
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
+  struct BlockMapEntry
+  {
+    u32 physical_address;
+    u32 effective_address;
+    CPUEmuFeatureFlags feature_flags;
+    JitBlock* block;
+  };
+
+  JitBlock* NewBlock();
+  void FreeBlock(JitBlock& block);
+  void RemoveFromBlockMap(const JitBlock& block);
+  void RemoveFromBlockRangeMap(const JitBlock& block, std::optional<u32> skipped_range);
+
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  std::unordered_map<u32, std::vector<JitBlock*>> links_to;  // destination_PC -> blocks
 
-  // Map indexed by the physical address of the entry point.
+  // Index of all blocks, bucketed by the physical page of their entry point.
   // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  static constexpr u32 BLOCK_MAP_SHIFT = 12;
+  std::unordered_map<u32, std::vector<BlockMapEntry>> block_map;  // start_addr >> shift -> blocks
+  std::size_t m_block_count = 0;
+  u64 m_next_compile_order = 0;
 
-  // Range of overlapping code indexed by a masked physical address.
+  // Range of overlapping code indexed by a shifted physical address.
   // This is used for invalidation of memory regions. The range is grouped
   // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  static constexpr u32 BLOCK_RANGE_MAP_SHIFT = 8;
+  std::unordered_map<u32, std::vector<JitBlock*>> block_range_map;
+
+  // Storage for all blocks. Blocks are recycled through m_free_blocks instead of being
+  // deallocated, so pointers to blocks stay valid and their containers keep their capacity.
+  std::deque<JitBlock> m_block_pool;
+  std::vector<JitBlock*> m_free_blocks;
+  std::deque<IndirectBranchCache> m_indirect_branch_caches;
+  std::vector<IndirectBranchCache*> m_free_indirect_branch_caches;
+  // Starts at 1 so that empty caches never match.
+  u64 m_indirect_branch_generation = 1;
+
+  Statistics m_statistics;
+  std::unordered_map<u64, u64> m_invalidation_counts;
+  JitBlock::ProfileData::Clock::time_point m_compile_start;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
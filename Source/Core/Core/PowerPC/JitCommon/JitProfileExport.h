@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
+
+// Binary format written by JitInterface::JitBlockProfileExport, meant to be consumed by external
+// tools. All fields are stored in host byte order (little-endian on all supported hosts), and
+// there is no padding. An export consists of:
+//
+//   Header
+//   BlockRecord[Header::num_blocks]
+//   InvalidationRecord[Header::num_invalidation_records]
+//
+// Per-block profiling fields and invalidation records are only filled in when the JIT was
+// running with profiling enabled (Debug/JitEnableProfiling). Otherwise they are zero and
+// num_invalidation_records is 0. The indirect branch counters are always filled in.
+//
+// Version 2 added the indirect branch counters to BlockRecord.
+namespace JitProfileExport
+{
+constexpr u32 MAGIC = 0x46504A44;  // "DJPF"
+constexpr u32 VERSION = 2;
+
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 block_record_size;
+  u32 invalidation_record_size;
+  u32 num_blocks;
+  u32 num_invalidation_records;
+  // Totals since the JIT was started or the profiling data was last wiped.
+  u64 blocks_compiled;
+  u64 blocks_invalidated;
+  u64 links_written;
+  u64 links_removed;
+};
+
+struct BlockRecord
+{
+  u32 effective_address;
+  u32 physical_address;
+  u32 feature_flags;
+  u32 num_instructions;
+  u32 host_near_size;
+  u32 host_far_size;
+  u64 run_count;
+  u64 cycles_spent;
+  u64 time_spent_ns;
+  u64 compile_time_ns;
+  u64 link_count;
+  u64 unlink_count;
+  // Summed over the bcctr exits of the block, as seen by their per-site target caches.
+  u64 indirect_branch_hits;
+  u64 indirect_branch_misses;
+};
+
+struct InvalidationRecord
+{
+  u32 effective_address;
+  u32 feature_flags;
+  u64 count;
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 56);
+static_assert(std::is_trivially_copyable_v<BlockRecord> && sizeof(BlockRecord) == 88);
+static_assert(std::is_trivially_copyable_v<InvalidationRecord> &&
+              sizeof(InvalidationRecord) == 16);
+}  // namespace JitProfileExport
@@ -6,18 +6,30 @@
 #include <algorithm>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitProfileExport.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -44,8 +56,16 @@ void JitInterface::SetJit(std::unique_ptr<JitBase> jit)
 
 void JitInterface::DoState(PointerWrap& p)
 {
-  if (m_jit && p.IsReadMode())
+  if (!p.IsReadMode())
+    return;
+
+  if (m_jit)
     m_jit->ClearCache();
+  if (m_cold_tier)
+  {
+    m_cold_tier->ClearCache();
+    m_cold_block_run_counts.clear();
+  }
 }
 
 CPUCoreBase* JitInterface::InitJitCore(PowerPC::CPUCore core)
@@ -72,10 +92,49 @@ CPUCoreBase* JitInterface::InitJitCore(PowerPC::CPUCore core)
     m_jit.reset();
     return nullptr;
   }
+
+  // The cold tier must exist before the JIT generates its dispatcher.
+  if (core != PowerPC::CPUCore::CachedInterpreter &&
+      Config::Get(Config::MAIN_JIT_TIERED_COMPILATION) && !Config::Get(Config::MAIN_ENABLE_DEBUGGING))
+  {
+    m_cold_tier = std::make_unique<CachedInterpreter>(m_system);
+    m_cold_tier->Init();
+    m_tier_up_threshold = Config::Get(Config::MAIN_JIT_TIER_UP_THRESHOLD);
+    m_background_analysis = Config::Get(Config::MAIN_JIT_BACKGROUND_ANALYSIS);
+  }
+
   m_jit->Init();
   return m_jit.get();
 }
 
+bool JitInterface::ExecuteInColdTier(u32 em_address)
+{
+  if (!m_cold_tier)
+    return false;
+
+  const auto& ppc_state = m_system.GetPPCState();
+  const u64 key = (u64{ppc_state.feature_flags} << 32) | em_address;
+  const auto [it, inserted] = m_cold_block_run_counts.try_emplace(key, 0);
+  if (it->second >= m_tier_up_threshold)
+  {
+    // Keep running the block in the cold tier while the JIT analyzes it in the background, but
+    // stop waiting if the worker falls behind.
+    const bool wait_for_analysis = m_background_analysis &&
+                                   it->second < m_tier_up_threshold * 2 &&
+                                   m_jit->PrepareBlockInBackground(em_address);
+    if (!wait_for_analysis)
+    {
+      // The block is hot. If it gets invalidated, it starts over in the cold tier.
+      m_cold_block_run_counts.erase(it);
+      return false;
+    }
+  }
+
+  ++it->second;
+  m_cold_tier->ExecuteOneBlock();
+  return true;
+}
+
 CPUCoreBase* JitInterface::GetCore() const
 {
   return m_jit.get();
@@ -110,7 +169,9 @@ static std::string_view GetDescription(const CPUEmuFeatureFlags flags)
 {
   static constexpr std::array<std::string_view, (FEATURE_FLAG_END_OF_ENUMERATION - 1) << 1>
       descriptions = {
-          "", "DR", "IR", "DR|IR", "PERFMON", "DR|PERFMON", "IR|PERFMON", "DR|IR|PERFMON",
+          "", "DR", "IR", "DR|IR", "PERFMON", "DR|PERFMON", "IR|PERFMON", "DR|IR|PERFMON", "NI",
+          "DR|NI", "IR|NI", "DR|IR|NI", "PERFMON|NI", "DR|PERFMON|NI", "IR|PERFMON|NI",
+          "DR|IR|PERFMON|NI",
       };
   return descriptions[flags];
 }
@@ -182,6 +243,121 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   }
 }
 
+void JitInterface::JitBlockProfileExport(const Core::CPUThreadGuard& guard, std::FILE* file) const
+{
+  if (!m_jit)
+    return;
+
+  const JitBaseBlockCache& block_cache = *m_jit->GetBlockCache();
+  const JitBaseBlockCache::Statistics& statistics = block_cache.GetStatistics();
+
+  std::vector<JitProfileExport::BlockRecord> blocks;
+  blocks.reserve(block_cache.GetBlockCount());
+  block_cache.RunOnBlocks(guard, [&](const JitBlock& block) {
+    const auto to_ns = [](JitBlock::ProfileData::Clock::duration duration) {
+      return static_cast<u64>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+
+    JitProfileExport::BlockRecord& record = blocks.emplace_back();
+    record.effective_address = block.effectiveAddress;
+    record.physical_address = block.physicalAddress;
+    record.feature_flags = block.feature_flags;
+    record.num_instructions = block.originalSize;
+    record.host_near_size = static_cast<u32>(block.near_end - block.near_begin);
+    record.host_far_size = static_cast<u32>(block.far_end - block.far_begin);
+    if (const JitBlock::ProfileData* const data = block.profile_data.get())
+    {
+      record.run_count = data->run_count;
+      record.cycles_spent = data->cycles_spent;
+      record.time_spent_ns = to_ns(data->time_spent);
+      record.compile_time_ns = to_ns(data->compile_time);
+      record.link_count = data->link_count;
+      record.unlink_count = data->unlink_count;
+    }
+    for (const IndirectBranchCache* cache : block.indirect_branch_caches)
+    {
+      record.indirect_branch_hits += cache->hits;
+      record.indirect_branch_misses += cache->misses;
+    }
+  });
+
+  std::vector<JitProfileExport::InvalidationRecord> invalidations;
+  invalidations.reserve(block_cache.GetInvalidationCounts().size());
+  for (const auto& [key, count] : block_cache.GetInvalidationCounts())
+    invalidations.push_back({static_cast<u32>(key), static_cast<u32>(key >> 32), count});
+
+  const JitProfileExport::Header header{
+      .magic = JitProfileExport::MAGIC,
+      .version = JitProfileExport::VERSION,
+      .block_record_size = sizeof(JitProfileExport::BlockRecord),
+      .invalidation_record_size = sizeof(JitProfileExport::InvalidationRecord),
+      .num_blocks = static_cast<u32>(blocks.size()),
+      .num_invalidation_records = static_cast<u32>(invalidations.size()),
+      .blocks_compiled = statistics.blocks_compiled,
+      .blocks_invalidated = statistics.blocks_invalidated,
+      .links_written = statistics.links_written,
+      .links_removed = statistics.links_removed,
+  };
+
+  if (std::fwrite(&header, sizeof(header), 1, file) != 1 ||
+      std::fwrite(blocks.data(), sizeof(blocks[0]), blocks.size(), file) != blocks.size() ||
+      std::fwrite(invalidations.data(), sizeof(invalidations[0]), invalidations.size(), file) !=
+          invalidations.size())
+  {
+    ERROR_LOG_FMT(DYNA_REC, "Failed to write JIT profile export");
+  }
+}
+
+void JitInterface::WriteConfiguredProfileExport(const Core::CPUThreadGuard& guard) const
+{
+  const std::string path = Config::Get(Config::MAIN_JIT_PROFILE_EXPORT_PATH);
+  if (path.empty() || !m_jit)
+    return;
+
+#ifndef _WIN32
+  struct stat path_stat;
+  if (stat(path.c_str(), &path_stat) == 0 && S_ISSOCK(path_stat.st_mode))
+  {
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+      ERROR_LOG_FMT(DYNA_REC, "JIT profile export socket path is too long: {}", path);
+      return;
+    }
+    path.copy(addr.sun_path, path.size());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1 || connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0)
+    {
+      ERROR_LOG_FMT(DYNA_REC, "Failed to connect to JIT profile export socket {}", path);
+      if (fd != -1)
+        close(fd);
+      return;
+    }
+
+    std::FILE* const file = fdopen(fd, "wb");
+    if (!file)
+    {
+      close(fd);
+      return;
+    }
+    JitBlockProfileExport(guard, file);
+    std::fclose(file);
+    return;
+  }
+#endif
+
+  File::IOFile file(path, "wb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(DYNA_REC, "Failed to open JIT profile export file {}", path);
+    return;
+  }
+  JitBlockProfileExport(guard, file.GetHandle());
+}
+
 void JitInterface::WipeBlockProfilingData(const Core::CPUThreadGuard& guard)
 {
   if (m_jit)
@@ -202,6 +378,27 @@ std::size_t JitInterface::GetBlockCount() const
   return 0;
 }
 
+u64 JitInterface::GetCompiledBlockCount() const
+{
+  if (m_jit)
+    return m_jit->GetBlockCache()->GetStatistics().blocks_compiled;
+  return 0;
+}
+
+u64 JitInterface::GetInvalidatedBlockCount() const
+{
+  if (m_jit)
+    return m_jit->GetBlockCache()->GetStatistics().blocks_invalidated;
+  return 0;
+}
+
+u64 JitInterface::GetEvictionCount() const
+{
+  if (m_jit)
+    return m_jit->GetBlockCache()->GetStatistics().evictions;
+  return 0;
+}
+
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -227,12 +424,22 @@ void JitInterface::ClearCache(const Core::CPUThreadGuard&)
 {
   if (m_jit)
     m_jit->ClearCache();
+  if (m_cold_tier)
+  {
+    m_cold_tier->ClearCache();
+    m_cold_block_run_counts.clear();
+  }
 }
 
 void JitInterface::ClearSafe()
 {
   if (m_jit)
     m_jit->GetBlockCache()->Clear();
+  if (m_cold_tier)
+  {
+    m_cold_tier->GetBlockCache()->Clear();
+    m_cold_block_run_counts.clear();
+  }
 }
 
 void JitInterface::EraseSingleBlock(const JitBlock& block)
@@ -266,12 +473,16 @@ void JitInterface::InvalidateICache(u32 address, u32 size, bool forced)
 {
   if (m_jit)
     m_jit->GetBlockCache()->InvalidateICache(address, size, forced);
+  if (m_cold_tier)
+    m_cold_tier->GetBlockCache()->InvalidateICache(address, size, forced);
 }
 
 void JitInterface::InvalidateICacheLine(u32 address)
 {
   if (m_jit)
     m_jit->GetBlockCache()->InvalidateICacheLine(address);
+  if (m_cold_tier)
+    m_cold_tier->GetBlockCache()->InvalidateICacheLine(address);
 }
 
 void JitInterface::InvalidateICacheLines(u32 address, u32 count)
@@ -354,4 +565,10 @@ void JitInterface::Shutdown()
     m_jit->Shutdown();
     m_jit.reset();
   }
+  if (m_cold_tier)
+  {
+    m_cold_tier->Shutdown();
+    m_cold_tier.reset();
+    m_cold_block_run_counts.clear();
+  }
 }
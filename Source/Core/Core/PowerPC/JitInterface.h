@@ -9,12 +9,14 @@
 #include <iosfwd>
 #include <memory>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/MachineContext.h"
 
+class CachedInterpreter;
 class CPUCoreBase;
 class PointerWrap;
 class JitBase;
@@ -45,11 +47,27 @@ public:
   CPUCoreBase* InitJitCore(PowerPC::CPUCore core);
   CPUCoreBase* GetCore() const;
 
+  // With tiered compilation, blocks are executed by a CachedInterpreter until they have been
+  // reached through the JIT's dispatcher a configurable number of times, and only then compiled
+  // by the native JIT. Returns false if em_address should be compiled by the native JIT.
+  bool ExecuteInColdTier(u32 em_address);
+  bool HasColdTier() const { return m_cold_tier != nullptr; }
+
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  // Writes the block cache statistics in the format described in JitProfileExport.h.
+  void JitBlockProfileExport(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  // Writes JitBlockProfileExport to the file, or the already listening Unix socket, set as
+  // Core/JITProfileExportPath. Does nothing if no path is set.
+  void WriteConfiguredProfileExport(const Core::CPUThreadGuard& guard) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   std::size_t GetBlockCount() const;
+  // Blocks compiled and invalidated since the JIT was started, or 0 if no JIT is in use.
+  u64 GetCompiledBlockCount() const;
+  u64 GetInvalidatedBlockCount() const;
+  // How often old blocks were evicted because the code space was running out.
+  u64 GetEvictionCount() const;
 
   // Memory Utilities
   bool HandleFault(uintptr_t access_address, SContext* ctx);
@@ -99,5 +117,10 @@ public:
 
 private:
   std::unique_ptr<JitBase> m_jit;
+  std::unique_ptr<CachedInterpreter> m_cold_tier;
+  // (feature_flags << 32 | address) -> number of times the block was run by m_cold_tier
+  std::unordered_map<u64, u32> m_cold_block_run_counts;
+  u32 m_tier_up_threshold = 0;
+  bool m_background_analysis = false;
   Core::System& m_system;
 };
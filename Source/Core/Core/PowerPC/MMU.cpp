@@ -214,7 +214,7 @@ T MMU::ReadFromHardware(u32 em_address)
     T value;
     em_address &= m_memory.GetRamMask();
 
-    if (!m_ppc_state.m_enable_dcache || wi)
+    if (!IsDCacheUsedFor(em_address, wi))
     {
       std::memcpy(&value, &m_memory.GetRAM()[em_address], sizeof(T));
     }
@@ -233,7 +233,7 @@ T MMU::ReadFromHardware(u32 em_address)
     T value;
     em_address &= 0x0FFFFFFF;
 
-    if (!m_ppc_state.m_enable_dcache || wi)
+    if (!IsDCacheUsedFor(em_address + 0x10000000, wi))
     {
       std::memcpy(&value, &m_memory.GetEXRAM()[em_address], sizeof(T));
     }
@@ -411,10 +411,11 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     // mirrors of memory).
     em_address &= m_memory.GetRamMask();
 
-    if (m_ppc_state.m_enable_dcache && !wi)
+    const bool use_dcache = IsDCacheUsedFor(em_address, wi);
+    if (use_dcache)
       m_ppc_state.dCache.Write(m_memory, em_address, &swapped_data, size, HID0(m_ppc_state).DLOCK);
 
-    if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    if (!use_dcache || flag != XCheckTLBFlag::Write)
       std::memcpy(&m_memory.GetRAM()[em_address], &swapped_data, size);
 
     return;
@@ -425,13 +426,14 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
   {
     em_address &= 0x0FFFFFFF;
 
-    if (m_ppc_state.m_enable_dcache && !wi)
+    const bool use_dcache = IsDCacheUsedFor(em_address + 0x10000000, wi);
+    if (use_dcache)
     {
       m_ppc_state.dCache.Write(m_memory, em_address + 0x10000000, &swapped_data, size,
                                HID0(m_ppc_state).DLOCK);
     }
 
-    if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    if (!use_dcache || flag != XCheckTLBFlag::Write)
       std::memcpy(&m_memory.GetEXRAM()[em_address], &swapped_data, size);
 
     return;
@@ -1110,6 +1112,9 @@ void MMU::ClearDCacheLine(u32 address)
     address = translated_address.address;
   }
 
+  if (m_ppc_state.m_enable_dcache)
+    m_memory.TrackDCachePage(address);
+
   // TODO: This isn't precisely correct for non-RAM regions, but the difference
   // is unlikely to matter.
   for (u32 i = 0; i < 32; i += 4)
@@ -1137,7 +1142,10 @@ void MMU::StoreDCacheLine(u32 address)
   }
 
   if (m_ppc_state.m_enable_dcache)
+  {
+    m_memory.TrackDCachePage(address);
     m_ppc_state.dCache.Store(m_memory, address);
+  }
 }
 
 void MMU::InvalidateDCacheLine(u32 address)
@@ -1159,7 +1167,10 @@ void MMU::InvalidateDCacheLine(u32 address)
   }
 
   if (m_ppc_state.m_enable_dcache)
+  {
+    m_memory.TrackDCachePage(address);
     m_ppc_state.dCache.Invalidate(m_memory, address);
+  }
 }
 
 void MMU::FlushDCacheLine(u32 address)
@@ -1183,7 +1194,10 @@ void MMU::FlushDCacheLine(u32 address)
   }
 
   if (m_ppc_state.m_enable_dcache)
+  {
+    m_memory.TrackDCachePage(address);
     m_ppc_state.dCache.Flush(m_memory, address);
+  }
 }
 
 void MMU::TouchDCacheLine(u32 address, bool store)
@@ -1221,6 +1235,10 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
   if (m_ppc_state.m_enable_dcache)
     return 0;
 
+  // Inlined accesses would bypass the access counters.
+  if (m_memory.GetMMIOMapping()->IsProfilingEnabled())
+    return 0;
+
   // Translate address
   // If we also optimize for TLB mappings, we'd have to clear the
   // JitCache on each TLB invalidation.
@@ -1324,95 +1342,185 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
-}
 
-enum class TLBLookupResult
-{
-  Found,
-  NotFound,
-  UpdateC
-};
+  ClearVictimTLB(PowerPC::DATA_TLB_INDEX);
+  ClearVictimTLB(PowerPC::INST_TLB_INDEX);
+}
 
-static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
-                                            const XCheckTLBFlag flag, const u32 vpa, const u32 vsid,
-                                            u32* paddr, bool* wi)
+MMU::TLBLookupResult MMU::LookupTLBPageAddress(const XCheckTLBFlag flag, const u32 vpa,
+                                               const u32 vsid, u32* paddr, bool* wi)
 {
   const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
-  TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
+  TLBEntry& tlbe = m_ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
+  TLBStatistics& statistics = m_tlb_statistics[tlb_index];
 
+  u32 way;
   if (tlbe.tag[0] == tag && tlbe.vsid[0] == vsid)
   {
-    UPTE_Hi pte2(tlbe.pte[0]);
-
-    // Check if C bit requires updating
-    if (flag == XCheckTLBFlag::Write)
+    way = 0;
+  }
+  else if (tlbe.tag[1] == tag && tlbe.vsid[1] == vsid)
+  {
+    way = 1;
+  }
+  else if (IsNoExceptionFlag(flag))
+  {
+    // Lookups without side effects must not move entries around.
+    const VictimTLBSet& set = m_victim_tlb[tlb_index][tag & (VICTIM_TLB_SETS - 1)];
+    for (size_t i = 0; i < VictimTLBSet::WAYS; ++i)
     {
-      if (pte2.C == 0)
+      if (set.tag[i] == tag && set.vsid[i] == vsid)
       {
-        pte2.C = 1;
-        tlbe.pte[0] = pte2.Hex;
-        return TLBLookupResult::UpdateC;
+        *paddr = set.paddr[i] | (vpa & 0xfff);
+        *wi = (UPTE_Hi(set.pte[i]).WIMG & 0b1100) != 0;
+        return TLBLookupResult::Found;
       }
     }
-
-    if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 0;
-
-    *paddr = tlbe.paddr[0] | (vpa & 0xfff);
-    *wi = (pte2.WIMG & 0b1100) != 0;
-
-    return TLBLookupResult::Found;
+    return TLBLookupResult::NotFound;
   }
-  if (tlbe.tag[1] == tag && tlbe.vsid[1] == vsid)
+  else if (RefillFromVictimTLB(tlb_index, tag, vsid))
+  {
+    way = tlbe.recent;
+    ++statistics.victim_hits;
+  }
+  else
   {
-    UPTE_Hi pte2(tlbe.pte[1]);
+    ++statistics.misses;
+    return TLBLookupResult::NotFound;
+  }
+
+  UPTE_Hi pte2(tlbe.pte[way]);
 
-    // Check if C bit requires updating
-    if (flag == XCheckTLBFlag::Write)
+  // Check if C bit requires updating
+  if (flag == XCheckTLBFlag::Write)
+  {
+    if (pte2.C == 0)
     {
-      if (pte2.C == 0)
-      {
-        pte2.C = 1;
-        tlbe.pte[1] = pte2.Hex;
-        return TLBLookupResult::UpdateC;
-      }
+      pte2.C = 1;
+      tlbe.pte[way] = pte2.Hex;
+      return TLBLookupResult::UpdateC;
     }
+  }
 
-    if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 1;
+  if (!IsNoExceptionFlag(flag))
+  {
+    tlbe.recent = way;
+    ++statistics.hits;
+  }
 
-    *paddr = tlbe.paddr[1] | (vpa & 0xfff);
-    *wi = (pte2.WIMG & 0b1100) != 0;
+  *paddr = tlbe.paddr[way] | (vpa & 0xfff);
+  *wi = (pte2.WIMG & 0b1100) != 0;
 
-    return TLBLookupResult::Found;
-  }
-  return TLBLookupResult::NotFound;
+  return TLBLookupResult::Found;
 }
 
-static void UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, UPTE_Hi pte2,
-                           const u32 address, const u32 vsid)
+void MMU::UpdateTLBEntry(const XCheckTLBFlag flag, u32 pte2, const u32 address, const u32 vsid)
 {
   if (IsNoExceptionFlag(flag))
     return;
 
-  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
-  TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
+  InstallTLBEntry(tlb_index, address >> HW_PAGE_INDEX_SHIFT, vsid, pte2,
+                  UPTE_Hi(pte2).RPN << HW_PAGE_INDEX_SHIFT);
+}
+
+void MMU::InstallTLBEntry(size_t tlb_index, u32 tag, u32 vsid, u32 pte, u32 paddr)
+{
+  TLBEntry& tlbe = m_ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
   const u32 index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
+
+  // Move the entry we are replacing to the victim TLB.
+  if (tlbe.tag[index] != TLBEntry::INVALID_TAG)
+  {
+    VictimTLBSet& set = m_victim_tlb[tlb_index][tlbe.tag[index] & (VICTIM_TLB_SETS - 1)];
+    size_t victim_way = 0;
+    while (victim_way < VictimTLBSet::WAYS && set.tag[victim_way] != VictimTLBSet::INVALID_TAG)
+      ++victim_way;
+    if (victim_way == VictimTLBSet::WAYS)
+    {
+      victim_way = set.next;
+      set.next = (set.next + 1) % VictimTLBSet::WAYS;
+    }
+    set.tag[victim_way] = tlbe.tag[index];
+    set.vsid[victim_way] = tlbe.vsid[index];
+    set.pte[victim_way] = tlbe.pte[index];
+    set.paddr[victim_way] = tlbe.paddr[index];
+  }
+
   tlbe.recent = index;
-  tlbe.paddr[index] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
-  tlbe.pte[index] = pte2.Hex;
+  tlbe.paddr[index] = paddr;
+  tlbe.pte[index] = pte;
   tlbe.tag[index] = tag;
   tlbe.vsid[index] = vsid;
 }
 
+bool MMU::RefillFromVictimTLB(size_t tlb_index, u32 tag, u32 vsid)
+{
+  VictimTLBSet& set = m_victim_tlb[tlb_index][tag & (VICTIM_TLB_SETS - 1)];
+  for (size_t i = 0; i < VictimTLBSet::WAYS; ++i)
+  {
+    if (set.tag[i] == tag && set.vsid[i] == vsid)
+    {
+      const u32 pte = set.pte[i];
+      const u32 paddr = set.paddr[i];
+      set.tag[i] = VictimTLBSet::INVALID_TAG;
+      InstallTLBEntry(tlb_index, tag, vsid, pte, paddr);
+      return true;
+    }
+  }
+  return false;
+}
+
+void MMU::ClearVictimTLB(size_t tlb_index)
+{
+  m_victim_tlb[tlb_index].fill({});
+}
+
 void MMU::InvalidateTLBEntry(u32 address)
 {
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+
+  // tlbie invalidates every entry in the congruence class, so do the same for all victim TLB sets
+  // which hold entries of that class.
+  for (VictimTLB& victim_tlb : m_victim_tlb)
+  {
+    for (size_t i = entry_index; i < VICTIM_TLB_SETS; i += HW_PAGE_INDEX_MASK + 1)
+      victim_tlb[i].tag.fill(VictimTLBSet::INVALID_TAG);
+  }
+}
+
+const MMU::TLBStatistics& MMU::GetDataTLBStatistics() const
+{
+  return m_tlb_statistics[PowerPC::DATA_TLB_INDEX];
+}
+
+const MMU::TLBStatistics& MMU::GetInstructionTLBStatistics() const
+{
+  return m_tlb_statistics[PowerPC::INST_TLB_INDEX];
+}
+
+void MMU::ResetTLBStatistics()
+{
+  m_tlb_statistics = {};
+}
+
+bool MMU::IsDCacheUsedFor(u32 physical_address, bool wi)
+{
+  if (!m_ppc_state.m_enable_dcache)
+    return false;
+
+  ++m_dcache_statistics.slow_accesses;
+  if (wi)
+    return false;
+  if (m_memory.IsDCacheTrackingEnabled() && !m_memory.IsDCacheTrackedPage(physical_address))
+    return false;
+
+  ++m_dcache_statistics.cached_accesses;
+  return true;
 }
 
 // Page Address Translation
@@ -1427,7 +1535,7 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   // benefit much from optimization.
   u32 translated_address = 0;
   const TLBLookupResult res =
-      LookupTLBPageAddress(m_ppc_state, flag, address.Hex, VSID, &translated_address, wi);
+      LookupTLBPageAddress(flag, address.Hex, VSID, &translated_address, wi);
   if (res == TLBLookupResult::Found)
   {
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
@@ -1503,7 +1611,7 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
 
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
-          UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+          UpdateTLBEntry(flag, pte2.Hex, address.Hex, VSID);
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
@@ -1627,6 +1735,8 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
 
 void MMU::DBATUpdated()
 {
+  ClearVictimTLB(PowerPC::DATA_TLB_INDEX);
+
   m_dbat_table = {};
   UpdateBATs(m_dbat_table, SPR_DBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
@@ -1649,6 +1759,8 @@ void MMU::DBATUpdated()
 
 void MMU::IBATUpdated()
 {
+  ClearVictimTLB(PowerPC::INST_TLB_INDEX);
+
   m_ibat_table = {};
   UpdateBATs(m_ibat_table, SPR_IBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
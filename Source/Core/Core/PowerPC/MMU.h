@@ -242,6 +242,32 @@ public:
   void DBATUpdated();
   void IBATUpdated();
 
+  struct TLBStatistics
+  {
+    // Translations found in the emulated TLB.
+    u64 hits = 0;
+    // Translations that missed the emulated TLB but were refilled from the victim TLB.
+    u64 victim_hits = 0;
+    // Translations that had to walk the page table.
+    u64 misses = 0;
+  };
+
+  const TLBStatistics& GetDataTLBStatistics() const;
+  const TLBStatistics& GetInstructionTLBStatistics() const;
+  void ResetTLBStatistics();
+
+  struct DCacheStatistics
+  {
+    // RAM and EXRAM accesses that took the slow path while the data cache was enabled.
+    u64 slow_accesses = 0;
+    // The part of those that went through the emulated data cache. With hybrid data cache
+    // emulation, that's only the accesses to tracked pages.
+    u64 cached_accesses = 0;
+  };
+
+  const DCacheStatistics& GetDCacheStatistics() const { return m_dcache_statistics; }
+  void ResetDCacheStatistics() { m_dcache_statistics = {}; }
+
   // Result changes based on the BAT registers and MSR.DR.  Returns whether
   // it's safe to optimize a read or write to this address to an unguarded
   // memory access.  Does not consider page tables.
@@ -297,6 +323,37 @@ private:
   template <const XCheckTLBFlag flag>
   TranslateAddressResult TranslatePageAddress(const EffectiveAddress address, bool* wi);
 
+  enum class TLBLookupResult
+  {
+    Found,
+    NotFound,
+    UpdateC
+  };
+
+  // Host-side second level behind the emulated TLB in PowerPCState. Entries evicted from the
+  // emulated TLB are kept here, so that a later miss can be refilled without walking the page
+  // table. It is not part of savestates, and is cleared whenever its contents may be stale.
+  struct VictimTLBSet
+  {
+    static constexpr size_t WAYS = 4;
+    static constexpr u32 INVALID_TAG = 0xffffffff;
+
+    std::array<u32, WAYS> tag{INVALID_TAG, INVALID_TAG, INVALID_TAG, INVALID_TAG};
+    std::array<u32, WAYS> paddr{};
+    std::array<u32, WAYS> vsid{};
+    std::array<u32, WAYS> pte{};
+    u32 next = 0;
+  };
+  static constexpr size_t VICTIM_TLB_SETS = 1024;
+  using VictimTLB = std::array<VictimTLBSet, VICTIM_TLB_SETS>;
+
+  TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32 vpa, const u32 vsid,
+                                       u32* paddr, bool* wi);
+  void UpdateTLBEntry(const XCheckTLBFlag flag, u32 pte2, const u32 address, const u32 vsid);
+  void InstallTLBEntry(size_t tlb_index, u32 tag, u32 vsid, u32 pte, u32 paddr);
+  bool RefillFromVictimTLB(size_t tlb_index, u32 tag, u32 vsid);
+  void ClearVictimTLB(size_t tlb_index);
+
   void GenerateDSIException(u32 effective_address, bool write);
   void GenerateISIException(u32 effective_address);
 
@@ -307,6 +364,8 @@ private:
 
   template <XCheckTLBFlag flag, typename T, bool never_translate = false>
   T ReadFromHardware(u32 em_address);
+  // Whether a slow path access to the given RAM or EXRAM address goes through the data cache.
+  bool IsDCacheUsedFor(u32 physical_address, bool wi);
   template <XCheckTLBFlag flag, bool never_translate = false>
   void WriteToHardware(u32 em_address, const u32 data, const u32 size);
   template <XCheckTLBFlag flag>
@@ -326,6 +385,11 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  // Indexed by PowerPC::DATA_TLB_INDEX and PowerPC::INST_TLB_INDEX.
+  std::array<VictimTLB, 2> m_victim_tlb;
+  std::array<TLBStatistics, 2> m_tlb_statistics;
+  DCacheStatistics m_dcache_statistics;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
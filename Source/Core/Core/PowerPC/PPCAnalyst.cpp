@@ -43,6 +43,9 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+// With trace formation, calls, returns and jumps within a function are followed up to this many
+// times, so that the hot path through a function becomes a single block.
+constexpr u32 TRACE_FOLLOWING_THRESHOLD = 8;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -737,13 +740,15 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
-bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
+bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions,
+                                 bool allow_register_updates) const
 {
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
   //   * It does not write to memory.
   //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //     does not write to these registers. With allow_register_updates, this
+  //     isn't checked, so the loop may e.g. count how long it has been waiting.
   //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
@@ -781,7 +786,7 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       {
         if (reg == -1)
           continue;
-        if (write_disallowed_regs[reg])
+        if (write_disallowed_regs[reg] && !allow_register_updates)
           return false;
         written_regs[reg] = true;
       }
@@ -800,8 +805,32 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+// Non-update, non-indexed stores, which all compute their address the same way and leave rA alone.
+static bool IsCombinableStore(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 36:  // stw
+  case 38:  // stb
+  case 44:  // sth
+  case 52:  // stfs
+  case 54:  // stfd
+    return true;
+  default:
+    return false;
+  }
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
                          std::size_t block_size) const
+{
+  const u32 next_address = FetchBlock(address, block, buffer, block_size);
+  AnalyzeFetchedBlock(block, buffer);
+  return next_address;
+}
+
+u32 PPCAnalyzer::FetchBlock(u32 address, CodeBlock* block, CodeBuffer* buffer,
+                            std::size_t block_size) const
 {
   // Clear block stats
   *block->m_stats = {};
@@ -817,6 +846,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   block->m_broken = false;
   block->m_memory_exception = false;
   block->m_num_instructions = 0;
+  block->m_possible_idle_loop = false;
   block->m_gqr_used = BitSet8(0);
   block->m_physical_addresses.clear();
 
@@ -832,6 +862,23 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   auto& system = Core::System::GetInstance();
   auto& mmu = system.GetMMU();
+  auto& power_pc = system.GetPowerPC();
+  auto& ppc_symbol_db = power_pc.GetSymbolDB();
+  const auto ppc_mode = power_pc.GetMode();
+
+  const auto can_follow = [&](const CodeOp& op) {
+    if (numFollows < BRANCH_FOLLOWING_THRESHOLD)
+      return true;
+    if (!m_enable_trace_formation || numFollows >= TRACE_FOLLOWING_THRESHOLD)
+      return false;
+    if (op.inst.LK || op.inst.OPCD == 19)
+      return true;
+
+    // Don't let a trace leave the current function through a jump (e.g. a tail call).
+    const Common::Symbol* symbol = ppc_symbol_db.GetSymbolFromAddr(op.address);
+    return symbol && op.branchTo >= symbol->address && op.branchTo - symbol->address < symbol->size;
+  };
+
   for (std::size_t i = 0; i < block_size; ++i)
   {
     auto result = mmu.TryReadInstruction(address);
@@ -851,6 +898,9 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].address = address;
     code[i].inst = inst;
     code[i].skip = false;
+    code[i].isHookedOrBreakpoint =
+        !!HLE::TryReplaceFunction(ppc_symbol_db, address, ppc_mode) ||
+        power_pc.GetBreakPoints().IsAddressBreakPoint(address);
     block->m_stats->numCycles += opinfo->num_cycles;
     block->m_physical_addresses.insert(result.physical_address);
 
@@ -891,7 +941,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            can_follow(code[i]))
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -944,8 +994,16 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    if (code[i].branchTo == block->m_address && !code[i].branchIsIdleLoop &&
+        IsBusyWaitLoop(block, code, i, true))
+    {
+      if (std::ranges::binary_search(m_idle_loop_addresses, block->m_address))
+        code[i].branchIsIdleLoop = true;
+      else
+        block->m_possible_idle_loop = true;
+    }
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && can_follow(code[i]))
     {
       // Follow the unconditional branch.
       numFollows++;
@@ -971,17 +1029,22 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   block->m_num_instructions = num_inst;
 
-  if (block->m_num_instructions > 1)
-    ReorderInstructions(block->m_num_instructions, code);
-
   if ((!found_exit && num_inst > 0) || block_size == 1)
   {
     // We couldn't find an exit
     block->m_broken = true;
   }
 
-  auto& power_pc = system.GetPowerPC();
-  auto& ppc_symbol_db = power_pc.GetSymbolDB();
+  return address;
+}
+
+void PPCAnalyzer::AnalyzeFetchedBlock(CodeBlock* block, CodeBuffer* buffer) const
+{
+  CodeOp* const code = buffer->data();
+
+  if (block->m_num_instructions > 1)
+    ReorderInstructions(block->m_num_instructions, code);
+
   // Scan for flag dependencies; assume the next block (or any branch that can leave the block)
   // wants flags, to be safe.
   bool wantsFPRF = true;
@@ -1001,10 +1064,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       crDiscardable = BitSet8{};
     }
 
-    const auto ppc_mode = power_pc.GetMode();
-    const bool hle = !!HLE::TryReplaceFunction(ppc_symbol_db, op.address, ppc_mode);
-    const bool breakpoint = power_pc.GetBreakPoints().IsAddressBreakPoint(op.address);
-    const bool may_exit_block = hle || breakpoint || op.canEndBlock || op.canCauseException;
+    const bool may_exit_block =
+        op.isHookedOrBreakpoint || op.canEndBlock || op.canCauseException;
 
     const bool opWantsFPRF = op.wantsFPRF;
     const bool opWantsCA = op.wantsCA;
@@ -1030,7 +1091,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     if (strncmp(op.opinfo->opname, "stfd", 4))
       fprInXmm |= op.fregsIn;
 
-    if (hle || breakpoint)
+    if (op.isHookedOrBreakpoint)
     {
       gprInUse = BitSet32{};
       fprInUse = BitSet32{};
@@ -1067,6 +1128,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     op.fprIsSingle = fprIsSingle;
     op.fprIsDuplicated = fprIsDuplicated;
     op.fprIsStoreSafeBeforeInst = fprIsStoreSafe;
+
+    if (i != 0 && IsCombinableStore(op.inst) && IsCombinableStore(code[i - 1].inst))
+    {
+      const UGeckoInstruction prev = code[i - 1].inst;
+      op.isStoreRunContinuation = prev.RA == op.inst.RA && prev.SIMM_16 == op.inst.SIMM_16;
+    }
     if (op.fregOut >= 0)
     {
       BitSet32 bitexact_inputs;
@@ -1152,7 +1219,6 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   block->m_gqr_used = gqrUsed;
   block->m_gqr_modified = gqrModified;
   block->m_gpr_inputs = gprBlockInputs;
-  return address;
 }
 
 }  // namespace PPCAnalyst
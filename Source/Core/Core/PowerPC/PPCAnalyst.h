@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -51,6 +52,10 @@ struct CodeOp  // 16B
   bool canCauseException = false;
   bool skipLRStack = false;
   bool skip = false;  // followed BL-s for example
+  bool isHookedOrBreakpoint = false;  // HLE function hook or breakpoint at this address
+  // A store to the same address as the store right before it. If that address is the gather pipe,
+  // the JITs combine the two.
+  bool isStoreRunContinuation = false;
   BitSet8 crInUse;
   BitSet8 crDiscardable;
   // which registers are still needed after this instruction in this block
@@ -119,6 +124,10 @@ struct CodeBlock
   // Did we have a memory_exception?
   bool m_memory_exception = false;
 
+  // Does the block end in a loop back to itself that only reads memory, but that couldn't be
+  // proven to spin until an interrupt arrives?
+  bool m_possible_idle_loop = false;
+
   // Which GQRs this block uses, if any.
   BitSet8 m_gqr_used;
 
@@ -179,10 +188,25 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  // Follow more branches than usual along calls, returns and jumps within a function.
+  void SetTraceFormationEnabled(bool enabled) { m_enable_trace_formation = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // Blocks at these addresses which end in a loop back to themselves and only read memory are
+  // skipped as idle loops, even when they update registers on every iteration.
+  void SetIdleLoopAddresses(std::vector<u32> addresses)
+  {
+    std::ranges::sort(addresses);
+    m_idle_loop_addresses = std::move(addresses);
+  }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
+  // Analyze is split into two steps. FetchBlock reads the instructions of the block and must run
+  // on the CPU thread. AnalyzeFetchedBlock only looks at the fetched instructions (unless
+  // debugging is enabled), so it may run on another thread.
+  u32 FetchBlock(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
+  void AnalyzeFetchedBlock(CodeBlock* block, CodeBuffer* buffer) const;
+
 private:
   enum class ReorderType
   {
@@ -196,15 +220,18 @@ private:
                                ReorderType type) const;
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
-  bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions,
+                      bool allow_register_updates = false) const;
 
   // Options
   u32 m_options = 0;
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  bool m_enable_trace_formation = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  std::vector<u32> m_idle_loop_addresses;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <bit>
 #include <cstring>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -18,9 +19,11 @@
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -62,7 +65,7 @@ static void InvalidateCacheThreadSafe(Core::System& system, u64 userdata, s64 cy
 
 PowerPCManager::PowerPCManager(Core::System& system)
     : m_breakpoints(system), m_memchecks(system), m_debug_interface(system, m_symbol_db),
-      m_system(system)
+      m_guest_profiler(system), m_system(system)
 {
 }
 
@@ -107,7 +110,9 @@ void PowerPCManager::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
-    if (!m_ppc_state.m_enable_dcache)
+    // Which pages are tracked isn't part of the state, so the lines of the loaded cache may
+    // belong to pages that aren't tracked now.
+    if (!m_ppc_state.m_enable_dcache || memory.IsDCacheTrackingEnabled())
     {
       INFO_LOG_FMT(POWERPC, "Flushing data cache");
       m_ppc_state.dCache.FlushAll(memory);
@@ -245,15 +250,22 @@ CPUCore DefaultCPUCore()
 
 void PowerPCManager::RefreshConfig()
 {
+  auto& memory = m_system.GetMemory();
   const bool old_enable_dcache = m_ppc_state.m_enable_dcache;
+  const bool old_hybrid_dcache = memory.IsDCacheTrackingEnabled();
 
   m_ppc_state.m_enable_dcache = Config::Get(Config::MAIN_ACCURATE_CPU_CACHE);
+  const bool hybrid_dcache =
+      m_ppc_state.m_enable_dcache && Config::Get(Config::MAIN_HYBRID_CPU_CACHE);
 
-  if (old_enable_dcache && !m_ppc_state.m_enable_dcache)
+  // Going to hybrid mode, the cache may hold lines of pages that aren't going to be tracked.
+  if (old_enable_dcache && (!m_ppc_state.m_enable_dcache || (hybrid_dcache && !old_hybrid_dcache)))
   {
     INFO_LOG_FMT(POWERPC, "Flushing data cache");
-    m_ppc_state.dCache.FlushAll(m_system.GetMemory());
+    m_ppc_state.dCache.FlushAll(memory);
   }
+
+  memory.SetDCacheTrackingEnabled(hybrid_dcache);
 }
 
 void PowerPCManager::Init(CPUCore cpu_core)
@@ -264,6 +276,7 @@ void PowerPCManager::Init(CPUCore cpu_core)
 
   m_invalidate_cache_thread_safe =
       m_system.GetCoreTiming().RegisterEvent("invalidateEmulatedCache", InvalidateCacheThreadSafe);
+  m_guest_profiler.Init();
 
   Reset();
 
@@ -278,6 +291,8 @@ void PowerPCManager::Reset()
   m_ppc_state.pagetable_base = 0;
   m_ppc_state.pagetable_hashmask = 0;
   m_ppc_state.tlb = {};
+  m_system.GetMMU().ResetTLBStatistics();
+  m_system.GetMMU().ResetDCacheStatistics();
 
   ResetRegisters();
   m_ppc_state.iCache.Reset(m_system.GetJitInterface());
@@ -303,6 +318,28 @@ void PowerPCManager::ScheduleInvalidateCacheThreadSafe(u32 address)
 
 void PowerPCManager::Shutdown()
 {
+  m_guest_profiler.Shutdown();
+
+  const auto log_tlb_statistics = [](std::string_view name, const MMU::TLBStatistics& stats) {
+    if (stats.hits + stats.victim_hits + stats.misses == 0)
+      return;
+    INFO_LOG_FMT(POWERPC, "{} TLB: {} hits, {} victim TLB hits, {} page table walks", name,
+                 stats.hits, stats.victim_hits, stats.misses);
+  };
+  auto& mmu = m_system.GetMMU();
+  log_tlb_statistics("Data", mmu.GetDataTLBStatistics());
+  log_tlb_statistics("Instruction", mmu.GetInstructionTLBStatistics());
+
+  const MMU::DCacheStatistics& dcache_stats = mmu.GetDCacheStatistics();
+  if (dcache_stats.slow_accesses != 0)
+  {
+    INFO_LOG_FMT(POWERPC,
+                 "Data cache ({}): {} slow path RAM accesses, {} of them through the data cache, "
+                 "{} tracked pages",
+                 SConfig::GetInstance().GetGameID(), dcache_stats.slow_accesses,
+                 dcache_stats.cached_accesses, m_system.GetMemory().GetNumDCacheTrackedPages());
+  }
+
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
   InjectExternalCPUCore(nullptr);
   m_system.GetJitInterface().Shutdown();
@@ -686,6 +723,10 @@ void RoundingModeUpdated(PowerPCState& ppc_state)
   ASSERT(Core::IsCPUThread());
 
   Common::FPU::SetSIMDMode(ppc_state.fpscr.RN, ppc_state.fpscr.NI);
+
+  ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>(
+      (ppc_state.feature_flags & ~FEATURE_FLAG_FPSCR_NI) |
+      (ppc_state.fpscr.NI ? FEATURE_FLAG_FPSCR_NI : 0));
 }
 
 void MSRUpdated(PowerPCState& ppc_state)
@@ -695,8 +736,8 @@ void MSRUpdated(PowerPCState& ppc_state)
   static_assert(FEATURE_FLAG_MSR_DR == 1 << 0);
   static_assert(FEATURE_FLAG_MSR_IR == 1 << 1);
 
-  ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>(
-      (ppc_state.feature_flags & FEATURE_FLAG_PERFMON) | ((ppc_state.msr.Hex >> 4) & 0x3));
+  ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>((ppc_state.feature_flags & ~0x3) |
+                                                            ((ppc_state.msr.Hex >> 4) & 0x3));
 }
 
 void MMCRUpdated(PowerPCState& ppc_state)
@@ -714,8 +755,9 @@ void RecalculateAllFeatureFlags(PowerPCState& ppc_state)
   static_assert(FEATURE_FLAG_MSR_IR == 1 << 1);
 
   const bool perfmon = ppc_state.spr[SPR_MMCR0] || ppc_state.spr[SPR_MMCR1];
-  ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>(((ppc_state.msr.Hex >> 4) & 0x3) |
-                                                            (perfmon ? FEATURE_FLAG_PERFMON : 0));
+  ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>(
+      ((ppc_state.msr.Hex >> 4) & 0x3) | (perfmon ? FEATURE_FLAG_PERFMON : 0) |
+      (ppc_state.fpscr.NI ? FEATURE_FLAG_FPSCR_NI : 0));
 }
 
 void CheckExceptionsFromJIT(PowerPCManager& power_pc)
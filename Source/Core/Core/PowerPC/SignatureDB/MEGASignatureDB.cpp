@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/SignatureDB/MEGASignatureDB.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <fstream>
@@ -101,20 +102,10 @@ bool GetRefs(MEGASignature* sig, std::istringstream* iss)
   return true;
 }
 
-bool Compare(const Core::CPUThreadGuard& guard, u32 address, u32 size, const MEGASignature& sig)
+bool Compare(const std::vector<u32>& code, const MEGASignature& sig)
 {
-  if (size != sig.code.size() * sizeof(u32))
-    return false;
-
-  for (size_t i = 0; i < sig.code.size(); ++i)
-  {
-    if (sig.code[i] != 0 && PowerPC::MMU::HostRead_U32(
-                                guard, static_cast<u32>(address + i * sizeof(u32))) != sig.code[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return std::equal(sig.code.begin(), sig.code.end(), code.begin(), code.end(),
+                    [](u32 expected, u32 actual) { return expected == 0 || expected == actual; });
 }
 }  // Anonymous namespace
 
@@ -124,6 +115,7 @@ MEGASignatureDB::~MEGASignatureDB() = default;
 void MEGASignatureDB::Clear()
 {
   m_signatures.clear();
+  m_signatures_by_size.clear();
 }
 
 bool MEGASignatureDB::Load(const std::string& file_path)
@@ -149,6 +141,13 @@ bool MEGASignatureDB::Load(const std::string& file_path)
       WARN_LOG_FMT(SYMBOLS, "MEGA database failed to parse line {}", i);
     }
   }
+
+  m_signatures_by_size.clear();
+  for (size_t i = 0; i < m_signatures.size(); ++i)
+  {
+    const u32 size = static_cast<u32>(m_signatures[i].code.size() * sizeof(u32));
+    m_signatures_by_size[size].push_back(i);
+  }
   return true;
 }
 
@@ -160,12 +159,26 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
 
 void MEGASignatureDB::Apply(const Core::CPUThreadGuard& guard, PPCSymbolDB* symbol_db) const
 {
+  std::vector<u32> code;
   for (auto& it : symbol_db->AccessSymbols())
   {
     auto& symbol = it.second;
-    for (const auto& sig : m_signatures)
+    const auto candidates = m_signatures_by_size.find(symbol.size);
+    if (candidates == m_signatures_by_size.end())
+      continue;
+
+    // Read the function once, rather than once for every signature it gets compared against.
+    code.resize(symbol.size / sizeof(u32));
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+      const u32 address = static_cast<u32>(symbol.address + i * sizeof(u32));
+      code[i] = PowerPC::MMU::HostRead_U32(guard, address);
+    }
+
+    for (const size_t index : candidates->second)
     {
-      if (Compare(guard, symbol.address, symbol.size, sig))
+      const MEGASignature& sig = m_signatures[index];
+      if (Compare(code, sig))
       {
         symbol.name = sig.name;
         INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -59,4 +60,7 @@ public:
 
 private:
   std::vector<MEGASignature> m_signatures;
+  // Indices into m_signatures by the size of their code in bytes, in file order. A symbol only
+  // has to be compared against signatures of its own size.
+  std::map<u32, std::vector<size_t>> m_signatures_by_size;
 };
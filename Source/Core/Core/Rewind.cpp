@@ -0,0 +1,365 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Rewind.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include <lz4.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/NetPlayClient.h"
+#include "Core/State.h"
+#include "VideoCommon/OnScreenDisplay.h"
+
+namespace Rewind
+{
+namespace
+{
+// A delta starts with the size of the state it encodes, followed by records of a run of unchanged
+// words, a count of changed words and the changed words XORed with the keyframe.
+struct DeltaRecordHeader
+{
+  u32 unchanged_words;
+  u32 changed_words;
+};
+
+// Short runs of unchanged words are cheaper to store as part of the changed words around them.
+constexpr size_t MIN_UNCHANGED_WORDS = sizeof(DeltaRecordHeader) / sizeof(u64) + 1;
+
+// Starting a new keyframe keeps the deltas small as emulation drifts away from the old one.
+constexpr size_t MAX_DELTAS_PER_KEYFRAME = 60;
+
+struct Group
+{
+  // LZ4 compressed for every group but the newest, which new snapshots are encoded against.
+  std::vector<u8> keyframe;
+  size_t keyframe_size = 0;
+  bool compressed = false;
+
+  std::vector<std::vector<u8>> deltas;
+};
+
+std::mutex s_mutex;
+std::deque<Group> s_groups;
+size_t s_memory_usage = 0;
+std::vector<u8> s_snapshot_buffer;
+
+std::atomic<u32> s_fields_since_snapshot = 0;
+std::atomic<bool> s_snapshot_pending = false;
+
+u64 LoadWord(std::span<const u8> data, size_t word)
+{
+  u64 value = 0;
+  const size_t offset = word * sizeof(u64);
+  if (offset < data.size())
+    std::memcpy(&value, data.data() + offset, std::min(sizeof(u64), data.size() - offset));
+  return value;
+}
+
+u64 XorWord(std::span<const u8> keyframe, std::span<const u8> state, size_t word)
+{
+  return LoadWord(keyframe, word) ^ LoadWord(state, word);
+}
+
+size_t SkipUnchangedWords(std::span<const u8> keyframe, std::span<const u8> state, size_t word,
+                          size_t word_count)
+{
+  // Compare whole cache lines with memcmp while both buffers have them. It is vectorized by every
+  // C library we build against, and this is where almost all of the encoding time goes.
+  constexpr size_t LINE_WORDS = 64 / sizeof(u64);
+  const size_t common_words = std::min(keyframe.size(), state.size()) / sizeof(u64);
+  while (word + LINE_WORDS <= common_words &&
+         std::memcmp(keyframe.data() + word * sizeof(u64), state.data() + word * sizeof(u64),
+                     LINE_WORDS * sizeof(u64)) == 0)
+  {
+    word += LINE_WORDS;
+  }
+
+  while (word < word_count && XorWord(keyframe, state, word) == 0)
+    ++word;
+  return word;
+}
+
+size_t GetMemoryUsage(const Group& group)
+{
+  size_t usage = group.keyframe.size();
+  for (const std::vector<u8>& delta : group.deltas)
+    usage += delta.size();
+  return usage;
+}
+
+void CompressKeyframe(Group& group)
+{
+  if (group.compressed || group.keyframe.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+    return;
+
+  const int source_size = static_cast<int>(group.keyframe.size());
+  std::vector<u8> compressed(LZ4_compressBound(source_size));
+  const int compressed_size = LZ4_compress_default(
+      reinterpret_cast<const char*>(group.keyframe.data()),
+      reinterpret_cast<char*>(compressed.data()), source_size, static_cast<int>(compressed.size()));
+  if (compressed_size <= 0)
+    return;
+
+  compressed.resize(compressed_size);
+  compressed.shrink_to_fit();
+  s_memory_usage -= group.keyframe.size();
+  s_memory_usage += compressed.size();
+  group.keyframe = std::move(compressed);
+  group.compressed = true;
+}
+
+bool DecompressKeyframe(Group& group)
+{
+  if (!group.compressed)
+    return true;
+
+  std::vector<u8> keyframe(group.keyframe_size);
+  const int size = LZ4_decompress_safe(reinterpret_cast<const char*>(group.keyframe.data()),
+                                       reinterpret_cast<char*>(keyframe.data()),
+                                       static_cast<int>(group.keyframe.size()),
+                                       static_cast<int>(keyframe.size()));
+  if (size != static_cast<int>(keyframe.size()))
+  {
+    ERROR_LOG_FMT(CORE, "Rewind: Failed to decompress a keyframe");
+    return false;
+  }
+
+  s_memory_usage -= group.keyframe.size();
+  s_memory_usage += keyframe.size();
+  group.keyframe = std::move(keyframe);
+  group.compressed = false;
+  return true;
+}
+
+void AddSnapshot(std::vector<u8>& state)
+{
+  if (!s_groups.empty())
+  {
+    Group& group = s_groups.back();
+    if (group.deltas.size() < MAX_DELTAS_PER_KEYFRAME)
+    {
+      std::vector<u8> delta = EncodeDelta(group.keyframe, state);
+      if (delta.size() < group.keyframe_size / 4)
+      {
+        delta.shrink_to_fit();
+        s_memory_usage += delta.size();
+        group.deltas.push_back(std::move(delta));
+        return;
+      }
+    }
+
+    CompressKeyframe(group);
+  }
+
+  Group& group = s_groups.emplace_back();
+  group.keyframe_size = state.size();
+  group.keyframe = std::move(state);
+  s_memory_usage += group.keyframe.size();
+}
+
+void TrimToBudget()
+{
+  const size_t budget = static_cast<size_t>(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE)) << 20;
+
+  // The newest group is always kept, or there would be nothing to encode new snapshots against.
+  while (s_memory_usage > budget && s_groups.size() > 1)
+  {
+    s_memory_usage -= GetMemoryUsage(s_groups.front());
+    s_groups.pop_front();
+  }
+}
+
+void TakeSnapshot(Core::System& system)
+{
+  std::lock_guard lk(s_mutex);
+  State::SaveToBuffer(system, s_snapshot_buffer);
+  if (!s_snapshot_buffer.empty())
+  {
+    AddSnapshot(s_snapshot_buffer);
+    TrimToBudget();
+  }
+  s_snapshot_pending.store(false);
+}
+}  // namespace
+
+std::vector<u8> EncodeDelta(std::span<const u8> keyframe, std::span<const u8> state)
+{
+  std::vector<u8> delta(sizeof(u64));
+  const u64 state_size = state.size();
+  std::memcpy(delta.data(), &state_size, sizeof(u64));
+
+  const size_t word_count = (state.size() + sizeof(u64) - 1) / sizeof(u64);
+  size_t word = 0;
+  while (word < word_count)
+  {
+    const size_t changed_start = SkipUnchangedWords(keyframe, state, word, word_count);
+    if (changed_start == word_count)
+      break;
+
+    // Extend the run of changed words until a run of unchanged ones is long enough to be worth
+    // a new record.
+    size_t changed_end = changed_start;
+    while (changed_end < word_count)
+    {
+      const size_t unchanged_end = SkipUnchangedWords(keyframe, state, changed_end, word_count);
+      if (unchanged_end != changed_end &&
+          (unchanged_end - changed_end >= MIN_UNCHANGED_WORDS || unchanged_end == word_count))
+      {
+        break;
+      }
+      changed_end = unchanged_end + 1;
+    }
+    changed_end = std::min(changed_end, word_count);
+
+    const DeltaRecordHeader header{static_cast<u32>(changed_start - word),
+                                   static_cast<u32>(changed_end - changed_start)};
+    const size_t offset = delta.size();
+    delta.resize(offset + sizeof(header) + header.changed_words * sizeof(u64));
+    std::memcpy(delta.data() + offset, &header, sizeof(header));
+    u8* out = delta.data() + offset + sizeof(header);
+    for (size_t i = changed_start; i < changed_end; ++i, out += sizeof(u64))
+    {
+      const u64 value = XorWord(keyframe, state, i);
+      std::memcpy(out, &value, sizeof(u64));
+    }
+
+    word = changed_end;
+  }
+
+  return delta;
+}
+
+bool DecodeDelta(std::span<const u8> keyframe, std::span<const u8> delta, std::vector<u8>& state)
+{
+  u64 state_size;
+  if (delta.size() < sizeof(u64))
+    return false;
+  std::memcpy(&state_size, delta.data(), sizeof(u64));
+
+  const size_t word_count = (state_size + sizeof(u64) - 1) / sizeof(u64);
+  state.assign(word_count * sizeof(u64), 0);
+  std::memcpy(state.data(), keyframe.data(), std::min(keyframe.size(), state.size()));
+
+  size_t offset = sizeof(u64);
+  size_t word = 0;
+  while (offset < delta.size())
+  {
+    DeltaRecordHeader header;
+    if (delta.size() - offset < sizeof(header))
+      return false;
+    std::memcpy(&header, delta.data() + offset, sizeof(header));
+    offset += sizeof(header);
+
+    word += header.unchanged_words;
+    const size_t changed_bytes = size_t(header.changed_words) * sizeof(u64);
+    if (word + header.changed_words > word_count || delta.size() - offset < changed_bytes)
+      return false;
+
+    u8* out = state.data() + word * sizeof(u64);
+    for (size_t i = 0; i < changed_bytes; i += sizeof(u64))
+    {
+      u64 value;
+      u64 changes;
+      std::memcpy(&value, out + i, sizeof(u64));
+      std::memcpy(&changes, delta.data() + offset + i, sizeof(u64));
+      value ^= changes;
+      std::memcpy(out + i, &value, sizeof(u64));
+    }
+
+    offset += changed_bytes;
+    word += header.changed_words;
+  }
+
+  state.resize(state_size);
+  return true;
+}
+
+void Shutdown()
+{
+  Clear();
+
+  std::lock_guard lk(s_mutex);
+  s_snapshot_buffer = {};
+}
+
+void OnNewField()
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED))
+    return;
+
+  const u32 interval = std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1);
+  if (s_fields_since_snapshot.fetch_add(1) + 1 < interval)
+    return;
+
+  // Loading states is disabled in these modes, so snapshots would only take up memory.
+  if (NetPlay::IsNetPlayRunning() || AchievementManager::GetInstance().IsHardcoreModeActive())
+    return;
+
+  // This runs in the middle of a CoreTiming event, which isn't a point that a savestate can be
+  // taken at. Let the host thread take it once the CPU thread is at a safe point.
+  if (s_snapshot_pending.exchange(true))
+    return;
+  s_fields_since_snapshot.store(0);
+  Core::QueueHostJob(TakeSnapshot);
+}
+
+bool StepBack(Core::System& system)
+{
+  std::vector<u8> state;
+  {
+    std::lock_guard lk(s_mutex);
+    if (s_groups.empty())
+    {
+      OSD::AddMessage("There is nothing to rewind to");
+      return false;
+    }
+
+    Group& group = s_groups.back();
+    if (!group.deltas.empty())
+    {
+      const bool decoded = DecodeDelta(group.keyframe, group.deltas.back(), state);
+      s_memory_usage -= group.deltas.back().size();
+      group.deltas.pop_back();
+      if (!decoded)
+      {
+        ERROR_LOG_FMT(CORE, "Rewind: Failed to decode a snapshot");
+        return false;
+      }
+    }
+    else
+    {
+      s_memory_usage -= group.keyframe.size();
+      state = std::move(group.keyframe);
+      s_groups.pop_back();
+      if (!s_groups.empty() && !DecompressKeyframe(s_groups.back()))
+      {
+        s_memory_usage -= GetMemoryUsage(s_groups.back());
+        s_groups.pop_back();
+      }
+    }
+  }
+
+  State::LoadFromBuffer(system, state);
+  s_fields_since_snapshot.store(0);
+  return true;
+}
+
+void Clear()
+{
+  std::lock_guard lk(s_mutex);
+  s_groups.clear();
+  s_memory_usage = 0;
+  s_fields_since_snapshot.store(0);
+}
+}  // namespace Rewind
@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// An in-memory history of savestates that emulation can be stepped back through.
+//
+// Snapshots are taken every few fields and kept as deltas against a periodically refreshed
+// keyframe. Most of a savestate is emulated memory that barely changes between two snapshots, so
+// XORing it against the keyframe gives long runs of zeroes that encode to almost nothing.
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class System;
+}
+
+namespace Rewind
+{
+void Shutdown();
+
+// Called on the CPU thread at every emulated field. Schedules a snapshot when one is due.
+void OnNewField();
+
+// Loads the most recent snapshot and drops it from the history, so that calling this repeatedly
+// keeps going further back. Returns false if there is nothing to rewind to.
+bool StepBack(Core::System& system);
+
+// Drops the whole history.
+void Clear();
+
+// Encodes state as a delta against keyframe. Either one may be of any size.
+std::vector<u8> EncodeDelta(std::span<const u8> keyframe, std::span<const u8> state);
+// Reverses EncodeDelta. Returns false if the delta doesn't fit the keyframe.
+bool DecodeDelta(std::span<const u8> keyframe, std::span<const u8> delta, std::vector<u8>& state);
+}  // namespace Rewind
@@ -6,11 +6,14 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -21,6 +24,7 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -36,6 +40,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -78,7 +83,10 @@ static std::mutex s_load_or_save_in_progress_mutex;
 struct CompressAndDumpState_args
 {
   std::vector<u8> buffer_vector;
+  // Only used if the emulation is kept paused until the state has been written.
+  std::vector<PointerWrap::GatheredArray> gathered_arrays;
   std::string filename;
+  CompressionType compression_type;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
 
@@ -106,6 +114,9 @@ constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
 // Change this if we ever need to store more data in the extended header
 constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
+// Small enough to give every core a few chunks, big enough to barely hurt the compression ratio.
+constexpr u32 ZSTD_CHUNK_SIZE = 4 * 1024 * 1024;
+
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
 // Maps savestate versions to Dolphin versions.
@@ -204,45 +215,92 @@ static void DoState(Core::System& system, PointerWrap& p)
 #endif  // USE_RETRO_ACHIEVEMENTS
 }
 
-void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
+static bool CanLoadFromBuffer(bool allow_netplay)
 {
-  if (NetPlay::IsNetPlayRunning())
+  if (!allow_netplay && NetPlay::IsNetPlayRunning())
   {
     OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
-    return;
+    return false;
   }
 
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
   {
     OSD::AddMessage("Loading savestates is disabled in RetroAchievements hardcore mode");
-    return;
+    return false;
   }
 
+  return true;
+}
+
+// Must be called on the CPU thread.
+static void DoLoadFromBuffer(Core::System& system, std::vector<u8>& buffer, bool incremental)
+{
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+  p.SetIncremental(incremental);
+  DoState(system, p);
+}
+
+// Must be called on the CPU thread.
+static void DoSaveToBuffer(Core::System& system, std::vector<u8>& buffer, bool incremental)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  p_measure.SetIncremental(incremental);
+
+  DoState(system, p_measure);
+  const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+  buffer.resize(buffer_size);
+
+  ptr = buffer.data();
+  PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+  p.SetIncremental(incremental);
+  DoState(system, p);
+}
+
+void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  if (!CanLoadFromBuffer(false))
+    return;
+
+  Core::RunOnCPUThread(system, [&] { DoLoadFromBuffer(system, buffer, false); }, true);
+}
+
+void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  Core::RunOnCPUThread(system, [&] { DoSaveToBuffer(system, buffer, false); }, true);
+}
+
+void SaveIncrementalBaseToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
   Core::RunOnCPUThread(
       system,
       [&] {
-        u8* ptr = buffer.data();
-        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
-        DoState(system, p);
+        DoSaveToBuffer(system, buffer, false);
+        system.GetMemory().SetIncrementalBase();
       },
       true);
 }
 
-void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+void SaveIncrementalToBuffer(Core::System& system, std::vector<u8>& buffer)
 {
+  Core::RunOnCPUThread(system, [&] { DoSaveToBuffer(system, buffer, true); }, true);
+}
+
+void LoadIncrementalFromBuffer(Core::System& system, std::vector<u8>& base,
+                               std::vector<u8>& incremental)
+{
+  // NetPlay rolls back with these and then replays the same inputs, so this can't desync.
+  if (!CanLoadFromBuffer(true))
+    return;
+
   Core::RunOnCPUThread(
       system,
       [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
-
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
+        DoLoadFromBuffer(system, base, false);
+        system.GetMemory().SetIncrementalBase();
+        if (!incremental.empty())
+          DoLoadFromBuffer(system, incremental, true);
       },
       true);
 }
@@ -318,51 +376,176 @@ static bool CompareTimestamp(const SlotWithTimestamp& lhs, const SlotWithTimesta
   return lhs.timestamp < rhs.timestamp;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+static void CompressBufferToFileLZ4(std::span<const std::span<const u8>> segments,
+                                    File::IOFile& f)
 {
-  u64 total_bytes_compressed = 0;
-
-  while (true)
+  // LZ4 blocks can be of any size, so every segment gets its own.
+  for (const std::span<const u8> segment : segments)
   {
-    u64 bytes_left_to_compress = size - total_bytes_compressed;
+    const u8* const raw_buffer = segment.data();
+    const u64 size = segment.size();
+    u64 total_bytes_compressed = 0;
 
-    int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
-    auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
-    s32 compressed_len =
-        LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
-                             compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
-
-    if (compressed_len == 0)
+    while (total_bytes_compressed < size)
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      u64 bytes_left_to_compress = size - total_bytes_compressed;
+
+      int bytes_to_compress = static_cast<int>(
+          std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
+      int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
+      auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
+      s32 compressed_len =
+          LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
+                               compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
+
+      if (compressed_len == 0)
+      {
+        PanicAlertFmtT("Internal LZ4 Error - compression failed");
+        return;
+      }
+
+      // The size of the data to write is 'compressed_len'
+      f.WriteArray(&compressed_len, 1);
+      f.WriteBytes(compressed_buffer.get(), compressed_len);
+
+      total_bytes_compressed += bytes_to_compress;
     }
+  }
+}
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+// Returns the given range of the state. Ranges that span several segments are copied to scratch.
+static std::span<const u8> GetStateRange(std::span<const std::span<const u8>> segments,
+                                         std::span<const u64> segment_offsets, u64 offset,
+                                         size_t size, std::vector<u8>& scratch)
+{
+  size_t i = std::upper_bound(segment_offsets.begin(), segment_offsets.end(), offset) -
+             segment_offsets.begin() - 1;
+  u64 offset_in_segment = offset - segment_offsets[i];
+  if (offset_in_segment + size <= segments[i].size())
+    return segments[i].subspan(offset_in_segment, size);
+
+  scratch.resize(size);
+  for (size_t copied = 0; copied < size; ++i, offset_in_segment = 0)
+  {
+    const size_t length =
+        static_cast<size_t>(std::min<u64>(size - copied, segments[i].size() - offset_in_segment));
+    std::memcpy(scratch.data() + copied, segments[i].data() + offset_in_segment, length);
+    copied += length;
+  }
+  return scratch;
+}
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+// The payload starts with the chunk size, followed by every chunk as an independent zstd frame
+// prefixed with its compressed size. This lets both compression and decompression use all cores.
+static void CompressBufferToFileZstd(std::span<const std::span<const u8>> segments, u64 size,
+                                     File::IOFile& f)
+{
+  std::vector<u64> segment_offsets;
+  u64 segment_offset = 0;
+  for (const std::span<const u8> segment : segments)
+  {
+    segment_offsets.push_back(segment_offset);
+    segment_offset += segment.size();
+  }
+
+  const u64 chunk_count = (size + ZSTD_CHUNK_SIZE - 1) / ZSTD_CHUNK_SIZE;
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  std::atomic<bool> success = true;
+
+  Common::ParallelFor(chunk_count, [&](size_t i) {
+    const u64 offset = i * ZSTD_CHUNK_SIZE;
+    const size_t chunk_size = static_cast<size_t>(std::min<u64>(ZSTD_CHUNK_SIZE, size - offset));
+    std::vector<u8> scratch;
+    const std::span<const u8> source =
+        GetStateRange(segments, segment_offsets, offset, chunk_size, scratch);
+
+    std::vector<u8>& chunk = chunks[i];
+    chunk.resize(ZSTD_compressBound(chunk_size));
+    const size_t compressed_size = ZSTD_compress(chunk.data(), chunk.size(), source.data(),
+                                                 source.size(), ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(compressed_size))
+      success = false;
+    else
+      chunk.resize(compressed_size);
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal Zstandard Error - compression failed");
+    return;
+  }
+
+  const u32 chunk_size = ZSTD_CHUNK_SIZE;
+  f.WriteArray(&chunk_size, 1);
+  for (const std::vector<u8>& chunk : chunks)
+  {
+    const u32 compressed_size = static_cast<u32>(chunk.size());
+    f.WriteArray(&compressed_size, 1);
+    f.WriteBytes(chunk.data(), chunk.size());
   }
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+// The state is the concatenation of segments, which add up to size bytes.
+static void CompressBufferToFile(CompressionType compression_type,
+                                 std::span<const std::span<const u8>> segments, u64 size,
+                                 File::IOFile& f)
+{
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
+    CompressBufferToFileLZ4(segments, f);
+    break;
+  case CompressionType::Zstd:
+    CompressBufferToFileZstd(segments, size, f);
+    break;
+  default:
+    for (const std::span<const u8> segment : segments)
+      f.WriteBytes(segment.data(), segment.size());
+    break;
+  }
+}
+
+// Interleaves the arrays that were gathered while saving with the rest of the state in buffer.
+static std::vector<std::span<const u8>>
+GetStateSegments(std::span<const u8> buffer,
+                 std::span<const PointerWrap::GatheredArray> gathered_arrays)
+{
+  std::vector<std::span<const u8>> segments;
+  size_t offset = 0;
+  for (const PointerWrap::GatheredArray& array : gathered_arrays)
+  {
+    if (array.offset > offset)
+      segments.push_back(buffer.subspan(offset, array.offset - offset));
+    segments.emplace_back(array.data, array.size);
+    offset = array.offset;
+  }
+  if (offset < buffer.size())
+    segments.push_back(buffer.subspan(offset));
+  return segments;
+}
+
+static CompressionType GetCompressionType()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+  return Config::Get(Config::MAIN_STATE_COMPRESSION_ZSTD) ? CompressionType::Zstd :
+                                                             CompressionType::LZ4;
+}
+
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -374,7 +557,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -386,8 +569,11 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
 
 static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
 {
-  const u8* const buffer_data = save_args.buffer_vector.data();
-  const size_t buffer_size = save_args.buffer_vector.size();
+  const std::vector<std::span<const u8>> segments =
+      GetStateSegments(save_args.buffer_vector, save_args.gathered_arrays);
+  size_t buffer_size = 0;
+  for (const std::span<const u8> segment : segments)
+    buffer_size += segment.size();
   const std::string& filename = save_args.filename;
 
   // Find free temporary filename.
@@ -408,12 +594,8 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
-
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
-  else
-    f.WriteBytes(buffer_data, buffer_size);
+  WriteHeadersToFile(buffer_size, save_args.compression_type, f);
+  CompressBufferToFile(save_args.compression_type, segments, buffer_size, f);
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -484,9 +666,16 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
+        // When waiting, emulation stays paused until the state has been written, so emulated
+        // memory can be compressed where it is instead of being copied first.
+        std::vector<PointerWrap::GatheredArray> gathered_arrays;
+        std::vector<PointerWrap::GatheredArray>* const gather_target =
+            wait ? &gathered_arrays : nullptr;
+
         // Measure the size of the buffer.
         u8* ptr = nullptr;
         PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+        p_measure.SetGatherTarget(gather_target);
         DoState(system, p_measure);
         const size_t buffer_size = reinterpret_cast<size_t>(ptr);
 
@@ -495,6 +684,7 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
         current_buffer.resize(buffer_size);
         ptr = current_buffer.data();
         PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+        p.SetGatherTarget(gather_target);
         DoState(system, p);
 
         if (p.IsWriteMode())
@@ -505,7 +695,9 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
 
           CompressAndDumpState_args save_args;
           save_args.buffer_vector = std::move(current_buffer);
+          save_args.gathered_arrays = std::move(gathered_arrays);
           save_args.filename = filename;
+          save_args.compression_type = GetCompressionType();
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -723,6 +915,55 @@ static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f
   }
 }
 
+static bool DecompressZstd(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f)
+{
+  raw_buffer.resize(size);
+
+  u32 chunk_size;
+  if (!f.ReadArray(&chunk_size, 1) || chunk_size == 0)
+  {
+    PanicAlertFmt("Could not read state chunk size");
+    return false;
+  }
+
+  const u64 chunk_count = (size + chunk_size - 1) / chunk_size;
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  for (std::vector<u8>& chunk : chunks)
+  {
+    u32 compressed_size;
+    if (!f.ReadArray(&compressed_size, 1))
+    {
+      PanicAlertFmt("Could not read state data length");
+      return false;
+    }
+
+    chunk.resize(compressed_size);
+    if (!f.ReadBytes(chunk.data(), chunk.size()))
+    {
+      PanicAlertFmt("Could not read state data");
+      return false;
+    }
+  }
+
+  std::atomic<bool> success = true;
+  Common::ParallelFor(chunk_count, [&](size_t i) {
+    const u64 offset = i * chunk_size;
+    const size_t expected_size = static_cast<size_t>(std::min<u64>(chunk_size, size - offset));
+    const size_t result = ZSTD_decompress(raw_buffer.data() + offset, expected_size,
+                                          chunks[i].data(), chunks[i].size());
+    if (ZSTD_isError(result) || result != expected_size)
+      success = false;
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal Zstandard Error - decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -770,53 +1011,37 @@ static bool ValidateHeaders(const StateHeader& header)
   return success;
 }
 
-static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
+static bool ReadStatePayload(const StateHeader& header, File::IOFile& f, std::vector<u8>& buffer)
 {
-  File::IOFile f;
-
-  {
-    // If a state is currently saving, wait for that to end or time out.
-    std::unique_lock lk(s_state_writes_in_queue_mutex);
-    if (s_state_writes_in_queue != 0)
-    {
-      if (!s_state_write_queue_is_empty.wait_for(lk, std::chrono::seconds(3),
-                                                 []() { return s_state_writes_in_queue == 0; }))
-      {
-        Core::DisplayMessage(
-            "A previous state saving operation is still in progress, cancelling load.", 2000);
-        return;
-      }
-    }
-    f.Open(filename, "rb");
-  }
-
-  StateHeader header;
-  if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
-    return;
-
   StateExtendedHeader extended_header;
   if (!f.ReadArray(&extended_header.base_header, 1))
   {
     PanicAlertFmt("Unable to read state header");
-    return;
+    return false;
   }
   // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
   if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
   {
     PanicAlertFmt("State header corrupted");
-    return;
+    return false;
   }
 
-  std::vector<u8> buffer;
-
   switch (extended_header.base_header.compression_type)
   {
   case CompressionType::LZ4:
   {
     Core::DisplayMessage("Decompressing State...", 500);
     if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
-      return;
+      return false;
+
+    break;
+  }
+  case CompressionType::Zstd:
+  {
+    Core::DisplayMessage("Decompressing State...", 500);
+    if (!DecompressZstd(buffer, extended_header.base_header.uncompressed_size, f))
+      return false;
 
     break;
   }
@@ -830,7 +1055,7 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
     if (file_size < header_len)
     {
       PanicAlertFmt("State header length corrupted");
-      return;
+      return false;
     }
 
     const auto size = static_cast<size_t>(file_size - header_len);
@@ -839,19 +1064,116 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
     if (!f.ReadBytes(buffer.data(), size))
     {
       PanicAlertFmt("Error reading bytes: {0}", size);
-      return;
+      return false;
     }
     break;
   }
   default:
     PanicAlertFmt("Unknown compression type {0}", extended_header.base_header.compression_type);
-    return;
+    return false;
+  }
+
+  return true;
+}
+
+static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
+{
+  File::IOFile f;
+
+  {
+    // If a state is currently saving, wait for that to end or time out.
+    std::unique_lock lk(s_state_writes_in_queue_mutex);
+    if (s_state_writes_in_queue != 0)
+    {
+      if (!s_state_write_queue_is_empty.wait_for(lk, std::chrono::seconds(3),
+                                                 []() { return s_state_writes_in_queue == 0; }))
+      {
+        Core::DisplayMessage(
+            "A previous state saving operation is still in progress, cancelling load.", 2000);
+        return;
+      }
+    }
+    f.Open(filename, "rb");
   }
 
+  StateHeader header;
+  if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
+    return;
+
+  std::vector<u8> buffer;
+  if (!ReadStatePayload(header, f, buffer))
+    return;
+
   // all good
   ret_data.swap(buffer);
 }
 
+static bool DecompressBuffer(CompressionType compression_type, std::vector<u8>& raw_buffer,
+                             u64 size, File::IOFile& f)
+{
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
+    return DecompressLZ4(raw_buffer, size, f);
+  case CompressionType::Zstd:
+    return DecompressZstd(raw_buffer, size, f);
+  default:
+    raw_buffer.resize(size);
+    return f.ReadBytes(raw_buffer.data(), raw_buffer.size());
+  }
+}
+
+std::optional<std::vector<CompressionBenchmarkResult>>
+BenchmarkCompression(const std::string& filename)
+{
+  File::IOFile f(filename, "rb");
+  StateHeader header;
+  std::vector<u8> buffer;
+  if (!ReadStateHeaderFromFile(header, f) || !ReadStatePayload(header, f, buffer))
+    return std::nullopt;
+  f.Close();
+
+  using Clock = std::chrono::steady_clock;
+  const auto seconds_since = [](Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
+  const std::string temp_filename = filename + ".benchmark.tmp";
+  const std::span<const u8> segments[] = {buffer};
+  std::vector<CompressionBenchmarkResult> results;
+  for (const CompressionType compression_type :
+       {CompressionType::Uncompressed, CompressionType::LZ4, CompressionType::Zstd})
+  {
+    CompressionBenchmarkResult& result = results.emplace_back();
+    result.compression_type = compression_type;
+
+    Clock::time_point start = Clock::now();
+    File::IOFile out(temp_filename, "wb");
+    CompressBufferToFile(compression_type, segments, buffer.size(), out);
+    const bool saved = out.IsGood() && out.Close();
+    result.save_seconds = seconds_since(start);
+    result.compressed_size = File::GetSize(temp_filename);
+
+    start = Clock::now();
+    std::vector<u8> loaded_buffer;
+    File::IOFile in(temp_filename, "rb");
+    const bool loaded = DecompressBuffer(compression_type, loaded_buffer, buffer.size(), in);
+    result.load_seconds = seconds_since(start);
+    in.Close();
+
+    if (!saved || !loaded || loaded_buffer != buffer)
+    {
+      results.clear();
+      break;
+    }
+  }
+
+  File::Delete(temp_filename);
+  if (results.empty())
+    return std::nullopt;
+  return results;
+}
+
 void LoadAs(Core::System& system, const std::string& filename)
 {
   if (!Core::IsRunningOrStarting(system))
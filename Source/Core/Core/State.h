@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -55,6 +56,8 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // Independently compressed chunks, which can be compressed and decompressed in parallel.
+  Zstd = 2,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -88,6 +91,20 @@ void EnableCompression(bool compression);
 
 bool ReadHeader(const std::string& filename, StateHeader& header);
 
+struct CompressionBenchmarkResult
+{
+  CompressionType compression_type;
+  u64 compressed_size;
+  double save_seconds;
+  double load_seconds;
+};
+
+// Writes the data of the given state file to a temporary file with every compression type and
+// reads it back, timing both. Returns nothing if the state can't be read or doesn't survive the
+// round trip.
+std::optional<std::vector<CompressionBenchmarkResult>>
+BenchmarkCompression(const std::string& filename);
+
 // Returns a string containing information of the savestate in the given slot
 // which can be presented to the user for identification purposes
 std::string GetInfoStringOfSlot(int slot, bool translate = true);
@@ -109,6 +126,17 @@ void LoadAs(Core::System& system, const std::string& filename);
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
+// Incremental states only contain the pages of emulated memory that changed since a base state,
+// which makes them much smaller and faster to save than full states when taken often.
+// SaveIncrementalBaseToBuffer saves a full state and makes it the base for the following calls to
+// SaveIncrementalToBuffer. An incremental state can only be loaded along with its base state,
+// which then becomes the new base. Passing an empty incremental state loads just the base.
+// Unlike LoadFromBuffer, this is allowed during NetPlay, as its rollback mode is built on it.
+void SaveIncrementalBaseToBuffer(Core::System& system, std::vector<u8>& buffer);
+void SaveIncrementalToBuffer(Core::System& system, std::vector<u8>& buffer);
+void LoadIncrementalFromBuffer(Core::System& system, std::vector<u8>& base,
+                               std::vector<u8>& incremental);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <list>
 #include <locale>
 #include <map>
 #include <memory>
@@ -97,9 +98,9 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
-      File::IOFile file(content.m_filename, "rb");
-      if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
-          !file.ReadBytes(*buffer, bytes_to_read))
+      File::IOFile* file = blob->GetContentFile(content.m_filename);
+      if (!file || !file->Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
+          !file->ReadBytes(*buffer, bytes_to_read))
       {
         return false;
       }
@@ -494,6 +495,38 @@ bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
       .Read(offset, length, buffer, this);
 }
 
+File::IOFile* DirectoryBlobReader::GetContentFile(const std::string& path)
+{
+  auto it = std::find_if(m_open_content_files.begin(), m_open_content_files.end(),
+                         [&path](const auto& open_file) { return open_file.first == path; });
+  if (it != m_open_content_files.end())
+  {
+    // Reopen handles that have failed a read, so that one error doesn't stick.
+    if (!it->second.IsGood())
+    {
+      m_open_content_files.erase(it);
+      it = m_open_content_files.end();
+    }
+    else if (it != m_open_content_files.begin())
+    {
+      m_open_content_files.splice(m_open_content_files.begin(), m_open_content_files, it);
+    }
+  }
+
+  if (it == m_open_content_files.end())
+  {
+    File::IOFile file(path, "rb");
+    if (!file.IsOpen())
+      return nullptr;
+
+    if (m_open_content_files.size() >= MAX_OPEN_CONTENT_FILES)
+      m_open_content_files.pop_back();
+    m_open_content_files.emplace_front(path, std::move(file));
+  }
+
+  return &m_open_content_files.front().second;
+}
+
 const DirectoryBlobPartition* DirectoryBlobReader::GetPartition(u64 offset, u64 size,
                                                                 u64 partition_data_offset) const
 {
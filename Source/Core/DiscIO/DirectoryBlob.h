@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -16,6 +17,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -23,7 +25,6 @@
 namespace File
 {
 struct FSTEntry;
-class IOFile;
 }  // namespace File
 
 namespace DiscIO
@@ -312,6 +313,9 @@ private:
 
   DiscIO::VolumeDisc* GetWrappedVolume() { return m_wrapped_volume.get(); }
 
+  // Returns an open handle to a host file that content is read from. Returns nullptr on failure.
+  File::IOFile* GetContentFile(const std::string& path);
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -326,6 +330,11 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<DiscIO::VolumeDisc> m_wrapped_volume;
+
+  // Games tend to read many small pieces of the same few files, so the most recently used files
+  // are kept open instead of being reopened for every read. Most recently used first.
+  static constexpr size_t MAX_OPEN_CONTENT_FILES = 16;
+  std::list<std::pair<std::string, File::IOFile>> m_open_content_files;
 };
 
 }  // namespace DiscIO
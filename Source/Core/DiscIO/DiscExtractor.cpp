@@ -8,9 +8,11 @@
 #include <cstddef>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
@@ -22,6 +24,8 @@
 
 namespace DiscIO
 {
+constexpr u64 EXPORT_CHUNK_SIZE = 0x800000;  // 8 MiB
+
 u64 ReadFile(const Volume& volume, const Partition& partition, const FileInfo* file_info,
              u8* buffer, u64 max_buffer_size, u64 offset_in_file)
 {
@@ -58,21 +62,37 @@ bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u6
   if (!f)
     return false;
 
+  // Files that span several chunks get each chunk written on another thread while the next one is
+  // read, so that decompressing and decrypting the volume overlaps with writing to the disk.
+  const size_t chunk_size = static_cast<size_t>(std::min(size, EXPORT_CHUNK_SIZE));
+  std::array<std::vector<u8>, 2> buffers;
+  buffers[0].resize(chunk_size);
+  if (size > chunk_size)
+    buffers[1].resize(chunk_size);
+  std::future<bool> write_result;
+  size_t buffer_index = 0;
+
   while (size)
   {
-    // Limit read size to 128 MB
-    const size_t read_size = static_cast<size_t>(std::min<u64>(size, 0x08000000));
-
-    std::vector<u8> buffer(read_size);
+    const size_t read_size = static_cast<size_t>(std::min<u64>(size, chunk_size));
+    std::vector<u8>& buffer = buffers[buffer_index];
 
     if (!volume.Read(offset, read_size, buffer.data(), partition))
       return false;
 
-    if (!f.WriteBytes(buffer.data(), read_size))
+    if (write_result.valid() && !write_result.get())
       return false;
 
     size -= read_size;
     offset += read_size;
+
+    if (size == 0)
+      return f.WriteBytes(buffer.data(), read_size);
+
+    write_result = std::async(std::launch::async, [&f, &buffer, read_size] {
+      return f.WriteBytes(buffer.data(), read_size);
+    });
+    buffer_index ^= 1;
   }
 
   return true;
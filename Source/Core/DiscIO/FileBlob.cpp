@@ -4,20 +4,27 @@
 #include "DiscIO/FileBlob.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
+
 namespace DiscIO
 {
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+
+  if (Config::Get(Config::MAIN_MEMORY_MAP_DISC_IMAGES))
+    m_mapping.Map(m_file);
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -35,6 +42,20 @@ std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapping.IsMapped())
+  {
+    if (offset > m_mapping.GetSize() || nbytes > m_mapping.GetSize() - offset)
+      return false;
+
+    // Let the OS read ahead of sequential reads, like it would for fread.
+    if (offset == m_last_read_end)
+      m_mapping.WillNeed(offset + nbytes, MAPPED_READ_AHEAD_SIZE);
+    m_last_read_end = offset + nbytes;
+
+    std::memcpy(out_ptr, m_mapping.GetData() + offset, nbytes);
+    return true;
+  }
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -9,10 +9,14 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
 {
+// How far ahead of a sequential read of a memory-mapped disc image the OS is asked to read.
+constexpr u64 MAPPED_READ_AHEAD_SIZE = 0x100000;
+
 class PlainFileReader : public BlobReader
 {
 public:
@@ -37,6 +41,10 @@ private:
 
   File::IOFile m_file;
   u64 m_size;
+
+  // Only used if MAIN_MEMORY_MAP_DISC_IMAGES is enabled.
+  File::MappedFile m_mapping;
+  u64 m_last_read_end = 0;
 };
 
 }  // namespace DiscIO
@@ -37,6 +37,7 @@ using ConversionResult = Common::Result<ConversionResultCode, T>;
 // but the compression threads are not guaranteed to handle data in a predictable order.
 // Remember to check GetStatus regularly and cancel if it doesn't return Success,
 // and call Shutdown when you want to ensure that everything finishes.
+// If threads is 0, one compression thread is started per CPU core.
 template <typename CompressThreadState, typename CompressParameters, typename OutputParameters>
 class MultithreadedCompressor
 {
@@ -45,10 +46,11 @@ public:
       std::function<ConversionResultCode(CompressThreadState*)> set_up_compress_thread_state,
       std::function<ConversionResult<OutputParameters>(CompressThreadState*, CompressParameters)>
           compress,
-      std::function<ConversionResultCode(OutputParameters)> output)
+      std::function<ConversionResultCode(OutputParameters)> output, unsigned int threads = 0)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(threads != 0 ? threads :
+                                 std::max<unsigned int>(1, std::thread::hardware_concurrency()))
   {
     m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
 
@@ -11,12 +11,20 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 #include "Core/IOS/ES/Formats.h"
 
 namespace DiscIO
 {
 constexpr size_t NAND_SIZE = 0x20000000;
 constexpr size_t NAND_KEYS_SIZE = 0x400;
+constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
+
+constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
+constexpr size_t NAND_BLOCK_SIZE = 0x800;
+constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
+constexpr size_t NAND_BIN_SIZE =
+    (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
 
 NANDImporter::NANDImporter() : m_nand_root(File::GetUserPath(D_WIIROOT_IDX))
 {
@@ -35,20 +43,27 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
     return;
 
   ExportKeys();
-  ProcessEntry(0, "");
+  FileList files;
+  ProcessEntry(0, "", &files);
+  ExtractFiles(files);
   ExtractCertificates();
+
+  m_nand_mapping.Unmap();
+  m_nand_file.Close();
+  m_nand.clear();
+}
+
+void NANDImporter::Update()
+{
+  std::lock_guard lk(m_update_mutex);
+  m_update_callback();
 }
 
 bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
                                std::function<std::string()> get_otp_dump_path)
 {
-  constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
-  constexpr size_t NAND_BLOCK_SIZE = 0x800;
-  constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
-  constexpr size_t NAND_BIN_SIZE =
-      (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
-
-  File::IOFile file(path_to_bin, "rb");
+  File::IOFile& file = m_nand_file;
+  file.Open(path_to_bin, "rb");
   const u64 image_size = file.GetSize();
   if (image_size != NAND_BIN_SIZE + NAND_KEYS_SIZE && image_size != NAND_BIN_SIZE)
   {
@@ -56,19 +71,23 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
     return false;
   }
 
-  m_nand.resize(NAND_SIZE);
-
-  for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i++)
+  // Mapping the dump avoids holding a copy of the whole NAND in memory.
+  if (!m_nand_mapping.Map(file))
   {
-    // Instead of updating on every cycle, we only update every 1000 cycles for a balance between
-    // not updating fast enough vs updating too fast
-    if (i % 1000 == 0)
-      m_update_callback();
+    m_nand.resize(NAND_SIZE);
+
+    for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i++)
+    {
+      // Instead of updating on every cycle, we only update every 1000 cycles for a balance
+      // between not updating fast enough vs updating too fast
+      if (i % 1000 == 0)
+        m_update_callback();
 
-    file.ReadBytes(&m_nand[i * NAND_BLOCK_SIZE], NAND_BLOCK_SIZE);
+      file.ReadBytes(&m_nand[i * NAND_BLOCK_SIZE], NAND_BLOCK_SIZE);
 
-    // We don't care about the ECC blocks
-    file.Seek(NAND_ECC_BLOCK_SIZE, File::SeekOrigin::Current);
+      // We don't care about the ECC blocks
+      file.Seek(NAND_ECC_BLOCK_SIZE, File::SeekOrigin::Current);
+    }
   }
 
   m_nand_keys.resize(NAND_KEYS_SIZE);
@@ -85,7 +104,32 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
   }
 
   // Otherwise, just read the key data from the NAND image.
-  return file.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
+  return file.Seek(NAND_BIN_SIZE, File::SeekOrigin::Begin) &&
+         file.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
+}
+
+void NANDImporter::ReadNAND(size_t offset, u8* dest, size_t size) const
+{
+  if (!m_nand_mapping.IsMapped())
+  {
+    std::memcpy(dest, &m_nand[offset], size);
+    return;
+  }
+
+  // Skip the ECC data that follows every block in the dump.
+  while (size > 0)
+  {
+    const size_t block = offset / NAND_BLOCK_SIZE;
+    const size_t offset_in_block = offset % NAND_BLOCK_SIZE;
+    const size_t chunk_size = std::min(size, NAND_BLOCK_SIZE - offset_in_block);
+    std::memcpy(dest,
+                m_nand_mapping.GetData() + block * (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) +
+                    offset_in_block,
+                chunk_size);
+    dest += chunk_size;
+    offset += chunk_size;
+    size -= chunk_size;
+  }
 }
 
 bool NANDImporter::FindSuperblock()
@@ -96,8 +140,8 @@ bool NANDImporter::FindSuperblock()
   for (int i = 0; i < 16; i++)
   {
     auto superblock = std::make_unique<NANDSuperblock>();
-    std::memcpy(superblock.get(), &m_nand[NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock)],
-                sizeof(NANDSuperblock));
+    ReadNAND(NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock),
+             reinterpret_cast<u8*>(superblock.get()), sizeof(NANDSuperblock));
 
     if (std::memcmp(superblock->magic.data(), "SFFS", 4) != 0)
     {
@@ -131,7 +175,8 @@ std::string NANDImporter::GetPath(const NANDFSTEntry& entry, const std::string&
   return parent_path + '/' + name;
 }
 
-void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path)
+// Creates the directories right away, and collects the files so they can be extracted in parallel.
+void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path, FileList* files)
 {
   while (entry_number != 0xffff)
   {
@@ -150,14 +195,12 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
     Type type = static_cast<Type>(entry.mode & 3);
     if (type == Type::File)
     {
-      std::vector<u8> data = GetEntryData(entry);
-      File::IOFile file(m_nand_root + path, "wb");
-      file.WriteBytes(data.data(), data.size());
+      files->emplace_back(entry, path);
     }
     else if (type == Type::Directory)
     {
       File::CreateDir(m_nand_root + path);
-      ProcessEntry(entry.sub, path);
+      ProcessEntry(entry.sub, path, files);
     }
     else
     {
@@ -168,7 +211,20 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
   }
 }
 
-std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
+void NANDImporter::ExtractFiles(const FileList& files)
+{
+  Common::ParallelFor(files.size(), [&](size_t i) {
+    const auto& [entry, path] = files[i];
+    const auto aes_ctx = Common::AES::CreateContextDecrypt(&m_nand_keys[NAND_AES_KEY_OFFSET]);
+    std::vector<u8> data = GetEntryData(entry, *aes_ctx);
+    File::IOFile file(m_nand_root + path, "wb");
+    file.WriteBytes(data.data(), data.size());
+    Update();
+  });
+}
+
+std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry,
+                                           Common::AES::Context& aes_ctx) const
 {
   constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
 
@@ -186,7 +242,8 @@ std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
       return {};
     }
 
-    m_aes_ctx->CryptIvZero(&m_nand[NAND_FAT_BLOCK_SIZE * sub], block.get(), NAND_FAT_BLOCK_SIZE);
+    ReadNAND(NAND_FAT_BLOCK_SIZE * sub, block.get(), NAND_FAT_BLOCK_SIZE);
+    aes_ctx.CryptIvZero(block.get(), block.get(), NAND_FAT_BLOCK_SIZE);
 
     size_t size = std::min(remaining_bytes, NAND_FAT_BLOCK_SIZE);
     data.insert(data.end(), block.get(), block.get() + size);
@@ -287,10 +344,6 @@ bool NANDImporter::ExtractCertificates()
 
 void NANDImporter::ExportKeys()
 {
-  constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
-
-  m_aes_ctx = Common::AES::CreateContextDecrypt(&m_nand_keys[NAND_AES_KEY_OFFSET]);
-
   const std::string file_path = m_nand_root + "/keys.bin";
   File::IOFile file(file_path, "wb");
   if (!file.WriteBytes(m_nand_keys.data(), NAND_KEYS_SIZE))
@@ -6,13 +6,17 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/Swap.h"
 
 namespace DiscIO
@@ -64,19 +68,28 @@ public:
 #pragma pack(pop)
 
 private:
+  using FileList = std::vector<std::pair<NANDFSTEntry, std::string>>;
+
   bool ReadNANDBin(const std::string& path_to_bin, std::function<std::string()> get_otp_dump_path);
+  void ReadNAND(size_t offset, u8* dest, size_t size) const;
   bool FindSuperblock();
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
   std::string FormatDebugString(const NANDFSTEntry& entry);
-  void ProcessEntry(u16 entry_number, const std::string& parent_path);
-  std::vector<u8> GetEntryData(const NANDFSTEntry& entry);
+  void ProcessEntry(u16 entry_number, const std::string& parent_path, FileList* files);
+  void ExtractFiles(const FileList& files);
+  std::vector<u8> GetEntryData(const NANDFSTEntry& entry, Common::AES::Context& aes_ctx) const;
   void ExportKeys();
+  void Update();
 
   std::string m_nand_root;
+  // The NAND image is read straight from a mapping of the dump if possible. Otherwise, its pages
+  // are read into m_nand without the ECC data.
+  File::IOFile m_nand_file;
+  File::MappedFile m_nand_mapping;
   std::vector<u8> m_nand;
   std::vector<u8> m_nand_keys;
-  std::unique_ptr<Common::AES::Context> m_aes_ctx;
   std::unique_ptr<NANDSuperblock> m_superblock;
+  std::mutex m_update_mutex;
   std::function<void()> m_update_callback;
 };
 }  // namespace DiscIO
@@ -3,6 +3,7 @@
 
 #include "DiscIO/SplitFileBlob.h"
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -11,10 +12,15 @@
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
+
+#include "DiscIO/FileBlob.h"
+
 namespace DiscIO
 {
 SplitPlainFileReader::SplitPlainFileReader(std::vector<SingleFile> files)
@@ -23,6 +29,16 @@ SplitPlainFileReader::SplitPlainFileReader(std::vector<SingleFile> files)
   m_size = 0;
   for (const auto& f : m_files)
     m_size += f.size;
+
+  if (Config::Get(Config::MAIN_MEMORY_MAP_DISC_IMAGES))
+  {
+    for (SingleFile& f : m_files)
+    {
+      f.mapping = std::make_unique<File::MappedFile>();
+      if (!f.mapping->Map(f.file) || f.mapping->GetSize() != f.size)
+        f.mapping.reset();
+    }
+  }
 }
 
 std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_view first_file_path)
@@ -72,6 +88,9 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   if (offset >= m_size)
     return false;
 
+  const bool sequential = offset == m_last_read_end;
+  m_last_read_end = offset + nbytes;
+
   u64 current_offset = offset;
   u64 rest = nbytes;
   u8* out = out_ptr;
@@ -82,7 +101,14 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (file.mapping)
+      {
+        // Let the OS read ahead of sequential reads, like it would for fread.
+        if (sequential)
+          file.mapping->WillNeed(seek_offset + current_read, MAPPED_READ_AHEAD_SIZE);
+        std::memcpy(out, file.mapping->GetData() + seek_offset, current_read);
+      }
+      else if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
       {
         f.ClearError();
         return false;
@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -40,12 +41,16 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+
+    // Only used if MAIN_MEMORY_MAP_DISC_IMAGES is enabled.
+    std::unique_ptr<File::MappedFile> mapping;
   };
 
   SplitPlainFileReader(std::vector<SingleFile> m_files);
 
   std::vector<SingleFile> m_files;
   u64 m_size;
+  u64 m_last_read_end = 0;
 };
 
 }  // namespace DiscIO
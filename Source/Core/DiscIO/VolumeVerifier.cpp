@@ -358,11 +358,14 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 }
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// Larger reads mean fewer round trips to the hashing threads, and nothing has to line up with
+// Wii groups when they aren't being checked.
+constexpr u64 HASHES_ONLY_READ_SIZE = 0x200000;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
-                               Hashes<bool> hashes_to_calculate)
+                               Hashes<bool> hashes_to_calculate, bool check_integrity)
     : m_volume(volume), m_redump_verification(redump_verification),
-      m_hashes_to_calculate(hashes_to_calculate),
+      m_check_integrity(check_integrity), m_hashes_to_calculate(hashes_to_calculate),
       m_calculating_any_hash(hashes_to_calculate.crc32 || hashes_to_calculate.md5 ||
                              hashes_to_calculate.sha1),
       m_max_progress(volume.GetDataSize()), m_data_size_type(volume.GetDataSizeType())
@@ -1049,7 +1052,13 @@ void VolumeVerifier::CheckSuperPaperMario()
 
 void VolumeVerifier::SetUpHashing()
 {
-  if (m_volume.GetVolumeType() == Platform::WiiWAD)
+  if (!m_check_integrity)
+  {
+    // Without anything to check per block or content, the volume is only read for the hashes
+    // of the whole thing.
+    m_groups.clear();
+  }
+  else if (m_volume.GetVolumeType() == Platform::WiiWAD)
   {
     m_content_offsets = m_volume.GetContentOffsets();
   }
@@ -1125,7 +1134,7 @@ void VolumeVerifier::Process()
   IOS::ES::Content content{};
   bool content_read = false;
   bool group_read = false;
-  u64 bytes_to_read = DEFAULT_READ_SIZE;
+  u64 bytes_to_read = m_check_integrity ? DEFAULT_READ_SIZE : HASHES_ONLY_READ_SIZE;
   u64 excess_bytes = 0;
   if (m_content_index < m_content_offsets.size() &&
       m_content_offsets[m_content_index] == m_progress)
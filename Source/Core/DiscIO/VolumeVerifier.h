@@ -124,7 +124,10 @@ public:
     RedumpVerifier::Result redump;
   };
 
-  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
+  // If check_integrity is false, only the hashes of the whole volume (and whatever can be found
+  // without reading all of it) are checked, not the hashes of each Wii block or WAD content.
+  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate,
+                 bool check_integrity = true);
   ~VolumeVerifier();
 
   static Hashes<bool> GetDefaultHashesToCalculate();
@@ -169,6 +172,7 @@ private:
 
   bool m_redump_verification;
   RedumpVerifier m_redump_verifier;
+  bool m_check_integrity;
 
   bool m_read_errors_occurred = false;
 
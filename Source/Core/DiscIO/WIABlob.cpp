@@ -5,14 +5,18 @@
 
 #include <algorithm>
 #include <array>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <zstd.h>
@@ -20,6 +24,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
@@ -27,6 +32,9 @@
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/MainSettings.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
@@ -79,13 +87,34 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
+    : m_file(std::move(file)), m_path(path),
+      m_chunk_cache_budget(size_t{Config::Get(Config::MAIN_WIA_CHUNK_CACHE_SIZE)} * 1024 * 1024),
+      m_read_ahead_enabled(Config::Get(Config::MAIN_WIA_READ_AHEAD)), m_encryption_cache(this)
 {
   m_valid = Initialize(path);
+
+  // Chunks that are being read ahead are not part of the cache, so they get a share of the budget.
+  // A chunk takes up its compressed size and its decompressed size.
+  const u64 chunk_memory = u64{Common::swap32(m_header_2.chunk_size)} * 2;
+  if (m_valid && chunk_memory != 0)
+  {
+    m_max_read_ahead_chunks =
+        std::clamp<size_t>(m_chunk_cache_budget / 2 / chunk_memory, 1,
+                           std::max(1u, std::thread::hardware_concurrency()));
+  }
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  {
+    std::lock_guard lk(m_read_ahead_mutex);
+    m_read_ahead_shutdown = true;
+  }
+  m_read_ahead_queue_cv.notify_all();
+  for (std::thread& thread : m_read_ahead_threads)
+    thread.join();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -206,10 +235,10 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
 
   const u32 number_of_raw_data_entries = Common::swap32(m_header_2.number_of_raw_data_entries);
   m_raw_data_entries.resize(number_of_raw_data_entries);
-  Chunk& raw_data_entries =
-      ReadCompressedData(Common::swap64(m_header_2.raw_data_entries_offset),
-                         Common::swap32(m_header_2.raw_data_entries_size),
-                         number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type);
+  Chunk raw_data_entries =
+      CreateChunk(&m_file, {Common::swap64(m_header_2.raw_data_entries_offset),
+                            Common::swap32(m_header_2.raw_data_entries_size),
+                            number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type});
   if (!raw_data_entries.ReadAll(&m_raw_data_entries))
     return false;
 
@@ -223,10 +252,10 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
 
   const u32 number_of_group_entries = Common::swap32(m_header_2.number_of_group_entries);
   m_group_entries.resize(number_of_group_entries);
-  Chunk& group_entries =
-      ReadCompressedData(Common::swap64(m_header_2.group_entries_offset),
-                         Common::swap32(m_header_2.group_entries_size),
-                         number_of_group_entries * sizeof(GroupEntry), m_compression_type);
+  Chunk group_entries =
+      CreateChunk(&m_file, {Common::swap64(m_header_2.group_entries_offset),
+                            Common::swap32(m_header_2.group_entries_size),
+                            number_of_group_entries * sizeof(GroupEntry), m_compression_type});
   if (!group_entries.ReadAll(&m_group_entries))
     return false;
 
@@ -507,45 +536,56 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const std::optional<ChunkParameters> chunk_parameters = GetGroupChunkParameters(
+        m_group_entries[total_group_index], chunk_size, exception_lists, group_offset_in_data);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
-
-    if (group_data_size == 0)
+    if (!chunk_parameters)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(*chunk_parameters);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        // Invalidate the cache. ReadCompressedData always puts the chunk first.
+        m_cached_chunks.pop_front();
         return false;
       }
 
+      if (total_group_index == m_last_group_index + 1)
+        ++m_sequential_groups;
+      else if (total_group_index != m_last_group_index)
+        m_sequential_groups = 0;
+
+      if (m_read_ahead_enabled && total_group_index == m_last_group_index + 1)
+      {
+        const size_t read_ahead_chunks = std::min(m_sequential_groups, m_max_read_ahead_chunks);
+        for (size_t j = 1; j <= read_ahead_chunks; ++j)
+        {
+          const u64 next_group_offset_in_data = group_offset_in_data + j * chunk_size;
+          if (i + j >= number_of_groups || total_group_index + j >= m_group_entries.size() ||
+              next_group_offset_in_data >= data_size)
+          {
+            break;
+          }
+
+          const std::optional<ChunkParameters> next_chunk_parameters = GetGroupChunkParameters(
+              m_group_entries[total_group_index + j],
+              std::min(chunk_size, data_size - next_group_offset_in_data), exception_lists,
+              next_group_offset_in_data);
+          if (next_chunk_parameters)
+            StartReadAhead(*next_chunk_parameters);
+        }
+      }
+
       if (m_write_to_exception_list && m_exception_list_last_group_index != total_group_index)
       {
         const u64 exception_list_index = offset_in_group / VolumeWii::GROUP_DATA_SIZE;
@@ -557,6 +597,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       }
     }
 
+    m_last_group_index = total_group_index;
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -566,24 +607,47 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 }
 
 template <bool RVZ>
-typename WIARVZFileReader<RVZ>::Chunk&
-WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
-                                          u64 decompressed_size,
-                                          WIARVZCompressionType compression_type,
-                                          u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
+std::optional<typename WIARVZFileReader<RVZ>::ChunkParameters>
+WIARVZFileReader<RVZ>::GetGroupChunkParameters(const GroupEntry& group, u64 chunk_size,
+                                               u32 exception_lists, u64 group_offset_in_data) const
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
 
+  if (group_data_size == 0)
+    return std::nullopt;
+
+  const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  return ChunkParameters{group_offset_in_file, group_data_size, chunk_size,
+                         compression_type,     exception_lists, rvz_packed_size,
+                         group_offset_in_data};
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const
+{
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (parameters.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
     break;
   case WIARVZCompressionType::Purge:
-    decompressor = std::make_unique<PurgeDecompressor>(rvz_packed_size == 0 ? decompressed_size :
-                                                                              rvz_packed_size);
+    decompressor = std::make_unique<PurgeDecompressor>(
+        parameters.rvz_packed_size == 0 ? parameters.decompressed_size :
+                                          parameters.rvz_packed_size);
     break;
   case WIARVZCompressionType::Bzip2:
     decompressor = std::make_unique<Bzip2Decompressor>();
@@ -601,13 +665,156 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      parameters.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, parameters.offset_in_file, parameters.compressed_size,
+               parameters.decompressed_size, parameters.exception_lists,
+               compressed_exception_lists, parameters.rvz_packed_size, parameters.data_offset,
+               std::move(decompressor));
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk&
+WIARVZFileReader<RVZ>::ReadCompressedData(const ChunkParameters& parameters)
+{
+  for (auto it = m_cached_chunks.begin(); it != m_cached_chunks.end(); ++it)
+  {
+    if (it->offset_in_file == parameters.offset_in_file)
+    {
+      m_cached_chunks.splice(m_cached_chunks.begin(), m_cached_chunks, it);
+      return it->chunk;
+    }
+  }
+
+  std::optional<Chunk> read_ahead_chunk;
+  const auto job_it = std::find_if(
+      m_read_ahead_jobs.begin(), m_read_ahead_jobs.end(),
+      [&](const auto& job) { return job->parameters.offset_in_file == parameters.offset_in_file; });
+  if (job_it != m_read_ahead_jobs.end())
+  {
+    const std::shared_ptr<ReadAheadJob> job = *job_it;
+    m_read_ahead_jobs.erase(job_it);
+
+    std::unique_lock lk(m_read_ahead_mutex);
+    if (!job->started)
+    {
+      // Decompressing it here is faster than waiting for the jobs queued before it.
+      job->cancelled = true;
+    }
+    else
+    {
+      m_read_ahead_done_cv.wait(lk, [&] { return job->done; });
+      if (job->success)
+        read_ahead_chunk = std::move(job->chunk);
+    }
+  }
+
+  m_cached_chunks.push_front(CachedChunk{
+      parameters.offset_in_file,
+      read_ahead_chunk ? std::move(*read_ahead_chunk) : CreateChunk(&m_file, parameters)});
+
+  // Evict the least recently used chunks, but always keep the one that is about to be used.
+  size_t cache_size = 0;
+  for (auto it = m_cached_chunks.begin(); it != m_cached_chunks.end(); ++it)
+  {
+    cache_size += it->chunk.GetMemoryUsage();
+    if (cache_size > m_chunk_cache_budget && it != m_cached_chunks.begin())
+    {
+      m_cached_chunks.erase(it, m_cached_chunks.end());
+      break;
+    }
+  }
+
+  return m_cached_chunks.front().chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::StartReadAhead(const ChunkParameters& parameters)
+{
+  const auto matches = [&](u64 offset_in_file) {
+    return offset_in_file == parameters.offset_in_file;
+  };
+  if (std::any_of(m_cached_chunks.begin(), m_cached_chunks.end(),
+                  [&](const CachedChunk& chunk) { return matches(chunk.offset_in_file); }) ||
+      std::any_of(m_read_ahead_jobs.begin(), m_read_ahead_jobs.end(),
+                  [&](const auto& job) { return matches(job->parameters.offset_in_file); }))
+  {
+    return;
+  }
+
+  if (m_read_ahead_threads.empty())
+  {
+    std::vector<File::IOFile> files;
+    for (size_t i = 0; i < m_max_read_ahead_chunks; ++i)
+    {
+      files.push_back(m_file.Duplicate("rb"));
+      if (!files.back().IsOpen())
+      {
+        m_read_ahead_enabled = false;
+        return;
+      }
+    }
+
+    for (File::IOFile& file : files)
+    {
+      m_read_ahead_threads.emplace_back(&WIARVZFileReader::ReadAheadThreadFunction, this,
+                                        std::move(file));
+    }
+  }
+
+  auto job = std::make_shared<ReadAheadJob>();
+  job->parameters = parameters;
+
+  {
+    std::lock_guard lk(m_read_ahead_mutex);
+
+    // Jobs that go unused (because the reads stopped being sequential) make way for new ones.
+    while (m_read_ahead_jobs.size() >= m_max_read_ahead_chunks)
+    {
+      m_read_ahead_jobs.front()->cancelled = true;
+      m_read_ahead_jobs.pop_front();
+    }
+
+    m_read_ahead_queue.push_back(job);
+  }
+  m_read_ahead_jobs.push_back(std::move(job));
+  m_read_ahead_queue_cv.notify_one();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ReadAheadThreadFunction(File::IOFile file)
+{
+  Common::SetCurrentThreadName("WIA/RVZ Read-Ahead");
+
+  while (true)
+  {
+    std::shared_ptr<ReadAheadJob> job;
+    {
+      std::unique_lock lk(m_read_ahead_mutex);
+      m_read_ahead_queue_cv.wait(
+          lk, [this] { return m_read_ahead_shutdown || !m_read_ahead_queue.empty(); });
+      if (m_read_ahead_shutdown)
+        return;
+
+      job = std::move(m_read_ahead_queue.front());
+      m_read_ahead_queue.pop_front();
+      if (job->cancelled)
+        continue;
+      job->started = true;
+    }
+
+    Chunk chunk = CreateChunk(&file, job->parameters);
+    const bool success = chunk.DecompressAll();
+
+    {
+      std::lock_guard lk(m_read_ahead_mutex);
+      job->chunk = std::move(chunk);
+      job->success = success;
+      job->done = true;
+    }
+    m_read_ahead_done_cv.notify_all();
+  }
 }
 
 template <bool RVZ>
@@ -651,16 +858,29 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!DecompressUntil(offset + size))
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end)
+{
+  if (!m_decompressor || !m_file || end > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
+    return false;
+
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -673,7 +893,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -753,7 +973,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1742,7 +1961,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               unsigned int threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1849,7 +2069,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -2041,7 +2261,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, unsigned int threads)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2059,7 +2279,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, threads);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
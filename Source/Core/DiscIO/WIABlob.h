@@ -4,12 +4,18 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
@@ -69,7 +75,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      unsigned int threads = 0);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -194,6 +201,11 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Reads and decompresses everything, so that later reads won't access the file
+    bool DecompressAll();
+
+    size_t GetMemoryUsage() const { return m_in.data.size() + m_out.data.size(); }
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -205,6 +217,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -228,6 +241,33 @@ private:
     u64 m_data_offset = 0;
   };
 
+  struct ChunkParameters
+  {
+    u64 offset_in_file;
+    u64 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 exception_lists = 0;
+    u32 rvz_packed_size = 0;
+    u64 data_offset = 0;
+  };
+
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    Chunk chunk;
+  };
+
+  struct ReadAheadJob
+  {
+    ChunkParameters parameters;
+    Chunk chunk;
+    bool started = false;
+    bool cancelled = false;
+    bool done = false;
+    bool success = false;
+  };
+
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
   bool Initialize(const std::string& path);
   bool HasDataOverlap() const;
@@ -237,9 +277,14 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
-  Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
-                            WIARVZCompressionType compression_type, u32 exception_lists = 0,
-                            u32 rvz_packed_size = 0, u64 data_offset = 0);
+  // Returns the parameters of a group's chunk, or nothing if the group is all zeroes
+  std::optional<ChunkParameters> GetGroupChunkParameters(const GroupEntry& group, u64 chunk_size,
+                                                         u32 exception_lists,
+                                                         u64 group_offset_in_data) const;
+  Chunk CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const;
+  Chunk& ReadCompressedData(const ChunkParameters& parameters);
+  void StartReadAhead(const ChunkParameters& parameters);
+  void ReadAheadThreadFunction(File::IOFile file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -366,8 +411,29 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+
+  // Decompressed chunks, most recently used first. Interleaved streams (such as streamed audio
+  // alongside level data) would make a single cached chunk get decompressed over and over.
+  std::list<CachedChunk> m_cached_chunks;
+  size_t m_chunk_cache_budget;
+
+  // When groups are read in order, the chunks after the current one are decompressed by a pool of
+  // threads while it is being used. The longer the run of groups read in order, the further ahead
+  // they read, so that a sequential scan (such as verification) decompresses on every core.
+  // Each thread has its own file handle, so that they don't share a file position.
+  bool m_read_ahead_enabled;
+  size_t m_max_read_ahead_chunks = 1;
+  std::vector<std::thread> m_read_ahead_threads;
+  std::mutex m_read_ahead_mutex;
+  std::condition_variable m_read_ahead_queue_cv;
+  std::condition_variable m_read_ahead_done_cv;
+  // Protected by m_read_ahead_mutex.
+  std::deque<std::shared_ptr<ReadAheadJob>> m_read_ahead_queue;
+  bool m_read_ahead_shutdown = false;
+  // Jobs whose chunks haven't been used yet, oldest first.
+  std::deque<std::shared_ptr<ReadAheadJob>> m_read_ahead_jobs;
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  size_t m_sequential_groups = 0;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -8,6 +8,7 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -256,14 +257,65 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
+// Creating a decompression stream allocates its whole workspace, which is a noticeable part of the
+// cost of reading a small chunk, so streams are reused across chunks.
+class ZstdDStreamPool
+{
+public:
+  ~ZstdDStreamPool()
+  {
+    for (ZSTD_DStream* stream : m_streams)
+      ZSTD_freeDStream(stream);
+  }
+
+  ZSTD_DStream* Get()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      if (!m_streams.empty())
+      {
+        ZSTD_DStream* stream = m_streams.back();
+        m_streams.pop_back();
+        return stream;
+      }
+    }
+    return ZSTD_createDStream();
+  }
+
+  void Release(ZSTD_DStream* stream)
+  {
+    if (!stream)
+      return;
+
+    if (!ZSTD_isError(ZSTD_DCtx_reset(stream, ZSTD_reset_session_only)))
+    {
+      std::lock_guard lk(m_mutex);
+      if (m_streams.size() < MAX_STREAMS)
+      {
+        m_streams.push_back(stream);
+        return;
+      }
+    }
+    ZSTD_freeDStream(stream);
+  }
+
+private:
+  static constexpr size_t MAX_STREAMS = 16;
+
+  std::mutex m_mutex;
+  std::vector<ZSTD_DStream*> m_streams;
+};
+
+static ZstdDStreamPool s_zstd_dstream_pool;
+
 ZstdDecompressor::ZstdDecompressor()
 {
-  m_stream = ZSTD_createDStream();
+  m_stream = s_zstd_dstream_pool.Get();
 }
 
 ZstdDecompressor::~ZstdDecompressor()
 {
-  ZSTD_freeDStream(m_stream);
+  s_zstd_dstream_pool.Release(m_stream);
 }
 
 bool ZstdDecompressor::Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/WiiClusterCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/IOS/ES/Formats.h"
+#include "DiscIO/Enums.h"
+#include "DiscIO/Volume.h"
+
+namespace DiscIO
+{
+std::unique_ptr<WiiClusterCache> WiiClusterCache::Open(const Volume& volume,
+                                                       const Partition& partition, u64 max_size)
+{
+  if (volume.GetVolumeType() != Platform::WiiDisc || partition == PARTITION_NONE)
+    return nullptr;
+
+  const IOS::ES::TMDReader& tmd = volume.GetTMD(partition);
+  if (!tmd.IsValid())
+    return nullptr;
+  const std::vector<IOS::ES::Content> contents = tmd.GetContents();
+  if (contents.empty())
+    return nullptr;
+
+  const std::string directory = File::GetUserPath(D_CACHE_IDX) + "WiiClusters/";
+  if (!File::CreateFullPath(directory))
+    return nullptr;
+  const std::string base_path =
+      fmt::format("{}{}_{}", directory, volume.GetGameID(partition),
+                  Common::SHA1::DigestToString(contents[0].sha1));
+
+  const auto open = [](const std::string& path) {
+    File::IOFile file(path, "r+b");
+    if (!file.IsOpen())
+      file.Open(path, "w+b");
+    return file;
+  };
+  File::IOFile data_file = open(base_path + ".bin");
+  File::IOFile index_file = open(base_path + ".idx");
+  if (!data_file.IsOpen() || !index_file.IsOpen())
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to open the cluster cache {}", base_path);
+    return nullptr;
+  }
+
+  // Clusters are written to the data file before their index entries, so entries without data
+  // can only come from a failed write. Drop them, along with any partially written entry.
+  const u64 data_clusters = data_file.GetSize() / CLUSTER_SIZE;
+  u64 entries = std::min(index_file.GetSize() / sizeof(u32), data_clusters);
+  std::vector<u32> index(static_cast<size_t>(entries));
+  if (!index_file.ReadArray(index.data(), index.size()))
+  {
+    index.clear();
+    entries = 0;
+  }
+  if (!index_file.Resize(entries * sizeof(u32)) || !index_file.Seek(0, File::SeekOrigin::End))
+    return nullptr;
+
+  return std::unique_ptr<WiiClusterCache>(
+      new WiiClusterCache(partition, std::move(data_file), std::move(index_file), std::move(index),
+                          max_size / CLUSTER_SIZE));
+}
+
+WiiClusterCache::WiiClusterCache(const Partition& partition, File::IOFile data_file,
+                                 File::IOFile index_file, std::vector<u32> index,
+                                 u64 max_clusters)
+    : m_partition(partition), m_data_file(std::move(data_file)),
+      m_index_file(std::move(index_file)), m_used_slots(static_cast<u32>(index.size())),
+      m_max_clusters(max_clusters), m_buffer(CLUSTER_SIZE)
+{
+  for (u32 slot = 0; slot < index.size(); ++slot)
+    m_slots[index[slot]] = slot;
+}
+
+bool WiiClusterCache::Read(const Volume& volume, u64 offset, u64 length, u8* buffer)
+{
+  while (length > 0)
+  {
+    const u64 cluster = offset / CLUSTER_SIZE;
+    const u64 offset_in_cluster = offset % CLUSTER_SIZE;
+    const u64 bytes_to_copy = std::min(length, CLUSTER_SIZE - offset_in_cluster);
+
+    const auto it = m_slots.find(static_cast<u32>(cluster));
+    if (it == m_slots.end() ||
+        !ReadCachedCluster(it->second, offset_in_cluster, bytes_to_copy, buffer))
+    {
+      if (volume.Read(cluster * CLUSTER_SIZE, CLUSTER_SIZE, m_buffer.data(), m_partition))
+      {
+        std::memcpy(buffer, m_buffer.data() + offset_in_cluster, bytes_to_copy);
+        if (it == m_slots.end())
+          StoreCluster(static_cast<u32>(cluster), m_buffer.data());
+      }
+      else if (!volume.Read(offset, bytes_to_copy, buffer, m_partition))
+      {
+        // The whole cluster can't be read if it's cut off by the end of the partition,
+        // but the requested part of it still might be.
+        return false;
+      }
+    }
+
+    offset += bytes_to_copy;
+    length -= bytes_to_copy;
+    buffer += bytes_to_copy;
+  }
+
+  return true;
+}
+
+bool WiiClusterCache::ReadCachedCluster(u32 slot, u64 offset_in_cluster, u64 length, u8* buffer)
+{
+  return m_data_file.Seek(slot * CLUSTER_SIZE + offset_in_cluster, File::SeekOrigin::Begin) &&
+         m_data_file.ReadBytes(buffer, static_cast<size_t>(length));
+}
+
+void WiiClusterCache::StoreCluster(u32 cluster, const u8* data)
+{
+  if (m_used_slots >= m_max_clusters)
+    return;
+
+  const u32 slot = m_used_slots;
+  if (!m_data_file.Seek(slot * CLUSTER_SIZE, File::SeekOrigin::Begin) ||
+      !m_data_file.WriteBytes(data, CLUSTER_SIZE) || !m_data_file.Flush() ||
+      !m_index_file.WriteArray(&cluster, 1) || !m_index_file.Flush())
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to write to the cluster cache, disabling it");
+    m_max_clusters = 0;
+    return;
+  }
+
+  m_slots[cluster] = slot;
+  ++m_used_slots;
+}
+
+}  // namespace DiscIO
@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace DiscIO
+{
+// A disk-backed cache of decrypted Wii partition data, so that clusters which have been read
+// before can be served without decrypting or decompressing them again.
+//
+// Each partition gets a data file and an index file in the cache directory. They are named after
+// the game ID and the hash of the partition's H3 table (from the TMD), which covers all of the
+// partition's data, so a modified or different disc never gets served stale data. The data file
+// holds one cluster per slot, and the index file holds the cluster index stored in each slot.
+// Once the size limit is reached, no more clusters are added.
+class WiiClusterCache
+{
+public:
+  static constexpr u64 CLUSTER_SIZE = VolumeWii::BLOCK_DATA_SIZE;
+
+  // Returns nullptr if the partition can't be identified or the cache files can't be opened.
+  static std::unique_ptr<WiiClusterCache> Open(const Volume& volume, const Partition& partition,
+                                               u64 max_size);
+
+  // Reads decrypted partition data, using the cache where possible. Clusters that aren't cached
+  // yet are read from the volume and added to the cache.
+  bool Read(const Volume& volume, u64 offset, u64 length, u8* buffer);
+
+private:
+  WiiClusterCache(const Partition& partition, File::IOFile data_file, File::IOFile index_file,
+                  std::vector<u32> index, u64 max_clusters);
+
+  bool ReadCachedCluster(u32 slot, u64 offset_in_cluster, u64 length, u8* buffer);
+  void StoreCluster(u32 cluster, const u8* data);
+
+  Partition m_partition;
+  File::IOFile m_data_file;
+  File::IOFile m_index_file;
+  std::unordered_map<u32, u32> m_slots;
+  u32 m_used_slots;
+  u64 m_max_clusters;
+
+  std::vector<u8> m_buffer;
+};
+
+}  // namespace DiscIO
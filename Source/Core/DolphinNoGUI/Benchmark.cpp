@@ -0,0 +1,609 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Event.h"
+#include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/HookableEvent.h"
+#include "Common/JsonUtil.h"
+#include "Common/PerfCounters.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
+#include "Common/WindowSystemInfo.h"
+
+#include "Core/Boot/Boot.h"
+#include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/Movie.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/System.h"
+
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+namespace Benchmark
+{
+namespace
+{
+constexpr double REPORT_VERSION = 1;
+
+Common::Event s_wakeup_event;
+Common::Flag s_stop_requested;
+
+struct Workload
+{
+  std::string name;
+  std::string path;
+  // The game a movie gets played back in. Empty for FIFO logs.
+  std::string game_path;
+};
+
+// Counters from g_stats, copied on the video thread after each frame.
+struct VideoCounters
+{
+  int pixel_shaders_created = 0;
+  int vertex_shaders_created = 0;
+  int textures_created = 0;
+  int textures_uploaded = 0;
+  int texture_memory_usage_kb = 0;
+  // Summed up over all frames.
+  u64 texture_overlap_candidates = 0;
+  u64 texture_levels_decoded_cpu = 0;
+  u64 texture_levels_decoded_gpu = 0;
+  u64 texture_pool_reuses = 0;
+  u64 efb_copies_to_vram = 0;
+  u64 efb_copies_to_ram = 0;
+};
+
+std::mutex s_frame_mutex;
+std::vector<TimePoint> s_frame_times;
+VideoCounters s_video_counters;
+// The first frame that is measured, and the counters before it. Frames before it are warm-up.
+std::optional<size_t> s_first_measured_frame;
+VideoCounters s_warmup_video_counters;
+// FIFO loops to finish before frames are measured. Always 0 for movies.
+u32 s_warmup_loops = 0;
+
+using ThreadTimes = std::map<std::string, double>;
+
+// CPU time, in seconds, that the threads of this process have used so far, summed up by name.
+ThreadTimes GetThreadCPUTimes()
+{
+  ThreadTimes times;
+#ifdef __linux__
+  const double ticks_per_second = static_cast<double>(sysconf(_SC_CLK_TCK));
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", error))
+  {
+    std::string name;
+    std::string stat;
+    if (!File::ReadFileToString(entry.path().string() + "/comm", name) ||
+        !File::ReadFileToString(entry.path().string() + "/stat", stat))
+    {
+      continue;
+    }
+
+    // The name in the stat line may contain spaces, so the fields are counted from after it.
+    const size_t name_end = stat.rfind(')');
+    if (name_end == std::string::npos)
+      continue;
+    const std::vector<std::string> fields = SplitString(stat.substr(name_end + 2), ' ');
+    // utime and stime are fields 14 and 15, the first field after the name being field 3.
+    if (fields.size() < 13)
+      continue;
+
+    u64 user_ticks = 0;
+    u64 system_ticks = 0;
+    if (!TryParse(fields[11], &user_ticks) || !TryParse(fields[12], &system_ticks))
+      continue;
+    times[std::string(StripWhitespace(name))] += (user_ticks + system_ticks) / ticks_per_second;
+  }
+#endif
+  return times;
+}
+
+std::string GetLowerCaseExtension(const std::filesystem::path& path)
+{
+  std::string extension = PathToString(path.extension());
+  Common::ToLower(&extension);
+  return extension;
+}
+
+std::vector<Workload> FindWorkloads(const std::string& directory)
+{
+  std::vector<std::filesystem::path> paths;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(StringToPath(directory), error))
+  {
+    if (entry.is_regular_file(error))
+      paths.push_back(entry.path());
+  }
+  std::sort(paths.begin(), paths.end());
+
+  std::vector<Workload> workloads;
+  for (const std::filesystem::path& path : paths)
+  {
+    const std::string extension = GetLowerCaseExtension(path);
+    if (extension == ".dff")
+    {
+      workloads.push_back({PathToString(path.filename()), PathToString(path), {}});
+    }
+    else if (extension == ".dtm")
+    {
+      const auto game = std::find_if(paths.begin(), paths.end(), [&](const auto& other) {
+        const std::string other_extension = GetLowerCaseExtension(other);
+        return other.stem() == path.stem() && other_extension != ".dtm" &&
+               other_extension != ".sav" && other_extension != ".json";
+      });
+      if (game == paths.end())
+      {
+        fmt::print(stderr, "Skipping {}: no game with the same name found\n",
+                   PathToString(path.filename()));
+        continue;
+      }
+      workloads.push_back({PathToString(path.filename()), PathToString(path), PathToString(*game)});
+    }
+  }
+  return workloads;
+}
+
+double GetPercentile(const std::vector<double>& sorted_values, double fraction)
+{
+  if (sorted_values.empty())
+    return 0;
+  const size_t index = static_cast<size_t>(fraction * (sorted_values.size() - 1) + 0.5);
+  return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+
+// Hardware counter totals over the measured part of the run, per thread.
+picojson::object GetPerfCounterDeltas(const std::vector<Common::PerfCounters::ThreadValues>& start,
+                                      const std::vector<Common::PerfCounters::ThreadValues>& end)
+{
+  using namespace Common::PerfCounters;
+
+  picojson::object threads;
+  for (const ThreadValues& thread : end)
+  {
+    const auto thread_start = std::ranges::find(start, thread.thread_name,
+                                                &ThreadValues::thread_name);
+    if (thread_start == start.end())
+      continue;
+
+    picojson::object counters;
+    for (size_t i = 0; i < NUM_COUNTERS; ++i)
+    {
+      if (!thread.values[i] || !thread_start->values[i])
+        continue;
+      counters[GetCounterName(static_cast<Counter>(i))] =
+          picojson::value(static_cast<double>(*thread.values[i] - *thread_start->values[i]));
+    }
+    if (counters.empty())
+      continue;
+
+    const auto instructions =
+        ReadNumericFromJson<double>(counters, GetCounterName(Counter::Instructions));
+    const auto cycles = ReadNumericFromJson<double>(counters, GetCounterName(Counter::Cycles));
+    if (instructions && cycles && *cycles > 0)
+      counters["ipc"] = picojson::value(*instructions / *cycles);
+
+    threads[thread.thread_name] = picojson::value(std::move(counters));
+  }
+  return threads;
+}
+
+picojson::object RunWorkload(const Workload& workload, const Options& options,
+                             const WindowSystemInfo& wsi)
+{
+  picojson::object result;
+  result["name"] = picojson::value(workload.name);
+  result["type"] = picojson::value(workload.game_path.empty() ? "fifo" : "movie");
+
+  const auto fail = [&](std::string_view error) {
+    fmt::print(stderr, "{}: {}\n", workload.name, error);
+    result["status"] = picojson::value(std::string(error));
+    return result;
+  };
+
+  Core::System& system = Core::System::GetInstance();
+
+  {
+    std::lock_guard lk(s_frame_mutex);
+    s_frame_times.clear();
+    s_video_counters = {};
+    s_first_measured_frame.reset();
+    s_warmup_video_counters = {};
+    s_warmup_loops = workload.game_path.empty() ? options.warmup_loops : 0;
+  }
+  s_stop_requested.Clear();
+
+  std::unique_ptr<BootParameters> boot;
+  if (workload.game_path.empty())
+  {
+    boot = BootParameters::GenerateFromFile(workload.path);
+  }
+  else
+  {
+    std::optional<std::string> savestate_path;
+    if (!system.GetMovie().PlayInput(workload.path, &savestate_path))
+      return fail("failed to load movie");
+    boot = BootParameters::GenerateFromFile(
+        workload.game_path, BootSessionData(savestate_path, DeleteSavestateAfterBoot::No));
+  }
+  if (!boot)
+    return fail("failed to load");
+
+  // Run as fast as possible, and make sure that every workload comes to an end. The current run
+  // layer is cleared when emulation stops, so this has to be done for each workload.
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  const u32 fifo_loops = options.warmup_loops + std::max(options.fifo_loops, 1u);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, fifo_loops > 1);
+  Config::SetCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, false);
+
+  const TimePoint boot_time = Clock::now();
+  if (!BootManager::BootCore(system, std::move(boot), wsi))
+    return fail("failed to boot");
+
+  std::string status = "ok";
+  std::optional<TimePoint> start_time;
+  ThreadTimes start_thread_times;
+  std::vector<Common::PerfCounters::ThreadValues> start_perf_counters;
+  std::vector<Common::PerfCounters::ThreadValues> end_perf_counters;
+  u64 frames_at_start = 0;
+  u64 jit_blocks_compiled = 0;
+  u64 jit_blocks_invalidated = 0;
+  u64 jit_evictions = 0;
+  while (true)
+  {
+    Core::HostDispatchJobs(system);
+    if (Core::IsUninitialized(system))
+      break;
+
+    size_t frame_count;
+    bool measuring;
+    {
+      std::lock_guard lk(s_frame_mutex);
+      frame_count = s_frame_times.size();
+      measuring = s_first_measured_frame.has_value();
+    }
+
+    // Measure from the first frame after warming up on, so that booting isn't part of the
+    // results.
+    if (!start_time && measuring)
+    {
+      start_time = Clock::now();
+      start_thread_times = GetThreadCPUTimes();
+      start_perf_counters = Common::PerfCounters::Read();
+      frames_at_start = frame_count;
+    }
+
+    bool finished = s_stop_requested.IsSet();
+    if (!workload.game_path.empty() && Core::IsRunning(system) &&
+        !system.GetMovie().IsPlayingInput())
+    {
+      finished = true;
+    }
+    if (workload.game_path.empty() && fifo_loops > 1 &&
+        system.GetFifoPlayer().GetLoopCount() >= fifo_loops)
+    {
+      finished = true;
+    }
+    if (options.max_frames != 0 && frame_count >= options.max_frames)
+      finished = true;
+    if (DT_s(Clock::now() - boot_time).count() > options.timeout_seconds)
+    {
+      status = "timeout";
+      finished = true;
+    }
+
+    if (finished && Core::IsRunning(system))
+    {
+      {
+        const Core::CPUThreadGuard guard(system);
+        jit_blocks_compiled = system.GetJitInterface().GetCompiledBlockCount();
+        jit_blocks_invalidated = system.GetJitInterface().GetInvalidatedBlockCount();
+        jit_evictions = system.GetJitInterface().GetEvictionCount();
+      }
+      // The emulation threads stop counting once they exit.
+      end_perf_counters = Common::PerfCounters::Read();
+      Core::Stop(system);
+    }
+    else if (finished)
+    {
+      Core::Stop(system);
+    }
+
+    s_wakeup_event.WaitFor(std::chrono::milliseconds(10));
+  }
+  Core::Shutdown(system);
+
+  if (system.GetMovie().IsMovieActive())
+    system.GetMovie().EndPlayInput(false);
+
+  const TimePoint end_time = Clock::now();
+  const ThreadTimes end_thread_times = GetThreadCPUTimes();
+
+  std::vector<TimePoint> frame_times;
+  VideoCounters video_counters;
+  VideoCounters warmup_video_counters;
+  size_t first_measured_frame = 0;
+  {
+    std::lock_guard lk(s_frame_mutex);
+    frame_times = s_frame_times;
+    video_counters = s_video_counters;
+    warmup_video_counters = s_warmup_video_counters;
+    first_measured_frame = s_first_measured_frame.value_or(frame_times.size());
+  }
+
+  if (frame_times.size() < first_measured_frame + 2 || !start_time)
+    return fail(status == "ok" ? "no frames were presented" : status);
+
+  std::vector<double> frame_ms;
+  frame_ms.reserve(frame_times.size() - first_measured_frame - 1);
+  for (size_t i = first_measured_frame + 1; i < frame_times.size(); ++i)
+    frame_ms.push_back(DT_ms(frame_times[i] - frame_times[i - 1]).count());
+  std::sort(frame_ms.begin(), frame_ms.end());
+
+  double total_ms = 0;
+  for (const double ms : frame_ms)
+    total_ms += ms;
+
+  picojson::object frame_time;
+  frame_time["mean"] = picojson::value(total_ms / frame_ms.size());
+  frame_time["p50"] = picojson::value(GetPercentile(frame_ms, 0.5));
+  frame_time["p90"] = picojson::value(GetPercentile(frame_ms, 0.9));
+  frame_time["p99"] = picojson::value(GetPercentile(frame_ms, 0.99));
+  frame_time["max"] = picojson::value(frame_ms.back());
+
+  const double measured_seconds = DT_s(end_time - *start_time).count();
+  picojson::object threads;
+  for (const auto& [name, seconds] : end_thread_times)
+  {
+    const auto it = start_thread_times.find(name);
+    const double used = seconds - (it != start_thread_times.end() ? it->second : 0.0);
+    if (measured_seconds > 0 && used > 0)
+      threads[name] = picojson::value(used / measured_seconds);
+  }
+
+  picojson::object jit;
+  jit["blocks_compiled"] = picojson::value(static_cast<double>(jit_blocks_compiled));
+  jit["blocks_invalidated"] = picojson::value(static_cast<double>(jit_blocks_invalidated));
+  jit["evictions"] = picojson::value(static_cast<double>(jit_evictions));
+
+  picojson::object shaders;
+  shaders["pixel_shaders_created"] =
+      picojson::value(static_cast<double>(video_counters.pixel_shaders_created));
+  shaders["vertex_shaders_created"] =
+      picojson::value(static_cast<double>(video_counters.vertex_shaders_created));
+  shaders["created_after_warmup"] = picojson::value(static_cast<double>(
+      video_counters.pixel_shaders_created - warmup_video_counters.pixel_shaders_created +
+      video_counters.vertex_shaders_created - warmup_video_counters.vertex_shaders_created));
+
+  picojson::object textures;
+  textures["created"] = picojson::value(static_cast<double>(video_counters.textures_created));
+  textures["uploaded"] = picojson::value(static_cast<double>(video_counters.textures_uploaded));
+  textures["memory_usage_kb"] =
+      picojson::value(static_cast<double>(video_counters.texture_memory_usage_kb));
+  textures["overlap_candidates"] =
+      picojson::value(static_cast<double>(video_counters.texture_overlap_candidates));
+  textures["uploaded_after_warmup"] = picojson::value(static_cast<double>(
+      video_counters.textures_uploaded - warmup_video_counters.textures_uploaded));
+  textures["levels_decoded_cpu"] =
+      picojson::value(static_cast<double>(video_counters.texture_levels_decoded_cpu));
+  textures["levels_decoded_gpu"] =
+      picojson::value(static_cast<double>(video_counters.texture_levels_decoded_gpu));
+  textures["pool_reuses"] =
+      picojson::value(static_cast<double>(video_counters.texture_pool_reuses));
+
+  picojson::object efb_copies;
+  efb_copies["to_vram"] = picojson::value(static_cast<double>(video_counters.efb_copies_to_vram));
+  efb_copies["to_ram"] = picojson::value(static_cast<double>(video_counters.efb_copies_to_ram));
+
+  result["status"] = picojson::value(status);
+  if (workload.game_path.empty() && fifo_loops > 1)
+  {
+    result["loops"] = picojson::value(static_cast<double>(options.fifo_loops));
+    result["warmup_loops"] = picojson::value(static_cast<double>(options.warmup_loops));
+  }
+  result["frames"] = picojson::value(static_cast<double>(frame_times.size() - frames_at_start));
+  result["boot_seconds"] = picojson::value(DT_s(*start_time - boot_time).count());
+  result["run_seconds"] = picojson::value(measured_seconds);
+  result["frame_time_ms"] = picojson::value(std::move(frame_time));
+  result["thread_utilization"] = picojson::value(std::move(threads));
+  result["jit"] = picojson::value(std::move(jit));
+  if (!end_perf_counters.empty())
+  {
+    result["perf_counters"] =
+        picojson::value(GetPerfCounterDeltas(start_perf_counters, end_perf_counters));
+  }
+  result["shaders"] = picojson::value(std::move(shaders));
+  result["textures"] = picojson::value(std::move(textures));
+  result["efb_copies"] = picojson::value(std::move(efb_copies));
+
+  fmt::print(stderr, "{}: {} frames, mean {:.2f} ms, p99 {:.2f} ms\n", workload.name,
+             frame_ms.size(), total_ms / frame_ms.size(), GetPercentile(frame_ms, 0.99));
+  return result;
+}
+
+std::optional<double> GetFrameTime(const picojson::object& workload, const std::string& key)
+{
+  const auto it = workload.find("frame_time_ms");
+  if (it == workload.end() || !it->second.is<picojson::object>())
+    return std::nullopt;
+  return ReadNumericFromJson<double>(it->second.get<picojson::object>(), key);
+}
+
+// Adds a comparison with the same workload in the baseline to each result. Returns false if any
+// workload got slower by more than the tolerance.
+bool CompareWithBaseline(picojson::array* workloads, const picojson::value& baseline,
+                         double tolerance)
+{
+  std::map<std::string, const picojson::object*> baseline_workloads;
+  if (baseline.contains("workloads") && baseline.get("workloads").is<picojson::array>())
+  {
+    for (const picojson::value& workload : baseline.get("workloads").get<picojson::array>())
+    {
+      if (!workload.is<picojson::object>())
+        continue;
+      const picojson::object& object = workload.get<picojson::object>();
+      if (const std::optional<std::string> name = ReadStringFromJson(object, "name"))
+        baseline_workloads[*name] = &object;
+    }
+  }
+
+  bool passed = true;
+  for (picojson::value& value : *workloads)
+  {
+    picojson::object& workload = value.get<picojson::object>();
+    const auto it = baseline_workloads.find(*ReadStringFromJson(workload, "name"));
+    if (it == baseline_workloads.end())
+      continue;
+
+    picojson::object comparison;
+    bool regressed = false;
+    for (const char* key : {"mean", "p99"})
+    {
+      const std::optional<double> current = GetFrameTime(workload, key);
+      const std::optional<double> previous = GetFrameTime(*it->second, key);
+      if (!current || !previous || *previous <= 0)
+        continue;
+
+      const double change = *current / *previous - 1;
+      comparison[fmt::format("{}_change", key)] = picojson::value(change);
+      if (change > tolerance)
+      {
+        fmt::print(stderr, "{}: {} frame time regressed by {:.1f}% ({:.2f} ms -> {:.2f} ms)\n",
+                   it->first, key, change * 100, *previous, *current);
+        regressed = true;
+      }
+    }
+    comparison["regressed"] = picojson::value(regressed);
+    workload["baseline"] = picojson::value(std::move(comparison));
+    passed &= !regressed;
+  }
+  return passed;
+}
+}  // namespace
+
+int Run(const Options& options, const WindowSystemInfo& wsi)
+{
+  const std::vector<Workload> workloads = FindWorkloads(options.workload_directory);
+  if (workloads.empty())
+  {
+    fmt::print(stderr, "No FIFO logs or movies found in {}\n", options.workload_directory);
+    return 1;
+  }
+
+  std::optional<picojson::value> baseline;
+  if (!options.baseline_path.empty())
+  {
+    std::string error;
+    baseline.emplace();
+    if (!JsonFromFile(options.baseline_path, &*baseline, &error))
+    {
+      fmt::print(stderr, "Failed to read the baseline {}: {}\n", options.baseline_path, error);
+      return 1;
+    }
+  }
+
+  Common::PerfCounters::Enable();
+  Common::ScopeGuard perf_counter_guard([] { Common::PerfCounters::Disable(); });
+
+  const Common::EventHook frame_hook = AfterPresentEvent::Register(
+      [](const PresentInfo&) {
+        std::lock_guard lk(s_frame_mutex);
+        s_frame_times.push_back(Clock::now());
+        const auto& this_frame = g_stats.this_frame;
+        const VideoCounters last = s_video_counters;
+        s_video_counters = {
+            .pixel_shaders_created = g_stats.num_pixel_shaders_created,
+            .vertex_shaders_created = g_stats.num_vertex_shaders_created,
+            .textures_created = g_stats.num_textures_created,
+            .textures_uploaded = g_stats.num_textures_uploaded,
+            .texture_memory_usage_kb = g_stats.texture_memory_usage_kb,
+            .texture_overlap_candidates =
+                last.texture_overlap_candidates + this_frame.num_texture_overlap_candidates,
+            .texture_levels_decoded_cpu =
+                last.texture_levels_decoded_cpu + this_frame.num_texture_levels_decoded_cpu,
+            .texture_levels_decoded_gpu =
+                last.texture_levels_decoded_gpu + this_frame.num_texture_levels_decoded_gpu,
+            .texture_pool_reuses = last.texture_pool_reuses + this_frame.num_texture_pool_reuses,
+            .efb_copies_to_vram = last.efb_copies_to_vram + this_frame.num_efb_copies_to_vram,
+            .efb_copies_to_ram = last.efb_copies_to_ram + this_frame.num_efb_copies_to_ram,
+        };
+
+        // In dual core, the CPU thread can already be a frame into the next loop.
+        if (!s_first_measured_frame &&
+            (s_warmup_loops == 0 ||
+             Core::System::GetInstance().GetFifoPlayer().GetLoopCount() >= s_warmup_loops))
+        {
+          s_first_measured_frame = s_frame_times.size() - 1;
+          s_warmup_video_counters = s_video_counters;
+        }
+      },
+      "Benchmark");
+
+  bool passed = true;
+  picojson::array results;
+  for (const Workload& workload : workloads)
+  {
+    picojson::object result = RunWorkload(workload, options, wsi);
+    passed &= ReadStringFromJson(result, "status") == "ok";
+    results.emplace_back(std::move(result));
+  }
+
+  if (baseline)
+    passed &= CompareWithBaseline(&results, *baseline, options.tolerance);
+
+  picojson::object report;
+  report["version"] = picojson::value(REPORT_VERSION);
+  report["workloads"] = picojson::value(std::move(results));
+  const picojson::value root(std::move(report));
+
+  if (options.output_path.empty())
+  {
+    fmt::print("{}\n", root.serialize(true));
+  }
+  else if (!JsonToFile(options.output_path, root, true))
+  {
+    fmt::print(stderr, "Failed to write {}\n", options.output_path);
+    return 1;
+  }
+
+  return passed ? 0 : 1;
+}
+
+void WakeUp()
+{
+  s_wakeup_event.Set();
+}
+
+void RequestStop()
+{
+  s_stop_requested.Set();
+  s_wakeup_event.Set();
+}
+}  // namespace Benchmark
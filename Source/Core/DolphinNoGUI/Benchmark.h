@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+struct WindowSystemInfo;
+
+// Replays a directory of workloads headlessly and reports how fast they ran.
+//
+// A workload is either a FIFO log (.dff), or a movie (.dtm) next to the game it was recorded
+// with, using the same name (e.g. Game.dtm and Game.rvz). Each one runs unthrottled until it ends.
+namespace Benchmark
+{
+struct Options
+{
+  std::string workload_directory;
+  // Where to write the JSON report. Printed to stdout if empty.
+  std::string output_path;
+  // Report of an earlier run to compare against. Slower frame times than in it by more than
+  // tolerance (as a fraction) count as a regression.
+  std::string baseline_path;
+  double tolerance = 0.05;
+  // Workloads that take longer than this are stopped and count as failed.
+  double timeout_seconds = 600;
+  // Stops every workload after this many frames, unless it is 0.
+  u32 max_frames = 0;
+  // Plays FIFO logs this many times over instead of once, unless it is 0.
+  u32 fifo_loops = 0;
+  // Runs FIFO logs this many extra times before measuring, so that shaders and textures are
+  // already cached and the results show the backend on its own.
+  u32 warmup_loops = 0;
+};
+
+// Returns the exit code for the process: non-zero if a workload failed or regressed.
+int Run(const Options& options, const WindowSystemInfo& wsi);
+
+// Host callbacks: host jobs have been queued, or emulation asks to be stopped.
+void WakeUp();
+void RequestStop();
+}  // namespace Benchmark
@@ -0,0 +1,232 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/Benchmark.h"
+
+#include <OptionParser.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include "Common/MsgHandler.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
+#include "Common/WindowSystemInfo.h"
+
+#include "Core/Core.h"
+#include "Core/Host.h"
+
+#include "UICommon/CommandLineParse.h"
+#include "UICommon/UICommon.h"
+
+// Begin stubs needed to satisfy Core dependencies
+
+std::vector<std::string> Host_GetPreferredLocales()
+{
+  return {};
+}
+
+void Host_PPCSymbolsChanged()
+{
+}
+
+void Host_PPCBreakpointsChanged()
+{
+}
+
+void Host_RefreshDSPDebuggerWindow()
+{
+}
+
+bool Host_UIBlocksControllerState()
+{
+  return false;
+}
+
+void Host_Message(HostMessageID id)
+{
+  if (id == HostMessageID::WMUserStop)
+    Benchmark::RequestStop();
+  else if (id == HostMessageID::WMUserJobDispatch)
+    Benchmark::WakeUp();
+}
+
+void Host_UpdateTitle(const std::string& title)
+{
+}
+
+void Host_UpdateDiscordClientID(const std::string& client_id)
+{
+}
+
+bool Host_UpdateDiscordPresenceRaw(const std::string& details, const std::string& state,
+                                   const std::string& large_image_key,
+                                   const std::string& large_image_text,
+                                   const std::string& small_image_key,
+                                   const std::string& small_image_text,
+                                   const int64_t start_timestamp, const int64_t end_timestamp,
+                                   const int party_size, const int party_max)
+{
+  return false;
+}
+
+void Host_UpdateDisasmDialog()
+{
+}
+
+void Host_JitCacheInvalidation()
+{
+}
+
+void Host_JitProfileDataWiped()
+{
+}
+
+void Host_UpdateMainFrame()
+{
+}
+
+void Host_RequestRenderWindowSize(int width, int height)
+{
+}
+
+bool Host_RendererHasFocus()
+{
+  return false;
+}
+
+bool Host_RendererHasFullFocus()
+{
+  return false;
+}
+
+bool Host_RendererIsFullscreen()
+{
+  return false;
+}
+
+bool Host_TASInputHasFocus()
+{
+  return false;
+}
+
+void Host_YieldToUI()
+{
+}
+
+void Host_TitleChanged()
+{
+}
+
+std::unique_ptr<GBAHostInterface> Host_CreateGBAHost(std::weak_ptr<HW::GBA::Core> core)
+{
+  return nullptr;
+}
+// End stubs to satisfy Core dependencies
+
+#ifdef _WIN32
+#define main app_main
+#endif
+
+int main(int argc, char* argv[])
+{
+  Core::DeclareAsHostThread();
+
+  auto parser = CommandLineParse::CreateParser(CommandLineParse::ParserOptions::OmitGUIOptions);
+  parser->usage("usage: %prog [options]... DIRECTORY");
+  parser->add_option("-o", "--output")
+      .action("store")
+      .help("Write the JSON report to FILE instead of stdout")
+      .metavar("FILE");
+  parser->add_option("--baseline")
+      .action("store")
+      .help("Compare against the report of an earlier run, and fail on regressions")
+      .metavar("FILE");
+  parser->add_option("--tolerance")
+      .type("double")
+      .action("store")
+      .help("How much slower than the baseline a workload may get, as a fraction "
+            "[default: %default]")
+      .set_default(0.05);
+  parser->add_option("--timeout")
+      .type("double")
+      .action("store")
+      .help("Seconds after which a workload is stopped and fails [default: %default]")
+      .set_default(600);
+  parser->add_option("--max-frames")
+      .type("int")
+      .action("store")
+      .help("Stop every workload after this many frames");
+  parser->add_option("--loops")
+      .type("int")
+      .action("store")
+      .help("Play FIFO logs this many times over");
+  parser->add_option("--warmup-loops")
+      .type("int")
+      .action("store")
+      .help("Play FIFO logs this many extra times before measuring");
+
+  optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
+  const std::vector<std::string> args = parser->args();
+  if (args.size() != 1)
+  {
+    parser->print_help();
+    return 1;
+  }
+
+  Benchmark::Options benchmark_options;
+  benchmark_options.workload_directory = args.front();
+  if (options.is_set("output"))
+    benchmark_options.output_path = static_cast<const char*>(options.get("output"));
+  if (options.is_set("baseline"))
+    benchmark_options.baseline_path = static_cast<const char*>(options.get("baseline"));
+  benchmark_options.tolerance = static_cast<double>(options.get("tolerance"));
+  benchmark_options.timeout_seconds = static_cast<double>(options.get("timeout"));
+  if (options.is_set("max_frames"))
+    benchmark_options.max_frames = static_cast<unsigned int>(options.get("max_frames"));
+  if (options.is_set("loops"))
+    benchmark_options.fifo_loops = static_cast<unsigned int>(options.get("loops"));
+  if (options.is_set("warmup_loops"))
+    benchmark_options.warmup_loops = static_cast<unsigned int>(options.get("warmup_loops"));
+
+  std::string user_directory;
+  if (options.is_set("user"))
+    user_directory = static_cast<const char*>(options.get("user"));
+
+  WindowSystemInfo wsi;
+  wsi.type = WindowSystemType::Headless;
+
+  UICommon::SetUserDirectory(user_directory);
+  UICommon::Init();
+  UICommon::InitControllers(wsi);
+
+  Common::ScopeGuard ui_common_guard([] {
+    UICommon::ShutdownControllers();
+    UICommon::Shutdown();
+  });
+
+  // Nobody is around to dismiss a panic alert, so log them instead of waiting forever.
+  Common::SetEnableAlert(false);
+
+  return Benchmark::Run(benchmark_options, wsi);
+}
+
+#ifdef _WIN32
+int wmain(int, wchar_t*[], wchar_t*[])
+{
+  std::vector<std::string> args = Common::CommandLineToUtf8Argv(GetCommandLineW());
+  const int argc = static_cast<int>(args.size());
+  std::vector<char*> argv(args.size());
+  for (size_t i = 0; i < args.size(); ++i)
+    argv[i] = args[i].data();
+
+  return main(argc, argv.data());
+}
+
+#undef main
+#endif
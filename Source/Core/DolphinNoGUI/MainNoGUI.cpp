@@ -79,6 +79,8 @@ void Host_Message(HostMessageID id)
 {
   if (id == HostMessageID::WMUserStop)
     s_platform->Stop();
+  else if (id == HostMessageID::WMUserJobDispatch)
+    s_platform->WakeUp();
 }
 
 void Host_UpdateTitle(const std::string& title)
@@ -177,6 +179,11 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
     return Platform::CreateX11Platform();
 #endif
 
+#if HAVE_DRM
+  if (platform_name == "drm")
+    return Platform::CreateDRMPlatform();
+#endif
+
 #ifdef __linux__
   if (platform_name == "fbdev" || platform_name.empty())
     return Platform::CreateFBDevPlatform();
@@ -215,6 +222,10 @@ int main(int argc, char* argv[])
             ,
             "fbdev"
 #endif
+#if HAVE_DRM
+            ,
+            "drm"
+#endif
 #if HAVE_X11
             ,
             "x11"
@@ -3,13 +3,55 @@
 
 #include "DolphinNoGUI/Platform.h"
 
+#ifndef _WIN32
+#include <cerrno>
+#include <chrono>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+#include "Common/CommonTypes.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/STM/STM.h"
 #include "Core/State.h"
 #include "Core/System.h"
 
-Platform::~Platform() = default;
+Platform::Platform()
+{
+#if defined(__linux__)
+  m_wakeup_read_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  m_wakeup_write_fd = m_wakeup_read_fd;
+#elif !defined(_WIN32)
+  int fds[2];
+  if (pipe(fds) == 0)
+  {
+    for (const int fd : fds)
+    {
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+      fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    m_wakeup_read_fd = fds[0];
+    m_wakeup_write_fd = fds[1];
+  }
+#endif
+}
+
+Platform::~Platform()
+{
+#ifndef _WIN32
+  if (m_wakeup_write_fd != m_wakeup_read_fd && m_wakeup_write_fd >= 0)
+    close(m_wakeup_write_fd);
+  if (m_wakeup_read_fd >= 0)
+    close(m_wakeup_read_fd);
+#endif
+}
 
 bool Platform::Init()
 {
@@ -43,9 +85,50 @@ void Platform::UpdateRunningFlag()
 void Platform::Stop()
 {
   m_running.Clear();
+  WakeUp();
 }
 
 void Platform::RequestShutdown()
 {
   m_shutdown_requested.Set();
+  WakeUp();
+}
+
+void Platform::WakeUp()
+{
+#ifdef _WIN32
+  m_wakeup_event.Set();
+#else
+  // Only async-signal-safe functions can be used here. Writes to an eventfd must be 8 bytes.
+  const u64 value = 1;
+  const size_t size = m_wakeup_write_fd == m_wakeup_read_fd ? sizeof(value) : 1;
+  if (write(m_wakeup_write_fd, &value, size) < 0)
+  {
+  }
+#endif
+}
+
+void Platform::WaitForWakeUp(int fd)
+{
+#ifdef _WIN32
+  m_wakeup_event.Wait();
+#else
+  if (m_wakeup_read_fd < 0)
+  {
+    // Without a way to be woken up, fall back to polling.
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return;
+  }
+
+  pollfd fds[2] = {{m_wakeup_read_fd, POLLIN, 0}, {fd, POLLIN, 0}};
+  while (poll(fds, fd >= 0 ? 2 : 1, -1) < 0 && errno == EINTR)
+  {
+    // Interrupted by a signal. If it requested a shutdown, the wakeup fd is readable by now.
+  }
+
+  u64 value;
+  while (read(m_wakeup_read_fd, &value, sizeof(value)) > 0)
+  {
+  }
+#endif
 }
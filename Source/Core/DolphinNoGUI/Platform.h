@@ -6,12 +6,14 @@
 #include <memory>
 #include <string>
 
+#include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/WindowSystemInfo.h"
 
 class Platform
 {
 public:
+  Platform();
   virtual ~Platform();
 
   bool IsRunning() const { return m_running.IsSet(); }
@@ -30,6 +32,10 @@ public:
   // Request an immediate shutdown.
   void Stop();
 
+  // Wakes up the main loop, e.g. because host jobs have been queued. Outside of Windows, this is
+  // safe to call from a signal handler.
+  void WakeUp();
+
   static std::unique_ptr<Platform> CreateHeadlessPlatform();
 #ifdef HAVE_X11
   static std::unique_ptr<Platform> CreateX11Platform();
@@ -39,6 +45,10 @@ public:
   static std::unique_ptr<Platform> CreateFBDevPlatform();
 #endif
 
+#if HAVE_DRM
+  static std::unique_ptr<Platform> CreateDRMPlatform();
+#endif
+
 #ifdef _WIN32
   static std::unique_ptr<Platform> CreateWin32Platform();
 #endif
@@ -50,10 +60,21 @@ public:
 protected:
   void UpdateRunningFlag();
 
+  // Blocks until WakeUp is called or, if it isn't -1, until fd becomes readable.
+  void WaitForWakeUp(int fd = -1);
+
   Common::Flag m_running{true};
   Common::Flag m_shutdown_requested{false};
   Common::Flag m_tried_graceful_shutdown{false};
 
+#ifdef _WIN32
+  Common::Event m_wakeup_event;
+#else
+  // An eventfd on Linux, and the two ends of a pipe elsewhere.
+  int m_wakeup_read_fd = -1;
+  int m_wakeup_write_fd = -1;
+#endif
+
   bool m_window_focus = true;  // Should be made atomic if actually implemented
   bool m_window_fullscreen = false;
 };
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/Platform.h"
+
+#include <cstdio>
+#include <memory>
+
+#include "Common/DRMDisplay.h"
+#include "Core/Core.h"
+#include "Core/System.h"
+
+namespace
+{
+class PlatformDRM : public Platform
+{
+public:
+  bool Init() override;
+  void SetTitle(const std::string& title) override;
+  void MainLoop() override;
+
+  WindowSystemInfo GetWindowSystemInfo() const override;
+
+private:
+  std::unique_ptr<Common::DRMDisplay> m_display;
+};
+
+bool PlatformDRM::Init()
+{
+  m_display = Common::DRMDisplay::Create();
+  if (!m_display)
+  {
+    std::fprintf(stderr, "Failed to open a DRM device with a connected display\n");
+    return false;
+  }
+
+  m_window_fullscreen = true;
+  return true;
+}
+
+void PlatformDRM::SetTitle(const std::string& title)
+{
+  std::fprintf(stdout, "%s\n", title.c_str());
+}
+
+void PlatformDRM::MainLoop()
+{
+  while (true)
+  {
+    UpdateRunningFlag();
+    Core::HostDispatchJobs(Core::System::GetInstance());
+    if (!IsRunning())
+      break;
+
+    WaitForWakeUp();
+  }
+}
+
+WindowSystemInfo PlatformDRM::GetWindowSystemInfo() const
+{
+  WindowSystemInfo wsi;
+  wsi.type = WindowSystemType::DRM;
+  wsi.display_connection = m_display.get();
+  wsi.render_window = nullptr;
+  wsi.render_surface = nullptr;
+  return wsi;
+}
+}  // namespace
+
+std::unique_ptr<Platform> Platform::CreateDRMPlatform()
+{
+  return std::make_unique<PlatformDRM>();
+}
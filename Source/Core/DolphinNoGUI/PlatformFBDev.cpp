@@ -13,7 +13,6 @@
 
 #include <climits>
 #include <cstdio>
-#include <thread>
 
 #include <fcntl.h>
 #include <linux/fb.h>
@@ -76,13 +75,15 @@ void PlatformFBDev::SetTitle(const std::string& string)
 
 void PlatformFBDev::MainLoop()
 {
-  while (IsRunning())
+  while (true)
   {
     UpdateRunningFlag();
     Core::HostDispatchJobs(Core::System::GetInstance());
+    if (!IsRunning())
+      break;
 
-    // TODO: Is this sleep appropriate?
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Host jobs, stop requests and signals all wake us up, so there is no need to poll.
+    WaitForWakeUp();
   }
 }
 
@@ -2,7 +2,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstdio>
-#include <thread>
 
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -26,11 +25,14 @@ void PlatformHeadless::SetTitle(const std::string& title)
 
 void PlatformHeadless::MainLoop()
 {
-  while (m_running.IsSet())
+  while (true)
   {
     UpdateRunningFlag();
     Core::HostDispatchJobs(Core::System::GetInstance());
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (!IsRunning())
+      break;
+
+    WaitForWakeUp();
   }
 }
 
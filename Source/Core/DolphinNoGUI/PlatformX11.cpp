@@ -20,7 +20,6 @@ static constexpr auto X_None = None;
 #include <climits>
 #include <cstdio>
 #include <cstring>
-#include <thread>
 
 #include <X11/Xatom.h>
 #include <X11/Xlib.h>
@@ -150,15 +149,18 @@ void PlatformX11::SetTitle(const std::string& string)
 
 void PlatformX11::MainLoop()
 {
-  while (IsRunning())
+  while (true)
   {
     UpdateRunningFlag();
     Core::HostDispatchJobs(Core::System::GetInstance());
     ProcessEvents();
     UpdateWindowPosition();
+    if (!IsRunning())
+      break;
 
-    // TODO: Is this sleep appropriate?
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Events that Xlib has already read from the connection would not wake us up.
+    if (XEventsQueued(m_display, QueuedAfterFlush) == 0)
+      WaitForWakeUp(ConnectionNumber(m_display));
   }
 }
 
@@ -59,6 +59,9 @@ void AdvancedWidget::CreateWidgets()
   m_show_ftimes = new ConfigBool(tr("Show Frame Times"), Config::GFX_SHOW_FTIMES);
   m_show_vps = new ConfigBool(tr("Show VPS"), Config::GFX_SHOW_VPS);
   m_show_vtimes = new ConfigBool(tr("Show VBlank Times"), Config::GFX_SHOW_VTIMES);
+  m_show_frame_pacing = new ConfigBool(tr("Show Frame Pacing"), Config::GFX_SHOW_FRAME_PACING);
+  m_show_perf_counters =
+      new ConfigBool(tr("Show Hardware Counters"), Config::GFX_SHOW_PERF_COUNTERS);
   m_show_graphs = new ConfigBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS);
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED);
   m_show_speed_colors = new ConfigBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS);
@@ -77,6 +80,8 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_frame_pacing, 5, 0);
+  performance_layout->addWidget(m_show_perf_counters, 5, 1);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -171,12 +176,17 @@ void AdvancedWidget::CreateWidgets()
       // i18n: VS is short for vertex shaders.
       tr("Prefer VS for Point/Line Expansion"), Config::GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION);
   m_cpu_cull = new ConfigBool(tr("Cull Vertices on the CPU"), Config::GFX_CPU_CULL);
+  m_cpu_cull_triangles =
+      new ConfigBool(tr("Cull Triangles on the CPU"), Config::GFX_CPU_CULL_TRIANGLES);
+  m_low_memory = new ConfigBool(tr("Low Memory Mode"), Config::GFX_LOW_MEMORY);
 
   misc_layout->addWidget(m_enable_cropping, 0, 0);
   misc_layout->addWidget(m_enable_prog_scan, 0, 1);
   misc_layout->addWidget(m_backend_multithreading, 1, 0);
   misc_layout->addWidget(m_prefer_vs_for_point_line_expansion, 1, 1);
   misc_layout->addWidget(m_cpu_cull, 2, 0);
+  misc_layout->addWidget(m_cpu_cull_triangles, 3, 0);
+  misc_layout->addWidget(m_low_memory, 3, 1);
 #ifdef _WIN32
   m_borderless_fullscreen =
       new ConfigBool(tr("Borderless Fullscreen"), Config::GFX_BORDERLESS_FULLSCREEN);
@@ -273,6 +283,17 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Shows the average time in ms between each rendered frame alongside "
                  "the standard deviation.<br><br><dolphin_emphasis>If unsure, leave this "
                  "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_FRAME_PACING_DESCRIPTION[] =
+      QT_TR_NOOP("Shows the median and 99th percentile time in ms between each rendered frame, "
+                 "their variance, the 99th percentile of how late frame deadlines were reached, and "
+                 "how many frame deadlines were missed by more than 1 ms."
+                 "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_PERF_COUNTERS_DESCRIPTION[] =
+      QT_TR_NOOP("Shows CPU hardware performance counters of the CPU, GPU and DSP threads for the "
+                 "last frame: instructions per cycle, and cache, branch and TLB misses per "
+                 "thousand instructions. Only available on Linux, where it may require lowering "
+                 "/proc/sys/kernel/perf_event_paranoid.<br><br><dolphin_emphasis>If unsure, leave "
+                 "this unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_GRAPHS_DESCRIPTION[] =
       QT_TR_NOOP("Shows frametime graph along with statistics as a representation of "
                  "emulation performance.<br><br><dolphin_emphasis>If unsure, leave this "
@@ -400,6 +421,18 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Cull vertices on the CPU to reduce the number of draw calls required.  "
                  "May affect performance and draw statistics.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_CPU_CULL_TRIANGLES_DESCRIPTION[] =
+      QT_TR_NOOP("Removes triangles that are back-facing, have no area or are off-screen from "
+                 "the draws sent to the GPU, along with the vertices that only they use. Reduces "
+                 "the amount of vertex and index data uploaded at the cost of some CPU time."
+                 "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_LOW_MEMORY_DESCRIPTION[] =
+      QT_TR_NOOP("Uses smaller vertex, index and uniform streaming buffers, and limits the "
+                 "texture cache to 256 MiB unless a limit is already configured. Meant for "
+                 "devices with 1-2 GB of RAM. The buffer sizes change when emulation is "
+                 "restarted.<br><br>May reduce performance in games that draw a lot of "
+                 "geometry.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION[] = QT_TR_NOOP(
       "Defers invalidation of the EFB access cache until a GPU synchronization command "
       "is executed. If disabled, the cache will be invalidated with every draw call. "
@@ -434,6 +467,8 @@ void AdvancedWidget::AddDescriptions()
   m_show_ftimes->SetDescription(tr(TR_SHOW_FTIMES_DESCRIPTION));
   m_show_vps->SetDescription(tr(TR_SHOW_VPS_DESCRIPTION));
   m_show_vtimes->SetDescription(tr(TR_SHOW_VTIMES_DESCRIPTION));
+  m_show_frame_pacing->SetDescription(tr(TR_SHOW_FRAME_PACING_DESCRIPTION));
+  m_show_perf_counters->SetDescription(tr(TR_SHOW_PERF_COUNTERS_DESCRIPTION));
   m_show_graphs->SetDescription(tr(TR_SHOW_GRAPHS_DESCRIPTION));
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
@@ -474,6 +509,8 @@ void AdvancedWidget::AddDescriptions()
   m_prefer_vs_for_point_line_expansion->SetDescription(
       tr(TR_PREFER_VS_FOR_POINT_LINE_EXPANSION_DESCRIPTION).arg(vsexpand_extra));
   m_cpu_cull->SetDescription(tr(TR_CPU_CULL_DESCRIPTION));
+  m_cpu_cull_triangles->SetDescription(tr(TR_CPU_CULL_TRIANGLES_DESCRIPTION));
+  m_low_memory->SetDescription(tr(TR_LOW_MEMORY_DESCRIPTION));
 #ifdef _WIN32
   m_borderless_fullscreen->SetDescription(tr(TR_BORDERLESS_FULLSCREEN_DESCRIPTION));
 #endif
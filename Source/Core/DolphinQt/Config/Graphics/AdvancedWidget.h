@@ -40,6 +40,8 @@ private:
   ConfigBool* m_show_ftimes;
   ConfigBool* m_show_vps;
   ConfigBool* m_show_vtimes;
+  ConfigBool* m_show_frame_pacing;
+  ConfigBool* m_show_perf_counters;
   ConfigBool* m_show_graphs;
   ConfigBool* m_show_speed;
   ConfigBool* m_show_speed_colors;
@@ -71,6 +73,8 @@ private:
   ConfigBool* m_backend_multithreading;
   ConfigBool* m_prefer_vs_for_point_line_expansion;
   ConfigBool* m_cpu_cull;
+  ConfigBool* m_cpu_cull_triangles;
+  ConfigBool* m_low_memory;
   ConfigBool* m_borderless_fullscreen;
 
   // Experimental
@@ -106,6 +106,7 @@ void EnhancementsWidget::CreateWidgets()
 
   m_ir_combo = new ConfigChoice(resolution_options, Config::GFX_EFB_SCALE);
   m_ir_combo->setMaxVisibleItems(visible_resolution_option_count);
+  m_dynamic_resolution = new ConfigBool(tr("Dynamic Resolution"), Config::GFX_DYNAMIC_RESOLUTION);
 
   m_aa_combo = new ToolTipComboBox();
 
@@ -165,6 +166,9 @@ void EnhancementsWidget::CreateWidgets()
   enhancements_layout->addWidget(m_ir_combo, row, 1, 1, -1);
   ++row;
 
+  enhancements_layout->addWidget(m_dynamic_resolution, row, 1, 1, -1);
+  ++row;
+
   enhancements_layout->addWidget(new QLabel(tr("Anti-Aliasing:")), row, 0);
   enhancements_layout->addWidget(m_aa_combo, row, 1, 1, -1);
   ++row;
@@ -535,6 +539,12 @@ void EnhancementsWidget::AddDescriptions()
                  "certain games. Generally speaking, the lower the internal resolution, the "
                  "better performance will be.<br><br><dolphin_emphasis>If unsure, "
                  "select Native.</dolphin_emphasis>");
+  static const char TR_DYNAMIC_RESOLUTION_DESCRIPTION[] = QT_TR_NOOP(
+      "Lowers the internal resolution in steps while the GPU can't keep up with the game, and "
+      "raises it back up to the selected one when there is headroom again. A lower resolution "
+      "that doesn't make the game faster is undone.<br><br>Each change of the resolution causes "
+      "a brief stutter.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_ANTIALIAS_DESCRIPTION[] = QT_TR_NOOP(
       "Reduces the amount of aliasing caused by rasterizing 3D graphics, resulting "
       "in smoother edges on objects. Increases GPU load and sometimes causes graphical "
@@ -659,6 +669,8 @@ void EnhancementsWidget::AddDescriptions()
   m_ir_combo->SetTitle(tr("Internal Resolution"));
   m_ir_combo->SetDescription(tr(TR_INTERNAL_RESOLUTION_DESCRIPTION));
 
+  m_dynamic_resolution->SetDescription(tr(TR_DYNAMIC_RESOLUTION_DESCRIPTION));
+
   m_aa_combo->SetTitle(tr("Anti-Aliasing"));
   m_aa_combo->SetDescription(tr(TR_ANTIALIAS_DESCRIPTION));
 
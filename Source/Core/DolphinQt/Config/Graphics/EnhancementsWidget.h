@@ -38,6 +38,7 @@ private:
 
   // Enhancements
   ConfigChoice* m_ir_combo;
+  ConfigBool* m_dynamic_resolution;
   ToolTipComboBox* m_aa_combo;
   ToolTipComboBox* m_texture_filtering_combo;
   ToolTipComboBox* m_output_resampling_combo;
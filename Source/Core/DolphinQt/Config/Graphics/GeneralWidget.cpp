@@ -72,6 +72,7 @@ void GeneralWidget::CreateWidgets()
   m_custom_aspect_height->setHidden(true);
   m_adapter_combo = new ToolTipComboBox;
   m_enable_vsync = new ConfigBool(tr("V-Sync"), Config::GFX_VSYNC);
+  m_reduce_latency = new ConfigBool(tr("Reduce V-Sync Latency"), Config::GFX_LATENCY_REDUCTION);
   m_enable_fullscreen = new ConfigBool(tr("Start in Fullscreen"), Config::MAIN_FULLSCREEN);
 
   m_video_box->setLayout(m_video_layout);
@@ -97,6 +98,7 @@ void GeneralWidget::CreateWidgets()
 
   m_video_layout->addWidget(m_enable_vsync, 5, 0);
   m_video_layout->addWidget(m_enable_fullscreen, 5, 1, 1, -1);
+  m_video_layout->addWidget(m_reduce_latency, 6, 0);
 
   // Other
   auto* m_options_box = new QGroupBox(tr("Other"));
@@ -275,6 +277,12 @@ void GeneralWidget::AddDescriptions()
       "if emulation speed is below 100%.<br><br><dolphin_emphasis>If unsure, leave "
       "this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_REDUCE_LATENCY_DESCRIPTION[] = QT_TR_NOOP(
+      "With V-Sync, delays the emulation of each frame so that it is finished just before the "
+      "display refreshes, instead of waiting for the refresh after it has been rendered. This "
+      "makes the input the game reads newer when it is shown.<br><br>Works best with Vulkan on "
+      "drivers that support VK_KHR_present_wait. Frames may stutter if rendering times vary a "
+      "lot.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_NETPLAY_PING_DESCRIPTION[] = QT_TR_NOOP(
       "Shows the player's maximum ping while playing on "
       "NetPlay.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -325,6 +333,8 @@ void GeneralWidget::AddDescriptions()
 
   m_enable_vsync->SetDescription(tr(TR_VSYNC_DESCRIPTION));
 
+  m_reduce_latency->SetDescription(tr(TR_REDUCE_LATENCY_DESCRIPTION));
+
   m_enable_fullscreen->SetDescription(tr(TR_FULLSCREEN_DESCRIPTION));
 
   m_show_ping->SetDescription(tr(TR_SHOW_NETPLAY_PING_DESCRIPTION));
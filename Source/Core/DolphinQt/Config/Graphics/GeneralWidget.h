@@ -47,6 +47,7 @@ private:
   ConfigInteger* m_custom_aspect_width;
   ConfigInteger* m_custom_aspect_height;
   ConfigBool* m_enable_vsync;
+  ConfigBool* m_reduce_latency;
   ConfigBool* m_enable_fullscreen;
 
   // Options
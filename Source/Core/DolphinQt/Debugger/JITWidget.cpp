@@ -118,7 +118,7 @@ bool JitBlockProxyModel::filterAcceptsRow(int source_row, const QModelIndex& sou
   }
   if (m_pm_address_covered.has_value())
   {
-    if (!block.physical_addresses.contains(m_pm_address_covered.value()))
+    if (!std::ranges::binary_search(block.physical_addresses, m_pm_address_covered.value()))
       return false;
   }
   return true;
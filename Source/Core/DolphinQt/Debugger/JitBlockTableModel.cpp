@@ -205,10 +205,14 @@ void JitBlockTableModel::OnEmulationStateChanged(Core::State state)
 static QString GetQStringDescription(const CPUEmuFeatureFlags flags)
 {
   static const std::array<QString, (FEATURE_FLAG_END_OF_ENUMERATION - 1) << 1> descriptions = {
-      QStringLiteral(""),           QStringLiteral("DR"),
-      QStringLiteral("IR"),         QStringLiteral("DR|IR"),
-      QStringLiteral("PERFMON"),    QStringLiteral("DR|PERFMON"),
-      QStringLiteral("IR|PERFMON"), QStringLiteral("DR|IR|PERFMON"),
+      QStringLiteral(""),              QStringLiteral("DR"),
+      QStringLiteral("IR"),            QStringLiteral("DR|IR"),
+      QStringLiteral("PERFMON"),       QStringLiteral("DR|PERFMON"),
+      QStringLiteral("IR|PERFMON"),    QStringLiteral("DR|IR|PERFMON"),
+      QStringLiteral("NI"),            QStringLiteral("DR|NI"),
+      QStringLiteral("IR|NI"),         QStringLiteral("DR|IR|NI"),
+      QStringLiteral("PERFMON|NI"),    QStringLiteral("DR|PERFMON|NI"),
+      QStringLiteral("IR|PERFMON|NI"), QStringLiteral("DR|IR|PERFMON|NI"),
   };
   return descriptions[flags];
 }
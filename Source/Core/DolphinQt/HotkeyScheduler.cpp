@@ -153,12 +153,14 @@ void HotkeyScheduler::Run()
   {
     Common::SleepCurrentThread(5);
 
+    // Poll the devices once for both channels rather than twice in a row.
+    g_controller_interface.UpdateInput(
+        {ciface::InputChannel::FreeLook, ciface::InputChannel::Host});
+
     g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::FreeLook);
-    g_controller_interface.UpdateInput();
     FreeLook::UpdateInput();
 
     g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::Host);
-    g_controller_interface.UpdateInput();
 
     if (!HotkeyManagerEmu::IsEnabled())
       continue;
@@ -242,6 +244,9 @@ void HotkeyScheduler::Run()
       if (IsHotkey(HK_SCREENSHOT))
         emit ScreenShotHotkey();
 
+      if (IsHotkey(HK_CAPTURE_FRAME_TRACE))
+        Core::CaptureFrameTrace();
+
       // Unlock Cursor
       if (IsHotkey(HK_UNLOCK_CURSOR))
         emit UnlockCursor();
@@ -654,6 +659,9 @@ void HotkeyScheduler::Run()
     if (IsHotkey(HK_UNDO_SAVE_STATE))
       emit StateSaveUndo();
 
+    if (IsHotkey(HK_REWIND))
+      emit StateRewind();
+
     if (IsHotkey(HK_LOAD_STATE_FILE))
       emit StateLoadFile();
 
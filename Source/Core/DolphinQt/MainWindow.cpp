@@ -58,12 +58,14 @@
 #include "Core/HW/Wiimote.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 #include "Core/HotkeyManager.h"
+#include "Core/IOS/ES/ES.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/NetPlayProto.h"
 #include "Core/NetPlayServer.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiUtils.h"
@@ -630,6 +632,7 @@ void MainWindow::ConnectHotkeys()
           &MainWindow::StateLoadLastSavedAt);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateLoadUndo, this, &MainWindow::StateLoadUndo);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveUndo, this, &MainWindow::StateSaveUndo);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateRewind, this, &MainWindow::StateRewind);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveOldest, this,
           &MainWindow::StateSaveOldest);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveFile, this, &MainWindow::StateSave);
@@ -1472,6 +1475,11 @@ void MainWindow::StateSaveUndo()
   State::UndoSaveState(m_system);
 }
 
+void MainWindow::StateRewind()
+{
+  Rewind::StepBack(m_system);
+}
+
 void MainWindow::StateSaveOldest()
 {
   State::SaveFirstSaved(m_system);
@@ -1825,6 +1833,7 @@ void MainWindow::OnImportNANDBackup()
 
   result.wait();
 
+  IOS::HLE::ESCore::InvalidateVerifiedContents();
   m_menu_bar->UpdateToolsMenu(Core::State::Uninitialized);
 }
 
@@ -822,6 +822,12 @@ void MenuBar::AddMovieMenu()
   connect(pause_at_end, &QAction::toggled,
           [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, value); });
 
+  auto* turbo_playback = movie_menu->addAction(tr("Turbo Playback Without Rendering"));
+  turbo_playback->setCheckable(true);
+  turbo_playback->setChecked(Config::Get(Config::MAIN_MOVIE_TURBO_PLAYBACK));
+  connect(turbo_playback, &QAction::toggled,
+          [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_TURBO_PLAYBACK, value); });
+
   auto* rerecord_counter = movie_menu->addAction(tr("Show Rerecord Counter"));
   rerecord_counter->setCheckable(true);
   rerecord_counter->setChecked(Config::Get(Config::MAIN_MOVIE_SHOW_RERECORD));
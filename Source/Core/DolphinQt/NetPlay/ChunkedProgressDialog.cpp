@@ -4,6 +4,7 @@
 #include "DolphinQt/NetPlay/ChunkedProgressDialog.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <functional>
 
@@ -71,6 +72,7 @@ void ChunkedProgressDialog::show(const QString& title, const u64 data_size,
 {
   m_progress_box->setTitle(title);
   m_data_size = data_size;
+  m_start_time = std::chrono::steady_clock::now();
 
   for (auto& pair : m_progress_bars)
   {
@@ -132,10 +134,15 @@ void ChunkedProgressDialog::SetProgress(const int pid, const u64 progress)
   const float total = m_data_size / 1024.0f / 1024.0f;
   const int prog = std::lround((static_cast<float>(progress) / m_data_size) * 100.0f);
 
-  m_status_labels[pid]->setText(tr("%1[%2]: %3/%4 MiB")
+  // Blocks a player already had count as received right away, so this is the effective speed.
+  const std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - m_start_time;
+  const float speed = elapsed.count() > 0 ? acquired / elapsed.count() : 0.0f;
+
+  m_status_labels[pid]->setText(tr("%1[%2]: %3/%4 MiB (%5 MiB/s)")
                                     .arg(player_name, QString::number(pid),
                                          QString::fromStdString(fmt::format("{:.2f}", acquired)),
-                                         QString::fromStdString(fmt::format("{:.2f}", total))));
+                                         QString::fromStdString(fmt::format("{:.2f}", total)),
+                                         QString::fromStdString(fmt::format("{:.2f}", speed))));
   m_progress_bars[pid]->setValue(prog);
 }
 
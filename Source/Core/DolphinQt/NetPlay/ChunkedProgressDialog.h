@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -36,6 +37,7 @@ private:
   std::map<int, QProgressBar*> m_progress_bars;
   std::map<int, QLabel*> m_status_labels;
   u64 m_data_size = 0;
+  std::chrono::steady_clock::time_point m_start_time;
 
   QGroupBox* m_progress_box;
   QVBoxLayout* m_progress_layout;
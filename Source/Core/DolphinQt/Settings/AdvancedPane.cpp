@@ -88,6 +88,16 @@ void AdvancedPane::CreateLayout()
          "needed.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>"));
   cpu_options_group_layout->addWidget(m_accurate_cpu_cache_checkbox);
 
+  m_hybrid_cpu_cache_checkbox = new ConfigBool(tr("Only Emulate Cache Where Needed"),
+                                               Config::MAIN_HYBRID_CPU_CACHE);
+  m_hybrid_cpu_cache_checkbox->SetDescription(
+      tr("Only emulates the write-back cache for the memory pages the game manages the cache "
+         "for or uses for DMA, and keeps fast memory access for everything else.<br>This is "
+         "much faster than emulating the cache everywhere, but a game that relies on the cache "
+         "for memory it never does that with can still misbehave.<br><br><dolphin_emphasis>If "
+         "unsure, leave this unchecked.</dolphin_emphasis>"));
+  cpu_options_group_layout->addWidget(m_hybrid_cpu_cache_checkbox);
+
   auto* clock_override = new QGroupBox(tr("Clock Override"));
   auto* clock_override_layout = new QVBoxLayout();
   clock_override->setLayout(clock_override_layout);
@@ -186,6 +196,8 @@ void AdvancedPane::CreateLayout()
 
 void AdvancedPane::ConnectLayout()
 {
+  connect(m_accurate_cpu_cache_checkbox, &QCheckBox::toggled, this, &AdvancedPane::Update);
+
   connect(m_cpu_emulation_engine_combobox, &QComboBox::currentIndexChanged, [](int index) {
     const auto cpu_cores = PowerPC::AvailableCPUCores();
     if (index >= 0 && static_cast<size_t>(index) < cpu_cores.size())
@@ -250,6 +262,7 @@ void AdvancedPane::Update()
   m_cpu_emulation_engine_combobox->setEnabled(is_uninitialized);
   m_enable_mmu_checkbox->setEnabled(is_uninitialized);
   m_pause_on_panic_checkbox->setEnabled(is_uninitialized);
+  m_hybrid_cpu_cache_checkbox->setEnabled(Config::Get(Config::MAIN_ACCURATE_CPU_CACHE));
 
   {
     QFont bf = font();
@@ -140,6 +140,7 @@ void AudioPane::CreateWidgets()
   auto* stretching_box = new QGroupBox(tr("Audio Stretching Settings"));
   auto* stretching_layout = new QGridLayout;
   m_stretching_enable = new QCheckBox(tr("Enable Audio Stretching"));
+  m_stretching_fast = new QCheckBox(tr("Use Faster Stretching"));
   m_stretching_buffer_slider = new QSlider(Qt::Horizontal);
   m_stretching_buffer_indicator = new QLabel();
   m_stretching_buffer_label = new QLabel(tr("Buffer Size:"));
@@ -151,11 +152,17 @@ void AudioPane::CreateWidgets()
   m_stretching_enable->setToolTip(tr("Enables stretching of the audio to match emulation speed."));
   m_stretching_buffer_slider->setToolTip(tr("Size of stretch buffer in milliseconds. "
                                             "Values too low may cause audio crackling."));
+  m_stretching_fast->setToolTip(
+      tr("Uses a quicker but less thorough search when stretching audio. This greatly reduces the "
+         "CPU cost of stretching, which helps on slow devices, but may cause audible "
+         "artifacts.<br><br><dolphin_emphasis>If unsure, leave this "
+         "unchecked.</dolphin_emphasis>"));
 
   stretching_layout->addWidget(m_stretching_enable, 0, 0, 1, -1);
   stretching_layout->addWidget(m_stretching_buffer_label, 1, 0);
   stretching_layout->addWidget(m_stretching_buffer_slider, 1, 1);
   stretching_layout->addWidget(m_stretching_buffer_indicator, 1, 2);
+  stretching_layout->addWidget(m_stretching_fast, 2, 0, 1, -1);
 
   dsp_box->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
 
@@ -196,6 +203,7 @@ void AudioPane::ConnectWidgets()
   connect(m_dolby_pro_logic, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
   connect(m_dolby_quality_slider, &QSlider::valueChanged, this, &AudioPane::SaveSettings);
   connect(m_stretching_enable, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
+  connect(m_stretching_fast, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_hle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_lle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_interpreter, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
@@ -262,6 +270,8 @@ void AudioPane::LoadSettings()
   m_stretching_buffer_slider->setEnabled(m_stretching_enable->isChecked());
   m_stretching_buffer_indicator->setEnabled(m_stretching_enable->isChecked());
   m_stretching_buffer_indicator->setText(tr("%1 ms").arg(m_stretching_buffer_slider->value()));
+  m_stretching_fast->setChecked(Config::Get(Config::MAIN_AUDIO_STRETCH_FAST));
+  m_stretching_fast->setEnabled(m_stretching_enable->isChecked());
 
   // Misc
   m_speed_up_mute_enable->setChecked(Config::Get(Config::MAIN_AUDIO_MUTE_ON_DISABLED_SPEED_LIMIT));
@@ -329,6 +339,8 @@ void AudioPane::SaveSettings()
   // Stretch
   Config::SetBaseOrCurrent(Config::MAIN_AUDIO_STRETCH, m_stretching_enable->isChecked());
   Config::SetBaseOrCurrent(Config::MAIN_AUDIO_STRETCH_LATENCY, m_stretching_buffer_slider->value());
+  Config::SetBaseOrCurrent(Config::MAIN_AUDIO_STRETCH_FAST, m_stretching_fast->isChecked());
+  m_stretching_fast->setEnabled(m_stretching_enable->isChecked());
   m_stretching_buffer_label->setEnabled(m_stretching_enable->isChecked());
   m_stretching_buffer_slider->setEnabled(m_stretching_enable->isChecked());
   m_stretching_buffer_indicator->setEnabled(m_stretching_enable->isChecked());
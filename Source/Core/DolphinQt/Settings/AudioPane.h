@@ -73,6 +73,7 @@ private:
 
   // Audio Stretching
   QCheckBox* m_stretching_enable;
+  QCheckBox* m_stretching_fast;
   QLabel* m_stretching_buffer_label;
   QSlider* m_stretching_buffer_slider;
   QLabel* m_stretching_buffer_indicator;
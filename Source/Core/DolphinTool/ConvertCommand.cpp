@@ -3,18 +3,34 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
+#include <ostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
 #include <OptionParser.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -25,6 +41,94 @@
 
 namespace DolphinTool
 {
+namespace
+{
+struct ConvertOptions
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  unsigned int threads;
+};
+
+struct PhaseStats
+{
+  double wall_seconds = 0;
+  double cpu_seconds = 0;
+
+  PhaseStats& operator+=(const PhaseStats& other)
+  {
+    wall_seconds += other.wall_seconds;
+    cpu_seconds += other.cpu_seconds;
+    return *this;
+  }
+};
+
+struct ConversionStats
+{
+  // Opening the input, including scanning it for junk data when scrubbing.
+  PhaseStats setup;
+  PhaseStats conversion;
+  u64 bytes_read = 0;
+  u64 bytes_written = 0;
+
+  ConversionStats& operator+=(const ConversionStats& other)
+  {
+    setup += other.setup;
+    conversion += other.conversion;
+    bytes_read += other.bytes_read;
+    bytes_written += other.bytes_written;
+    return *this;
+  }
+};
+
+// Measures the wall time and the CPU time of the whole process between its construction and
+// the call to Stop.
+class PhaseTimer
+{
+public:
+  PhaseTimer() : m_wall_start(Clock::now()), m_cpu_start(GetProcessCPUSeconds()) {}
+
+  PhaseStats Stop() const
+  {
+    const std::chrono::duration<double> wall_time = Clock::now() - m_wall_start;
+    return {wall_time.count(), GetProcessCPUSeconds() - m_cpu_start};
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  static double GetProcessCPUSeconds()
+  {
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time,
+                         &user_time))
+    {
+      return 0;
+    }
+    const auto to_seconds = [](const FILETIME& time) {
+      return ((u64{time.dwHighDateTime} << 32) | time.dwLowDateTime) / 10'000'000.0;
+    };
+    return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+      return 0;
+    const auto to_seconds = [](const timeval& time) {
+      return time.tv_sec + time.tv_usec / 1'000'000.0;
+    };
+    return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+#endif
+  }
+
+  Clock::time_point m_wall_start;
+  double m_cpu_start;
+};
+}  // namespace
+
 static std::optional<DiscIO::WIARVZCompressionType>
 ParseCompressionTypeString(const std::string& compression_str)
 {
@@ -56,6 +160,276 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+static double GetMBPerSecond(u64 bytes, double seconds)
+{
+  return seconds > 0 ? bytes / 1'000'000.0 / seconds : 0;
+}
+
+static void PrintStats(std::ostream& out, const ConversionStats& stats)
+{
+  fmt::print(out, "Setup: {:.2f} s, CPU time {:.2f} s\n", stats.setup.wall_seconds,
+             stats.setup.cpu_seconds);
+  fmt::print(out, "Conversion: {:.2f} s, CPU time {:.2f} s\n", stats.conversion.wall_seconds,
+             stats.conversion.cpu_seconds);
+  fmt::print(out, "Read: {:.1f} MB/s, written: {:.1f} MB/s\n",
+             GetMBPerSecond(stats.bytes_read, stats.conversion.wall_seconds),
+             GetMBPerSecond(stats.bytes_written, stats.conversion.wall_seconds));
+}
+
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConvertOptions& options, std::ostream& log, ConversionStats* stats)
+{
+  const PhaseTimer setup_timer;
+
+  const DiscIO::BlobType format = options.format;
+  const bool scrub = options.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(log, "Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      fmt::print(log, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    fmt::print(log, "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      fmt::print(log, "Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      fmt::print(log, "Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (scrub && format == DiscIO::BlobType::RVZ)
+  {
+    fmt::print(log, "Warning: Scrubbing an RVZ container does not offer significant space "
+                    "advantages. Continuing anyway.\n");
+  }
+
+  if (scrub && format == DiscIO::BlobType::PLAIN)
+  {
+    fmt::print(log, "Warning: Scrubbing does not save space when converting to ISO unless "
+                    "using external compression. Continuing anyway.\n");
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    fmt::print(log, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                    "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    fmt::print(log,
+               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(options.block_size.value(), volume->GetDataSize()))
+  {
+    fmt::print(log, "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+                    "must be an integer multiple of the block size and must not be an integer "
+                    "multiple of the block size multiplied by 32. Continuing anyway.\n");
+  }
+
+  stats->setup = setup_timer.Stop();
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  const PhaseTimer conversion_timer;
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   options.block_size.value(), NOOP_STATUS_CALLBACK,
+                                   options.threads);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        options.compression.value(), options.compression_level.value(),
+        options.block_size.value(), NOOP_STATUS_CALLBACK, options.threads);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  stats->conversion = conversion_timer.Stop();
+
+  if (!success)
+  {
+    fmt::print(log, "Error: Conversion failed\n");
+    return false;
+  }
+
+  stats->bytes_read = blob_reader->GetDataSize();
+  stats->bytes_written = File::GetSize(output_file_path);
+
+  return true;
+}
+
+static int ConvertDirectory(const std::string& input_directory,
+                            const std::string& output_directory, const ConvertOptions& options,
+                            unsigned int jobs, bool print_stats)
+{
+  const std::vector<std::string> input_file_paths =
+      Common::DoFileSearch({input_directory}, {".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs",
+                                               ".wia", ".rvz", ".nfs"});
+  if (input_file_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No disc images found in the input directory\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!File::CreateFullPath(output_directory + '/'))
+  {
+    fmt::print(std::cerr, "Error: The output directory could not be created\n");
+    return EXIT_FAILURE;
+  }
+
+  // Each running conversion gets an equal share of the compression threads.
+  jobs = std::min<unsigned int>(jobs, static_cast<unsigned int>(input_file_paths.size()));
+  ConvertOptions file_options = options;
+  file_options.threads = std::max(1u, options.threads / jobs);
+
+  std::mutex output_mutex;
+  std::atomic<size_t> next_file = 0;
+  std::atomic<size_t> failures = 0;
+  ConversionStats total_stats;
+
+  const PhaseTimer total_timer;
+
+  const auto job = [&] {
+    for (size_t i = next_file++; i < input_file_paths.size(); i = next_file++)
+    {
+      const std::string& input_file_path = input_file_paths[i];
+      std::string name;
+      SplitPath(WithUnifiedPathSeparators(input_file_path), nullptr, &name, nullptr);
+      const std::string output_file_path =
+          fmt::format("{}/{}{}", output_directory, name, GetFormatExtension(options.format));
+
+      std::ostringstream log;
+      ConversionStats stats;
+      bool success;
+      if (File::Exists(output_file_path))
+      {
+        fmt::print(log, "Error: The output file already exists\n");
+        success = false;
+      }
+      else
+      {
+        success = ConvertFile(input_file_path, output_file_path, file_options, log, &stats);
+      }
+
+      std::lock_guard lk(output_mutex);
+      fmt::print(std::cerr, "{}:\n{}", input_file_path, log.str());
+      if (success)
+      {
+        if (print_stats)
+          PrintStats(std::cerr, stats);
+        total_stats += stats;
+      }
+      else
+      {
+        ++failures;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 1; i < jobs; ++i)
+    threads.emplace_back(job);
+  job();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  if (print_stats)
+  {
+    const PhaseStats total_time = total_timer.Stop();
+    fmt::print(std::cerr, "Total: {} files, {:.2f} s, CPU time {:.2f} s\n",
+               input_file_paths.size() - failures, total_time.wall_seconds,
+               total_time.cpu_seconds);
+    fmt::print(std::cerr, "Read: {:.1f} MB/s, written: {:.1f} MB/s\n",
+               GetMBPerSecond(total_stats.bytes_read, total_time.wall_seconds),
+               GetMBPerSecond(total_stats.bytes_written, total_time.wall_seconds));
+  }
+
+  if (failures != 0)
+  {
+    fmt::print(std::cerr, "Error: {} of {} conversions failed\n", failures.load(),
+               input_file_paths.size());
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -72,13 +446,14 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-i", "--input")
       .type("string")
       .action("store")
-      .help("Path to disc image FILE.")
+      .help("Path to disc image FILE, or to a directory of disc images to convert all of them.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE, or the destination directory if the input is a "
+            "directory.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -110,6 +485,23 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Number of compression threads, shared by all files being converted at once. "
+            "Default is one per CPU core.");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of files to convert at once when the input is a directory. Default is 1.")
+      .set_default(1);
+
+  parser.add_option("--stats")
+      .action("store_true")
+      .help("Print the read and write throughput and the time spent in each phase. CPU times are "
+            "for the whole process.");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -144,73 +536,6 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
-  // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
-  }
-
-  if (scrub && format == DiscIO::BlobType::PLAIN)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
-                          "using external compression. Continuing anyway.\n");
-  }
-
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +562,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,57 +612,47 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
-  {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
-  }
-
-  case DiscIO::BlobType::GCZ:
+  // --threads, --jobs
+  unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+  if (options.is_set("threads"))
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    const int threads_option = static_cast<int>(options.get("threads"));
+    if (threads_option < 1)
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: The number of threads must be at least 1\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
+    threads = static_cast<unsigned int>(threads_option);
   }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
   {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+    return EXIT_FAILURE;
   }
 
-  default:
+  ConvertOptions convert_options;
+  convert_options.format = format;
+  convert_options.scrub = static_cast<bool>(options.get("scrub"));
+  convert_options.block_size = block_size_o;
+  convert_options.compression = compression_o;
+  convert_options.compression_level = compression_level_o;
+  convert_options.threads = threads;
+  const bool print_stats = static_cast<bool>(options.get("stats"));
+
+  if (File::IsDirectory(input_file_path))
   {
-    ASSERT(false);
-    break;
-  }
+    return ConvertDirectory(input_file_path, output_file_path, convert_options,
+                            static_cast<unsigned int>(jobs), print_stats);
   }
 
-  if (!success)
-  {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
+  ConversionStats stats;
+  if (!ConvertFile(input_file_path, output_file_path, convert_options, std::cerr, &stats))
     return EXIT_FAILURE;
-  }
+
+  if (print_stats)
+    PrintStats(std::cerr, stats);
 
   return EXIT_SUCCESS;
 }
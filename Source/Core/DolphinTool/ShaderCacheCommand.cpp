@@ -0,0 +1,114 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ShaderCacheCommand.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct SerializedUidLess
+{
+  bool operator()(const VideoCommon::SerializedGXPipelineUid& a,
+                  const VideoCommon::SerializedGXPipelineUid& b) const
+  {
+    return std::memcmp(&a, &b, sizeof(a)) < 0;
+  }
+};
+}  // namespace
+
+int ShaderCacheCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: shadercache [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to pipeline UID cache FILE, usually Cache/<game ID>.uidcache.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_file_path = options["input"];
+  if (input_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  File::IOFile file(input_file_path, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != VideoCommon::GX_PIPELINE_UID_CACHE_MAGIC)
+  {
+    fmt::print(std::cerr, "Error: Not a pipeline UID cache\n");
+    return EXIT_FAILURE;
+  }
+
+  // Dolphin discards caches of other versions and truncated caches when it boots the game, so
+  // report these as errors too.
+  if (version != VideoCommon::GX_PIPELINE_UID_VERSION)
+  {
+    fmt::print(std::cerr, "Error: UID cache version {} doesn't match this build's version {}\n",
+               version, VideoCommon::GX_PIPELINE_UID_VERSION);
+    return EXIT_FAILURE;
+  }
+
+  const u64 data_size = file.GetSize() - VideoCommon::GX_PIPELINE_UID_CACHE_HEADER_SIZE;
+  if (data_size % sizeof(VideoCommon::SerializedGXPipelineUid) != 0)
+  {
+    fmt::print(std::cerr, "Error: UID cache is truncated\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<VideoCommon::SerializedGXPipelineUid> uids(
+      data_size / sizeof(VideoCommon::SerializedGXPipelineUid));
+  if (!file.ReadArray(uids.data(), uids.size()))
+  {
+    fmt::print(std::cerr, "Error: Unable to read UID cache\n");
+    return EXIT_FAILURE;
+  }
+
+  std::set<VideoCommon::SerializedGXPipelineUid, SerializedUidLess> pipelines;
+  std::set<PortableVertexDeclaration> vertex_formats;
+  std::set<VertexShaderUid> vertex_shaders;
+  std::set<GeometryShaderUid> geometry_shaders;
+  std::set<PixelShaderUid> pixel_shaders;
+  for (const VideoCommon::SerializedGXPipelineUid& uid : uids)
+  {
+    pipelines.insert(uid);
+    vertex_formats.insert(uid.vertex_decl);
+    vertex_shaders.insert(uid.vs_uid);
+    geometry_shaders.insert(uid.gs_uid);
+    pixel_shaders.insert(uid.ps_uid);
+  }
+
+  // Each pipeline is compiled once when the game boots, so these are the numbers of objects
+  // the backend has to create to warm up this cache.
+  fmt::print(std::cout, "Entries: {}\n", uids.size());
+  fmt::print(std::cout, "Pipelines: {}\n", pipelines.size());
+  fmt::print(std::cout, "Vertex formats: {}\n", vertex_formats.size());
+  fmt::print(std::cout, "Vertex shaders: {}\n", vertex_shaders.size());
+  fmt::print(std::cout, "Geometry shaders: {}\n", geometry_shaders.size());
+  fmt::print(std::cout, "Pixel shaders: {}\n", pixel_shaders.size());
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
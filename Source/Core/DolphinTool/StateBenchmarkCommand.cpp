@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/StateBenchmarkCommand.h"
+
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Core/State.h"
+
+namespace DolphinTool
+{
+static std::string_view GetCompressionName(State::CompressionType compression_type)
+{
+  switch (compression_type)
+  {
+  case State::CompressionType::Uncompressed:
+    return "none";
+  case State::CompressionType::LZ4:
+    return "lz4";
+  case State::CompressionType::Zstd:
+    return "zstd";
+  default:
+    return "unknown";
+  }
+}
+
+int StateBenchmarkCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: statebench [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to savestate FILE.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_file_path = options["input"];
+  if (input_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::optional<std::vector<State::CompressionBenchmarkResult>> results =
+      State::BenchmarkCompression(input_file_path);
+  if (!results)
+  {
+    fmt::print(std::cerr, "Error: Unable to read savestate\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "{:<12}{:>14}{:>12}{:>12}\n", "Compression", "Size", "Save (ms)",
+             "Load (ms)");
+  for (const State::CompressionBenchmarkResult& result : *results)
+  {
+    fmt::print(std::cout, "{:<12}{:>14}{:>12.1f}{:>12.1f}\n",
+               GetCompressionName(result.compression_type), result.compressed_size,
+               result.save_seconds * 1000, result.load_seconds * 1000);
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
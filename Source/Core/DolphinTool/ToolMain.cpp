@@ -17,13 +17,16 @@
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/ExtractCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/ShaderCacheCommand.h"
+#include "DolphinTool/StateBenchmarkCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, statebench, "
+                        "shadercache]\n");
 }
 
 #ifdef _WIN32
@@ -52,6 +55,10 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "statebench")
+    return DolphinTool::StateBenchmarkCommand(args);
+  else if (command_str == "shadercache")
+    return DolphinTool::ShaderCacheCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
@@ -153,8 +153,8 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  // Verify the volume. When only a digest gets printed, nothing else has to be checked.
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate, !algorithm_is_set);
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
   {
@@ -414,6 +414,11 @@ public:
     lhs->UpdateReferences(env);
     rhs->UpdateReferences(env);
   }
+
+  bool IsConstant() const override
+  {
+    return op != TOK_ASSIGN && lhs->IsConstant() && rhs->IsConstant();
+  }
 };
 
 class LiteralExpression : public Expression
@@ -431,6 +436,8 @@ public:
     // Nothing needed.
   }
 
+  bool IsConstant() const override { return true; }
+
 protected:
   virtual std::string GetName() const = 0;
 };
@@ -448,6 +455,15 @@ private:
   const ControlState m_value{};
 };
 
+// Replaces expressions that always evaluate to the same value with a literal, so that they don't
+// have to be walked on every input poll.
+static std::unique_ptr<Expression> FoldConstant(std::unique_ptr<Expression>&& expr)
+{
+  if (!expr->IsConstant())
+    return std::move(expr);
+  return std::make_unique<LiteralReal>(expr->GetValue());
+}
+
 static ParseResult MakeLiteralExpression(const Token& token)
 {
   ControlState val{};
@@ -588,16 +604,19 @@ public:
   {
     m_lhs->UpdateReferences(env);
     m_rhs->UpdateReferences(env);
+    // The bound controls only change here, so don't count them on every poll.
+    m_use_lhs = m_lhs->CountNumControls() > 0;
   }
 
 private:
   const std::unique_ptr<Expression>& GetActiveChild() const
   {
-    return m_lhs->CountNumControls() > 0 ? m_lhs : m_rhs;
+    return m_use_lhs ? m_lhs : m_rhs;
   }
 
   std::unique_ptr<Expression> m_lhs;
   std::unique_ptr<Expression> m_rhs;
+  bool m_use_lhs = false;
 };
 
 std::shared_ptr<Device> ControlEnvironment::FindDevice(const ControlQualifier& qualifier) const
@@ -775,7 +794,7 @@ private:
                                           Common::FmtFormatT("Expected arguments: {0}", text));
     }
 
-    return ParseResult::MakeSuccessfulResult(std::move(func));
+    return ParseResult::MakeSuccessfulResult(FoldConstant(std::move(func)));
   }
 
   ParseResult ParseAtom(const Token& tok)
@@ -893,7 +912,8 @@ private:
         return rhs;
       }
 
-      expr = std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr));
+      expr = FoldConstant(
+          std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr)));
     }
 
     return ParseResult::MakeSuccessfulResult(std::move(expr));
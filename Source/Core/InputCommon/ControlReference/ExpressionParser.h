@@ -172,6 +172,8 @@ public:
   virtual void SetValue(ControlState state) = 0;
   virtual int CountNumControls() const = 0;
   virtual void UpdateReferences(ControlEnvironment& finder) = 0;
+  // True if the expression evaluates to the same value every time and can be folded at parse time.
+  virtual bool IsConstant() const { return false; }
 };
 
 class ParseResult
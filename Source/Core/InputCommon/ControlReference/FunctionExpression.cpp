@@ -48,6 +48,8 @@ private:
     return m_state;
   }
 
+  bool IsStateful() const override { return true; }
+
   mutable bool m_released{};
   mutable bool m_state{};
 };
@@ -332,6 +334,8 @@ private:
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable Clock::time_point m_start_time = Clock::now();
 };
 
@@ -452,6 +456,8 @@ class SmoothExpression : public FunctionExpression
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable ControlState m_value = 0.0;
   mutable Clock::time_point m_last_update = Clock::now();
 };
@@ -491,6 +497,8 @@ class HoldExpression : public FunctionExpression
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable bool m_state = false;
   mutable Clock::time_point m_start_time = Clock::now();
 };
@@ -549,6 +557,8 @@ class TapExpression : public FunctionExpression
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable bool m_released = true;
   mutable u32 m_taps = 0;
   mutable Clock::time_point m_start_time = Clock::now();
@@ -610,6 +620,8 @@ class RelativeExpression : public FunctionExpression
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable ControlState m_state = 0.0;
   mutable Clock::time_point m_last_update = Clock::now();
 };
@@ -662,6 +674,8 @@ class PulseExpression : public FunctionExpression
   }
 
 private:
+  bool IsStateful() const override { return true; }
+
   mutable bool m_released = false;
   mutable bool m_state = false;
   mutable Clock::time_point m_release_time = Clock::now();
@@ -723,6 +737,12 @@ std::unique_ptr<FunctionExpression> MakeFunctionExpression(std::string_view name
   return nullptr;
 }
 
+bool FunctionExpression::IsConstant() const
+{
+  return !IsStateful() &&
+         std::all_of(m_args.begin(), m_args.end(), [](auto& arg) { return arg->IsConstant(); });
+}
+
 int FunctionExpression::CountNumControls() const
 {
   int result = 0;
@@ -32,12 +32,17 @@ public:
 
   int CountNumControls() const override;
   void UpdateReferences(ControlEnvironment& env) override;
+  bool IsConstant() const override;
 
   ArgumentValidation SetArguments(std::vector<std::unique_ptr<Expression>>&& args);
 
   void SetValue(ControlState value) override;
 
 protected:
+  // Functions that keep state between evaluations (e.g. timers and toggles) must return true so
+  // that they aren't folded into a constant.
+  virtual bool IsStateful() const { return false; }
+
   virtual ArgumentValidation
   ValidateArguments(const std::vector<std::unique_ptr<Expression>>& args) = 0;
 
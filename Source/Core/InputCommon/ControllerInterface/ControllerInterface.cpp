@@ -46,6 +46,7 @@ ControllerInterface g_controller_interface;
 static thread_local ciface::InputChannel tls_input_channel = ciface::InputChannel::Host;
 
 static thread_local bool tls_is_updating_devices = false;
+static thread_local u32 tls_updating_input_channels = 0;
 
 void ControllerInterface::Initialize(const WindowSystemInfo& wsi)
 {
@@ -325,6 +326,11 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
 
 // Update input for all devices if lock can be acquired without waiting.
 void ControllerInterface::UpdateInput()
+{
+  UpdateInput({tls_input_channel});
+}
+
+void ControllerInterface::UpdateInput(std::initializer_list<ciface::InputChannel> input_channels)
 {
   // This should never happen
   ASSERT(m_is_init);
@@ -349,7 +355,11 @@ void ControllerInterface::UpdateInput()
 
     std::lock_guard lk_devices(m_devices_mutex, std::adopt_lock);
 
+    m_last_input_update_time.store(std::chrono::steady_clock::now());
+
     tls_is_updating_devices = true;
+    for (const ciface::InputChannel input_channel : input_channels)
+      tls_updating_input_channels |= 1u << int(input_channel);
 
     for (auto& backend : m_input_backends)
       backend->UpdateInput(devices_to_remove);
@@ -362,6 +372,7 @@ void ControllerInterface::UpdateInput()
         devices_to_remove.push_back(d);
     }
 
+    tls_updating_input_channels = 0;
     tls_is_updating_devices = false;
   }
 
@@ -386,6 +397,16 @@ ciface::InputChannel ControllerInterface::GetCurrentInputChannel()
   return tls_input_channel;
 }
 
+u32 ControllerInterface::GetUpdatingInputChannels()
+{
+  return tls_updating_input_channels;
+}
+
+std::chrono::steady_clock::time_point ControllerInterface::GetLastInputUpdateTime() const
+{
+  return m_last_input_update_time.load();
+}
+
 WindowSystemInfo ControllerInterface::GetWindowSystemInfo() const
 {
   return m_wsi;
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <initializer_list>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -101,6 +103,11 @@ public:
   void PlatformPopulateDevices(std::function<void()> callback);
   bool IsInit() const { return m_is_init; }
   void UpdateInput();
+  // Updates input for several input channels with a single poll of the devices, for when all of
+  // them are about to be read anyway.
+  void UpdateInput(std::initializer_list<ciface::InputChannel> input_channels);
+  // When devices were last polled by UpdateInput.
+  std::chrono::steady_clock::time_point GetLastInputUpdateTime() const;
 
   // Set adjustment from the full render window aspect-ratio to the drawn aspect-ratio.
   // Used to fit mouse cursor inputs to the relevant region of the render window.
@@ -121,6 +128,8 @@ public:
 
   static void SetCurrentInputChannel(ciface::InputChannel);
   static ciface::InputChannel GetCurrentInputChannel();
+  // A mask of the input channels that the UpdateInput call running on this thread updates.
+  static u32 GetUpdatingInputChannels();
 
   WindowSystemInfo GetWindowSystemInfo() const;
 
@@ -138,6 +147,7 @@ private:
   WindowSystemInfo m_wsi;
   std::atomic<float> m_aspect_ratio_adjustment = 1;
   std::atomic<bool> m_requested_mouse_centering = false;
+  std::atomic<std::chrono::steady_clock::time_point> m_last_input_update_time{};
 
   std::vector<std::unique_ptr<ciface::InputBackend>> m_input_backends;
 };
@@ -150,10 +160,16 @@ class RelativeInputState
 public:
   void Update()
   {
-    const auto channel = int(ControllerInterface::GetCurrentInputChannel());
+    const u32 channels = ControllerInterface::GetUpdatingInputChannels();
+
+    for (int channel = 0; channel != int(InputChannel::Count); ++channel)
+    {
+      if (!(channels & (1u << channel)))
+        continue;
 
-    m_value[channel] = m_delta[channel];
-    m_delta[channel] = {};
+      m_value[channel] = m_delta[channel];
+      m_delta[channel] = {};
+    }
   }
 
   T GetValue() const
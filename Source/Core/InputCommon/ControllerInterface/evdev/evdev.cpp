@@ -4,13 +4,16 @@
 #include "InputCommon/ControllerInterface/evdev/evdev.h"
 
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <fcntl.h>
 #include <libudev.h>
+#include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <unistd.h>
 
@@ -41,6 +44,10 @@ public:
   // separate thread *shrug*
   void CloseDescriptor(int fd) { m_cleanup_thread.Push(fd); }
 
+  // Events of added nodes are read on the input thread as soon as they arrive.
+  void AddInputNode(int fd, libevdev* dev, EventState* state);
+  void RemoveInputNode(int fd);
+
 private:
   std::shared_ptr<evdevDevice>
   FindDeviceWithUniqueIDAndPhysicalLocation(const char* unique_id, const char* physical_location);
@@ -51,10 +58,28 @@ private:
   void StopHotplugThread();
   void HotplugThreadFunc();
 
+  void StartInputThread();
+  void StopInputThread();
+  void InputThreadFunc();
+
   std::thread m_hotplug_thread;
   Common::Flag m_hotplug_thread_running;
   int m_wakeup_eventfd;
 
+  struct InputNode
+  {
+    libevdev* device;
+    EventState* state;
+  };
+
+  std::thread m_input_thread;
+  Common::Flag m_input_thread_running;
+  int m_epoll_fd = -1;
+  int m_input_wakeup_eventfd = -1;
+  // Held by the input thread while it reads events, so nodes aren't freed while in use.
+  std::mutex m_input_nodes_mutex;
+  std::map<int, InputNode> m_input_nodes;
+
   // There is no easy way to get the device name from only a dev node
   // during a device removed event, since libevdev can't work on removed devices;
   // sysfs is not stable, so this is probably the easiest way to get a name for a node.
@@ -74,23 +99,28 @@ std::unique_ptr<ciface::InputBackend> CreateInputBackend(ControllerInterface* co
 class Input : public Core::Device::Input
 {
 public:
-  Input(u16 code, libevdev* dev) : m_code(code), m_dev(dev) {}
+  Input(u16 code, libevdev* dev, const EventState& state)
+      : m_code(code), m_dev(dev), m_state(state)
+  {
+  }
 
 protected:
   const u16 m_code;
   libevdev* const m_dev;
+  const EventState& m_state;
 };
 
 class Button : public Input
 {
 public:
-  Button(u8 index, u16 code, libevdev* dev) : Input(code, dev), m_index(index) {}
+  Button(u8 index, u16 code, libevdev* dev, const EventState& state)
+      : Input(code, dev, state), m_index(index)
+  {
+  }
 
   ControlState GetState() const final override
   {
-    int value = 0;
-    libevdev_fetch_event_value(m_dev, EV_KEY, m_code, &value);
-    return value;
+    return m_state.keys[m_code].load(std::memory_order_relaxed);
   }
 
 protected:
@@ -156,8 +186,7 @@ public:
 
   ControlState GetState() const final override
   {
-    int value = 0;
-    libevdev_fetch_event_value(m_dev, EV_ABS, m_code, &value);
+    const int value = m_state.axes[m_code].load(std::memory_order_relaxed);
 
     return (value - m_base) / m_range;
   }
@@ -170,7 +199,8 @@ protected:
 class Axis : public AnalogInput
 {
 public:
-  Axis(u8 index, u16 code, bool upper, libevdev* dev) : AnalogInput(code, dev), m_index(index)
+  Axis(u8 index, u16 code, bool upper, libevdev* dev, const EventState& state)
+      : AnalogInput(code, dev, state), m_index(index)
   {
     const int min = libevdev_get_abs_minimum(m_dev, m_code);
     const int max = libevdev_get_abs_maximum(m_dev, m_code);
@@ -194,7 +224,9 @@ private:
 class MotionDataInput final : public AnalogInput
 {
 public:
-  MotionDataInput(u16 code, ControlState resolution_scale, libevdev* dev) : AnalogInput(code, dev)
+  MotionDataInput(u16 code, ControlState resolution_scale, libevdev* dev,
+                  const EventState& state)
+      : AnalogInput(code, dev, state)
   {
     auto* const info = libevdev_get_abs_info(m_dev, m_code);
 
@@ -271,7 +303,7 @@ void InputBackend::AddDeviceNode(const char* devnode)
   // Unfortunately udev gives us no way to filter out the non event device interfaces.
   // So we open it and see if it works with evdev ioctls or not.
 
-  // The device file will be read on one of the main threads, so we open in non-blocking mode.
+  // The device file will be read on the input thread, so we open in non-blocking mode.
   const int fd = open(devnode, O_RDWR | O_NONBLOCK);
   if (fd == -1)
   {
@@ -423,9 +455,115 @@ void InputBackend::StopHotplugThread()
   close(m_wakeup_eventfd);
 }
 
+// Reads all pending events of a node into its state. Returns false once the node is gone.
+static bool ReadEvents(libevdev* dev, EventState* state)
+{
+  int rc = LIBEVDEV_READ_STATUS_SUCCESS;
+  while (true)
+  {
+    input_event ev;
+    if (LIBEVDEV_READ_STATUS_SYNC == rc)
+      rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
+    else
+      rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+
+    if (rc < 0)
+      return rc == -EAGAIN;
+
+    if (ev.type == EV_KEY && ev.code < KEY_CNT)
+      state->keys[ev.code].store(ev.value, std::memory_order_relaxed);
+    else if (ev.type == EV_ABS && ev.code < ABS_CNT)
+      state->axes[ev.code].store(ev.value, std::memory_order_relaxed);
+  }
+}
+
+void InputBackend::InputThreadFunc()
+{
+  Common::SetCurrentThreadName("evdev Input Thread");
+
+  std::array<epoll_event, 16> events;
+  while (m_input_thread_running.IsSet())
+  {
+    const int count = epoll_wait(m_epoll_fd, events.data(), int(events.size()), -1);
+
+    std::lock_guard lk(m_input_nodes_mutex);
+    for (int i = 0; i < count; ++i)
+    {
+      // The node might have been removed after epoll_wait returned. This also skips the wakeup fd.
+      const auto it = m_input_nodes.find(events[i].data.fd);
+      if (it == m_input_nodes.end())
+        continue;
+
+      if (!ReadEvents(it->second.device, it->second.state))
+      {
+        // The device was unplugged, stop polling it until the hotplug thread removes it.
+        epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, it->first, nullptr);
+        m_input_nodes.erase(it);
+      }
+    }
+  }
+}
+
+void InputBackend::StartInputThread()
+{
+  if (!m_input_thread_running.TestAndSet())
+    return;
+
+  m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  ASSERT_MSG(CONTROLLERINTERFACE, m_epoll_fd != -1, "Couldn't create epoll instance.");
+  m_input_wakeup_eventfd = eventfd(0, 0);
+  ASSERT_MSG(CONTROLLERINTERFACE, m_input_wakeup_eventfd != -1, "Couldn't create eventfd.");
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = m_input_wakeup_eventfd;
+  epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_input_wakeup_eventfd, &event);
+
+  m_input_thread = std::thread(&InputBackend::InputThreadFunc, this);
+}
+
+void InputBackend::StopInputThread()
+{
+  if (!m_input_thread_running.TestAndClear())
+    return;
+
+  // Write something to efd so that epoll_wait() stops blocking.
+  const uint64_t value = 1;
+  static_cast<void>(!write(m_input_wakeup_eventfd, &value, sizeof(uint64_t)));
+
+  m_input_thread.join();
+
+  std::lock_guard lk(m_input_nodes_mutex);
+  m_input_nodes.clear();
+  close(m_input_wakeup_eventfd);
+  close(m_epoll_fd);
+  m_epoll_fd = -1;
+}
+
+void InputBackend::AddInputNode(int fd, libevdev* dev, EventState* state)
+{
+  std::lock_guard lk(m_input_nodes_mutex);
+  if (m_epoll_fd == -1)
+    return;
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+    m_input_nodes.emplace(fd, InputNode{dev, state});
+}
+
+void InputBackend::RemoveInputNode(int fd)
+{
+  std::lock_guard lk(m_input_nodes_mutex);
+  if (m_input_nodes.erase(fd) != 0)
+    epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
 InputBackend::InputBackend(ControllerInterface* controller_interface)
     : ciface::InputBackend(controller_interface), m_cleanup_thread("evdev cleanup", close)
 {
+  StartInputThread();
   StartHotplugThread();
 }
 
@@ -471,11 +609,29 @@ void InputBackend::PopulateDevices()
 InputBackend::~InputBackend()
 {
   StopHotplugThread();
+  StopInputThread();
 }
 
 bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
 {
-  m_nodes.emplace_back(Node{std::move(devnode), fd, dev});
+  const Node& node =
+      m_nodes.emplace_back(Node{std::move(devnode), fd, dev, std::make_unique<EventState>()});
+  EventState& state = *node.state;
+
+  // libevdev reads the current state of the device when it's created.
+  for (int key = 0; key != KEY_CNT; ++key)
+  {
+    int value = 0;
+    if (libevdev_fetch_event_value(dev, EV_KEY, key, &value))
+      state.keys[key].store(value, std::memory_order_relaxed);
+  }
+  for (int axis = 0; axis != ABS_CNT; ++axis)
+  {
+    int value = 0;
+    if (libevdev_fetch_event_value(dev, EV_ABS, axis, &value))
+      state.axes[axis].store(value, std::memory_order_relaxed);
+  }
+  m_input_backend.AddInputNode(fd, dev, &state);
 
   // Take on the alphabetically first name.
   const auto potential_new_name = StripWhitespace(libevdev_get_name(dev));
@@ -500,15 +656,15 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
       {
         // This node will probably be combined with another with regular buttons.
         // We don't want to match "Button 0" names here as it will name clash.
-        AddInput(new NamedButtonWithNoBackwardsCompat(num_buttons, key, dev));
+        AddInput(new NamedButtonWithNoBackwardsCompat(num_buttons, key, dev, state));
       }
       else if (has_sensible_button_names)
       {
-        AddInput(new NamedButton(num_buttons, key, dev));
+        AddInput(new NamedButton(num_buttons, key, dev, state));
       }
       else
       {
-        AddInput(new NumberedButton(num_buttons, key, dev));
+        AddInput(new NumberedButton(num_buttons, key, dev, state));
       }
 
       ++num_buttons;
@@ -521,14 +677,14 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
   {
     // If INPUT_PROP_ACCELEROMETER is set then X,Y,Z,RX,RY,RZ contain motion data.
 
-    auto add_motion_inputs = [&num_axis, dev, this](int first_code, double scale) {
+    auto add_motion_inputs = [&num_axis, dev, &state, this](int first_code, double scale) {
       for (int i = 0; i != 3; ++i)
       {
         const int code = first_code + i;
         if (libevdev_has_event_code(dev, EV_ABS, code))
         {
-          AddInput(new MotionDataInput(code, scale * -1, dev));
-          AddInput(new MotionDataInput(code, scale, dev));
+          AddInput(new MotionDataInput(code, scale * -1, dev, state));
+          AddInput(new MotionDataInput(code, scale, dev, state));
 
           ++num_axis;
         }
@@ -548,11 +704,11 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
 
   if (is_pointing_device)
   {
-    auto add_cursor_input = [&num_axis, dev, this](int code) {
+    auto add_cursor_input = [&num_axis, dev, &state, this](int code) {
       if (libevdev_has_event_code(dev, EV_ABS, code))
       {
-        AddInput(new CursorInput(num_axis, code, false, dev));
-        AddInput(new CursorInput(num_axis, code, true, dev));
+        AddInput(new CursorInput(num_axis, code, false, dev, state));
+        AddInput(new CursorInput(num_axis, code, true, dev, state));
 
         ++num_axis;
       }
@@ -572,8 +728,8 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
   {
     if (libevdev_has_event_code(dev, EV_ABS, axis))
     {
-      AddFullAnalogSurfaceInputs(new Axis(num_axis, axis, false, dev),
-                                 new Axis(num_axis, axis, true, dev));
+      AddFullAnalogSurfaceInputs(new Axis(num_axis, axis, false, dev, state),
+                                 new Axis(num_axis, axis, true, dev, state));
       ++num_axis;
     }
   }
@@ -673,6 +829,7 @@ evdevDevice::~evdevDevice()
 {
   for (auto& node : m_nodes)
   {
+    m_input_backend.RemoveInputNode(node.fd);
     m_input_backend.RemoveDevnodeObject(node.devnode);
     libevdev_free(node.device);
     m_input_backend.CloseDescriptor(node.fd);
@@ -684,26 +841,6 @@ void InputBackend::RemoveDevnodeObject(const std::string& node)
   m_devnode_objects.erase(node);
 }
 
-Core::DeviceRemoval evdevDevice::UpdateInput()
-{
-  // Run through all evdev events
-  // libevdev will keep track of the actual controller state internally which can be queried
-  // later with libevdev_fetch_event_value()
-  for (auto& node : m_nodes)
-  {
-    int rc = LIBEVDEV_READ_STATUS_SUCCESS;
-    while (rc >= 0)
-    {
-      input_event ev;
-      if (LIBEVDEV_READ_STATUS_SYNC == rc)
-        rc = libevdev_next_event(node.device, LIBEVDEV_READ_FLAG_SYNC, &ev);
-      else
-        rc = libevdev_next_event(node.device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
-    }
-  }
-  return Core::DeviceRemoval::Keep;
-}
-
 bool evdevDevice::IsValid() const
 {
   for (auto& node : m_nodes)
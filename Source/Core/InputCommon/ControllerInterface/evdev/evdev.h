@@ -4,6 +4,9 @@
 #pragma once
 
 #include <libevdev/libevdev.h>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,6 +18,14 @@ class InputBackend;
 
 std::unique_ptr<ciface::InputBackend> CreateInputBackend(ControllerInterface* controller_interface);
 
+// The state of a node's keys and axes. Written by the input thread as events arrive, so polling
+// an input doesn't have to touch the device.
+struct EventState
+{
+  std::array<std::atomic<int>, KEY_CNT> keys{};
+  std::array<std::atomic<int>, ABS_CNT> axes{};
+};
+
 class evdevDevice : public Core::Device
 {
 private:
@@ -72,7 +83,6 @@ private:
   };
 
 public:
-  Core::DeviceRemoval UpdateInput() override;
   bool IsValid() const override;
 
   evdevDevice(InputBackend* input_backend);
@@ -95,6 +105,7 @@ private:
     std::string devnode;
     int fd;
     libevdev* device;
+    std::unique_ptr<EventState> state;
   };
 
   std::vector<Node> m_nodes;
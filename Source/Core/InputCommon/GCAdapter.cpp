@@ -226,7 +226,9 @@ static void ReadThreadFunc()
       // and cleanup program state without getting another thread to call Reset().
     }
 
-    ProcessInputPayload(input_buffer.data(), payload_size);
+    // A failed transfer leaves the buffer uninitialized, so there is nothing to process.
+    if (error == LIBUSB_SUCCESS)
+      ProcessInputPayload(input_buffer.data(), payload_size);
 
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
     const int payload_size = env->CallStaticIntMethod(s_adapter_class, input_func);
@@ -795,17 +797,19 @@ void ProcessInputPayload(const u8* data, std::size_t size)
   }
   else
   {
-    std::lock_guard lk(s_read_mutex);
+    // Decode the whole payload first so that Input() on the CPU thread only ever waits for the
+    // few stores below, not for the decoding.
+    std::array<ControllerType, SerialInterface::MAX_SI_CHANNELS> types;
+    std::array<GCPadStatus, SerialInterface::MAX_SI_CHANNELS> pads{};
 
     for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
     {
       const u8* const channel_data = &data[1 + (9 * chan)];
 
       const auto type = IdentifyControllerType(channel_data[0]);
+      types[chan] = type;
 
-      auto& pad_state = s_port_states[chan];
-
-      GCPadStatus pad = {};
+      GCPadStatus& pad = pads[chan];
 
       if (type != ControllerType::None)
       {
@@ -853,11 +857,21 @@ void ProcessInputPayload(const u8* data, std::size_t size)
         // The corresponding code in DeviceGCAdapter has the same check
         pad.button = PAD_ERR_STATUS;
       }
+    }
+
+    std::lock_guard lk(s_read_mutex);
+
+    for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
+    {
+      const auto type = types[chan];
+      GCPadStatus& pad = pads[chan];
+
+      auto& pad_state = s_port_states[chan];
 
       if (type != ControllerType::None && pad_state.controller_type == ControllerType::None)
       {
         NOTICE_LOG_FMT(CONTROLLERINTERFACE, "New device connected to Port {} of Type: {:02x}",
-                       chan + 1, channel_data[0]);
+                       chan + 1, data[1 + (9 * chan)]);
 
         pad.button |= PAD_GET_ORIGIN;
         pad_state.origin = pad;
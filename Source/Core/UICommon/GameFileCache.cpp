@@ -4,12 +4,15 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -131,13 +134,49 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Creating a GameFile mostly consists of waiting for reads from the file, so this is done on
+  // several threads. The results are added to the cache on this thread as they come in.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::atomic<size_t> next_path = 0;
+  std::mutex new_files_mutex;
+  std::condition_variable new_files_cv;
+  std::vector<std::shared_ptr<GameFile>> new_files;
+  size_t paths_done = 0;
+
+  const auto scan = [&] {
+    for (size_t i = next_path++; i < new_paths.size(); i = next_path++)
+    {
+      std::shared_ptr<GameFile> file;
+      if (!processing_halted)
+        file = std::make_shared<GameFile>(new_paths[i]);
+
+      std::lock_guard lk(new_files_mutex);
+      if (file && file->IsValid())
+        new_files.push_back(std::move(file));
+      ++paths_done;
+      new_files_cv.notify_one();
+    }
+  };
+
+  const size_t thread_count =
+      std::min<size_t>(new_paths.size(), std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::thread> scan_threads;
+  for (size_t i = 0; i < thread_count; ++i)
+    scan_threads.emplace_back(scan);
+
+  size_t paths_added = 0;
+  while (paths_added < new_paths.size())
   {
-    if (processing_halted)
-      break;
+    std::vector<std::shared_ptr<GameFile>> files;
+    {
+      std::unique_lock lk(new_files_mutex);
+      new_files_cv.wait(lk, [&] { return !new_files.empty() || paths_done > paths_added; });
+      files = std::move(new_files);
+      new_files.clear();
+      paths_added = paths_done;
+    }
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    for (std::shared_ptr<GameFile>& file : files)
     {
       if (game_added_to_cache)
         game_added_to_cache(file);
@@ -147,6 +186,9 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     }
   }
 
+  for (std::thread& thread : scan_threads)
+    thread.join();
+
   return cache_changed;
 }
 
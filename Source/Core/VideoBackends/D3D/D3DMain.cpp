@@ -101,6 +101,7 @@ void VideoBackend::FillBackendInfo()
   g_Config.backend_info.bSupportsBackgroundCompiling = true;
   g_Config.backend_info.bSupportsST3CTextures = true;
   g_Config.backend_info.bSupportsBPTCTextures = true;
+  g_Config.backend_info.bSupportsETC2Textures = false;
   g_Config.backend_info.bSupportsEarlyZ = true;
   g_Config.backend_info.bSupportsBBox = true;
   g_Config.backend_info.bSupportsFragmentStoresAndAtomics = true;
@@ -207,6 +207,9 @@ bool VertexManager::UploadTexelBuffer(const void* data, u32 data_size, TexelBuff
   return true;
 }
 
+// Unlike the other backends, the vertices are staged in CPU memory and copied in CommitBuffer().
+// The buffer can't stay mapped during the batch, as texture loading may draw palette conversions
+// before the batch is committed, and D3D11 doesn't allow drawing while a bound buffer is mapped.
 void VertexManager::ResetBuffer(u32 vertex_stride)
 {
   m_base_buffer_pointer = m_cpu_vertex_buffer.data();
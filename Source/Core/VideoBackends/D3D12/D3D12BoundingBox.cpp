@@ -13,6 +13,11 @@ namespace DX12
 {
 D3D12BoundingBox::~D3D12BoundingBox()
 {
+  if (m_queued_readback_pointer)
+  {
+    static constexpr D3D12_RANGE write_range = {0, 0};
+    m_queued_readback_buffer->Unmap(0, &write_range);
+  }
   if (m_gpu_descriptor)
     g_dx_context->GetDescriptorHeapManager().Free(m_gpu_descriptor);
 }
@@ -26,15 +31,20 @@ bool D3D12BoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+void D3D12BoundingBox::CopyToReadbackBuffer(ID3D12Resource* buffer, u32 offset)
 {
-  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
-  g_dx_context->GetCommandList()->CopyBufferRegion(m_readback_buffer.Get(), 0, m_gpu_buffer.Get(),
-                                                   0, BUFFER_SIZE);
+  g_dx_context->GetCommandList()->CopyBufferRegion(buffer, offset, m_gpu_buffer.Get(), 0,
+                                                   BUFFER_SIZE);
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+}
+
+std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+{
+  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
+  CopyToReadbackBuffer(m_readback_buffer.Get(), 0);
   Gfx::GetInstance()->ExecuteCommandList(true);
 
   // Read back to cached values.
@@ -56,6 +66,24 @@ std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool D3D12BoundingBox::QueueReadback(u32 slot)
+{
+  CopyToReadbackBuffer(m_queued_readback_buffer.Get(), slot * BUFFER_SIZE);
+  m_queued_readback_fences[slot] = g_dx_context->GetCurrentFenceValue();
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> D3D12BoundingBox::PollReadback(u32 slot)
+{
+  if (g_dx_context->GetCompletedFenceValue() < m_queued_readback_fences[slot])
+    return std::nullopt;
+
+  // Readback heap resources may stay mapped while the GPU writes to them.
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  std::memcpy(values.data(), m_queued_readback_pointer + slot * BUFFER_SIZE, BUFFER_SIZE);
+  return values;
+}
+
 void D3D12BoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   const u32 copy_size = static_cast<u32>(values.size() * sizeof(BBoxType));
@@ -120,6 +148,24 @@ bool D3D12BoundingBox::CreateBuffers()
   if (FAILED(hr))
     return false;
 
+  buffer_desc.Width = BUFFER_SIZE * MAX_QUEUED_READBACKS;
+  hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &cpu_heap_properties, D3D12_HEAP_FLAG_NONE, &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+      nullptr, IID_PPV_ARGS(&m_queued_readback_buffer));
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Creating bounding box queued readback buffer failed: {}",
+             DX12HRWrap(hr));
+  if (FAILED(hr))
+    return false;
+
+  const D3D12_RANGE read_range = {0, BUFFER_SIZE * MAX_QUEUED_READBACKS};
+  void* mapped_pointer;
+  hr = m_queued_readback_buffer->Map(0, &read_range, &mapped_pointer);
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Map bounding box queued readback buffer failed: {}",
+             DX12HRWrap(hr));
+  if (FAILED(hr))
+    return false;
+  m_queued_readback_pointer = static_cast<const u8*>(mapped_pointer);
+
   if (!m_upload_buffer.AllocateBuffer(STREAM_BUFFER_SIZE))
     return false;
 
@@ -22,6 +22,8 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueReadback(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollReadback(u32 slot) override;
 
 private:
   static constexpr u32 BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
@@ -29,12 +31,18 @@ private:
   static constexpr u32 STREAM_BUFFER_SIZE = BUFFER_SIZE * MAX_UPDATES_PER_FRAME;
 
   bool CreateBuffers();
+  void CopyToReadbackBuffer(ID3D12Resource* buffer, u32 offset);
 
   // Three buffers: GPU for read/write, CPU for reading back, and CPU for staging changes.
   ComPtr<ID3D12Resource> m_gpu_buffer;
   ComPtr<ID3D12Resource> m_readback_buffer;
   StreamBuffer m_upload_buffer;
   DescriptorHandle m_gpu_descriptor{};
+
+  // One slot per queued readback, persistently mapped, and the fence value that fills each slot.
+  ComPtr<ID3D12Resource> m_queued_readback_buffer;
+  const u8* m_queued_readback_pointer = nullptr;
+  std::array<u64, MAX_QUEUED_READBACKS> m_queued_readback_fences = {};
 };
 
 }  // namespace DX12
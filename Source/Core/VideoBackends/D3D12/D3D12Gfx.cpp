@@ -3,6 +3,10 @@
 
 #include "VideoBackends/D3D12/D3D12Gfx.h"
 
+#include <dxgi1_4.h>
+
+#include <fmt/format.h>
+
 #include "Common/Logging/Log.h"
 
 #include "VideoBackends/D3D12/Common.h"
@@ -411,6 +415,29 @@ SurfaceInfo Gfx::GetSurfaceInfo() const
           m_swap_chain ? m_swap_chain->GetFormat() : AbstractTextureFormat::Undefined};
 }
 
+std::string Gfx::GetDriverIdentity() const
+{
+  Microsoft::WRL::ComPtr<IDXGIFactory4> factory;
+  Microsoft::WRL::ComPtr<IDXGIAdapter> adapter;
+  if (FAILED(g_dx_context->GetDXGIFactory()->QueryInterface(IID_PPV_ARGS(&factory))) ||
+      FAILED(factory->EnumAdapterByLuid(g_dx_context->GetDevice()->GetAdapterLuid(),
+                                        IID_PPV_ARGS(&adapter))))
+  {
+    return {};
+  }
+
+  DXGI_ADAPTER_DESC desc;
+  LARGE_INTEGER driver_version;
+  if (FAILED(adapter->GetDesc(&desc)) ||
+      FAILED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driver_version)))
+  {
+    return {};
+  }
+
+  return fmt::format("{:04x}:{:04x}:{:08x}:{:02x}|{:016x}", desc.VendorId, desc.DeviceId,
+                     desc.SubSysId, desc.Revision, static_cast<u64>(driver_version.QuadPart));
+}
+
 void Gfx::OnConfigChanged(u32 bits)
 {
   AbstractGfx::OnConfigChanged(bits);
@@ -659,32 +686,36 @@ void Gfx::UpdateDescriptorTables()
 
 bool Gfx::UpdateSRVDescriptorTable()
 {
-  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> src_sizes = {
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  DescriptorHandle dst_base_handle;
-  const UINT dst_handle_sizes = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
-  if (!g_dx_context->GetDescriptorAllocator()->Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-                                                        &dst_base_handle))
+  D3D12_GPU_DESCRIPTOR_HANDLE handle;
+  if (!g_dx_context->GetDescriptorAllocator()->GetTextureGroupHandle(m_state.textures, &handle))
     return false;
 
-  g_dx_context->GetDevice()->CopyDescriptors(
-      1, &dst_base_handle.cpu_handle, &dst_handle_sizes, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-      m_state.textures.data(), src_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-  m_state.srv_descriptor_base = dst_base_handle.gpu_handle;
-  m_dirty_bits = (m_dirty_bits & ~DirtyState_Textures) | DirtyState_SRV_Descriptor;
+  // Going back to a set of textures that was used earlier gives the same table, which is still
+  // bound unless the root signature changed. That already marks the table dirty itself.
+  m_dirty_bits &= ~DirtyState_Textures;
+  if (handle.ptr != m_state.srv_descriptor_base.ptr)
+  {
+    m_state.srv_descriptor_base = handle;
+    m_dirty_bits |= DirtyState_SRV_Descriptor;
+  }
   return true;
 }
 
 bool Gfx::UpdateSamplerDescriptorTable()
 {
-  if (!g_dx_context->GetSamplerAllocator()->GetGroupHandle(m_state.samplers,
-                                                           &m_state.sampler_descriptor_base))
+  D3D12_GPU_DESCRIPTOR_HANDLE handle;
+  if (!g_dx_context->GetSamplerAllocator()->GetGroupHandle(m_state.samplers, &handle))
   {
     g_dx_context->ResetSamplerAllocators();
     return false;
   }
 
-  m_dirty_bits = (m_dirty_bits & ~DirtyState_Samplers) | DirtyState_Sampler_Descriptor;
+  m_dirty_bits &= ~DirtyState_Samplers;
+  if (handle.ptr != m_state.sampler_descriptor_base.ptr)
+  {
+    m_state.sampler_descriptor_base = handle;
+    m_dirty_bits |= DirtyState_Sampler_Descriptor;
+  }
   return true;
 }
 
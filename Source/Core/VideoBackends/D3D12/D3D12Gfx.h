@@ -72,6 +72,7 @@ public:
   void PresentBackbuffer() override;
 
   SurfaceInfo GetSurfaceInfo() const override;
+  std::string GetDriverIdentity() const override;
 
   // Completes the current render pass, executes the command buffer, and restores state ready for
   // next render. Use when you want to kick the current buffer to make room for new data.
@@ -74,6 +74,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
     ASSERT(!entry.has_value && !entry.resolved);
     entry.has_value = true;
     entry.query_group = group;
+    entry.frame = m_frame_number;
 
     g_dx_context->GetCommandList()->BeginQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_OCCLUSION,
                                                m_query_next_pos);
@@ -144,6 +145,20 @@ bool PerfQuery::IsFlushed() const
   return m_query_count.load(std::memory_order_relaxed) == 0;
 }
 
+void PerfQuery::CollectResults(u64 oldest_frame)
+{
+  // Queries are resolved whenever a command list is executed, so this picks up everything from the
+  // command lists that have finished.
+  ReadbackQueries(false);
+
+  if (m_query_count.load(std::memory_order_relaxed) != 0 &&
+      m_query_buffer[m_query_readback_pos].frame < oldest_frame)
+  {
+    CountStall();
+    FlushResults();
+  }
+}
+
 void PerfQuery::ResolveQueries()
 {
   // Do we need to split the resolve as it's wrapping around?
@@ -27,10 +27,14 @@ public:
   void FlushResults() override;
   bool IsFlushed() const override;
 
+protected:
+  void CollectResults(u64 oldest_frame) override;
+
 private:
   struct ActiveQuery
   {
     u64 fence_value;
+    u64 frame;
     PerfQueryGroup query_group;
     bool has_value;
     bool resolved;
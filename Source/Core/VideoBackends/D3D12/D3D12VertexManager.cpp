@@ -33,9 +33,9 @@ bool VertexManager::Initialize()
   if (!VertexManagerBase::Initialize())
     return false;
 
-  if (!m_vertex_stream_buffer.AllocateBuffer(VERTEX_STREAM_BUFFER_SIZE) ||
-      !m_index_stream_buffer.AllocateBuffer(INDEX_STREAM_BUFFER_SIZE) ||
-      !m_uniform_stream_buffer.AllocateBuffer(UNIFORM_STREAM_BUFFER_SIZE) ||
+  if (!m_vertex_stream_buffer.AllocateBuffer(GetVertexStreamBufferSize()) ||
+      !m_index_stream_buffer.AllocateBuffer(GetIndexStreamBufferSize()) ||
+      !m_uniform_stream_buffer.AllocateBuffer(GetUniformStreamBufferSize()) ||
       !m_texel_stream_buffer.AllocateBuffer(TEXEL_STREAM_BUFFER_SIZE))
   {
     PanicAlertFmt("Failed to allocate streaming buffers");
@@ -3,12 +3,21 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
 #include "VideoCommon/Constants.h"
 
 namespace DX12
 {
+using TextureDescriptorSet =
+    std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>;
+
+struct TextureDescriptorSetLess final
+{
+  bool operator()(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs) const;
+};
+
 class DescriptorAllocator
 {
 public:
@@ -23,6 +32,11 @@ public:
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
   void Reset();
 
+  // Copies the texture descriptors to a table, reusing a table made since the last reset if the
+  // textures are the same. The descriptors of destroyed textures are only freed once the command
+  // list is done, so a set can't be stale before the allocator is reset.
+  bool GetTextureGroupHandle(const TextureDescriptorSet& tds, D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
 protected:
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_descriptor_increment_size = 0;
@@ -31,6 +45,9 @@ protected:
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
+
+  std::map<TextureDescriptorSet, D3D12_GPU_DESCRIPTOR_HANDLE, TextureDescriptorSetLess>
+      m_texture_map;
 };
 
 struct SamplerStateSet final
@@ -287,6 +287,9 @@ void Metal::Gfx::OnConfigChanged(u32 bits)
 {
   AbstractGfx::OnConfigChanged(bits);
 
+  if (bits & CONFIG_CHANGE_BIT_HOST_CONFIG)
+    g_object_cache->ReloadPipelineCache();
+
   if (bits & CONFIG_CHANGE_BIT_VSYNC)
     [m_layer setDisplaySyncEnabled:g_ActiveConfig.bVSyncActive];
 
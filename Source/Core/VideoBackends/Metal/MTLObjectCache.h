@@ -93,6 +93,9 @@ public:
   std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config);
   void ShaderDestroyed(const Shader* shader);
 
+  // Saves the pipeline archive and opens the one for the current game and host config.
+  void ReloadPipelineCache();
+
 private:
   class Internal;
   std::unique_ptr<Internal> m_internal;
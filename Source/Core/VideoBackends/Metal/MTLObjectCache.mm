@@ -3,11 +3,14 @@
 
 #include "VideoBackends/Metal/MTLObjectCache.h"
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <optional>
 
 #include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Metal/MTLPipeline.h"
@@ -16,6 +19,7 @@
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -42,6 +46,7 @@ void Metal::ObjectCache::Initialize(MRCOwned<id<MTLDevice>> device)
   g_device = std::move(device);
   g_queue = MRCTransfer([g_device newCommandQueue]);
   g_object_cache = std::unique_ptr<ObjectCache>(new ObjectCache);
+  g_object_cache->ReloadPipelineCache();
 }
 
 void Metal::ObjectCache::Shutdown()
@@ -380,6 +385,82 @@ public:
   std::map<const Shader*, std::vector<PipelineID>> m_shaders;
   std::array<u32, 3> m_pipeline_counter;
 
+  // id<MTLBinaryArchive>, only set on macOS 11 / iOS 14 and up.  Guarded by m_mtx.
+  MRCOwned<id> m_archive;
+  std::string m_archive_filename;
+  std::atomic<bool> m_archive_dirty{false};
+
+  ~Internal() { SaveArchive(); }
+
+  NSURL* GetArchiveURL() const
+  {
+    return [NSURL fileURLWithPath:[NSString stringWithUTF8String:m_archive_filename.c_str()]];
+  }
+
+  void LoadArchive()
+  {
+    if (!g_ActiveConfig.bShaderCache)
+      return;
+    if (@available(macOS 11, iOS 14, *))
+    {
+      @autoreleasepool
+      {
+        m_archive_filename =
+            GetDiskShaderCacheFileName(APIType::Metal, "PipelineArchive", true, true);
+        NSURL* url = GetArchiveURL();
+        auto desc = MRCTransfer([MTLBinaryArchiveDescriptor new]);
+        NSError* err = nullptr;
+        id<MTLBinaryArchive> archive = nil;
+        if (File::Exists(m_archive_filename))
+        {
+          [desc setUrl:url];
+          archive = [g_device newBinaryArchiveWithDescriptor:desc error:&err];
+          if (!archive)
+          {
+            WARN_LOG_FMT(VIDEO, "Failed to load pipeline archive {}: {}", m_archive_filename,
+                         [[err localizedDescription] UTF8String]);
+            File::Delete(m_archive_filename);
+            [desc setUrl:nil];
+          }
+        }
+        if (!archive)
+          archive = [g_device newBinaryArchiveWithDescriptor:desc error:&err];
+        if (!archive)
+        {
+          ERROR_LOG_FMT(VIDEO, "Failed to create pipeline archive: {}",
+                        [[err localizedDescription] UTF8String]);
+          return;
+        }
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_archive = MRCTransfer(static_cast<id>(archive));
+      }
+    }
+  }
+
+  void SaveArchive()
+  {
+    MRCOwned<id> archive;
+    {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      archive = std::move(m_archive);
+    }
+    if (!archive || !m_archive_dirty.exchange(false))
+      return;
+    if (@available(macOS 11, iOS 14, *))
+    {
+      @autoreleasepool
+      {
+        NSURL* url = GetArchiveURL();
+        NSError* err = nullptr;
+        if (![static_cast<id<MTLBinaryArchive>>(archive.Get()) serializeToURL:url error:&err])
+        {
+          ERROR_LOG_FMT(VIDEO, "Failed to save pipeline archive {}: {}", m_archive_filename,
+                        [[err localizedDescription] UTF8String]);
+        }
+      }
+    }
+  }
+
   StoredPipeline CreatePipeline(const AbstractPipelineConfig& config)
   {
     @autoreleasepool
@@ -439,11 +520,52 @@ public:
         [desc setStencilAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
       NSError* err = nullptr;
       MTLRenderPipelineReflection* reflection = nullptr;
-      id<MTLRenderPipelineState> pipe =
-          [g_device newRenderPipelineStateWithDescriptor:desc
-                                                 options:MTLPipelineOptionArgumentInfo
-                                              reflection:&reflection
-                                                   error:&err];
+      id<MTLRenderPipelineState> pipe = nil;
+      MRCOwned<id> archive;
+      {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        archive = m_archive;
+      }
+      if (archive)
+      {
+        if (@available(macOS 11, iOS 14, *))
+        {
+          // Look the pipeline up in the archive first, and only compile it if it isn't there.
+          [desc setBinaryArchives:@[ archive.Get() ]];
+          pipe = [g_device
+              newRenderPipelineStateWithDescriptor:desc
+                                           options:MTLPipelineOptionArgumentInfo |
+                                                   MTLPipelineOptionFailOnBinaryArchiveMiss
+                                        reflection:&reflection
+                                             error:&err];
+          err = nullptr;
+        }
+      }
+      if (!pipe)
+      {
+        pipe = [g_device newRenderPipelineStateWithDescriptor:desc
+                                                      options:MTLPipelineOptionArgumentInfo
+                                                   reflection:&reflection
+                                                        error:&err];
+        if (archive && !err)
+        {
+          if (@available(macOS 11, iOS 14, *))
+          {
+            NSError* add_err = nullptr;
+            if ([static_cast<id<MTLBinaryArchive>>(archive.Get())
+                    addRenderPipelineFunctionsWithDescriptor:desc
+                                                       error:&add_err])
+            {
+              m_archive_dirty.store(true);
+            }
+            else
+            {
+              WARN_LOG_FMT(VIDEO, "Failed to add pipeline to archive: {}",
+                           [[add_err localizedDescription] UTF8String]);
+            }
+          }
+        }
+      }
       if (err)
       {
         static int counter;
@@ -570,3 +692,9 @@ void Metal::ObjectCache::ShaderDestroyed(const Shader* shader)
 {
   m_internal->ShaderDestroyed(shader);
 }
+
+void Metal::ObjectCache::ReloadPipelineCache()
+{
+  m_internal->SaveArchive();
+  m_internal->LoadArchive();
+}
@@ -260,6 +260,7 @@ void Metal::Util::PopulateBackendInfoFeatures(VideoConfig* config, id<MTLDevice>
   config->backend_info.bSupportsDepthClamp = true;
   config->backend_info.bSupportsST3CTextures = true;
   config->backend_info.bSupportsBPTCTextures = true;
+  config->backend_info.bSupportsETC2Textures = false;
 #else
   bool supports_apple4 = false;
   bool supports_bcn = false;
@@ -272,6 +273,8 @@ void Metal::Util::PopulateBackendInfoFeatures(VideoConfig* config, id<MTLDevice>
   config->backend_info.bSupportsDepthClamp = supports_apple4;
   config->backend_info.bSupportsST3CTextures = supports_bcn;
   config->backend_info.bSupportsBPTCTextures = supports_bcn;
+  // Every iOS GPU supports ETC2, which is used for custom textures when BCn is missing.
+  config->backend_info.bSupportsETC2Textures = true;
 
   config->backend_info.bSupportsFramebufferFetch = true;
 #endif
@@ -345,6 +348,7 @@ AbstractTextureFormat Metal::Util::ToAbstract(MTLPixelFormat format)
   case MTLPixelFormatBC2_RGBA:              return AbstractTextureFormat::DXT3;
   case MTLPixelFormatBC3_RGBA:              return AbstractTextureFormat::DXT5;
   case MTLPixelFormatBC7_RGBAUnorm:         return AbstractTextureFormat::BPTC;
+  case MTLPixelFormatEAC_RGBA8:             return AbstractTextureFormat::ETC2;
   case MTLPixelFormatR16Unorm:              return AbstractTextureFormat::R16;
   case MTLPixelFormatDepth16Unorm:          return AbstractTextureFormat::D16;
 #if TARGET_OS_OSX
@@ -373,6 +377,7 @@ MTLPixelFormat Metal::Util::FromAbstract(AbstractTextureFormat format)
   case AbstractTextureFormat::DXT3:      return MTLPixelFormatBC2_RGBA;
   case AbstractTextureFormat::DXT5:      return MTLPixelFormatBC3_RGBA;
   case AbstractTextureFormat::BPTC:      return MTLPixelFormatBC7_RGBAUnorm;
+  case AbstractTextureFormat::ETC2:      return MTLPixelFormatEAC_RGBA8;
   case AbstractTextureFormat::R16:       return MTLPixelFormatR16Unorm;
   case AbstractTextureFormat::D16:       return MTLPixelFormatDepth16Unorm;
 #if TARGET_OS_OSX
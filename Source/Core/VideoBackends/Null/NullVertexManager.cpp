@@ -3,9 +3,14 @@
 
 #include "VideoBackends/Null/NullVertexManager.h"
 
+#include "Core/Config/GraphicsSettings.h"
+
 namespace Null
 {
-VertexManager::VertexManager() = default;
+VertexManager::VertexManager()
+{
+  m_skip_draws = Config::Get(Config::GFX_NULL_THROUGHPUT_MODE);
+}
 
 VertexManager::~VertexManager() = default;
 
@@ -10,6 +10,13 @@ namespace OGL
 {
 OGLBoundingBox::~OGLBoundingBox()
 {
+  for (GLsync fence : m_queued_readback_fences)
+  {
+    if (fence)
+      glDeleteSync(fence);
+  }
+  if (m_queued_readback_buffer_id)
+    glDeleteBuffers(1, &m_queued_readback_buffer_id);
   if (m_buffer_id)
     glDeleteBuffers(1, &m_buffer_id);
 }
@@ -23,6 +30,12 @@ bool OGLBoundingBox::Initialize()
   glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(initial_values), initial_values, GL_DYNAMIC_DRAW);
   glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_buffer_id);
 
+  glGenBuffers(1, &m_queued_readback_buffer_id);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_queued_readback_buffer_id);
+  glBufferData(GL_COPY_WRITE_BUFFER, sizeof(initial_values) * MAX_QUEUED_READBACKS, nullptr,
+               GL_STREAM_READ);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
   return true;
 }
 
@@ -66,6 +79,56 @@ std::vector<BBoxType> OGLBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool OGLBoundingBox::QueueReadback(u32 slot)
+{
+  constexpr GLsizeiptr size = sizeof(BBoxType) * NUM_BBOX_VALUES;
+
+  // Make the shader writes visible to the copy.
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+  glBindBuffer(GL_COPY_READ_BUFFER, m_buffer_id);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_queued_readback_buffer_id);
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, size * slot, size);
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  if (m_queued_readback_fences[slot])
+    glDeleteSync(m_queued_readback_fences[slot]);
+  m_queued_readback_fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  // Make sure the copy gets submitted, so that the fence can signal without a later wait.
+  glFlush();
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> OGLBoundingBox::PollReadback(u32 slot)
+{
+  constexpr GLsizeiptr size = sizeof(BBoxType) * NUM_BBOX_VALUES;
+
+  GLsync& fence = m_queued_readback_fences[slot];
+  if (!fence)
+    return std::nullopt;
+
+  const GLenum status = glClientWaitSync(fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+    return std::nullopt;
+
+  glDeleteSync(fence);
+  fence = nullptr;
+
+  // The copy is complete, so mapping the buffer doesn't wait. Unlike glGetBufferSubData, this also
+  // works on GLES.
+  std::array<BBoxType, NUM_BBOX_VALUES> values = {};
+  glBindBuffer(GL_COPY_READ_BUFFER, m_queued_readback_buffer_id);
+  const void* ptr = glMapBufferRange(GL_COPY_READ_BUFFER, size * slot, size, GL_MAP_READ_BIT);
+  if (ptr)
+  {
+    std::memcpy(values.data(), ptr, size);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+  }
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  return values;
+}
+
 void OGLBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffer_id);
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLUtil.h"
 
@@ -20,9 +22,15 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueReadback(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollReadback(u32 slot) override;
 
 private:
   GLuint m_buffer_id = 0;
+
+  // One slot per queued readback, and the fence that signals once the copy into it is done.
+  GLuint m_queued_readback_buffer_id = 0;
+  std::array<GLsync, MAX_QUEUED_READBACKS> m_queued_readback_fences = {};
 };
 
 }  // namespace OGL
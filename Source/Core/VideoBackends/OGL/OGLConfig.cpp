@@ -346,6 +346,8 @@ bool PopulateConfig(GLContext* m_main_gl_context)
       GLExtensions::Supports("GL_EXT_texture_compression_s3tc");
   g_Config.backend_info.bSupportsBPTCTextures =
       GLExtensions::Supports("GL_ARB_texture_compression_bptc");
+  // ETC2 is core in GLES 3.0. Desktop drivers expose it too, but usually decompress it in software.
+  g_Config.backend_info.bSupportsETC2Textures = m_main_gl_context->IsGLES();
   g_Config.backend_info.bSupportsCoarseDerivatives =
       GLExtensions::Supports("GL_ARB_derivative_control") || GLExtensions::Version() >= 450;
   g_Config.backend_info.bSupportsTextureQueryLevels =
@@ -19,12 +19,15 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/VideoConfig.h"
 
 #include <algorithm>
 #include <string_view>
 
+#include <fmt/format.h>
+
 namespace OGL
 {
 VideoConfig g_ogl_config;
@@ -135,6 +138,9 @@ OGLGfx::OGLGfx(std::unique_ptr<GLContext> main_gl_context, float backbuffer_scal
     m_current_framebuffer = m_system_framebuffer.get();
   }
 
+  m_main_gl_context->SetPageFlipCallback(
+      [](TimePoint flip_time) { g_perf_metrics.CountPageFlip(flip_time); });
+
   if (!m_main_gl_context->IsGLES())
   {
     // OpenGL 3 doesn't provide GLES like float functions for depth.
@@ -732,4 +738,10 @@ SurfaceInfo OGLGfx::GetSurfaceInfo() const
           AbstractTextureFormat::RGBA8};
 }
 
+std::string OGLGfx::GetDriverIdentity() const
+{
+  return fmt::format("{}|{}|{}", g_ogl_config.gl_vendor, g_ogl_config.gl_renderer,
+                     g_ogl_config.gl_version);
+}
+
 }  // namespace OGL
@@ -91,6 +91,7 @@ public:
   void RestoreFramebufferBinding();
 
   SurfaceInfo GetSurfaceInfo() const override;
+  std::string GetDriverIdentity() const override;
 
 private:
   void CheckForSurfaceChange();
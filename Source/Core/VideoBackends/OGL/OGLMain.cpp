@@ -124,6 +124,9 @@ bool VideoBackend::FillBackendInfo(GLContext* context)
   g_Config.backend_info.bSupportsSSAA = true;
   g_Config.backend_info.bSupportsReversedDepthRange = true;
   g_Config.backend_info.bSupportsLogicOp = true;
+  // GL calls must be made on the thread that owns the context, and a lot of the GL state is
+  // used implicitly (bound objects, mapped stream buffers). Moving submission to another thread
+  // would mean recording and replaying the whole API, so devices that need this should use Vulkan.
   g_Config.backend_info.bSupportsMultithreading = false;
   g_Config.backend_info.bSupportsCopyToVram = true;
   g_Config.backend_info.bSupportsLargePoints = true;
@@ -150,6 +153,7 @@ bool VideoBackend::FillBackendInfo(GLContext* context)
   g_Config.backend_info.bSupportsDepthClamp = true;
   g_Config.backend_info.bSupportsST3CTextures = false;
   g_Config.backend_info.bSupportsBPTCTextures = false;
+  g_Config.backend_info.bSupportsETC2Textures = false;
   g_Config.backend_info.bSupportsCoarseDerivatives = false;
   g_Config.backend_info.bSupportsTextureQueryLevels = false;
   g_Config.backend_info.bSupportsSettingObjectNames = false;
@@ -27,6 +27,8 @@ GLenum OGLTexture::GetGLInternalFormatForTextureFormat(AbstractTextureFormat for
     return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
   case AbstractTextureFormat::BPTC:
     return GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+  case AbstractTextureFormat::ETC2:
+    return GL_COMPRESSED_RGBA8_ETC2_EAC;
   case AbstractTextureFormat::RGBA8:
     return storage ? GL_RGBA8 : GL_RGBA;
   case AbstractTextureFormat::BGRA8:
@@ -56,8 +56,8 @@ bool VertexManager::Initialize()
   if (!VertexManagerBase::Initialize())
     return false;
 
-  m_vertex_buffer = StreamBuffer::Create(GL_ARRAY_BUFFER, VERTEX_STREAM_BUFFER_SIZE);
-  m_index_buffer = StreamBuffer::Create(GL_ELEMENT_ARRAY_BUFFER, INDEX_STREAM_BUFFER_SIZE);
+  m_vertex_buffer = StreamBuffer::Create(GL_ARRAY_BUFFER, GetVertexStreamBufferSize());
+  m_index_buffer = StreamBuffer::Create(GL_ELEMENT_ARRAY_BUFFER, GetIndexStreamBufferSize());
   if (g_ActiveConfig.UseVSForLinePointExpand() ||
       g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
   {
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -40,6 +41,7 @@
 namespace OGL
 {
 u32 ProgramShaderCache::s_ubo_buffer_size;
+u32 ProgramShaderCache::s_last_constants_offset = std::numeric_limits<u32>::max();
 s32 ProgramShaderCache::s_ubo_align = 1;
 GLuint ProgramShaderCache::s_attributeless_VBO = 0;
 GLuint ProgramShaderCache::s_attributeless_VAO = 0;
@@ -227,55 +229,72 @@ void ProgramShaderCache::UploadConstants()
   auto& pixel_shader_manager = system.GetPixelShaderManager();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
-  if (pixel_shader_manager.dirty || vertex_shader_manager.dirty || geometry_shader_manager.dirty ||
-      pixel_shader_manager.custom_constants_dirty)
+  if (!pixel_shader_manager.dirty && !vertex_shader_manager.dirty &&
+      !geometry_shader_manager.dirty && !pixel_shader_manager.custom_constants_dirty)
   {
-    const u32 custom_constants_size = static_cast<u32>(
-        Common::AlignUp(pixel_shader_manager.custom_constants.size(), s_ubo_align));
-    auto buffer = s_buffer->Map(s_ubo_buffer_size + custom_constants_size, s_ubo_align);
+    return;
+  }
 
-    memcpy(buffer.first, &pixel_shader_manager.constants, sizeof(PixelShaderConstants));
+  const u32 custom_constants_size = static_cast<u32>(
+      Common::AlignUp(pixel_shader_manager.custom_constants.size(), s_ubo_align));
+  auto buffer = s_buffer->Map(s_ubo_buffer_size + custom_constants_size, s_ubo_align);
 
-    u64 size = Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align);
+  // Only the stages that changed are copied and re-bound, the others keep pointing at an earlier
+  // allocation. That is only valid until the buffer wraps around or gets orphaned, after which
+  // the old ranges may be overwritten, so everything is uploaded again.
+  const bool upload_all = buffer.second <= s_last_constants_offset;
+  s_last_constants_offset = buffer.second;
+
+  u32 size = 0;
+  u32 uploaded_size = 0;
+  if (upload_all || pixel_shader_manager.dirty)
+  {
+    memcpy(buffer.first + size, &pixel_shader_manager.constants, sizeof(PixelShaderConstants));
+    glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second + size,
+                      sizeof(PixelShaderConstants));
+    uploaded_size += sizeof(PixelShaderConstants);
+  }
+  size += Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align);
 
+  if (upload_all || vertex_shader_manager.dirty)
+  {
     memcpy(buffer.first + size, &vertex_shader_manager.constants, sizeof(VertexShaderConstants));
-    size += Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align);
+    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer, buffer.second + size,
+                      sizeof(VertexShaderConstants));
+    uploaded_size += sizeof(VertexShaderConstants);
+  }
+  size += Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align);
 
-    if (!pixel_shader_manager.custom_constants.empty())
+  if (!pixel_shader_manager.custom_constants.empty())
+  {
+    if (upload_all || pixel_shader_manager.custom_constants_dirty)
     {
       memcpy(buffer.first + size, pixel_shader_manager.custom_constants.data(),
              pixel_shader_manager.custom_constants.size());
-      size += custom_constants_size;
+      glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer, buffer.second + size,
+                        pixel_shader_manager.custom_constants.size());
+      uploaded_size += static_cast<u32>(pixel_shader_manager.custom_constants.size());
     }
+    size += custom_constants_size;
+  }
 
+  if (upload_all || geometry_shader_manager.dirty)
+  {
     memcpy(buffer.first + size, &geometry_shader_manager.constants,
            sizeof(GeometryShaderConstants));
-
-    s_buffer->Unmap(s_ubo_buffer_size + custom_constants_size);
-
-    glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
-                      sizeof(PixelShaderConstants));
-    size = Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align);
-    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer, buffer.second + size,
-                      sizeof(VertexShaderConstants));
-    size += Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align);
-
-    if (!pixel_shader_manager.custom_constants.empty())
-    {
-      glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer, buffer.second + size,
-                        pixel_shader_manager.custom_constants.size());
-      size += Common::AlignUp(pixel_shader_manager.custom_constants.size(), s_ubo_align);
-    }
     glBindBufferRange(GL_UNIFORM_BUFFER, 4, s_buffer->m_buffer, buffer.second + size,
                       sizeof(GeometryShaderConstants));
+    uploaded_size += sizeof(GeometryShaderConstants);
+  }
 
-    pixel_shader_manager.dirty = false;
-    vertex_shader_manager.dirty = false;
-    geometry_shader_manager.dirty = false;
-    pixel_shader_manager.custom_constants_dirty = false;
+  s_buffer->Unmap(s_ubo_buffer_size + custom_constants_size);
 
-    ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, s_ubo_buffer_size + custom_constants_size);
-  }
+  pixel_shader_manager.dirty = false;
+  vertex_shader_manager.dirty = false;
+  geometry_shader_manager.dirty = false;
+  pixel_shader_manager.custom_constants_dirty = false;
+
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, uploaded_size);
 }
 
 void ProgramShaderCache::UploadConstants(const void* data, u32 data_size)
@@ -290,6 +309,9 @@ void ProgramShaderCache::UploadConstants(const void* data, u32 data_size)
   for (u32 index = 1; index <= 4; index++)
     glBindBufferRange(GL_UNIFORM_BUFFER, index, s_buffer->m_buffer, buffer.second, data_size);
 
+  // The GX constants have to be bound again in full.
+  s_last_constants_offset = std::numeric_limits<u32>::max();
+
   ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, data_size);
 }
 
@@ -470,7 +492,9 @@ void ProgramShaderCache::Init()
   // We multiply by *4*4 because we need to get down to basic machine units.
   // So multiply by four to get how many floats we have from vec4s
   // Then once more to get bytes
-  s_buffer = StreamBuffer::Create(GL_UNIFORM_BUFFER, VertexManagerBase::UNIFORM_STREAM_BUFFER_SIZE);
+  s_buffer =
+      StreamBuffer::Create(GL_UNIFORM_BUFFER, VertexManagerBase::GetUniformStreamBufferSize());
+  s_last_constants_offset = std::numeric_limits<u32>::max();
 
   CreateHeader();
   CreateAttributelessVAO();
@@ -114,6 +114,7 @@ private:
   static std::mutex s_pipeline_program_lock;
 
   static u32 s_ubo_buffer_size;
+  static u32 s_last_constants_offset;
   static s32 s_ubo_align;
 
   static GLuint s_attributeless_VBO;
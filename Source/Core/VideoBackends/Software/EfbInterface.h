@@ -58,5 +58,6 @@ void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>
 
 u32 GetPerfQueryResult(PerfQueryType type);
 void ResetPerfQuery();
-void IncPerfCounterQuadCount(PerfQueryType type);
+// Counts pixel_count pixels towards a counter, which is incremented once per quad.
+void IncPerfCounterQuadCount(PerfQueryType type, u32 pixel_count);
 }  // namespace EfbInterface
@@ -4,11 +4,20 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
@@ -25,6 +34,12 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// Size of the screen tiles that triangles are binned into when rasterizing on several threads.
+// Must be a multiple of BLOCK_SIZE, so that no block is split between tiles.
+static constexpr s32 TILE_SIZE = 32;
+static constexpr u32 TILES_WIDE = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 TILES_HIGH = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -96,21 +111,116 @@ struct Slope
   }
 };
 
+// Everything that is needed to rasterize a triangle after setup.
+struct TriangleSetup
+{
+  Slope z;
+  Slope w;
+  Slope color[2][4];
+  Slope tex[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed-point
+  s32 c1, c2, c3;
+  s32 dx12, dx23, dx31;
+  s32 dy12, dy23, dy31;
+
+  // Bounding rectangle, clipped to the scissor
+  s32 minx, maxx, miny, maxy;
+};
+
+// The state used while drawing pixels, of which each rasterizer thread has its own.
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock block;
+  u32 rasterized_pixels = 0;
+};
+
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static RasterContext s_context;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// Tile-binned rasterization. Triangles are set up on the GPU thread and binned into every tile that
+// their bounding rectangle touches. Once the batch ends, the tiles are handed out to the worker
+// threads and the GPU thread, which draw the triangles of the tile in order. Each pixel is only
+// touched by one thread, in the same order as the serial rasterizer, so the output is identical.
+static std::vector<TriangleSetup> s_triangles;
+static std::array<std::vector<u32>, TILES_WIDE * TILES_HIGH> s_tile_bins;
+
+static std::vector<std::unique_ptr<RasterContext>> s_worker_contexts;
+static std::vector<std::thread> s_worker_threads;
+static std::mutex s_worker_mutex;
+static std::condition_variable s_work_available;
+static std::condition_variable s_work_done;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_exit_workers = false;
+static std::atomic<u32> s_next_tile = 0;
+
+static void RasterizeTiles(RasterContext& context);
+
+static void WorkerThread(RasterContext* context)
+{
+  Common::SetCurrentThreadName("SW Rasterizer");
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lock(s_worker_mutex);
+      s_work_available.wait(lock,
+                            [&] { return s_exit_workers || s_work_generation != generation; });
+      if (s_exit_workers)
+        return;
+      generation = s_work_generation;
+    }
+
+    RasterizeTiles(*context);
+
+    std::lock_guard lock(s_worker_mutex);
+    if (--s_busy_workers == 0)
+      s_work_done.notify_one();
+  }
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  // The GPU thread rasterizes as well, so one thread less is needed.
+  const int threads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  const u32 num_workers =
+      threads < 0 ? std::max(std::thread::hardware_concurrency(), 1u) - 1 :
+                    static_cast<u32>(std::max(threads, 1) - 1);
+
+  s_exit_workers = false;
+  s_work_generation = 0;
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    s_worker_contexts.push_back(std::make_unique<RasterContext>());
+    s_worker_threads.emplace_back(WorkerThread, s_worker_contexts.back().get());
+  }
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lock(s_worker_mutex);
+    s_exit_workers = true;
+  }
+  s_work_available.notify_all();
+  for (std::thread& thread : s_worker_threads)
+    thread.join();
+
+  s_worker_threads.clear();
+  s_worker_contexts.clear();
+  s_triangles.clear();
+  for (std::vector<u32>& bin : s_tile_bins)
+    bin.clear();
 }
 
 void ScissorChanged()
@@ -142,29 +252,35 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  s_context.tev.SetKonstColors();
+  for (const auto& context : s_worker_contexts)
+    context->tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(const TriangleSetup& triangle, RasterContext& context, s32 x, s32 y, s32 xi,
+                 s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  context.rasterized_pixels++;
+
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.block;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(triangle.z.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.IncPerfCounter(PQ_ZCOMP_INPUT_ZCOMPLOC);
     if (bpmem.zmode.testenable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.IncPerfCounter(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +291,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)triangle.color[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +323,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +335,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,7 +375,8 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(const TriangleSetup& triangle, RasterBlock& rasterBlock, s32 blockX,
+                       s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -269,19 +387,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / triangle.w.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = triangle.tex[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = triangle.tex[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = triangle.tex[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +409,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +422,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,34 +440,20 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+static void RasterizeTriangle(const TriangleSetup& triangle, RasterContext& context, s32 minx,
+                              s32 maxx, s32 miny, s32 maxy)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
-
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
-
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+  const s32 C1 = triangle.c1;
+  const s32 C2 = triangle.c2;
+  const s32 C3 = triangle.c3;
 
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
+  const s32 DX12 = triangle.dx12;
+  const s32 DX23 = triangle.dx23;
+  const s32 DX31 = triangle.dx31;
 
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = triangle.dy12;
+  const s32 DY23 = triangle.dy23;
+  const s32 DY31 = triangle.dy31;
 
   // Fixed-point deltas
   const s32 FDX12 = DX12 * 16;
@@ -358,62 +464,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
-
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
-
-  if (minx >= maxx || miny >= maxy)
-    return;
-
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    for (int comp = 0; comp < 3; comp++)
-    {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
-    }
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
-
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
@@ -455,7 +505,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(triangle, context.block, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +515,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(triangle, context, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +538,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(triangle, context, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -505,6 +555,134 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void RasterizeTiles(RasterContext& context)
+{
+  for (u32 tile = s_next_tile++; tile < s_tile_bins.size(); tile = s_next_tile++)
+  {
+    const s32 tile_x = static_cast<s32>(tile % TILES_WIDE) * TILE_SIZE;
+    const s32 tile_y = static_cast<s32>(tile / TILES_WIDE) * TILE_SIZE;
+    for (const u32 index : s_tile_bins[tile])
+    {
+      const TriangleSetup& triangle = s_triangles[index];
+      const s32 minx = std::max(triangle.minx, tile_x);
+      const s32 maxx = std::min(triangle.maxx, tile_x + TILE_SIZE);
+      const s32 miny = std::max(triangle.miny, tile_y);
+      const s32 maxy = std::min(triangle.maxy, tile_y + TILE_SIZE);
+      RasterizeTriangle(triangle, context, minx, maxx, miny, maxy);
+    }
+  }
+}
+
+static void BinTriangle(const TriangleSetup& triangle)
+{
+  const u32 index = static_cast<u32>(s_triangles.size());
+  s_triangles.push_back(triangle);
+
+  for (s32 y = triangle.miny / TILE_SIZE; y <= (triangle.maxy - 1) / TILE_SIZE; y++)
+  {
+    for (s32 x = triangle.minx / TILE_SIZE; x <= (triangle.maxx - 1) / TILE_SIZE; x++)
+      s_tile_bins[y * TILES_WIDE + x].push_back(index);
+  }
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  TriangleSetup triangle;
+
+  // Deltas
+  const s32 DX12 = triangle.dx12 = X1 - X2;
+  const s32 DX23 = triangle.dx23 = X2 - X3;
+  const s32 DX31 = triangle.dx31 = X3 - X1;
+
+  const s32 DY12 = triangle.dy12 = Y1 - Y2;
+  const s32 DY23 = triangle.dy23 = Y2 - Y3;
+  const s32 DY31 = triangle.dy31 = Y3 - Y1;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = triangle.minx = std::max(minx, scissor.rect.left);
+  maxx = triangle.maxx = std::min(maxx, scissor.rect.right);
+  miny = triangle.miny = std::max(miny, scissor.rect.top);
+  maxy = triangle.maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  // Set up the remaining slopes
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  triangle.z = ZSlope;
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  triangle.w = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      triangle.color[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    for (int comp = 0; comp < 3; comp++)
+    {
+      triangle.tex[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                                    v2->texCoords[i][comp] * w[2], ctx);
+    }
+  }
+
+  // Half-edge constants
+  triangle.c1 = DY12 * X1 - DX12 * Y1;
+  triangle.c2 = DY23 * X2 - DX23 * Y2;
+  triangle.c3 = DY31 * X3 - DX31 * Y3;
+
+  // Correct for fill convention
+  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
+    triangle.c1++;
+  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
+    triangle.c2++;
+  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
+    triangle.c3++;
+
+  if (s_worker_threads.empty())
+    RasterizeTriangle(triangle, s_context, minx, maxx, miny, maxy);
+  else
+    BinTriangle(triangle);
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -513,4 +691,40 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   for (const auto& scissor : scissors)
     DrawTriangleFrontFace(v0, v1, v2, scissor);
 }
+
+static void FlushCounters(RasterContext& context)
+{
+  context.tev.FlushCounters();
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, context.rasterized_pixels);
+  context.rasterized_pixels = 0;
+}
+
+void Flush()
+{
+  if (!s_triangles.empty())
+  {
+    {
+      std::lock_guard lock(s_worker_mutex);
+      s_next_tile = 0;
+      s_busy_workers = static_cast<u32>(s_worker_threads.size());
+      s_work_generation++;
+    }
+    s_work_available.notify_all();
+
+    RasterizeTiles(s_context);
+
+    {
+      std::unique_lock lock(s_worker_mutex);
+      s_work_done.wait(lock, [] { return s_busy_workers == 0; });
+    }
+
+    s_triangles.clear();
+    for (std::vector<u32>& bin : s_tile_bins)
+      bin.clear();
+  }
+
+  FlushCounters(s_context);
+  for (const auto& context : s_worker_contexts)
+    FlushCounters(*context);
+}
 }  // namespace Rasterizer
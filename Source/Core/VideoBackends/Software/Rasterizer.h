@@ -10,6 +10,7 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -17,6 +18,10 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
+// Finishes drawing the triangles of the current batch, which may have been deferred to the
+// rasterizer threads, and applies their counters.
+void Flush();
+
 void SetTevKonstColors();
 
 struct RasterBlockPixel
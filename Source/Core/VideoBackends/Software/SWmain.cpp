@@ -76,6 +76,7 @@ void VideoSoftware::InitBackendInfo(const WindowSystemInfo& wsi)
   g_Config.backend_info.bSupportsGPUTextureDecoding = false;
   g_Config.backend_info.bSupportsST3CTextures = false;
   g_Config.backend_info.bSupportsBPTCTextures = false;
+  g_Config.backend_info.bSupportsETC2Textures = false;
   g_Config.backend_info.bSupportsCopyToVram = false;
   g_Config.backend_info.bSupportsLargePoints = false;
   g_Config.backend_info.bSupportsDepthReadback = false;
@@ -115,5 +116,6 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -391,7 +391,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  m_pixels_in++;
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -660,21 +660,23 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    IncPerfCounter(PQ_ZCOMP_INPUT);
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    IncPerfCounter(PQ_ZCOMP_OUTPUT);
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  m_bbox_left = std::min(m_bbox_left, static_cast<u16>(Position[0] & ~1));
+  m_bbox_right = std::max(m_bbox_right, static_cast<u16>(Position[0] | 1));
+  m_bbox_top = std::min(m_bbox_top, static_cast<u16>(Position[1] & ~1));
+  m_bbox_bottom = std::max(m_bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  m_pixels_out++;
+  IncPerfCounter(PQ_BLEND_INPUT);
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -692,3 +694,25 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::FlushCounters()
+{
+  for (u32 i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (m_perf_pixel_counts[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i), m_perf_pixel_counts[i]);
+  }
+  m_perf_pixel_counts = {};
+
+  if (m_pixels_out != 0)
+    BBoxManager::Update(m_bbox_left, m_bbox_right, m_bbox_top, m_bbox_bottom);
+  m_bbox_left = 0xFFFF;
+  m_bbox_right = 0;
+  m_bbox_top = 0xFFFF;
+  m_bbox_bottom = 0;
+
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, m_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, m_pixels_out);
+  m_pixels_in = 0;
+  m_pixels_out = 0;
+}
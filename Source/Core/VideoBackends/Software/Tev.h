@@ -7,6 +7,7 @@
 
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -212,6 +213,15 @@ class Tev
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
+  // Side effects that don't belong to a single pixel, applied by FlushCounters.
+  std::array<u32, PQ_NUM_MEMBERS> m_perf_pixel_counts{};
+  u32 m_pixels_in = 0;
+  u32 m_pixels_out = 0;
+  u16 m_bbox_left = 0xFFFF;
+  u16 m_bbox_right = 0;
+  u16 m_bbox_top = 0xFFFF;
+  u16 m_bbox_bottom = 0;
+
 public:
   s32 Position[3]{};
   u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
@@ -231,4 +241,11 @@ public:
 
   void SetKonstColors();
   void Draw();
+
+  void IncPerfCounter(PerfQueryType type) { ++m_perf_pixel_counts[type]; }
+
+  // The performance counters, bounding box and statistics are only updated by FlushCounters, so
+  // that several instances can draw into different parts of the EFB at the same time. It must not
+  // be called concurrently with other instances.
+  void FlushCounters();
 };
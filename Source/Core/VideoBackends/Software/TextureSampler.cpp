@@ -5,8 +5,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <span>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
@@ -70,6 +77,59 @@ static inline void AddTexel(const u8* inTexel, u32* outTexel, u32 fract)
   outTexel[3] += inTexel[3] * fract;
 }
 
+// Blends the texels at (s, t), (s+1, t), (s, t+1) and (s+1, t+1). The weights fit in 16 bits, so
+// all four channels are computed at once with 16x16->32-bit multiplies.
+static inline void FilterTexels(const u8 (&texels)[4][4], int fractS, int fractT, u8* sample)
+{
+  const u32 weights[4] = {
+      static_cast<u32>((128 - fractS) * (128 - fractT)),
+      static_cast<u32>(fractS * (128 - fractT)),
+      static_cast<u32>((128 - fractS) * fractT),
+      static_cast<u32>(fractS * fractT),
+  };
+
+  u32 packed[4];
+  std::memcpy(packed, texels, sizeof(packed));
+
+#if defined(_M_X86_64)
+  // Interleave the channels of two texels, so that one madd computes a channel of both.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i t01 = _mm_unpacklo_epi8(
+      _mm_unpacklo_epi8(_mm_cvtsi32_si128(packed[0]), _mm_cvtsi32_si128(packed[1])), zero);
+  const __m128i t23 = _mm_unpacklo_epi8(
+      _mm_unpacklo_epi8(_mm_cvtsi32_si128(packed[2]), _mm_cvtsi32_si128(packed[3])), zero);
+  const __m128i w01 = _mm_set1_epi32(static_cast<int>(weights[0] | (weights[1] << 16)));
+  const __m128i w23 = _mm_set1_epi32(static_cast<int>(weights[2] | (weights[3] << 16)));
+  __m128i result = _mm_add_epi32(_mm_madd_epi16(t01, w01), _mm_madd_epi16(t23, w23));
+  result = _mm_srli_epi32(result, 14);
+  result = _mm_packs_epi32(result, result);
+  result = _mm_packus_epi16(result, result);
+  const u32 out = static_cast<u32>(_mm_cvtsi128_si32(result));
+  std::memcpy(sample, &out, sizeof(out));
+#elif defined(_M_ARM_64)
+  const auto widen = [](u32 texel) { return vget_low_u16(vmovl_u8(vcreate_u8(texel))); };
+  uint32x4_t result = vmull_n_u16(widen(packed[0]), static_cast<u16>(weights[0]));
+  result = vmlal_n_u16(result, widen(packed[1]), static_cast<u16>(weights[1]));
+  result = vmlal_n_u16(result, widen(packed[2]), static_cast<u16>(weights[2]));
+  result = vmlal_n_u16(result, widen(packed[3]), static_cast<u16>(weights[3]));
+  const uint16x4_t narrowed = vshrn_n_u32(result, 14);
+  const uint8x8_t out = vmovn_u16(vcombine_u16(narrowed, narrowed));
+  const u32 out_texel = vget_lane_u32(vreinterpret_u32_u8(out), 0);
+  std::memcpy(sample, &out_texel, sizeof(out_texel));
+#else
+  u32 texel[4];
+  SetTexel(texels[0], texel, weights[0]);
+  AddTexel(texels[1], texel, weights[1]);
+  AddTexel(texels[2], texel, weights[2]);
+  AddTexel(texels[3], texel, weights[3]);
+
+  sample[0] = (u8)(texel[0] >> 14);
+  sample[1] = (u8)(texel[1] >> 14);
+  sample[2] = (u8)(texel[2] >> 14);
+  sample[3] = (u8)(texel[3] >> 14);
+#endif
+}
+
 void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
 {
   int baseMip = 0;
@@ -194,8 +254,7 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     int imageTPlus1 = imageT + 1;
     const int fractT = t & 0x7f;
 
-    u8 sampledTex[4];
-    u32 texel[4];
+    u8 texels[4][4];
 
     WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
@@ -204,45 +263,28 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
     if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
     {
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageT, image_width_minus_1, texfmt,
+      TexDecoder_DecodeTexel(texels[0], image_src, imageS, imageT, image_width_minus_1, texfmt,
                              tlut, tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageT, image_width_minus_1,
+      TexDecoder_DecodeTexel(texels[1], image_src, imageSPlus1, imageT, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageTPlus1, image_width_minus_1,
+      TexDecoder_DecodeTexel(texels[2], image_src, imageS, imageTPlus1, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageTPlus1, image_width_minus_1,
+      TexDecoder_DecodeTexel(texels[3], image_src, imageSPlus1, imageTPlus1, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
     else
     {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageT,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[0], image_src, image_src_odd, imageS, imageT,
                                           image_width_minus_1);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1, imageT,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[1], image_src, image_src_odd, imageSPlus1, imageT,
                                           image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageTPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[2], image_src, image_src_odd, imageS, imageTPlus1,
                                           image_width_minus_1);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[3], image_src, image_src_odd, imageSPlus1,
                                           imageTPlus1, image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
 
-    sample[0] = (u8)(texel[0] >> 14);
-    sample[1] = (u8)(texel[1] >> 14);
-    sample[2] = (u8)(texel[2] >> 14);
-    sample[3] = (u8)(texel[3] >> 14);
+    FilterTexels(texels, fractS, fractT, sample);
   }
   else
   {
@@ -439,6 +439,13 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
                                      &present_image_index,
                                      nullptr};
 
+    VkPresentIdKHR present_id = {VK_STRUCTURE_TYPE_PRESENT_ID_KHR, nullptr, 1, &m_last_present_id};
+    if (g_vulkan_context->SupportsPresentWait())
+    {
+      m_last_present_id++;
+      present_info.pNext = &present_id;
+    }
+
     m_last_present_result = vkQueuePresentKHR(g_vulkan_context->GetPresentQueue(), &present_info);
     m_last_present_done.Set();
     if (m_last_present_result != VK_SUCCESS)
@@ -463,6 +470,26 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
   }
 }
 
+void CommandBufferManager::WaitForLastPresent(VkSwapchainKHR swap_chain)
+{
+  WaitForWorkerThreadIdle();
+  if (!g_vulkan_context->SupportsPresentWait() || m_last_present_id == 0 ||
+      m_last_present_result != VK_SUCCESS)
+  {
+    return;
+  }
+
+  // Don't hang if the display stops taking presents, e.g. while the window is minimized.
+  constexpr u64 TIMEOUT_NS = 100'000'000;
+  const VkResult res = vkWaitForPresentKHR(g_vulkan_context->GetDevice(), swap_chain,
+                                           m_last_present_id, TIMEOUT_NS);
+  if (res != VK_SUCCESS && res != VK_TIMEOUT && res != VK_SUBOPTIMAL_KHR &&
+      res != VK_ERROR_OUT_OF_DATE_KHR)
+  {
+    LOG_VULKAN_ERROR(res, "vkWaitForPresentKHR failed: ");
+  }
+}
+
 void CommandBufferManager::BeginCommandBuffer()
 {
   // Move to the next command buffer.
@@ -94,6 +94,10 @@ public:
   VkResult GetLastPresentResult() const { return m_last_present_result; }
   bool CheckLastPresentDone() { return m_last_present_done.TestAndClear(); }
 
+  // Waits until the last present has reached the display. Returns right away if the device
+  // doesn't support VK_KHR_present_wait.
+  void WaitForLastPresent(VkSwapchainKHR swap_chain);
+
   // Schedule a vulkan resource for destruction later on. This will occur when the command buffer
   // is next re-used, and the GPU has finished working with the specified resource.
   void DeferBufferViewDestruction(VkBufferView object);
@@ -166,6 +170,8 @@ private:
   Common::Flag m_last_present_failed;
   Common::Flag m_last_present_done;
   VkResult m_last_present_result = VK_SUCCESS;
+  // Only written by the thread that presents, like m_last_present_result.
+  u64 m_last_present_id = 0;
   bool m_use_threaded_submission = false;
   u32 m_descriptor_set_count = DESCRIPTOR_SETS_PER_POOL;
 };
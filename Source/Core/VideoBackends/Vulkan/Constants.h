@@ -93,4 +93,7 @@ constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
 // large anyway, so it's only really an issue for HD texture packs, and memory is not
 // a limiting factor in these scenarios anyway.
 constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+
+// Those staging buffers are kept for reuse until they add up to this size.
+constexpr u32 MAX_UPLOAD_STAGING_BUFFER_POOL_SIZE = 64 * 1024 * 1024;
 }  // namespace Vulkan
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <type_traits>
 
 #include "Common/Assert.h"
@@ -17,6 +18,7 @@
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/ShaderCompiler.h"
+#include "VideoBackends/Vulkan/StagingBuffer.h"
 #include "VideoBackends/Vulkan/VKStreamBuffer.h"
 #include "VideoBackends/Vulkan/VKTexture.h"
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
@@ -37,7 +39,9 @@ ObjectCache::~ObjectCache()
   DestroyPipelineLayouts();
   DestroyDescriptorSetLayouts();
   DestroyRenderPassCache();
+  DestroyPipelineLibraryCache();
   m_dummy_texture.reset();
+  m_upload_staging_buffer_pool.clear();
 }
 
 bool ObjectCache::Initialize()
@@ -79,6 +83,52 @@ void ObjectCache::Shutdown()
     SavePipelineCache();
 }
 
+std::unique_ptr<StagingBuffer> ObjectCache::AcquireTextureUploadStagingBuffer(VkDeviceSize size)
+{
+  // Take the smallest buffer that fits and that the GPU is done with.
+  const u64 completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
+  auto best = m_upload_staging_buffer_pool.end();
+  for (auto it = m_upload_staging_buffer_pool.begin(); it != m_upload_staging_buffer_pool.end();
+       ++it)
+  {
+    if (it->fence_counter <= completed_fence_counter && it->buffer->GetSize() >= size &&
+        (best == m_upload_staging_buffer_pool.end() ||
+         it->buffer->GetSize() < best->buffer->GetSize()))
+    {
+      best = it;
+    }
+  }
+
+  if (best != m_upload_staging_buffer_pool.end())
+  {
+    std::unique_ptr<StagingBuffer> buffer = std::move(best->buffer);
+    m_upload_staging_buffer_pool_size -= buffer->GetSize();
+    m_upload_staging_buffer_pool.erase(best);
+    return buffer;
+  }
+
+  // Round up, so that textures of similar sizes, like the mips of a custom texture, can share
+  // buffers.
+  return StagingBuffer::Create(STAGING_BUFFER_TYPE_UPLOAD, std::bit_ceil(size),
+                               VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+}
+
+void ObjectCache::ReleaseTextureUploadStagingBuffer(std::unique_ptr<StagingBuffer> buffer)
+{
+  m_upload_staging_buffer_pool_size += buffer->GetSize();
+  m_upload_staging_buffer_pool.push_back(
+      {std::move(buffer), g_command_buffer_mgr->GetCurrentFenceCounter()});
+
+  // Destroying a buffer is deferred until the GPU is done with it, so the oldest ones can be
+  // dropped at any time.
+  while (m_upload_staging_buffer_pool_size > MAX_UPLOAD_STAGING_BUFFER_POOL_SIZE &&
+         m_upload_staging_buffer_pool.size() > 1)
+  {
+    m_upload_staging_buffer_pool_size -= m_upload_staging_buffer_pool.front().buffer->GetSize();
+    m_upload_staging_buffer_pool.erase(m_upload_staging_buffer_pool.begin());
+  }
+}
+
 void ObjectCache::ClearSamplerCache()
 {
   for (const auto& it : m_sampler_cache)
@@ -220,6 +270,16 @@ bool ObjectCache::CreateDescriptorSetLayouts()
   if (!g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
 
+  // Textures change far more often than the other bindings, so push them when possible.
+  // Dynamic uniform buffers can't be pushed, so the other sets still come from the pools.
+  if (g_vulkan_context->SupportsPushDescriptors())
+  {
+    create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    create_infos[DESCRIPTOR_SET_LAYOUT_UTILITY_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+  }
+
   for (size_t i = 0; i < create_infos.size(); i++)
   {
     VkResult res = vkCreateDescriptorSetLayout(g_vulkan_context->GetDevice(), &create_infos[i],
@@ -417,11 +477,12 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
 }
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
-                                        u32 multisamples, VkAttachmentLoadOp load_op,
+                                        u32 multisamples, VkAttachmentLoadOp color_load_op,
+                                        VkAttachmentLoadOp depth_load_op,
                                         u8 additional_attachment_count)
 {
-  auto key =
-      std::tie(color_format, depth_format, multisamples, load_op, additional_attachment_count);
+  auto key = std::tie(color_format, depth_format, multisamples, color_load_op, depth_load_op,
+                      additional_attachment_count);
   auto it = m_render_pass_cache.find(key);
   if (it != m_render_pass_cache.end())
     return it->second;
@@ -437,8 +498,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     color_reference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     color_attachment_references.push_back(std::move(color_reference));
     attachments.push_back({0, color_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           color_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
   }
@@ -448,8 +509,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     depth_reference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     depth_reference_ptr = &depth_reference;
     attachments.push_back({0, depth_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           depth_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL});
   }
@@ -461,8 +522,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     color_reference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     color_attachment_references.push_back(std::move(color_reference));
     attachments.push_back({0, color_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           color_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
   }
@@ -507,6 +568,50 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
+VkPipeline ObjectCache::GetPipelineLibrary(const PipelineLibraryKey& key,
+                                           const std::function<VkPipeline()>& create)
+{
+  {
+    std::lock_guard guard(m_pipeline_library_lock);
+    auto it = m_pipeline_library_cache.find(key);
+    if (it != m_pipeline_library_cache.end())
+      return it->second;
+  }
+
+  // Compile without holding the lock, other threads may be creating different libraries.
+  VkPipeline library = create();
+  if (library == VK_NULL_HANDLE)
+    return VK_NULL_HANDLE;
+
+  std::lock_guard guard(m_pipeline_library_lock);
+  auto [it, inserted] = m_pipeline_library_cache.emplace(key, library);
+  if (!inserted)
+  {
+    // Another thread got there first.
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+  }
+  return it->second;
+}
+
+void ObjectCache::DestroyPipelineLibraries(VkShaderModule module)
+{
+  std::lock_guard guard(m_pipeline_library_lock);
+  std::erase_if(m_pipeline_library_cache, [module](const auto& it) {
+    if (std::get<2>(it.first) != module && std::get<3>(it.first) != module)
+      return false;
+
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+    return true;
+  });
+}
+
+void ObjectCache::DestroyPipelineLibraryCache()
+{
+  for (auto& it : m_pipeline_library_cache)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_pipeline_library_cache.clear();
+}
+
 class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
 {
 public:
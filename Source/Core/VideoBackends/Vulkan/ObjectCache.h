@@ -5,11 +5,14 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/LinearDiskCache.h"
@@ -26,6 +29,7 @@ namespace Vulkan
 class CommandBufferManager;
 class VertexFormat;
 class VKTexture;
+class StagingBuffer;
 class StreamBuffer;
 
 class ObjectCache
@@ -53,6 +57,12 @@ public:
   // Staging buffer for textures.
   StreamBuffer* GetTextureUploadBuffer() const { return m_texture_upload_buffer.get(); }
 
+  // Staging buffers for uploads that are too large for the texture upload buffer. Released
+  // buffers are reused once the GPU has finished the command buffer they were used in, instead of
+  // creating a buffer for every upload.
+  std::unique_ptr<StagingBuffer> AcquireTextureUploadStagingBuffer(VkDeviceSize size);
+  void ReleaseTextureUploadStagingBuffer(std::unique_ptr<StagingBuffer> buffer);
+
   // Static samplers
   VkSampler GetPointSampler() const { return m_point_sampler; }
   VkSampler GetLinearSampler() const { return m_linear_sampler; }
@@ -60,11 +70,36 @@ public:
 
   // Render pass cache.
   VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
-                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0);
+                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0)
+  {
+    return GetRenderPass(color_format, depth_format, multisamples, load_op, load_op,
+                         additional_attachment_count);
+  }
+  VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
+                             VkAttachmentLoadOp color_load_op, VkAttachmentLoadOp depth_load_op,
+                             u8 additional_attachment_count);
 
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
 
+  // Pipeline library cache, for linking GX pipelines from separately compiled parts.
+  // The key is the part, followed by the vertex format, shader modules and state it was compiled
+  // with. If the library isn't cached yet, create is called to compile it, from any thread.
+  enum class PipelineLibraryPart : u32
+  {
+    VertexInput,
+    PreRasterization,
+    FragmentShader,
+    FragmentOutput
+  };
+  using PipelineLibraryKey =
+      std::tuple<PipelineLibraryPart, const void*, VkShaderModule, VkShaderModule, u32, u32>;
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key,
+                                const std::function<VkPipeline()>& create);
+
+  // Destroys the pipeline libraries which used a shader module. Call before destroying it.
+  void DestroyPipelineLibraries(VkShaderModule module);
+
   // Clear sampler cache, use when anisotropy mode changes
   // WARNING: Ensure none of the objects from here are in use when calling
   void ClearSamplerCache();
@@ -83,6 +118,7 @@ private:
   bool CreateStaticSamplers();
   void DestroySamplers();
   void DestroyRenderPassCache();
+  void DestroyPipelineLibraryCache();
   bool CreatePipelineCache();
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
@@ -93,6 +129,15 @@ private:
 
   std::unique_ptr<StreamBuffer> m_texture_upload_buffer;
 
+  struct PooledStagingBuffer
+  {
+    std::unique_ptr<StagingBuffer> buffer;
+    u64 fence_counter;
+  };
+  // Oldest release first.
+  std::vector<PooledStagingBuffer> m_upload_staging_buffer_pool;
+  VkDeviceSize m_upload_staging_buffer_pool_size = 0;
+
   VkSampler m_point_sampler = VK_NULL_HANDLE;
   VkSampler m_linear_sampler = VK_NULL_HANDLE;
 
@@ -102,9 +147,14 @@ private:
   std::unique_ptr<VKTexture> m_dummy_texture;
 
   // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t>;
+  using RenderPassCacheKey =
+      std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, VkAttachmentLoadOp, std::size_t>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
+  // Pipeline libraries are created from the shader compiler threads.
+  std::map<PipelineLibraryKey, VkPipeline> m_pipeline_library_cache;
+  std::mutex m_pipeline_library_lock;
+
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
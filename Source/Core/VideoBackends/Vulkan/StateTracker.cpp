@@ -14,6 +14,7 @@
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 #include "VideoCommon/Constants.h"
+#include "VideoCommon/Statistics.h"
 
 namespace Vulkan
 {
@@ -92,6 +93,8 @@ bool StateTracker::Initialize()
     m_bindings.image_textures[i].sampler = g_object_cache->GetPointSampler();
   }
 
+  m_push_sampler_descriptors = g_vulkan_context->SupportsPushDescriptors();
+
   // Default dirty flags include all descriptors
   InvalidateCachedState();
   return true;
@@ -289,6 +292,12 @@ void StateTracker::BeginRenderPass()
   m_current_render_pass = m_framebuffer->GetLoadRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
 
+  INCSTAT(g_stats.this_frame.num_render_passes);
+  // On tiled GPUs, this reloads what the last pass has just written back to memory.
+  if (m_framebuffer == m_last_render_pass_framebuffer)
+    INCSTAT(g_stats.this_frame.num_render_pass_splits);
+  m_last_render_pass_framebuffer = m_framebuffer;
+
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
                                       m_current_render_pass,
@@ -308,6 +317,8 @@ void StateTracker::BeginDiscardRenderPass()
 
   m_current_render_pass = m_framebuffer->GetDiscardRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
+  INCSTAT(g_stats.this_frame.num_render_passes);
+  m_last_render_pass_framebuffer = m_framebuffer;
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
@@ -328,15 +339,19 @@ void StateTracker::EndRenderPass()
 
   vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
   m_current_render_pass = VK_NULL_HANDLE;
+  m_in_clear_render_pass = false;
 }
 
-void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
-                                        u32 num_clear_values)
+void StateTracker::BeginClearRenderPass(VkRenderPass render_pass, const VkRect2D& area,
+                                        const VkClearValue* clear_values, u32 num_clear_values)
 {
   ASSERT(!InRenderPass());
 
-  m_current_render_pass = m_framebuffer->GetClearRenderPass();
+  m_current_render_pass = render_pass;
+  m_in_clear_render_pass = true;
   m_framebuffer_render_area = area;
+  INCSTAT(g_stats.this_frame.num_render_passes);
+  m_last_render_pass_framebuffer = m_framebuffer;
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
@@ -368,6 +383,22 @@ void StateTracker::SetScissor(const VkRect2D& scissor)
   m_dirty_flags |= DIRTY_FLAG_SCISSOR;
 }
 
+void StateTracker::SetDepthAndCullState(VkBool32 depth_test, VkBool32 depth_write,
+                                        VkCompareOp compare_op, VkCullModeFlags cull_mode)
+{
+  if (m_depth_test_enable == depth_test && m_depth_write_enable == depth_write &&
+      m_depth_compare_op == compare_op && m_cull_mode == cull_mode)
+  {
+    return;
+  }
+
+  m_depth_test_enable = depth_test;
+  m_depth_write_enable = depth_write;
+  m_depth_compare_op = compare_op;
+  m_cull_mode = cull_mode;
+  m_dirty_flags |= DIRTY_FLAG_DEPTH_AND_CULL_STATE;
+}
+
 bool StateTracker::Bind()
 {
   // Must have a pipeline.
@@ -375,7 +406,7 @@ bool StateTracker::Bind()
     return false;
 
   // Check the render area if we were in a clear pass.
-  if (m_current_render_pass == m_framebuffer->GetClearRenderPass() && !IsViewportWithinRenderArea())
+  if (m_in_clear_render_pass && !IsViewportWithinRenderArea())
     EndRenderPass();
 
   // Get a new descriptor set if any parts have changed
@@ -407,6 +438,18 @@ bool StateTracker::Bind()
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
     vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
 
+  // Binding a utility pipeline, which has this as static state, leaves it undefined.
+  if (g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState &&
+      m_pipeline->GetUsage() != AbstractPipelineUsage::Utility &&
+      (m_dirty_flags & (DIRTY_FLAG_PIPELINE | DIRTY_FLAG_DEPTH_AND_CULL_STATE)))
+  {
+    vkCmdSetDepthTestEnableEXT(command_buffer, m_depth_test_enable);
+    vkCmdSetDepthWriteEnableEXT(command_buffer, m_depth_write_enable);
+    vkCmdSetDepthCompareOpEXT(command_buffer, m_depth_compare_op);
+    vkCmdSetCullModeEXT(command_buffer, m_cull_mode);
+    m_dirty_flags &= ~DIRTY_FLAG_DEPTH_AND_CULL_STATE;
+  }
+
   m_dirty_flags &=
       ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
   return true;
@@ -457,7 +500,7 @@ bool StateTracker::IsViewportWithinRenderArea() const
 
 void StateTracker::EndClearRenderPass()
 {
-  if (m_current_render_pass != m_framebuffer->GetClearRenderPass())
+  if (!m_in_clear_render_pass)
     return;
 
   // End clear render pass. Bind() will call BeginRenderPass() which
@@ -517,7 +560,29 @@ void StateTracker::UpdateGXDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_UBOS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+  if (m_push_sampler_descriptors)
+  {
+    // Pushed descriptors don't survive a change of pipeline layout, so push them again whenever
+    // the other sets are rebound.
+    if (m_dirty_flags & (DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_DESCRIPTOR_SETS))
+    {
+      const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                          nullptr,
+                                          VK_NULL_HANDLE,
+                                          0,
+                                          0,
+                                          static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                                          VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                          m_bindings.samplers.data(),
+                                          nullptr,
+                                          nullptr};
+      vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                                1, 1, &write);
+      m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
+    }
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
     m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
@@ -573,7 +638,23 @@ void StateTracker::UpdateGXDescriptorSet()
   if (num_writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), num_writes, writes.data(), 0, nullptr);
 
-  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
+  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS && m_push_sampler_descriptors)
+  {
+    // The pushed sampler set sits between the others, so they have to be bound separately.
+    vkCmdBindDescriptorSets(
+        g_command_buffer_mgr->GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
+        m_pipeline->GetVkPipelineLayout(), 0, 1, m_gx_descriptor_sets.data(),
+        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
+        m_bindings.gx_ubo_offsets.data());
+    if (needs_ssbo)
+    {
+      vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                              2, 1, &m_gx_descriptor_sets[2], 0, nullptr);
+    }
+    m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
     vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
@@ -621,7 +702,26 @@ void StateTracker::UpdateUtilityDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_UTILITY_UBO) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS || m_utility_descriptor_sets[1] == VK_NULL_HANDLE)
+  if (m_push_sampler_descriptors)
+  {
+    if (m_dirty_flags & (DIRTY_FLAG_UTILITY_BINDINGS | DIRTY_FLAG_DESCRIPTOR_SETS))
+    {
+      const std::array<VkWriteDescriptorSet, 2> push_writes{{
+          {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 0, 0,
+           NUM_UTILITY_PIXEL_SAMPLERS, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+           m_bindings.samplers.data(), nullptr, nullptr},
+          {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 8, 0, 1,
+           VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, nullptr, nullptr,
+           m_bindings.texel_buffers.data()},
+      }};
+      vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                                1, static_cast<u32>(push_writes.size()), push_writes.data());
+      m_dirty_flags &= ~DIRTY_FLAG_UTILITY_BINDINGS;
+    }
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS ||
+           m_utility_descriptor_sets[1] == VK_NULL_HANDLE)
   {
     m_utility_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_UTILITY_SAMPLERS));
@@ -657,8 +757,8 @@ void StateTracker::UpdateUtilityDescriptorSet()
   {
     vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+                            m_push_sampler_descriptors ? 1 : NUM_UTILITY_DESCRIPTOR_SETS,
+                            m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
@@ -59,13 +59,17 @@ public:
   void EndRenderPass();
 
   // Ends the current render pass if it was a clear render pass.
-  void BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
-                            u32 num_clear_values);
+  void BeginClearRenderPass(VkRenderPass render_pass, const VkRect2D& area,
+                            const VkClearValue* clear_values, u32 num_clear_values);
   void EndClearRenderPass();
 
   void SetViewport(const VkViewport& viewport);
   void SetScissor(const VkRect2D& scissor);
 
+  // Depth state and cull mode for GX pipelines, when they are dynamic state.
+  void SetDepthAndCullState(VkBool32 depth_test, VkBool32 depth_write, VkCompareOp compare_op,
+                            VkCullModeFlags cull_mode);
+
   // Binds all dirty state to the commmand buffer.
   // If this returns false, you should not issue the draw.
   bool Bind();
@@ -104,6 +108,7 @@ private:
     DIRTY_FLAG_COMPUTE_SHADER = (1 << 13),
     DIRTY_FLAG_DESCRIPTOR_SETS = (1 << 14),
     DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET = (1 << 15),
+    DIRTY_FLAG_DEPTH_AND_CULL_STATE = (1 << 16),
 
     DIRTY_FLAG_ALL_DESCRIPTORS = DIRTY_FLAG_GX_UBOS | DIRTY_FLAG_UTILITY_UBO |
                                  DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_GX_SSBO |
@@ -124,6 +129,9 @@ private:
   // Which bindings/state has to be updated before the next draw.
   u32 m_dirty_flags = 0;
 
+  // Sampler descriptors are pushed instead of being allocated from the descriptor pools.
+  bool m_push_sampler_descriptors = false;
+
   // input assembly
   VkBuffer m_vertex_buffer = VK_NULL_HANDLE;
   VkDeviceSize m_vertex_buffer_offset = 0;
@@ -155,6 +163,10 @@ private:
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
+  VkBool32 m_depth_test_enable = VK_FALSE;
+  VkBool32 m_depth_write_enable = VK_FALSE;
+  VkCompareOp m_depth_compare_op = VK_COMPARE_OP_ALWAYS;
+  VkCullModeFlags m_cull_mode = VK_CULL_MODE_NONE;
 
   // uniform buffers
   std::unique_ptr<VKTexture> m_dummy_texture;
@@ -162,6 +174,11 @@ private:
 
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
+  bool m_in_clear_render_pass = false;
+
+  // The framebuffer of the last render pass, to count render passes that are split by work that
+  // has to happen outside of one.
+  const VKFramebuffer* m_last_render_pass_framebuffer = nullptr;
   VkRect2D m_framebuffer_render_area = {};
 };
 }  // namespace Vulkan
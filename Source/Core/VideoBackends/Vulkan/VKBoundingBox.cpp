@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer(StagingBuffer* buffer, VkDeviceSize offset)
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -47,22 +47,26 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, 0,
       BUFFER_SIZE, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-  m_readback_buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                        VK_ACCESS_TRANSFER_WRITE_BIT,
-                                        VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                             VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
 
   // Copy from GPU -> readback buffer.
-  VkBufferCopy region = {0, 0, BUFFER_SIZE};
+  VkBufferCopy region = {0, offset, BUFFER_SIZE};
   vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
-                  m_readback_buffer->GetBuffer(), 1, &region);
+                  buffer->GetBuffer(), 1, &region);
 
   // Restore GPU buffer access.
   StagingBuffer::BufferMemoryBarrier(
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer, VK_ACCESS_TRANSFER_READ_BIT,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, 0, BUFFER_SIZE,
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-  m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                   VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                        VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer(m_readback_buffer.get(), 0);
 
   // Wait until these commands complete.
   VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -77,6 +81,23 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::QueueReadback(u32 slot)
+{
+  CopyToReadbackBuffer(m_queued_readback_buffer.get(), slot * BUFFER_SIZE);
+  m_queued_readback_fences[slot] = g_command_buffer_mgr->GetCurrentFenceCounter();
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> VKBoundingBox::PollReadback(u32 slot)
+{
+  if (g_command_buffer_mgr->GetCompletedFenceCounter() < m_queued_readback_fences[slot])
+    return std::nullopt;
+
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  m_queued_readback_buffer->Read(slot * BUFFER_SIZE, values.data(), BUFFER_SIZE, true);
+  return values;
+}
+
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
@@ -148,6 +169,12 @@ bool VKBoundingBox::CreateReadbackBuffer()
   if (!m_readback_buffer || !m_readback_buffer->Map())
     return false;
 
+  m_queued_readback_buffer =
+      StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE * MAX_QUEUED_READBACKS,
+                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  if (!m_queued_readback_buffer || !m_queued_readback_buffer->Map())
+    return false;
+
   return true;
 }
 
@@ -27,10 +27,13 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueReadback(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollReadback(u32 slot) override;
 
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer(StagingBuffer* buffer, VkDeviceSize offset);
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
@@ -38,6 +41,10 @@ private:
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+
+  // One slot per queued readback, and the fence counter of the command buffer that fills it.
+  std::unique_ptr<StagingBuffer> m_queued_readback_buffer;
+  std::array<u64, MAX_QUEUED_READBACKS> m_queued_readback_fences = {};
 };
 
 }  // namespace Vulkan
@@ -103,6 +103,13 @@ void VKGfx::SetPipeline(const AbstractPipeline* pipeline)
   StateTracker::GetInstance()->SetPipeline(static_cast<const VKPipeline*>(pipeline));
 }
 
+void VKGfx::SetDynamicDepthAndCullState(const DepthState& depth_state, CullMode cull_mode)
+{
+  StateTracker::GetInstance()->SetDepthAndCullState(
+      depth_state.testenable ? VK_TRUE : VK_FALSE, depth_state.updateenable ? VK_TRUE : VK_FALSE,
+      VKPipeline::GetVulkanCompareOp(depth_state.func), VKPipeline::GetVulkanCullMode(cull_mode));
+}
+
 void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_enable,
                         bool alpha_enable, bool z_enable, u32 color, u32 z)
 {
@@ -122,10 +129,12 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
     clear_depth_value.depthStencil.depth = 1.0f - clear_depth_value.depthStencil.depth;
 
   // If we're not in a render pass (start of the frame), we can use a clear render pass
-  // to discard the data, rather than loading and then clearing.
+  // to discard the data, rather than loading and then clearing. This also works when only the
+  // color or only the depth is cleared, as the other attachment can still be loaded. Tiled GPUs
+  // then don't have to load the cleared attachment from memory at all.
   bool use_clear_attachments = (color_enable && alpha_enable) || z_enable;
   bool use_clear_render_pass =
-      !StateTracker::GetInstance()->InRenderPass() && color_enable && alpha_enable && z_enable;
+      !StateTracker::GetInstance()->InRenderPass() && use_clear_attachments;
 
   // The NVIDIA Vulkan driver causes the GPU to lock up, or throw exceptions if MSAA is enabled,
   // a non-full clear rect is specified, and a clear loadop or vkCmdClearAttachments is used.
@@ -146,8 +155,16 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
   // Fastest path: Use a render pass to clear the buffers.
   if (use_clear_render_pass)
   {
-    vk_frame_buffer->SetAndClear(target_vk_rc, clear_color_value, clear_depth_value);
-    return;
+    const bool clear_color = color_enable && alpha_enable;
+    vk_frame_buffer->SetAndClear(target_vk_rc, clear_color_value, clear_depth_value, clear_color,
+                                 z_enable);
+    if (clear_color)
+    {
+      color_enable = false;
+      alpha_enable = false;
+    }
+    z_enable = false;
+    use_clear_attachments = false;
   }
 
   // Fast path: Use vkCmdClearAttachments to clear the buffers within a render path
@@ -329,6 +346,11 @@ void VKGfx::PresentBackbuffer()
     // can happen off-thread in the background while we're preparing the next frame.
     g_command_buffer_mgr->SubmitCommandBuffer(true, false, true, m_swap_chain->GetSwapChain(),
                                               m_swap_chain->GetCurrentImageIndex());
+
+    // The latency limiter measures how long presents block. Waiting for the frame to reach the
+    // display makes that the real slack, rather than just the time the queue accepted it in.
+    if (g_ActiveConfig.bLatencyReduction && g_ActiveConfig.bVSyncActive)
+      g_command_buffer_mgr->WaitForLastPresent(m_swap_chain->GetSwapChain());
   }
   else
   {
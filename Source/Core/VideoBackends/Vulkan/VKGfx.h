@@ -59,6 +59,7 @@ public:
                    bool z_enable, u32 color, u32 z) override;
 
   void SetPipeline(const AbstractPipeline* pipeline) override;
+  void SetDynamicDepthAndCullState(const DepthState& depth_state, CullMode cull_mode) override;
   void SetFramebuffer(AbstractFramebuffer* framebuffer) override;
   void SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer) override;
   void SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const ClearColor& color_value = {},
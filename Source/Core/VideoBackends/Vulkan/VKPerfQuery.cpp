@@ -37,6 +37,12 @@ bool PerfQuery::Initialize()
     return false;
   }
 
+  if (!CreateReadbackBuffer())
+  {
+    PanicAlertFmt("Failed to create query readback buffer");
+    return false;
+  }
+
   // Vulkan requires query pools to be reset after creation
   ResetQuery();
 
@@ -58,9 +64,10 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
-    DEBUG_ASSERT(!entry.has_value);
+    DEBUG_ASSERT(!entry.has_value && !entry.resolved);
     entry.has_value = true;
     entry.query_group = group;
+    entry.frame = m_frame_number;
 
     // Use precise queries if supported, otherwise boolean (which will be incorrect).
     VkQueryControlFlags flags =
@@ -83,12 +90,15 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 
     m_query_next_pos = (m_query_next_pos + 1) % PERF_QUERY_BUFFER_SIZE;
     m_query_count.fetch_add(1, std::memory_order_relaxed);
+    m_unresolved_queries++;
   }
 }
 
 void PerfQuery::ResetQuery()
 {
   m_query_count.store(0, std::memory_order_relaxed);
+  m_unresolved_queries = 0;
+  m_query_resolve_pos = 0;
   m_query_readback_pos = 0;
   m_query_next_pos = 0;
   for (size_t i = 0; i < m_results.size(); ++i)
@@ -139,6 +149,21 @@ bool PerfQuery::IsFlushed() const
   return m_query_count.load(std::memory_order_relaxed) == 0;
 }
 
+void PerfQuery::CollectResults(u64 oldest_frame)
+{
+  // Copy this frame's results along with the command buffer that is submitted next, and pick up
+  // the ones from earlier command buffers that have finished.
+  ResolveQueries();
+  ReadbackQueries();
+
+  if (m_query_count.load(std::memory_order_relaxed) != 0 &&
+      m_query_buffer[m_query_readback_pos].frame < oldest_frame)
+  {
+    CountStall();
+    FlushResults();
+  }
+}
+
 bool PerfQuery::CreateQueryPool()
 {
   VkQueryPoolCreateInfo info = {
@@ -160,6 +185,54 @@ bool PerfQuery::CreateQueryPool()
   return true;
 }
 
+bool PerfQuery::CreateReadbackBuffer()
+{
+  m_readback_buffer =
+      StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK,
+                            PERF_QUERY_BUFFER_SIZE * sizeof(PerfQueryDataType),
+                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  return m_readback_buffer && m_readback_buffer->Map();
+}
+
+void PerfQuery::ResolveQueries()
+{
+  // Do we need to split the resolve as it's wrapped around?
+  if ((m_query_resolve_pos + m_unresolved_queries) > PERF_QUERY_BUFFER_SIZE)
+    ResolveQueries(PERF_QUERY_BUFFER_SIZE - m_query_resolve_pos);
+
+  if (m_unresolved_queries > 0)
+    ResolveQueries(m_unresolved_queries);
+}
+
+void PerfQuery::ResolveQueries(u32 query_count)
+{
+  DEBUG_ASSERT(m_unresolved_queries >= query_count &&
+               (m_query_resolve_pos + query_count) <= PERF_QUERY_BUFFER_SIZE);
+
+  // Copy all of the results with one command, rather than asking the driver for every query.
+  StateTracker::GetInstance()->EndRenderPass();
+  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
+  m_readback_buffer->PrepareForGPUWrite(command_buffer, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                        VK_PIPELINE_STAGE_TRANSFER_BIT);
+  vkCmdCopyQueryPoolResults(command_buffer, m_query_pool, m_query_resolve_pos, query_count,
+                            m_readback_buffer->GetBuffer(),
+                            m_query_resolve_pos * sizeof(PerfQueryDataType),
+                            sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
+  m_readback_buffer->FlushGPUCache(command_buffer, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+  for (u32 i = 0; i < query_count; i++)
+  {
+    ActiveQuery& entry = m_query_buffer[m_query_resolve_pos + i];
+    DEBUG_ASSERT(entry.has_value && !entry.resolved);
+    entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+    entry.resolved = true;
+  }
+
+  m_query_resolve_pos = (m_query_resolve_pos + query_count) % PERF_QUERY_BUFFER_SIZE;
+  m_unresolved_queries -= query_count;
+}
+
 void PerfQuery::ReadbackQueries()
 {
   const u64 completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
@@ -171,7 +244,7 @@ void PerfQuery::ReadbackQueries()
   {
     u32 index = (m_query_readback_pos + readback_count) % PERF_QUERY_BUFFER_SIZE;
     const ActiveQuery& entry = m_query_buffer[index];
-    if (entry.fence_counter > completed_fence_counter)
+    if (!entry.resolved || entry.fence_counter > completed_fence_counter)
       break;
 
     // If this wrapped around, we need to flush the entries before the end of the buffer.
@@ -195,13 +268,9 @@ void PerfQuery::ReadbackQueries(u32 query_count)
   ASSERT(query_count <= m_query_count.load(std::memory_order_relaxed) &&
          (m_query_readback_pos + query_count) <= PERF_QUERY_BUFFER_SIZE);
 
-  // Read back from the GPU.
-  VkResult res = vkGetQueryPoolResults(
-      g_vulkan_context->GetDevice(), m_query_pool, m_query_readback_pos, query_count,
-      query_count * sizeof(PerfQueryDataType), m_query_result_buffer.data(),
-      sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
-  if (res != VK_SUCCESS)
-    LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+  // The GPU has already copied the results, so reading them doesn't wait.
+  m_readback_buffer->InvalidateCPUCache(m_query_readback_pos * sizeof(PerfQueryDataType),
+                                        query_count * sizeof(PerfQueryDataType));
 
   StateTracker::GetInstance()->EndRenderPass();
   vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
@@ -214,12 +283,16 @@ void PerfQuery::ReadbackQueries(u32 query_count)
     ActiveQuery& entry = m_query_buffer[index];
 
     // Should have a fence associated with it (waiting for a result).
-    DEBUG_ASSERT(entry.fence_counter != 0);
+    DEBUG_ASSERT(entry.fence_counter != 0 && entry.resolved);
     entry.fence_counter = 0;
     entry.has_value = false;
+    entry.resolved = false;
+
+    PerfQueryDataType result;
+    m_readback_buffer->Read(index * sizeof(PerfQueryDataType), &result, sizeof(result), false);
 
     // NOTE: Reported pixel metrics should be referenced to native resolution
-    u64 native_res_result = static_cast<u64>(m_query_result_buffer[i]) * EFB_WIDTH /
+    u64 native_res_result = static_cast<u64>(result) * EFB_WIDTH /
                             g_framebuffer_manager->GetEFBWidth() * EFB_HEIGHT /
                             g_framebuffer_manager->GetEFBHeight();
     if (g_ActiveConfig.iMultisamples > 1)
@@ -234,6 +307,8 @@ void PerfQuery::ReadbackQueries(u32 query_count)
 
 void PerfQuery::PartialFlush(bool blocking)
 {
+  ResolveQueries();
+
   // Submit a command buffer in the background if the front query is not bound to one.
   if (blocking || m_query_buffer[m_query_readback_pos].fence_counter ==
                       g_command_buffer_mgr->GetCurrentFenceCounter())
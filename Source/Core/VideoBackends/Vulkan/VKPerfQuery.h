@@ -8,6 +8,7 @@
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
+#include "VideoBackends/Vulkan/StagingBuffer.h"
 #include "VideoCommon/PerfQueryBase.h"
 
 namespace Vulkan
@@ -29,6 +30,9 @@ public:
   void FlushResults() override;
   bool IsFlushed() const override;
 
+protected:
+  void CollectResults(u64 oldest_frame) override;
+
 private:
   // u32 is used for the sample counts.
   using PerfQueryDataType = u32;
@@ -39,21 +43,30 @@ private:
 
   struct ActiveQuery
   {
+    // The command buffer that copies the result to the readback buffer, once resolved.
     u64 fence_counter;
+    u64 frame;
     PerfQueryGroup query_group;
     bool has_value;
+    bool resolved;
   };
 
   bool CreateQueryPool();
+  bool CreateReadbackBuffer();
+  void ResolveQueries();
+  void ResolveQueries(u32 query_count);
   void ReadbackQueries();
   void ReadbackQueries(u32 query_count);
   void PartialFlush(bool blocking);
 
   VkQueryPool m_query_pool = VK_NULL_HANDLE;
+  // Results are copied here on the GPU, in batches, at the same index as their query.
+  std::unique_ptr<StagingBuffer> m_readback_buffer;
+  u32 m_unresolved_queries = 0;
+  u32 m_query_resolve_pos = 0;
   u32 m_query_readback_pos = 0;
   u32 m_query_next_pos = 0;
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
-  std::array<PerfQueryDataType, PERF_QUERY_BUFFER_SIZE> m_query_result_buffer = {};
 };
 
 }  // namespace Vulkan
@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
+#include <algorithm>
 #include <array>
 
 #include "Common/Assert.h"
@@ -20,15 +21,21 @@
 namespace Vulkan
 {
 VKPipeline::VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline,
-                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage)
+                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage,
+                       const PipelineLibraries& libraries)
     : AbstractPipeline(config), m_pipeline(pipeline), m_pipeline_layout(pipeline_layout),
-      m_usage(usage)
+      m_usage(usage), m_libraries(libraries)
 {
 }
 
 VKPipeline::~VKPipeline()
 {
   vkDestroyPipeline(g_vulkan_context->GetDevice(), m_pipeline, nullptr);
+  if (const VkPipeline optimized_pipeline = m_optimized_pipeline.load();
+      optimized_pipeline != VK_NULL_HANDLE)
+  {
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), optimized_pipeline, nullptr);
+  }
 }
 
 static bool IsStripPrimitiveTopology(VkPrimitiveTopology topology)
@@ -39,14 +46,19 @@ static bool IsStripPrimitiveTopology(VkPrimitiveTopology topology)
          topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_WITH_ADJACENCY;
 }
 
-static VkPipelineRasterizationStateCreateInfo
-GetVulkanRasterizationState(const RasterizationState& state)
+VkCullModeFlags VKPipeline::GetVulkanCullMode(CullMode cull_mode)
 {
   static constexpr std::array<VkCullModeFlags, 4> cull_modes = {
       {VK_CULL_MODE_NONE, VK_CULL_MODE_BACK_BIT, VK_CULL_MODE_FRONT_BIT,
        VK_CULL_MODE_FRONT_AND_BACK}};
+  return cull_modes[u32(cull_mode)];
+}
 
+static VkPipelineRasterizationStateCreateInfo
+GetVulkanRasterizationState(const RasterizationState& state)
+{
   bool depth_clamp = g_ActiveConfig.backend_info.bSupportsDepthClamp;
+  VkCullModeFlags cull_mode = VKPipeline::GetVulkanCullMode(state.cullmode);
 
   return {
       VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,  // VkStructureType sType
@@ -55,8 +67,8 @@ GetVulkanRasterizationState(const RasterizationState& state)
       depth_clamp,           // VkBool32                                  depthClampEnable
       VK_FALSE,              // VkBool32                                  rasterizerDiscardEnable
       VK_POLYGON_MODE_FILL,  // VkPolygonMode                             polygonMode
-      cull_modes[u32(state.cullmode.Value())],  // VkCullModeFlags        cullMode
-      VK_FRONT_FACE_CLOCKWISE,                  // VkFrontFace            frontFace
+      cull_mode,             // VkCullModeFlags                           cullMode
+      VK_FRONT_FACE_CLOCKWISE,  // VkFrontFace                               frontFace
       VK_FALSE,  // VkBool32                                              depthBiasEnable
       0.0f,      // float                                                 depthBiasConstantFactor
       0.0f,      // float                                                 depthBiasClamp
@@ -81,12 +93,12 @@ static VkPipelineMultisampleStateCreateInfo GetVulkanMultisampleState(const Fram
   };
 }
 
-static VkPipelineDepthStencilStateCreateInfo GetVulkanDepthStencilState(const DepthState& state)
+VkCompareOp VKPipeline::GetVulkanCompareOp(CompareMode mode)
 {
   // Less/greater are swapped due to inverted depth.
   VkCompareOp compare_op;
   bool inverted_depth = !g_ActiveConfig.backend_info.bSupportsReversedDepthRange;
-  switch (state.func)
+  switch (mode)
   {
   case CompareMode::Never:
     compare_op = VK_COMPARE_OP_NEVER;
@@ -113,11 +125,18 @@ static VkPipelineDepthStencilStateCreateInfo GetVulkanDepthStencilState(const De
     compare_op = VK_COMPARE_OP_ALWAYS;
     break;
   default:
-    PanicAlertFmt("Invalid compare mode {}", state.func);
+    PanicAlertFmt("Invalid compare mode {}", mode);
     compare_op = VK_COMPARE_OP_ALWAYS;
     break;
   }
 
+  return compare_op;
+}
+
+static VkPipelineDepthStencilStateCreateInfo GetVulkanDepthStencilState(const DepthState& state)
+{
+  VkCompareOp compare_op = VKPipeline::GetVulkanCompareOp(state.func);
+
   return {
       VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,  // VkStructureType sType
       nullptr,             // const void*                               pNext
@@ -240,6 +259,178 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
+static VkPipeline CreatePipelineLibrary(VkGraphicsPipelineLibraryFlagsEXT part,
+                                        VkGraphicsPipelineCreateInfo pipeline_info)
+{
+  // The link time optimization info is needed for the optimized link later on.
+  const VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, part};
+  pipeline_info.pNext = &library_info;
+  pipeline_info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                        VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed for pipeline library: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+static VkPipeline LinkPipelineLibraries(const VKPipeline::PipelineLibraries& libraries,
+                                        VkPipelineLayout pipeline_layout, bool optimize)
+{
+  const VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<u32>(libraries.size()), libraries.data()};
+  VkGraphicsPipelineCreateInfo pipeline_info = {};
+  pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_info.pNext = &library_info;
+  pipeline_info.flags = optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+  pipeline_info.layout = pipeline_layout;
+  pipeline_info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed to link pipeline libraries: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+// Creates the pipeline from one library per part, which are shared with other pipelines that use
+// the same shaders and state for that part. Only the link is left to do for new combinations.
+static std::unique_ptr<VKPipeline>
+CreateFromPipelineLibraries(const AbstractPipelineConfig& config,
+                            const VkGraphicsPipelineCreateInfo& pipeline_info)
+{
+  using Part = ObjectCache::PipelineLibraryPart;
+  const u32 num_pre_raster_stages = pipeline_info.stageCount - 1;
+  const bool dynamic_depth_and_cull_state =
+      g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState;
+
+  // Each part declares its own subset of the dynamic state.
+  static constexpr std::array<VkDynamicState, 3> pre_raster_dynamic_states{
+      VK_DYNAMIC_STATE_VIEWPORT,
+      VK_DYNAMIC_STATE_SCISSOR,
+      VK_DYNAMIC_STATE_CULL_MODE_EXT,
+  };
+  static constexpr std::array<VkDynamicState, 3> fragment_dynamic_states{
+      VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+      VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+      VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
+  };
+  const VkPipelineDynamicStateCreateInfo pre_raster_dynamic_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr, 0,
+      dynamic_depth_and_cull_state ? 3u : 2u, pre_raster_dynamic_states.data()};
+  const VkPipelineDynamicStateCreateInfo fragment_dynamic_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr, 0,
+      static_cast<u32>(fragment_dynamic_states.size()), fragment_dynamic_states.data()};
+
+  VkGraphicsPipelineCreateInfo vertex_input_info = {};
+  vertex_input_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  vertex_input_info.pVertexInputState = pipeline_info.pVertexInputState;
+  vertex_input_info.pInputAssemblyState = pipeline_info.pInputAssemblyState;
+  vertex_input_info.basePipelineIndex = -1;
+
+  VkGraphicsPipelineCreateInfo pre_raster_info = {};
+  pre_raster_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pre_raster_info.stageCount = num_pre_raster_stages;
+  pre_raster_info.pStages = pipeline_info.pStages;
+  pre_raster_info.pViewportState = pipeline_info.pViewportState;
+  pre_raster_info.pRasterizationState = pipeline_info.pRasterizationState;
+  pre_raster_info.pDynamicState = &pre_raster_dynamic_state;
+  pre_raster_info.layout = pipeline_info.layout;
+  pre_raster_info.renderPass = pipeline_info.renderPass;
+  pre_raster_info.basePipelineIndex = -1;
+
+  VkGraphicsPipelineCreateInfo fragment_info = {};
+  fragment_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  fragment_info.stageCount = 1;
+  fragment_info.pStages = &pipeline_info.pStages[num_pre_raster_stages];
+  fragment_info.pMultisampleState = pipeline_info.pMultisampleState;
+  fragment_info.pDepthStencilState = pipeline_info.pDepthStencilState;
+  fragment_info.pDynamicState = dynamic_depth_and_cull_state ? &fragment_dynamic_state : nullptr;
+  fragment_info.layout = pipeline_info.layout;
+  fragment_info.renderPass = pipeline_info.renderPass;
+  fragment_info.basePipelineIndex = -1;
+
+  VkGraphicsPipelineCreateInfo output_info = {};
+  output_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  output_info.pMultisampleState = pipeline_info.pMultisampleState;
+  output_info.pColorBlendState = pipeline_info.pColorBlendState;
+  output_info.renderPass = pipeline_info.renderPass;
+  output_info.basePipelineIndex = -1;
+
+  const VkShaderModule vs = static_cast<const VKShader*>(config.vertex_shader)->GetShaderModule();
+  const VkShaderModule gs =
+      config.geometry_shader ?
+          static_cast<const VKShader*>(config.geometry_shader)->GetShaderModule() :
+          VK_NULL_HANDLE;
+  const VkShaderModule ps = static_cast<const VKShader*>(config.pixel_shader)->GetShaderModule();
+  const u32 framebuffer = config.framebuffer_state.hex;
+
+  const VKPipeline::PipelineLibraries libraries = {
+      g_object_cache->GetPipelineLibrary(
+          {Part::VertexInput, config.vertex_format, VK_NULL_HANDLE, VK_NULL_HANDLE,
+           static_cast<u32>(config.rasterization_state.primitive.Value()), 0},
+          [&] {
+            return CreatePipelineLibrary(
+                VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, vertex_input_info);
+          }),
+      g_object_cache->GetPipelineLibrary(
+          {Part::PreRasterization, nullptr, vs, gs, config.rasterization_state.hex, framebuffer},
+          [&] {
+            return CreatePipelineLibrary(
+                VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, pre_raster_info);
+          }),
+      g_object_cache->GetPipelineLibrary(
+          {Part::FragmentShader, nullptr, ps, VK_NULL_HANDLE, config.depth_state.hex, framebuffer},
+          [&] {
+            return CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                                         fragment_info);
+          }),
+      g_object_cache->GetPipelineLibrary(
+          {Part::FragmentOutput, nullptr, VK_NULL_HANDLE, VK_NULL_HANDLE,
+           config.blending_state.hex, framebuffer},
+          [&] {
+            return CreatePipelineLibrary(
+                VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, output_info);
+          }),
+  };
+  if (std::find(libraries.begin(), libraries.end(), VK_NULL_HANDLE) != libraries.end())
+    return nullptr;
+
+  const VkPipeline pipeline = LinkPipelineLibraries(libraries, pipeline_info.layout, false);
+  if (pipeline == VK_NULL_HANDLE)
+    return nullptr;
+
+  return std::make_unique<VKPipeline>(config, pipeline, pipeline_info.layout, config.usage,
+                                      libraries);
+}
+
+bool VKPipeline::NeedsOptimizedLink() const
+{
+  return m_libraries[0] != VK_NULL_HANDLE && m_optimized_pipeline.load() == VK_NULL_HANDLE;
+}
+
+void VKPipeline::LinkOptimized()
+{
+  const VkPipeline pipeline = LinkPipelineLibraries(m_libraries, m_pipeline_layout, true);
+  if (pipeline != VK_NULL_HANDLE)
+    m_optimized_pipeline.store(pipeline, std::memory_order_release);
+}
+
 std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
@@ -382,14 +573,23 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   };
 
   // Set viewport and scissor dynamic state so we can change it elsewhere.
-  static const std::array<VkDynamicState, 2> dynamic_states{
+  // GX pipelines also leave the depth state and cull mode to StateTracker where supported, so
+  // draws that differ only in those can share a pipeline.
+  static const std::array<VkDynamicState, 6> dynamic_states{
       VK_DYNAMIC_STATE_VIEWPORT,
       VK_DYNAMIC_STATE_SCISSOR,
+      VK_DYNAMIC_STATE_CULL_MODE_EXT,
+      VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+      VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+      VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
   };
-  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
+  const bool dynamic_depth_and_cull_state =
+      config.usage != AbstractPipelineUsage::Utility &&
+      g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState;
+  const VkPipelineDynamicStateCreateInfo dynamic_state = {
       VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
       0,                                        // VkPipelineDynamicStateCreateFlags    flags
-      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
+      dynamic_depth_and_cull_state ? 6u : 2u,   // uint32_t dynamicStateCount
       dynamic_states.data()  // const VkDynamicState*                pDynamicStates
   };
 
@@ -416,6 +616,14 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       -1                     // int32_t                                          basePipelineIndex
   };
 
+  // Ubershader pipelines are all compiled up front, so only specialized pipelines are linked.
+  if (config.usage == AbstractPipelineUsage::GX &&
+      g_vulkan_context->SupportsGraphicsPipelineLibrary())
+  {
+    if (auto linked_pipeline = CreateFromPipelineLibraries(config, pipeline_info))
+      return linked_pipeline;
+  }
+
   VkPipeline pipeline;
   VkResult res =
       vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 
 #include "VideoBackends/Vulkan/VulkanLoader.h"
@@ -13,19 +15,37 @@ namespace Vulkan
 class VKPipeline final : public AbstractPipeline
 {
 public:
+  // The libraries a pipeline was linked from, which are owned by the object cache.
+  using PipelineLibraries = std::array<VkPipeline, 4>;
+
   explicit VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline,
-                      VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage);
+                      VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage,
+                      const PipelineLibraries& libraries = {});
   ~VKPipeline() override;
 
-  VkPipeline GetVkPipeline() const { return m_pipeline; }
+  // Returns the optimized pipeline once it has been linked, otherwise the fast linked one.
+  VkPipeline GetVkPipeline() const
+  {
+    const VkPipeline optimized_pipeline = m_optimized_pipeline.load(std::memory_order_acquire);
+    return optimized_pipeline != VK_NULL_HANDLE ? optimized_pipeline : m_pipeline;
+  }
   VkPipelineLayout GetVkPipelineLayout() const { return m_pipeline_layout; }
   AbstractPipelineUsage GetUsage() const { return m_usage; }
   static std::unique_ptr<VKPipeline> Create(const AbstractPipelineConfig& config);
 
+  static VkCullModeFlags GetVulkanCullMode(CullMode cull_mode);
+  static VkCompareOp GetVulkanCompareOp(CompareMode mode);
+
+  bool NeedsOptimizedLink() const override;
+  void LinkOptimized() override;
+
 private:
   VkPipeline m_pipeline;
   VkPipelineLayout m_pipeline_layout;
   AbstractPipelineUsage m_usage;
+
+  PipelineLibraries m_libraries;
+  std::atomic<VkPipeline> m_optimized_pipeline{VK_NULL_HANDLE};
 };
 
 }  // namespace Vulkan
@@ -204,6 +204,9 @@ VkFormat VKTexture::GetVkFormatForHostTextureFormat(AbstractTextureFormat format
   case AbstractTextureFormat::BPTC:
     return VK_FORMAT_BC7_UNORM_BLOCK;
 
+  case AbstractTextureFormat::ETC2:
+    return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+
   case AbstractTextureFormat::RGBA8:
     return VK_FORMAT_R8G8B8A8_UNORM;
 
@@ -408,9 +411,8 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   }
   else
   {
-    // Create a temporary staging buffer that is destroyed after the image is copied.
-    temp_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_UPLOAD, upload_size,
-                                        VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    // Use a separate staging buffer, which goes back to the pool after the image is copied.
+    temp_buffer = g_object_cache->AcquireTextureUploadStagingBuffer(upload_size);
     if (!temp_buffer || !temp_buffer->Map())
     {
       PanicAlertFmt("Failed to allocate staging texture for large texture upload.");
@@ -434,6 +436,8 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   };
   vkCmdCopyBufferToImage(g_command_buffer_mgr->GetCurrentInitCommandBuffer(), upload_buffer,
                          m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
+  if (temp_buffer)
+    g_object_cache->ReleaseTextureUploadStagingBuffer(std::move(temp_buffer));
 
   // Preemptively transition to shader read only after uploading the last mip level, as we're
   // likely finished with writes to this texture for now. We can't do this in common with a
@@ -1013,14 +1017,16 @@ VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attac
                              std::vector<AbstractTexture*> additional_color_attachments, u32 width,
                              u32 height, u32 layers, u32 samples, VkFramebuffer fb,
                              VkRenderPass load_render_pass, VkRenderPass discard_render_pass,
-                             VkRenderPass clear_render_pass)
+                             VkRenderPass clear_render_pass, VkRenderPass clear_color_render_pass,
+                             VkRenderPass clear_depth_render_pass)
     : AbstractFramebuffer(
           color_attachment, depth_attachment, std::move(additional_color_attachments),
           color_attachment ? color_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           depth_attachment ? depth_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           width, height, layers, samples),
       m_fb(fb), m_load_render_pass(load_render_pass), m_discard_render_pass(discard_render_pass),
-      m_clear_render_pass(clear_render_pass)
+      m_clear_render_pass(clear_render_pass), m_clear_color_render_pass(clear_color_render_pass),
+      m_clear_depth_render_pass(clear_depth_render_pass)
 {
 }
 
@@ -1067,8 +1073,15 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
   VkRenderPass clear_render_pass = g_object_cache->GetRenderPass(
       vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_CLEAR,
       static_cast<u8>(additional_color_attachments.size()));
+  VkRenderPass clear_color_render_pass = g_object_cache->GetRenderPass(
+      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_CLEAR,
+      VK_ATTACHMENT_LOAD_OP_LOAD, static_cast<u8>(additional_color_attachments.size()));
+  VkRenderPass clear_depth_render_pass = g_object_cache->GetRenderPass(
+      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD,
+      VK_ATTACHMENT_LOAD_OP_CLEAR, static_cast<u8>(additional_color_attachments.size()));
   if (load_render_pass == VK_NULL_HANDLE || discard_render_pass == VK_NULL_HANDLE ||
-      clear_render_pass == VK_NULL_HANDLE)
+      clear_render_pass == VK_NULL_HANDLE || clear_color_render_pass == VK_NULL_HANDLE ||
+      clear_depth_render_pass == VK_NULL_HANDLE)
   {
     return nullptr;
   }
@@ -1094,7 +1107,8 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
 
   return std::make_unique<VKFramebuffer>(
       color_attachment, depth_attachment, std::move(additional_color_attachments), width, height,
-      layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass);
+      layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass,
+      clear_color_render_pass, clear_depth_render_pass);
 }
 
 void VKFramebuffer::Unbind()
@@ -1139,8 +1153,10 @@ void VKFramebuffer::TransitionForRender()
 }
 
 void VKFramebuffer::SetAndClear(const VkRect2D& rect, const VkClearValue& color_value,
-                                const VkClearValue& depth_value)
+                                const VkClearValue& depth_value, bool clear_color,
+                                bool clear_depth)
 {
+  // The clear values of loaded attachments are ignored.
   std::vector<VkClearValue> clear_values;
   if (GetColorFormat() != AbstractTextureFormat::Undefined)
   {
@@ -1154,7 +1170,10 @@ void VKFramebuffer::SetAndClear(const VkRect2D& rect, const VkClearValue& color_
   {
     clear_values.push_back(color_value);
   }
-  StateTracker::GetInstance()->BeginClearRenderPass(rect, clear_values.data(),
+  const VkRenderPass render_pass = !clear_depth ? m_clear_color_render_pass :
+                                   !clear_color ? m_clear_depth_render_pass :
+                                                  m_clear_render_pass;
+  StateTracker::GetInstance()->BeginClearRenderPass(render_pass, rect, clear_values.data(),
                                                     static_cast<u32>(clear_values.size()));
 }
 }  // namespace Vulkan
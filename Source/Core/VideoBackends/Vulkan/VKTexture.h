@@ -129,7 +129,8 @@ public:
   VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment,
                 std::vector<AbstractTexture*> additional_color_attachments, u32 width, u32 height,
                 u32 layers, u32 samples, VkFramebuffer fb, VkRenderPass load_render_pass,
-                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass);
+                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass,
+                VkRenderPass clear_color_render_pass, VkRenderPass clear_depth_render_pass);
   ~VKFramebuffer() override;
 
   VkFramebuffer GetFB() const { return m_fb; }
@@ -138,12 +139,16 @@ public:
   VkRenderPass GetLoadRenderPass() const { return m_load_render_pass; }
   VkRenderPass GetDiscardRenderPass() const { return m_discard_render_pass; }
   VkRenderPass GetClearRenderPass() const { return m_clear_render_pass; }
+  // Clear only the color or only the depth attachments, and load the other.
+  VkRenderPass GetClearColorRenderPass() const { return m_clear_color_render_pass; }
+  VkRenderPass GetClearDepthRenderPass() const { return m_clear_depth_render_pass; }
 
   void Unbind();
   void TransitionForRender();
 
   void SetAndClear(const VkRect2D& rect, const VkClearValue& color_value,
-                   const VkClearValue& depth_value);
+                   const VkClearValue& depth_value, bool clear_color = true,
+                   bool clear_depth = true);
   std::size_t GetNumberOfAdditonalAttachments() const
   {
     return m_additional_color_attachments.size();
@@ -158,6 +163,8 @@ protected:
   VkRenderPass m_load_render_pass;
   VkRenderPass m_discard_render_pass;
   VkRenderPass m_clear_render_pass;
+  VkRenderPass m_clear_color_render_pass;
+  VkRenderPass m_clear_depth_render_pass;
 };
 
 }  // namespace Vulkan
@@ -29,6 +29,28 @@ static void InsertIntoChain(Chain* chain, Element* element)
   chain->pNext = element;
 }
 
+static bool SupportsExtension(VkPhysicalDevice device, const char* name)
+{
+  u32 extension_count = 0;
+  if (vkEnumerateDeviceExtensionProperties(device, nullptr, &extension_count, nullptr) !=
+      VK_SUCCESS)
+  {
+    return false;
+  }
+
+  std::vector<VkExtensionProperties> extensions(extension_count);
+  if (vkEnumerateDeviceExtensionProperties(device, nullptr, &extension_count, extensions.data()) !=
+      VK_SUCCESS)
+  {
+    return false;
+  }
+
+  return std::any_of(extensions.begin(), extensions.end(),
+                     [name](const VkExtensionProperties& properties) {
+                       return !strcmp(name, properties.extensionName);
+                     });
+}
+
 VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
 {
   VkPhysicalDeviceFeatures features;
@@ -75,6 +97,52 @@ VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
         properties_subgroup.supportedStages & VK_SHADER_STAGE_FRAGMENT_BIT;
   }
 
+  if (apiVersion >= VK_API_VERSION_1_1 && vkGetPhysicalDeviceFeatures2)
+  {
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT features_eds = {};
+    features_eds.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+    if (SupportsExtension(device, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+      InsertIntoChain(&features2, &features_eds);
+
+    // Only worth using if linking is fast, as that's the point of it.
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT features_gpl = {};
+    features_gpl.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT properties_gpl = {};
+    properties_gpl.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+    const bool has_gpl =
+        SupportsExtension(device, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+        SupportsExtension(device, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    if (has_gpl)
+    {
+      InsertIntoChain(&features2, &features_gpl);
+      properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+      properties2.pNext = &properties_gpl;
+      vkGetPhysicalDeviceProperties2(device, &properties2);
+    }
+
+    // Present wait needs present IDs to say which present to wait for.
+    VkPhysicalDevicePresentIdFeaturesKHR features_present_id = {};
+    features_present_id.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+    VkPhysicalDevicePresentWaitFeaturesKHR features_present_wait = {};
+    features_present_wait.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+    if (SupportsExtension(device, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+        SupportsExtension(device, VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+    {
+      InsertIntoChain(&features2, &features_present_id);
+      InsertIntoChain(&features2, &features_present_wait);
+    }
+
+    vkGetPhysicalDeviceFeatures2(device, &features2);
+    extendedDynamicState = features_eds.extendedDynamicState != VK_FALSE;
+    presentWait = features_present_id.presentId != VK_FALSE &&
+                  features_present_wait.presentWait != VK_FALSE;
+    graphicsPipelineLibrary = features_gpl.graphicsPipelineLibrary != VK_FALSE &&
+                              properties_gpl.graphicsPipelineLibraryFastLinking != VK_FALSE;
+  }
+
   memcpy(deviceName, properties.deviceName, sizeof(deviceName));
   memcpy(pipelineCacheUUID, properties.pipelineCacheUUID, sizeof(pipelineCacheUUID));
   vendorID = properties.vendorID;
@@ -103,6 +171,7 @@ VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
   shaderClipDistance = features.shaderClipDistance != VK_FALSE;
   depthClamp = features.depthClamp != VK_FALSE;
   textureCompressionBC = features.textureCompressionBC != VK_FALSE;
+  textureCompressionETC2 = features.textureCompressionETC2 != VK_FALSE;
 }
 
 VkPhysicalDeviceFeatures VulkanContext::PhysicalDeviceInfo::features() const
@@ -123,6 +192,7 @@ VkPhysicalDeviceFeatures VulkanContext::PhysicalDeviceInfo::features() const
   features.shaderClipDistance = shaderClipDistance ? VK_TRUE : VK_FALSE;
   features.depthClamp = depthClamp ? VK_TRUE : VK_FALSE;
   features.textureCompressionBC = textureCompressionBC ? VK_TRUE : VK_FALSE;
+  features.textureCompressionETC2 = textureCompressionETC2 ? VK_TRUE : VK_FALSE;
   return features;
 }
 
@@ -460,6 +530,7 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsDepthClamp = false;                // Dependent on features.
   config->backend_info.bSupportsST3CTextures = false;              // Dependent on features.
   config->backend_info.bSupportsBPTCTextures = false;              // Dependent on features.
+  config->backend_info.bSupportsETC2Textures = false;              // Dependent on features.
   config->backend_info.bSupportsLogicOp = false;                   // Dependent on features.
   config->backend_info.bSupportsLargePoints = false;               // Dependent on features.
   config->backend_info.bSupportsFramebufferFetch = false;          // Dependent on OS and features.
@@ -471,6 +542,7 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsDynamicVertexLoader = true;        // Assumed support.
   config->backend_info.bSupportsVSLinePointExpand = true;          // Assumed support.
   config->backend_info.bSupportsHDROutput = true;                  // Assumed support.
+  config->backend_info.bSupportsDynamicDepthAndCullState = false;  // Dependent on features.
 }
 
 void VulkanContext::PopulateBackendInfoAdapters(VideoConfig* config, const GPUList& gpu_list)
@@ -496,6 +568,7 @@ void VulkanContext::PopulateBackendInfoFeatures(VideoConfig* config, VkPhysicalD
       info.fragmentStoresAndAtomics;
   config->backend_info.bSupportsSSAA = info.sampleRateShading;
   config->backend_info.bSupportsLogicOp = info.logicOp;
+  config->backend_info.bSupportsDynamicDepthAndCullState = info.extendedDynamicState;
 
   // Metal doesn't support this.
   config->backend_info.bSupportsLodBiasInSampler = info.driverID != VK_DRIVER_ID_MOLTENVK;
@@ -514,6 +587,7 @@ void VulkanContext::PopulateBackendInfoFeatures(VideoConfig* config, VkPhysicalD
   // textureCompressionBC implies BC1 through BC7, which is a superset of DXT1/3/5, which we need.
   config->backend_info.bSupportsST3CTextures = info.textureCompressionBC;
   config->backend_info.bSupportsBPTCTextures = info.textureCompressionBC;
+  config->backend_info.bSupportsETC2Textures = info.textureCompressionETC2;
 
   // Some devices don't support point sizes >1 (e.g. Adreno).
   // If we can't use a point size above our maximum IR, use triangles instead for EFB pokes.
@@ -675,6 +749,24 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
 
   AddExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, false);
   AddExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
+  AddExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false);
+  if (m_device_info.extendedDynamicState &&
+      !AddExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME, false))
+  {
+    m_device_info.extendedDynamicState = false;
+  }
+  if (m_device_info.graphicsPipelineLibrary &&
+      (!AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false) ||
+       !AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false)))
+  {
+    m_device_info.graphicsPipelineLibrary = false;
+  }
+  if (m_device_info.presentWait &&
+      (!enable_surface || !AddExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false) ||
+       !AddExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false)))
+  {
+    m_device_info.presentWait = false;
+  }
 
   return true;
 }
@@ -808,6 +900,32 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   VkPhysicalDeviceFeatures device_features = m_device_info.features();
   device_info.pEnabledFeatures = &device_features;
 
+  VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extended_dynamic_state_features = {};
+  extended_dynamic_state_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+  extended_dynamic_state_features.extendedDynamicState = VK_TRUE;
+  if (m_device_info.extendedDynamicState)
+    InsertIntoChain(&device_info, &extended_dynamic_state_features);
+
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphics_pipeline_library_features = {};
+  graphics_pipeline_library_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  graphics_pipeline_library_features.graphicsPipelineLibrary = VK_TRUE;
+  if (m_device_info.graphicsPipelineLibrary)
+    InsertIntoChain(&device_info, &graphics_pipeline_library_features);
+
+  VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+  present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+  present_id_features.presentId = VK_TRUE;
+  VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+  present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+  present_wait_features.presentWait = VK_TRUE;
+  if (m_device_info.presentWait)
+  {
+    InsertIntoChain(&device_info, &present_id_features);
+    InsertIntoChain(&device_info, &present_wait_features);
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -826,6 +944,15 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   if (!LoadVulkanDeviceFunctions(m_device))
     return false;
 
+  if (m_device_info.extendedDynamicState &&
+      (!vkCmdSetCullModeEXT || !vkCmdSetDepthTestEnableEXT || !vkCmdSetDepthWriteEnableEXT ||
+       !vkCmdSetDepthCompareOpEXT))
+  {
+    m_device_info.extendedDynamicState = false;
+  }
+  if (m_device_info.presentWait && !vkWaitForPresentKHR)
+    m_device_info.presentWait = false;
+
   // Grab the graphics and present queues.
   vkGetDeviceQueue(m_device, m_graphics_queue_family_index, 0, &m_graphics_queue);
   if (surface)
@@ -933,6 +1060,12 @@ bool VulkanContext::SupportsDeviceExtension(const char* name) const
                      [name](const std::string& extension) { return extension == name; });
 }
 
+bool VulkanContext::SupportsPushDescriptors() const
+{
+  return SupportsDeviceExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) &&
+         vkCmdPushDescriptorSetKHR != nullptr;
+}
+
 static bool DriverIsMesa(VkDriverId driver_id)
 {
   switch (driver_id)
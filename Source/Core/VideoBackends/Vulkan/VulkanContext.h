@@ -53,7 +53,11 @@ public:
     bool shaderClipDistance;
     bool depthClamp;
     bool textureCompressionBC;
+    bool textureCompressionETC2;
     bool shaderSubgroupOperations = false;
+    bool extendedDynamicState = false;
+    bool graphicsPipelineLibrary = false;
+    bool presentWait = false;
   };
 
   VulkanContext(VkInstance instance, VkPhysicalDevice physical_device);
@@ -108,6 +112,9 @@ public:
   bool SupportsPreciseOcclusionQueries() const { return m_device_info.occlusionQueryPrecise; }
   u32 GetShaderSubgroupSize() const { return m_device_info.subgroupSize; }
   bool SupportsShaderSubgroupOperations() const { return m_device_info.shaderSubgroupOperations; }
+  bool SupportsGraphicsPipelineLibrary() const { return m_device_info.graphicsPipelineLibrary; }
+  // VK_KHR_present_id and VK_KHR_present_wait, to wait until a present has reached the display.
+  bool SupportsPresentWait() const { return m_device_info.presentWait; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -120,6 +127,10 @@ public:
   // Returns true if the specified extension is supported and enabled.
   bool SupportsDeviceExtension(const char* name) const;
 
+  // Returns true if the texture descriptor sets can be written directly into command buffers,
+  // instead of being allocated from the per-frame descriptor pools.
+  bool SupportsPushDescriptors() const;
+
   // Returns true if exclusive fullscreen is supported for the given surface.
   bool SupportsExclusiveFullscreen(const WindowSystemInfo& wsi, VkSurfaceKHR surface);
 
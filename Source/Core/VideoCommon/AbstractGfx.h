@@ -10,6 +10,7 @@
 
 #include <array>
 #include <memory>
+#include <string>
 #include <vector>
 
 class AbstractFramebuffer;
@@ -58,6 +59,9 @@ public:
   virtual bool SupportsUtilityDrawing() const { return true; }
 
   virtual void SetPipeline(const AbstractPipeline* pipeline) {}
+  // Overrides the depth state and cull mode of the current GX pipeline.
+  // Only called when backend_info.bSupportsDynamicDepthAndCullState is set.
+  virtual void SetDynamicDepthAndCullState(const DepthState& depth_state, CullMode cull_mode) {}
   virtual void SetScissorRect(const MathUtil::Rectangle<int>& rc) {}
   virtual void SetTexture(u32 index, const AbstractTexture* texture) {}
   virtual void SetSamplerState(u32 index, const SamplerState& state) {}
@@ -169,6 +173,10 @@ public:
   // Returns info about the main surface (aka backbuffer)
   virtual SurfaceInfo GetSurfaceInfo() const = 0;
 
+  // Identifies the device and driver version that pipeline cache data is valid for, so the cache
+  // can be shared between games. Empty if the backend can't tell drivers apart.
+  virtual std::string GetDriverIdentity() const { return {}; }
+
 protected:
   AbstractFramebuffer* m_current_framebuffer = nullptr;
   const AbstractPipeline* m_current_pipeline = nullptr;
@@ -85,4 +85,10 @@ public:
   // pipeline objects, the cache is optionally used by the driver to speed up compilation.
   using CacheData = std::vector<u8>;
   virtual CacheData GetCacheData() const { return {}; }
+
+  // Some backends can create pipelines quickly by linking separately compiled stages, without
+  // optimizing across them. LinkOptimized() then builds the optimized pipeline, which is used in
+  // place of the quickly linked one once it's done. It is called from a shader compiler thread.
+  virtual bool NeedsOptimizedLink() const { return false; }
+  virtual void LinkOptimized() {}
 };
@@ -20,6 +20,19 @@ void AbstractTexture::FinishedRendering()
 }
 
 bool AbstractTexture::Save(const std::string& filename, unsigned int level, int compression) const
+{
+  std::vector<u8> data;
+  u32 width;
+  u32 height;
+  if (!Read(level, &data, &width, &height))
+    return false;
+
+  return Common::SavePNG(filename, data.data(), Common::ImageByteFormat::RGBA, width, height,
+                         width * 4, compression);
+}
+
+bool AbstractTexture::Read(unsigned int level, std::vector<u8>* data, u32* width,
+                           u32* height) const
 {
   // We can't dump compressed textures currently (it would mean drawing them to a RGBA8
   // framebuffer, and saving that). TextureCache does not call Save for custom textures
@@ -48,14 +61,20 @@ bool AbstractTexture::Save(const std::string& filename, unsigned int level, int
   readback_texture->CopyFromTexture(this, 0, level);
   readback_texture->Flush();
 
-  // Map it so we can encode it to the file.
+  // Map it so we can copy the data out.
   if (!readback_texture->Map())
     return false;
 
-  return Common::SavePNG(filename,
-                         reinterpret_cast<const u8*>(readback_texture->GetMappedPointer()),
-                         Common::ImageByteFormat::RGBA, level_width, level_height,
-                         static_cast<int>(readback_texture->GetMappedStride()), compression);
+  const u32 row_size = level_width * 4;
+  const size_t stride = readback_texture->GetMappedStride();
+  const u8* src = reinterpret_cast<const u8*>(readback_texture->GetMappedPointer());
+  data->resize(static_cast<size_t>(row_size) * level_height);
+  for (u32 row = 0; row < level_height; ++row)
+    std::copy_n(src + row * stride, row_size, data->data() + static_cast<size_t>(row) * row_size);
+
+  *width = level_width;
+  *height = level_height;
+  return true;
 }
 
 bool AbstractTexture::IsCompressedFormat(AbstractTextureFormat format)
@@ -66,6 +85,7 @@ bool AbstractTexture::IsCompressedFormat(AbstractTextureFormat format)
   case AbstractTextureFormat::DXT3:
   case AbstractTextureFormat::DXT5:
   case AbstractTextureFormat::BPTC:
+  case AbstractTextureFormat::ETC2:
     return true;
 
   default:
@@ -118,6 +138,7 @@ u32 AbstractTexture::CalculateStrideForFormat(AbstractTextureFormat format, u32
   case AbstractTextureFormat::DXT3:
   case AbstractTextureFormat::DXT5:
   case AbstractTextureFormat::BPTC:
+  case AbstractTextureFormat::ETC2:
     return static_cast<size_t>(std::max(1u, row_length / 4)) * 16;
   case AbstractTextureFormat::R16:
   case AbstractTextureFormat::D16:
@@ -147,6 +168,7 @@ u32 AbstractTexture::GetTexelSizeForFormat(AbstractTextureFormat format)
   case AbstractTextureFormat::DXT3:
   case AbstractTextureFormat::DXT5:
   case AbstractTextureFormat::BPTC:
+  case AbstractTextureFormat::ETC2:
     return 16;
   case AbstractTextureFormat::R16:
   case AbstractTextureFormat::D16:
@@ -175,6 +197,7 @@ u32 AbstractTexture::GetBlockSizeForFormat(AbstractTextureFormat format)
   case AbstractTextureFormat::DXT3:
   case AbstractTextureFormat::DXT5:
   case AbstractTextureFormat::BPTC:
+  case AbstractTextureFormat::ETC2:
     return 4;
 
   default:
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
@@ -39,6 +40,8 @@ public:
   MathUtil::Rectangle<int> GetMipRect(u32 level) const { return m_config.GetMipRect(level); }
   bool IsMultisampled() const { return m_config.IsMultisampled(); }
   bool Save(const std::string& filename, unsigned int level, int compression = 6) const;
+  // Downloads the given level as tightly packed RGBA8 data, so it can be encoded elsewhere.
+  bool Read(unsigned int level, std::vector<u8>* data, u32* width, u32* height) const;
 
   static bool IsCompressedFormat(AbstractTextureFormat format);
   static bool IsDepthFormat(AbstractTextureFormat format);
@@ -23,11 +23,23 @@ bool CustomAsset::Load()
   return load_information.m_bytes_loaded != 0;
 }
 
+void CustomAsset::Unload()
+{
+  UnloadImpl();
+  std::lock_guard lk(m_info_lock);
+  m_bytes_loaded = 0;
+}
+
 CustomAssetLibrary::TimeType CustomAsset::GetLastWriteTime() const
 {
   return m_owning_library->GetLastAssetWriteTime(m_asset_id);
 }
 
+std::vector<std::filesystem::path> CustomAsset::GetFiles() const
+{
+  return m_owning_library->GetAssetFiles(m_asset_id);
+}
+
 const CustomAssetLibrary::TimeType& CustomAsset::GetLastLoadedTime() const
 {
   std::lock_guard lk(m_info_lock);
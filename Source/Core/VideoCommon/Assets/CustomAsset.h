@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <vector>
 
 namespace VideoCommon
 {
@@ -28,11 +29,19 @@ public:
   // Loads the asset from the library returning a pass/fail result
   bool Load();
 
+  // Frees the loaded data, the asset can be loaded again afterwards
+  // The last loaded time is kept, so that a reload of the same data isn't seen as a change
+  void Unload();
+
   // Queries the last time the asset was modified or standard epoch time
   // if the asset hasn't been modified yet
   // Note: not thread safe, expected to be called by the loader
   CustomAssetLibrary::TimeType GetLastWriteTime() const;
 
+  // Queries the files the asset is loaded from, if the library is backed by files
+  // Note: not thread safe, expected to be called by the loader
+  std::vector<std::filesystem::path> GetFiles() const;
+
   // Returns the time that the data was last loaded
   const CustomAssetLibrary::TimeType& GetLastLoadedTime() const;
 
@@ -48,6 +57,7 @@ protected:
 
 private:
   virtual CustomAssetLibrary::LoadInfo LoadImpl(const CustomAssetLibrary::AssetID& asset_id) = 0;
+  virtual void UnloadImpl() = 0;
   CustomAssetLibrary::AssetID m_asset_id;
 
   mutable std::mutex m_info_lock;
@@ -80,6 +90,13 @@ public:
   }
 
 protected:
+  void UnloadImpl() override
+  {
+    std::lock_guard lk(m_data_lock);
+    m_loaded = false;
+    m_data.reset();
+  }
+
   bool m_loaded = false;
   mutable std::mutex m_data_lock;
   std::shared_ptr<UnderlyingType> m_data;
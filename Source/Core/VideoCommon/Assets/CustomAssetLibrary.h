@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace VideoCommon
 {
@@ -40,6 +41,13 @@ public:
   // Gets the last write time for a given asset id
   virtual TimeType GetLastAssetWriteTime(const AssetID& asset_id) const = 0;
 
+  // Gets the files a given asset id is loaded from, so that they can be watched for changes
+  // Libraries that aren't backed by files return nothing, their assets are polled instead
+  virtual std::vector<std::filesystem::path> GetAssetFiles(const AssetID& asset_id) const
+  {
+    return {};
+  }
+
   // Loads a texture as a game texture, providing additional checks like confirming
   // each mip level size is correct and that the format is consistent across the data
   LoadInfo LoadGameTexture(const AssetID& asset_id, TextureData* data);
@@ -3,14 +3,31 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+#include <utility>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/VideoEvents.h"
 
 namespace VideoCommon
 {
 void CustomAssetLoader::Init()
 {
   m_asset_monitor_thread_shutdown.Clear();
+  m_load_workers_shutdown = false;
+  m_memory_exceeded = false;
+  m_frame = 0;
 
   const size_t sys_mem = Common::MemPhysical();
   const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
@@ -18,64 +35,60 @@ void CustomAssetLoader::Init()
   m_max_memory_available =
       (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
 
+#ifdef __linux__
+  m_watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_watch_fd < 0)
+    WARN_LOG_FMT(VIDEO, "Failed to watch custom assets for changes, polling them instead.");
+#endif
+
   m_asset_monitor_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Asset monitor");
-    while (true)
-    {
-      if (m_asset_monitor_thread_shutdown.IsSet())
-      {
-        break;
-      }
-
-      std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
-
-      std::lock_guard lk(m_asset_load_lock);
-      for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
-      {
-        if (auto ptr = asset_to_monitor.lock())
-        {
-          const auto write_time = ptr->GetLastWriteTime();
-          if (write_time > ptr->GetLastLoadedTime())
-          {
-            (void)ptr->Load();
-          }
-        }
-      }
-    }
+    MonitorAssets();
   });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (m_memory_exceeded)
-        return;
+  // Loading is mostly decoding, which benefits from a few threads, but the emulation and the
+  // GPU thread shouldn't have to compete with too many of them
+  const u32 num_workers =
+      std::clamp(std::thread::hardware_concurrency() / 2, 1u, u32{MAX_LOAD_WORKERS});
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    m_load_workers.emplace_back([this, i]() {
+      Common::SetCurrentThreadName(fmt::format("Custom Asset Loader {}", i).c_str());
+      Common::SetCurrentThreadBackgroundPriority();
+      LoadWorker();
+    });
+  }
 
-      if (ptr->Load())
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        m_total_bytes_loaded += asset_memory_size;
-        m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        if (m_total_bytes_loaded > m_max_memory_available)
-        {
-          ERROR_LOG_FMT(VIDEO,
-                        "Asset memory exceeded with asset '{}', future assets won't load until "
-                        "memory is available.",
-                        ptr->GetAssetId());
-          m_memory_exceeded = true;
-        }
-      }
-    }
-  });
+  m_frame_end_event =
+      AfterFrameEvent::Register([this](Core::System&) { OnFrameEnd(); }, "CustomAssetLoader");
 }
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  m_frame_end_event.reset();
+
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    m_load_workers_shutdown = true;
+  }
+  m_load_cv.notify_all();
+  for (std::thread& worker : m_load_workers)
+    worker.join();
+  m_load_workers.clear();
 
   m_asset_monitor_thread_shutdown.Set();
   m_asset_monitor_thread.join();
-  m_assets_to_monitor.clear();
+
+  std::lock_guard lk(m_asset_load_lock);
+  m_pending_loads.clear();
+  m_assets.clear();
+  m_watched_files.clear();
+  m_watched_directories.clear();
+#ifdef __linux__
+  if (m_watch_fd >= 0)
+    close(m_watch_fd);
+#endif
+  m_watch_fd = -1;
   m_total_bytes_loaded = 0;
 }
 
@@ -105,4 +118,318 @@ std::shared_ptr<MeshAsset> CustomAssetLoader::LoadMesh(const CustomAssetLibrary:
 {
   return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library));
 }
+
+void CustomAssetLoader::AddAsset(std::shared_ptr<CustomAsset> asset, bool evictable)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  AssetState& state = m_assets[asset.get()];
+  state.asset = asset;
+  state.last_request_frame = m_frame;
+  state.evictable = evictable;
+  QueueLoad(asset.get(), state);
+}
+
+void CustomAssetLoader::RequestAsset(const CustomAsset* asset)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  const auto it = m_assets.find(asset);
+  if (it == m_assets.end())
+    return;
+
+  AssetState& state = it->second;
+  if (state.last_request_frame == m_frame)
+    return;
+
+  state.last_request_frame = m_frame;
+  // A queued asset moves up to the front with the others requested this frame
+  if (state.queued || state.evicted)
+    QueueLoad(asset, state);
+}
+
+void CustomAssetLoader::OnAssetDestroyed(const CustomAsset* asset)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  const auto it = m_assets.find(asset);
+  if (it == m_assets.end())
+    return;
+
+  if (it->second.queued)
+    m_pending_loads.erase({it->second.queue_frame, it->second.queue_sequence, asset});
+  if (it->second.watched)
+    UnwatchAssetFiles(asset);
+  m_total_bytes_loaded -= asset->GetByteSizeInMemory();
+  m_assets.erase(it);
+  UpdateMemoryExceeded();
+}
+
+void CustomAssetLoader::QueueLoad(const CustomAsset* asset, AssetState& state)
+{
+  if (state.queued)
+    m_pending_loads.erase({state.queue_frame, state.queue_sequence, asset});
+
+  state.queue_frame = state.last_request_frame;
+  state.queue_sequence = m_queue_sequence++;
+  state.queued = true;
+  state.evicted = false;
+  m_pending_loads.insert({state.queue_frame, state.queue_sequence, asset});
+  m_load_cv.notify_one();
+}
+
+void CustomAssetLoader::OnFrameEnd()
+{
+  std::lock_guard lk(m_asset_load_lock);
+  m_frame++;
+
+  // Assets that were in use when the memory ran out become evictable as time goes on
+  if (m_memory_exceeded)
+  {
+    EvictUnusedAssets();
+    UpdateMemoryExceeded();
+  }
+}
+
+void CustomAssetLoader::LoadWorker()
+{
+  std::unique_lock lk(m_asset_load_lock);
+  while (true)
+  {
+    m_load_cv.wait(lk, [this] {
+      return m_load_workers_shutdown || (!m_memory_exceeded && !m_pending_loads.empty());
+    });
+    if (m_load_workers_shutdown)
+      return;
+
+    const auto first = m_pending_loads.begin();
+    const auto it = m_assets.find(first->asset);
+    m_pending_loads.erase(first);
+    if (it == m_assets.end())
+      continue;
+
+    it->second.queued = false;
+    if (const auto asset = it->second.asset.lock())
+      (void)LoadAsset(lk, asset.get(), it->second);
+  }
+}
+
+void CustomAssetLoader::MonitorAssets()
+{
+  while (!m_asset_monitor_thread_shutdown.IsSet())
+  {
+    const std::vector<const CustomAsset*> changed_assets =
+        WaitForFileChanges(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
+
+    std::unique_lock lk(m_asset_load_lock);
+    // Assets are only checked after the iteration, as releasing the last reference to one of them
+    // removes it from the map
+    std::vector<std::shared_ptr<CustomAsset>> assets_to_check;
+    for (auto& [asset_ptr, state] : m_assets)
+    {
+      if (!state.loaded || state.loading)
+        continue;
+      if (state.watched && std::ranges::find(changed_assets, asset_ptr) == changed_assets.end())
+        continue;
+
+      if (auto ptr = state.asset.lock())
+        assets_to_check.push_back(std::move(ptr));
+    }
+
+    for (const auto& asset : assets_to_check)
+    {
+      // The lock is released while loading, so the state may have changed in the meantime
+      const auto it = m_assets.find(asset.get());
+      if (it == m_assets.end() || !it->second.loaded || it->second.loading)
+        continue;
+
+      const auto write_time = asset->GetLastWriteTime();
+      if (write_time > asset->GetLastLoadedTime())
+        (void)LoadAsset(lk, asset.get(), it->second);
+    }
+  }
+}
+
+bool CustomAssetLoader::LoadAsset(std::unique_lock<std::recursive_mutex>& lk, CustomAsset* asset,
+                                  AssetState& state)
+{
+  state.loading = true;
+  const std::size_t previous_size = asset->GetByteSizeInMemory();
+  lk.unlock();
+  const bool loaded = asset->Load();
+  lk.lock();
+  state.loading = false;
+  if (!loaded)
+    return false;
+
+  m_total_bytes_loaded -= previous_size;
+  m_total_bytes_loaded += asset->GetByteSizeInMemory();
+  state.loaded = true;
+  if (!state.watched)
+    WatchAssetFiles(asset, state);
+
+  if (m_total_bytes_loaded > m_max_memory_available)
+    EvictUnusedAssets();
+  UpdateMemoryExceeded();
+  return true;
+}
+
+void CustomAssetLoader::EvictUnusedAssets()
+{
+  if (m_total_bytes_loaded <= m_max_memory_available)
+    return;
+
+  std::vector<std::pair<u64, const CustomAsset*>> candidates;
+  for (const auto& [asset_ptr, state] : m_assets)
+  {
+    if (state.evictable && state.loaded && !state.loading &&
+        state.last_request_frame + MIN_FRAMES_BEFORE_EVICTION <= m_frame)
+    {
+      candidates.emplace_back(state.last_request_frame, asset_ptr);
+    }
+  }
+  std::ranges::sort(candidates);
+
+  std::size_t bytes_evicted = 0;
+  std::size_t assets_evicted = 0;
+  for (const auto& [frame, asset_ptr] : candidates)
+  {
+    if (m_total_bytes_loaded <= m_max_memory_available)
+      break;
+
+    // Releasing the last reference to an asset below destroys it, which removes its state
+    const auto it = m_assets.find(asset_ptr);
+    if (it == m_assets.end())
+      continue;
+    const auto asset = it->second.asset.lock();
+    if (!asset)
+      continue;
+
+    const std::size_t size = asset->GetByteSizeInMemory();
+    asset->Unload();
+    it->second.loaded = false;
+    it->second.evicted = true;
+    m_total_bytes_loaded -= size;
+    bytes_evicted += size;
+    assets_evicted++;
+  }
+
+  if (assets_evicted != 0)
+  {
+    INFO_LOG_FMT(VIDEO, "Unloaded {} unused assets to free {} MiB of asset memory.", assets_evicted,
+                 bytes_evicted / (1024 * 1024));
+  }
+}
+
+void CustomAssetLoader::UpdateMemoryExceeded()
+{
+  const bool memory_exceeded = m_total_bytes_loaded > m_max_memory_available;
+  if (memory_exceeded == m_memory_exceeded)
+    return;
+
+  m_memory_exceeded = memory_exceeded;
+  if (memory_exceeded)
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset memory exceeded, future assets won't load until assets that "
+                         "aren't used anymore are unloaded.");
+  }
+  else
+  {
+    INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
+    m_load_cv.notify_all();
+  }
+}
+
+void CustomAssetLoader::WatchAssetFiles(const CustomAsset* asset, AssetState& state)
+{
+#ifdef __linux__
+  if (m_watch_fd < 0)
+    return;
+
+  const std::vector<std::filesystem::path> files = asset->GetFiles();
+  if (files.empty())
+    return;
+
+  for (const std::filesystem::path& file : files)
+  {
+    // Editors often save by writing a new file and moving it over the old one, which can only be
+    // seen from the directory
+    const std::filesystem::path directory = file.parent_path();
+    const int wd = inotify_add_watch(m_watch_fd, directory.empty() ? "." : directory.c_str(),
+                                     IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0)
+    {
+      UnwatchAssetFiles(asset);
+      return;
+    }
+    m_watched_directories[wd] = directory;
+    m_watched_files[file].insert(asset);
+  }
+  state.watched = true;
+#endif
+}
+
+void CustomAssetLoader::UnwatchAssetFiles(const CustomAsset* asset)
+{
+  for (auto it = m_watched_files.begin(); it != m_watched_files.end();)
+  {
+    it->second.erase(asset);
+    if (it->second.empty())
+      it = m_watched_files.erase(it);
+    else
+      ++it;
+  }
+}
+
+std::vector<const CustomAsset*>
+CustomAssetLoader::WaitForFileChanges(std::chrono::milliseconds timeout)
+{
+  std::vector<const CustomAsset*> result;
+#ifdef __linux__
+  if (m_watch_fd >= 0)
+  {
+    pollfd pfd{m_watch_fd, POLLIN, 0};
+    if (poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0)
+      return result;
+
+    std::lock_guard lk(m_asset_load_lock);
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(m_watch_fd, buffer, sizeof(buffer))) > 0)
+    {
+      for (const char* ptr = buffer; ptr < buffer + length;)
+      {
+        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+        ptr += sizeof(inotify_event) + event->len;
+
+        const auto directory = m_watched_directories.find(event->wd);
+        if (directory == m_watched_directories.end())
+          continue;
+        if (event->mask & IN_IGNORED)
+        {
+          // The directory is gone, whatever comes back in its place can only be polled
+          for (const auto& [file, assets] : m_watched_files)
+          {
+            if (file.parent_path() != directory->second)
+              continue;
+            for (const CustomAsset* asset : assets)
+            {
+              if (const auto it = m_assets.find(asset); it != m_assets.end())
+                it->second.watched = false;
+            }
+          }
+          m_watched_directories.erase(directory);
+          continue;
+        }
+        if (event->len == 0)
+          continue;
+
+        const auto files = m_watched_files.find(directory->second / event->name);
+        if (files != m_watched_files.end())
+          result.insert(result.end(), files->second.begin(), files->second.end());
+      }
+    }
+    return result;
+  }
+#endif
+  std::this_thread::sleep_for(timeout);
+  return result;
+}
 }  // namespace VideoCommon
@@ -4,14 +4,21 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Common/Flag.h"
-#include "Common/Logging/Log.h"
-#include "Common/WorkQueueThread.h"
+#include "Common/HookableEvent.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/MeshAsset.h"
@@ -22,6 +29,9 @@ namespace VideoCommon
 {
 // This class is responsible for loading data asynchronously when requested
 // and watches that data asynchronously reloading it if it changes
+// Loads are spread over a few worker threads, the assets requested most recently load first
+// When the loaded data goes over the memory budget, the game textures that haven't been
+// requested for the longest time are unloaded again, they are reloaded when requested
 class CustomAssetLoader
 {
 public:
@@ -65,27 +75,74 @@ private:
     {
       auto shared = it->second.lock();
       if (shared)
+      {
+        RequestAsset(shared.get());
         return shared;
+      }
     }
     std::shared_ptr<AssetType> ptr(new AssetType(std::move(library), asset_id), [&](AssetType* a) {
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        m_total_bytes_loaded -= a->GetByteSizeInMemory();
-        m_assets_to_monitor.erase(a->GetAssetId());
-        if (m_max_memory_available >= m_total_bytes_loaded && m_memory_exceeded)
-        {
-          INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
-          m_memory_exceeded = false;
-        }
-      }
+      OnAssetDestroyed(a);
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    // Game textures are requested again every time the texture cache needs them, the users of
+    // the other assets hold on to them for as long as they are used
+    AddAsset(ptr, std::is_same_v<AssetType, GameTextureAsset>);
     return ptr;
   }
 
+  struct AssetState
+  {
+    std::weak_ptr<CustomAsset> asset;
+    u64 last_request_frame = 0;
+    u64 queue_frame = 0;
+    u64 queue_sequence = 0;
+    bool queued = false;
+    bool loading = false;
+    bool loaded = false;
+    bool evictable = false;
+    bool evicted = false;
+    bool watched = false;
+  };
+
+  // Pending loads are sorted with the most recently requested first, and in request order after
+  // that
+  struct PendingLoad
+  {
+    u64 frame;
+    u64 sequence;
+    const CustomAsset* asset;
+
+    bool operator<(const PendingLoad& other) const
+    {
+      return std::tie(other.frame, sequence) < std::tie(frame, other.sequence);
+    }
+  };
+
+  void AddAsset(std::shared_ptr<CustomAsset> asset, bool evictable);
+  void RequestAsset(const CustomAsset* asset);
+  void OnAssetDestroyed(const CustomAsset* asset);
+  void QueueLoad(const CustomAsset* asset, AssetState& state);
+  void OnFrameEnd();
+
+  void LoadWorker();
+  void MonitorAssets();
+  // Expects the lock to be held, it is released while the asset loads
+  bool LoadAsset(std::unique_lock<std::recursive_mutex>& lk, CustomAsset* asset,
+                 AssetState& state);
+  void EvictUnusedAssets();
+  void UpdateMemoryExceeded();
+
+  void WatchAssetFiles(const CustomAsset* asset, AssetState& state);
+  void UnwatchAssetFiles(const CustomAsset* asset);
+  // Waits for changes to the watched files for up to the given time, returning the assets that
+  // changed
+  std::vector<const CustomAsset*> WaitForFileChanges(std::chrono::milliseconds timeout);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
+  // Assets that were requested less than this many frames ago are never evicted
+  static constexpr u64 MIN_FRAMES_BEFORE_EVICTION = 300;
+  static constexpr u32 MAX_LOAD_WORKERS = 4;
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<PixelShaderAsset>> m_pixel_shaders;
@@ -93,16 +150,28 @@ private:
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<MeshAsset>> m_meshes;
   std::thread m_asset_monitor_thread;
   Common::Flag m_asset_monitor_thread_shutdown;
+  std::vector<std::thread> m_load_workers;
+  bool m_load_workers_shutdown = false;
+  Common::EventHook m_frame_end_event;
 
   std::size_t m_total_bytes_loaded = 0;
   std::size_t m_max_memory_available = 0;
-  std::atomic_bool m_memory_exceeded = false;
+  bool m_memory_exceeded = false;
+
+  u64 m_frame = 0;
+  u64 m_queue_sequence = 0;
+  std::unordered_map<const CustomAsset*, AssetState> m_assets;
+  std::set<PendingLoad> m_pending_loads;
 
-  std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
+  // Changes to the files of assets are picked up through inotify where available, assets that
+  // can't be watched have their write times polled
+  int m_watch_fd = -1;
+  std::map<int, std::filesystem::path> m_watched_directories;
+  std::map<std::filesystem::path, std::set<const CustomAsset*>> m_watched_files;
 
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
-  // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
+  // iterating over the assets, which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+  std::condition_variable_any m_load_cv;
 };
 }  // namespace VideoCommon
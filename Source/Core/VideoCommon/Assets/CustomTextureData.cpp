@@ -14,6 +14,7 @@
 #include "Common/Image.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "VideoCommon/Assets/TextureTranscoder.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace
@@ -417,8 +418,8 @@ static bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
   }
 
   // We also need to ensure the backend supports these formats natively before loading them,
-  // otherwise, fallback to SOIL, which will decompress them to RGBA.
-  if (needs_s3tc && !g_ActiveConfig.backend_info.bSupportsST3CTextures)
+  // or that they can be transcoded to a format that it supports.
+  if (needs_s3tc && !VideoCommon::CanLoadS3TCTextures())
     return false;
 
   // Mip levels smaller than the block size are padded to multiples of the block size.
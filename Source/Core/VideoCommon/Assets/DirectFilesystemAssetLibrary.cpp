@@ -17,6 +17,7 @@
 #include "VideoCommon/Assets/MeshAsset.h"
 #include "VideoCommon/Assets/ShaderAsset.h"
 #include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TextureTranscoder.h"
 #include "VideoCommon/RenderState.h"
 
 namespace VideoCommon
@@ -75,6 +76,20 @@ DirectFilesystemAssetLibrary::GetLastAssetWriteTime(const AssetID& asset_id) con
   return {};
 }
 
+std::vector<std::filesystem::path>
+DirectFilesystemAssetLibrary::GetAssetFiles(const AssetID& asset_id) const
+{
+  std::vector<std::filesystem::path> result;
+  std::lock_guard lk(m_lock);
+  if (auto iter = m_assetid_to_asset_map_path.find(asset_id);
+      iter != m_assetid_to_asset_map_path.end())
+  {
+    for (const auto& [key, value] : iter->second)
+      result.push_back(value);
+  }
+  return result;
+}
+
 CustomAssetLibrary::LoadInfo DirectFilesystemAssetLibrary::LoadPixelShader(const AssetID& asset_id,
                                                                            PixelShaderData* data)
 {
@@ -395,6 +410,7 @@ CustomAssetLibrary::LoadInfo DirectFilesystemAssetLibrary::LoadTexture(const Ass
     if (!LoadMips(texture_path->second, &data->m_texture.m_slices[0]))
       return {};
 
+    TranscodeCustomTexture(&data->m_texture);
     return LoadInfo{GetAssetSize(data->m_texture) + metadata_size, GetLastAssetWriteTime(asset_id)};
   }
   else if (ext == ".png")
@@ -426,6 +442,7 @@ CustomAssetLibrary::LoadInfo DirectFilesystemAssetLibrary::LoadTexture(const Ass
     if (!LoadMips(texture_path->second, &slice))
       return {};
 
+    TranscodeCustomTexture(&data->m_texture);
     return LoadInfo{GetAssetSize(data->m_texture) + metadata_size, GetLastAssetWriteTime(asset_id)};
   }
 
@@ -28,6 +28,9 @@ public:
   // Gets the latest time from amongst all the files in the asset map
   TimeType GetLastAssetWriteTime(const AssetID& asset_id) const override;
 
+  // Gets all the files in the asset map
+  std::vector<std::filesystem::path> GetAssetFiles(const AssetID& asset_id) const override;
+
   // Assigns the asset id to a map of files, how this map is read is dependent on the data
   // For instance, a raw texture would expect the map to have a single entry and load that
   // file as the asset.  But a model file data might have its data spread across multiple files
@@ -0,0 +1,600 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TextureTranscoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <xxhash.h>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "VideoCommon/AbstractTexture.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 TRANSCODE_CACHE_MAGIC = 0x32435445;  // 'ETC2'
+constexpr u32 TRANSCODE_CACHE_VERSION = 1;
+
+struct TranscodeCacheHeader
+{
+  u32 magic;
+  u32 version;
+  u64 source_hash;
+};
+
+// The intensity modifiers of the ETC1 subblock modes, for the small and the large index.
+constexpr std::array<std::array<int, 2>, 8> ETC1_MODIFIERS = {{
+    {2, 8},
+    {5, 17},
+    {9, 29},
+    {13, 42},
+    {18, 60},
+    {24, 80},
+    {33, 106},
+    {47, 183},
+}};
+
+// Each row goes from the smallest negative modifier (index 0) to the largest negative one (index
+// 3), then from the smallest positive one (index 4) to the largest positive one (index 7).
+constexpr std::array<std::array<int, 8>, 16> EAC_MODIFIERS = {{
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8},
+}};
+
+// The table whose index 4 is a modifier of 0, used for blocks with a single alpha value.
+constexpr u32 EAC_ZERO_TABLE = 13;
+
+// The texels of a 4x4 block, in the column-major order ETC2 uses for its pixel indices.
+using Block = std::array<std::array<u8, 4>, 16>;
+using Color = std::array<int, 3>;
+
+Block FetchBlock(const u8* rgba, u32 width, u32 height, u32 row_length, u32 block_x,
+                 u32 block_y)
+{
+  Block block;
+  for (u32 x = 0; x < 4; ++x)
+  {
+    for (u32 y = 0; y < 4; ++y)
+    {
+      const u32 src_x = std::min(block_x * 4 + x, width - 1);
+      const u32 src_y = std::min(block_y * 4 + y, height - 1);
+      std::memcpy(block[x * 4 + y].data(), rgba + (size_t{src_y} * row_length + src_x) * 4, 4);
+    }
+  }
+  return block;
+}
+
+void StoreBigEndian(u8* dst, u64 value)
+{
+  for (int i = 7; i >= 0; --i)
+  {
+    dst[i] = static_cast<u8>(value);
+    value >>= 8;
+  }
+}
+
+// Subblock 0 is the left half of the block, or the top half if the block is flipped.
+bool IsInSubblock(u32 texel, bool flip, u32 subblock)
+{
+  const u32 coordinate = flip ? texel % 4 : texel / 4;
+  return (coordinate >= 2) == (subblock == 1);
+}
+
+int Quantize(int value, int max)
+{
+  return (value * max + 127) / 255;
+}
+
+struct SubblockEncoding
+{
+  u32 error = UINT32_MAX;
+  u32 table = 0;
+  // Already at their final position: the MSB of texel i at bit 16 + i, the LSB at bit i.
+  u32 index_bits = 0;
+};
+
+SubblockEncoding EncodeSubblock(const Block& block, bool flip, u32 subblock, const Color& base)
+{
+  SubblockEncoding best;
+  for (u32 table = 0; table < ETC1_MODIFIERS.size(); ++table)
+  {
+    SubblockEncoding encoding{0, table, 0};
+    for (u32 texel = 0; texel < 16; ++texel)
+    {
+      if (!IsInSubblock(texel, flip, subblock))
+        continue;
+
+      u32 best_error = UINT32_MAX;
+      u32 best_index = 0;
+      for (u32 index = 0; index < 4; ++index)
+      {
+        // Bit 0 selects the large modifier, bit 1 negates it.
+        const int modifier = (index & 2) ? -ETC1_MODIFIERS[table][index & 1] :
+                                           ETC1_MODIFIERS[table][index & 1];
+        u32 error = 0;
+        for (u32 c = 0; c < 3; ++c)
+        {
+          const int diff = std::clamp(base[c] + modifier, 0, 255) - block[texel][c];
+          error += static_cast<u32>(diff * diff);
+        }
+        if (error < best_error)
+        {
+          best_error = error;
+          best_index = index;
+        }
+      }
+
+      encoding.error += best_error;
+      encoding.index_bits |= ((best_index >> 1) << (16 + texel)) | ((best_index & 1) << texel);
+    }
+
+    if (encoding.error < best.error)
+      best = encoding;
+  }
+  return best;
+}
+
+// Only uses the two ETC1 modes (which are valid ETC2 blocks), trying both block orientations.
+// The differential mode never overflows its offsets, as that would select the ETC2-only modes.
+u64 EncodeColorBlock(const Block& block)
+{
+  u64 best_bits = 0;
+  u32 best_error = UINT32_MAX;
+  for (const bool flip : {false, true})
+  {
+    std::array<Color, 2> averages{};
+    for (u32 texel = 0; texel < 16; ++texel)
+    {
+      const u32 subblock = IsInSubblock(texel, flip, 0) ? 0 : 1;
+      for (u32 c = 0; c < 3; ++c)
+        averages[subblock][c] += block[texel][c];
+    }
+    for (Color& average : averages)
+    {
+      for (int& value : average)
+        value = (value + 4) / 8;
+    }
+
+    // Differential mode: 5-bit base colors, the second stored as an offset of -4 to 3.
+    Color base0, base1, expanded0, expanded1;
+    for (u32 c = 0; c < 3; ++c)
+    {
+      base0[c] = Quantize(averages[0][c], 31);
+      base1[c] = std::clamp(Quantize(averages[1][c], 31), base0[c] - 4, base0[c] + 3);
+      expanded0[c] = (base0[c] << 3) | (base0[c] >> 2);
+      expanded1[c] = (base1[c] << 3) | (base1[c] >> 2);
+    }
+    SubblockEncoding subblock0 = EncodeSubblock(block, flip, 0, expanded0);
+    SubblockEncoding subblock1 = EncodeSubblock(block, flip, 1, expanded1);
+    if (subblock0.error + subblock1.error < best_error)
+    {
+      best_error = subblock0.error + subblock1.error;
+      best_bits = 0;
+      for (u32 c = 0; c < 3; ++c)
+      {
+        best_bits |= u64(base0[c]) << (59 - c * 8);
+        best_bits |= u64((base1[c] - base0[c]) & 7) << (56 - c * 8);
+      }
+      best_bits |= u64(subblock0.table) << 37 | u64(subblock1.table) << 34 | u64(1) << 33 |
+                   u64(flip) << 32 | subblock0.index_bits | subblock1.index_bits;
+    }
+
+    // Individual mode: two independent 4-bit base colors.
+    for (u32 c = 0; c < 3; ++c)
+    {
+      base0[c] = Quantize(averages[0][c], 15);
+      base1[c] = Quantize(averages[1][c], 15);
+      expanded0[c] = base0[c] * 17;
+      expanded1[c] = base1[c] * 17;
+    }
+    subblock0 = EncodeSubblock(block, flip, 0, expanded0);
+    subblock1 = EncodeSubblock(block, flip, 1, expanded1);
+    if (subblock0.error + subblock1.error < best_error)
+    {
+      best_error = subblock0.error + subblock1.error;
+      best_bits = 0;
+      for (u32 c = 0; c < 3; ++c)
+        best_bits |= u64(base0[c]) << (60 - c * 8) | u64(base1[c]) << (56 - c * 8);
+      best_bits |= u64(subblock0.table) << 37 | u64(subblock1.table) << 34 | u64(flip) << 32 |
+                   subblock0.index_bits | subblock1.index_bits;
+    }
+  }
+  return best_bits;
+}
+
+u64 EncodeAlphaBlock(const Block& block)
+{
+  int min_alpha = 255;
+  int max_alpha = 0;
+  for (const auto& texel : block)
+  {
+    min_alpha = std::min<int>(min_alpha, texel[3]);
+    max_alpha = std::max<int>(max_alpha, texel[3]);
+  }
+
+  if (min_alpha == max_alpha)
+  {
+    u64 bits = u64(min_alpha) << 56 | u64(1) << 52 | u64(EAC_ZERO_TABLE) << 48;
+    for (u32 texel = 0; texel < 16; ++texel)
+      bits |= u64(4) << (45 - texel * 3);
+    return bits;
+  }
+
+  u64 best_bits = 0;
+  u32 best_error = UINT32_MAX;
+  for (u32 table = 0; table < EAC_MODIFIERS.size(); ++table)
+  {
+    // Fit the modifier range to the alpha range, then also try the neighbouring multipliers.
+    const int low = EAC_MODIFIERS[table][3];
+    const int high = EAC_MODIFIERS[table][7];
+    const int multiplier = (max_alpha - min_alpha + (high - low) / 2) / (high - low);
+    for (int m = std::max(multiplier - 1, 1); m <= std::min(multiplier + 1, 15); ++m)
+    {
+      const int base = std::clamp((min_alpha + max_alpha - (low + high) * m + 1) / 2, 0, 255);
+      u64 bits = u64(base) << 56 | u64(m) << 52 | u64(table) << 48;
+      u32 error = 0;
+      for (u32 texel = 0; texel < 16; ++texel)
+      {
+        u32 best_texel_error = UINT32_MAX;
+        u32 best_index = 0;
+        for (u32 index = 0; index < 8; ++index)
+        {
+          const int diff =
+              std::clamp(base + EAC_MODIFIERS[table][index] * m, 0, 255) - block[texel][3];
+          if (static_cast<u32>(diff * diff) < best_texel_error)
+          {
+            best_texel_error = static_cast<u32>(diff * diff);
+            best_index = index;
+          }
+        }
+        error += best_texel_error;
+        bits |= u64(best_index) << (45 - texel * 3);
+      }
+
+      if (error < best_error)
+      {
+        best_error = error;
+        best_bits = bits;
+      }
+    }
+  }
+  return best_bits;
+}
+
+// The texels of a decoded S3TC block, in row-major order.
+using S3TCBlock = std::array<std::array<u8, 4>, 16>;
+
+void DecodeS3TCColorBlock(const u8* src, bool allow_transparency, S3TCBlock* block)
+{
+  const u16 raw0 = src[0] | (src[1] << 8);
+  const u16 raw1 = src[2] | (src[3] << 8);
+  const auto expand = [](u16 raw) {
+    const int r = (raw >> 11) & 0x1F;
+    const int g = (raw >> 5) & 0x3F;
+    const int b = raw & 0x1F;
+    return std::array<int, 4>{(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255};
+  };
+
+  std::array<std::array<int, 4>, 4> colors{expand(raw0), expand(raw1)};
+  // DXT3 and DXT5 always use four colors, only DXT1 has the mode with transparent black.
+  const bool four_colors = raw0 > raw1 || !allow_transparency;
+  for (u32 c = 0; c < 3; ++c)
+  {
+    if (four_colors)
+    {
+      colors[2][c] = (2 * colors[0][c] + colors[1][c]) / 3;
+      colors[3][c] = (colors[0][c] + 2 * colors[1][c]) / 3;
+    }
+    else
+    {
+      colors[2][c] = (colors[0][c] + colors[1][c]) / 2;
+      colors[3][c] = 0;
+    }
+  }
+  colors[2][3] = 255;
+  colors[3][3] = four_colors ? 255 : 0;
+
+  const u32 indices = src[4] | (src[5] << 8) | (src[6] << 16) | (u32(src[7]) << 24);
+  for (u32 texel = 0; texel < 16; ++texel)
+  {
+    const auto& color = colors[(indices >> (texel * 2)) & 3];
+    for (u32 c = 0; c < 4; ++c)
+      (*block)[texel][c] = static_cast<u8>(color[c]);
+  }
+}
+
+u64 LoadLittleEndian(const u8* src, u32 size)
+{
+  u64 value = 0;
+  for (u32 i = 0; i < size; ++i)
+    value |= u64(src[i]) << (i * 8);
+  return value;
+}
+
+void DecodeDXT3AlphaBlock(const u8* src, S3TCBlock* block)
+{
+  const u64 alphas = LoadLittleEndian(src, 8);
+  for (u32 texel = 0; texel < 16; ++texel)
+    (*block)[texel][3] = static_cast<u8>(((alphas >> (texel * 4)) & 0xF) * 17);
+}
+
+void DecodeDXT5AlphaBlock(const u8* src, S3TCBlock* block)
+{
+  std::array<int, 8> alphas{src[0], src[1]};
+  if (alphas[0] > alphas[1])
+  {
+    for (int i = 1; i < 7; ++i)
+      alphas[i + 1] = ((7 - i) * alphas[0] + i * alphas[1]) / 7;
+  }
+  else
+  {
+    for (int i = 1; i < 5; ++i)
+      alphas[i + 1] = ((5 - i) * alphas[0] + i * alphas[1]) / 5;
+    alphas[6] = 0;
+    alphas[7] = 255;
+  }
+
+  const u64 indices = LoadLittleEndian(src + 2, 6);
+  for (u32 texel = 0; texel < 16; ++texel)
+    (*block)[texel][3] = static_cast<u8>(alphas[(indices >> (texel * 3)) & 7]);
+}
+
+bool IsS3TCFormat(AbstractTextureFormat format)
+{
+  return format == AbstractTextureFormat::DXT1 || format == AbstractTextureFormat::DXT3 ||
+         format == AbstractTextureFormat::DXT5;
+}
+
+bool ShouldTranscode(const CustomTextureData& texture)
+{
+  if (texture.m_slices.empty())
+    return false;
+
+  for (const auto& slice : texture.m_slices)
+  {
+    if (slice.m_levels.empty())
+      return false;
+
+    // Compressed formats that the backend supports are already as small as ETC2.
+    const auto& first_level = slice.m_levels[0];
+    const AbstractTextureFormat format = first_level.format;
+    if (format != AbstractTextureFormat::RGBA8 &&
+        !(IsS3TCFormat(format) && !g_ActiveConfig.backend_info.bSupportsST3CTextures))
+    {
+      return false;
+    }
+
+    // Keep the same restrictions that DDS files have for block compressed formats.
+    if (first_level.width % 4 != 0 || first_level.height % 4 != 0)
+      return false;
+
+    // Mismatched levels are rejected later, leave them alone.
+    if (std::any_of(slice.m_levels.begin(), slice.m_levels.end(),
+                    [format](const auto& level) { return level.format != format; }))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+u64 HashTexture(const CustomTextureData& texture)
+{
+  u64 hash = TRANSCODE_CACHE_VERSION;
+  for (const auto& slice : texture.m_slices)
+  {
+    for (const auto& level : slice.m_levels)
+    {
+      const std::array<u32, 4> parameters{level.width, level.height, level.row_length,
+                                          static_cast<u32>(level.format)};
+      hash = XXH3_64bits_withSeed(parameters.data(), sizeof(parameters), hash);
+      hash = XXH3_64bits_withSeed(level.data.data(), level.data.size(), hash);
+    }
+  }
+  return hash;
+}
+
+u32 GetTranscodedRowLength(u32 width)
+{
+  return (width + 3) & ~3;
+}
+
+size_t GetTranscodedSize(u32 width, u32 height)
+{
+  return size_t{AbstractTexture::CalculateStrideForFormat(AbstractTextureFormat::ETC2,
+                                                          GetTranscodedRowLength(width))} *
+         ((height + 3) / 4);
+}
+
+bool ReadTranscodeCache(const std::string& path, u64 hash, CustomTextureData* texture)
+{
+  File::IOFile file(path, "rb");
+  TranscodeCacheHeader header;
+  if (!file.IsOpen() || !file.ReadArray(&header, 1) || header.magic != TRANSCODE_CACHE_MAGIC ||
+      header.version != TRANSCODE_CACHE_VERSION || header.source_hash != hash)
+  {
+    return false;
+  }
+
+  size_t size = sizeof(header);
+  for (const auto& slice : texture->m_slices)
+  {
+    for (const auto& level : slice.m_levels)
+      size += GetTranscodedSize(level.width, level.height);
+  }
+  if (file.GetSize() != size)
+    return false;
+
+  std::vector<CustomTextureData::ArraySlice> slices = texture->m_slices;
+  for (auto& slice : slices)
+  {
+    for (auto& level : slice.m_levels)
+    {
+      level.data.resize(GetTranscodedSize(level.width, level.height));
+      if (!file.ReadBytes(level.data.data(), level.data.size()))
+        return false;
+      level.format = AbstractTextureFormat::ETC2;
+      level.row_length = GetTranscodedRowLength(level.width);
+    }
+  }
+
+  texture->m_slices = std::move(slices);
+  return true;
+}
+
+void WriteTranscodeCache(const std::string& path, u64 hash, const CustomTextureData& texture)
+{
+  // Write to a temporary file first, so that other threads never see a partial file.
+  const std::string temp_path = path + ".tmp";
+  File::CreateFullPath(path);
+  {
+    File::IOFile file(temp_path, "wb");
+    const TranscodeCacheHeader header{TRANSCODE_CACHE_MAGIC, TRANSCODE_CACHE_VERSION, hash};
+    bool success = file.WriteArray(&header, 1);
+    for (const auto& slice : texture.m_slices)
+    {
+      for (const auto& level : slice.m_levels)
+        success = success && file.WriteBytes(level.data.data(), level.data.size());
+    }
+    if (!success)
+    {
+      file.Close();
+      File::Delete(temp_path);
+      WARN_LOG_FMT(VIDEO, "Failed to write transcoded texture '{}'", path);
+      return;
+    }
+  }
+
+  if (!File::Rename(temp_path, path))
+    File::Delete(temp_path);
+}
+}  // namespace
+
+std::vector<u8> EncodeETC2(const u8* rgba, u32 width, u32 height, u32 row_length)
+{
+  const u32 blocks_wide = (width + 3) / 4;
+  const u32 blocks_high = (height + 3) / 4;
+  std::vector<u8> blocks(size_t{blocks_wide} * blocks_high * 16);
+  u8* dst = blocks.data();
+  for (u32 block_y = 0; block_y < blocks_high; ++block_y)
+  {
+    for (u32 block_x = 0; block_x < blocks_wide; ++block_x)
+    {
+      const Block block = FetchBlock(rgba, width, height, row_length, block_x, block_y);
+      StoreBigEndian(dst, EncodeAlphaBlock(block));
+      StoreBigEndian(dst + 8, EncodeColorBlock(block));
+      dst += 16;
+    }
+  }
+  return blocks;
+}
+
+std::vector<u8> DecodeS3TC(const u8* data, AbstractTextureFormat format, u32 width, u32 height,
+                           u32 row_length)
+{
+  const u32 blocks_wide = (width + 3) / 4;
+  const u32 blocks_high = (height + 3) / 4;
+  const u32 src_stride = AbstractTexture::CalculateStrideForFormat(format, row_length);
+  const u32 block_size = AbstractTexture::GetTexelSizeForFormat(format);
+  const u32 dst_row_length = blocks_wide * 4;
+
+  std::vector<u8> rgba(size_t{dst_row_length} * blocks_high * 4 * 4);
+  for (u32 block_y = 0; block_y < blocks_high; ++block_y)
+  {
+    for (u32 block_x = 0; block_x < blocks_wide; ++block_x)
+    {
+      const u8* src = data + size_t{block_y} * src_stride + block_x * block_size;
+      S3TCBlock block;
+      if (format == AbstractTextureFormat::DXT1)
+      {
+        DecodeS3TCColorBlock(src, true, &block);
+      }
+      else
+      {
+        DecodeS3TCColorBlock(src + 8, false, &block);
+        if (format == AbstractTextureFormat::DXT3)
+          DecodeDXT3AlphaBlock(src, &block);
+        else
+          DecodeDXT5AlphaBlock(src, &block);
+      }
+
+      for (u32 y = 0; y < 4; ++y)
+      {
+        u8* dst = rgba.data() + ((size_t{block_y} * 4 + y) * dst_row_length + block_x * 4) * 4;
+        std::memcpy(dst, block[y * 4].data(), 4 * 4);
+      }
+    }
+  }
+  return rgba;
+}
+
+void TranscodeCustomTexture(CustomTextureData* texture)
+{
+  if (!g_ActiveConfig.UseHiresTextureTranscoding() || !ShouldTranscode(*texture))
+    return;
+
+  const u64 hash = HashTexture(*texture);
+  const std::string cache_path = fmt::format("{}TranscodedTextures/{:016x}.etc2",
+                                             File::GetUserPath(D_CACHE_IDX), hash);
+  if (ReadTranscodeCache(cache_path, hash, texture))
+    return;
+
+  Common::Timer timer;
+  timer.Start();
+  for (auto& slice : texture->m_slices)
+  {
+    for (auto& level : slice.m_levels)
+    {
+      if (IsS3TCFormat(level.format))
+      {
+        const std::vector<u8> rgba =
+            DecodeS3TC(level.data.data(), level.format, level.width, level.height,
+                       level.row_length);
+        level.data = EncodeETC2(rgba.data(), level.width, level.height,
+                                GetTranscodedRowLength(level.width));
+      }
+      else
+      {
+        level.data = EncodeETC2(level.data.data(), level.width, level.height, level.row_length);
+      }
+      level.format = AbstractTextureFormat::ETC2;
+      level.row_length = GetTranscodedRowLength(level.width);
+    }
+  }
+
+  DEBUG_LOG_FMT(VIDEO, "Transcoded a custom texture to ETC2 in {} ms", timer.ElapsedMs());
+  WriteTranscodeCache(cache_path, hash, *texture);
+}
+
+bool CanLoadS3TCTextures()
+{
+  return g_ActiveConfig.backend_info.bSupportsST3CTextures ||
+         g_ActiveConfig.UseHiresTextureTranscoding();
+}
+}  // namespace VideoCommon
@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/TextureConfig.h"
+
+namespace VideoCommon
+{
+// Encodes RGBA8 texels to ETC2 RGBA8 blocks (an ETC2 color block and an EAC alpha block each).
+// Texels past the edge of the image are clamped, so any size can be encoded.
+// row_length is the distance between rows, in texels.
+std::vector<u8> EncodeETC2(const u8* rgba, u32 width, u32 height, u32 row_length);
+
+// Decodes DXT1, DXT3 or DXT5 blocks to RGBA8. The result covers whole blocks, so its row length
+// is the width rounded up to a multiple of 4.
+std::vector<u8> DecodeS3TC(const u8* data, AbstractTextureFormat format, u32 width, u32 height,
+                           u32 row_length);
+
+// GPUs without BCn support (which is most mobile GPUs) would otherwise have to sample custom
+// textures as RGBA8, or couldn't load S3TC DDS files at all. When transcoding is enabled and the
+// backend supports ETC2, this converts RGBA8 and S3TC textures to ETC2 instead, which is a quarter
+// of the size of RGBA8. Encoding is slow, so the results are kept in the cache directory, keyed by
+// the hash of the source data.
+void TranscodeCustomTexture(CustomTextureData* texture);
+
+// Whether S3TC textures can be loaded, either directly or by transcoding them.
+bool CanLoadS3TCTextures();
+}  // namespace VideoCommon
@@ -169,6 +169,7 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
     break;
 
   case Event::PERF_QUERY:
+    INCSTAT(g_stats.this_frame.num_perf_query_stalls);
     g_perf_query->FlushResults();
     break;
 
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -36,7 +37,7 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   else
   {
     std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    m_pending_work.emplace(priority, PendingWorkItem{std::move(item), Clock::now()});
     m_worker_thread_wake.notify_one();
   }
 }
@@ -114,6 +115,47 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   return true;
 }
 
+void AsyncShaderCompiler::SetFrameBudget(DT budget, u32 max_unbudgeted_priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  if (budget == DT{})
+    m_active_worker_limit = static_cast<u32>(m_worker_threads.size());
+  m_frame_budget = budget;
+  m_max_unbudgeted_priority = max_unbudgeted_priority;
+  m_worker_thread_wake.notify_all();
+}
+
+AsyncShaderCompiler::FrameMetrics AsyncShaderCompiler::EndFrame(double speed_headroom)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  const u32 num_workers = static_cast<u32>(m_worker_threads.size());
+  if (m_frame_budget != DT{} && ++m_frames_since_scaling >= WORKER_SCALING_INTERVAL)
+  {
+    // Only add workers back while there is background work to do, so that an idle compiler
+    // doesn't ramp up to all threads just because there's headroom.
+    m_frames_since_scaling = 0;
+    if (speed_headroom < 1.0 + HEADROOM_LOW && m_active_worker_limit > 1)
+      m_active_worker_limit--;
+    else if (speed_headroom > 1.0 + HEADROOM_HIGH && m_active_worker_limit < num_workers &&
+             !m_pending_work.empty())
+      m_active_worker_limit++;
+  }
+
+  FrameMetrics metrics = m_frame_metrics;
+  metrics.pending_items = m_pending_work.size();
+  metrics.active_workers = std::min(m_active_worker_limit, num_workers);
+  if (m_num_latency_samples != 0)
+    metrics.average_latency = m_total_latency / m_num_latency_samples;
+
+  m_frame_metrics = {};
+  m_num_latency_samples = 0;
+  m_total_latency = {};
+
+  // The new budget may let waiting workers run again.
+  m_worker_thread_wake.notify_all();
+  return metrics;
+}
+
 bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 {
   if (num_worker_threads == 0)
@@ -143,6 +185,11 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
     m_worker_threads.push_back(std::move(thr));
   }
 
+  {
+    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    m_active_worker_limit = static_cast<u32>(m_worker_threads.size());
+  }
+
   return HasWorkerThreads();
 }
 
@@ -196,6 +243,7 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
+  Common::SetCurrentThreadBackgroundPriority();
 
   // Initialize worker thread with backend-specific method.
   if (!WorkerThreadInitWorkerThread(param))
@@ -214,6 +262,19 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   WorkerThreadExit(param);
 }
 
+bool AsyncShaderCompiler::CanRunWorkItem(u32 priority) const
+{
+  if (m_frame_budget == DT{})
+    return true;
+
+  // Work the current frame is waiting for always runs, everything else has to fit within the
+  // active worker count and the frame's budget.
+  if (priority <= m_max_unbudgeted_priority)
+    return true;
+  return m_busy_workers.load() < m_active_worker_limit &&
+         m_frame_metrics.budgeted_compile_time < m_frame_budget;
+}
+
 void AsyncShaderCompiler::WorkerThreadRun()
 {
   std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
@@ -223,20 +284,38 @@ void AsyncShaderCompiler::WorkerThreadRun()
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
-      m_busy_workers++;
+      // The queue is sorted by priority, so if the first item has to wait, all of them do.
       auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
+      const u32 priority = iter->first;
+      if (!CanRunWorkItem(priority))
+        break;
+
+      m_busy_workers++;
+      PendingWorkItem work(std::move(iter->second));
       m_pending_work.erase(iter);
       pending_lock.unlock();
 
-      if (item->Compile())
+      const TimePoint start_time = Clock::now();
+      if (work.item->Compile())
       {
         std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-        m_completed_work.push_back(std::move(item));
+        m_completed_work.push_back(std::move(work.item));
       }
+      const TimePoint end_time = Clock::now();
 
       pending_lock.lock();
       m_busy_workers--;
+      if (priority > m_max_unbudgeted_priority)
+      {
+        m_frame_metrics.budgeted_compile_time += end_time - start_time;
+      }
+      else
+      {
+        const DT latency = end_time - work.queue_time;
+        m_frame_metrics.max_latency = std::max(m_frame_metrics.max_latency, latency);
+        m_total_latency += latency;
+        m_num_latency_samples++;
+      }
     }
   }
 }
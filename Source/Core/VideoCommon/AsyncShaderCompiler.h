@@ -33,6 +33,18 @@ public:
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
 
+  // Queue depth and latency, since the last call to EndFrame().
+  struct FrameMetrics
+  {
+    size_t pending_items = 0;
+    u32 active_workers = 0;
+    // Time spent compiling budgeted work items.
+    DT budgeted_compile_time{};
+    // Time from queueing to completion of unbudgeted work items.
+    DT max_latency{};
+    DT average_latency{};
+  };
+
   AsyncShaderCompiler();
   virtual ~AsyncShaderCompiler();
 
@@ -53,6 +65,16 @@ public:
   // Returns false if interrupted.
   bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
 
+  // Limits the time the worker threads spend per frame on work items with a priority value above
+  // max_unbudgeted_priority. Once the budget is used up, those wait for the next frame, while
+  // work items with lower values still run. A zero budget removes the limit.
+  void SetFrameBudget(DT budget, u32 max_unbudgeted_priority);
+
+  // Starts a new frame budget, and adjusts how many workers may compile at once. speed_headroom is
+  // how much faster than full speed the emulation could run: below 1 + HEADROOM_LOW, compiling
+  // is taking time away from the emulation, so fewer workers run. Returns the metrics of the frame.
+  FrameMetrics EndFrame(double speed_headroom);
+
   // Needed because of calling virtual methods in shutdown procedure.
   bool StartWorkerThreads(u32 num_worker_threads);
   bool ResizeWorkerThreads(u32 num_worker_threads);
@@ -65,8 +87,20 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
+  struct PendingWorkItem
+  {
+    WorkItemPtr item;
+    TimePoint queue_time;
+  };
+
+  // Adjust the active worker count after this many frames.
+  static constexpr u32 WORKER_SCALING_INTERVAL = 30;
+  static constexpr double HEADROOM_LOW = 0.1;
+  static constexpr double HEADROOM_HIGH = 0.5;
+
   void WorkerThreadEntryPoint(void* param);
   void WorkerThreadRun();
+  bool CanRunWorkItem(u32 priority) const;
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -76,11 +110,20 @@ private:
 
   // A multimap is used to store the work items. We can't use a priority_queue here, because
   // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
+  std::multimap<u32, PendingWorkItem> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
   std::atomic_size_t m_busy_workers{0};
 
+  // Frame budget state, protected by m_pending_work_lock.
+  DT m_frame_budget{};
+  u32 m_max_unbudgeted_priority = 0;
+  u32 m_active_worker_limit = 0;
+  u32 m_frames_since_scaling = 0;
+  FrameMetrics m_frame_metrics;
+  size_t m_num_latency_samples = 0;
+  DT m_total_latency{};
+
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
 };
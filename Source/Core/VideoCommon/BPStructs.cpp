@@ -37,6 +37,7 @@
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -88,6 +89,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
           bp.address == BPMEM_TEXINVALIDATE || bp.address == BPMEM_PRELOAD_MODE ||
           bp.address == BPMEM_CLEAR_PIXEL_PERF))
     {
+      INCSTAT(g_stats.this_frame.num_bp_loads_redundant);
       return;
     }
   }
@@ -95,6 +97,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   FlushPipeline();
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
+  g_vertex_manager->SetShaderUidsChanged();
 
   switch (bp.address)
   {
@@ -9,22 +9,33 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/VideoEvents.h"
 
 #include <algorithm>
 
 std::unique_ptr<BoundingBox> g_bounding_box;
 
+BoundingBox::BoundingBox()
+{
+  m_end_of_frame_event =
+      AfterFrameEvent::Register([this](Core::System&) { EndOfFrame(); }, "BoundingBox");
+}
+
 void BoundingBox::Enable(PixelShaderManager& pixel_shader_manager)
 {
   m_is_active = true;
   pixel_shader_manager.SetBoundingBoxActive(m_is_active);
+  g_vertex_manager->SetShaderUidsChanged();
 }
 
 void BoundingBox::Disable(PixelShaderManager& pixel_shader_manager)
 {
   m_is_active = false;
   pixel_shader_manager.SetBoundingBoxActive(m_is_active);
+  g_vertex_manager->SetShaderUidsChanged();
 }
 
 void BoundingBox::Flush()
@@ -72,6 +83,69 @@ void BoundingBox::Readback()
   m_is_valid = true;
 }
 
+bool BoundingBox::ReadbackFromQueue()
+{
+  const u32 latency = static_cast<u32>(
+      std::clamp<int>(g_ActiveConfig.iBBoxReadbackLatency, 0, MAX_QUEUED_READBACKS - 1));
+  if (latency == 0)
+    return false;
+
+  const QueuedReadback* newest = nullptr;
+  for (u32 slot = 0; slot < MAX_QUEUED_READBACKS; ++slot)
+  {
+    QueuedReadback& readback = m_queued_readbacks[slot];
+    if (!readback.queued || m_frame_number - readback.frame > latency)
+      continue;
+
+    if (!readback.complete)
+    {
+      const auto values = PollReadback(slot);
+      if (!values)
+        continue;
+      readback.values = *values;
+      readback.complete = true;
+    }
+
+    if (!newest || readback.frame > newest->frame)
+      newest = &readback;
+  }
+
+  if (!newest)
+    return false;
+
+  for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+  {
+    if (!m_dirty[i])
+      m_values[i] = newest->values[i];
+  }
+
+  m_is_valid = true;
+  return true;
+}
+
+void BoundingBox::EndOfFrame()
+{
+  ++m_frame_number;
+  if (!m_read_this_frame)
+    return;
+
+  m_read_this_frame = false;
+  if (g_ActiveConfig.iBBoxReadbackLatency <= 0 || !g_ActiveConfig.bBBoxEnable ||
+      !g_ActiveConfig.backend_info.bSupportsBBox)
+  {
+    return;
+  }
+
+  // The copy is queued behind this frame's draws, so it has usually finished by the time the next
+  // frame reads the values.
+  const u32 slot = m_next_readback_slot;
+  if (!QueueReadback(slot))
+    return;
+
+  m_queued_readbacks[slot] = {m_frame_number, true, false, {}};
+  m_next_readback_slot = (slot + 1) % MAX_QUEUED_READBACKS;
+}
+
 u16 BoundingBox::Get(u32 index)
 {
   ASSERT(index < NUM_BBOX_VALUES);
@@ -79,8 +153,19 @@ u16 BoundingBox::Get(u32 index)
   if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
     return m_bounding_box_fallback[index];
 
+  m_read_this_frame = true;
   if (!m_is_valid)
-    Readback();
+  {
+    if (ReadbackFromQueue())
+    {
+      INCSTAT(g_stats.this_frame.num_bbox_queued_reads);
+    }
+    else
+    {
+      INCSTAT(g_stats.this_frame.num_bbox_stalls);
+      Readback();
+    }
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -113,6 +198,10 @@ void BoundingBox::DoState(PointerWrap& p)
   p.DoArray(m_dirty);
   p.Do(m_is_valid);
 
+  // Queued readbacks may belong to a different timeline.
+  if (p.IsReadMode())
+    m_queued_readbacks = {};
+
   // We handle saving the backend values specially rather than using Readback() and Flush() so that
   // we don't mess up the current cache state
   std::vector<BBoxType> backend_values(NUM_BBOX_VALUES);
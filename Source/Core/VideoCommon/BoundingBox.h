@@ -5,10 +5,12 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
 
 class PixelShaderManager;
 class PointerWrap;
@@ -19,7 +21,11 @@ constexpr u32 NUM_BBOX_VALUES = 4;
 class BoundingBox
 {
 public:
-  explicit BoundingBox() = default;
+  // Readbacks that can be in flight at once when the readback latency is non-zero. This also
+  // limits the latency, as a slot is reused after this many frames.
+  static constexpr u32 MAX_QUEUED_READBACKS = 4;
+
+  explicit BoundingBox();
   virtual ~BoundingBox() = default;
 
   bool IsEnabled() const { return m_is_active; }
@@ -41,8 +47,27 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Copies the current values to a staging buffer slot without waiting for the GPU. Returns false
+  // if the backend can't, in which case every readback waits for the GPU.
+  virtual bool QueueReadback(u32) { return false; }
+  // Returns the values copied by QueueReadback(slot) if the GPU has finished the copy.
+  virtual std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollReadback(u32)
+  {
+    return std::nullopt;
+  }
+
 private:
+  struct QueuedReadback
+  {
+    u64 frame = 0;
+    bool queued = false;
+    bool complete = false;
+    std::array<BBoxType, NUM_BBOX_VALUES> values = {};
+  };
+
   void Readback();
+  bool ReadbackFromQueue();
+  void EndOfFrame();
 
   bool m_is_active = false;
 
@@ -61,6 +86,14 @@ private:
   // This produces much better results than just returning garbage, which can cause games like
   // Ultimate Spider-Man to crash
   std::array<u16, 4> m_bounding_box_fallback = {};
+
+  // With a non-zero readback latency, the values are copied to the CPU at the end of each frame in
+  // which they were read, and reads are served from copies that are at most that many frames old.
+  std::array<QueuedReadback, MAX_QUEUED_READBACKS> m_queued_readbacks;
+  u32 m_next_readback_slot = 0;
+  u64 m_frame_number = 0;
+  bool m_read_this_frame = false;
+  Common::EventHook m_end_of_frame_event;
 };
 
 extern std::unique_ptr<BoundingBox> g_bounding_box;
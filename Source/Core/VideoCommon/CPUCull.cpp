@@ -121,6 +121,34 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+static CPUCull::CullTrianglesFunction GetCullTrianglesFunction0()
+{
+#if defined(USE_SSE)
+  if (MIN_SSE >= 50 || cpu_info.bAVX)
+    return CPUCull_AVX::CullTriangles<Primitive, Mode>;
+  else if (MIN_SSE >= 30 || cpu_info.bSSE3)
+    return CPUCull_SSE3::CullTriangles<Primitive, Mode>;
+  else
+    return CPUCull_SSE::CullTriangles<Primitive, Mode>;
+#elif defined(USE_NEON)
+  return CPUCull_NEON::CullTriangles<Primitive, Mode>;
+#else
+  return CPUCull_Scalar::CullTriangles<Primitive, Mode>;
+#endif
+}
+
+template <OpcodeDecoder::Primitive Primitive>
+static Common::EnumMap<CPUCull::CullTrianglesFunction, CullMode::All> GetCullTrianglesFunction1()
+{
+  return {
+      GetCullTrianglesFunction0<Primitive, CullMode::None>(),
+      GetCullTrianglesFunction0<Primitive, CullMode::Back>(),
+      GetCullTrianglesFunction0<Primitive, CullMode::Front>(),
+      GetCullTrianglesFunction0<Primitive, CullMode::All>(),
+  };
+}
+
 CPUCull::~CPUCull() = default;
 
 void CPUCull::Init()
@@ -135,10 +163,34 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLES] = GetCullFunction1<Prim::GX_DRAW_TRIANGLES>();
   m_cull_table[Prim::GX_DRAW_TRIANGLE_STRIP] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
+  m_cull_triangles_table[Prim::GX_DRAW_QUADS] = GetCullTrianglesFunction1<Prim::GX_DRAW_QUADS>();
+  m_cull_triangles_table[Prim::GX_DRAW_QUADS_2] = GetCullTrianglesFunction1<Prim::GX_DRAW_QUADS>();
+  m_cull_triangles_table[Prim::GX_DRAW_TRIANGLES] =
+      GetCullTrianglesFunction1<Prim::GX_DRAW_TRIANGLES>();
+  m_cull_triangles_table[Prim::GX_DRAW_TRIANGLE_STRIP] =
+      GetCullTrianglesFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
+  m_cull_triangles_table[Prim::GX_DRAW_TRIANGLE_FAN] =
+      GetCullTrianglesFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
 bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                                    const u8* src, u32 count)
+{
+  const CullMode cullmode = TransformVertices(loader, primitive, src, count);
+  const CullFunction cull = m_cull_table[primitive][cullmode];
+  return cull(m_transform_buffer.get(), count);
+}
+
+u32 CPUCull::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                           const u8* src, u32 count, u16* indices)
+{
+  const CullMode cullmode = TransformVertices(loader, primitive, src, count);
+  const CullTrianglesFunction cull = m_cull_triangles_table[primitive][cullmode];
+  return cull(m_transform_buffer.get(), count, indices);
+}
+
+CullMode CPUCull::TransformVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                    const u8* src, u32 count)
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
@@ -165,8 +217,7 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+  return cullmode;
 }
 
 template <typename T>
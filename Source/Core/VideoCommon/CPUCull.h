@@ -14,6 +14,10 @@ public:
   void Init();
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  // Writes the triangles that aren't culled to indices as a triangle list, and returns the number
+  // of indices written. The indices are relative to src, and there are fewer than 3 per vertex.
+  u32 CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                    u32 count, u16* indices);
 
   struct alignas(16) TransformedVertex
   {
@@ -22,8 +26,14 @@ public:
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullTrianglesFunction = u32 (*)(const CPUCull::TransformedVertex*, int, u16*);
 
 private:
+  // Transforms the vertices to clip space into the transform buffer, and returns the cull mode to
+  // test them with.
+  CullMode TransformVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                             const u8* src, u32 count);
+
   template <typename T>
   struct BufferDeleter
   {
@@ -35,4 +45,7 @@ private:
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table{};
+  Common::EnumMap<Common::EnumMap<CullTrianglesFunction, CullMode::All>,
+                  OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
+      m_cull_triangles_table{};
 };
@@ -708,6 +708,64 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
   return true;
 }
 
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u16* AddTriangleIfVisible(
+    const CPUCull::TransformedVertex* transformed, u16* out, int a, int b, int c)
+{
+  if (CullTriangle<Mode>(transformed[a], transformed[b], transformed[c]))
+    return out;
+  *out++ = static_cast<u16>(a);
+  *out++ = static_cast<u16>(b);
+  *out++ = static_cast<u16>(c);
+  return out;
+}
+
+// Writes a triangle list of the triangles that aren't culled, in the order IndexGenerator gives
+// them without primitive restart. Returns the number of indices written.
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+ATTR_TARGET static u32 CullTriangles(const CPUCull::TransformedVertex* transformed, int count,
+                                     u16* indices)
+{
+  u16* out = indices;
+  switch (Primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+  {
+    int i = 3;
+    for (; i < count; i += 4)
+    {
+      out = AddTriangleIfVisible<Mode>(transformed, out, i - 3, i - 2, i - 1);
+      out = AddTriangleIfVisible<Mode>(transformed, out, i - 3, i - 1, i - 0);
+    }
+    // three vertices remaining, so render a triangle
+    if (i == count)
+      out = AddTriangleIfVisible<Mode>(transformed, out, i - 3, i - 2, i - 1);
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    for (int i = 2; i < count; i += 3)
+      out = AddTriangleIfVisible<Mode>(transformed, out, i - 2, i - 1, i - 0);
+    break;
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  {
+    bool wind = false;
+    for (int i = 2; i < count; ++i)
+    {
+      out = AddTriangleIfVisible<Mode>(transformed, out, i - 2, i - !wind, i - wind);
+      wind = !wind;
+    }
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+    for (int i = 2; i < count; ++i)
+      out = AddTriangleIfVisible<Mode>(transformed, out, 0, i - 1, i);
+    break;
+  }
+
+  return static_cast<u32>(out - indices);
+}
+
 }  // namespace VECTOR_NAMESPACE
 
 #undef ATTR_TARGET
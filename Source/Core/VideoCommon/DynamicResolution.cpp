@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DynamicResolution.h"
+
+#include <algorithm>
+
+DynamicResolution g_dynamic_resolution;
+
+void DynamicResolution::Reset()
+{
+  *this = {};
+}
+
+bool DynamicResolution::Update(TimePoint now, double max_speed, u32 max_scale)
+{
+  const u32 old_scale = GetScale(max_scale);
+  m_steps_down = std::min(m_steps_down, std::max(max_scale, 1u) - 1);
+
+  if (m_next_evaluation == TimePoint{})
+    m_next_evaluation = now + EVALUATION_INTERVAL;
+  if (now < m_next_evaluation)
+    return GetScale(max_scale) != old_scale;
+  m_next_evaluation = now + EVALUATION_INTERVAL;
+
+  if (m_checking_reduction)
+  {
+    m_checking_reduction = false;
+    if (max_speed < m_speed_before_reduction * MIN_IMPROVEMENT)
+    {
+      // Rendering fewer pixels didn't make the emulation faster, so the GPU isn't what holds it
+      // back.
+      m_steps_down--;
+      m_retry_lower_scale = now + RETRY_INTERVAL;
+    }
+    else
+    {
+      m_retry_higher_scale = now + RETRY_INTERVAL;
+    }
+  }
+  else if (max_speed < SLOW_SPEED && GetScale(max_scale) > 1 && now >= m_retry_lower_scale)
+  {
+    m_speed_before_reduction = max_speed;
+    m_steps_down++;
+    m_checking_reduction = true;
+  }
+  else if (max_speed > FAST_SPEED && m_steps_down > 0 && now >= m_retry_higher_scale)
+  {
+    m_steps_down--;
+  }
+
+  return GetScale(max_scale) != old_scale;
+}
+
+u32 DynamicResolution::GetScale(u32 max_scale) const
+{
+  return max_scale > m_steps_down ? max_scale - m_steps_down : 1;
+}
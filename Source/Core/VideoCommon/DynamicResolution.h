@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+
+// Lowers the internal resolution below the configured one while the emulation can't keep up, and
+// raises it back when there is headroom again. The emulation speed that could be reached without
+// throttling stands in for the GPU frame time: it also drops when the CPU thread has to wait for
+// the GPU. Because it drops just the same when the emulated CPU is too slow, every reduction is
+// checked, and undone if rendering fewer pixels didn't make the emulation faster.
+//
+// The scale only changes in whole steps, and a change recreates the EFB like a change of the
+// setting does, so EFB copies and the XFB output always use the same scale as the EFB.
+class DynamicResolution
+{
+public:
+  void Reset();
+
+  // Called once per frame, with the speed the emulation could currently run at and the scale that
+  // is configured. Returns true if the scale to render at changed.
+  bool Update(TimePoint now, double max_speed, u32 max_scale);
+
+  // The scale to render at when max_scale is configured.
+  u32 GetScale(u32 max_scale) const;
+
+private:
+  // The maximum speed is averaged over the last 2.56 seconds, so a change takes this long to show.
+  static constexpr DT EVALUATION_INTERVAL = std::chrono::seconds(3);
+  // How long a scale that turned out too slow, or a reduction that didn't help, isn't retried.
+  static constexpr DT RETRY_INTERVAL = std::chrono::seconds(30);
+
+  static constexpr double SLOW_SPEED = 0.98;
+  static constexpr double FAST_SPEED = 1.4;
+  // A reduction has to make the emulation at least this much faster to be kept.
+  static constexpr double MIN_IMPROVEMENT = 1.05;
+
+  TimePoint m_next_evaluation{};
+  TimePoint m_retry_higher_scale{};
+  TimePoint m_retry_lower_scale{};
+  u32 m_steps_down = 0;
+  bool m_checking_reduction = false;
+  double m_speed_before_reduction = 0;
+};
+
+extern DynamicResolution g_dynamic_resolution;
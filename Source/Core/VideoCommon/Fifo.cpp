@@ -3,7 +3,10 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <chrono>
 #include <cstring>
 
 #include "Common/Assert.h"
@@ -11,6 +14,8 @@
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
+#include "Common/FrameTrace.h"
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 
@@ -28,9 +33,11 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Fifo
 {
@@ -48,6 +55,13 @@ void FifoManager::RefreshConfig()
   m_config_sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   m_config_sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   m_config_sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
+  m_config_bounded_gpu_latency = Config::Get(Config::MAIN_BOUNDED_GPU_LATENCY) &&
+                                 !m_config_sync_gpu && m_system.IsDualCoreMode();
+  m_config_bounded_gpu_latency_max_cycles =
+      std::max(Config::Get(Config::MAIN_BOUNDED_GPU_LATENCY_MAX_CYCLES), GPU_TIME_SLOT_SIZE);
+  m_config_bounded_gpu_latency_max_bytes =
+      std::max(Config::Get(Config::MAIN_BOUNDED_GPU_LATENCY_MAX_BYTES),
+               static_cast<int>(GPFifo::GATHER_PIPE_SIZE));
 }
 
 void FifoManager::DoState(PointerWrap& p)
@@ -98,6 +112,7 @@ void FifoManager::Init()
   if (m_system.IsDualCoreMode())
     m_gpu_mainloop.Prepare();
   m_sync_ticks.store(0);
+  m_gpu_latency_statistics = {};
 }
 
 void FifoManager::Shutdown()
@@ -105,6 +120,8 @@ void FifoManager::Shutdown()
   if (m_gpu_mainloop.IsRunning())
     PanicAlertFmt("FIFO shutting down while active");
 
+  LogGpuLatency();
+
   Common::FreeMemoryPages(m_video_buffer, FIFO_SIZE + 4);
   m_video_buffer = nullptr;
   m_video_buffer_write_ptr = nullptr;
@@ -299,6 +316,8 @@ void FifoManager::RunGpuLoop()
         if (!m_emu_running_state.IsSet())
           return;
 
+        TRACE_SCOPE("FifoManager::RunGpuLoop");
+
         if (m_use_deterministic_gpu_thread)
         {
           // All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
@@ -307,6 +326,7 @@ void FifoManager::RunGpuLoop()
           // See comment in SyncGPU
           if (write_ptr > seen_ptr)
           {
+            ScopedStatisticTimer timer(g_stats.this_frame.fifo_time, g_ActiveConfig.bOverlayStats);
             m_video_buffer_read_ptr =
                 OpcodeDecoder::RunFifo(DataReader(m_video_buffer_read_ptr, write_ptr), nullptr);
             m_video_buffer_seen_ptr = write_ptr;
@@ -345,8 +365,12 @@ void FifoManager::RunGpuLoop()
                        distance);
 
             u8* write_ptr = m_video_buffer_write_ptr;
-            m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-                DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
+            {
+              ScopedStatisticTimer timer(g_stats.this_frame.fifo_time,
+                                         g_ActiveConfig.bOverlayStats);
+              m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
+                  DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
+            }
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
             fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
@@ -368,6 +392,18 @@ void FifoManager::RunGpuLoop()
                 m_sync_wakeup_event.Set();
               }
             }
+            else if (m_config_bounded_gpu_latency)
+            {
+              const int max_cycles = m_config_bounded_gpu_latency_max_cycles;
+              const int max_bytes = m_config_bounded_gpu_latency_max_bytes;
+              const int old = m_sync_ticks.fetch_sub(cyclesExecuted);
+              if ((old >= max_cycles && old - static_cast<int>(cyclesExecuted) < max_cycles) ||
+                  (distance + static_cast<s32>(GPFifo::GATHER_PIPE_SIZE) > max_bytes &&
+                   distance <= max_bytes))
+              {
+                m_sync_wakeup_event.Set();
+              }
+            }
 
             // This call is pretty important in DualCore mode and must be called in the FIFO Loop.
             // If we don't, s_swapRequested or s_efbAccessRequested won't be set to false
@@ -384,6 +420,11 @@ void FifoManager::RunGpuLoop()
               m_sync_wakeup_event.Set();
           }
 
+          // The GPU can't make progress until the CPU gives it more work (or re-enables reading),
+          // so the CPU must not keep waiting for it.
+          if (m_config_bounded_gpu_latency)
+            m_sync_wakeup_event.Set();
+
           // The fifo is empty and it's unlikely we will get any more work in the near future.
           // Make sure VertexManager finishes drawing any primitives it has stored in it's buffer.
           g_vertex_manager->Flush();
@@ -429,7 +470,8 @@ void FifoManager::RunGpu()
   }
 
   // if the sync GPU callback is suspended, wake it up.
-  if (!is_dual_core || m_use_deterministic_gpu_thread || m_config_sync_gpu)
+  if (!is_dual_core || m_use_deterministic_gpu_thread || m_config_sync_gpu ||
+      m_config_bounded_gpu_latency)
   {
     if (m_syncing_suspended)
     {
@@ -465,8 +507,11 @@ int FifoManager::RunGpuOnCpu(int ticks)
       }
       ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
       u32 cycles = 0;
-      m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-          DataReader(m_video_buffer_read_ptr, m_video_buffer_write_ptr), &cycles);
+      {
+        ScopedStatisticTimer timer(g_stats.this_frame.fifo_time, g_ActiveConfig.bOverlayStats);
+        m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
+            DataReader(m_video_buffer_read_ptr, m_video_buffer_write_ptr), &cycles);
+      }
       available_ticks -= cycles;
     }
 
@@ -564,6 +609,83 @@ int FifoManager::WaitForGpuThread(int ticks)
   return GPU_TIME_SLOT_SIZE;
 }
 
+/* Like WaitForGpuThread, but the GPU thread is never held back, and the CPU thread only blocks
+ * while it is further ahead of the GPU than the configured number of cycles or FIFO bytes.
+ * @ticks The gone emulated CPU time.
+ * @return A good time to call WaitForBoundedGpuLatency() next.
+ */
+int FifoManager::WaitForBoundedGpuLatency(int ticks)
+{
+  const int old = m_sync_ticks.fetch_add(ticks);
+
+  // GPU is idle, so stop polling.
+  if (old >= 0 && m_gpu_mainloop.IsDone())
+    return -1;
+
+  const int cycles = old + ticks;
+  const u32 bytes = m_system.GetCommandProcessor().GetFifo().CPReadWriteDistance.load(
+      std::memory_order_relaxed);
+  GpuLatencyStatistics& statistics = m_gpu_latency_statistics;
+  ++statistics.cycles_histogram[std::bit_width(static_cast<u32>(std::max(cycles, 0)))];
+  ++statistics.bytes_histogram[std::bit_width(bytes)];
+  ++statistics.samples;
+
+  if (!IsGpuLatencyBoundExceeded())
+    return GPU_TIME_SLOT_SIZE;
+
+  const TimePoint wait_start = Clock::now();
+  ++statistics.waits;
+  // The timeout only matters if the GPU thread is stopped while we wait.
+  while (m_gpu_mainloop.IsRunning() && IsGpuLatencyBoundExceeded())
+    m_sync_wakeup_event.WaitFor(std::chrono::milliseconds(10));
+  statistics.time_waited += Clock::now() - wait_start;
+
+  return GPU_TIME_SLOT_SIZE;
+}
+
+bool FifoManager::IsGpuLatencyBoundExceeded() const
+{
+  if (m_sync_ticks.load() >= m_config_bounded_gpu_latency_max_cycles)
+    return true;
+
+  // Only wait for the GPU to consume FIFO data if it is able to.
+  auto& command_processor = m_system.GetCommandProcessor();
+  const auto& fifo = command_processor.GetFifo();
+  return fifo.CPReadWriteDistance.load(std::memory_order_relaxed) >
+             static_cast<u32>(m_config_bounded_gpu_latency_max_bytes) &&
+         fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
+         !command_processor.IsInterruptWaiting() && !AtBreakpoint(m_system);
+}
+
+void FifoManager::LogGpuLatency() const
+{
+  const GpuLatencyStatistics& statistics = m_gpu_latency_statistics;
+  if (statistics.samples == 0)
+    return;
+
+  // Returns the upper bound of the histogram bucket which contains the given fraction of samples.
+  const auto percentile = [&statistics](const std::array<u64, 33>& histogram, double fraction) {
+    const auto target = static_cast<u64>(fraction * static_cast<double>(statistics.samples));
+    u64 count = 0;
+    for (size_t i = 0; i < histogram.size(); ++i)
+    {
+      count += histogram[i];
+      if (count > target)
+        return i == 0 ? u64{0} : (u64{1} << i) - 1;
+    }
+    return u64{UINT32_MAX};
+  };
+
+  INFO_LOG_FMT(VIDEO,
+               "CPU lead over the GPU thread: p50 <= {} cycles / {} bytes, p99 <= {} cycles / {} "
+               "bytes over {} samples. The CPU waited {} times for {:.1f} ms in total.",
+               percentile(statistics.cycles_histogram, 0.50),
+               percentile(statistics.bytes_histogram, 0.50),
+               percentile(statistics.cycles_histogram, 0.99),
+               percentile(statistics.bytes_histogram, 0.99), statistics.samples, statistics.waits,
+               DT_ms(statistics.time_waited).count());
+}
+
 void FifoManager::SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate)
 {
   ticks += cyclesLate;
@@ -578,6 +700,10 @@ void FifoManager::SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLat
   {
     next = fifo.WaitForGpuThread(int(ticks));
   }
+  else if (fifo.m_config_bounded_gpu_latency)
+  {
+    next = fifo.WaitForBoundedGpuLatency(int(ticks));
+  }
 
   fifo.m_syncing_suspended = next < 0;
   if (!fifo.m_syncing_suspended)
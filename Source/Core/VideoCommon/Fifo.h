@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <optional>
@@ -81,6 +82,9 @@ private:
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
+  int WaitForBoundedGpuLatency(int ticks);
+  bool IsGpuLatencyBoundExceeded() const;
+  void LogGpuLatency() const;
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
@@ -127,6 +131,22 @@ private:
   int m_config_sync_gpu_max_distance = 0;
   int m_config_sync_gpu_min_distance = 0;
   float m_config_sync_gpu_overclock = 0.0f;
+  // Only set in dual core mode without SyncGPU, which bounds the CPU-GPU distance on its own.
+  bool m_config_bounded_gpu_latency = false;
+  int m_config_bounded_gpu_latency_max_cycles = 0;
+  int m_config_bounded_gpu_latency_max_bytes = 0;
+
+  // How far the CPU was ahead of the GPU when the bounded latency mode checked, on the CPU thread.
+  // Bucket i counts the samples in [2^(i-1), 2^i).
+  struct GpuLatencyStatistics
+  {
+    std::array<u64, 33> cycles_histogram{};
+    std::array<u64, 33> bytes_histogram{};
+    u64 samples = 0;
+    u64 waits = 0;
+    DT time_waited{};
+  };
+  GpuLatencyStatistics m_gpu_latency_statistics;
 
   Core::System& m_system;
 };
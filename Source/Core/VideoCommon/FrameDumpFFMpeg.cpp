@@ -18,6 +18,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -51,6 +52,10 @@ struct FrameDumpContext
   AVFrame* scaled_frame = nullptr;
   SwsContext* sws = nullptr;
 
+  // Only used by encoders that take frames in device memory.
+  AVBufferRef* hw_device = nullptr;
+  AVFrame* hw_frame = nullptr;
+
   s64 last_pts = AV_NOPTS_VALUE;
 
   int width = 0;
@@ -158,6 +163,73 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Returns how to create device frames for encoders that only accept those (such as h264_vaapi),
+// or null if the encoder takes frames in system memory.
+const AVCodecHWConfig* GetHardwareFramesConfig(const AVCodec* codec)
+{
+  if (!codec->pix_fmts || codec->pix_fmts[0] == AV_PIX_FMT_NONE)
+    return nullptr;
+
+  for (const AVPixelFormat* pix_fmt = codec->pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; ++pix_fmt)
+  {
+    if (!(av_pix_fmt_desc_get(*pix_fmt)->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      return nullptr;
+  }
+
+  for (int i = 0;; ++i)
+  {
+    const AVCodecHWConfig* config = avcodec_get_hw_config(codec, i);
+    if (!config)
+      return nullptr;
+    if (config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX)
+      return config;
+  }
+}
+
+bool InitHardwareFrames(FrameDumpContext* context, const AVCodecHWConfig* config,
+                        AVPixelFormat sw_pix_fmt)
+{
+  const char* const device_name = av_hwdevice_get_type_name(config->device_type);
+  if (const int error =
+          av_hwdevice_ctx_create(&context->hw_device, config->device_type, nullptr, nullptr, 0))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}", device_name, AVErrorString(error));
+    return false;
+  }
+
+  AVBufferRef* frames_ref = av_hwframe_ctx_alloc(context->hw_device);
+  if (!frames_ref)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate {} frames context", device_name);
+    return false;
+  }
+
+  auto* const frames = reinterpret_cast<AVHWFramesContext*>(frames_ref->data);
+  frames->format = config->pix_fmt;
+  frames->sw_format = sw_pix_fmt;
+  frames->width = context->width;
+  frames->height = context->height;
+  // Some devices can't grow the pool once encoding has started.
+  frames->initial_pool_size = 20;
+
+  const int error = av_hwframe_ctx_init(frames_ref);
+  if (error == 0)
+    context->codec->hw_frames_ctx = av_buffer_ref(frames_ref);
+  av_buffer_unref(&frames_ref);
+  if (error != 0 || !context->codec->hw_frames_ctx)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not initialize {} frames: {}", device_name,
+                  AVErrorString(error));
+    return false;
+  }
+
+  context->codec->pix_fmt = config->pix_fmt;
+  context->hw_frame = av_frame_alloc();
+  INFO_LOG_FMT(FRAMEDUMP, "Encoding {} frames uploaded from {}", device_name,
+               av_get_pix_fmt_name(sw_pix_fmt));
+  return context->hw_frame != nullptr;
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -275,9 +347,13 @@ bool FFMpegFrameDump::CreateVideoFile()
       WARN_LOG_FMT(FRAMEDUMP, "Invalid pixel format {}", pixel_format_string);
   }
 
+  const AVCodecHWConfig* const hw_config = GetHardwareFramesConfig(codec);
+
   if (pix_fmt == AV_PIX_FMT_NONE)
   {
-    if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
+    if (hw_config)
+      pix_fmt = AV_PIX_FMT_NV12;
+    else if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
       pix_fmt = AV_PIX_FMT_BGR0;
     else if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
       pix_fmt = AV_PIX_FMT_GBRP;
@@ -285,7 +361,16 @@ bool FFMpegFrameDump::CreateVideoFile()
       pix_fmt = AV_PIX_FMT_YUV420P;
   }
 
-  m_context->codec->pix_fmt = pix_fmt;
+  // Frames are still converted on the CPU, then uploaded in pix_fmt to the encoder's device.
+  if (hw_config)
+  {
+    if (!InitHardwareFrames(m_context.get(), hw_config, pix_fmt))
+      return false;
+  }
+  else
+  {
+    m_context->codec->pix_fmt = pix_fmt;
+  }
 
   if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
     av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
@@ -302,7 +387,7 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -387,17 +472,33 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      static_cast<AVPixelFormat>(m_context->scaled_frame->format), SWS_BICUBIC, nullptr, nullptr,
+      nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
   }
 
+  AVFrame* output_frame = m_context->scaled_frame;
+  if (m_context->hw_frame)
+  {
+    av_frame_unref(m_context->hw_frame);
+    int error = av_hwframe_get_buffer(m_context->codec->hw_frames_ctx, m_context->hw_frame, 0);
+    if (error == 0)
+      error = av_hwframe_transfer_data(m_context->hw_frame, m_context->scaled_frame, 0);
+    if (error != 0)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Error uploading frame: {}", AVErrorString(error));
+      return;
+    }
+    output_frame = m_context->hw_frame;
+  }
+
   m_context->last_pts = pts;
-  m_context->scaled_frame->pts = pts;
+  output_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  if (const int error = avcodec_send_frame(m_context->codec, output_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -470,8 +571,10 @@ void FFMpegFrameDump::CloseVideoFile()
 {
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
+  av_frame_free(&m_context->hw_frame);
 
   avcodec_free_context(&m_context->codec);
+  av_buffer_unref(&m_context->hw_device);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
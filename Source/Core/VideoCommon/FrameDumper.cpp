@@ -3,6 +3,8 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <utility>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
@@ -62,13 +64,22 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
+  // If all textures are in use, wait for the oldest frame to be encoded.
+  if (m_frames_pending + m_frames_encoding == NUM_READBACK_FRAMES)
+  {
+    if (m_frames_encoding == 0)
+      QueueOldestReadbackFrame();
+    UnmapEncodedFrames(true);
+  }
+
   if (!CheckFrameDumpReadbackTexture(target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  ReadbackFrame& frame = m_readback_frames[m_readback_head];
+  frame.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, frame.texture->GetRect());
+  frame.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_readback_head = (m_readback_head + 1) % NUM_READBACK_FRAMES;
+  m_frames_pending++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -101,7 +112,7 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
 
 bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = m_readback_frames[m_readback_head].texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -118,45 +129,60 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_frames_pending == 0 && m_frames_encoding == 0)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
-
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  UnmapEncodedFrames(false);
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    ShutdownFrameDumping();
+    return;
   }
-  else
+
+  // Leave the frame that was just copied, so that the GPU can finish it while the next frame is
+  // rendered.
+  while (m_frames_pending > 1)
+    QueueOldestReadbackFrame();
+}
+
+void FrameDumper::QueueOldestReadbackFrame()
+{
+  ReadbackFrame& frame =
+      m_readback_frames[(m_readback_head + NUM_READBACK_FRAMES - m_frames_pending) %
+                        NUM_READBACK_FRAMES];
+  m_frames_pending--;
+
+  auto& texture = frame.texture;
+  texture->Flush();
+  if (!texture->Map())
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
-  }
 
-  m_frame_dump_needs_flush = false;
+    // Drop the frame. Textures are released in order, so the queued frames have to finish first.
+    while (m_frames_encoding != 0)
+      UnmapEncodedFrames(true);
+    return;
+  }
 
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+  m_frames_encoding++;
+  DumpFrameData(reinterpret_cast<u8*>(texture->GetMappedPointer()), texture->GetConfig().width,
+                texture->GetConfig().height, static_cast<int>(texture->GetMappedStride()),
+                frame.state);
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure all frames that were read back have been sent to the encoder.
+  while (m_frames_pending != 0)
+    QueueOldestReadbackFrame();
+  while (m_frames_encoding != 0)
+    UnmapEncodedFrames(true);
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
-  FinishFrameData();
-
   // Wake thread up, and wait for it to exit.
   m_frame_dump_thread_running.Clear();
   m_frame_dump_start.Set();
@@ -165,13 +191,17 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (ReadbackFrame& frame : m_readback_frames)
+    frame.texture.reset();
+  m_readback_head = 0;
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  {
+    std::lock_guard lk(m_frame_dump_lock);
+    m_frame_dump_queue.push_back(FrameData{data, w, h, stride, state});
+  }
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -183,18 +213,32 @@ void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
-void FrameDumper::FinishFrameData()
+void FrameDumper::UnmapEncodedFrames(bool wait)
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  while (m_frames_encoding != 0)
+  {
+    u32 frames_done;
+    {
+      std::lock_guard lk(m_frame_dump_lock);
+      frames_done = std::exchange(m_frame_dump_frames_done, 0);
+    }
+
+    for (; frames_done != 0; frames_done--)
+    {
+      const u32 oldest = m_readback_head + NUM_READBACK_FRAMES - m_frames_pending -
+                         m_frames_encoding;
+      m_readback_frames[oldest % NUM_READBACK_FRAMES].texture->Unmap();
+      m_frames_encoding--;
+      wait = false;
+    }
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+    if (!wait)
+      return;
 
-  m_frame_dump_output_texture->Unmap();
+    m_frame_dump_done.Wait();
+  }
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -216,11 +260,21 @@ void FrameDumper::FrameDumpThreadFunc()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
+    FrameData frame;
+    {
+      std::lock_guard lk(m_frame_dump_lock);
+      if (!m_frame_dump_queue.empty())
+        frame = m_frame_dump_queue.front();
+    }
 
-    auto frame = m_frame_dump_data;
+    // Only exit once every queued frame has been encoded.
+    if (!frame.data)
+    {
+      if (!m_frame_dump_thread_running.IsSet())
+        break;
+      m_frame_dump_start.Wait();
+      continue;
+    }
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -259,6 +313,11 @@ void FrameDumper::FrameDumpThreadFunc()
       }
     }
 
+    {
+      std::lock_guard lk(m_frame_dump_lock);
+      m_frame_dump_queue.pop_front();
+      m_frame_dump_frames_done++;
+    }
     m_frame_dump_done.Set();
   }
 
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -52,14 +57,18 @@ private:
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
+  // Checks that the next frame dump readback texture exists and is the correct size.
   bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
 
+  // Maps the oldest frame that has been read back, and queues it for encoding.
+  void QueueOldestReadbackFrame();
+
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
-  // Ensures all encoded frames have been written to the output file.
-  void FinishFrameData();
+  // Unmaps the textures of frames that the dump thread is done with. If wait is set, blocks until
+  // at least one frame is done, unless no frames are queued.
+  void UnmapEncodedFrames(bool wait);
 
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
@@ -70,23 +79,31 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
+  // Communication of frames between video and dump threads, oldest first.
+  std::mutex m_frame_dump_lock;
+  std::deque<FrameData> m_frame_dump_queue;
+  u32 m_frame_dump_frames_done = 0;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Frames are read back through a ring of staging textures. A texture is only mapped a frame
+  // after its copy was recorded, so the GPU has usually finished it by then, and the encoder can
+  // fall behind by a few frames before the video thread has to wait for it.
+  static constexpr u32 NUM_READBACK_FRAMES = 4;
+  struct ReadbackFrame
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    FrameState state;
+  };
+  std::array<ReadbackFrame, NUM_READBACK_FRAMES> m_readback_frames;
+  // Index of the texture that the next frame is copied to.
+  u32 m_readback_head = 0;
+  // Frames before the head that have been copied, but not yet queued.
+  u32 m_frames_pending = 0;
+  // Frames before the pending ones that are queued for encoding, and still mapped.
+  u32 m_frames_encoding = 0;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -19,6 +19,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
+#include "VideoCommon/DynamicResolution.h"
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
@@ -217,6 +218,9 @@ std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
   else
     m_efb_scale = g_ActiveConfig.iEFBScale;
 
+  if (g_ActiveConfig.bDynamicResolution)
+    m_efb_scale = g_dynamic_resolution.GetScale(static_cast<u32>(m_efb_scale));
+
   const u32 max_size = g_ActiveConfig.backend_info.MaxTextureSize;
   if (max_size < EFB_WIDTH * m_efb_scale)
     m_efb_scale = max_size / EFB_WIDTH;
@@ -446,6 +450,11 @@ bool FramebufferManager::IsUsingTiledEFBCache() const
   return m_efb_cache_tile_size > 0;
 }
 
+bool FramebufferManager::IsPeekCacheRefreshedPerFrame() const
+{
+  return g_ActiveConfig.iEFBAccessStaleFrames > 0;
+}
+
 bool FramebufferManager::IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const
 {
   const EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
@@ -567,6 +576,17 @@ void FramebufferManager::RefreshPeekCache()
 }
 
 void FramebufferManager::InvalidatePeekCache(bool forced)
+{
+  // Draw done and tokens don't invalidate the cache when peeks may be stale. Games that peek every
+  // frame are then served from the readbacks queued at the end of a frame, rather than waiting for
+  // a new readback after each change to the EFB.
+  if (!forced && IsPeekCacheRefreshedPerFrame())
+    return;
+
+  InvalidateOutOfDatePeekCache(forced);
+}
+
+void FramebufferManager::InvalidateOutOfDatePeekCache(bool forced)
 {
   if (forced || m_efb_color_cache.out_of_date)
   {
@@ -607,7 +627,7 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
   if (m_efb_depth_cache.has_active_tiles)
     m_efb_depth_cache.out_of_date = true;
 
-  if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
+  if (!g_ActiveConfig.bEFBAccessDeferInvalidation && !IsPeekCacheRefreshedPerFrame())
     InvalidatePeekCache();
 }
 
@@ -618,6 +638,21 @@ void FramebufferManager::EndOfFrame()
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
     m_efb_depth_cache.tiles[i].frame_access_mask <<= 1;
   }
+
+  if (!IsPeekCacheRefreshedPerFrame())
+  {
+    m_frames_since_peek_refresh = 0;
+    return;
+  }
+
+  if (++m_frames_since_peek_refresh < static_cast<u32>(g_ActiveConfig.iEFBAccessStaleFrames))
+    return;
+
+  // Queue readbacks of the tiles that were peeked in the last few frames. They will usually be
+  // complete by the time the next frame peeks them, so the CPU doesn't wait for the GPU.
+  m_frames_since_peek_refresh = 0;
+  InvalidateOutOfDatePeekCache(false);
+  RefreshPeekCache();
 }
 
 bool FramebufferManager::CompileReadbackPipelines()
@@ -121,6 +121,7 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
   void FlagPeekCacheAsOutOfDate();
+  // Refreshes the peek cache if it has been stale for too long, when stale peeks are allowed.
   void EndOfFrame();
 
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
@@ -179,9 +180,11 @@ protected:
   void DestroyPokePipelines();
 
   bool IsUsingTiledEFBCache() const;
+  bool IsPeekCacheRefreshedPerFrame() const;
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void InvalidateOutOfDatePeekCache(bool forced);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -226,6 +229,8 @@ protected:
   u32 m_efb_cache_tile_row_stride = 1;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  // Frames since the peek cache was last refreshed at the end of a frame.
+  u32 m_frames_since_peek_refresh = 0;
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
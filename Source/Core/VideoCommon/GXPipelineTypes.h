@@ -21,6 +21,11 @@ namespace VideoCommon
 // caches to be invalidated.
 constexpr u32 GX_PIPELINE_UID_VERSION = 8;  // Last changed in PR 12185
 
+// The UID cache file starts with this magic and GX_PIPELINE_UID_VERSION, followed by
+// SerializedGXPipelineUid entries.
+constexpr u32 GX_PIPELINE_UID_CACHE_MAGIC = 0x44495550;  // PUID
+constexpr size_t GX_PIPELINE_UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
 struct GXPipelineUid
 {
   const NativeVertexFormat* vertex_format;
@@ -238,6 +238,9 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
     // the depth value. This results in objects at a distance smaller than the convergence
     // distance to seemingly appear in front of the screen.
     // This formula is based on page 13 of the "Nvidia 3D Vision Automatic, Best Practices Guide"
+    // The offset could be applied in the vertex shader with VK_KHR_multiview or
+    // GL_OVR_multiview2 instead, but then every render pass, framebuffer and pipeline that touches
+    // the EFB (including clears, pokes and format conversions) would have to be multiview too.
     out.Write("\tfloat hoffset = (eye == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y;\n");
     out.Write("\tf.pos.x += hoffset * (f.pos.w - " I_STEREOPARAMS ".z);\n");
   }
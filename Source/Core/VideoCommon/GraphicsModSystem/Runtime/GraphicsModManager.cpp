@@ -3,8 +3,11 @@
 
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 
+#include <array>
+#include <map>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 
 #include "Common/Logging/Log.h"
@@ -18,6 +21,7 @@
 #include "VideoCommon/GraphicsModSystem/Config/GraphicsModAsset.h"
 #include "VideoCommon/GraphicsModSystem/Config/GraphicsModGroup.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionFactory.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureInfo.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -26,58 +30,103 @@ std::unique_ptr<GraphicsModManager> g_graphics_mod_manager;
 class GraphicsModManager::DecoratedAction final : public GraphicsModAction
 {
 public:
-  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod)
-      : m_action_impl(std::move(action)), m_mod(std::move(mod))
+  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod,
+                  std::string action_name)
+      : m_action_impl(std::move(action)), m_mod(std::move(mod)),
+        m_action_name(std::move(action_name))
   {
   }
   void OnDrawStarted(GraphicsModActionData::DrawStarted* draw_started) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnDrawStarted(draw_started);
   }
   void OnEFB(GraphicsModActionData::EFB* efb) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnEFB(efb);
   }
+  void OnXFB() override
+  {
+    if (!m_mod.m_enabled)
+      return;
+    const auto timer = CountCall();
+    m_action_impl->OnXFB();
+  }
   void OnProjection(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnProjection(projection);
   }
   void OnProjectionAndTexture(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnProjectionAndTexture(projection);
   }
   void OnTextureLoad(GraphicsModActionData::TextureLoad* texture_load) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnTextureLoad(texture_load);
   }
   void OnTextureCreate(GraphicsModActionData::TextureCreate* texture_create) override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnTextureCreate(texture_create);
   }
   void OnFrameEnd() override
   {
     if (!m_mod.m_enabled)
       return;
+    const auto timer = CountCall();
     m_action_impl->OnFrameEnd();
   }
 
+  void EndFrame()
+  {
+    m_last_frame_calls = std::exchange(m_frame_calls, 0);
+    m_last_frame_time = std::exchange(m_frame_time, DT::zero());
+  }
+
+  ActionTimes GetLastFrameTimes() const
+  {
+    return {m_mod.m_title, m_action_name, m_last_frame_calls, m_last_frame_time};
+  }
+
 private:
+  ScopedStatisticTimer CountCall()
+  {
+    ++m_frame_calls;
+    return ScopedStatisticTimer(m_frame_time, g_ActiveConfig.bOverlayStats);
+  }
+
   std::unique_ptr<GraphicsModAction> m_action_impl;
   GraphicsModConfig m_mod;
+  std::string m_action_name;
+
+  u32 m_frame_calls = 0;
+  DT m_frame_time{};
+  u32 m_last_frame_calls = 0;
+  DT m_last_frame_time{};
 };
 
+GraphicsModManager::GraphicsModManager() : m_texture_targets(1)
+{
+}
+
+GraphicsModManager::~GraphicsModManager() = default;
+
 bool GraphicsModManager::Initialize()
 {
   if (g_ActiveConfig.bGraphicMods)
@@ -102,86 +151,92 @@ bool GraphicsModManager::Initialize()
   return true;
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
+u32 GraphicsModManager::GetTextureTargetId(const std::string& texture_name) const
 {
-  if (const auto it = m_projection_target_to_actions.find(projection_type);
-      it != m_projection_target_to_actions.end())
-  {
+  if (const auto it = m_texture_target_ids.find(texture_name); it != m_texture_target_ids.end())
     return it->second;
-  }
 
-  return m_default;
+  return NO_TARGET;
 }
 
-const std::vector<GraphicsModAction*>&
+GraphicsModManager::Actions GraphicsModManager::GetActions(ActionRange range) const
+{
+  return Actions(m_target_actions).subspan(range.begin, range.count);
+}
+
+GraphicsModManager::Actions
+GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
+{
+  return GetActions(m_projection_actions[static_cast<size_t>(projection_type)]);
+}
+
+GraphicsModManager::Actions
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
-                                                const std::string& texture_name) const
+                                                u32 texture_target) const
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  if (texture_target >= m_texture_targets.size())
+    return {};
 
-  return m_default;
+  return GetActions(
+      m_texture_targets[texture_target].projection[static_cast<size_t>(projection_type)]);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
+GraphicsModManager::Actions GraphicsModManager::GetDrawStartedActions(u32 texture_target) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
-      it != m_draw_started_target_to_actions.end())
-  {
-    return it->second;
-  }
+  if (texture_target >= m_texture_targets.size())
+    return {};
 
-  return m_default;
+  return GetActions(m_texture_targets[texture_target].draw_started);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
+GraphicsModManager::Actions GraphicsModManager::GetTextureLoadActions(u32 texture_target) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
-      it != m_load_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  if (texture_target >= m_texture_targets.size())
+    return {};
 
-  return m_default;
+  return GetActions(m_texture_targets[texture_target].texture_load);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
+GraphicsModManager::Actions GraphicsModManager::GetTextureCreateActions(u32 texture_target) const
 {
-  if (const auto it = m_create_texture_target_to_actions.find(texture_name);
-      it != m_create_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  if (texture_target >= m_texture_targets.size())
+    return {};
 
-  return m_default;
+  return GetActions(m_texture_targets[texture_target].texture_create);
 }
 
-const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
+GraphicsModManager::Actions GraphicsModManager::GetEFBActions(const FBInfo& efb) const
 {
+  if (m_efb_target_to_actions.empty())
+    return {};
+
   if (const auto it = m_efb_target_to_actions.find(efb); it != m_efb_target_to_actions.end())
-  {
-    return it->second;
-  }
+    return GetActions(it->second);
+
+  return {};
+}
+
+GraphicsModManager::Actions GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
+{
+  if (m_xfb_target_to_actions.empty())
+    return {};
+
+  if (const auto it = m_xfb_target_to_actions.find(xfb); it != m_xfb_target_to_actions.end())
+    return GetActions(it->second);
 
-  return m_default;
+  return {};
 }
 
-const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
+std::vector<GraphicsModManager::ActionTimes> GraphicsModManager::GetLastFrameActionTimes() const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
+  std::vector<ActionTimes> result;
+  for (const auto& action : m_actions)
   {
-    return it->second;
+    const ActionTimes times = action->GetLastFrameTimes();
+    if (times.calls != 0)
+      result.push_back(times);
   }
-
-  return m_default;
+  return result;
 }
 
 void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
@@ -192,6 +247,19 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
 
   auto filesystem_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
+  // The actions are gathered by target first, and then laid out in m_target_actions.
+  struct TextureTargetActions
+  {
+    std::vector<GraphicsModAction*> draw_started;
+    std::vector<GraphicsModAction*> texture_load;
+    std::vector<GraphicsModAction*> texture_create;
+    std::array<std::vector<GraphicsModAction*>, NUM_PROJECTION_TYPES> projection;
+  };
+  std::map<std::string, TextureTargetActions> texture_target_actions;
+  std::array<std::vector<GraphicsModAction*>, NUM_PROJECTION_TYPES> projection_actions;
+  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> efb_actions;
+  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> xfb_actions;
+
   std::map<std::string, std::vector<GraphicsTargetConfig>> group_to_targets;
   for (const auto& mod : mods)
   {
@@ -245,14 +313,15 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
       const auto create_action =
           [filesystem_library](const std::string_view& action_name,
                                const picojson::value& json_data,
-                               GraphicsModConfig mod_config) -> std::unique_ptr<GraphicsModAction> {
+                               GraphicsModConfig mod_config) -> std::unique_ptr<DecoratedAction> {
         auto action =
             GraphicsModActionFactory::Create(action_name, json_data, std::move(filesystem_library));
         if (action == nullptr)
         {
           return nullptr;
         }
-        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config));
+        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config),
+                                                 std::string(action_name));
       };
 
       const auto internal_group = fmt::format("{}.{}", mod.m_title, feature.m_group);
@@ -261,43 +330,45 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
+                  texture_target_actions[the_target.m_texture_info_string].draw_started.push_back(
                       m_actions.back().get());
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
+                  texture_target_actions[the_target.m_texture_info_string].texture_load.push_back(
                       m_actions.back().get());
                 },
                 [&](const CreateTextureTarget& the_target) {
-                  m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  texture_target_actions[the_target.m_texture_info_string]
+                      .texture_create.push_back(m_actions.back().get());
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
                   info.m_height = the_target.m_height;
                   info.m_width = the_target.m_width;
                   info.m_texture_format = the_target.m_texture_format;
-                  m_efb_target_to_actions[info].push_back(m_actions.back().get());
+                  efb_actions[info].push_back(m_actions.back().get());
                 },
                 [&](const XFBTarget& the_target) {
                   FBInfo info;
                   info.m_height = the_target.m_height;
                   info.m_width = the_target.m_width;
                   info.m_texture_format = the_target.m_texture_format;
-                  m_xfb_target_to_actions[info].push_back(m_actions.back().get());
+                  xfb_actions[info].push_back(m_actions.back().get());
                 },
                 [&](const ProjectionTarget& the_target) {
+                  const auto projection_type = static_cast<size_t>(the_target.m_projection_type);
+                  if (projection_type >= NUM_PROJECTION_TYPES)
+                    return;
+
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    texture_target_actions[*the_target.m_texture_info_string]
+                        .projection[projection_type]
+                        .push_back(m_actions.back().get());
                   }
                   else
                   {
-                    m_projection_target_to_actions[the_target.m_projection_type].push_back(
-                        m_actions.back().get());
+                    projection_actions[projection_type].push_back(m_actions.back().get());
                   }
                 },
             },
@@ -346,6 +417,40 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
       }
     }
   }
+
+  const auto add_actions = [this](const std::vector<GraphicsModAction*>& actions) {
+    const ActionRange range{static_cast<u32>(m_target_actions.size()),
+                            static_cast<u32>(actions.size())};
+    m_target_actions.insert(m_target_actions.end(), actions.begin(), actions.end());
+    return range;
+  };
+
+  for (size_t i = 0; i < NUM_PROJECTION_TYPES; ++i)
+  {
+    m_projection_actions[i] = add_actions(projection_actions[i]);
+    m_has_projection_actions |= !projection_actions[i].empty();
+  }
+
+  for (const auto& [texture_name, actions] : texture_target_actions)
+  {
+    TextureTarget& target = m_texture_targets.emplace_back();
+    target.draw_started = add_actions(actions.draw_started);
+    target.texture_load = add_actions(actions.texture_load);
+    target.texture_create = add_actions(actions.texture_create);
+    for (size_t i = 0; i < NUM_PROJECTION_TYPES; ++i)
+    {
+      target.projection[i] = add_actions(actions.projection[i]);
+      m_has_projection_actions |= !actions.projection[i].empty();
+    }
+    m_has_draw_started_actions |= !actions.draw_started.empty();
+
+    m_texture_target_ids.emplace(texture_name, static_cast<u32>(m_texture_targets.size() - 1));
+  }
+
+  for (const auto& [info, actions] : efb_actions)
+    m_efb_target_to_actions.emplace(info, add_actions(actions));
+  for (const auto& [info, actions] : xfb_actions)
+    m_xfb_target_to_actions.emplace(info, add_actions(actions));
 }
 
 void GraphicsModManager::EndOfFrame()
@@ -353,6 +458,7 @@ void GraphicsModManager::EndOfFrame()
   for (auto&& action : m_actions)
   {
     action->OnFrameEnd();
+    action->EndFrame();
   }
 }
 
@@ -360,11 +466,15 @@ void GraphicsModManager::Reset()
 {
   m_actions.clear();
   m_groups.clear();
-  m_projection_target_to_actions.clear();
-  m_projection_texture_target_to_actions.clear();
-  m_draw_started_target_to_actions.clear();
-  m_load_texture_target_to_actions.clear();
-  m_create_texture_target_to_actions.clear();
+  m_target_actions.clear();
+  m_texture_targets.resize(1);
+  m_texture_target_ids.clear();
+  m_projection_actions = {};
   m_efb_target_to_actions.clear();
   m_xfb_target_to_actions.clear();
+  m_has_projection_actions = false;
+  m_has_draw_started_actions = false;
+
+  // Texture target IDs that were handed out before are now stale.
+  m_generation++;
 }
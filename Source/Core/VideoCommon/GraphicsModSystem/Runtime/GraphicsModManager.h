@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -20,41 +24,84 @@ class GraphicsModGroupConfig;
 class GraphicsModManager
 {
 public:
+  using Actions = std::span<GraphicsModAction* const>;
+
+  // Textures are identified by an integer ID, so that draws can find their actions without
+  // looking the texture name up every time. Textures that no action targets get NO_TARGET.
+  static constexpr u32 NO_TARGET = 0;
+
+  GraphicsModManager();
+  ~GraphicsModManager();
+
   bool Initialize();
 
-  const std::vector<GraphicsModAction*>& GetProjectionActions(ProjectionType projection_type) const;
-  const std::vector<GraphicsModAction*>&
-  GetProjectionTextureActions(ProjectionType projection_type,
-                              const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetDrawStartedActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureLoadActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureCreateActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>& GetEFBActions(const FBInfo& efb) const;
-  const std::vector<GraphicsModAction*>& GetXFBActions(const FBInfo& xfb) const;
+  // Only valid until the mods are loaded again, which changes the generation.
+  u32 GetTextureTargetId(const std::string& texture_name) const;
+  u32 GetGeneration() const { return m_generation; }
+
+  // Whether any action of the category exists, so that callers can skip gathering the targets.
+  bool HasProjectionActions() const { return m_has_projection_actions; }
+  bool HasDrawStartedActions() const { return m_has_draw_started_actions; }
+
+  Actions GetProjectionActions(ProjectionType projection_type) const;
+  Actions GetProjectionTextureActions(ProjectionType projection_type, u32 texture_target) const;
+  Actions GetDrawStartedActions(u32 texture_target) const;
+  Actions GetTextureLoadActions(u32 texture_target) const;
+  Actions GetTextureCreateActions(u32 texture_target) const;
+  Actions GetEFBActions(const FBInfo& efb) const;
+  Actions GetXFBActions(const FBInfo& xfb) const;
 
   void Load(const GraphicsModGroupConfig& config);
 
+  struct ActionTimes
+  {
+    std::string_view mod_title;
+    std::string_view action_name;
+    u32 calls;
+    DT time;
+  };
+  // How often each action that was called ran during the last frame, and for how long. Only
+  // measured while the statistics are shown.
+  std::vector<ActionTimes> GetLastFrameActionTimes() const;
+
 private:
   void EndOfFrame();
   void Reset();
 
   class DecoratedAction;
 
-  static inline const std::vector<GraphicsModAction*> m_default = {};
-  std::list<std::unique_ptr<GraphicsModAction>> m_actions;
-  std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
-      m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_create_texture_target_to_actions;
-  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
-  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
+  // A part of m_target_actions.
+  struct ActionRange
+  {
+    u32 begin = 0;
+    u32 count = 0;
+  };
+
+  static constexpr size_t NUM_PROJECTION_TYPES = 2;
+
+  struct TextureTarget
+  {
+    ActionRange draw_started;
+    ActionRange texture_load;
+    ActionRange texture_create;
+    std::array<ActionRange, NUM_PROJECTION_TYPES> projection;
+  };
+
+  Actions GetActions(ActionRange range) const;
+
+  std::list<std::unique_ptr<DecoratedAction>> m_actions;
+
+  // The actions of all targets, with those of each target and category next to each other.
+  std::vector<GraphicsModAction*> m_target_actions;
+  // Indexed by target ID. The first entry is NO_TARGET, which has no actions.
+  std::vector<TextureTarget> m_texture_targets;
+  std::unordered_map<std::string, u32> m_texture_target_ids;
+  std::array<ActionRange, NUM_PROJECTION_TYPES> m_projection_actions;
+  std::unordered_map<FBInfo, ActionRange, FBInfoHasher> m_efb_target_to_actions;
+  std::unordered_map<FBInfo, ActionRange, FBInfoHasher> m_xfb_target_to_actions;
+  bool m_has_projection_actions = false;
+  bool m_has_draw_started_actions = false;
+  u32 m_generation = 1;
 
   std::unordered_set<std::string> m_groups;
 
@@ -0,0 +1,321 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/HiresTextureIndex.h"
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <unordered_set>
+#include <xxhash.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace VideoCommon
+{
+constexpr std::string_view TEXTURE_PREFIX = "tex1_";
+
+constexpr u32 INDEX_MAGIC = 0x49544844;  // 'DHTI'
+constexpr u32 INDEX_VERSION = 1;
+constexpr u32 EMPTY_SLOT = UINT32_MAX;
+constexpr u32 SLOT_FLAG_ARBITRARY_MIPMAPS = 1;
+
+struct HiresTextureIndex::Header
+{
+  u32 magic;
+  u32 version;
+  u32 num_directories;
+  u32 num_slots;
+  u32 num_textures;
+  u32 strings_size;
+};
+
+struct HiresTextureIndex::Directory
+{
+  u64 modification_time;
+  u32 path_offset;
+  u32 padding;
+};
+
+struct HiresTextureIndex::Slot
+{
+  u64 name_hash;
+  u32 path_offset;
+  u32 flags;
+};
+
+static u64 HashTextureName(std::string_view name)
+{
+  return XXH64(name.data(), name.size(), 0);
+}
+
+static std::optional<u64> GetModificationTime(const std::string& path)
+{
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(StringToPath(path), error);
+  if (error)
+    return std::nullopt;
+  return static_cast<u64>(time.time_since_epoch().count());
+}
+
+std::string HiresTextureIndex::GetTextureName(std::string_view path, bool* has_arbitrary_mipmaps)
+{
+  std::string filename;
+  std::string extension;
+  SplitPath(path, nullptr, &filename, &extension);
+  Common::ToLower(&extension);
+  if ((extension != ".png" && extension != ".dds") || !filename.starts_with(TEXTURE_PREFIX))
+    return {};
+
+  const size_t arb_index = filename.rfind("_arb");
+  *has_arbitrary_mipmaps = arb_index != std::string::npos;
+  if (*has_arbitrary_mipmaps)
+    filename.erase(arb_index, 4);
+  return filename;
+}
+
+HiresTextureIndex HiresTextureIndex::Build(const std::string& directory)
+{
+  struct Texture
+  {
+    std::string name;
+    u32 path_offset;
+    bool has_arbitrary_mipmaps;
+  };
+  std::vector<Texture> textures;
+  std::vector<Directory> directories;
+  std::string strings;
+  std::unordered_set<std::string> names;
+  bool failed_insert = false;
+
+  const auto add_string = [&strings](std::string_view str) {
+    const u32 offset = static_cast<u32>(strings.size());
+    strings.append(str);
+    strings.push_back('\0');
+    return offset;
+  };
+  // Paths are stored relative to the pack, the directory itself has the empty path.
+  const auto add_directory = [&](const std::string& path) {
+    directories.push_back({GetModificationTime(path).value_or(0),
+                           add_string(std::string_view(path).substr(directory.size())), 0});
+  };
+
+  add_directory(directory);
+
+  // An empty extension list also returns directories, so one search finds everything.
+  for (const std::string& path : Common::DoFileSearch({directory}, {}, /*recursive*/ true))
+  {
+    if (!path.starts_with(directory))
+      continue;
+
+    bool has_arbitrary_mipmaps;
+    std::string name = GetTextureName(path, &has_arbitrary_mipmaps);
+    if (!name.empty())
+    {
+      if (!names.insert(name).second)
+      {
+        failed_insert = true;
+        continue;
+      }
+      const u32 path_offset = add_string(std::string_view(path).substr(directory.size()));
+      textures.push_back({std::move(name), path_offset, has_arbitrary_mipmaps});
+    }
+    else if (File::IsDirectory(path))
+    {
+      add_directory(path);
+    }
+  }
+
+  if (failed_insert)
+    ERROR_LOG_FMT(VIDEO, "One or more textures at path '{}' were already inserted", directory);
+
+  // Keep the table at most half full, so probe sequences stay short.
+  const u32 num_slots = std::bit_ceil(std::max<u32>(static_cast<u32>(textures.size()) * 2, 1));
+  std::vector<Slot> slots(num_slots, Slot{0, EMPTY_SLOT, 0});
+  for (const Texture& texture : textures)
+  {
+    const u64 hash = HashTextureName(texture.name);
+    u32 slot = static_cast<u32>(hash) & (num_slots - 1);
+    while (slots[slot].path_offset != EMPTY_SLOT)
+      slot = (slot + 1) & (num_slots - 1);
+    slots[slot] = {hash, texture.path_offset,
+                   texture.has_arbitrary_mipmaps ? SLOT_FLAG_ARBITRARY_MIPMAPS : 0};
+  }
+
+  const Header header{INDEX_MAGIC,
+                      INDEX_VERSION,
+                      static_cast<u32>(directories.size()),
+                      num_slots,
+                      static_cast<u32>(textures.size()),
+                      static_cast<u32>(strings.size())};
+
+  HiresTextureIndex index;
+  index.m_directory = directory;
+  index.m_data.resize(sizeof(Header) + directories.size() * sizeof(Directory) +
+                      slots.size() * sizeof(Slot) + strings.size());
+  u8* ptr = index.m_data.data();
+  std::memcpy(ptr, &header, sizeof(Header));
+  ptr += sizeof(Header);
+  std::memcpy(ptr, directories.data(), directories.size() * sizeof(Directory));
+  ptr += directories.size() * sizeof(Directory);
+  std::memcpy(ptr, slots.data(), slots.size() * sizeof(Slot));
+  ptr += slots.size() * sizeof(Slot);
+  std::memcpy(ptr, strings.data(), strings.size());
+  return index;
+}
+
+std::optional<HiresTextureIndex> HiresTextureIndex::Load(const std::string& index_path,
+                                                         const std::string& directory)
+{
+  File::IOFile file(index_path, "rb");
+  if (!file.IsOpen())
+    return std::nullopt;
+
+  HiresTextureIndex index;
+  index.m_directory = directory;
+  index.m_data.resize(file.GetSize());
+  if (!file.ReadBytes(index.m_data.data(), index.m_data.size()) || !index.IsValid())
+  {
+    WARN_LOG_FMT(VIDEO, "Texture pack index '{}' is invalid, rebuilding it", index_path);
+    return std::nullopt;
+  }
+
+  const Directory* directories = index.GetDirectories();
+  for (u32 i = 0; i < index.GetHeader().num_directories; ++i)
+  {
+    const std::string path = directory + index.GetString(directories[i].path_offset);
+    if (GetModificationTime(path) != directories[i].modification_time)
+    {
+      INFO_LOG_FMT(VIDEO, "Texture pack directory '{}' changed, rebuilding its index", path);
+      return std::nullopt;
+    }
+  }
+
+  return index;
+}
+
+bool HiresTextureIndex::Save(const std::string& index_path) const
+{
+  // A directory whose modification time is unknown can't be checked, so the index would never
+  // notice changes to it.
+  const Directory* directories = GetDirectories();
+  for (u32 i = 0; i < GetHeader().num_directories; ++i)
+  {
+    if (directories[i].modification_time == 0)
+      return false;
+  }
+
+  File::CreateFullPath(index_path);
+  File::IOFile file(index_path, "wb");
+  return file.IsOpen() && file.WriteBytes(m_data.data(), m_data.size());
+}
+
+bool HiresTextureIndex::Find(std::string_view name, std::string* path,
+                             bool* has_arbitrary_mipmaps) const
+{
+  const Header& header = GetHeader();
+  if (header.num_textures == 0)
+    return false;
+
+  const Slot* slots = GetSlots();
+  const u64 hash = HashTextureName(name);
+  for (u32 slot = static_cast<u32>(hash) & (header.num_slots - 1);
+       slots[slot].path_offset != EMPTY_SLOT; slot = (slot + 1) & (header.num_slots - 1))
+  {
+    if (slots[slot].name_hash != hash)
+      continue;
+
+    // Rule out hash collisions by comparing the name in the path.
+    std::string full_path = m_directory + GetString(slots[slot].path_offset);
+    bool arbitrary_mipmaps;
+    if (GetTextureName(full_path, &arbitrary_mipmaps) == name)
+    {
+      *path = std::move(full_path);
+      *has_arbitrary_mipmaps = arbitrary_mipmaps;
+      return true;
+    }
+  }
+  return false;
+}
+
+void HiresTextureIndex::ForEachTexture(
+    const std::function<void(const std::string& name, const std::string& path,
+                             bool has_arbitrary_mipmaps)>& callback) const
+{
+  const Slot* slots = GetSlots();
+  for (u32 slot = 0; slot < GetHeader().num_slots; ++slot)
+  {
+    if (slots[slot].path_offset == EMPTY_SLOT)
+      continue;
+
+    const std::string path = m_directory + GetString(slots[slot].path_offset);
+    bool has_arbitrary_mipmaps;
+    const std::string name = GetTextureName(path, &has_arbitrary_mipmaps);
+    callback(name, path, has_arbitrary_mipmaps);
+  }
+}
+
+u32 HiresTextureIndex::GetTextureCount() const
+{
+  return GetHeader().num_textures;
+}
+
+const HiresTextureIndex::Header& HiresTextureIndex::GetHeader() const
+{
+  return *reinterpret_cast<const Header*>(m_data.data());
+}
+
+const HiresTextureIndex::Directory* HiresTextureIndex::GetDirectories() const
+{
+  return reinterpret_cast<const Directory*>(m_data.data() + sizeof(Header));
+}
+
+const HiresTextureIndex::Slot* HiresTextureIndex::GetSlots() const
+{
+  return reinterpret_cast<const Slot*>(GetDirectories() + GetHeader().num_directories);
+}
+
+const char* HiresTextureIndex::GetString(u32 offset) const
+{
+  const auto* strings = reinterpret_cast<const char*>(GetSlots() + GetHeader().num_slots);
+  return strings + offset;
+}
+
+bool HiresTextureIndex::IsValid() const
+{
+  if (m_data.size() < sizeof(Header))
+    return false;
+
+  const Header& header = GetHeader();
+  if (header.magic != INDEX_MAGIC || header.version != INDEX_VERSION ||
+      !std::has_single_bit(header.num_slots) || header.num_textures >= header.num_slots)
+  {
+    return false;
+  }
+
+  const u64 expected_size = sizeof(Header) + u64{header.num_directories} * sizeof(Directory) +
+                            u64{header.num_slots} * sizeof(Slot) + header.strings_size;
+  if (m_data.size() != expected_size || header.strings_size == 0 || m_data.back() != '\0')
+    return false;
+
+  // Every string must start inside the string table.
+  const Directory* directories = GetDirectories();
+  for (u32 i = 0; i < header.num_directories; ++i)
+  {
+    if (directories[i].path_offset >= header.strings_size)
+      return false;
+  }
+  const Slot* slots = GetSlots();
+  for (u32 i = 0; i < header.num_slots; ++i)
+  {
+    if (slots[i].path_offset != EMPTY_SLOT && slots[i].path_offset >= header.strings_size)
+      return false;
+  }
+  return true;
+}
+}  // namespace VideoCommon
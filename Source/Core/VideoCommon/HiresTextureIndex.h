@@ -0,0 +1,60 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace VideoCommon
+{
+// The custom textures in one texture pack directory, as an open-addressed hash table of texture
+// names. The table, the paths it points to and the modification times of the pack's directories
+// are stored in a single buffer, which is also the on-disk format. This lets later boots skip
+// searching the pack: the index is only rebuilt when one of its directories was modified, which
+// happens whenever a file is added, removed or renamed.
+class HiresTextureIndex
+{
+public:
+  // Searches the directory for textures.
+  static HiresTextureIndex Build(const std::string& directory);
+
+  // Loads an index saved with Save(). Returns nullopt if the file is missing or invalid, or if the
+  // directory was modified since the index was built.
+  static std::optional<HiresTextureIndex> Load(const std::string& index_path,
+                                               const std::string& directory);
+
+  bool Save(const std::string& index_path) const;
+
+  // Looks a texture up by name, without the extension and the _arb suffix.
+  bool Find(std::string_view name, std::string* path, bool* has_arbitrary_mipmaps) const;
+
+  void ForEachTexture(
+      const std::function<void(const std::string& name, const std::string& path,
+                               bool has_arbitrary_mipmaps)>& callback) const;
+
+  u32 GetTextureCount() const;
+
+  // Returns the texture name for a path, or an empty string if it isn't a custom texture.
+  static std::string GetTextureName(std::string_view path, bool* has_arbitrary_mipmaps);
+
+private:
+  struct Header;
+  struct Directory;
+  struct Slot;
+
+  const Header& GetHeader() const;
+  const Directory* GetDirectories() const;
+  const Slot* GetSlots() const;
+  const char* GetString(u32 offset) const;
+  bool IsValid() const;
+
+  std::string m_directory;
+  std::vector<u8> m_data;
+};
+}  // namespace VideoCommon
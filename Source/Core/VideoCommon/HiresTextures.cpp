@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -21,57 +22,139 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/System.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/HiresTextureIndex.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
-constexpr std::string_view s_format_prefix{"tex1_"};
-
 static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_texture_cache;
+
+// Textures that were already looked up in the indices, and registered with the asset library.
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
+// One index per texture directory, in the order they are searched.
+static std::vector<VideoCommon::HiresTextureIndex> s_texture_indices;
+
+namespace
+{
+// Identifies a texture by the hash the texture cache gave its data, and the parameters its custom
+// texture name is made of. Textures with the same key are the same texture to the texture cache
+// too.
+struct LookupKey
+{
+  u64 cache_hash;
+  u32 raw_width;
+  u32 raw_height;
+  TextureFormat texture_format;
+  TLUTFormat tlut_format;
+  bool mipmaps_enabled;
+
+  bool operator==(const LookupKey&) const = default;
+};
+
+struct LookupKeyHash
+{
+  size_t operator()(const LookupKey& key) const
+  {
+    const u64 parameters = (u64{key.raw_width} << 40) ^ (u64{key.raw_height} << 16) ^
+                           (static_cast<u64>(key.texture_format) << 8) ^
+                           (static_cast<u64>(key.tlut_format) << 1) ^ key.mipmaps_enabled;
+    return static_cast<size_t>(key.cache_hash ^ (parameters * 0x9E3779B97F4A7C15ULL));
+  }
+};
+
+struct LookupResult
+{
+  // Empty if there is no custom texture.
+  std::string name;
+  bool has_arbitrary_mipmaps = false;
+};
+}  // namespace
+
+// The results of every lookup since the texture packs were loaded, including those that found
+// nothing. Looking a texture up by name hashes all of its data again and formats a few names, so
+// this keeps the textures of a pack that are always missing from costing that every time the
+// texture cache creates an entry for them.
+static std::unordered_map<LookupKey, LookupResult, LookupKeyHash> s_lookup_results;
+// Games that stream lots of unique textures would otherwise grow the table forever.
+static constexpr size_t MAX_LOOKUP_RESULTS = 1 << 16;
+
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
 namespace
 {
-std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
+std::string GetIndexCachePath(const std::string& texture_directory)
 {
-  if (s_hires_texture_id_to_arbmipmap.empty())
-    return {"", false};
+  return fmt::format("{}HiresTextures/{:016x}.idx", File::GetUserPath(D_CACHE_IDX),
+                     XXH64(texture_directory.data(), texture_directory.size(), 0));
+}
 
-  const auto texture_name_details = texture_info.CalculateTextureName();
-  // look for an exact match first
-  const std::string full_name = texture_name_details.GetFullName();
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(full_name);
+VideoCommon::HiresTextureIndex LoadOrBuildIndex(const std::string& texture_directory)
+{
+  const std::string index_path = GetIndexCachePath(texture_directory);
+  if (auto index = VideoCommon::HiresTextureIndex::Load(index_path, texture_directory))
+    return std::move(*index);
+
+  auto index = VideoCommon::HiresTextureIndex::Build(texture_directory);
+  if (!index.Save(index_path))
+    WARN_LOG_FMT(VIDEO, "Failed to save the index of texture directory '{}'", texture_directory);
+  return index;
+}
+
+// Makes the texture available to the asset library the first time its name is found.
+std::optional<bool> FindTexture(const std::string& name)
+{
+  if (auto iter = s_hires_texture_id_to_arbmipmap.find(name);
       iter != s_hires_texture_id_to_arbmipmap.end())
   {
-    return {full_name, iter->second};
+    return iter->second;
+  }
+
+  std::string path;
+  bool has_arbitrary_mipmaps;
+  for (const auto& index : s_texture_indices)
+  {
+    if (index.Find(name, &path, &has_arbitrary_mipmaps))
+    {
+      // Since this is just a texture (single file) the mapper doesn't really matter
+      // just provide a string
+      s_file_library->SetAssetIDMapData(
+          name, std::map<std::string, std::filesystem::path>{{"texture", StringToPath(path)}});
+      s_hires_texture_id_to_arbmipmap.emplace(name, has_arbitrary_mipmaps);
+      return has_arbitrary_mipmaps;
+    }
   }
 
+  return std::nullopt;
+}
+
+std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
+{
+  const auto texture_name_details = texture_info.CalculateTextureName();
+  // look for an exact match first
+  const std::string full_name = texture_name_details.GetFullName();
+  if (const auto has_arbitrary_mipmaps = FindTexture(full_name))
+    return {full_name, *has_arbitrary_mipmaps};
+
   // Single wildcard ignoring the tlut hash
   const std::string texture_name_single_wildcard_tlut =
       fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tlut);
-      iter != s_hires_texture_id_to_arbmipmap.end())
-  {
-    return {texture_name_single_wildcard_tlut, iter->second};
-  }
+  if (const auto has_arbitrary_mipmaps = FindTexture(texture_name_single_wildcard_tlut))
+    return {texture_name_single_wildcard_tlut, *has_arbitrary_mipmaps};
 
   // Single wildcard ignoring the texture hash
   const std::string texture_name_single_wildcard_tex =
       fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tex);
-      iter != s_hires_texture_id_to_arbmipmap.end())
-  {
-    return {texture_name_single_wildcard_tex, iter->second};
-  }
+  if (const auto has_arbitrary_mipmaps = FindTexture(texture_name_single_wildcard_tex))
+    return {texture_name_single_wildcard_tex, *has_arbitrary_mipmaps};
 
   return {"", false};
 }
@@ -89,77 +172,53 @@ void HiresTexture::Shutdown()
 
 void HiresTexture::Update()
 {
+  Clear();
   if (!g_ActiveConfig.bHiresTextures)
-  {
-    Clear();
     return;
-  }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
-  const std::set<std::string> texture_directories =
+  const std::set<std::string> directory_set =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
-  const std::vector<std::string> extensions{".png", ".dds"};
+  const std::vector<std::string> texture_directories(directory_set.begin(), directory_set.end());
 
-  auto& system = Core::System::GetInstance();
+  // The directories are independent, so they can be scanned at the same time.
+  std::vector<std::optional<VideoCommon::HiresTextureIndex>> indices(texture_directories.size());
+  Common::ParallelFor(texture_directories.size(),
+                      [&](size_t i) { indices[i] = LoadOrBuildIndex(texture_directories[i]); });
 
-  for (const auto& texture_directory : texture_directories)
+  u32 num_textures = 0;
+  for (auto& index : indices)
   {
-    const auto texture_paths =
-        Common::DoFileSearch({texture_directory}, extensions, /*recursive*/ true);
+    if (index->GetTextureCount() == 0)
+      continue;
 
-    bool failed_insert = false;
-    for (auto& path : texture_paths)
-    {
-      std::string filename;
-      SplitPath(path, nullptr, &filename, nullptr);
-
-      if (filename.substr(0, s_format_prefix.length()) == s_format_prefix)
-      {
-        const size_t arb_index = filename.rfind("_arb");
-        const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
-        if (has_arbitrary_mipmaps)
-          filename.erase(arb_index, 4);
-
-        const auto [it, inserted] =
-            s_hires_texture_id_to_arbmipmap.try_emplace(filename, has_arbitrary_mipmaps);
-        if (!inserted)
-        {
-          failed_insert = true;
-        }
-        else
-        {
-          // Since this is just a texture (single file) the mapper doesn't really matter
-          // just provide a string
-          s_file_library->SetAssetIDMapData(filename, std::map<std::string, std::filesystem::path>{
-                                                          {"texture", StringToPath(path)}});
-
-          if (g_ActiveConfig.bCacheHiresTextures)
-          {
-            auto hires_texture = std::make_shared<HiresTexture>(
-                has_arbitrary_mipmaps,
-                system.GetCustomAssetLoader().LoadGameTexture(filename, s_file_library));
-            s_hires_texture_cache.try_emplace(filename, std::move(hires_texture));
-          }
-        }
-      }
-    }
-
-    if (failed_insert)
-    {
-      ERROR_LOG_FMT(VIDEO, "One or more textures at path '{}' were already inserted",
-                    texture_directory);
-    }
+    num_textures += index->GetTextureCount();
+    s_texture_indices.push_back(std::move(*index));
   }
 
   if (g_ActiveConfig.bCacheHiresTextures)
   {
+    auto& system = Core::System::GetInstance();
+    for (const auto& index : s_texture_indices)
+    {
+      index.ForEachTexture([&](const std::string& name, const std::string&, bool) {
+        const std::optional<bool> has_arbitrary_mipmaps = FindTexture(name);
+        if (!has_arbitrary_mipmaps || s_hires_texture_cache.contains(name))
+          return;
+
+        auto hires_texture = std::make_shared<HiresTexture>(
+            *has_arbitrary_mipmaps,
+            system.GetCustomAssetLoader().LoadGameTexture(name, s_file_library));
+        s_hires_texture_cache.try_emplace(name, std::move(hires_texture));
+      });
+    }
+
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
                     10000);
   }
   else
   {
-    OSD::AddMessage(
-        fmt::format("Found '{}' custom textures", s_hires_texture_id_to_arbmipmap.size()), 10000);
+    OSD::AddMessage(fmt::format("Found '{}' custom textures", num_textures), 10000);
   }
 }
 
@@ -167,22 +226,49 @@ void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
+  s_lookup_results.clear();
+  s_texture_indices.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
-std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
+std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info,
+                                                   u64 cache_hash)
 {
-  const auto [base_filename, has_arb_mipmaps] = GetNameArbPair(texture_info);
-  if (base_filename == "")
+  if (s_texture_indices.empty())
     return nullptr;
 
+  const LookupKey key{cache_hash,
+                      texture_info.GetRawWidth(),
+                      texture_info.GetRawHeight(),
+                      texture_info.GetTextureFormat(),
+                      texture_info.GetTlutFormat(),
+                      texture_info.AreMipmapsEnabled()};
+  auto result_iter = s_lookup_results.find(key);
+  if (result_iter == s_lookup_results.end())
+  {
+    if (s_lookup_results.size() >= MAX_LOOKUP_RESULTS)
+      s_lookup_results.clear();
+
+    auto [name, has_arbitrary_mipmaps] = GetNameArbPair(texture_info);
+    result_iter =
+        s_lookup_results.emplace(key, LookupResult{std::move(name), has_arbitrary_mipmaps}).first;
+  }
+
+  const std::string& base_filename = result_iter->second.name;
+  const bool has_arb_mipmaps = result_iter->second.has_arbitrary_mipmaps;
+  if (base_filename.empty())
+    return nullptr;
+
+  auto& system = Core::System::GetInstance();
   if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
   {
+    // Requesting the texture again lets the loader know it is still in use, and loads it again if
+    // it was unloaded to save memory
+    (void)system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library);
     return iter->second;
   }
   else
   {
-    auto& system = Core::System::GetInstance();
     auto hires_texture = std::make_shared<HiresTexture>(
         has_arb_mipmaps,
         system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
@@ -26,7 +26,9 @@ public:
   static void Update();
   static void Clear();
   static void Shutdown();
-  static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
+  // cache_hash is the hash the texture cache gave the texture, including its palette. Results are
+  // remembered by it, so looking a texture up again, even if nothing was found, is cheap.
+  static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info, u64 cache_hash);
 
   HiresTexture(bool has_arbitrary_mipmaps, std::shared_ptr<VideoCommon::GameTextureAsset> asset);
 
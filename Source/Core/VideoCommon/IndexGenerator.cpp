@@ -7,6 +7,12 @@
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +22,108 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Most primitive types produce a periodic index pattern: every lane of the output advances by a
+// fixed step per group of primitives (0 for the center vertex of a fan and for restart indices).
+// This describes NumVectors * 8 output indices, which are written with 128-bit vector stores.
+template <size_t NumVectors>
+struct IndexPattern
+{
+  static constexpr size_t NUM_LANES = NumVectors * 8;
+
+  std::array<u16, NUM_LANES> offsets{};
+  std::array<u16, NUM_LANES> steps{};
+  std::array<u16, NUM_LANES> restart{};
+};
+
+// The lane function returns the offset of a lane from the first vertex, and whether it advances
+// (or is a primitive restart index, if offset is s_primitive_restart).
+template <size_t NumVectors, typename F>
+constexpr IndexPattern<NumVectors> MakePattern(u16 step, F lane)
+{
+  IndexPattern<NumVectors> pattern;
+  for (size_t i = 0; i < pattern.NUM_LANES; ++i)
+  {
+    const auto [offset, advances] = lane(static_cast<u16>(i));
+    if (offset == s_primitive_restart)
+      pattern.restart[i] = s_primitive_restart;
+    else
+      pattern.offsets[i] = offset;
+    pattern.steps[i] = advances ? step : 0;
+  }
+  return pattern;
+}
+
+template <size_t NumVectors>
+u16* WritePattern(u16* index_ptr, u32 iterations, u32 index,
+                  const IndexPattern<NumVectors>& pattern)
+{
+#if defined(_M_X86_64)
+  __m128i current[NumVectors];
+  __m128i steps[NumVectors];
+  const __m128i base = _mm_set1_epi16(static_cast<s16>(index));
+  for (size_t v = 0; v < NumVectors; ++v)
+  {
+    const auto load = [v](const auto& lanes) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.data() + v * 8));
+    };
+    current[v] = _mm_or_si128(_mm_add_epi16(load(pattern.offsets), base), load(pattern.restart));
+    steps[v] = load(pattern.steps);
+  }
+  for (u32 i = 0; i < iterations; ++i)
+  {
+    for (size_t v = 0; v < NumVectors; ++v)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), current[v]);
+      index_ptr += 8;
+      current[v] = _mm_add_epi16(current[v], steps[v]);
+    }
+  }
+#elif defined(_M_ARM_64)
+  uint16x8_t current[NumVectors];
+  uint16x8_t steps[NumVectors];
+  const uint16x8_t base = vdupq_n_u16(static_cast<u16>(index));
+  for (size_t v = 0; v < NumVectors; ++v)
+  {
+    current[v] = vorrq_u16(vaddq_u16(vld1q_u16(pattern.offsets.data() + v * 8), base),
+                           vld1q_u16(pattern.restart.data() + v * 8));
+    steps[v] = vld1q_u16(pattern.steps.data() + v * 8);
+  }
+  for (u32 i = 0; i < iterations; ++i)
+  {
+    for (size_t v = 0; v < NumVectors; ++v)
+    {
+      vst1q_u16(index_ptr, current[v]);
+      index_ptr += 8;
+      current[v] = vaddq_u16(current[v], steps[v]);
+    }
+  }
+#else
+  constexpr size_t num_lanes = IndexPattern<NumVectors>::NUM_LANES;
+  std::array<u16, num_lanes> current;
+  for (size_t i = 0; i < num_lanes; ++i)
+    current[i] = static_cast<u16>(pattern.offsets[i] + index) | pattern.restart[i];
+  for (u32 i = 0; i < iterations; ++i)
+  {
+    for (size_t j = 0; j < num_lanes; ++j)
+    {
+      *index_ptr++ = current[j];
+      current[j] += pattern.steps[j];
+    }
+  }
+#endif
+  return index_ptr;
+}
+
+struct PatternLane
+{
+  u16 offset;
+  bool advances;
+};
+
+// 8 consecutive indices per iteration.
+constexpr auto s_sequential_pattern =
+    MakePattern<1>(8, [](u16 i) { return PatternLane{i, true}; });
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -27,22 +135,47 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
   return index_ptr;
 }
 
+// 8 triangles per iteration.
+template <bool pr>
+constexpr auto s_list_pattern = MakePattern<pr ? 4 : 3>(24, [](u16 i) {
+  constexpr u16 indices_per_triangle = pr ? 4 : 3;
+  const u16 triangle = i / indices_per_triangle;
+  const u16 vertex = i % indices_per_triangle;
+  if (vertex == 3)
+    return PatternLane{s_primitive_restart, false};
+  return PatternLane{static_cast<u16>(triangle * 3 + vertex), true};
+});
+
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 iterations = num_verts / 24;
+  index_ptr = WritePattern(index_ptr, iterations, index, s_list_pattern<pr>);
+
+  for (u32 i = 2 + iterations * 24; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
   return index_ptr;
 }
 
+// 8 triangles per iteration. Odd triangles swap their last two vertices to keep the winding.
+constexpr auto s_strip_pattern = MakePattern<3>(8, [](u16 i) {
+  const u16 triangle = i / 3;
+  const u16 wind = triangle & 1;
+  const u16 vertex = i % 3;
+  const u16 offset = vertex == 0 ? 0 : vertex == 1 ? 1 + wind : 2 - wind;
+  return PatternLane{static_cast<u16>(triangle + offset), true};
+});
+
 template <bool pr>
 u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 iterations = num_verts / 8;
+    index_ptr = WritePattern(index_ptr, iterations, index, s_sequential_pattern);
+    for (u32 i = iterations * 8; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +183,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    const u32 iterations = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WritePattern(index_ptr, iterations, index, s_strip_pattern);
+
+    // The number of triangles written is even, so the winding starts over.
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + iterations * 8; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -80,6 +217,25 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
  * so we use 6 indices for 3 triangles
  */
 
+// 4 groups of 3 triangles per iteration, as described above.
+constexpr auto s_fan_restart_pattern = MakePattern<3>(12, [](u16 i) {
+  const u16 group = i / 6;
+  constexpr std::array<u16, 6> offsets = {1, 2, 0, 3, 4, s_primitive_restart};
+  const u16 offset = offsets[i % 6];
+  if (offset == 0 || offset == s_primitive_restart)
+    return PatternLane{offset, false};
+  return PatternLane{static_cast<u16>(group * 3 + offset), true};
+});
+
+// 8 triangles per iteration, all sharing the first vertex.
+constexpr auto s_fan_pattern = MakePattern<3>(8, [](u16 i) {
+  const u16 triangle = i / 3;
+  const u16 vertex = i % 3;
+  if (vertex == 0)
+    return PatternLane{0, false};
+  return PatternLane{static_cast<u16>(triangle + vertex), true};
+});
+
 template <bool pr>
 u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 {
@@ -87,6 +243,10 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    const u32 iterations = num_verts > 2 ? (num_verts - 2) / 12 : 0;
+    index_ptr = WritePattern(index_ptr, iterations, index, s_fan_restart_pattern);
+    i += iterations * 12;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +266,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    const u32 iterations = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WritePattern(index_ptr, iterations, index, s_fan_pattern);
+    i += iterations * 8;
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -131,10 +297,26 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
  * A simple triangle has to be rendered for three vertices.
  * ZWW do this for sun rays
  */
+// 8 quads per iteration with primitive restart, 4 quads otherwise.
+template <bool pr>
+constexpr auto s_quads_pattern = MakePattern<pr ? 5 : 3>(pr ? 32 : 16, [](u16 i) {
+  constexpr std::array<u16, 5> strip_offsets = {1, 2, 0, 3, s_primitive_restart};
+  constexpr std::array<u16, 6> list_offsets = {0, 1, 2, 0, 2, 3};
+  const u16 quad = i / (pr ? 5 : 6);
+  const u16 offset = pr ? strip_offsets[i % 5] : list_offsets[i % 6];
+  if (offset == s_primitive_restart)
+    return PatternLane{offset, false};
+  return PatternLane{static_cast<u16>(quad * 4 + offset), true};
+});
+
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
+  constexpr u32 quads_per_iteration = pr ? 8 : 4;
+  const u32 iterations = num_verts / (quads_per_iteration * 4);
+  index_ptr = WritePattern(index_ptr, iterations, index, s_quads_pattern<pr>);
+
+  u32 i = 3 + iterations * quads_per_iteration * 4;
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -170,7 +352,10 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  const u32 iterations = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, iterations, index, s_sequential_pattern);
+
+  for (u32 i = 1 + iterations * 8; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -180,9 +365,16 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 
 // Shouldn't be used as strips as LineLists are much more common
 // so converting them to lists
+// 4 lines per iteration.
+constexpr auto s_line_strip_pattern =
+    MakePattern<1>(4, [](u16 i) { return PatternLane{static_cast<u16>((i + 1) / 2), true}; });
+
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 iterations = num_verts > 1 ? (num_verts - 1) / 4 : 0;
+  index_ptr = WritePattern(index_ptr, iterations, index, s_line_strip_pattern);
+
+  for (u32 i = 1 + iterations * 4; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -225,7 +417,10 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  const u32 iterations = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, iterations, index, s_sequential_pattern);
+
+  for (u32 i = iterations * 8; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
@@ -266,7 +461,8 @@ void IndexGenerator::Init()
 {
   using OpcodeDecoder::Primitive;
 
-  if (g_Config.backend_info.bSupportsPrimitiveRestart)
+  m_primitive_restart = g_Config.backend_info.bSupportsPrimitiveRestart;
+  if (m_primitive_restart)
   {
     m_primitive_table[Primitive::GX_DRAW_QUADS] = AddQuads<true>;
     m_primitive_table[Primitive::GX_DRAW_QUADS_2] = AddQuads_nonstandard<true>;
@@ -326,6 +522,21 @@ void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddTriangles(const u16* indices, u32 num_indices, u32 num_vertices)
+{
+  for (u32 i = 0; i + 3 <= num_indices; i += 3)
+  {
+    const u32 index1 = m_base_index + indices[i];
+    const u32 index2 = m_base_index + indices[i + 1];
+    const u32 index3 = m_base_index + indices[i + 2];
+    if (m_primitive_restart)
+      m_index_buffer_current = WriteTriangle<true>(m_index_buffer_current, index1, index2, index3);
+    else
+      m_index_buffer_current = WriteTriangle<false>(m_index_buffer_current, index1, index2, index3);
+  }
+  m_base_index += num_vertices;
+}
+
 u32 IndexGenerator::GetRemainingIndices(OpcodeDecoder::Primitive primitive) const
 {
   u32 max_index = UINT16_MAX;
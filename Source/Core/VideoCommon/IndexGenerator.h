@@ -20,6 +20,14 @@ public:
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
+  // Adds a triangle list whose indices are relative to the vertices being added.
+  void AddTriangles(const u16* indices, u32 num_indices, u32 num_vertices);
+  // Number of indices AddTriangles writes for a triangle list of num_indices.
+  u32 GetTriangleListLength(u32 num_indices) const
+  {
+    return m_primitive_restart ? num_indices / 3 * 4 : num_indices;
+  }
+
   // returns numprimitives
   u32 GetNumVerts() const { return m_base_index; }
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
@@ -29,6 +37,7 @@ private:
   u16* m_index_buffer_current = nullptr;
   u16* m_base_index_ptr = nullptr;
   u32 m_base_index = 0;
+  bool m_primitive_restart = false;
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
@@ -0,0 +1,124 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/LatencyLimiter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+#include "VideoCommon/VideoConfig.h"
+
+LatencyLimiter g_latency_limiter;
+
+void LatencyLimiter::Reset()
+{
+  {
+    std::lock_guard lk(m_fields_lock);
+    m_fields.fill({});
+    m_field_index = 0;
+  }
+
+  m_last_present_ticks = 0;
+  m_last_present_end = {};
+  m_present_interval = {};
+  m_slack_index = 0;
+  m_num_slack = 0;
+
+  m_delay.store(0, std::memory_order_relaxed);
+  m_field_to_display.store(0, std::memory_order_relaxed);
+}
+
+void LatencyLimiter::OnFieldOutput(u64 ticks)
+{
+  std::lock_guard lk(m_fields_lock);
+  m_fields[m_field_index] = {ticks, Clock::now()};
+  m_field_index = (m_field_index + 1) % NUM_FIELDS;
+}
+
+void LatencyLimiter::OnPresent(u64 ticks, TimePoint present_start, TimePoint present_end)
+{
+  // The same field is presented again when the UI is redrawn, e.g. while paused.
+  if (ticks == m_last_present_ticks)
+    return;
+  m_last_present_ticks = ticks;
+
+  std::optional<TimePoint> field_time;
+  {
+    std::lock_guard lk(m_fields_lock);
+    const auto it = std::find_if(m_fields.begin(), m_fields.end(),
+                                 [ticks](const Field& field) { return field.ticks == ticks; });
+    if (it != m_fields.end())
+      field_time = it->time;
+  }
+  if (field_time)
+  {
+    const DT latency = present_end - *field_time;
+    const DT average{m_field_to_display.load(std::memory_order_relaxed)};
+    const DT new_average = average == DT::zero() ? latency : average + (latency - average) / 16;
+    m_field_to_display.store(new_average.count(), std::memory_order_relaxed);
+  }
+
+  if (m_last_present_end != TimePoint{})
+  {
+    const DT interval = present_end - m_last_present_end;
+    m_present_interval = m_present_interval == DT::zero() ?
+                             interval :
+                             m_present_interval + (interval - m_present_interval) / 16;
+  }
+  m_last_present_end = present_end;
+
+  // Without V-Sync, presents don't wait for the display, so there is nothing to take away.
+  if (!g_ActiveConfig.bLatencyReduction || !g_ActiveConfig.bVSyncActive)
+  {
+    m_num_slack = 0;
+    m_delay.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  const DT blocked = present_end - present_start;
+  const DT min_slack = m_num_slack != 0 ?
+                           *std::min_element(m_slack.begin(), m_slack.begin() + m_num_slack) :
+                           DT::zero();
+  // A frame that misses its refresh waits for the next one, and so blocks for a lot longer than
+  // the frames before it.
+  UpdateDelay(blocked, m_num_slack != 0 && blocked > min_slack + m_present_interval / 2);
+}
+
+void LatencyLimiter::UpdateDelay(DT blocked, bool missed_refresh)
+{
+  const DT margin = std::chrono::microseconds(g_ActiveConfig.iLatencyReductionMargin);
+  DT delay{m_delay.load(std::memory_order_relaxed)};
+
+  if (missed_refresh)
+  {
+    delay -= 2 * margin;
+    m_num_slack = 0;
+  }
+  else
+  {
+    m_slack[m_slack_index] = blocked;
+    m_slack_index = (m_slack_index + 1) % SLACK_WINDOW;
+    m_num_slack = std::min(m_num_slack + 1, SLACK_WINDOW);
+    if (m_num_slack < SLACK_WINDOW)
+      return;
+
+    // A changed delay takes a few frames to show up in the presents, so only a part of the slack
+    // is taken every time.
+    const DT slack = *std::min_element(m_slack.begin(), m_slack.end());
+    delay += (slack - margin) / 8;
+  }
+
+  delay = std::clamp(delay, DT::zero(), m_present_interval * 3 / 4);
+  m_delay.store(delay.count(), std::memory_order_relaxed);
+}
+
+DT LatencyLimiter::GetDelay() const
+{
+  return DT{m_delay.load(std::memory_order_relaxed)};
+}
+
+DT LatencyLimiter::GetFieldToDisplayLatency() const
+{
+  return DT{m_field_to_display.load(std::memory_order_relaxed)};
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include "Common/CommonTypes.h"
+
+// With V-Sync, a frame that is finished early waits in the swapchain until the display takes it,
+// and the input the game read for it gets older all that time. The latency limiter moves that
+// wait in front of the emulated frame instead: it measures how long each present blocks, and
+// delays the field deadlines of the CPU thread by that slack, minus a safety margin. The slack
+// is taken away gradually and given back quickly when a frame misses its refresh.
+//
+// It also measures how long it takes from the output of a field to that field being on screen.
+// When the backend can wait for presents to complete (VK_KHR_present_wait), the present includes
+// that wait and the times are those of the display. Otherwise, they are the times the
+// presentation API stopped blocking, which is as close as it gets.
+class LatencyLimiter
+{
+public:
+  LatencyLimiter() = default;
+
+  LatencyLimiter(const LatencyLimiter&) = delete;
+  LatencyLimiter& operator=(const LatencyLimiter&) = delete;
+  LatencyLimiter(LatencyLimiter&&) = delete;
+  LatencyLimiter& operator=(LatencyLimiter&&) = delete;
+
+  void Reset();
+
+  // Called on the CPU thread when the VI outputs a field at the given tick.
+  void OnFieldOutput(u64 ticks);
+  // Called on the presenting thread after the XFB of the field that was output at the given tick
+  // has been presented. The present started at present_start and stopped blocking at
+  // present_end.
+  void OnPresent(u64 ticks, TimePoint present_start, TimePoint present_end);
+
+  // How far the CPU thread should currently push its field deadlines back.
+  DT GetDelay() const;
+  // A running average of the time from the output of a field to its display. Zero until something
+  // has been presented.
+  DT GetFieldToDisplayLatency() const;
+
+private:
+  void UpdateDelay(DT blocked, bool missed_refresh);
+
+  static constexpr size_t NUM_FIELDS = 8;
+  // The slack is taken as the minimum over this many presents, so that a single present that
+  // happened to block for long doesn't cause a miss.
+  static constexpr size_t SLACK_WINDOW = 8;
+
+  struct Field
+  {
+    u64 ticks = 0;
+    TimePoint time{};
+  };
+
+  std::mutex m_fields_lock;
+  std::array<Field, NUM_FIELDS> m_fields{};
+  size_t m_field_index = 0;
+
+  // Only touched by the presenting thread.
+  u64 m_last_present_ticks = 0;
+  TimePoint m_last_present_end{};
+  DT m_present_interval{};
+  std::array<DT, SLACK_WINDOW> m_slack{};
+  size_t m_slack_index = 0;
+  size_t m_num_slack = 0;
+
+  std::atomic<DT::rep> m_delay{0};
+  std::atomic<DT::rep> m_field_to_display{0};
+};
+
+extern LatencyLimiter g_latency_limiter;
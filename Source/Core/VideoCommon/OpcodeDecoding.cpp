@@ -15,6 +15,7 @@
 #include "VideoCommon/OpcodeDecoding.h"
 
 #include "Common/Assert.h"
+#include "Common/FrameTrace.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
@@ -127,6 +128,8 @@ public:
   OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
                                           u32 vertex_size, u16 num_vertices, const u8* vertex_data))
   {
+    TRACE_SCOPE("OpcodeDecoder::Primitive");
+
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
@@ -188,6 +191,7 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          TRACE_SCOPE("OpcodeDecoder::DisplayList");
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
@@ -3,13 +3,52 @@
 
 #include "VideoCommon/PerfQueryBase.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/VideoEvents.h"
 
 std::unique_ptr<PerfQueryBase> g_perf_query;
 
+PerfQueryBase::PerfQueryBase() : m_query_count(0)
+{
+  m_end_of_frame_event =
+      AfterFrameEvent::Register([this](Core::System&) { EndOfFrame(); }, "PerfQueryBase");
+}
+
 bool PerfQueryBase::ShouldEmulate()
 {
   return g_ActiveConfig.bPerfQueriesEnable;
 }
+
+u32 PerfQueryBase::GetMaxStaleFrames()
+{
+  return static_cast<u32>(std::max(g_ActiveConfig.iPerfQueriesStaleFrames, 0));
+}
+
+void PerfQueryBase::CountStall()
+{
+  INCSTAT(g_stats.this_frame.num_perf_query_stalls);
+}
+
+void PerfQueryBase::CollectResults(u64)
+{
+  if (IsFlushed())
+    return;
+
+  CountStall();
+  FlushResults();
+}
+
+void PerfQueryBase::EndOfFrame()
+{
+  ++m_frame_number;
+
+  const u32 max_stale_frames = GetMaxStaleFrames();
+  if (!ShouldEmulate() || max_stale_frames == 0)
+    return;
+
+  CollectResults(m_frame_number > max_stale_frames ? m_frame_number - max_stale_frames : 0);
+}
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
 
 enum PerfQueryType
 {
@@ -31,7 +32,7 @@ enum PerfQueryGroup
 class PerfQueryBase
 {
 public:
-  PerfQueryBase() : m_query_count(0) {}
+  PerfQueryBase();
   virtual ~PerfQueryBase() {}
 
   virtual bool Initialize() { return true; }
@@ -40,6 +41,12 @@ public:
   // NOTE: Called from CPU+GPU thread
   static bool ShouldEmulate();
 
+  // If non-zero, reads return the results of the queries that have finished without waiting for
+  // the GPU. The queries issued before the last this many frames are waited for at the end of each
+  // frame, which bounds how stale the results can be.
+  // NOTE: Called from CPU+GPU thread
+  static u32 GetMaxStaleFrames();
+
   // Begin querying the specified value for the following host GPU commands
   // The call to EnableQuery() should be placed immediately before the draw command, otherwise
   // there is a risk of GPU resets if the query is left open and the buffer is submitted during
@@ -65,8 +72,24 @@ public:
   virtual bool IsFlushed() const { return true; }
 
 protected:
+  // Called at the end of each frame while reads may be stale. Adds up the results of the queries
+  // that have finished, and waits for those that were issued in a frame before oldest_frame.
+  // Backends that don't keep track of which frame a query belongs to wait for all of them.
+  virtual void CollectResults(u64 oldest_frame);
+
+  // Accounts for a wait for query results in the statistics.
+  static void CountStall();
+
+  // Incremented at the end of every frame, on the GPU thread.
+  u64 m_frame_number = 0;
+
   std::atomic<u32> m_query_count;
   std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results;
+
+private:
+  void EndOfFrame();
+
+  Common::EventHook m_end_of_frame_event;
 };
 
 extern std::unique_ptr<PerfQueryBase> g_perf_query;
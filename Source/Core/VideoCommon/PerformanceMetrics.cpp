@@ -3,11 +3,13 @@
 
 #include "VideoCommon/PerformanceMetrics.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <imgui.h>
 #include <implot.h>
 
+#include "Common/Logging/Log.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/System.h"
@@ -19,9 +21,14 @@ void PerformanceMetrics::Reset()
 {
   m_fps_counter.Reset();
   m_vps_counter.Reset();
+  m_flip_counter.Reset();
   m_speed_counter.Reset();
 
   m_time_sleeping = DT::zero();
+  m_field_deadline_index = 0;
+  m_field_lateness.fill(DT::zero());
+  m_field_deadlines = 0;
+  m_missed_field_deadlines = 0;
   m_real_times.fill(Clock::now());
   m_cpu_times.fill(Core::System::GetInstance().GetCoreTiming().GetCPUTimePoint(0));
 }
@@ -29,6 +36,57 @@ void PerformanceMetrics::Reset()
 void PerformanceMetrics::CountFrame()
 {
   m_fps_counter.Count();
+  SamplePerfCounters();
+}
+
+void PerformanceMetrics::SamplePerfCounters()
+{
+  using namespace Common::PerfCounters;
+
+  if (g_ActiveConfig.bShowPerfCounters != m_perf_counters_enabled)
+  {
+    m_perf_counters_enabled = g_ActiveConfig.bShowPerfCounters;
+    if (m_perf_counters_enabled)
+      Enable();
+    else
+      Disable();
+    m_last_perf_counters.clear();
+  }
+
+  if (!m_perf_counters_enabled)
+  {
+    std::lock_guard lock(m_perf_counter_lock);
+    m_frame_perf_counters.clear();
+    return;
+  }
+
+  std::vector<ThreadValues> current = Read();
+  std::vector<ThreadValues> frame;
+  for (const ThreadValues& thread : current)
+  {
+    const auto last = std::ranges::find(m_last_perf_counters, thread.thread_name,
+                                        &ThreadValues::thread_name);
+    if (last == m_last_perf_counters.end())
+      continue;
+
+    ThreadValues& delta = frame.emplace_back();
+    delta.thread_name = thread.thread_name;
+    for (size_t i = 0; i < NUM_COUNTERS; ++i)
+    {
+      if (thread.values[i] && last->values[i])
+        delta.values[i] = *thread.values[i] - *last->values[i];
+    }
+  }
+  m_last_perf_counters = std::move(current);
+
+  std::lock_guard lock(m_perf_counter_lock);
+  m_frame_perf_counters = std::move(frame);
+}
+
+std::vector<Common::PerfCounters::ThreadValues> PerformanceMetrics::GetFramePerfCounters() const
+{
+  std::lock_guard lock(m_perf_counter_lock);
+  return m_frame_perf_counters;
 }
 
 void PerformanceMetrics::CountVBlank()
@@ -36,12 +94,26 @@ void PerformanceMetrics::CountVBlank()
   m_vps_counter.Count();
 }
 
+void PerformanceMetrics::CountPageFlip(TimePoint flip_time)
+{
+  m_flip_counter.Count(flip_time);
+}
+
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
 {
   std::unique_lock lock(m_time_lock);
   m_time_sleeping += sleep;
 }
 
+void PerformanceMetrics::CountFieldDeadline(DT lateness)
+{
+  std::unique_lock lock(m_time_lock);
+  m_field_lateness[m_field_deadline_index++] = lateness;
+  ++m_field_deadlines;
+  if (lateness > MISSED_DEADLINE_THRESHOLD)
+    ++m_missed_field_deadlines;
+}
+
 void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cyclesLate)
 {
   std::unique_lock lock(m_time_lock);
@@ -62,6 +134,11 @@ double PerformanceMetrics::GetVPS() const
   return m_vps_counter.GetHzAvg();
 }
 
+double PerformanceMetrics::GetFlipsPerSecond() const
+{
+  return m_flip_counter.GetHzAvg();
+}
+
 double PerformanceMetrics::GetSpeed() const
 {
   return m_speed_counter.GetHzAvg() / 100.0;
@@ -80,6 +157,61 @@ double PerformanceMetrics::GetLastSpeedDenominator() const
          Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
 }
 
+DT PerformanceMetrics::GetFieldLatenessPercentile(double fraction) const
+{
+  std::array<DT, 256> lateness;
+  std::size_t count;
+  {
+    std::shared_lock lock(m_time_lock);
+    lateness = m_field_lateness;
+    count = std::min<std::size_t>(m_field_deadlines, lateness.size());
+  }
+
+  if (count == 0)
+    return DT::zero();
+
+  const auto nth = lateness.begin() + static_cast<std::size_t>(std::clamp(fraction, 0.0, 1.0) *
+                                                               static_cast<double>(count - 1));
+  std::nth_element(lateness.begin(), nth, lateness.begin() + count);
+  return *nth;
+}
+
+u64 PerformanceMetrics::GetMissedFieldDeadlines() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_missed_field_deadlines;
+}
+
+void PerformanceMetrics::LogFramePacing() const
+{
+  u64 field_deadlines;
+  {
+    std::shared_lock lock(m_time_lock);
+    field_deadlines = m_field_deadlines;
+  }
+
+  if (field_deadlines == 0)
+    return;
+
+  const DT vblank_std = m_vps_counter.GetDtStd();
+  INFO_LOG_FMT(VIDEO,
+               "Frame pacing: vblank p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, "
+               "variance {:.3f} ms^2; field deadline lateness p99 {:.3f} ms, {} of {} missed",
+               DT_ms(m_vps_counter.GetDtPercentile(0.50)).count(),
+               DT_ms(m_vps_counter.GetDtPercentile(0.95)).count(),
+               DT_ms(m_vps_counter.GetDtPercentile(0.99)).count(),
+               DT_ms(vblank_std).count() * DT_ms(vblank_std).count(),
+               DT_ms(GetFieldLatenessPercentile(0.99)).count(), GetMissedFieldDeadlines(),
+               field_deadlines);
+
+  if (GetFlipsPerSecond() > 0)
+  {
+    INFO_LOG_FMT(VIDEO, "Page flips: {:.2f} per second, interval p50 {:.2f} ms, p99 {:.2f} ms",
+                 GetFlipsPerSecond(), DT_ms(m_flip_counter.GetDtPercentile(0.50)).count(),
+                 DT_ms(m_flip_counter.GetDtPercentile(0.99)).count());
+  }
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   const float bg_alpha = 0.7f;
@@ -269,5 +401,86 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowFramePacing)
+  {
+    float window_height = (12.f + 17.f * 5) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("FramePacingStats", nullptr, imgui_flags))
+    {
+      const double vblank_std = DT_ms(m_vps_counter.GetDtStd()).count();
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "p50:%6.2lfms",
+                         DT_ms(m_vps_counter.GetDtPercentile(0.50)).count());
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "p99:%6.2lfms",
+                         DT_ms(m_vps_counter.GetDtPercentile(0.99)).count());
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "var:%6.2lf", vblank_std * vblank_std);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "lat:%5.2lfms",
+                         DT_ms(GetFieldLatenessPercentile(0.99)).count());
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "miss:%6llu",
+                         static_cast<unsigned long long>(GetMissedFieldDeadlines()));
+      ImGui::End();
+    }
+  }
+
+  if (g_ActiveConfig.bShowPerfCounters)
+  {
+    using Common::PerfCounters::Counter;
+    const std::vector<Common::PerfCounters::ThreadValues> threads = GetFramePerfCounters();
+
+    const float counters_width = 2.5f * window_width;
+    const int count = threads.empty() ? 1 : static_cast<int>(threads.size()) * 3;
+    const float window_height = (12.f + 17.f * count) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(counters_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= counters_width + window_padding;
+
+    if (ImGui::Begin("PerfCounterStats", nullptr, imgui_flags))
+    {
+      const ImVec4 color(r, g, b, 1.0f);
+      if (threads.empty())
+        ImGui::TextColored(color, "No hardware counters");
+
+      for (const auto& thread : threads)
+      {
+        const auto get = [&](Counter counter) {
+          const auto& value = thread.values[static_cast<size_t>(counter)];
+          return value ? static_cast<double>(*value) : -1.0;
+        };
+        // Misses per thousand instructions, or -1 if they couldn't be counted.
+        const double instructions = get(Counter::Instructions);
+        const auto mpki = [&](Counter counter) {
+          const double misses = get(counter);
+          return misses >= 0 && instructions > 0 ? misses * 1000 / instructions : -1.0;
+        };
+
+        const double cycles = get(Counter::Cycles);
+        ImGui::TextColored(color, "%-7s IPC:%5.2lf", thread.thread_name.c_str(),
+                           cycles > 0 && instructions >= 0 ? instructions / cycles : -1.0);
+        ImGui::TextColored(color, " L1i:%5.1lf L1d:%5.1lf LLC:%5.1lf", mpki(Counter::L1IMisses),
+                           mpki(Counter::L1DMisses), mpki(Counter::LLCMisses));
+        ImGui::TextColored(color, " br:%6.1lf iTLB:%5.1lf dTLB:%5.1lf",
+                           mpki(Counter::BranchMisses), mpki(Counter::ITLBMisses),
+                           mpki(Counter::DTLBMisses));
+      }
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
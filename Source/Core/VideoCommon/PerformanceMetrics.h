@@ -4,9 +4,13 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <mutex>
 #include <shared_mutex>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/PerfCounters.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -29,24 +33,43 @@ public:
   void Reset();
   void CountFrame();
   void CountVBlank();
+  // Called for every page flip reported by the presentation path, with when it reached the display.
+  void CountPageFlip(TimePoint flip_time);
 
   void CountThrottleSleep(DT sleep);
+  // Called at each throttle deadline that is aligned to the output of a VI field, with how long
+  // after the deadline the CPU thread actually got there.
+  void CountFieldDeadline(DT lateness);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
 
   // Getter Functions
   double GetFPS() const;
   double GetVPS() const;
+  double GetFlipsPerSecond() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
 
   double GetLastSpeedDenominator() const;
 
+  DT GetFieldLatenessPercentile(double fraction) const;
+  u64 GetMissedFieldDeadlines() const;
+
+  // Logs a summary of the frame pacing since the last Reset().
+  void LogFramePacing() const;
+
+  // How much each counted thread did during the last frame. Empty unless the hardware counters
+  // are shown.
+  std::vector<Common::PerfCounters::ThreadValues> GetFramePerfCounters() const;
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
 private:
+  void SamplePerfCounters();
+
   PerformanceTracker m_fps_counter{"render_times.txt"};
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
+  PerformanceTracker m_flip_counter{"flip_times.txt"};
   PerformanceTracker m_speed_counter{std::nullopt, 1000000};
 
   double m_graph_max_time = 0.0;
@@ -57,6 +80,21 @@ private:
   std::array<TimePoint, 256> m_real_times{};
   std::array<TimePoint, 256> m_cpu_times{};
   DT m_time_sleeping{};
+
+  // A field deadline counts as missed if it is reached later than this.
+  static constexpr DT MISSED_DEADLINE_THRESHOLD = std::chrono::milliseconds(1);
+
+  u8 m_field_deadline_index = 0;
+  std::array<DT, 256> m_field_lateness{};
+  u64 m_field_deadlines = 0;
+  u64 m_missed_field_deadlines = 0;
+
+  // Only touched by the thread that presents frames.
+  bool m_perf_counters_enabled = false;
+  std::vector<Common::PerfCounters::ThreadValues> m_last_perf_counters;
+
+  mutable std::mutex m_perf_counter_lock;
+  std::vector<Common::PerfCounters::ThreadValues> m_frame_perf_counters;
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -48,15 +48,20 @@ void PerformanceTracker::Reset()
 }
 
 void PerformanceTracker::Count()
+{
+  Count(Clock::now());
+}
+
+void PerformanceTracker::Count(TimePoint time)
 {
   std::unique_lock lock{m_mutex};
 
-  if (m_paused)
+  // Events from before the last reset are dropped.
+  if (m_paused || time < m_last_time)
     return;
 
   const DT window{GetSampleWindow()};
 
-  const TimePoint time{Clock::now()};
   const DT diff{time - m_last_time};
 
   m_last_time = time;
@@ -129,6 +134,24 @@ DT PerformanceTracker::GetDtStd() const
   return *(m_dt_std = std::chrono::duration_cast<DT>(DT_s(std::sqrt(total / QueueSize()))));
 }
 
+DT PerformanceTracker::GetDtPercentile(double fraction) const
+{
+  std::unique_lock lock{m_mutex};
+
+  if (QueueEmpty())
+    return DT::zero();
+
+  m_dt_sorted.clear();
+  for (std::size_t i = m_dt_queue_begin; i != m_dt_queue_end; i = IncrementIndex(i))
+    m_dt_sorted.push_back(m_dt_queue[i]);
+
+  const auto index = static_cast<std::size_t>(std::clamp(fraction, 0.0, 1.0) *
+                                              static_cast<double>(m_dt_sorted.size() - 1));
+  const auto nth = m_dt_sorted.begin() + index;
+  std::ranges::nth_element(m_dt_sorted, nth);
+  return *nth;
+}
+
 DT PerformanceTracker::GetLastRawDt() const
 {
   std::shared_lock lock{m_mutex};
@@ -8,6 +8,7 @@
 #include <fstream>
 #include <optional>
 #include <shared_mutex>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -46,6 +47,8 @@ public:
   // Functions for recording performance information
   void Reset();
   void Count();
+  // Counts an event that happened at the given time, instead of now.
+  void Count(TimePoint time);
 
   // Functions for reading performance information
   DT GetSampleWindow() const;
@@ -54,6 +57,8 @@ public:
 
   DT GetDtAvg() const;
   DT GetDtStd() const;
+  // Returns the dt that the given fraction (0.0 to 1.0) of the dt's in the window don't exceed.
+  DT GetDtPercentile(double fraction) const;
 
   DT GetLastRawDt() const;
 
@@ -99,6 +104,9 @@ private:  // Functions for managing dt queue
   // Used to initialize this on demand instead of on every Count()
   mutable std::optional<DT> m_dt_std = std::nullopt;
 
+  // Scratch space for GetDtPercentile
+  mutable std::vector<DT> m_dt_sorted;
+
   // Used to enable thread safety with the performance tracker
   mutable std::shared_mutex m_mutex;
 };
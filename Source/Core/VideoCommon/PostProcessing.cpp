@@ -3,9 +3,11 @@
 
 #include "VideoCommon/PostProcessing.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -38,6 +40,8 @@ static const char s_default_pixel_shader_name[] = "default_pre_post_process";
 // Keep the highest quality possible to avoid losing quality on subtle gamma conversions.
 // RGBA16F should have enough quality even if we store colors in gamma space on it.
 static const AbstractTextureFormat s_intermediary_buffer_format = AbstractTextureFormat::RGBA16F;
+// The caches only grow while switching between shaders, so they start over past this many.
+static constexpr size_t MAX_CACHED_SHADERS = 64;
 
 static bool LoadShaderFromFile(const std::string& shader, const std::string& sub_dir,
                                std::string& out_code)
@@ -103,6 +107,7 @@ void PostProcessingConfiguration::LoadDefaultShader()
 {
   m_options.clear();
   m_any_options_dirty = false;
+  m_output_scale = 1.0f;
   m_current_shader = "";
   m_current_shader_code = s_empty_pixel_shader;
 }
@@ -116,6 +121,7 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
 
   m_options.clear();
   m_any_options_dirty = true;
+  m_output_scale = 1.0f;
 
   if (configuration_start == std::string::npos || configuration_end == std::string::npos)
   {
@@ -181,6 +187,18 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
 
   for (const auto& it : option_strings)
   {
+    // Not an option, but settings for how the shader is run.
+    if (it.m_type == "Pass")
+    {
+      for (const auto& [key, value] : it.m_options)
+      {
+        if (key == "OutputScale")
+          TryParse(value, &m_output_scale);
+      }
+      m_output_scale = std::clamp(m_output_scale, 0.125f, 1.0f);
+      continue;
+    }
+
     ConfigurationOption option;
     option.m_dirty = true;
 
@@ -430,15 +448,22 @@ bool PostProcessing::Initialize(AbstractTextureFormat format)
 
 void PostProcessing::RecompileShader()
 {
-  // Note: for simplicity we already recompile all the shaders
-  // and pipelines even if there might not be need to.
-
-  m_default_pipeline.reset();
-  m_pipeline.reset();
-  m_default_pixel_shader.reset();
-  m_pixel_shader.reset();
-  m_default_vertex_shader.reset();
-  m_vertex_shader.reset();
+  // Shaders and pipelines which were compiled before are taken from the caches. The GPU is idle
+  // here, so this is also where the caches can be emptied.
+  m_default_pipeline = nullptr;
+  m_pipeline = nullptr;
+  m_upscale_pipeline = nullptr;
+  m_default_pixel_shader = nullptr;
+  m_pixel_shader = nullptr;
+  m_upscale_pixel_shader = nullptr;
+  m_default_vertex_shader = nullptr;
+  m_vertex_shader = nullptr;
+  if (m_shader_cache.size() > MAX_CACHED_SHADERS)
+  {
+    m_pipeline_cache.clear();
+    m_shader_cache.clear();
+  }
+
   if (!CompilePixelShader())
     return;
   if (!CompileVertexShader())
@@ -449,8 +474,9 @@ void PostProcessing::RecompileShader()
 
 void PostProcessing::RecompilePipeline()
 {
-  m_default_pipeline.reset();
-  m_pipeline.reset();
+  m_default_pipeline = nullptr;
+  m_pipeline = nullptr;
+  m_upscale_pipeline = nullptr;
   CompilePipeline();
 }
 
@@ -463,6 +489,13 @@ bool PostProcessing::IsColorCorrectionActive() const
          m_framebuffer_format == AbstractTextureFormat::RGBA16F;
 }
 
+bool PostProcessing::UseScaledOutput() const
+{
+  // Stereo modes that render both layers at once aren't supported by the upscale pass.
+  return m_upscale_pipeline && m_config.GetOutputScale() < 1.0f &&
+         g_ActiveConfig.stereo_mode == StereoMode::Off;
+}
+
 bool PostProcessing::NeedsIntermediaryBuffer() const
 {
   // If we have no user selected post process shader,
@@ -497,7 +530,7 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
       g_ActiveConfig.output_resampling_mode > OutputResamplingMode::Default;
   const bool needs_intermediary_buffer = NeedsIntermediaryBuffer();
   const bool needs_default_pipeline = needs_color_correction || needs_resampling;
-  const AbstractPipeline* final_pipeline = m_pipeline.get();
+  const AbstractPipeline* final_pipeline = m_pipeline;
   std::vector<u8>* uniform_staging_buffer = &m_default_uniform_staging_buffer;
   bool default_uniform_staging_buffer = true;
   const MathUtil::Rectangle<int> present_rect = g_presenter->GetTargetRectangle();
@@ -549,7 +582,7 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
 
     g_gfx->SetViewportAndScissor(g_gfx->ConvertFramebufferRectangle(
         m_intermediary_color_texture->GetRect(), m_intermediary_frame_buffer.get()));
-    g_gfx->SetPipeline(m_default_pipeline.get());
+    g_gfx->SetPipeline(m_default_pipeline);
     g_gfx->Draw(0, 3);
 
     g_gfx->SetFramebuffer(previous_framebuffer);
@@ -572,7 +605,7 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
     // doing two passes, with the second one doing nothing useful.
     if (m_default_pipeline && needs_default_pipeline)
     {
-      final_pipeline = m_default_pipeline.get();
+      final_pipeline = m_default_pipeline;
     }
     else
     {
@@ -592,16 +625,73 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   // Final pass, either a user selected shader or the default (fixed) shader.
   if (final_pipeline)
   {
+    // User shaders with an output scale below 1 render to a smaller texture first, which is then
+    // scaled up to the target with bilinear filtering.
+    AbstractFramebuffer* const output_frame_buffer = g_gfx->GetCurrentFramebuffer();
+    const bool scaled_output = final_pipeline == m_pipeline && UseScaledOutput();
+    MathUtil::Rectangle<int> pass_dst = dst;
+    if (scaled_output)
+    {
+      const float scale = m_config.GetOutputScale();
+      const u32 scaled_width = std::max(static_cast<u32>(dst.GetWidth() * scale), 1u);
+      const u32 scaled_height = std::max(static_cast<u32>(dst.GetHeight() * scale), 1u);
+      if (!m_scaled_frame_buffer || m_scaled_color_texture->GetWidth() != scaled_width ||
+          m_scaled_color_texture->GetHeight() != scaled_height ||
+          m_scaled_color_texture->GetFormat() != m_framebuffer_format)
+      {
+        const TextureConfig scaled_color_texture_config(
+            scaled_width, scaled_height, 1, 1, 1, m_framebuffer_format,
+            AbstractTextureFlag_RenderTarget, AbstractTextureType::Texture_2DArray);
+        m_scaled_frame_buffer.reset();
+        m_scaled_color_texture =
+            g_gfx->CreateTexture(scaled_color_texture_config, "Scaled post process texture");
+        if (m_scaled_color_texture)
+        {
+          m_scaled_frame_buffer =
+              g_gfx->CreateFramebuffer(m_scaled_color_texture.get(), nullptr);
+        }
+      }
+      if (m_scaled_frame_buffer)
+      {
+        g_gfx->SetFramebuffer(m_scaled_frame_buffer.get());
+        pass_dst = m_scaled_color_texture->GetRect();
+      }
+    }
+    else
+    {
+      m_scaled_frame_buffer.reset();
+      m_scaled_color_texture.reset();
+    }
+    const bool draw_to_scaled_output = scaled_output && m_scaled_frame_buffer;
+
     FillUniformBuffer(src_rect, src_tex, src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
                       present_rect, uniform_staging_buffer->data(), !default_uniform_staging_buffer,
-                      false);
+                      draw_to_scaled_output);
     g_vertex_manager->UploadUtilityUniforms(uniform_staging_buffer->data(),
                                             static_cast<u32>(uniform_staging_buffer->size()));
 
     g_gfx->SetViewportAndScissor(
-        g_gfx->ConvertFramebufferRectangle(dst, g_gfx->GetCurrentFramebuffer()));
+        g_gfx->ConvertFramebufferRectangle(pass_dst, g_gfx->GetCurrentFramebuffer()));
     g_gfx->SetPipeline(final_pipeline);
     g_gfx->Draw(0, 3);
+
+    if (draw_to_scaled_output)
+    {
+      g_gfx->SetFramebuffer(output_frame_buffer);
+      g_gfx->SetTexture(0, m_scaled_color_texture.get());
+      g_gfx->SetTexture(1, m_scaled_color_texture.get());
+
+      FillUniformBuffer(m_scaled_color_texture->GetRect(), m_scaled_color_texture.get(), 0,
+                        output_frame_buffer->GetRect(), present_rect,
+                        m_upscale_uniform_staging_buffer.data(), false, false);
+      g_vertex_manager->UploadUtilityUniforms(
+          m_upscale_uniform_staging_buffer.data(),
+          static_cast<u32>(m_upscale_uniform_staging_buffer.size()));
+
+      g_gfx->SetViewportAndScissor(g_gfx->ConvertFramebufferRectangle(dst, output_frame_buffer));
+      g_gfx->SetPipeline(m_upscale_pipeline);
+      g_gfx->Draw(0, 3);
+    }
   }
 }
 
@@ -812,20 +902,19 @@ bool PostProcessing::CompileVertexShader()
   std::ostringstream ss_default;
   ss_default << GetUniformBufferHeader(false);
   ss_default << GetVertexShaderBody();
-  m_default_vertex_shader = g_gfx->CreateShaderFromSource(ShaderStage::Vertex, ss_default.str(),
-                                                          "Default post-processing vertex shader");
+  m_default_vertex_shader = GetShader(ShaderStage::Vertex, ss_default.str(),
+                                      "Default post-processing vertex shader");
 
   std::ostringstream ss;
   ss << GetUniformBufferHeader(true);
   ss << GetVertexShaderBody();
-  m_vertex_shader =
-      g_gfx->CreateShaderFromSource(ShaderStage::Vertex, ss.str(), "Post-processing vertex shader");
+  m_vertex_shader = GetShader(ShaderStage::Vertex, ss.str(), "Post-processing vertex shader");
 
   if (!m_default_vertex_shader || !m_vertex_shader)
   {
     PanicAlertFmt("Failed to compile post-processing vertex shader");
-    m_default_vertex_shader.reset();
-    m_vertex_shader.reset();
+    m_default_vertex_shader = nullptr;
+    m_vertex_shader = nullptr;
     return false;
   }
 
@@ -960,17 +1049,18 @@ void PostProcessing::FillUniformBuffer(const MathUtil::Rectangle<int>& src,
 
 bool PostProcessing::CompilePixelShader()
 {
-  m_default_pixel_shader.reset();
-  m_pixel_shader.reset();
+  m_default_pixel_shader = nullptr;
+  m_pixel_shader = nullptr;
+  m_upscale_pixel_shader = nullptr;
 
   // Generate GLSL and compile the new shaders:
 
   std::string default_pixel_shader_code;
   if (LoadShaderFromFile(s_default_pixel_shader_name, "", default_pixel_shader_code))
   {
-    m_default_pixel_shader = g_gfx->CreateShaderFromSource(
-        ShaderStage::Pixel, GetHeader(false) + default_pixel_shader_code + GetFooter(),
-        "Default post-processing pixel shader");
+    m_default_pixel_shader =
+        GetShader(ShaderStage::Pixel, GetHeader(false) + default_pixel_shader_code + GetFooter(),
+                  "Default post-processing pixel shader");
     // We continue even if all of this failed, it doesn't matter
     m_default_uniform_staging_buffer.resize(CalculateUniformsSize(false));
   }
@@ -980,18 +1070,18 @@ bool PostProcessing::CompilePixelShader()
   }
 
   m_config.LoadShader(g_ActiveConfig.sPostProcessingShader);
-  m_pixel_shader = g_gfx->CreateShaderFromSource(
-      ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
-      fmt::format("User post-processing pixel shader: {}", m_config.GetShader()));
+  m_pixel_shader =
+      GetShader(ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
+                fmt::format("User post-processing pixel shader: {}", m_config.GetShader()));
   if (!m_pixel_shader)
   {
     PanicAlertFmt("Failed to compile user post-processing shader {}", m_config.GetShader());
 
     // Use default shader.
     m_config.LoadDefaultShader();
-    m_pixel_shader = g_gfx->CreateShaderFromSource(
-        ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
-        "Default user post-processing pixel shader");
+    m_pixel_shader =
+        GetShader(ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
+                  "Default user post-processing pixel shader");
     if (!m_pixel_shader)
     {
       m_uniform_staging_buffer.resize(0);
@@ -1000,6 +1090,15 @@ bool PostProcessing::CompilePixelShader()
   }
 
   m_uniform_staging_buffer.resize(CalculateUniformsSize(true));
+
+  if (m_config.GetOutputScale() < 1.0f)
+  {
+    // We continue even if this failed, the user shader then renders at the full size.
+    m_upscale_pixel_shader =
+        GetShader(ShaderStage::Pixel, GetHeader(false) + s_empty_pixel_shader + GetFooter(),
+                  "Post-processing upscale pixel shader");
+    m_upscale_uniform_staging_buffer.resize(CalculateUniformsSize(false));
+  }
   return true;
 }
 
@@ -1035,13 +1134,13 @@ bool PostProcessing::CompilePipeline()
   const bool needs_intermediary_buffer = NeedsIntermediaryBuffer();
 
   AbstractPipelineConfig config = {};
-  config.vertex_shader = m_default_vertex_shader.get();
+  config.vertex_shader = m_default_vertex_shader;
   // This geometry shader will take care of reading both layer 0 and 1 on the source texture,
   // and writing to both layer 0 and 1 on the render target.
   config.geometry_shader = UseGeometryShaderForPostProcess(needs_intermediary_buffer) ?
                                g_shader_cache->GetTexcoordGeometryShader() :
                                nullptr;
-  config.pixel_shader = m_default_pixel_shader.get();
+  config.pixel_shader = m_default_pixel_shader;
   config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
   config.depth_state = RenderState::GetNoDepthTestingDepthState();
   config.blending_state = RenderState::GetNoBlendingBlendState();
@@ -1050,18 +1149,50 @@ bool PostProcessing::CompilePipeline()
   config.usage = AbstractPipelineUsage::Utility;
   // We continue even if it failed, it will be skipped later on
   if (config.pixel_shader)
-    m_default_pipeline = g_gfx->CreatePipeline(config);
+    m_default_pipeline = GetPipeline(config);
 
-  config.vertex_shader = m_vertex_shader.get();
+  config.vertex_shader = m_vertex_shader;
   config.geometry_shader = UseGeometryShaderForPostProcess(false) ?
                                g_shader_cache->GetTexcoordGeometryShader() :
                                nullptr;
-  config.pixel_shader = m_pixel_shader.get();
+  config.pixel_shader = m_pixel_shader;
   config.framebuffer_state = RenderState::GetColorFramebufferState(m_framebuffer_format);
-  m_pipeline = g_gfx->CreatePipeline(config);
+  m_pipeline = GetPipeline(config);
   if (!m_pipeline)
     return false;
 
+  if (m_upscale_pixel_shader)
+  {
+    config.vertex_shader = m_default_vertex_shader;
+    config.geometry_shader = nullptr;
+    config.pixel_shader = m_upscale_pixel_shader;
+    m_upscale_pipeline = GetPipeline(config);
+  }
+
   return true;
 }
+
+const AbstractShader* PostProcessing::GetShader(ShaderStage stage, std::string source,
+                                                std::string_view name)
+{
+  auto key = std::make_pair(stage, std::move(source));
+  if (const auto it = m_shader_cache.find(key); it != m_shader_cache.end())
+    return it->second.get();
+
+  std::unique_ptr<AbstractShader> shader = g_gfx->CreateShaderFromSource(stage, key.second, name);
+  if (!shader)
+    return nullptr;
+  return m_shader_cache.emplace(std::move(key), std::move(shader)).first->second.get();
+}
+
+const AbstractPipeline* PostProcessing::GetPipeline(const AbstractPipelineConfig& config)
+{
+  if (const auto it = m_pipeline_cache.find(config); it != m_pipeline_cache.end())
+    return it->second.get();
+
+  std::unique_ptr<AbstractPipeline> pipeline = g_gfx->CreatePipeline(config);
+  if (!pipeline)
+    return nullptr;
+  return m_pipeline_cache.emplace(config, std::move(pipeline)).first->second.get();
+}
 }  // namespace VideoCommon
@@ -6,11 +6,15 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
 #include "Common/Timer.h"
+#include "VideoCommon/AbstractPipeline.h"
+#include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/TextureConfig.h"
 
 class AbstractPipeline;
@@ -74,6 +78,9 @@ public:
   const ConfigMap& GetOptions() const { return m_options; }
   ConfigMap& GetOptions() { return m_options; }
   const ConfigurationOption& GetOption(const std::string& option) { return m_options[option]; }
+  // Size of the shader's output relative to the target, from the OutputScale of its [Pass]
+  // section. Smaller passes are rendered to a texture and scaled up to the target afterwards.
+  float GetOutputScale() const { return m_output_scale; }
   // For updating option's values
   void SetOptionf(const std::string& option, int index, float value);
   void SetOptioni(const std::string& option, int index, s32 value);
@@ -84,6 +91,7 @@ private:
   std::string m_current_shader;
   std::string m_current_shader_code;
   ConfigMap m_options;
+  float m_output_scale = 1.0f;
 
   void LoadOptions(const std::string& code);
   void LoadOptionsConfiguration();
@@ -121,6 +129,10 @@ protected:
   bool CompilePixelShader();
   bool CompilePipeline();
 
+  const AbstractShader* GetShader(ShaderStage stage, std::string source, std::string_view name);
+  const AbstractPipeline* GetPipeline(const AbstractPipelineConfig& config);
+  bool UseScaledOutput() const;
+
   size_t CalculateUniformsSize(bool user_post_process) const;
   void FillUniformBuffer(const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
                          int src_layer, const MathUtil::Rectangle<int>& dst,
@@ -130,20 +142,32 @@ protected:
   // Timer for determining our time value
   Common::Timer m_timer;
 
+  // Every shader and pipeline compiled so far, by source and by config. Switching back to a
+  // shader or output format reuses them instead of compiling them again. The objects below point
+  // into these.
+  std::map<std::pair<ShaderStage, std::string>, std::unique_ptr<AbstractShader>> m_shader_cache;
+  std::map<AbstractPipelineConfig, std::unique_ptr<AbstractPipeline>> m_pipeline_cache;
+
   // Dolphin fixed post process:
   PostProcessingConfiguration::ConfigMap m_default_options;
-  std::unique_ptr<AbstractShader> m_default_vertex_shader;
-  std::unique_ptr<AbstractShader> m_default_pixel_shader;
-  std::unique_ptr<AbstractPipeline> m_default_pipeline;
+  const AbstractShader* m_default_vertex_shader = nullptr;
+  const AbstractShader* m_default_pixel_shader = nullptr;
+  const AbstractPipeline* m_default_pipeline = nullptr;
   std::unique_ptr<AbstractFramebuffer> m_intermediary_frame_buffer;
   std::unique_ptr<AbstractTexture> m_intermediary_color_texture;
   std::vector<u8> m_default_uniform_staging_buffer;
   // User post process:
   PostProcessingConfiguration m_config;
-  std::unique_ptr<AbstractShader> m_vertex_shader;
-  std::unique_ptr<AbstractShader> m_pixel_shader;
-  std::unique_ptr<AbstractPipeline> m_pipeline;
+  const AbstractShader* m_vertex_shader = nullptr;
+  const AbstractShader* m_pixel_shader = nullptr;
+  const AbstractPipeline* m_pipeline = nullptr;
   std::vector<u8> m_uniform_staging_buffer;
+  // Scales the output of user shaders with an output scale below 1 up to the target.
+  const AbstractShader* m_upscale_pixel_shader = nullptr;
+  const AbstractPipeline* m_upscale_pipeline = nullptr;
+  std::unique_ptr<AbstractFramebuffer> m_scaled_frame_buffer;
+  std::unique_ptr<AbstractTexture> m_scaled_color_texture;
+  std::vector<u8> m_upscale_uniform_staging_buffer;
 
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
 };
@@ -4,6 +4,7 @@
 #include "VideoCommon/Present.h"
 
 #include "Common/ChunkFile.h"
+#include "Common/FrameTrace.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
@@ -15,6 +16,8 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/LatencyLimiter.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/OnScreenUI.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Statistics.h"
@@ -202,6 +205,7 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
     ProcessFrameDumping(ticks);
 
     AfterPresentEvent::Trigger(present_info);
+    MarkTraceFrame();
   }
 }
 
@@ -221,6 +225,19 @@ void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_
   ProcessFrameDumping(ticks);
 
   AfterPresentEvent::Trigger(present_info);
+  MarkTraceFrame();
+}
+
+void Presenter::MarkTraceFrame()
+{
+  const std::optional<std::string> trace_path = Common::FrameTrace::MarkFrame();
+  if (!trace_path)
+    return;
+
+  if (trace_path->empty())
+    OSD::AddMessage("Failed to write frame trace", OSD::Duration::NORMAL, OSD::Color::RED);
+  else
+    OSD::AddMessage("Frame trace saved to " + *trace_path);
 }
 
 void Presenter::ProcessFrameDumping(u64 ticks) const
@@ -816,6 +833,8 @@ void Presenter::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
 
 void Presenter::Present()
 {
+  TRACE_SCOPE("Presenter::Present");
+
   m_present_count++;
 
   if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_entry))
@@ -867,7 +886,11 @@ void Presenter::Present()
   // Present to the window system.
   {
     std::lock_guard<std::mutex> guard(m_swap_mutex);
+    TRACE_SCOPE("PresentBackbuffer");
+    const TimePoint present_start = Clock::now();
     g_gfx->PresentBackbuffer();
+    if (m_xfb_entry)
+      g_latency_limiter.OnPresent(m_last_xfb_ticks, present_start, Clock::now());
   }
 
   if (m_xfb_entry)
@@ -100,10 +100,13 @@ public:
 
 private:
   // Fetches the XFB texture from the texture cache.
-  // Returns true the contents have changed since last time
+  // Returns true if it is the same cache entry as last time, i.e. the contents have not changed.
+  // XFBs loaded from RAM keep their entry for as long as the RAM hash matches, and XFB copies
+  // get a new entry each time they are written.
   bool FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
 
   void ProcessFrameDumping(u64 ticks) const;
+  static void MarkTraceFrame();
 
   void OnBackBufferSizeChanged();
 
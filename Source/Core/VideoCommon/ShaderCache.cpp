@@ -3,10 +3,14 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <unordered_set>
+
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
+#include "Common/FrameTrace.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
 
@@ -15,6 +19,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -55,11 +60,12 @@ void ShaderCache::InitializeShaderCache()
 {
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
 
-  // Load shader and UID caches.
+  // Load shader and UID caches. The UID cache goes first, as it decides which pipelines from the
+  // shared pipeline cache are created up front.
   if (g_ActiveConfig.bShaderCache && m_api_type != APIType::Nothing)
   {
-    LoadCaches();
     LoadPipelineUIDCache();
+    LoadCaches();
   }
 
   // Queue ubershader precompiling if required.
@@ -102,6 +108,18 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+
+  // Pipelines the game is waiting for are never held back by the budget.
+  m_async_shader_compiler->SetFrameBudget(
+      std::chrono::milliseconds(g_ActiveConfig.iShaderCompileFrameBudget),
+      COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  const AsyncShaderCompiler::FrameMetrics metrics =
+      m_async_shader_compiler->EndFrame(g_perf_metrics.GetMaxSpeed());
+  g_stats.num_shader_compiles_pending = static_cast<int>(metrics.pending_items);
+  g_stats.num_shader_compiler_workers = static_cast<int>(metrics.active_workers);
+  g_stats.shader_compile_time = metrics.budgeted_compile_time;
+  g_stats.shader_compile_latency = metrics.average_latency;
+  g_stats.max_shader_compile_latency = metrics.max_latency;
 }
 
 void ShaderCache::Shutdown()
@@ -114,8 +132,42 @@ void ShaderCache::Shutdown()
   ClosePipelineUIDCache();
 }
 
-const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
+// When depth state and cull mode are set at draw time, pipelines that only differ by them are
+// the same pipeline, so they are reset to a fixed value before the UID is looked up.
+static void ClearDynamicState(RasterizationState* rasterization_state, DepthState* depth_state,
+                              bool keep_depth_writes)
+{
+  const bool updateenable = keep_depth_writes && depth_state->updateenable;
+  *depth_state = RenderState::GetNoDepthTestingDepthState();
+  depth_state->updateenable = updateenable;
+  rasterization_state->cullmode = CullMode::None;
+}
+
+static GXPipelineUid ClearDynamicState(const GXPipelineUid& in)
+{
+  GXPipelineUid out;
+  memcpy(static_cast<void*>(&out), static_cast<const void*>(&in), sizeof(out));  // copy padding
+  if (g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState)
+  {
+    // ApplyDriverBugs() only forces early depth testing when depth is written.
+    ClearDynamicState(&out.rasterization_state, &out.depth_state,
+                      out.ps_uid.GetUidData()->ztest == EmulatedZ::ForcedEarly);
+  }
+  return out;
+}
+
+static GXUberPipelineUid ClearDynamicState(const GXUberPipelineUid& in)
 {
+  GXUberPipelineUid out;
+  memcpy(static_cast<void*>(&out), static_cast<const void*>(&in), sizeof(out));  // copy padding
+  if (g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState)
+    ClearDynamicState(&out.rasterization_state, &out.depth_state, false);
+  return out;
+}
+
+const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid_in)
+{
+  const GXPipelineUid uid = ClearDynamicState(uid_in);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
@@ -124,14 +176,23 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
-    pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  {
+    TRACE_SCOPE("ShaderCache::CompilePipeline");
+    const std::vector<u8> cache_data = ReadGXPipelineCacheData(uid);
+    if (!cache_data.empty())
+      pipeline = g_gfx->CreatePipeline(*pipeline_config, cache_data.data(), cache_data.size());
+    if (!pipeline)
+      pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
-std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
+std::optional<const AbstractPipeline*>
+ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid_in)
 {
+  const GXPipelineUid uid = ClearDynamicState(uid_in);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
@@ -147,8 +208,9 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   return {};
 }
 
-const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
+const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid_in)
 {
+  const GXUberPipelineUid uid = ClearDynamicState(uid_in);
   auto it = m_gx_uber_pipeline_cache.find(uid);
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
@@ -156,14 +218,37 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    TRACE_SCOPE("ShaderCache::CompileUberPipeline");
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid_in)
+{
+  const GXUberPipelineUid uid = ClearDynamicState(uid_in);
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.second)
+      return it->second.first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  return {};
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
 
+  // No frames are run while waiting, so the frame budget would never be renewed.
+  m_async_shader_compiler->SetFrameBudget(DT{}, 0);
+
   constexpr auto update_ui_progress = [](size_t completed, size_t total) {
     const float center_x = ImGui::GetIO().DisplaySize.x * 0.5f;
     const float center_y = ImGui::GetIO().DisplaySize.y * 0.5f;
@@ -290,7 +375,8 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
       UnserializePipelineUid(key, real_uid);
 
       // Skip those which are already compiled.
-      if (failed || cache.contains(real_uid))
+      const auto iter = cache.find(real_uid);
+      if (failed || (iter != cache.end() && iter->second.first))
         return;
 
       auto config = this_ptr->GetGXPipelineConfig(real_uid);
@@ -349,6 +435,116 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   }
 }
 
+static u64 HashSerializedPipelineUid(const SerializedGXPipelineUid& uid)
+{
+  return XXH64(&uid, sizeof(uid), 0);
+}
+
+void ShaderCache::LoadGXPipelineCache()
+{
+  class CacheReader : public Common::LinearDiskCacheReader<SerializedGXPipelineUid, u8>
+  {
+  public:
+    CacheReader(ShaderCache* this_ptr_, std::unordered_set<u64> wanted_uids_)
+        : this_ptr(this_ptr_), wanted_uids(std::move(wanted_uids_))
+    {
+    }
+    bool AnyFailed() const { return failed; }
+    void Read(const SerializedGXPipelineUid& key, const u8* value, u32 value_size) override
+    {
+      // Every pipeline in the cache can be created later on when it's first used, but only the
+      // ones which this game is known to use are created now.
+      const u64 hash = HashSerializedPipelineUid(key);
+      this_ptr->m_gx_pipeline_disk_offsets.emplace(
+          hash, this_ptr->m_gx_pipeline_disk_cache.GetCurrentEntryOffset());
+      if (failed || !wanted_uids.contains(hash))
+        return;
+
+      GXPipelineUid real_uid;
+      UnserializePipelineUid(key, real_uid);
+      auto& entry = this_ptr->m_gx_pipeline_cache[real_uid];
+      if (entry.first)
+        return;
+
+      auto config = this_ptr->GetGXPipelineConfig(real_uid);
+      if (!config)
+        return;
+
+      entry.first = g_gfx->CreatePipeline(*config, value, value_size);
+      entry.second = false;
+      if (entry.first && entry.first->NeedsOptimizedLink())
+        this_ptr->QueueOptimizedLink(entry.first.get());
+
+      // If any of the pipelines fail to create, consider the cache stale.
+      failed = !entry.first;
+    }
+
+  private:
+    ShaderCache* this_ptr;
+    std::unordered_set<u64> wanted_uids;
+    bool failed = false;
+  };
+
+  // Pipeline cache data only depends on the driver and the host config, so when the backend can
+  // identify its driver, every game shares one cache file per driver. Otherwise, a driver update
+  // could leave a stale cache behind that every game would have to throw away.
+  const std::string driver_identity = g_gfx->GetDriverIdentity();
+  const std::string filename =
+      driver_identity.empty() ?
+          GetDiskShaderCacheFileName(m_api_type, "specialized-pipeline", true, true) :
+          GetDiskShaderCacheFileName(
+              m_api_type,
+              fmt::format("shared-pipeline-{:016x}",
+                          XXH64(driver_identity.data(), driver_identity.size(), 0))
+                  .c_str(),
+              false, true);
+
+  std::unordered_set<u64> wanted_uids;
+  for (const auto& it : m_gx_pipeline_cache)
+  {
+    SerializedGXPipelineUid disk_uid;
+    SerializePipelineUid(it.first, disk_uid);
+    wanted_uids.insert(HashSerializedPipelineUid(disk_uid));
+  }
+
+  CacheReader reader(this, std::move(wanted_uids));
+  const u32 count = m_gx_pipeline_disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(VIDEO, "Found {} cached pipelines in {}", count, filename);
+
+  // If any of the pipelines in the cache failed to create, it's likely because of a change of
+  // system configuration that the driver identity doesn't cover. There's no point in keeping the
+  // old cache data around, so discard and recreate the disk cache.
+  if (reader.AnyFailed())
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
+                 filename);
+    m_gx_pipeline_disk_cache.Close();
+    m_gx_pipeline_disk_offsets.clear();
+    File::Delete(filename);
+    CacheReader empty_reader(this, {});
+    m_gx_pipeline_disk_cache.OpenAndRead(filename, empty_reader);
+  }
+}
+
+std::vector<u8> ShaderCache::ReadGXPipelineCacheData(const GXPipelineUid& uid)
+{
+  SerializedGXPipelineUid disk_uid;
+  SerializePipelineUid(uid, disk_uid);
+  const auto iter = m_gx_pipeline_disk_offsets.find(HashSerializedPipelineUid(disk_uid));
+  if (iter == m_gx_pipeline_disk_offsets.end())
+    return {};
+
+  // Rule out hash collisions by comparing the stored UID.
+  SerializedGXPipelineUid stored_uid;
+  std::vector<u8> cache_data;
+  if (!m_gx_pipeline_disk_cache.ReadEntry(iter->second, &stored_uid, &cache_data) ||
+      std::memcmp(&stored_uid, &disk_uid, sizeof(disk_uid)) != 0)
+  {
+    return {};
+  }
+  return cache_data;
+}
+
 void ShaderCache::LoadCaches()
 {
   // Ubershader caches, if present.
@@ -373,8 +569,7 @@ void ShaderCache::LoadCaches()
 
   if (g_ActiveConfig.backend_info.bSupportsPipelineCacheData)
   {
-    LoadPipelineCache<GXPipelineUid, SerializedGXPipelineUid>(
-        m_gx_pipeline_cache, m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
+    LoadGXPipelineCache();
     LoadPipelineCache<GXUberPipelineUid, SerializedGXUberPipelineUid>(
         m_gx_uber_pipeline_cache, m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline",
         false);
@@ -384,6 +579,7 @@ void ShaderCache::LoadCaches()
 void ShaderCache::ClearCaches()
 {
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
+  m_gx_pipeline_disk_offsets.clear();
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
   ClearShaderCache(m_ps_cache);
@@ -432,6 +628,7 @@ void ShaderCache::CompileMissingPipelines()
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("ShaderCache::CompileVertexShader");
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +637,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("ShaderCache::CompileVertexUberShader");
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +646,7 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("ShaderCache::CompilePixelShader");
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +655,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("ShaderCache::CompilePixelUberShader");
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -877,16 +1077,22 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
   if (!entry.first && pipeline)
   {
     entry.first = std::move(pipeline);
-
-    if (g_ActiveConfig.bShaderCache)
+    if (entry.first->NeedsOptimizedLink())
+      QueueOptimizedLink(entry.first.get());
+
+    // The pipeline may have been created from the disk cache, or was already added to it by
+    // another game sharing the cache, in which case there's nothing to write.
+    SerializedGXPipelineUid disk_uid;
+    SerializePipelineUid(config, disk_uid);
+    const u64 hash = HashSerializedPipelineUid(disk_uid);
+    if (g_ActiveConfig.bShaderCache && !m_gx_pipeline_disk_offsets.contains(hash))
     {
       auto cache_data = entry.first->GetCacheData();
       if (!cache_data.empty())
       {
-        SerializedGXPipelineUid disk_uid;
-        SerializePipelineUid(config, disk_uid);
-        m_gx_pipeline_disk_cache.Append(disk_uid, cache_data.data(),
-                                        static_cast<u32>(cache_data.size()));
+        m_gx_pipeline_disk_offsets.emplace(
+            hash, m_gx_pipeline_disk_cache.Append(disk_uid, cache_data.data(),
+                                                  static_cast<u32>(cache_data.size())));
       }
     }
   }
@@ -922,8 +1128,8 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  constexpr u32 CACHE_FILE_MAGIC = GX_PIPELINE_UID_CACHE_MAGIC;
+  constexpr size_t CACHE_HEADER_SIZE = GX_PIPELINE_UID_CACHE_HEADER_SIZE;
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
@@ -1003,6 +1209,7 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
+  real_uid = ClearDynamicState(real_uid);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
@@ -1154,7 +1361,11 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       // Check if all the stages required for this pipeline have been compiled.
       // If not, this work item becomes a no-op, and re-queues the pipeline for the next frame.
       if (SetStagesReady())
+      {
         config = shader_cache->GetGXPipelineConfig(uid);
+        if (config)
+          cache_data = shader_cache->ReadGXPipelineCacheData(uid);
+      }
     }
 
     bool SetStagesReady()
@@ -1181,7 +1392,10 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
     bool Compile() override
     {
-      if (config)
+      TRACE_SCOPE("ShaderCache::CompilePipeline");
+      if (config && !cache_data.empty())
+        pipeline = g_gfx->CreatePipeline(*config, cache_data.data(), cache_data.size());
+      if (config && !pipeline)
         pipeline = g_gfx->CreatePipeline(*config);
       return true;
     }
@@ -1207,6 +1421,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     GXPipelineUid uid;
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
+    std::vector<u8> cache_data;
     bool stages_ready;
   };
 
@@ -1256,6 +1471,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
 
     bool Compile() override
     {
+      TRACE_SCOPE("ShaderCache::CompileUberPipeline");
       if (config)
         UberPipeline = g_gfx->CreatePipeline(*config);
       return true;
@@ -1290,6 +1506,30 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
   m_gx_uber_pipeline_cache[uid].second = true;
 }
 
+void ShaderCache::QueueOptimizedLink(AbstractPipeline* pipeline)
+{
+  // Pipelines are only destroyed once the compiler threads are idle, so this can't outlive it.
+  class OptimizedLinkWorkItem final : public AsyncShaderCompiler::WorkItem
+  {
+  public:
+    explicit OptimizedLinkWorkItem(AbstractPipeline* pipeline_) : pipeline(pipeline_) {}
+
+    bool Compile() override
+    {
+      pipeline->LinkOptimized();
+      return true;
+    }
+
+    void Retrieve() override {}
+
+  private:
+    AbstractPipeline* pipeline;
+  };
+
+  auto wi = m_async_shader_compiler->CreateWorkItem<OptimizedLinkWorkItem>(pipeline);
+  m_async_shader_compiler->QueueWorkItem(std::move(wi), COMPILE_PRIORITY_OPTIMIZED_LINK);
+}
+
 void ShaderCache::QueueUberShaderPipelines()
 {
   // Create a dummy vertex format with no attributes.
@@ -1319,6 +1559,7 @@ void ShaderCache::QueueUberShaderPipelines()
           config.blending_state.logicopenable = true;
           config.blending_state.logicmode = LogicOp::And;
         }
+        config = ClearDynamicState(config);
 
         auto iter = m_gx_uber_pipeline_cache.find(config);
         if (iter != m_gx_uber_pipeline_cache.end())
@@ -1345,6 +1586,23 @@ void ShaderCache::QueueUberShaderPipelines()
         }
         BlendingState blend = RenderState::GetNoBlendingBlendState();
         QueueDummyPipeline(vuid, guid, cleared_puid, blend);
+        if (g_ActiveConfig.bSpecializeUberShaders)
+        {
+          // Only the most common variants are built up front: one or two TEV stages, without
+          // fog, alpha testing or indirect texturing. Others are compiled when they're used.
+          UberShader::PixelShaderUid specialized_puid = cleared_puid;
+          UberShader::pixel_ubershader_uid_data* const specialized_data =
+              specialized_puid.GetUidData();
+          specialized_data->specialized = 1;
+          specialized_data->fog_enabled = 0;
+          specialized_data->alpha_test_passes = 1;
+          specialized_data->no_indirect = 1;
+          for (u32 num_tev_stages = 0; num_tev_stages < 2; num_tev_stages++)
+          {
+            specialized_data->num_tev_stages = num_tev_stages;
+            QueueDummyPipeline(vuid, guid, specialized_puid, blend);
+          }
+        }
         if (g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
         {
           // Not all GPUs need all the pipeline state compiled into shaders, so they tend to key
@@ -12,6 +12,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -63,12 +64,16 @@ public:
   void RetrieveAsyncShaders();
 
   // Accesses ShaderGen shader caches
+  // If the backend supports dynamic depth and cull state, the returned pipeline may have been
+  // created with a different depth state and cull mode, which must be set with
+  // AbstractGfx::SetDynamicDepthAndCullState() before drawing.
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
 
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  std::optional<const AbstractPipeline*> GetUberPipelineForUidAsync(const GXUberPipelineUid& uid);
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -124,6 +129,7 @@ private:
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
+  void QueueOptimizedLink(AbstractPipeline* pipeline);
   bool CompileSharedPipelines();
 
   // GX shader compiler methods
@@ -180,6 +186,8 @@ private:
                          APIType api_type, const char* type, bool include_gameid);
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
+  void LoadGXPipelineCache();
+  std::vector<u8> ReadGXPipelineCacheData(const GXPipelineUid& uid);
 
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
@@ -189,7 +197,8 @@ private:
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
+    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300,
+    COMPILE_PRIORITY_OPTIMIZED_LINK = 400
   };
 
   // Configuration bits.
@@ -230,6 +239,9 @@ private:
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
+  // Offsets of the entries in m_gx_pipeline_disk_cache, by the hash of their serialized UID. The
+  // disk cache is shared between games, so most of these are only created when first used.
+  std::unordered_map<u64, u64> m_gx_pipeline_disk_offsets;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
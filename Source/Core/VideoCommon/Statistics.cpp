@@ -4,8 +4,10 @@
 #include "VideoCommon/Statistics.h"
 
 #include <cstring>
+#include <string>
 #include <utility>
 
+#include <fmt/format.h>
 #include <imgui.h>
 
 #include "Core/DolphinAnalytics.h"
@@ -13,6 +15,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -90,30 +93,73 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Textures pending", "%d", num_textures_pending);
+  draw_statistic("Texture memory", "%.1f MB", texture_memory_usage_kb / 1024.0f);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
+  draw_statistic("shader UID updates", "%d", this_frame.num_shader_uid_updates);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
+  draw_statistic("Primitives skipped", "%d", this_frame.num_skipped_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
   draw_statistic("XF loads (DL)", "%d", this_frame.num_xf_loads_in_dl);
+  draw_statistic("XF loads (redundant)", "%d", this_frame.num_xf_loads_redundant);
   draw_statistic("CP loads", "%d", this_frame.num_cp_loads);
   draw_statistic("CP loads (DL)", "%d", this_frame.num_cp_loads_in_dl);
   draw_statistic("BP loads", "%d", this_frame.num_bp_loads);
   draw_statistic("BP loads (DL)", "%d", this_frame.num_bp_loads_in_dl);
+  draw_statistic("BP loads (redundant)", "%d", this_frame.num_bp_loads_redundant);
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
+  draw_statistic("CPU culled triangles", "%d (%i kB vertices)", this_frame.num_cpu_culled_triangles,
+                 this_frame.bytes_cpu_culled_vertices / 1024);
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
+  draw_statistic("BBox reads:", "%d stalled, %d queued", this_frame.num_bbox_stalls,
+                 this_frame.num_bbox_queued_reads);
+  draw_statistic("Perf query stalls:", "%d", this_frame.num_perf_query_stalls);
+  draw_statistic("Texture hashes:", "%d (%i kB)", this_frame.num_texture_hashes,
+                 this_frame.bytes_texture_hashed / 1024);
+  draw_statistic("Texture overlap candidates:", "%d", this_frame.num_texture_overlap_candidates);
+  draw_statistic("Palette conversions:", "%d", this_frame.num_palette_conversions);
+  draw_statistic("Texture levels decoded:", "%d CPU, %d GPU",
+                 this_frame.num_texture_levels_decoded_cpu,
+                 this_frame.num_texture_levels_decoded_gpu);
+  draw_statistic("Texture pool reuses:", "%d", this_frame.num_texture_pool_reuses);
+  draw_statistic("EFB copies:", "%d to VRAM, %d to RAM", this_frame.num_efb_copies_to_vram,
+                 this_frame.num_efb_copies_to_ram);
+  draw_statistic("Late texture binds:", "%d", this_frame.num_textures_late);
+  draw_statistic("Render passes:", "%d (%d split)", this_frame.num_render_passes,
+                 this_frame.num_render_pass_splits);
+  draw_statistic("FIFO time:", "%.2f ms", DT_ms(this_frame.fifo_time).count());
+  draw_statistic("Vertex loading:", "%.2f ms", DT_ms(this_frame.vertex_loading_time).count());
+  draw_statistic("Draw submission:", "%.2f ms", DT_ms(this_frame.draw_submission_time).count());
+  draw_statistic("Texture hashing:", "%.2f ms", DT_ms(this_frame.texture_hash_time).count());
+  draw_statistic("Texture decoding:", "%.2f ms", DT_ms(this_frame.texture_decode_time).count());
+  draw_statistic("Shader compiles pending:", "%d (%d workers)", num_shader_compiles_pending,
+                 num_shader_compiler_workers);
+  draw_statistic("Background compile time:", "%.2f ms", DT_ms(shader_compile_time).count());
+  draw_statistic("Shader compile latency:", "%.2f ms (max %.2f ms)",
+                 DT_ms(shader_compile_latency).count(), DT_ms(max_shader_compile_latency).count());
+
+  if (g_ActiveConfig.bGraphicMods)
+  {
+    for (const auto& times : g_graphics_mod_manager->GetLastFrameActionTimes())
+    {
+      const std::string name = fmt::format("{} ({}):", times.mod_title, times.action_name);
+      draw_statistic(name.c_str(), "%u calls, %.2f ms", times.calls, DT_ms(times.time).count());
+    }
+  }
 
   ImGui::Columns(1);
 
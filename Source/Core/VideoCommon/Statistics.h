@@ -6,6 +6,7 @@
 #include <array>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPFunctions.h"
 
 struct Statistics
@@ -18,6 +19,18 @@ struct Statistics
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
+  // Textures still being decoded by async texture loading.
+  int num_textures_pending = 0;
+  // Host memory used by the textures in the texture cache and its pool, in KiB.
+  int texture_memory_usage_kb = 0;
+
+  // Shader compiler state at the end of the last frame. The compile time only counts shaders
+  // compiled ahead of use, the latencies only the ones the game asked for.
+  int num_shader_compiles_pending = 0;
+  int num_shader_compiler_workers = 0;
+  DT shader_compile_time{};
+  DT shader_compile_latency{};
+  DT max_shader_compile_latency{};
 
   int num_vertex_loaders = 0;
 
@@ -49,9 +62,14 @@ struct Statistics
     int num_cp_loads_in_dl = 0;
     int num_xf_loads_in_dl = 0;
 
+    int num_bp_loads_redundant = 0;
+    int num_xf_loads_redundant = 0;
+
     int num_prims = 0;
+    int num_skipped_prims = 0;
     int num_dl_prims = 0;
     int num_shader_changes = 0;
+    int num_shader_uid_updates = 0;
 
     int num_primitive_joins = 0;
     int num_draw_calls = 0;
@@ -66,6 +84,9 @@ struct Statistics
     int num_triangles_in = 0;
     int num_triangles_rejected = 0;
     int num_triangles_culled = 0;
+    // Triangles removed from partially visible draws by CPUCull, and the vertex data it saved.
+    int num_cpu_culled_triangles = 0;
+    int bytes_cpu_culled_vertices = 0;
     int num_drawn_objects = 0;
     int rasterized_pixels = 0;
     int num_triangles_drawn = 0;
@@ -79,6 +100,47 @@ struct Statistics
     int num_draw_done = 0;
     int num_token = 0;
     int num_token_int = 0;
+
+    // Bounding box reads that waited for the GPU, and ones served from a queued readback.
+    int num_bbox_stalls = 0;
+    int num_bbox_queued_reads = 0;
+    // Waits for the results of occlusion queries, for CPU reads or to bound their staleness.
+    int num_perf_query_stalls = 0;
+
+    // Guest memory read by the texture cache to check whether textures changed.
+    int num_texture_hashes = 0;
+    int bytes_texture_hashed = 0;
+    // Textures the texture cache looked at to find the ones overlapping a range of memory.
+    int num_texture_overlap_candidates = 0;
+    // Textures rendered with a palette applied, not counting reused ones.
+    int num_palette_conversions = 0;
+    // Texture levels decoded on the GPU thread, by the CPU or with a compute shader. Async
+    // texture loads decode on worker threads and are counted in num_textures_pending instead.
+    int num_texture_levels_decoded_cpu = 0;
+    int num_texture_levels_decoded_gpu = 0;
+    // Textures taken from the pool of unused textures rather than created.
+    int num_texture_pool_reuses = 0;
+    // EFB and XFB copies, by where they were written. A copy can go to both.
+    int num_efb_copies_to_vram = 0;
+    int num_efb_copies_to_ram = 0;
+
+    // Texture binds which used the async texture loading placeholder.
+    int num_textures_late = 0;
+
+    // Render passes begun by the backend, and how many of them continued drawing to the
+    // framebuffer of the previous pass, so had to load what that pass had just stored.
+    int num_render_passes = 0;
+    int num_render_pass_splits = 0;
+
+    // Time the GPU thread spent running the FIFO, and how much of that went into converting
+    // vertices and into flushing draws to the backend. Only measured while statistics are shown.
+    DT fifo_time{};
+    DT vertex_loading_time{};
+    DT draw_submission_time{};
+    // Time the texture cache spent hashing guest memory and decoding textures on the CPU.
+    // Also only measured while statistics are shown.
+    DT texture_hash_time{};
+    DT texture_decode_time{};
   };
   ThisFrame this_frame;
   void ResetFrame();
@@ -91,6 +153,28 @@ struct Statistics
 
 extern Statistics g_stats;
 
+// Adds the time spent in its scope to a statistic, if enabled.
+class ScopedStatisticTimer final
+{
+public:
+  ScopedStatisticTimer(DT& statistic, bool enabled)
+      : m_statistic(enabled ? &statistic : nullptr), m_start(enabled ? Clock::now() : TimePoint{})
+  {
+  }
+  ~ScopedStatisticTimer()
+  {
+    if (m_statistic)
+      *m_statistic += Clock::now() - m_start;
+  }
+
+  ScopedStatisticTimer(const ScopedStatisticTimer&) = delete;
+  ScopedStatisticTimer& operator=(const ScopedStatisticTimer&) = delete;
+
+private:
+  DT* m_statistic;
+  TimePoint m_start;
+};
+
 #define STATISTICS
 
 #ifdef STATISTICS
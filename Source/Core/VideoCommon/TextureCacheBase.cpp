@@ -8,6 +8,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #if defined(_M_X86_64)
@@ -20,7 +21,10 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/FrameTrace.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
@@ -43,6 +47,7 @@
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
@@ -61,8 +66,25 @@ static const u64 TEXHASH_INVALID = 0;
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
+// Async texture loading only applies to textures with at least this many texels in the base
+// level. Smaller textures decode quickly enough that a placeholder would just cause flicker.
+static constexpr u32 ASYNC_TEXTURE_LOAD_MIN_TEXELS = 256 * 256;
+
+// Palette conversions kept per texture. Enough for the palette animations games cycle through.
+static constexpr size_t MAX_PALETTE_CONVERSIONS_PER_TEXTURE = 8;
+
 static int xfb_count = 0;
 
+// Common::GetHash64, counting how much guest memory the texture cache reads to validate textures.
+static u64 HashTextureMemory(const u8* src, u32 len, u32 samples)
+{
+  INCSTAT(g_stats.this_frame.num_texture_hashes);
+  ADDSTAT(g_stats.this_frame.bytes_texture_hashed,
+          samples == 0 ? len : std::min(len, samples * u32(sizeof(u64))));
+  ScopedStatisticTimer timer(g_stats.this_frame.texture_hash_time, g_ActiveConfig.bOverlayStats);
+  return Common::GetHash64(src, len, samples);
+}
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -93,8 +115,8 @@ TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
 
-  m_temp_size = 2048 * 2048 * 4;
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  // m_temp is allocated by CheckTempSize on first use, and only as large as the biggest texture
+  // decoded on the CPU so far.
 
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
@@ -108,6 +130,13 @@ void TextureCacheBase::Shutdown()
 {
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
+  m_efb_copy_batches.clear();
+
+  // Drop async texture loads, the textures they're for are about to be invalidated anyway.
+  m_async_load_entries.clear();
+  for (auto& worker : m_async_load_workers)
+    worker->Shutdown(true);
+  m_async_load_workers.clear();
 
   HiresTexture::Shutdown();
 
@@ -141,6 +170,7 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_texture_sizes.clear();
 
   m_texture_pool.clear();
 }
@@ -231,6 +261,104 @@ void TextureCacheBase::Cleanup(int _frameCount)
       ++iter2;
     }
   }
+
+  EnforceMemoryBudget(_frameCount);
+}
+
+// Approximate amount of memory the backend needs for a texture, including all mip levels, layers
+// and samples. Scaled EFB copies are accounted at their scaled size.
+static u64 GetTextureMemorySize(const TextureConfig& config)
+{
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(config.format);
+  u64 size = 0;
+  for (u32 level = 0; level < config.levels; ++level)
+  {
+    const u32 width = std::max(config.width >> level, 1u);
+    const u32 height = std::max(config.height >> level, 1u);
+    size += u64{AbstractTexture::CalculateStrideForFormat(config.format, width)} *
+            ((height + block_size - 1) / block_size);
+  }
+  return size * config.layers * config.samples;
+}
+
+void TextureCacheBase::EnforceMemoryBudget(int frame_count)
+{
+  u64 budget = u64{g_ActiveConfig.iTextureCacheMemoryBudget} * 1024 * 1024;
+  if (budget == 0 && g_ActiveConfig.bLowMemory)
+    budget = LOW_MEMORY_TEXTURE_BUDGET;
+  if (budget == 0 && !g_ActiveConfig.bOverlayStats)
+    return;
+
+  const auto get_usage = [this] {
+    u64 total = 0;
+    for (const auto& [addr, entry] : m_textures_by_address)
+      total += GetTextureMemorySize(entry->texture->GetConfig());
+    for (const auto& [config, pool_entry] : m_texture_pool)
+      total += GetTextureMemorySize(config);
+    return total;
+  };
+  u64 usage = get_usage();
+
+  if (budget != 0 && usage > budget)
+  {
+    // Free pool textures first, they hold no data. Least recently released first; textures that
+    // were released this frame have FRAMECOUNT_INVALID, and were just evicted below.
+    const auto trim_pool = [&] {
+      std::vector<TexPool::iterator> pool_entries;
+      pool_entries.reserve(m_texture_pool.size());
+      for (auto iter = m_texture_pool.begin(); iter != m_texture_pool.end(); ++iter)
+        pool_entries.push_back(iter);
+      std::sort(pool_entries.begin(), pool_entries.end(), [](const auto& a, const auto& b) {
+        return a->second.frameCount < b->second.frameCount;
+      });
+      for (const TexPool::iterator& iter : pool_entries)
+      {
+        if (usage <= budget)
+          break;
+        usage -= GetTextureMemorySize(iter->first);
+        m_texture_pool.erase(iter);
+      }
+    };
+    trim_pool();
+
+    if (usage > budget)
+    {
+      // Then textures not used this frame, least recently used first. EFB copies are kept, as
+      // they can't be recreated from RAM.
+      std::vector<TexAddrCache::iterator> stale_entries;
+      for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
+      {
+        if (!iter->second->IsCopy() && iter->second->frameCount < frame_count)
+          stale_entries.push_back(iter);
+      }
+      std::sort(stale_entries.begin(), stale_entries.end(), [](const auto& a, const auto& b) {
+        return a->second->frameCount < b->second->frameCount;
+      });
+
+      u64 evicted = 0;
+      for (const TexAddrCache::iterator& iter : stale_entries)
+      {
+        if (usage - evicted <= budget)
+          break;
+        evicted += GetTextureMemorySize(iter->second->texture->GetConfig());
+        InvalidateTexture(iter);
+      }
+
+      // Invalidated textures go back to the pool, unless they are still bound.
+      usage = get_usage();
+      trim_pool();
+    }
+
+    if (usage > budget)
+    {
+      OSD::AddTypedMessage(OSD::MessageType::TextureMemoryBudget,
+                           fmt::format("Texture memory exceeds the budget: {} MB / {} MB",
+                                       usage / (1024 * 1024), budget / (1024 * 1024)),
+                           OSD::Duration::SHORT, OSD::Color::YELLOW);
+    }
+  }
+
+  SETSTAT(g_stats.texture_memory_usage_kb, usage / 1024);
 }
 
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -289,6 +417,19 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
 {
   DEBUG_ASSERT(g_ActiveConfig.backend_info.bSupportsPaletteConversion);
 
+  // Games that cycle palettes apply the same few of them to a texture over and over.
+  const u32 palette_size = entry->format == TextureFormat::I4 ? 32 : 512;
+  const u64 tlut_hash = Common::GetHash64(palette, palette_size, 0);
+  auto& conversions = entry->palette_conversions;
+  const auto cached = std::ranges::find_if(conversions, [&](const auto& conversion) {
+    return conversion.tlut_hash == tlut_hash && conversion.tlut_format == tlutfmt;
+  });
+  if (cached != conversions.end())
+  {
+    std::rotate(conversions.begin(), cached, cached + 1);
+    return conversions.front().entry;
+  }
+
   const AbstractPipeline* pipeline = g_shader_cache->GetPaletteConversionPipeline(tlutfmt);
   if (!pipeline)
   {
@@ -315,7 +456,6 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
 
   g_gfx->BeginUtilityDrawing();
 
-  const u32 palette_size = entry->format == TextureFormat::I4 ? 32 : 512;
   u32 texel_buffer_offset;
   if (g_vertex_manager->UploadTexelBuffer(palette, palette_size,
                                           TexelBufferFormat::TEXEL_BUFFER_FORMAT_R16_UINT,
@@ -341,6 +481,11 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->Draw(0, 3);
     g_gfx->EndUtilityDrawing();
     decoded_entry->texture->FinishedRendering();
+    INCSTAT(g_stats.this_frame.num_palette_conversions);
+
+    if (conversions.size() == MAX_PALETTE_CONVERSIONS_PER_TEXTURE)
+      conversions.pop_back();
+    conversions.insert(conversions.begin(), {tlut_hash, tlutfmt, decoded_entry});
   }
   else
   {
@@ -348,8 +493,6 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
-
   return decoded_entry;
 }
 
@@ -394,7 +537,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddTextureByAddress(reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -428,6 +571,7 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(RcTcacheEntry& entry, u32 new_wi
                       entry->texture.get(), entry->texture->GetConfig().GetRect());
   entry->texture.swap(new_texture->texture);
   entry->framebuffer.swap(new_texture->framebuffer);
+  entry->palette_conversions.clear();
 
   // At this point new_texture has the old texture in it,
   // we can potentially reuse this, so let's move it back to the pool
@@ -563,6 +707,7 @@ void TextureCacheBase::DoState(PointerWrap& p)
 {
   // Flush all pending XFB copies before either loading or saving.
   FlushEFBCopies();
+  WaitForAsyncTextureLoads();
 
   p.Do(m_last_entry_id);
 
@@ -748,7 +893,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddTextureByAddress(entry);
   }
 
   // Fill in hash map.
@@ -923,6 +1068,10 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
         u32 copy_height =
             std::min(entry->native_height - src_y, entry_to_update->native_height - dst_y);
 
+        // The decoded data would overwrite the partial update when it gets uploaded.
+        if (entry_to_update->async_load)
+          FinishAsyncTextureLoad(*entry_to_update, true);
+
         // If one of the textures is scaled, scale both with the current efb scaling factor
         if (entry_to_update->native_width != entry_to_update->GetWidth() ||
             entry_to_update->native_height != entry_to_update->GetHeight() ||
@@ -1081,12 +1230,21 @@ void TextureCacheBase::BindTextures(BitSet32 used_textures,
 {
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
+  UploadFinishedAsyncTextureLoads();
   for (u32 i = 0; i < m_bound_textures.size(); i++)
   {
     const RcTcacheEntry& tentry = m_bound_textures[i];
     if (used_textures[i] && tentry)
     {
-      g_gfx->SetTexture(i, tentry->texture.get());
+      if (!tentry->async_load)
+      {
+        g_gfx->SetTexture(i, tentry->texture.get());
+      }
+      else
+      {
+        g_gfx->SetTexture(i, m_async_load_placeholder_texture.get());
+        INCSTAT(g_stats.this_frame.num_textures_late);
+      }
       pixel_shader_manager.SetTexDims(i, tentry->native_width, tentry->native_height);
 
       auto& state = samplers[i];
@@ -1245,6 +1403,8 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
+  TRACE_SCOPE("TextureCache::Load");
+
   if (auto entry = LoadImpl(texture_info, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1300,7 +1460,7 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
 
     GraphicsModActionData::TextureLoad texture_load{entry->texture_info_name};
     for (const auto& action :
-         g_graphics_mod_manager->GetTextureLoadActions(entry->texture_info_name))
+         g_graphics_mod_manager->GetTextureLoadActions(entry->GetGraphicsModTarget()))
     {
       action->OnTextureLoad(&texture_load);
     }
@@ -1351,14 +1511,14 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+  base_hash = HashTextureMemory(texture_info.GetData(), texture_info.GetTextureSize(),
                                 textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
+        base_hash ^ HashTextureMemory(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
                                       textureCacheSafetyColorSampleSize);
   }
   else
@@ -1577,7 +1737,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   std::shared_ptr<HiresTexture> hires_texture;
   if (g_ActiveConfig.bHiresTextures)
   {
-    hires_texture = HiresTexture::Search(texture_info);
+    hires_texture = HiresTexture::Search(texture_info, full_hash);
     if (hires_texture)
     {
       auto asset = hires_texture->GetAsset();
@@ -1619,7 +1779,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     texture_name = texture_info.CalculateTextureName().GetFullName();
     GraphicsModActionData::TextureCreate texture_create{
         texture_name, width, height, &cached_game_assets, &additional_dependencies};
-    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(texture_name))
+    const u32 texture_target = g_graphics_mod_manager->GetTextureTargetId(texture_name);
+    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(texture_target))
     {
       action->OnTextureCreate(&texture_create);
     }
@@ -1723,109 +1884,141 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         g_ActiveConfig.UseGPUTextureDecoding() &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
-    ArbitraryMipmapDetector arbitrary_mip_detector;
-
-    // Initialized to null because only software loading uses this buffer
-    u8* dst_buffer = nullptr;
+    // Large textures which would be decoded on the CPU can be decoded on a worker thread
+    // instead. Texture dumping needs the decoded texture right away.
+    const bool async_load =
+        g_ActiveConfig.bAsyncTextureLoading && !decode_on_gpu && !texture_info.IsFromTmem() &&
+        !(g_ActiveConfig.bDumpTextures && !skip_texture_dump) &&
+        expanded_width * expanded_height >= ASYNC_TEXTURE_LOAD_MIN_TEXELS;
 
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    if (async_load)
     {
-      size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
-
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
+      QueueAsyncTextureLoad(entry, texture_info, texLevels);
+    }
+    else
+    {
+      ArbitraryMipmapDetector arbitrary_mip_detector;
 
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
+      // Initialized to null because only software loading uses this buffer
+      u8* dst_buffer = nullptr;
 
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+      if (!decode_on_gpu ||
+          !DecodeTextureOnGPU(
+              entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+              texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+              creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
+              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
-      }
+        size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
+        // Allocate memory for all levels at once
+        size_t total_texture_size = decoded_texture_size;
 
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
+        // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+        size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+        size_t prev_level_size = decoded_texture_size;
+        for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+        {
+          prev_level_size /= 4;
+          total_texture_size += prev_level_size;
+        }
 
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+        // Add space for the downsampling at the end
+        total_texture_size += mip_downsample_buffer_size;
 
-      dst_buffer += decoded_texture_size;
-    }
+        CheckTempSize(total_texture_size);
+        dst_buffer = m_temp;
+        INCSTAT(g_stats.this_frame.num_texture_levels_decoded_cpu);
+        {
+          ScopedStatisticTimer timer(g_stats.this_frame.texture_decode_time,
+                                     g_ActiveConfig.bOverlayStats);
+          if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 &&
+                texture_info.IsFromTmem()))
+          {
+            TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                              texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                              texture_info.GetTlutFormat());
+          }
+          else
+          {
+            TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
+                                           texture_info.GetTmemOddAddress(), expanded_width,
+                                           expanded_height);
+          }
+        }
 
-    for (u32 level = 1; level != texLevels; ++level)
-    {
-      auto mip_level = texture_info.GetMipMapLevel(level - 1);
-      if (!mip_level)
-        continue;
+        entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
 
-      if (!decode_on_gpu ||
-          !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
-                              texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
-                              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
-                              mip_level->GetExpandedHeight(),
-                              creation_info.bytes_per_block *
-                                  (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
-                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
-      {
-        // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
-        const u32 decoded_mip_size =
-            mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
-
-        dst_buffer += decoded_mip_size;
-      }
-    }
+        arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+        dst_buffer += decoded_texture_size;
+      }
 
-    if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
-    {
-      const std::string basename = texture_info.CalculateTextureName().GetFullName();
-      if (g_ActiveConfig.bDumpBaseTextures)
+      for (u32 level = 1; level != texLevels; ++level)
       {
-        m_texture_dumper.DumpTexture(*entry->texture, basename, 0, entry->has_arbitrary_mips);
+        auto mip_level = texture_info.GetMipMapLevel(level - 1);
+        if (!mip_level)
+          continue;
+
+        if (!decode_on_gpu ||
+            !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
+                                texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
+                                mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+                                mip_level->GetExpandedHeight(),
+                                creation_info.bytes_per_block *
+                                    (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+        {
+          // No need to call CheckTempSize here, as the whole buffer is preallocated at the
+          // beginning
+          const u32 decoded_mip_size =
+              mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
+          INCSTAT(g_stats.this_frame.num_texture_levels_decoded_cpu);
+          {
+            ScopedStatisticTimer timer(g_stats.this_frame.texture_decode_time,
+                                       g_ActiveConfig.bOverlayStats);
+            TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                              mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+          }
+          entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                               mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
+
+          arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                          mip_level->GetExpandedWidth(), dst_buffer);
+
+          dst_buffer += decoded_mip_size;
+        }
       }
-      if (g_ActiveConfig.bDumpMipmapTextures)
+
+      entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+
+      if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
       {
-        for (u32 level = 1; level < texLevels; ++level)
+        const std::string basename = texture_info.CalculateTextureName().GetFullName();
+        if (g_ActiveConfig.bDumpBaseTextures)
+        {
+          m_texture_dumper.DumpTexture(*entry->texture, basename, 0, entry->has_arbitrary_mips);
+        }
+        if (g_ActiveConfig.bDumpMipmapTextures)
         {
-          m_texture_dumper.DumpTexture(*entry->texture, basename, level, entry->has_arbitrary_mips);
+          for (u32 level = 1; level < texLevels; ++level)
+          {
+            m_texture_dumper.DumpTexture(*entry->texture, basename, level,
+                                         entry->has_arbitrary_mips);
+          }
         }
       }
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
+  const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
+                                         texture_info.GetTlutFormat());
+  entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
+                              full_format, false);
+
+  const auto iter = AddTextureByAddress(entry);
   if (safety_color_sample_size == 0 ||
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
@@ -1833,10 +2026,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
   }
 
-  const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
-                                         texture_info.GetTlutFormat());
-  entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
-                              full_format, false);
   entry->SetDimensions(texture_info.GetRawWidth(), texture_info.GetRawHeight(),
                        texture_info.GetLevelCount());
   entry->SetHashes(creation_info.base_hash, creation_info.full_hash);
@@ -1855,6 +2044,158 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+struct AsyncTextureLoad
+{
+  struct Level
+  {
+    u32 level;
+    u32 width;
+    u32 height;
+    u32 expanded_width;
+    u32 expanded_height;
+    size_t decoded_offset;
+    size_t decoded_size;
+    std::vector<u8> data;
+  };
+
+  TextureFormat format;
+  TLUTFormat tlut_format;
+  std::vector<u8> tlut;
+  std::vector<Level> levels;
+
+  // Decoded levels, followed by space for arbitrary mipmap detection. Written by the worker,
+  // and only read by the GPU thread once the decode is done.
+  std::vector<u8> decoded;
+  size_t decoded_levels_size = 0;
+  size_t downsample_buffer_size = 0;
+
+  Common::Flag done;
+  Common::Event done_event;
+};
+
+static void DecodeAsyncTextureLoad(AsyncTextureLoad& load)
+{
+  load.decoded.resize(load.decoded_levels_size + load.downsample_buffer_size);
+  for (const AsyncTextureLoad::Level& level : load.levels)
+  {
+    TexDecoder_Decode(load.decoded.data() + level.decoded_offset, level.data.data(),
+                      level.expanded_width, level.expanded_height, load.format, load.tlut.data(),
+                      load.tlut_format);
+  }
+
+  load.done.Set();
+  load.done_event.Set();
+}
+
+void TextureCacheBase::QueueAsyncTextureLoad(RcTcacheEntry& entry, const TextureInfo& texture_info,
+                                             u32 levels)
+{
+  if (m_async_load_workers.empty())
+  {
+    const u32 num_workers = std::clamp(std::thread::hardware_concurrency() / 4, 1u, 4u);
+    for (u32 i = 0; i < num_workers; ++i)
+    {
+      m_async_load_workers.push_back(std::make_unique<AsyncTextureLoadWorker>(
+          "Texture Decoder",
+          [](std::shared_ptr<AsyncTextureLoad> load) { DecodeAsyncTextureLoad(*load); }, true));
+    }
+  }
+
+  // Everything the worker reads is copied here, guest memory can change before it gets to run.
+  auto load = std::make_shared<AsyncTextureLoad>();
+  load->format = texture_info.GetTextureFormat();
+  load->tlut_format = texture_info.GetTlutFormat();
+  if (const std::optional<u32> palette_size = texture_info.GetPaletteSize())
+  {
+    load->tlut.assign(texture_info.GetTlutAddress(),
+                      texture_info.GetTlutAddress() + *palette_size);
+  }
+
+  const auto add_level = [&load](u32 level, const u8* data, u32 size, u32 width, u32 height,
+                                 u32 expanded_width, u32 expanded_height) {
+    const size_t decoded_size = expanded_width * sizeof(u32) * expanded_height;
+    load->levels.push_back({level, width, height, expanded_width, expanded_height,
+                            load->decoded_levels_size, decoded_size,
+                            std::vector<u8>(data, data + size)});
+    load->decoded_levels_size += decoded_size;
+  };
+
+  add_level(0, texture_info.GetData(), texture_info.GetTextureSize(), texture_info.GetRawWidth(),
+            texture_info.GetRawHeight(), texture_info.GetExpandedWidth(),
+            texture_info.GetExpandedHeight());
+  for (u32 level = 1; level != levels; ++level)
+  {
+    const auto* mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    add_level(level, mip_level->GetData(), mip_level->GetTextureSize(), mip_level->GetRawWidth(),
+              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+              mip_level->GetExpandedHeight());
+  }
+
+  // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+  load->downsample_buffer_size = load->levels[0].decoded_size * 5 / 16;
+
+  entry->async_load = load;
+  m_async_load_entries.push_back(entry);
+  SETSTAT(g_stats.num_textures_pending, static_cast<int>(m_async_load_entries.size()));
+
+  m_async_load_workers[m_next_async_load_worker]->Push(std::move(load));
+  m_next_async_load_worker = (m_next_async_load_worker + 1) % m_async_load_workers.size();
+}
+
+bool TextureCacheBase::FinishAsyncTextureLoad(TCacheEntry& entry, bool wait)
+{
+  AsyncTextureLoad& load = *entry.async_load;
+  if (!load.done.IsSet())
+  {
+    if (!wait)
+      return false;
+
+    load.done_event.Wait();
+  }
+
+  // The upload goes through the backend's usual texture upload path, e.g. the streaming buffer
+  // and init command buffer on Vulkan, so it is ordered before the next draw using the texture.
+  ArbitraryMipmapDetector arbitrary_mip_detector;
+  for (const AsyncTextureLoad::Level& level : load.levels)
+  {
+    const u8* decoded = load.decoded.data() + level.decoded_offset;
+    entry.texture->Load(level.level, level.width, level.height, level.expanded_width, decoded,
+                        level.decoded_size);
+    arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, decoded);
+  }
+  entry.has_arbitrary_mips =
+      arbitrary_mip_detector.HasArbitraryMipmaps(load.decoded.data() + load.decoded_levels_size);
+
+  entry.async_load.reset();
+  return true;
+}
+
+void TextureCacheBase::UploadFinishedAsyncTextureLoads()
+{
+  if (m_async_load_entries.empty())
+    return;
+
+  std::erase_if(m_async_load_entries, [this](const std::weak_ptr<TCacheEntry>& weak_entry) {
+    const RcTcacheEntry entry = weak_entry.lock();
+    return !entry || !entry->async_load || FinishAsyncTextureLoad(*entry, false);
+  });
+  SETSTAT(g_stats.num_textures_pending, static_cast<int>(m_async_load_entries.size()));
+}
+
+void TextureCacheBase::WaitForAsyncTextureLoads()
+{
+  for (const std::weak_ptr<TCacheEntry>& weak_entry : m_async_load_entries)
+  {
+    if (const RcTcacheEntry entry = weak_entry.lock(); entry && entry->async_load)
+      FinishAsyncTextureLoad(*entry, true);
+  }
+  m_async_load_entries.clear();
+  SETSTAT(g_stats.num_textures_pending, 0);
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -1925,7 +2266,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddTextureByAddress(entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -2351,6 +2692,11 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       !is_depth_copy &&
       (scaleByHalf || g_framebuffer_manager->GetEFBScale() != 1 || y_scale > 1.0f);
 
+  if (copy_to_vram)
+    INCSTAT(g_stats.this_frame.num_efb_copies_to_vram);
+  if (copy_to_ram)
+    INCSTAT(g_stats.this_frame.num_efb_copies_to_ram);
+
   RcTcacheEntry entry;
   if (copy_to_vram)
   {
@@ -2424,23 +2770,35 @@ void TextureCacheBase::CopyRenderTargetToTexture(
                          AllCopyFilterCoefsNeeded(coefficients),
                          CopyFilterCanOverflow(coefficients), gamma != 1.0);
 
-    std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
-    if (staging_texture)
+    // We can't defer if there is no VRAM copy (since we need to update the hash).
+    if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
     {
-      CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
-              scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
-
-      // We can't defer if there is no VRAM copy (since we need to update the hash).
-      if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
+      std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
+      if (staging_texture)
       {
+        CopyEFB(staging_texture.get(), 0, format, tex_w, bytes_per_row, num_blocks_y, dstStride,
+                srcRect, scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom,
+                coefficients);
+
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
-                          std::move(staging_texture));
+                          staging_texture.get(), 0);
+        ReleaseEFBCopyStagingTexture(std::move(staging_texture));
       }
-      else
+    }
+    else
+    {
+      u32 staging_row;
+      AbstractStagingTexture* staging_texture = AllocateDeferredEFBCopy(num_blocks_y, &staging_row);
+      if (staging_texture)
       {
+        CopyEFB(staging_texture, staging_row, format, tex_w, bytes_per_row, num_blocks_y,
+                dstStride, srcRect, scaleByHalf, linear_filter, y_scale, gamma, clamp_top,
+                clamp_bottom, coefficients);
+
         // Defer the flush until later.
-        entry->pending_efb_copy = std::move(staging_texture);
+        entry->pending_efb_copy = staging_texture;
+        entry->pending_efb_copy_row = staging_row;
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
         m_pending_efb_copies.push_back(entry);
@@ -2540,18 +2898,23 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddTextureByAddress(std::move(entry));
   }
 }
 
 void TextureCacheBase::FlushEFBCopies()
 {
-  if (m_pending_efb_copies.empty())
+  if (m_pending_efb_copies.empty() && m_efb_copy_batches.empty())
     return;
 
   for (auto& entry : m_pending_efb_copies)
     FlushEFBCopy(entry.get());
   m_pending_efb_copies.clear();
+
+  for (auto& staging_texture : m_efb_copy_batches)
+    ReleaseEFBCopyStagingTexture(std::move(staging_texture));
+  m_efb_copy_batches.clear();
+  m_efb_copy_batch_rows_used = 0;
 }
 
 void TextureCacheBase::FlushStaleBinds()
@@ -2564,11 +2927,11 @@ void TextureCacheBase::FlushStaleBinds()
 }
 
 void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
-                                         std::unique_ptr<AbstractStagingTexture> staging_texture)
+                                         AbstractStagingTexture* staging_texture, u32 staging_row)
 {
-  MathUtil::Rectangle<int> copy_rect(0, 0, static_cast<int>(width), static_cast<int>(height));
+  MathUtil::Rectangle<int> copy_rect(0, static_cast<int>(staging_row), static_cast<int>(width),
+                                     static_cast<int>(staging_row + height));
   staging_texture->ReadTexels(copy_rect, dst_ptr, stride);
-  ReleaseEFBCopyStagingTexture(std::move(staging_texture));
 }
 
 void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
@@ -2580,7 +2943,8 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   auto& memory = system.GetMemory();
   u8* const dst = memory.GetPointerForRange(entry->addr, covered_range);
   WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
-                    entry->memory_stride, std::move(entry->pending_efb_copy));
+                    entry->memory_stride, entry->pending_efb_copy, entry->pending_efb_copy_row);
+  entry->pending_efb_copy = nullptr;
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), we don't
   // need to do anything more. The entry will be automatically deleted by smart pointers
@@ -2628,6 +2992,24 @@ std::unique_ptr<AbstractStagingTexture> TextureCacheBase::GetEFBCopyStagingTextu
   return tex;
 }
 
+AbstractStagingTexture* TextureCacheBase::AllocateDeferredEFBCopy(u32 height, u32* row)
+{
+  if (m_efb_copy_batches.empty() ||
+      m_efb_copy_batch_rows_used + height > m_efb_copy_batches.back()->GetConfig().height)
+  {
+    std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
+    if (!staging_texture)
+      return nullptr;
+
+    m_efb_copy_batches.push_back(std::move(staging_texture));
+    m_efb_copy_batch_rows_used = 0;
+  }
+
+  *row = m_efb_copy_batch_rows_used;
+  m_efb_copy_batch_rows_used += height;
+  return m_efb_copy_batches.back().get();
+}
+
 void TextureCacheBase::ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex)
 {
   m_efb_copy_staging_texture_pool.push_back(std::move(tex));
@@ -2710,6 +3092,7 @@ TextureCacheBase::AllocateTexture(const TextureConfig& config)
   {
     auto entry = std::move(iter->second);
     m_texture_pool.erase(iter);
+    INCSTAT(g_stats.this_frame.num_texture_pool_reuses);
     return std::move(entry);
   }
 
@@ -2767,20 +3150,30 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddTextureByAddress(RcTcacheEntry entry)
+{
+  m_texture_sizes.insert(entry->size_in_bytes);
+  const u32 addr = entry->addr;
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
+  // which end after the given addr. But no texture in the cache is larger than the largest
+  // size we keep track of, so we look for all textures which have a start address bigger than
+  // addr minus that size. But this yields false-positives which must be checked later on.
+  // Games with thousands of small EFB copies would otherwise have to walk all the textures in
+  // front of addr for as far as the largest possible texture (1024 x 1024 texels times 8
+  // nibbles per texel).
+  const u32 max_texture_size = m_texture_sizes.empty() ? 0 : *m_texture_sizes.rbegin();
   u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
 
+  ADDSTAT(g_stats.this_frame.num_texture_overlap_candidates,
+          static_cast<int>(std::distance(begin, end)));
   return std::make_pair(begin, end);
 }
 
@@ -2813,7 +3206,8 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
       // existing pending copy, and not bother waiting for it in the future. This happens in
       // Xenoblade's sunset scene, where 35 copies are done per frame, and 25 of them are
       // copied to the same address, and can be skipped.
-      ReleaseEFBCopyStagingTexture(std::move(entry->pending_efb_copy));
+      // Its rows in the batch stay unused until the batch is flushed.
+      entry->pending_efb_copy = nullptr;
       auto pending_it = std::ranges::find(m_pending_efb_copies, entry);
       if (pending_it != m_pending_efb_copies.end())
         m_pending_efb_copies.erase(pending_it);
@@ -2827,6 +3221,13 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
     }
   }
   entry->invalidated = true;
+  for (auto& conversion : entry->palette_conversions)
+    conversion.entry->invalidated = true;
+  entry->palette_conversions.clear();
+
+  const auto size_iter = m_texture_sizes.find(entry->size_in_bytes);
+  ASSERT(size_iter != m_texture_sizes.end());
+  m_texture_sizes.erase(size_iter);
 
   return m_textures_by_address.erase(iter);
 }
@@ -2864,6 +3265,18 @@ bool TextureCacheBase::CreateUtilityTextures()
       return false;
   }
 
+  constexpr TextureConfig placeholder_texture_config(1, 1, 1, 1, 1, AbstractTextureFormat::RGBA8,
+                                                     0, AbstractTextureType::Texture_2DArray);
+  m_async_load_placeholder_texture =
+      g_gfx->CreateTexture(placeholder_texture_config, "Async texture load placeholder");
+  if (!m_async_load_placeholder_texture)
+    return false;
+
+  // Opaque grey, so textures that aren't ready yet neither disappear nor stand out too much.
+  constexpr u32 placeholder_texel = 0xFF808080;
+  m_async_load_placeholder_texture->Load(
+      0, 1, 1, 1, reinterpret_cast<const u8*>(&placeholder_texel), sizeof(placeholder_texel));
+
   return true;
 }
 
@@ -2943,9 +3356,10 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   entry->texture->FinishedRendering();
 }
 
-void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params,
-                               u32 native_width, u32 bytes_per_row, u32 num_blocks_y,
-                               u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
+void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, u32 dst_row,
+                               const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
+                               u32 num_blocks_y, u32 memory_stride,
+                               const MathUtil::Rectangle<int>& src_rect,
                                bool scale_by_half, bool linear_filter, float y_scale, float gamma,
                                bool clamp_top, bool clamp_bottom,
                                const std::array<u32, 3>& filter_coefficients)
@@ -3016,7 +3430,9 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
   g_gfx->SetSamplerState(0, linear_filter ? RenderState::GetLinearSamplerState() :
                                             RenderState::GetPointSamplerState());
   g_gfx->Draw(0, 3);
-  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, encode_rect);
+  const auto dst_rect =
+      MathUtil::Rectangle<int>(0, dst_row, render_width, dst_row + render_height);
+  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, dst_rect);
   g_gfx->EndUtilityDrawing();
 
   // Flush if there's sufficient draws between this copy and the last.
@@ -3079,10 +3495,14 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
 
   // Copy from decoding texture -> final texture
   // This is because we don't want to have to create compute view for every layer
+  // The decode stays in the same command stream as the draws. The destination usually comes from
+  // the texture pool, and earlier commands in the same command buffer may still read its old
+  // contents, so it can't be written from a queue that runs ahead of them.
   const auto copy_rect = entry->texture->GetConfig().GetMipRect(dst_level);
   entry->texture->CopyRectangleFromTexture(m_decoding_texture.get(), copy_rect, 0, 0, copy_rect, 0,
                                            dst_level);
   entry->texture->FinishedRendering();
+  INCSTAT(g_stats.this_frame.num_texture_levels_decoded_gpu);
   return true;
 }
 
@@ -3154,6 +3574,17 @@ int TCacheEntry::HashSampleSize() const
   return g_ActiveConfig.iSafeTextureCache_ColorSamples;
 }
 
+u32 TCacheEntry::GetGraphicsModTarget()
+{
+  const u32 generation = g_graphics_mod_manager->GetGeneration();
+  if (graphics_mod_generation != generation)
+  {
+    graphics_mod_target = g_graphics_mod_manager->GetTextureTargetId(texture_info_name);
+    graphics_mod_generation = generation;
+  }
+  return graphics_mod_target;
+}
+
 u64 TCacheEntry::CalculateHash() const
 {
   const u32 bytes_per_row = BytesPerRow();
@@ -3165,7 +3596,7 @@ u64 TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointerForRange(addr, size_in_bytes);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return HashTextureMemory(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3184,7 +3615,7 @@ u64 TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ HashTextureMemory(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -20,6 +21,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
@@ -33,6 +35,7 @@
 class AbstractFramebuffer;
 class AbstractStagingTexture;
 class PointerWrap;
+struct AsyncTextureLoad;
 struct SamplerState;
 struct VideoConfig;
 
@@ -160,12 +163,30 @@ struct TCacheEntry
   //   * partially updated textures which refer to this efb copy
   std::unordered_set<TCacheEntry*> references;
 
-  // Pending EFB copy
-  std::unique_ptr<AbstractStagingTexture> pending_efb_copy;
+  // Palette-converted versions of this texture, most recently used first. They aren't tracked by
+  // the cache maps, and are released along with this entry.
+  struct PaletteConversion
+  {
+    u64 tlut_hash;
+    TLUTFormat tlut_format;
+    std::shared_ptr<TCacheEntry> entry;
+  };
+  std::vector<PaletteConversion> palette_conversions;
+
+  // Pending EFB copy, stored at pending_efb_copy_row in one of the batched staging textures.
+  AbstractStagingTexture* pending_efb_copy = nullptr;
+  u32 pending_efb_copy_row = 0;
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
 
   std::string texture_info_name = "";
+  // The graphics mod target of texture_info_name, as of graphics_mod_generation.
+  u32 graphics_mod_target = 0;
+  u32 graphics_mod_generation = 0;
+
+  // Set while the texture is being decoded on a worker thread. The texture's contents are
+  // undefined until the decoded data has been uploaded, so a placeholder is bound instead.
+  std::shared_ptr<AsyncTextureLoad> async_load;
 
   std::vector<VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>> linked_game_texture_assets;
   std::vector<VideoCommon::CachedAsset<VideoCommon::CustomAsset>> linked_asset_dependencies;
@@ -229,6 +250,9 @@ struct TCacheEntry
 
   u64 CalculateHash() const;
 
+  // Looks texture_info_name up as a graphics mod target once each time the mods are loaded.
+  u32 GetGraphicsModTarget();
+
   int HashSampleSize() const;
   u32 GetWidth() const { return texture->GetConfig().width; }
   u32 GetHeight() const { return texture->GetConfig().height; }
@@ -273,6 +297,12 @@ public:
   // frameCount is the current frame number.
   void Cleanup(int _frameCount);
 
+  // Evicts pool textures, then textures not used this frame, least recently used first, until
+  // the texture memory fits in the configured budget. Low memory mode uses
+  // LOW_MEMORY_TEXTURE_BUDGET if no budget is configured.
+  void EnforceMemoryBudget(int frame_count);
+  static constexpr u64 LOW_MEMORY_TEXTURE_BUDGET = 256 * 1024 * 1024;
+
   void Invalidate();
   void ReleaseToPool(TCacheEntry* entry);
 
@@ -323,8 +353,9 @@ protected:
                           u32 aligned_height, u32 row_stride, const u8* palette,
                           TLUTFormat palette_format);
 
-  virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-                       u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+  // Encodes the copy into the rows of dst starting at dst_row.
+  virtual void CopyEFB(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+                       u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
                        const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
                        bool linear_filter, float y_scale, float gamma, bool clamp_top,
                        bool clamp_bottom, const std::array<u32, 3>& filter_coefficients);
@@ -369,11 +400,26 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // Copies the source data of a texture and queues its decode on a worker thread.
+  void QueueAsyncTextureLoad(RcTcacheEntry& entry, const TextureInfo& texture_info, u32 levels);
+
+  // Uploads the decoded data of an async texture load, waiting for the decode if requested.
+  // Returns false if the texture is still being decoded.
+  bool FinishAsyncTextureLoad(TCacheEntry& entry, bool wait);
+
+  // Uploads the async texture loads that have finished decoding.
+  void UploadFinishedAsyncTextureLoads();
+  void WaitForAsyncTextureLoads();
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Adds the entry to m_textures_by_address at its address. The size of the entry must be set
+  // beforehand, and must not change while it is in the cache.
+  TexAddrCache::iterator AddTextureByAddress(RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -394,12 +440,16 @@ private:
 
   // Flushes a pending EFB copy to RAM from the host to the guest RAM.
   void WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
-                         std::unique_ptr<AbstractStagingTexture> staging_texture);
+                         AbstractStagingTexture* staging_texture, u32 staging_row);
   void FlushEFBCopy(TCacheEntry* entry);
 
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
 
+  // Reserves space for a deferred EFB copy in the current batch, starting a new batch if it
+  // doesn't fit. Returns null if no staging texture could be created.
+  AbstractStagingTexture* AllocateDeferredEFBCopy(u32 height, u32* row);
+
   // Returns an EFB copy staging texture to the pool, so it can be re-used.
   void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
 
@@ -411,6 +461,10 @@ private:
   // but it's possible for invalidated TCache entries to live on elsewhere
   TexAddrCache m_textures_by_address;
 
+  // The sizes of all the textures in m_textures_by_address. Overlap queries only have to look this
+  // far in front of the queried range, rather than as far as the largest possible texture.
+  std::multiset<u32> m_texture_sizes;
+
   // m_textures_by_hash is an alternative view of the texture cache
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
@@ -448,9 +502,26 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Bound in place of textures which are still being decoded asynchronously.
+  std::unique_ptr<AbstractTexture> m_async_load_placeholder_texture;
+
+  // Workers decoding textures for async texture loading, started on first use. Each load is only
+  // referenced by its entry and its worker, so loads of textures that are invalidated in the
+  // meantime are simply dropped.
+  using AsyncTextureLoadWorker = Common::WorkQueueThread<std::shared_ptr<AsyncTextureLoad>>;
+  std::vector<std::unique_ptr<AsyncTextureLoadWorker>> m_async_load_workers;
+  size_t m_next_async_load_worker = 0;
+  std::vector<std::weak_ptr<TCacheEntry>> m_async_load_entries;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
+  // Staging textures holding the pending EFB copies. Deferred copies are stacked on top of each
+  // other in the same staging texture, so that flushing them is a single download instead of one
+  // per copy, and so that they don't each hold a staging texture of the maximum copy size.
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_batches;
+  u32 m_efb_copy_batch_rows_used = 0;
+
   // List of pending EFB copies. It is important that the order is preserved for these,
   // so that overlapping textures are written to guest RAM in the order they are issued.
   // It's valid for textures to live be in here after they've been invalidated
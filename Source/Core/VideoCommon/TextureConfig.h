@@ -19,6 +19,7 @@ enum class AbstractTextureFormat : u32
   DXT3,
   DXT5,
   BPTC,
+  ETC2,  // RGBA8 ETC2 with EAC alpha
   R16,
   D16,
   D24_S8,
@@ -837,7 +837,10 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
      {TEXEL_BUFFER_FORMAT_R32G32_UINT, 0, 64, 1, true,
       R"(
       // In the compute version of this decoder, we flatten the blocks to a one-dimension array.
-      // Each group is subdivided into 16, and the first thread in each group fetches the DXT data.
+      // Each group is subdivided into 16, one thread per texel of a DXT block. Every thread fetches
+      // the whole block itself: the 16 loads are from the same address, which the GPU serves with
+      // a single memory access, and that is cheaper than sharing the data through group shared
+      // memory and a barrier, especially on mobile GPUs.
       // All threads then calculate the possible colors for the block and write to the output image.
 
       #define GROUP_SIZE 64u
@@ -852,8 +855,6 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         return ((v1 * 3u + v2 * 5u) >> 3);
       }
 
-      GROUP_SHARED uint2 shared_temp[BLOCKS_PER_GROUP];
-
       DEFINE_MAIN(GROUP_SIZE, 1)
       {
         uint local_thread_id = gl_LocalInvocationID.x;
@@ -869,28 +870,19 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         block_coords.y = block_index / blocks_wide;
         block_coords.x = block_index - (block_coords.y * blocks_wide);
 
-        // Only the first thread for each block reads from the texel buffer.
-        if (thread_in_block == 0u)
-        {
-          // Calculate tiled block coordinates.
-          uint2 tile_block_coords = block_coords / 2u;
-          uint2 subtile_block_coords = block_coords % 2u;
-          uint buffer_pos = 0u;
-          buffer_pos += tile_block_coords.y * u_src_row_stride;
-          buffer_pos += tile_block_coords.x * 4u;
-          buffer_pos += subtile_block_coords.y * 2u;
-          buffer_pos += subtile_block_coords.x;
-
-          // Read the entire DXT block to shared memory.
-          uint2 raw_data = FETCH(buffer_pos);
-          shared_temp[block_in_group] = raw_data;
-        }
+        // Calculate tiled block coordinates.
+        uint2 tile_block_coords = block_coords / 2u;
+        uint2 subtile_block_coords = block_coords % 2u;
+        uint buffer_pos = 0u;
+        buffer_pos += tile_block_coords.y * u_src_row_stride;
+        buffer_pos += tile_block_coords.x * 4u;
+        buffer_pos += subtile_block_coords.y * 2u;
+        buffer_pos += subtile_block_coords.x;
 
-        // Ensure store is completed before the remaining threads in the block continue.
-        GROUP_MEMORY_BARRIER_WITH_SYNC;
+        // Read the entire DXT block.
+        uint2 raw_data = FETCH(buffer_pos);
 
         // Unpack colors and swap BE to LE.
-        uint2 raw_data = shared_temp[block_in_group];
         uint swapped = ((raw_data.x & 0xFF00FF00u) >> 8) | ((raw_data.x & 0x00FF00FFu) << 8);
         uint c1 = swapped & 0xFFFFu;
         uint c2 = swapped >> 16;
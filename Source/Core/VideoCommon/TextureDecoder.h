@@ -203,6 +203,10 @@ void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 str
 
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
 
-/* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
+/* Internal method, implemented by TextureDecoder_x64, TextureDecoder_ARM64, or
+ * TextureDecoder_Generic on other architectures. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt);
+/* Plain C++ decoder, built on all architectures. The optimized decoders must match its output. */
+void TexDecoder_DecodeImplGeneric(u32* dst, const u8* src, int width, int height,
+                                  TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
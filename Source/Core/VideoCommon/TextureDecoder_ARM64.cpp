@@ -0,0 +1,292 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecoder.h"
+
+#include <arm_neon.h>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder_Util.h"
+
+// NEON versions of the decoders for the common non-paletted formats. NEON is part of the ARMv8-A
+// baseline, so unlike the x64 decoder no runtime CPU check is needed. The output must be identical
+// to TexDecoder_DecodeImplGeneric, which handles all other formats.
+
+// Writes each of the 8 bytes of v as a whole RGBA pixel.
+static inline void StoreIntensity8(u32* dst, uint8x8_t v)
+{
+  vst4_u8(reinterpret_cast<u8*>(dst), uint8x8x4_t{{v, v, v, v}});
+}
+
+static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int height)
+{
+  const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+  const uint8x8_t expand = vdup_n_u8(0x11);  // Convert4To8
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8)
+    {
+      for (int iy = 0; iy < 8; iy++, src += 4)
+      {
+        u32 row;
+        std::memcpy(&row, src, sizeof(row));
+        const uint8x8_t v = vcreate_u8(row);
+        // High nibble first: i0 i1 i2 i3 ... from the 4 bytes.
+        const uint8x8_t i = vzip_u8(vshr_n_u8(v, 4), vand_u8(v, nibble_mask)).val[0];
+        StoreIntensity8(dst + (y + iy) * width + x, vmul_u8(i, expand));
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_I8(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0; x < width; x += 8)
+      for (int iy = 0; iy < 4; ++iy, src += 8)
+        StoreIntensity8(dst + (y + iy) * width + x, vld1_u8(src));
+}
+
+static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int height)
+{
+  const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+  const uint8x8_t expand = vdup_n_u8(0x11);  // Convert4To8
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8)
+    {
+      for (int iy = 0; iy < 4; iy++, src += 8)
+      {
+        const uint8x8_t v = vld1_u8(src);
+        const uint8x8_t a = vmul_u8(vshr_n_u8(v, 4), expand);
+        const uint8x8_t l = vmul_u8(vand_u8(v, nibble_mask), expand);
+        vst4_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), uint8x8x4_t{{l, l, l, a}});
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_IA8(u32* dst, const u8* src, int width, int height)
+{
+  // Each texel is an alpha byte followed by an intensity byte.
+  static constexpr u8 shuffle[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+  const uint8x16_t mask = vld1q_u8(shuffle);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4)
+    {
+      for (int iy = 0; iy < 4; iy++, src += 8)
+      {
+        const uint8x16_t v = vcombine_u8(vld1_u8(src), vdup_n_u8(0));
+        vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), vqtbl1q_u8(v, mask));
+      }
+    }
+  }
+}
+
+// Loads 4 big-endian 16-bit texels, zero-extended to 32 bits.
+static inline uint32x4_t Load4BE16(const u8* src)
+{
+  return vmovl_u16(vreinterpret_u16_u8(vrev16_u8(vld1_u8(src))));
+}
+
+static inline uint32x4_t Extract(uint32x4_t v, int shift, u32 mask)
+{
+  return vandq_u32(vshlq_u32(v, vdupq_n_s32(-shift)), vdupq_n_u32(mask));
+}
+
+static inline uint32x4_t Expand5To8(uint32x4_t v)
+{
+  return vorrq_u32(vshlq_n_u32(v, 3), vshrq_n_u32(v, 2));
+}
+
+static inline uint32x4_t PackRGBA(uint32x4_t r, uint32x4_t g, uint32x4_t b, uint32x4_t a)
+{
+  return vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)),
+                   vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24)));
+}
+
+static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int height)
+{
+  const uint32x4_t alpha = vdupq_n_u32(0xFF);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4)
+    {
+      for (int iy = 0; iy < 4; iy++, src += 8)
+      {
+        const uint32x4_t v = Load4BE16(src);
+        const uint32x4_t r = Expand5To8(Extract(v, 11, 0x1F));
+        const uint32x4_t g6 = Extract(v, 5, 0x3F);
+        const uint32x4_t g = vorrq_u32(vshlq_n_u32(g6, 2), vshrq_n_u32(g6, 4));
+        const uint32x4_t b = Expand5To8(Extract(v, 0, 0x1F));
+        vst1q_u32(dst + (y + iy) * width + x, PackRGBA(r, g, b, alpha));
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int height)
+{
+  const uint32x4_t opaque_alpha = vdupq_n_u32(0xFF);
+  const uint32x4_t expand4 = vdupq_n_u32(0x11);  // Convert4To8
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4)
+    {
+      for (int iy = 0; iy < 4; iy++, src += 8)
+      {
+        const uint32x4_t v = Load4BE16(src);
+
+        // RGB555
+        const uint32x4_t r5 = Expand5To8(Extract(v, 10, 0x1F));
+        const uint32x4_t g5 = Expand5To8(Extract(v, 5, 0x1F));
+        const uint32x4_t b5 = Expand5To8(Extract(v, 0, 0x1F));
+        const uint32x4_t opaque = PackRGBA(r5, g5, b5, opaque_alpha);
+
+        // RGB4A3
+        const uint32x4_t a3 = Extract(v, 12, 0x7);
+        const uint32x4_t a =
+            vorrq_u32(vorrq_u32(vshlq_n_u32(a3, 5), vshlq_n_u32(a3, 2)), vshrq_n_u32(a3, 1));
+        const uint32x4_t r4 = vmulq_u32(Extract(v, 8, 0xF), expand4);
+        const uint32x4_t g4 = vmulq_u32(Extract(v, 4, 0xF), expand4);
+        const uint32x4_t b4 = vmulq_u32(Extract(v, 0, 0xF), expand4);
+        const uint32x4_t translucent = PackRGBA(r4, g4, b4, a);
+
+        const uint32x4_t is_opaque = vtstq_u32(v, vdupq_n_u32(0x8000));
+        vst1q_u32(dst + (y + iy) * width + x, vbslq_u32(is_opaque, opaque, translucent));
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_RGBA8(u32* dst, const u8* src, int width, int height)
+{
+  // A block is 16 AR texels followed by the 16 GB texels. The shuffle takes one row (4 texels)
+  // of each: A0 R0 A1 R1 ... G0 B0 G1 B1 ...
+  static constexpr u8 shuffle[16] = {1, 8, 9, 0, 3, 10, 11, 2, 5, 12, 13, 4, 7, 14, 15, 6};
+  const uint8x16_t mask = vld1q_u8(shuffle);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 64)
+    {
+      for (int iy = 0; iy < 4; iy++)
+      {
+        const uint8x16_t v = vcombine_u8(vld1_u8(src + 8 * iy), vld1_u8(src + 32 + 8 * iy));
+        vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), vqtbl1q_u8(v, mask));
+      }
+    }
+  }
+}
+
+static inline void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  // Same palette as the generic decoder; only the texel lookup is vectorized.
+  const u16 c1 = Common::swap16(src->color1);
+  const u16 c2 = Common::swap16(src->color2);
+  const int blue1 = Convert5To8(c1 & 0x1F);
+  const int blue2 = Convert5To8(c2 & 0x1F);
+  const int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  const int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  const int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  const int red2 = Convert5To8((c2 >> 11) & 0x1F);
+  u32 colors[4];
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+  const uint8x16_t palette = vreinterpretq_u8_u32(vld1q_u32(colors));
+
+  // Spread the 2-bit selectors of the 4 lines into one byte per texel, leftmost texel in the
+  // high bits, and turn them into byte offsets into the palette.
+  static constexpr u8 spread[16] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  static constexpr s8 shifts[16] = {-6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0};
+  u32 lines;
+  std::memcpy(&lines, src->lines, sizeof(lines));
+  const uint8x16_t line_bytes = vqtbl1q_u8(vcombine_u8(vcreate_u8(lines), vdup_n_u8(0)),
+                                           vld1q_u8(spread));
+  const uint8x16_t selectors = vandq_u8(vshlq_u8(line_bytes, vld1q_s8(shifts)), vdupq_n_u8(3));
+  const uint8x16_t offsets = vshlq_n_u8(selectors, 2);
+
+  // For each row, spread the offsets of its 4 texels over the 4 channels.
+  static constexpr u8 channels[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  const uint8x16_t channel = vld1q_u8(channels);
+  const uint8x16_t row_spread = vld1q_u8(spread);
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t texel_offsets =
+        vqtbl1q_u8(offsets, vaddq_u8(row_spread, vdupq_n_u8(static_cast<u8>(y * 4))));
+    const uint8x16_t row = vqtbl1q_u8(palette, vaddq_u8(texel_offsets, channel));
+    vst1q_u8(reinterpret_cast<u8*>(dst), row);
+    dst += pitch;
+  }
+}
+
+static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8)
+    {
+      DecodeDXTBlock(dst + y * width + x, reinterpret_cast<const DXTBlock*>(src), width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + y * width + x + 4, reinterpret_cast<const DXTBlock*>(src), width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + (y + 4) * width + x, reinterpret_cast<const DXTBlock*>(src), width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + (y + 4) * width + x + 4, reinterpret_cast<const DXTBlock*>(src),
+                     width);
+      src += sizeof(DXTBlock);
+    }
+  }
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  switch (texformat)
+  {
+  case TextureFormat::I4:
+    TexDecoder_DecodeImpl_I4(dst, src, width, height);
+    break;
+  case TextureFormat::I8:
+    TexDecoder_DecodeImpl_I8(dst, src, width, height);
+    break;
+  case TextureFormat::IA4:
+    TexDecoder_DecodeImpl_IA4(dst, src, width, height);
+    break;
+  case TextureFormat::IA8:
+    TexDecoder_DecodeImpl_IA8(dst, src, width, height);
+    break;
+  case TextureFormat::RGB565:
+    TexDecoder_DecodeImpl_RGB565(dst, src, width, height);
+    break;
+  case TextureFormat::RGB5A3:
+    TexDecoder_DecodeImpl_RGB5A3(dst, src, width, height);
+    break;
+  case TextureFormat::RGBA8:
+    TexDecoder_DecodeImpl_RGBA8(dst, src, width, height);
+    break;
+  case TextureFormat::CMPR:
+    TexDecoder_DecodeImpl_CMPR(dst, src, width, height);
+    break;
+  default:
+    // Paletted formats are bound by the TLUT lookups.
+    TexDecoder_DecodeImplGeneric(dst, src, width, height, texformat, tlut, tlutfmt);
+    break;
+  }
+}
@@ -105,6 +105,7 @@ TextureInfo::TextureInfo(u32 stage, std::span<const u8> data, std::span<const u8
     // we limit the mipmap count to 6 there
     const u32 limited_mip_count =
         std::min<u32>(MathUtil::IntLog2(std::max(width, height)) + 1, raw_mip_count + 1) - 1;
+    DEBUG_ASSERT(limited_mip_count <= MAX_MIP_LEVELS);
 
     // load mips
     std::span<const u8> src_data = Common::SafeSubspan(data, GetTextureSize());
@@ -283,6 +284,11 @@ bool TextureInfo::HasMipMaps() const
   return !m_mip_levels.empty();
 }
 
+bool TextureInfo::AreMipmapsEnabled() const
+{
+  return m_mipmaps_enabled;
+}
+
 u32 TextureInfo::GetLevelCount() const
 {
   return static_cast<u32>(m_mip_levels.size()) + 1;
@@ -7,9 +7,9 @@
 #include <span>
 #include <string>
 #include <string_view>
-#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/SmallVector.h"
 
 enum class TextureFormat;
 enum class TLUTFormat;
@@ -64,6 +64,7 @@ public:
   class MipLevel
   {
   public:
+    MipLevel() = default;
     MipLevel(u32 level, const TextureInfo& parent, bool from_tmem, std::span<const u8>* src_data,
              std::span<const u8>* tmem_even, std::span<const u8>* tmem_odd);
 
@@ -79,20 +80,25 @@ public:
     u32 GetRawHeight() const;
 
   private:
-    bool m_data_valid;
+    bool m_data_valid = false;
 
-    const u8* m_ptr;
+    const u8* m_ptr = nullptr;
 
     u32 m_texture_size = 0;
 
-    u32 m_expanded_width;
-    u32 m_raw_width;
+    u32 m_expanded_width = 0;
+    u32 m_raw_width = 0;
 
-    u32 m_expanded_height;
-    u32 m_raw_height;
+    u32 m_expanded_height = 0;
+    u32 m_raw_height = 0;
   };
 
+  // Levels below the base level of a 1024x1024 texture, the largest size GX supports.
+  static constexpr u32 MAX_MIP_LEVELS = 10;
+
   bool HasMipMaps() const;
+  // Whether the game enabled mipmapping, even if the texture ends up with a single level.
+  bool AreMipmapsEnabled() const;
   u32 GetLevelCount() const;
   const MipLevel* GetMipMapLevel(u32 level) const;
   u32 GetFullLevelSize() const;
@@ -114,7 +120,8 @@ private:
   TLUTFormat m_tlut_format;
 
   bool m_mipmaps_enabled = false;
-  std::vector<MipLevel> m_mip_levels;
+  // Textures are looked up for every draw that changes them, so this avoids a heap allocation.
+  Common::SmallVector<MipLevel, MAX_MIP_LEVELS> m_mip_levels;
 
   u32 m_texture_size = 0;
   std::optional<u32> m_palette_size;
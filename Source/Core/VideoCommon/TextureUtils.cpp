@@ -7,6 +7,7 @@
 
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
@@ -74,7 +75,43 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
   if (file_existed)
     return;
 
-  texture.Save(fmt::format("{}/{}.png", dump_dir, name), level,
-               Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
+  PendingDump dump{.filename = fmt::format("{}/{}.png", dump_dir, name),
+                   .compression = Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL)};
+  if (!texture.Read(level, &dump.data, &dump.width, &dump.height))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read back texture {} for dumping", name);
+    return;
+  }
+
+  {
+    std::unique_lock lk(m_pending_lock);
+    m_pending_cv.wait(lk, [this] { return m_num_pending < MAX_PENDING_DUMPS; });
+    m_num_pending++;
+  }
+
+  if (!m_workers_started)
+  {
+    for (auto& worker : m_workers)
+    {
+      worker.Reset(
+          "Texture Dumper", [this](PendingDump queued) { SaveDump(std::move(queued)); }, true);
+    }
+    m_workers_started = true;
+  }
+
+  m_workers[m_next_worker].Push(std::move(dump));
+  m_next_worker = (m_next_worker + 1) % NUM_WORKERS;
+}
+
+void TextureDumper::SaveDump(PendingDump dump)
+{
+  Common::SavePNG(dump.filename, dump.data.data(), Common::ImageByteFormat::RGBA, dump.width,
+                  dump.height, dump.width * 4, dump.compression);
+
+  {
+    std::lock_guard lk(m_pending_lock);
+    m_num_pending--;
+  }
+  m_pending_cv.notify_one();
 }
 }  // namespace VideoCommon::TextureUtils
@@ -3,24 +3,56 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 class AbstractTexture;
 
 namespace VideoCommon::TextureUtils
 {
+// Reads the textures back on the calling thread, but encodes and writes them on a few worker
+// threads, so that dumping doesn't stall the GPU thread for every texture a game loads.
 class TextureDumper
 {
 public:
   // Only dumps if texture did not already exist anywhere within the dump-textures path.
+  // Waits for earlier dumps if too many of them are still queued.
   void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                    bool is_arbitrary);
 
 private:
+  struct PendingDump
+  {
+    std::string filename;
+    std::vector<u8> data;
+    u32 width = 0;
+    u32 height = 0;
+    int compression = 0;
+  };
+
+  static constexpr size_t NUM_WORKERS = 3;
+  // Bounds the memory the read back textures can take up while they wait to be encoded.
+  static constexpr size_t MAX_PENDING_DUMPS = 64;
+
+  void SaveDump(PendingDump dump);
+
   std::unordered_set<std::string> m_dumped_textures;
+
+  std::mutex m_pending_lock;
+  std::condition_variable m_pending_cv;
+  size_t m_num_pending = 0;
+  size_t m_next_worker = 0;
+  bool m_workers_started = false;
+
+  // Declared last, so that the queued dumps are finished before the rest is destroyed.
+  std::array<Common::WorkQueueThread<PendingDump>, NUM_WORKERS> m_workers;
 };
 
 void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
@@ -293,6 +293,24 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+void SpecializePixelShaderUid(PixelShaderUid* uid)
+{
+  pixel_ubershader_uid_data* const uid_data = uid->GetUidData();
+  uid_data->specialized = 1;
+  uid_data->num_tev_stages = bpmem.genMode.numtevstages;
+  uid_data->fog_enabled = bpmem.fog.c_proj_fsel.fsel != FogType::Off;
+  uid_data->alpha_test_passes = bpmem.alpha_test.TestResult() == AlphaTestResult::Pass;
+
+  // Stages can apply the indirect bias and wrapping without any indirect stages, so this has to
+  // check the stages themselves rather than numindstages.
+  uid_data->no_indirect = 1;
+  for (u32 stage = 0; stage <= bpmem.genMode.numtevstages; stage++)
+  {
+    if (bpmem.tevind[stage].hex != 0)
+      uid_data->no_indirect = 0;
+  }
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -876,8 +894,16 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  const bool specialized = uid_data->specialized != 0;
+  if (specialized)
+  {
+    out.Write("  uint num_stages = {}u;\n\n", uid_data->num_tev_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   bool has_custom_shader_details = false;
   if (std::any_of(custom_details.shaders.begin(), custom_details.shaders.end(),
@@ -979,9 +1005,10 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               1 << TwoTevStageOrders().enable_tex_even.StartBit());
     out.Write("\n"
               "    // Indirect textures\n"
-              "    uint tevind = bpmem_tevind(stage);\n"
-              "    if (tevind != 0u)\n"
-              "    {{\n"
+              "    uint tevind = {};\n"
+              "    if (tevind != 0u)\n",
+              specialized && uid_data->no_indirect ? "0u" : "bpmem_tevind(stage)");
+    out.Write("    {{\n"
               "      uint bs = {};\n",
               BitfieldExtract<&TevStageIndirect::bs>("tevind"));
     out.Write("      uint fmt = {};\n", BitfieldExtract<&TevStageIndirect::fmt>("tevind"));
@@ -1402,27 +1429,31 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
     out.Write("  #define discard_fragment discard\n");
   }
 
-  out.Write("  if (bpmem_alphaTest != 0u) {{\n"
-            "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
-            BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
-  out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
-            BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
-  out.Write("\n"
-            "    // These if statements are written weirdly to work around intel and Qualcomm "
-            "bugs with handling booleans.\n"
-            "    switch ({}) {{\n",
-            BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
-  out.Write("    case 0u: // AND\n"
-            "      if (comp0 && comp1) break; else discard_fragment; break;\n"
-            "    case 1u: // OR\n"
-            "      if (comp0 || comp1) break; else discard_fragment; break;\n"
-            "    case 2u: // XOR\n"
-            "      if (comp0 != comp1) break; else discard_fragment; break;\n"
-            "    case 3u: // XNOR\n"
-            "      if (comp0 == comp1) break; else discard_fragment; break;\n"
-            "    }}\n"
-            "  }}\n"
-            "\n");
+  // The uniform is zero when the alpha test always passes, so this can be left out then.
+  if (!specialized || !uid_data->alpha_test_passes)
+  {
+    out.Write("  if (bpmem_alphaTest != 0u) {{\n"
+              "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+              BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
+    out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
+              BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
+    out.Write("\n"
+              "    // These if statements are written weirdly to work around intel and Qualcomm "
+              "bugs with handling booleans.\n"
+              "    switch ({}) {{\n",
+              BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
+    out.Write("    case 0u: // AND\n"
+              "      if (comp0 && comp1) break; else discard_fragment; break;\n"
+              "    case 1u: // OR\n"
+              "      if (comp0 || comp1) break; else discard_fragment; break;\n"
+              "    case 2u: // XOR\n"
+              "      if (comp0 != comp1) break; else discard_fragment; break;\n"
+              "    case 3u: // XNOR\n"
+              "      if (comp0 == comp1) break; else discard_fragment; break;\n"
+              "    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  // Hardware testing indicates that an alpha of 1 can pass an alpha test,\n"
             "  // but doesn't do anything in blending\n"
@@ -1444,9 +1475,18 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  if (specialized && !uid_data->fog_enabled)
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {:s};\n",
+              FogType::Off);
+  }
+  else
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  }
   out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
   out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
             "    float ze;\n"
@@ -20,6 +20,15 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Set by SpecializePixelShaderUid. The fields below are GX state that rarely changes, which is
+  // then written into the shader as constants, so that the shader only contains the paths that
+  // state needs instead of branching on it per pixel.
+  u32 specialized : 1;
+  u32 num_tev_stages : 4;  // genMode.numtevstages, i.e. one less than the number of stages
+  u32 fog_enabled : 1;
+  u32 alpha_test_passes : 1;  // The alpha test always passes, so it doesn't need to be run
+  u32 no_indirect : 1;        // None of the TEV stages use indirect texturing
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -27,6 +36,7 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+void SpecializePixelShaderUid(PixelShaderUid* uid);
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data,
@@ -44,9 +54,17 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.specialized)
+    {
+      out = fmt::format_to(out, ", specialized for {} TEV stages{}{}{}", uid.num_tev_stages + 1,
+                           uid.fog_enabled ? ", fog" : "",
+                           uid.alpha_test_passes ? "" : ", alpha test",
+                           uid.no_indirect ? "" : ", indirect");
+    }
+    return out;
   }
 };
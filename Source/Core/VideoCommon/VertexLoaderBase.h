@@ -32,6 +32,32 @@ public:
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  // Raw words, used to store the UID in the per-game loader UID cache.
+  const std::array<u32, 5>& GetData() const { return vid; }
+  TVtxDesc GetVtxDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
+
+  static VertexLoaderUID FromData(const std::array<u32, 5>& data)
+  {
+    VertexLoaderUID uid;
+    uid.vid = data;
+    uid.hash = uid.CalculateHash();
+    return uid;
+  }
+
 private:
   size_t CalculateHash() const
   {
@@ -15,8 +15,11 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -53,6 +56,9 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Records every UID added to s_vertex_loader_map. Guarded by s_vertex_loader_map_lock.
+static File::IOFile s_loader_uid_cache_file;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -73,10 +79,99 @@ void Init()
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_loader_uid_cache_file.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+static void AppendLoaderUID(const VertexLoaderUID& uid)
+{
+  if (!s_loader_uid_cache_file.IsOpen())
+    return;
+
+  if (!s_loader_uid_cache_file.WriteBytes(uid.GetData().data(), sizeof(uid.GetData())))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_loader_uid_cache_file.Close();
+  }
+}
+
+static void AddCachedLoaderUID(const VertexLoaderUID& uid)
+{
+  auto [it, added] = s_vertex_loader_map.try_emplace(uid);
+  if (!added)
+    return;
+
+  it->second = VertexLoaderBase::CreateVertexLoader(uid.GetVtxDesc(), uid.GetVAT());
+  it->second->m_native_vertex_format = GetOrCreateMatchingFormat(it->second->m_native_vtx_decl);
+  INCSTAT(g_stats.num_vertex_loaders);
+}
+
+void LoadLoaderUIDCache()
+{
+  constexpr u32 CACHE_FILE_MAGIC = 0x44495556;  // VUID
+  constexpr u32 CACHE_FILE_VERSION = 1;
+  using SerializedUID = std::array<u32, 5>;
+  static_assert(sizeof(SerializedUID) == sizeof(VertexLoaderUID().GetData()));
+  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  const size_t num_loaders_before = s_vertex_loader_map.size();
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+  if (s_loader_uid_cache_file.Open(filename, "rb+"))
+  {
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid = false;
+    if (s_loader_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        s_loader_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == CACHE_FILE_MAGIC && existing_version == CACHE_FILE_VERSION)
+    {
+      // A size that isn't a whole number of UIDs means the file was truncated or corrupted.
+      const u64 file_size = s_loader_uid_cache_file.GetSize();
+      const size_t uid_count =
+          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedUID);
+      const size_t expected_size = uid_count * sizeof(SerializedUID) + CACHE_HEADER_SIZE;
+      uid_file_valid = file_size == expected_size;
+      for (size_t i = 0; uid_file_valid && i < uid_count; i++)
+      {
+        SerializedUID serialized_uid;
+        uid_file_valid = s_loader_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid));
+        if (uid_file_valid)
+          AddCachedLoaderUID(VertexLoaderUID::FromData(serialized_uid));
+      }
+
+      // We open the file for reading and writing, so we must seek to the end before writing.
+      if (uid_file_valid)
+        uid_file_valid = s_loader_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+    }
+
+    // If the file is invalid, close it. We re-open and truncate it below.
+    if (!uid_file_valid)
+      s_loader_uid_cache_file.Close();
+  }
+
+  if (!s_loader_uid_cache_file.IsOpen())
+  {
+    if (s_loader_uid_cache_file.Open(filename, "wb"))
+    {
+      s_loader_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+      s_loader_uid_cache_file.WriteBytes(&CACHE_FILE_VERSION, sizeof(CACHE_FILE_VERSION));
+
+      // Keep the loaders we already know about, in case the old file was only partially valid.
+      for (const auto& it : s_vertex_loader_map)
+        AppendLoaderUID(it.first);
+    }
+  }
+
+  INFO_LOG_FMT(VIDEO, "Precompiled {} vertex loaders from {}",
+               s_vertex_loader_map.size() - num_loaders_before, filename);
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -236,6 +331,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    AppendLoaderUID(uid);
   }
   if (check_for_native_format)
   {
@@ -392,6 +488,10 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
   }
 }
 
+// Vertices are always decoded on the CPU, even on backends that fetch vertex data from a storage
+// buffer in the shader (bSupportsDynamicVertexLoader). CPU culling, the zfreeze reference slope
+// and the cached normal/tangent/binormal values all need the decoded positions, so a path that
+// uploads raw guest data would still have to decode most of it here.
 template <bool IsPreprocess>
 int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
 {
@@ -408,6 +508,13 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     // Doing early return for the opposite case would be cleaner
     // but triggers a false unreachable code warning in MSVC debug builds.
 
+    // Only the size of the vertex data matters when nothing is drawn.
+    if (g_vertex_manager->IsSkippingDraws()) [[unlikely]]
+    {
+      ADDSTAT(g_stats.this_frame.num_skipped_prims, count);
+      return size;
+    }
+
     if (g_needs_cp_xf_consistency_check) [[unlikely]]
     {
       CheckCPConfiguration(vtx_attr_group);
@@ -422,6 +529,7 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
       s_current_vtx_fmt = loader->m_native_vertex_format;
       g_current_components = loader->m_native_components;
+      g_vertex_manager->SetShaderUidsChanged();
       auto& system = Core::System::GetInstance();
       auto& vertex_shader_manager = system.GetVertexShaderManager();
       vertex_shader_manager.SetVertexFormat(loader->m_native_components,
@@ -434,6 +542,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                         primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
                         !g_vertex_manager->HasSendableVertices();
 
+    const bool cpu_cull_triangles = g_ActiveConfig.bCPUCullTriangles &&
+                                    primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES;
+
     // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
     // They still need to go through vertex loading, because we need to calculate a zfreeze
     // reference slope.
@@ -449,7 +560,12 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      {
+        ScopedStatisticTimer timer(g_stats.this_frame.vertex_loading_time,
+                                   g_ActiveConfig.bOverlayStats);
+        num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      }
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
@@ -464,8 +580,14 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
         }
       }
 
-      g_vertex_manager->AddIndices(primitive, num_loaded);
-      g_vertex_manager->FlushData(num_loaded, stride);
+      // Draws that stay visible can still have their culled triangles removed, which shrinks the
+      // vertex and index data uploaded for them.
+      u32 num_drawn = num_loaded;
+      if (cpu_cull_triangles && !cullall && !can_cpu_cull)
+        num_drawn = g_vertex_manager->AddCulledIndices(loader, primitive, num_loaded, stride);
+      else
+        g_vertex_manager->AddIndices(primitive, num_loaded);
+      g_vertex_manager->FlushData(num_drawn, stride);
 
       ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
     } while (count);
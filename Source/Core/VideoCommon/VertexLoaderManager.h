@@ -28,6 +28,11 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Loads the list of vertex loader UIDs this game used in previous runs, creates those loaders
+// ahead of time, and keeps the file open to record new ones until Clear(). Must be called on the
+// GPU thread after the backend is initialized, since it also creates the native vertex formats.
+void LoadLoaderUIDCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
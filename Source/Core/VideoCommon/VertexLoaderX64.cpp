@@ -155,7 +155,7 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
     }
     else if (native_format == &m_native_vtx_decl.normals[2])
     {
-      CMP(32, R(remaining_reg), R(remaining_reg));
+      TEST(32, R(remaining_reg), R(remaining_reg));
       FixupBranch dont_store = J_CC(CC_NZ);
       // For similar reasons, the cached tangent and binormal are 4 floats each
       MOVUPS(MPIC(VertexLoaderManager::binormal_cache.data()), coords);
@@ -272,6 +272,7 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
       }
 
       write_zfreeze();
+      return;
     }
   }
 
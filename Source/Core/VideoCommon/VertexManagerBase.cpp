@@ -3,13 +3,16 @@
 
 #include "VideoCommon/VertexManagerBase.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FrameTrace.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
@@ -115,6 +118,22 @@ VertexManagerBase::VertexManagerBase()
 
 VertexManagerBase::~VertexManagerBase() = default;
 
+u32 VertexManagerBase::GetVertexStreamBufferSize()
+{
+  static_assert(VERTEX_STREAM_BUFFER_SIZE / 2 > MAXVBUFFERSIZE);
+  return g_ActiveConfig.bLowMemory ? VERTEX_STREAM_BUFFER_SIZE / 2 : VERTEX_STREAM_BUFFER_SIZE;
+}
+
+u32 VertexManagerBase::GetIndexStreamBufferSize()
+{
+  return g_ActiveConfig.bLowMemory ? INDEX_STREAM_BUFFER_SIZE / 2 : INDEX_STREAM_BUFFER_SIZE;
+}
+
+u32 VertexManagerBase::GetUniformStreamBufferSize()
+{
+  return g_ActiveConfig.bLowMemory ? UNIFORM_STREAM_BUFFER_SIZE / 4 : UNIFORM_STREAM_BUFFER_SIZE;
+}
+
 bool VertexManagerBase::Initialize()
 {
   m_frame_end_event =
@@ -145,6 +164,70 @@ bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
   return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
 }
 
+static u32 GetNumTriangles(OpcodeDecoder::Primitive primitive, u32 count)
+{
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_QUADS:
+  case Primitive::GX_DRAW_QUADS_2:
+    return count / 4 * 2 + (count % 4 == 3);
+  case Primitive::GX_DRAW_TRIANGLES:
+    return count / 3;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+    return count > 2 ? count - 2 : 0;
+  default:
+    return 0;
+  }
+}
+
+u32 VertexManagerBase::AddCulledIndices(VertexLoaderBase* loader,
+                                        OpcodeDecoder::Primitive primitive, u32 count, u32 stride)
+{
+  m_culled_indices.resize(static_cast<size_t>(count) * 3);
+  const u32 num_indices = m_cpu_cull.CullTriangles(loader, primitive, m_cur_buffer_pointer, count,
+                                                   m_culled_indices.data());
+
+  // A triangle list can take more indices than the primitive would have. If it doesn't fit, draw
+  // everything, as PrepareForAdditionalData has only made room for the primitive's own indices.
+  const u32 index_len = MAXIBUFFERSIZE - m_index_generator.GetIndexLen();
+  if (m_index_generator.GetTriangleListLength(num_indices) > index_len)
+  {
+    m_index_generator.AddIndices(primitive, count);
+    return count;
+  }
+
+  // The last three vertices are always kept, as the z slope for zfreeze is taken from them.
+  static constexpr u16 UNUSED = UINT16_MAX;
+  m_culled_vertex_remap.assign(count, UNUSED);
+  for (u32 i = 0; i < num_indices; ++i)
+    m_culled_vertex_remap[m_culled_indices[i]] = 0;
+  for (u32 i = count - std::min(count, 3u); i < count; ++i)
+    m_culled_vertex_remap[i] = 0;
+
+  u32 num_kept = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    if (m_culled_vertex_remap[i] == UNUSED)
+      continue;
+    if (num_kept != i)
+    {
+      std::memcpy(m_cur_buffer_pointer + num_kept * stride, m_cur_buffer_pointer + i * stride,
+                  stride);
+    }
+    m_culled_vertex_remap[i] = static_cast<u16>(num_kept++);
+  }
+  for (u32 i = 0; i < num_indices; ++i)
+    m_culled_indices[i] = m_culled_vertex_remap[m_culled_indices[i]];
+
+  m_index_generator.AddTriangles(m_culled_indices.data(), num_indices, num_kept);
+
+  ADDSTAT(g_stats.this_frame.num_cpu_culled_triangles,
+          GetNumTriangles(primitive, count) - num_indices / 3);
+  ADDSTAT(g_stats.this_frame.bytes_cpu_culled_vertices, (count - num_kept) * stride);
+  return num_kept;
+}
+
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
                                                        u32 count, u32 stride, bool cullall)
 {
@@ -165,6 +248,7 @@ DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive
     // Have to update the rasterization state for point/line cull modes.
     m_current_primitive_type = new_primitive_type;
     SetRasterizationStateChanged();
+    SetShaderUidsChanged();
   }
 
   u32 remaining_indices = GetRemainingIndices(primitive);
@@ -437,8 +521,13 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  TRACE_SCOPE("VertexManager::Flush");
+
   m_is_flushed = true;
 
+  ScopedStatisticTimer timer(g_stats.this_frame.draw_submission_time,
+                             g_ActiveConfig.bOverlayStats);
+
   if (m_draw_counter == 0)
   {
     // This is more or less the start of the Frame
@@ -561,7 +650,9 @@ void VertexManagerBase::Flush()
   CalculateNormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
+  // With graphics mods, the textures with distinct names, and their graphics mod targets.
+  Common::SmallVector<const TCacheEntry*, 8> named_textures;
+  Common::SmallVector<u32, 8> texture_targets;
   Common::SmallVector<u32, 8> texture_units;
   std::array<SamplerState, 8> samplers;
   if (!m_cull_all)
@@ -585,11 +676,13 @@ void VertexManagerBase::Flush()
         const auto cache_entry = g_texture_cache->Load(TextureInfo::FromStage(i));
         if (cache_entry)
         {
-          if (std::find(texture_names.begin(), texture_names.end(),
-                        cache_entry->texture_info_name) == texture_names.end())
+          if (std::none_of(named_textures.begin(), named_textures.end(), [&](const auto& entry) {
+                return entry->texture_info_name == cache_entry->texture_info_name;
+              }))
           {
-            texture_names.push_back(cache_entry->texture_info_name);
+            texture_targets.push_back(cache_entry->GetGraphicsModTarget());
             texture_units.push_back(i);
+            named_textures.push_back(cache_entry);
           }
 
           const float custom_tex_scale = cache_entry->GetWidth() / float(cache_entry->native_width);
@@ -599,7 +692,7 @@ void VertexManagerBase::Flush()
       }
     }
   }
-  vertex_shader_manager.SetConstants(texture_names, xf_state_manager);
+  vertex_shader_manager.SetConstants(texture_targets, xf_state_manager);
   if (!bpmem.genMode.zfreeze)
   {
     // Must be done after VertexShaderManager::SetConstants()
@@ -615,22 +708,24 @@ void VertexManagerBase::Flush()
   {
     CustomPixelShaderContents custom_pixel_shader_contents;
     std::optional<CustomPixelShader> custom_pixel_shader;
-    std::vector<std::string> custom_pixel_texture_names;
     std::span<u8> custom_pixel_shader_uniforms;
     bool skip = false;
-    for (size_t i = 0; i < texture_names.size(); i++)
+    if (!texture_targets.empty() && g_graphics_mod_manager->HasDrawStartedActions())
     {
-      GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
-                                                      &custom_pixel_shader_uniforms};
-      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
+      for (const u32 texture_target : texture_targets)
       {
-        action->OnDrawStarted(&draw_started);
-        if (custom_pixel_shader)
+        if (texture_target == GraphicsModManager::NO_TARGET)
+          continue;
+
+        GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
+                                                        &custom_pixel_shader_uniforms};
+        for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_target))
         {
-          custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
-          custom_pixel_texture_names.push_back(texture_names[i]);
+          action->OnDrawStarted(&draw_started);
+          if (custom_pixel_shader)
+            custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
+          custom_pixel_shader = std::nullopt;
         }
-        custom_pixel_shader = std::nullopt;
       }
     }
 
@@ -696,6 +791,7 @@ void VertexManagerBase::DoState(PointerWrap& p)
   {
     // Flush old vertex data before loading state.
     Flush();
+    SetShaderUidsChanged();
   }
 
   p.Do(m_zslope);
@@ -818,28 +914,36 @@ void VertexManagerBase::UpdatePipelineConfig()
     m_pipeline_config_changed = true;
   }
 
-  VertexShaderUid vs_uid = GetVertexShaderUid();
-  if (vs_uid != m_current_pipeline_config.vs_uid)
+  // Generating the UIDs walks the whole TEV and texgen setup, so it is skipped for the common case
+  // of consecutive draws that only change vertex data or constants.
+  if (m_shader_uids_changed)
   {
-    m_current_pipeline_config.vs_uid = vs_uid;
-    m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
-    m_pipeline_config_changed = true;
-  }
+    m_shader_uids_changed = false;
+    INCSTAT(g_stats.this_frame.num_shader_uid_updates);
 
-  PixelShaderUid ps_uid = GetPixelShaderUid();
-  if (ps_uid != m_current_pipeline_config.ps_uid)
-  {
-    m_current_pipeline_config.ps_uid = ps_uid;
-    m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
-    m_pipeline_config_changed = true;
-  }
+    VertexShaderUid vs_uid = GetVertexShaderUid();
+    if (vs_uid != m_current_pipeline_config.vs_uid)
+    {
+      m_current_pipeline_config.vs_uid = vs_uid;
+      m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
+      m_pipeline_config_changed = true;
+    }
 
-  GeometryShaderUid gs_uid = GetGeometryShaderUid(GetCurrentPrimitiveType());
-  if (gs_uid != m_current_pipeline_config.gs_uid)
-  {
-    m_current_pipeline_config.gs_uid = gs_uid;
-    m_current_uber_pipeline_config.gs_uid = gs_uid;
-    m_pipeline_config_changed = true;
+    PixelShaderUid ps_uid = GetPixelShaderUid();
+    if (ps_uid != m_current_pipeline_config.ps_uid)
+    {
+      m_current_pipeline_config.ps_uid = ps_uid;
+      m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
+      m_pipeline_config_changed = true;
+    }
+
+    GeometryShaderUid gs_uid = GetGeometryShaderUid(GetCurrentPrimitiveType());
+    if (gs_uid != m_current_pipeline_config.gs_uid)
+    {
+      m_current_pipeline_config.gs_uid = gs_uid;
+      m_current_uber_pipeline_config.gs_uid = gs_uid;
+      m_pipeline_config_changed = true;
+    }
   }
 
   if (m_rasterization_state_changed)
@@ -905,8 +1009,7 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::SynchronousUberShaders:
   {
     // Exclusive ubershader mode, always use ubershaders.
-    m_current_pipeline_object =
-        g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+    m_current_pipeline_object = GetUberPipelineObject();
   }
   break;
 
@@ -925,8 +1028,7 @@ void VertexManagerBase::UpdatePipelineObject()
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
       // Specialized shaders not ready, use the ubershaders.
-      m_current_pipeline_object =
-          g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_object = GetUberPipelineObject();
     }
     else
     {
@@ -939,6 +1041,25 @@ void VertexManagerBase::UpdatePipelineObject()
   }
 }
 
+const AbstractPipeline* VertexManagerBase::GetUberPipelineObject()
+{
+  if (g_ActiveConfig.bSpecializeUberShaders)
+  {
+    VideoCommon::GXUberPipelineUid specialized_config = m_current_uber_pipeline_config;
+    UberShader::SpecializePixelShaderUid(&specialized_config.ps_uid);
+    auto res = g_shader_cache->GetUberPipelineForUidAsync(specialized_config);
+    if (res && *res)
+      return *res;
+
+    // Keep using the generic ubershaders until the specialized ones are ready, and try again
+    // next draw, as with specialized shaders.
+    if (!res)
+      m_pipeline_config_changed = true;
+  }
+
+  return g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+}
+
 void VertexManagerBase::OnConfigChange()
 {
   // Reload index generator function tables in case VS expand config changed
@@ -1084,6 +1205,11 @@ void VertexManagerBase::RenderDrawCall(
   UploadUniforms();
 
   g_gfx->SetPipeline(current_pipeline);
+  if (g_ActiveConfig.backend_info.bSupportsDynamicDepthAndCullState)
+  {
+    g_gfx->SetDynamicDepthAndCullState(m_current_pipeline_config.depth_state,
+                                       m_current_pipeline_config.rasterization_state.cullmode);
+  }
 
   u32 base_vertex, base_index;
   CommitBuffer(m_index_generator.GetNumVerts(),
@@ -101,6 +101,12 @@ public:
   static constexpr u32 UNIFORM_STREAM_BUFFER_SIZE = 64 * 1024 * 1024;
   static constexpr u32 TEXEL_STREAM_BUFFER_SIZE = 16 * 1024 * 1024;
 
+  // The sizes above the backends should create their buffers with. Smaller in low memory mode,
+  // but the vertex buffer still has room for a full MAXVBUFFERSIZE reservation.
+  static u32 GetVertexStreamBufferSize();
+  static u32 GetIndexStreamBufferSize();
+  static u32 GetUniformStreamBufferSize();
+
   VertexManagerBase();
   virtual ~VertexManagerBase();
 
@@ -110,6 +116,11 @@ public:
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  /// Removes the triangles CPUCull rejects from the vertices just loaded to the current buffer,
+  /// and moves the vertices still used to the front. Adds the indices of the remaining triangles
+  /// and returns the number of vertices left.
+  u32 AddCulledIndices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, u32 count,
+                       u32 stride);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -120,6 +131,7 @@ public:
 
   void Flush();
   bool HasSendableVertices() const { return !m_is_flushed && !m_cull_all; }
+  bool IsSkippingDraws() const { return m_skip_draws; }
 
   void DoState(PointerWrap& p);
 
@@ -129,10 +141,13 @@ public:
   void SetRasterizationStateChanged() { m_rasterization_state_changed = true; }
   void SetDepthStateChanged() { m_depth_state_changed = true; }
   void SetBlendingStateChanged() { m_blending_state_changed = true; }
+  // Any BP, XF or vertex format change can alter the shader UIDs.
+  void SetShaderUidsChanged() { m_shader_uids_changed = true; }
   void InvalidatePipelineObject()
   {
     m_current_pipeline_object = nullptr;
     m_pipeline_config_changed = true;
+    m_shader_uids_changed = true;
   }
   void NotifyCustomShaderCacheOfHostChange(const ShaderHostConfig& host_config);
 
@@ -175,7 +190,9 @@ protected:
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
   static void InvalidateConstants();
 
-  // Prepares the buffer for the next batch of vertices.
+  // Prepares the buffer for the next batch of vertices. Backends with a mapped stream buffer point
+  // the buffer pointers and index generator straight at it, so the vertex loaders write into GPU
+  // visible memory and CommitBuffer() only has to advance the stream buffer.
   virtual void ResetBuffer(u32 vertex_stride);
 
   // Commits/uploads the current batch of vertices.
@@ -200,6 +217,10 @@ protected:
   u8* m_base_buffer_pointer = nullptr;
   u8* m_end_buffer_pointer = nullptr;
 
+  // Set by backends whose draws have no observable effect, so that primitives are skipped before
+  // vertex loading, and no pipeline state or textures are ever prepared for them.
+  bool m_skip_draws = false;
+
   // Alternative buffers in CPU memory for primitives we are going to discard.
   std::vector<u8> m_cpu_vertex_buffer;
   std::vector<u16> m_cpu_index_buffer;
@@ -214,10 +235,13 @@ protected:
   bool m_rasterization_state_changed = true;
   bool m_depth_state_changed = true;
   bool m_blending_state_changed = true;
+  bool m_shader_uids_changed = true;
   bool m_cull_all = false;
 
   IndexGenerator m_index_generator;
   CPUCull m_cpu_cull;
+  std::vector<u16> m_culled_indices;
+  std::vector<u16> m_culled_vertex_remap;
 
 private:
   // Minimum number of draws per command buffer when attempting to preempt a readback operation.
@@ -230,6 +254,7 @@ private:
                       const AbstractPipeline* current_pipeline);
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
+  const AbstractPipeline* GetUberPipelineObject();
 
   const AbstractPipeline*
   GetCustomPipeline(const CustomPixelShaderContents& custom_pixel_shader_contents,
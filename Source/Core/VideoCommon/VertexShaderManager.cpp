@@ -164,7 +164,7 @@ bool VertexShaderManager::UseVertexDepthRange()
 
 // Syncs the shader constant buffers with xfmem
 // TODO: A cleaner way to control the matrices without making a mess in the parameters field
-void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
+void VertexShaderManager::SetConstants(std::span<const u32> texture_targets,
                                        XFStateManager& xf_state_manager)
 {
   if (constants.missing_color_hex != g_ActiveConfig.iMissingColorValue)
@@ -185,9 +185,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   {
     int startn = per_vertex_transform_matrix_changes[0] / 4;
     int endn = (per_vertex_transform_matrix_changes[1] + 3) / 4;
-    memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    UpdateConstants(&dirty, constants.transformmatrices[startn].data(),
+                    &xfmem.posMatrices[startn * 4], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPerVertexTransformMatrixChanges();
   }
 
@@ -199,9 +198,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     int endn = (per_vertex_normal_matrices_changed[1] + 2) / 3;
     for (int i = startn; i < endn; i++)
     {
-      memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
+      UpdateConstants(&dirty, constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i],
+                      12);
     }
-    dirty = true;
     xf_state_manager.ResetPerVertexNormalMatrixChanges();
   }
 
@@ -210,9 +209,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   {
     int startn = post_transform_matrices_changed[0] / 4;
     int endn = (post_transform_matrices_changed[1] + 3) / 4;
-    memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    UpdateConstants(&dirty, constants.posttransformmatrices[startn].data(),
+                    &xfmem.postMatrices[startn * 4], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPostTransformMatrixChanges();
   }
 
@@ -227,7 +225,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     for (int i = istart; i < iend; ++i)
     {
       const Light& light = xfmem.lights[i];
-      VertexShaderConstants::Light& dstlight = constants.lights[i];
+      VertexShaderConstants::Light dstlight = constants.lights[i];
 
       // xfmem.light.color is packed as abgr in u8[4], so we have to swap the order
       dstlight.color[0] = light.color[3];
@@ -272,8 +270,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       dstlight.dir[0] = sanitize(static_cast<float>(light.ddir[0] * norm));
       dstlight.dir[1] = sanitize(static_cast<float>(light.ddir[1] * norm));
       dstlight.dir[2] = sanitize(static_cast<float>(light.ddir[2] * norm));
+
+      UpdateConstants(&dirty, &constants.lights[i], &dstlight, sizeof(dstlight));
     }
-    dirty = true;
 
     xf_state_manager.ResetLightsChanged();
   }
@@ -281,11 +280,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   for (int i : xf_state_manager.GetMaterialChanges())
   {
     u32 data = i >= 2 ? xfmem.matColor[i - 2] : xfmem.ambColor[i];
-    constants.materials[i][0] = (data >> 24) & 0xFF;
-    constants.materials[i][1] = (data >> 16) & 0xFF;
-    constants.materials[i][2] = (data >> 8) & 0xFF;
-    constants.materials[i][3] = data & 0xFF;
-    dirty = true;
+    const int4 material = {static_cast<int>((data >> 24) & 0xFF),
+                           static_cast<int>((data >> 16) & 0xFF),
+                           static_cast<int>((data >> 8) & 0xFF), static_cast<int>(data & 0xFF)};
+    UpdateConstants(&dirty, constants.materials[i].data(), material.data(), sizeof(material));
   }
   xf_state_manager.ResetMaterialChanges();
 
@@ -296,11 +294,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    UpdateConstants(&dirty, constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+    UpdateConstants(&dirty, constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+    UpdateConstants(&dirty, constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+    UpdateConstants(&dirty, constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
   }
 
   if (xf_state_manager.DidTexMatrixAChange())
@@ -315,9 +312,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateConstants(&dirty, constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i],
+                      3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidTexMatrixBChange())
@@ -332,9 +329,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateConstants(&dirty, constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                      3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidViewportChange())
@@ -396,17 +393,17 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   }
 
   std::vector<GraphicsModAction*> projection_actions;
-  if (g_ActiveConfig.bGraphicMods)
+  if (g_ActiveConfig.bGraphicMods && g_graphics_mod_manager->HasProjectionActions())
   {
     for (const auto& action : g_graphics_mod_manager->GetProjectionActions(xfmem.projection.type))
     {
       projection_actions.push_back(action);
     }
 
-    for (const auto& texture : textures)
+    for (const u32 texture_target : texture_targets)
     {
-      for (const auto& action :
-           g_graphics_mod_manager->GetProjectionTextureActions(xfmem.projection.type, texture))
+      for (const auto& action : g_graphics_mod_manager->GetProjectionTextureActions(
+               xfmem.projection.type, texture_target))
       {
         projection_actions.push_back(action);
       }
@@ -427,8 +424,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       action->OnProjection(&projection);
     }
 
-    memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
-    dirty = true;
+    UpdateConstants(&dirty, constants.projection.data(), corrected_matrix.data.data(),
+                    4 * sizeof(float4));
   }
 
   if (xf_state_manager.DidTexMatrixInfoChange())
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <cstring>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -26,7 +28,8 @@ public:
 
   // constant management
   void SetProjectionMatrix(XFStateManager& xf_state_manager);
-  void SetConstants(const std::vector<std::string>& textures, XFStateManager& xf_state_manager);
+  // texture_targets are the graphics mod targets of the textures the draw uses.
+  void SetConstants(std::span<const u32> texture_targets, XFStateManager& xf_state_manager);
 
   // data: 3 floats representing the X, Y and Z vertex model coordinates and the posmatrix index.
   // out:  4 floats which will be initialized with the corresponding clip space coordinates
@@ -58,6 +61,17 @@ public:
     UpdateValue(dirty, old_value, new_value);
   }
 
+  // Games commonly reload the same matrices and lights for every draw. Comparing before copying
+  // keeps those loads from causing another upload of the whole constant block.
+  static DOLPHIN_FORCE_INLINE void UpdateConstants(bool* dirty, void* dst, const void* src,
+                                                   size_t size)
+  {
+    if (std::memcmp(dst, src, size) == 0)
+      return;
+    std::memcpy(dst, src, size);
+    *dirty = true;
+  }
+
   template <size_t N>
   static DOLPHIN_FORCE_INLINE void UpdateOffsets(bool* dirty, bool include_components,
                                                  std::array<u32, N>* old_value,
@@ -159,6 +159,10 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  // Return what has been collected so far. The GPU thread bounds how stale that is.
+  if (PerfQueryBase::GetMaxStaleFrames() != 0)
+    return g_perf_query->GetQueryResult(type);
+
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
@@ -403,6 +407,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   }
 
   g_shader_cache->InitializeShaderCache();
+  VertexLoaderManager::LoadLoaderUIDCache();
 
   return true;
 }
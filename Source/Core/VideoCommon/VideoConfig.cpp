@@ -20,12 +20,14 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
+#include "VideoCommon/DynamicResolution.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FreeLookCamera.h"
 #include "VideoCommon/GraphicsModSystem/Config/GraphicsMod.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderGenCommon.h"
@@ -81,6 +83,8 @@ void VideoConfig::Refresh()
 
   bVSync = Config::Get(Config::GFX_VSYNC);
   iAdapter = Config::Get(Config::GFX_ADAPTER);
+  bLatencyReduction = Config::Get(Config::GFX_LATENCY_REDUCTION);
+  iLatencyReductionMargin = Config::Get(Config::GFX_LATENCY_REDUCTION_MARGIN);
   iManuallyUploadBuffers = Config::Get(Config::GFX_MTL_MANUALLY_UPLOAD_BUFFERS);
   iUsePresentDrawable = Config::Get(Config::GFX_MTL_USE_PRESENT_DRAWABLE);
 
@@ -99,10 +103,13 @@ void VideoConfig::Refresh()
       Config::Get(Config::GFX_WIDESCREEN_HEURISTIC_WIDESCREEN_RATIO);
   bCrop = Config::Get(Config::GFX_CROP);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  iTextureCacheMemoryBudget = Config::Get(Config::GFX_TEXTURE_CACHE_MEMORY_BUDGET);
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
   bShowFTimes = Config::Get(Config::GFX_SHOW_FTIMES);
   bShowVPS = Config::Get(Config::GFX_SHOW_VPS);
   bShowVTimes = Config::Get(Config::GFX_SHOW_VTIMES);
+  bShowFramePacing = Config::Get(Config::GFX_SHOW_FRAME_PACING);
+  bShowPerfCounters = Config::Get(Config::GFX_SHOW_PERF_COUNTERS);
   bShowGraphs = Config::Get(Config::GFX_SHOW_GRAPHS);
   bShowSpeed = Config::Get(Config::GFX_SHOW_SPEED);
   bShowSpeedColors = Config::Get(Config::GFX_SHOW_SPEED_COLORS);
@@ -118,6 +125,7 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  bTranscodeHiresTextures = Config::Get(Config::GFX_TRANSCODE_HIRES_TEXTURES);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bDumpFramesAsImages = Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES);
@@ -136,6 +144,7 @@ void VideoConfig::Refresh()
   iMultisamples = Config::Get(Config::GFX_MSAA);
   bSSAA = Config::Get(Config::GFX_SSAA);
   iEFBScale = Config::Get(Config::GFX_EFB_SCALE);
+  bDynamicResolution = Config::Get(Config::GFX_DYNAMIC_RESOLUTION);
   bTexFmtOverlayEnable = Config::Get(Config::GFX_TEXFMT_OVERLAY_ENABLE);
   bTexFmtOverlayCenter = Config::Get(Config::GFX_TEXFMT_OVERLAY_CENTER);
   bWireFrame = Config::Get(Config::GFX_ENABLE_WIREFRAME);
@@ -149,7 +158,11 @@ void VideoConfig::Refresh()
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  iShaderCompileFrameBudget = Config::Get(Config::GFX_SHADER_COMPILE_FRAME_BUDGET);
+  bSpecializeUberShaders = Config::Get(Config::GFX_SPECIALIZE_UBERSHADERS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  bCPUCullTriangles = Config::Get(Config::GFX_CPU_CULL_TRIANGLES);
+  bLowMemory = Config::Get(Config::GFX_LOW_MEMORY);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -182,6 +195,7 @@ void VideoConfig::Refresh()
   bEFBAccessEnable = Config::Get(Config::GFX_HACK_EFB_ACCESS_ENABLE);
   bEFBAccessDeferInvalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
   bBBoxEnable = Config::Get(Config::GFX_HACK_BBOX_ENABLE);
+  iBBoxReadbackLatency = Config::Get(Config::GFX_HACK_BBOX_READBACK_LATENCY);
   bForceProgressive = Config::Get(Config::GFX_HACK_FORCE_PROGRESSIVE);
   bSkipEFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   bSkipXFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
@@ -194,13 +208,16 @@ void VideoConfig::Refresh()
   bEFBEmulateFormatChanges = Config::Get(Config::GFX_HACK_EFB_EMULATE_FORMAT_CHANGES);
   bVertexRounding = Config::Get(Config::GFX_HACK_VERTEX_ROUNDING);
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
+  iEFBAccessStaleFrames = Config::Get(Config::GFX_HACK_EFB_ACCESS_STALE_FRAMES);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  bAsyncTextureLoading = Config::Get(Config::GFX_HACK_ASYNC_TEXTURE_LOADING);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
 
   bPerfQueriesEnable = Config::Get(Config::GFX_PERF_QUERIES_ENABLE);
+  iPerfQueriesStaleFrames = Config::Get(Config::GFX_PERF_QUERIES_STALE_FRAMES);
 
   bGraphicMods = Config::Get(Config::GFX_MODS_ENABLE);
 
@@ -288,6 +305,7 @@ void CheckForConfigChanges()
   const bool old_vsync = g_ActiveConfig.bVSyncActive;
   const bool old_bbox = g_ActiveConfig.bBBoxEnable;
   const int old_efb_scale = g_ActiveConfig.iEFBScale;
+  const bool old_dynamic_resolution = g_ActiveConfig.bDynamicResolution;
   const u32 old_game_mod_changes =
       g_ActiveConfig.graphics_mod_config ? g_ActiveConfig.graphics_mod_config->GetChangeCount() : 0;
   const bool old_graphics_mods_enabled = g_ActiveConfig.bGraphicMods;
@@ -341,6 +359,19 @@ void CheckForConfigChanges()
     changed_bits |= CONFIG_CHANGE_BIT_BBOX;
   if (old_efb_scale != g_ActiveConfig.iEFBScale)
     changed_bits |= CONFIG_CHANGE_BIT_TARGET_SIZE;
+  if (old_dynamic_resolution != g_ActiveConfig.bDynamicResolution)
+  {
+    g_dynamic_resolution.Reset();
+    changed_bits |= CONFIG_CHANGE_BIT_TARGET_SIZE;
+  }
+  if (g_ActiveConfig.bDynamicResolution)
+  {
+    const u32 max_scale = g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL ?
+                              g_presenter->AutoIntegralScale() :
+                              static_cast<u32>(g_ActiveConfig.iEFBScale);
+    if (g_dynamic_resolution.Update(Clock::now(), g_perf_metrics.GetMaxSpeed(), max_scale))
+      changed_bits |= CONFIG_CHANGE_BIT_TARGET_SIZE;
+  }
   if (old_aspect_mode != g_ActiveConfig.aspect_mode)
     changed_bits |= CONFIG_CHANGE_BIT_ASPECT_RATIO;
   if (old_suggested_aspect_mode != g_ActiveConfig.suggested_aspect_mode)
@@ -116,6 +116,8 @@ struct VideoConfig final
   // General
   bool bVSync = false;
   bool bVSyncActive = false;
+  bool bLatencyReduction = false;
+  int iLatencyReductionMargin = 0;
   bool bWidescreenHack = false;
   AspectMode aspect_mode{};
   int custom_aspect_width = 1;
@@ -132,6 +134,8 @@ struct VideoConfig final
   u32 iMultisamples = 0;
   bool bSSAA = false;
   int iEFBScale = 0;
+  // Renders below iEFBScale while the GPU can't keep up.
+  bool bDynamicResolution = false;
   TextureFilteringMode texture_filtering_mode = TextureFilteringMode::Default;
   OutputResamplingMode output_resampling_mode = OutputResamplingMode::Default;
   int iMaxAnisotropy = 0;
@@ -167,6 +171,8 @@ struct VideoConfig final
   bool bShowFTimes = false;
   bool bShowVPS = false;
   bool bShowVTimes = false;
+  bool bShowFramePacing = false;
+  bool bShowPerfCounters = false;
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
@@ -190,6 +196,7 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bTranscodeHiresTextures = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
@@ -212,9 +219,17 @@ struct VideoConfig final
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
+  int iPerfQueriesStaleFrames = 0;
   bool bBBoxEnable = false;
+  // Frames by which bounding box reads may lag behind the GPU. 0 waits for the GPU on every read.
+  int iBBoxReadbackLatency = 0;
   bool bForceProgressive = false;
   bool bCPUCull = false;
+  // Removes culled triangles, and the vertices only they use, from draws that stay visible.
+  bool bCPUCullTriangles = false;
+  // Uses smaller streaming buffers and caps the texture cache, for devices with little RAM.
+  // The buffer sizes are only picked up when the backend is initialized.
+  bool bLowMemory = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -225,6 +240,8 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  // In MiB, 0 for no limit. Textures are evicted at the end of the frame when it's exceeded.
+  u32 iTextureCacheMemoryBudget = 0;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -232,9 +249,15 @@ struct VideoConfig final
   bool bVertexRounding = false;
   bool bVISkip = false;
   int iEFBAccessTileSize = 0;
+  // If non-zero, EFB peeks may return data that is up to this many frames old. The peek cache is
+  // only refreshed at the end of a frame instead of whenever the EFB changes.
+  int iEFBAccessStaleFrames = 0;
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  // Decodes large textures on worker threads and draws with a placeholder until they are ready.
+  // Not frame-exact, so it's meant to be enabled per game.
+  bool bAsyncTextureLoading = false;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -276,6 +299,15 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Milliseconds of compile time per frame the shader compiler threads may spend on shaders the
+  // game hasn't asked for yet, e.g. from the shader cache. The number of threads compiling at
+  // once also follows the emulation's speed headroom. 0 disables the limit.
+  int iShaderCompileFrameBudget = 0;
+
+  // Also compiles ubershaders with the TEV stage count, fog, alpha test and indirect state that
+  // is currently in use baked in, and uses them over the generic ubershaders once they're ready.
+  bool bSpecializeUberShaders = false;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -322,6 +354,7 @@ struct VideoConfig final
     // Needed by UberShaders, so must stay in VideoCommon
     bool bSupportsDynamicSamplerIndexing = false;
     bool bSupportsBPTCTextures = false;
+    bool bSupportsETC2Textures = false;
     bool bSupportsFramebufferFetch = false;  // Used as an alternative to dual-source blend on GLES
     bool bSupportsBackgroundCompiling = false;
     bool bSupportsLargePoints = false;
@@ -338,6 +371,8 @@ struct VideoConfig final
     bool bSupportsVSLinePointExpand = false;
     bool bSupportsGLLayerInFS = true;
     bool bSupportsHDROutput = false;
+    // Depth state and cull mode are set at draw time instead of being part of the pipeline.
+    bool bSupportsDynamicDepthAndCullState = false;
   } backend_info;
 
   // Utility
@@ -358,6 +393,10 @@ struct VideoConfig final
   {
     return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
   }
+  bool UseHiresTextureTranscoding() const
+  {
+    return backend_info.bSupportsETC2Textures && bTranscodeHiresTextures;
+  }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
   bool ManualTextureSamplingWithCustomTextureSizes() const
   {
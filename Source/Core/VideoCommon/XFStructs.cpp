@@ -17,6 +17,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/XFMemory.h"
@@ -120,6 +121,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +136,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +156,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +170,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -219,6 +228,7 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
 
   auto& system = Core::System::GetInstance();
   auto& xf_state_manager = system.GetXFStateManager();
+  bool changed = false;
 
   // write to XF mem
   if (base_address < XFMEM_REGISTERS_START)
@@ -232,12 +242,23 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
-    for (u32 i = 0; i < xf_mem_transfer_size; i++)
+    // Games often reload the same matrices for every draw. Only flush if something changed.
+    u32* const xf_mem = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
+    u32 first_changed = 0;
+    while (first_changed < xf_mem_transfer_size &&
+           xf_mem[first_changed] == Common::swap32(data + first_changed * 4))
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      first_changed++;
+    }
+
+    if (first_changed != xf_mem_transfer_size)
+    {
+      changed = true;
+      XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+      for (u32 i = first_changed; i < xf_mem_transfer_size; i++)
+        xf_mem[i] = Common::swap32(data + i * 4);
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
@@ -248,11 +269,19 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       const u32 value = Common::swap32(data);
 
       XFRegWritten(system, xf_state_manager, address, value);
+      if (((u32*)&xfmem)[address] != value)
+      {
+        changed = true;
+        g_vertex_manager->SetShaderUidsChanged();
+      }
       ((u32*)&xfmem)[address] = value;
 
       data += 4;
     }
   }
+
+  if (!changed)
+    INCSTAT(g_stats.this_frame.num_xf_loads_redundant);
 }
 
 // TODO - verify that it is correct. Seems to work, though.
@@ -293,6 +322,10 @@ void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size)
     for (u32 i = 0; i < size; ++i)
       currData[i] = Common::swap32(newData[i]);
   }
+  else
+  {
+    INCSTAT(g_stats.this_frame.num_xf_loads_redundant);
+  }
 }
 
 void PreprocessIndexedXF(CPArray array, u32 index, u16 address, u8 size)
@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+namespace
+{
+struct TestState
+{
+  u32 header = 0x12345678;
+  std::array<u8, 0x100> live_a{};
+  u16 middle = 0xABCD;
+  std::array<u32, 0x40> live_b{};
+  std::vector<u8> trailer{1, 2, 3};
+
+  void DoState(PointerWrap& p)
+  {
+    p.Do(header);
+    p.DoLiveArray(live_a.data(), static_cast<u32>(live_a.size()));
+    p.Do(middle);
+    p.DoLiveArray(live_b.data(), static_cast<u32>(live_b.size()));
+    p.Do(trailer);
+  }
+};
+
+std::vector<u8> Save(TestState& state, std::vector<PointerWrap::GatheredArray>* gathered_arrays)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  p_measure.SetGatherTarget(gathered_arrays);
+  state.DoState(p_measure);
+
+  std::vector<u8> buffer(reinterpret_cast<size_t>(ptr));
+  ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  p.SetGatherTarget(gathered_arrays);
+  state.DoState(p);
+  EXPECT_TRUE(p.IsWriteMode());
+  return buffer;
+}
+}  // namespace
+
+TEST(PointerWrap, GatheredArraysInterleaveToFullState)
+{
+  TestState state;
+  for (size_t i = 0; i < state.live_a.size(); ++i)
+    state.live_a[i] = static_cast<u8>(i * 7);
+  for (size_t i = 0; i < state.live_b.size(); ++i)
+    state.live_b[i] = static_cast<u32>(i * 0x01010101);
+
+  const std::vector<u8> full = Save(state, nullptr);
+
+  std::vector<PointerWrap::GatheredArray> gathered_arrays;
+  const std::vector<u8> partial = Save(state, &gathered_arrays);
+  ASSERT_EQ(gathered_arrays.size(), 2u);
+  EXPECT_EQ(partial.size(), full.size() - sizeof(state.live_a) - sizeof(state.live_b));
+
+  std::vector<u8> interleaved;
+  size_t offset = 0;
+  for (const PointerWrap::GatheredArray& array : gathered_arrays)
+  {
+    interleaved.insert(interleaved.end(), partial.begin() + offset, partial.begin() + array.offset);
+    interleaved.insert(interleaved.end(), array.data, array.data + array.size);
+    offset = array.offset;
+  }
+  interleaved.insert(interleaved.end(), partial.begin() + offset, partial.end());
+  EXPECT_EQ(interleaved, full);
+
+  // The full state loads as usual.
+  TestState loaded;
+  loaded.header = 0;
+  loaded.middle = 0;
+  loaded.trailer.clear();
+  u8* ptr = interleaved.data();
+  PointerWrap p(&ptr, interleaved.size(), PointerWrap::Mode::Read);
+  loaded.DoState(p);
+  EXPECT_EQ(loaded.header, state.header);
+  EXPECT_EQ(loaded.live_a, state.live_a);
+  EXPECT_EQ(loaded.middle, state.middle);
+  EXPECT_EQ(loaded.live_b, state.live_b);
+  EXPECT_EQ(loaded.trailer, state.trailer);
+}
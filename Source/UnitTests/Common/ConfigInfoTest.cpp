@@ -0,0 +1,86 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/ConfigInfo.h"
+
+namespace
+{
+enum class TestEnum
+{
+  A,
+  B,
+};
+
+// The settings that are read on hot paths must not need a lock to be read.
+static_assert(Config::detail::IsAtomicCacheable<bool>);
+static_assert(Config::detail::IsAtomicCacheable<int>);
+static_assert(Config::detail::IsAtomicCacheable<u32>);
+static_assert(Config::detail::IsAtomicCacheable<float>);
+static_assert(Config::detail::IsAtomicCacheable<TestEnum>);
+static_assert(!Config::detail::IsAtomicCacheable<std::string>);
+
+const Config::Location TEST_LOCATION{Config::System::Main, "Test", "Value"};
+}  // namespace
+
+TEST(ConfigInfo, CachedValueOnlyGetsNewer)
+{
+  const Config::Info<int> info{TEST_LOCATION, 1};
+  EXPECT_EQ(info.GetCachedValue().value, 1);
+  EXPECT_EQ(info.GetCachedValue().config_version, 0u);
+
+  info.SetCachedValue({2, 5});
+  EXPECT_EQ(info.GetCachedValue().value, 2);
+  EXPECT_EQ(info.GetCachedValue().config_version, 5u);
+
+  info.SetCachedValue({3, 4});
+  EXPECT_EQ(info.GetCachedValue().value, 2);
+  EXPECT_EQ(info.GetCachedValue().config_version, 5u);
+}
+
+TEST(ConfigInfo, CopyKeepsCachedValue)
+{
+  const Config::Info<std::string> string_info{TEST_LOCATION, "a"};
+  string_info.SetCachedValue({"b", 1});
+  const Config::Info<std::string> string_copy = string_info;
+  EXPECT_EQ(string_copy.GetCachedValue().value, "b");
+  EXPECT_EQ(string_copy.GetCachedValue().config_version, 1u);
+
+  const Config::Info<TestEnum> enum_info{TEST_LOCATION, TestEnum::A};
+  enum_info.SetCachedValue({TestEnum::B, 2});
+  const Config::Info<int> int_copy = enum_info;
+  EXPECT_EQ(int_copy.GetDefaultValue(), static_cast<int>(TestEnum::A));
+  EXPECT_EQ(int_copy.GetCachedValue().value, static_cast<int>(TestEnum::B));
+  EXPECT_EQ(int_copy.GetCachedValue().config_version, 2u);
+}
+
+TEST(ConfigInfo, ConcurrentReadsSeeValueAtLeastAsNewAsVersion)
+{
+  constexpr u64 ITERATIONS = 100000;
+  const Config::Info<u64> info{TEST_LOCATION, 0};
+  std::atomic<bool> done = false;
+
+  std::thread writer([&] {
+    for (u64 i = 1; i <= ITERATIONS; ++i)
+      info.SetCachedValue({i, i});
+    done = true;
+  });
+
+  u64 last_version = 0;
+  while (!done)
+  {
+    const Config::CachedValue<u64> cached = info.GetCachedValue();
+    EXPECT_GE(cached.value, cached.config_version);
+    EXPECT_GE(cached.config_version, last_version);
+    last_version = cached.config_version;
+  }
+  writer.join();
+
+  EXPECT_EQ(info.GetCachedValue().value, ITERATIONS);
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Common/FileUtil.h"
+#include "Common/FrameTrace.h"
+
+TEST(FrameTrace, CapturesEventsUntilTheLastFrame)
+{
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+  const std::string path = dir + "/trace.json";
+
+  // Nothing is recorded outside of a capture.
+  {
+    const Common::FrameTrace::ScopedEvent event("BeforeCapture");
+  }
+  EXPECT_FALSE(Common::FrameTrace::MarkFrame());
+
+  ASSERT_TRUE(Common::FrameTrace::StartCapture(path, 2));
+  EXPECT_TRUE(Common::FrameTrace::IsCapturing());
+  EXPECT_FALSE(Common::FrameTrace::StartCapture(path, 2));
+
+  {
+    const Common::FrameTrace::ScopedEvent event("MainThreadEvent");
+  }
+  std::thread([] {
+    Common::FrameTrace::SetThreadName("Trace\"Worker");
+    const Common::FrameTrace::ScopedEvent event("WorkerEvent");
+  }).join();
+
+  EXPECT_FALSE(Common::FrameTrace::MarkFrame());
+  EXPECT_EQ(Common::FrameTrace::MarkFrame(), path);
+  EXPECT_FALSE(Common::FrameTrace::IsCapturing());
+
+  {
+    const Common::FrameTrace::ScopedEvent event("AfterCapture");
+  }
+
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(path, contents));
+  EXPECT_EQ(contents.front(), '{');
+  EXPECT_NE(contents.find("\"name\":\"MainThreadEvent\",\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(contents.find("\"name\":\"WorkerEvent\""), std::string::npos);
+  EXPECT_NE(contents.find("\"name\":\"Trace\\\"Worker\""), std::string::npos);
+  EXPECT_NE(contents.find("\"name\":\"Frame 2\""), std::string::npos);
+  EXPECT_EQ(contents.find("BeforeCapture"), std::string::npos);
+  EXPECT_EQ(contents.find("AfterCapture"), std::string::npos);
+
+  File::DeleteDirRecursively(dir);
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <xxhash.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+static std::vector<u8> RandomBytes(size_t size)
+{
+  std::mt19937 rng(0x1234);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(rng());
+  return data;
+}
+
+TEST(Hash, CRC32)
+{
+  EXPECT_EQ(Common::ComputeCRC32(std::string_view("123456789")), 0xCBF43926u);
+
+  const std::vector<u8> data = RandomBytes(1000);
+  const u32 crc = Common::UpdateCRC32(Common::UpdateCRC32(Common::StartCRC32(), data.data(), 300),
+                                      data.data() + 300, data.size() - 300);
+  EXPECT_EQ(crc, Common::ComputeCRC32(data.data(), data.size()));
+}
+
+TEST(Hash, GetHash64)
+{
+  std::vector<u8> data = RandomBytes(4096);
+  const u64 full_hash = Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0);
+  EXPECT_EQ(full_hash, Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0));
+
+  // Hashing everything has to notice a change in any byte.
+  data[1234] ^= 1;
+  EXPECT_NE(full_hash, Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0));
+}
+
+// Not a correctness test: prints the throughput of the hash functions used for textures and
+// caches. The texture cache uses GetHash64, either on all of the data or on a number of samples.
+TEST(Hash, ThroughputBenchmark)
+{
+  constexpr u32 SIZE = 1024 * 1024;
+  constexpr int ITERATIONS = 100;
+
+  const std::vector<u8> data = RandomBytes(SIZE);
+  fmt::print("{}\n", cpu_info.Summarize());
+
+  const auto benchmark = [&](std::string_view name, auto hash) {
+    u64 result = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+      result += hash();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    fmt::print("{}: {:.1f} MB/s (result {:016x})\n", name,
+               double(ITERATIONS) * SIZE / seconds / 1e6, result);
+  };
+
+  benchmark(cpu_info.bCRC32 ? "GetHash64 (CRC32)" : "GetHash64 (MurmurHash3)",
+            [&] { return Common::GetHash64(data.data(), SIZE, 0); });
+  benchmark("GetHash64, 128 samples", [&] { return Common::GetHash64(data.data(), SIZE, 128); });
+  benchmark("XXH64", [&] { return XXH64(data.data(), SIZE, 0); });
+  benchmark("XXH3_64bits", [&] { return XXH3_64bits(data.data(), SIZE); });
+  benchmark("CRC32", [&] { return Common::ComputeCRC32(data.data(), SIZE); });
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+class OffsetReader : public Common::LinearDiskCacheReader<u32, u8>
+{
+public:
+  explicit OffsetReader(Common::LinearDiskCache<u32, u8>& cache_) : cache(cache_) {}
+  void Read(const u32& key, const u8* value, u32 value_size) override
+  {
+    offsets[key] = cache.GetCurrentEntryOffset();
+  }
+
+  Common::LinearDiskCache<u32, u8>& cache;
+  std::map<u32, u64> offsets;
+};
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_temp_directory(File::CreateTempDir()), m_cache_path(m_temp_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_temp_directory.empty())
+      File::DeleteDirRecursively(m_temp_directory);
+  }
+
+  void SetUp() override { ASSERT_FALSE(m_temp_directory.empty()); }
+
+  const std::string m_temp_directory;
+  const std::string m_cache_path;
+};
+
+TEST_F(LinearDiskCacheTest, ReadEntry)
+{
+  const std::vector<u8> first{1, 2, 3};
+  const std::vector<u8> second{4, 5, 6, 7, 8};
+
+  Common::LinearDiskCache<u32, u8> cache;
+  OffsetReader reader(cache);
+  EXPECT_EQ(0u, cache.OpenAndRead(m_cache_path, reader));
+  const u64 first_offset = cache.Append(10, first.data(), static_cast<u32>(first.size()));
+  cache.Append(20, second.data(), static_cast<u32>(second.size()));
+
+  // Entries written in this session can be read back, and appending still works afterwards.
+  u32 key;
+  std::vector<u8> value;
+  ASSERT_TRUE(cache.ReadEntry(first_offset, &key, &value));
+  EXPECT_EQ(10u, key);
+  EXPECT_EQ(first, value);
+  cache.Append(30, first.data(), static_cast<u32>(first.size()));
+  cache.Close();
+
+  // The offsets reported while reading match the ones returned by Append.
+  EXPECT_EQ(3u, cache.OpenAndRead(m_cache_path, reader));
+  ASSERT_EQ(3u, reader.offsets.size());
+  EXPECT_EQ(first_offset, reader.offsets[10]);
+  ASSERT_TRUE(cache.ReadEntry(reader.offsets[20], &key, &value));
+  EXPECT_EQ(20u, key);
+  EXPECT_EQ(second, value);
+  ASSERT_TRUE(cache.ReadEntry(reader.offsets[30], &key, &value));
+  EXPECT_EQ(30u, key);
+  EXPECT_EQ(first, value);
+
+  EXPECT_FALSE(cache.ReadEntry(File::GetSize(m_cache_path), &key, &value));
+}
+
+TEST_F(LinearDiskCacheTest, TruncatedEntry)
+{
+  const std::vector<u8> first{1, 2, 3};
+  const std::vector<u8> second{4, 5, 6, 7, 8};
+
+  Common::LinearDiskCache<u32, u8> cache;
+  OffsetReader reader(cache);
+  EXPECT_EQ(0u, cache.OpenAndRead(m_cache_path, reader));
+  cache.Append(10, first.data(), static_cast<u32>(first.size()));
+  const u64 second_offset = cache.Append(20, second.data(), static_cast<u32>(second.size()));
+  cache.Close();
+
+  // Simulate a crash in the middle of writing the second entry.
+  {
+    File::IOFile file(m_cache_path, "r+b");
+    ASSERT_TRUE(file.Resize(second_offset + 6));
+  }
+
+  // The partial entry is dropped, and entries appended afterwards are found on the next open.
+  EXPECT_EQ(1u, cache.OpenAndRead(m_cache_path, reader));
+  EXPECT_EQ(second_offset, File::GetSize(m_cache_path));
+  cache.Append(30, first.data(), static_cast<u32>(first.size()));
+  cache.Close();
+
+  reader.offsets.clear();
+  EXPECT_EQ(2u, cache.OpenAndRead(m_cache_path, reader));
+  EXPECT_EQ(1u, reader.offsets.count(10));
+  EXPECT_EQ(1u, reader.offsets.count(30));
+}
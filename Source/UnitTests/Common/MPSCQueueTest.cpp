@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32, 16> q;
+
+  EXPECT_TRUE(q.Empty());
+  u32 v;
+  EXPECT_FALSE(q.Pop(v));
+
+  EXPECT_TRUE(q.TryPush(1));
+  EXPECT_FALSE(q.Empty());
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+
+  // Test the FIFO order, wrapping around the ring several times.
+  for (u32 lap = 0; lap < 4; ++lap)
+  {
+    for (u32 i = 0; i < 16; ++i)
+      EXPECT_TRUE(q.TryPush(lap * 16 + i));
+    EXPECT_FALSE(q.TryPush(0));
+
+    for (u32 i = 0; i < 16; ++i)
+    {
+      EXPECT_TRUE(q.Pop(v));
+      EXPECT_EQ(lap * 16 + i, v);
+    }
+    EXPECT_TRUE(q.Empty());
+  }
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  constexpr u32 NUM_PRODUCERS = 4;
+  constexpr u32 NUM_ELEMENTS = 20000;
+  Common::MPSCQueue<u32, 256> q;
+
+  std::vector<std::thread> producers;
+  for (u32 producer = 0; producer < NUM_PRODUCERS; ++producer)
+  {
+    producers.emplace_back([&q, producer] {
+      for (u32 i = 0; i < NUM_ELEMENTS; ++i)
+      {
+        while (!q.TryPush(producer << 24 | i))
+          std::this_thread::yield();
+      }
+    });
+  }
+
+  // Elements from the same producer must arrive in order.
+  std::array<u32, NUM_PRODUCERS> next{};
+  for (u32 i = 0; i < NUM_PRODUCERS * NUM_ELEMENTS; ++i)
+  {
+    u32 v;
+    while (!q.Pop(v))
+      ;
+    const u32 producer = v >> 24;
+    ASSERT_LT(producer, NUM_PRODUCERS);
+    EXPECT_EQ(next[producer]++, v & 0xffffff);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (std::thread& producer : producers)
+    producer.join();
+}
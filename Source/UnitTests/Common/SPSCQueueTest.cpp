@@ -2,9 +2,16 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <gtest/gtest.h>
+
+#include <chrono>
 #include <thread>
+#include <vector>
+
+#include <fmt/format.h>
 
+#include "Common/CommonTypes.h"
 #include "Common/SPSCQueue.h"
+#include "Common/SPSCRingQueue.h"
 
 TEST(SPSCQueue, Simple)
 {
@@ -68,3 +75,119 @@ TEST(SPSCQueue, MultiThreaded)
   popper_thread.join();
   inserter_thread.join();
 }
+
+TEST(SPSCRingQueue, Simple)
+{
+  Common::SPSCRingQueue<u32, 16> q;
+
+  EXPECT_TRUE(q.Empty());
+  u32 v;
+  EXPECT_FALSE(q.Pop(v));
+
+  EXPECT_TRUE(q.TryPush(1));
+  EXPECT_FALSE(q.Empty());
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+
+  // Test the FIFO order, wrapping around the ring several times.
+  for (u32 lap = 0; lap < 4; ++lap)
+  {
+    for (u32 i = 0; i < 16; ++i)
+      EXPECT_TRUE(q.TryPush(lap * 16 + i));
+    EXPECT_FALSE(q.TryPush(0));
+
+    for (u32 i = 0; i < 16; ++i)
+    {
+      EXPECT_TRUE(q.Pop(v));
+      EXPECT_EQ(lap * 16 + i, v);
+    }
+    EXPECT_TRUE(q.Empty());
+  }
+
+  for (u32 i = 0; i < 10; ++i)
+    q.Push(i);
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(SPSCRingQueue, Batch)
+{
+  Common::SPSCRingQueue<u32, 16> q;
+
+  std::vector<u32> values(20);
+  for (u32 i = 0; i < 20; ++i)
+    values[i] = i;
+
+  EXPECT_TRUE(q.TryPush(100));
+  // Only as many elements as there is space for are taken.
+  EXPECT_EQ(15u, q.TryPushRange(values.begin(), values.end()));
+  EXPECT_FALSE(q.TryPush(0));
+
+  std::vector<u32> popped;
+  EXPECT_EQ(16u, q.PopAll([&popped](u32 value) { popped.push_back(value); }));
+  EXPECT_TRUE(q.Empty());
+  ASSERT_EQ(16u, popped.size());
+  EXPECT_EQ(100u, popped[0]);
+  for (u32 i = 0; i < 15; ++i)
+    EXPECT_EQ(i, popped[i + 1]);
+
+  EXPECT_EQ(0u, q.PopAll([](u32) { ADD_FAILURE(); }));
+  EXPECT_EQ(5u, q.TryPushRange(values.begin() + 15, values.end()));
+  EXPECT_EQ(5u, q.PopAll([](u32) {}));
+}
+
+TEST(SPSCRingQueue, MultiThreaded)
+{
+  // Small enough that both threads have to wait for each other.
+  Common::SPSCRingQueue<u32, 8> q;
+
+  std::thread inserter_thread([&q] {
+    for (u32 i = 0; i < 100000; ++i)
+      q.Push(i);
+  });
+
+  for (u32 i = 0; i < 100000; ++i)
+  {
+    q.WaitForData();
+    u32 v;
+    ASSERT_TRUE(q.Pop(v));
+    EXPECT_EQ(i, v);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  inserter_thread.join();
+}
+
+// Not a correctness test: compares the cost of pushing and popping with the linked-list queue,
+// which allocates a node for every element, and the ring. Both run on one thread, so the result
+// doesn't depend on how the threads get scheduled.
+TEST(SPSCRingQueue, ThroughputBenchmark)
+{
+  constexpr u32 NUM_ROUNDS = 10000;
+  constexpr u32 ELEMENTS_PER_ROUND = 256;
+
+  const auto run = [](auto& q) {
+    const auto start = std::chrono::steady_clock::now();
+    u32 sum = 0;
+    for (u32 round = 0; round < NUM_ROUNDS; ++round)
+    {
+      for (u32 i = 0; i < ELEMENTS_PER_ROUND; ++i)
+        q.Push(i);
+      u32 v;
+      while (q.Pop(v))
+        sum += v;
+    }
+    EXPECT_EQ(NUM_ROUNDS * (ELEMENTS_PER_ROUND * (ELEMENTS_PER_ROUND - 1) / 2), sum);
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                 start);
+  };
+
+  Common::SPSCQueue<u32, false> list_queue;
+  const auto list_time = run(list_queue);
+  Common::SPSCRingQueue<u32, ELEMENTS_PER_ROUND> ring_queue;
+  const auto ring_time = run(ring_queue);
+
+  fmt::print("SPSCQueue: {} us, SPSCRingQueue: {} us for {} elements\n", list_time.count(),
+             ring_time.count(), NUM_ROUNDS * ELEMENTS_PER_ROUND);
+}
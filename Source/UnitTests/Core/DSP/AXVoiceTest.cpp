@@ -0,0 +1,236 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+
+#define AX_GC
+#include "Core/HW/DSPHLE/UCodes/AXVoice.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// The straightforward sample by sample implementations that the mixing code used to have.
+// The optimized versions must give bit-exact results.
+void ReferenceMixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
+{
+  u16& volume = vd->volume;
+  const u16 volume_delta = ramp ? vd->volume_delta : 0;
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    const s16 sample16 = std::clamp<s64>(sample, -0x8000, 0x7FFF);
+
+    out[i] += sample16;
+    volume += volume_delta;
+
+    *dpop = sample16;
+  }
+}
+
+u32 ReferenceResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count,
+                           s16* last_samples, u32 curr_pos, u32 ratio, int srctype,
+                           const s16* coeffs)
+{
+  int read_samples_count = 0;
+  s16 temp[4];
+  u32 idx = 0;
+
+  if (srctype == SRCTYPE_NEAREST)
+  {
+    for (u32 i = 0; i < count; ++i)
+      output[i] = input_callback(i);
+    std::memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
+    return curr_pos;
+  }
+
+  for (u32 i = 0; i < 4; ++i)
+    temp[idx++ & 3] = last_samples[i];
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    while (curr_pos >= 0x10000)
+    {
+      temp[idx++ & 3] = input_callback(read_samples_count++);
+      curr_pos -= 0x10000;
+    }
+
+    if (coeffs && srctype == SRCTYPE_POLYPHASE)
+    {
+      const s16* c = &coeffs[((curr_pos & 0xFFFF) >> 9) << 2];
+      s64 samp = 0;
+      for (u32 j = 0; j < 4; ++j)
+        samp += s64(temp[idx++ & 3]) * c[j];
+      output[i] = MathUtil::SaturatingCast<s16>(samp >> 15);
+    }
+    else
+    {
+      const u16 curr_frac = curr_pos & 0xFFFF;
+      const u16 inv_curr_frac = -curr_frac;
+      if (curr_frac)
+      {
+        const s32 s0 = temp[idx++ & 3];
+        const s32 s1 = temp[idx++ & 3];
+        output[i] = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+        idx += 2;
+      }
+      else
+      {
+        output[i] = temp[idx++ & 3];
+        idx += 3;
+      }
+    }
+  }
+
+  for (u32 i = 4; i > 0; --i)
+    last_samples[i - 1] = temp[--idx & 3];
+
+  return curr_pos;
+}
+
+std::vector<s16> RandomSamples(std::mt19937& rng, size_t count)
+{
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::vector<s16> samples(count);
+  for (s16& sample : samples)
+    sample = static_cast<s16>(dist(rng));
+  return samples;
+}
+}  // namespace
+
+TEST(AXVoice, MixAddMatchesReference)
+{
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<u32> u16_dist(0, 0xFFFF);
+
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const u32 count = iteration % (MAX_SAMPLES_PER_FRAME + 1);
+    const std::vector<s16> input = RandomSamples(rng, count);
+    const bool ramp = (iteration & 1) != 0;
+
+    // Cover muted buses and volume wraparound as well as random volumes.
+    VolumeData vd{static_cast<u16>(u16_dist(rng)), static_cast<u16>(u16_dist(rng))};
+    if (iteration % 7 == 0)
+      vd = {0, 0};
+    else if (iteration % 7 == 1)
+      vd.volume = 0;
+    VolumeData expected_vd = vd;
+
+    std::vector<int> out(count, iteration);
+    std::vector<int> expected_out = out;
+    s16 dpop = 0x1234;
+    s16 expected_dpop = dpop;
+
+    MixAdd(out.data(), input.data(), count, &vd, &dpop, ramp);
+    ReferenceMixAdd(expected_out.data(), input.data(), count, &expected_vd, &expected_dpop, ramp);
+
+    ASSERT_EQ(out, expected_out);
+    ASSERT_EQ(dpop, expected_dpop);
+    ASSERT_EQ(vd.volume, expected_vd.volume);
+    ASSERT_EQ(vd.volume_delta, expected_vd.volume_delta);
+  }
+}
+
+TEST(AXVoice, ResampleAudioMatchesReference)
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<u32> frac_dist(0, 0xFFFF);
+  std::uniform_int_distribution<u32> ratio_dist(0x100, MAX_DECODE_RATIO << 16);
+  const std::vector<s16> coeffs = RandomSamples(rng, 0x200);
+
+  for (int iteration = 0; iteration < 3000; ++iteration)
+  {
+    const u32 count = MAX_SAMPLES_PER_FRAME;
+    const int srctype = iteration % 3;
+    const bool use_coeffs = (iteration / 3) % 2 == 0;
+    const u32 frac = frac_dist(rng);
+    u32 ratio = ratio_dist(rng);
+    if (iteration % 5 == 0)
+      ratio = 0x10000;
+    else if (iteration % 5 == 1)
+      ratio = MAX_DECODE_RATIO << 16;
+
+    const std::vector<s16> input = RandomSamples(rng, MAX_SAMPLES_PER_FRAME * MAX_DECODE_RATIO + 1);
+    const std::vector<s16> initial_last_samples = RandomSamples(rng, 4);
+
+    u32 reads = 0;
+    std::array<s16, MAX_SAMPLES_PER_FRAME> output;
+    std::array<s16, 4> last_samples;
+    std::ranges::copy(initial_last_samples, last_samples.begin());
+    const u32 pos = ResampleAudio(
+        [&](u32 i) {
+          ++reads;
+          return input[i];
+        },
+        output.data(), count, last_samples.data(), frac, ratio, srctype,
+        use_coeffs ? coeffs.data() : nullptr);
+
+    std::array<s16, MAX_SAMPLES_PER_FRAME> expected_output;
+    std::array<s16, 4> expected_last_samples;
+    std::ranges::copy(initial_last_samples, expected_last_samples.begin());
+    const u32 expected_pos = ReferenceResampleAudio(
+        [&](u32 i) { return input[i]; }, expected_output.data(), count,
+        expected_last_samples.data(), frac, ratio, srctype, use_coeffs ? coeffs.data() : nullptr);
+
+    ASSERT_EQ(output, expected_output);
+    ASSERT_EQ(last_samples, expected_last_samples);
+    ASSERT_EQ(pos, expected_pos);
+
+    // GetInputSamples decodes exactly this many samples ahead of time.
+    const bool resampling = srctype == SRCTYPE_POLYPHASE || srctype == SRCTYPE_LINEAR;
+    ASSERT_EQ(reads, resampling ? (frac + u64(ratio) * count) >> 16 : count);
+  }
+}
+
+TEST(AXVoice, SkipResampleAudioMatchesResampleAudio)
+{
+  std::mt19937 rng(2);
+  std::uniform_int_distribution<u32> frac_dist(0, 0xFFFF);
+  std::uniform_int_distribution<u32> ratio_dist(0, MAX_DECODE_RATIO << 16);
+
+  for (int iteration = 0; iteration < 3000; ++iteration)
+  {
+    const u32 count = iteration % 2 == 0 ? 32 : MAX_SAMPLES_PER_FRAME;
+    const int srctype = iteration % 3;
+    const u32 frac = frac_dist(rng);
+    u32 ratio = ratio_dist(rng);
+    // Very low ratios read fewer than four samples per frame.
+    if (iteration % 5 == 0)
+      ratio = 0x100;
+    else if (iteration % 5 == 1)
+      ratio = MAX_DECODE_RATIO << 16;
+
+    const std::vector<s16> input = RandomSamples(rng, MAX_SAMPLES_PER_FRAME * MAX_DECODE_RATIO + 1);
+    const std::vector<s16> initial_last_samples = RandomSamples(rng, 4);
+
+    std::array<s16, 4> last_samples;
+    std::ranges::copy(initial_last_samples, last_samples.begin());
+    const u32 pos = SkipResampleAudio(input.data(), count, last_samples.data(), frac, ratio,
+                                      srctype);
+
+    std::array<s16, MAX_SAMPLES_PER_FRAME> expected_output;
+    std::array<s16, 4> expected_last_samples;
+    std::ranges::copy(initial_last_samples, expected_last_samples.begin());
+    const u32 expected_pos =
+        ResampleAudio([&](u32 i) { return input[i]; }, expected_output.data(), count,
+                      expected_last_samples.data(), frac, ratio, srctype, nullptr);
+
+    ASSERT_EQ(last_samples, expected_last_samples);
+    ASSERT_EQ(pos, expected_pos);
+  }
+}
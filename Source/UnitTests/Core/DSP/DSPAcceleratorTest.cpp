@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -185,3 +187,84 @@ TEST(DSPAccelerator, CurrentAddressSkips)
   accelerator.TestRead();
   EXPECT_EQ(accelerator.GetCurrentAddress(), 0x00000013u);
 }
+
+// Accelerator over a block of random memory, which can optionally be read directly.
+class MemoryAccelerator : public DSP::Accelerator
+{
+public:
+  MemoryAccelerator(const std::vector<u8>& memory, bool direct_access)
+      : m_memory(memory), m_direct_access(direct_access)
+  {
+  }
+
+  u32 EndExceptionCount() const { return m_accov_count; }
+
+protected:
+  void OnEndException() override
+  {
+    // Resume reads every other time, like a looping voice.
+    if (++m_accov_count % 2 == 0)
+      SetYn2(GetYn2());
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  void WriteMemory(u32 address, u8 value) override {}
+  const u8* GetMemoryPointer(u32 address, u32 size) override
+  {
+    if (!m_direct_access || u64{address} + size > m_memory.size())
+      return nullptr;
+    return m_memory.data() + address;
+  }
+
+private:
+  const std::vector<u8>& m_memory;
+  bool m_direct_access;
+  u32 m_accov_count = 0;
+};
+
+TEST(DSPAccelerator, ReadSamplesMatchesRead)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> memory(0x400);
+  for (u8& byte : memory)
+    byte = static_cast<u8>(rng());
+  std::array<s16, 16> coefs;
+  for (s16& coef : coefs)
+    coef = static_cast<s16>(rng());
+
+  constexpr std::array<u16, 4> formats{0x00, 0x0A, 0x19, 0x05};
+  for (int iteration = 0; iteration < 4000; ++iteration)
+  {
+    const u16 format = formats[iteration % formats.size()];
+    const bool direct_access = (iteration / formats.size()) % 4 != 0;
+    const u32 start = rng() % 0x200;
+    const u32 end = start + rng() % 0x180;
+    const u32 current = start + rng() % (end - start + 8);
+    const size_t count = rng() % 0x200;
+
+    MemoryAccelerator expected(memory, direct_access);
+    MemoryAccelerator actual(memory, direct_access);
+    for (MemoryAccelerator* accelerator : {&expected, &actual})
+    {
+      accelerator->SetSampleFormat(format);
+      accelerator->SetStartAddress(start);
+      accelerator->SetEndAddress(end);
+      accelerator->SetCurrentAddress(current);
+      accelerator->SetPredScale(static_cast<u16>(iteration));
+      accelerator->SetYn1(static_cast<s16>(iteration * 3));
+      accelerator->SetYn2(static_cast<s16>(iteration * 5));
+    }
+
+    std::vector<s16> expected_samples(count);
+    for (s16& sample : expected_samples)
+      sample = static_cast<s16>(expected.Read(coefs.data()));
+    std::vector<s16> samples(count);
+    actual.ReadSamples(coefs.data(), samples.data(), count);
+
+    ASSERT_EQ(samples, expected_samples);
+    ASSERT_EQ(actual.GetCurrentAddress(), expected.GetCurrentAddress());
+    ASSERT_EQ(actual.GetYn1(), expected.GetYn1());
+    ASSERT_EQ(actual.GetYn2(), expected.GetYn2());
+    ASSERT_EQ(actual.GetPredScale(), expected.GetPredScale());
+    ASSERT_EQ(actual.EndExceptionCount(), expected.EndExceptionCount());
+  }
+}
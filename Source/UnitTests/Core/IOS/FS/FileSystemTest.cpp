@@ -12,6 +12,8 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
+#include "Core/IOS/FS/PackBackend/FS.h"
 #include "Core/IOS/IOS.h"
 #include "UICommon/UICommon.h"
 
@@ -468,3 +470,98 @@ TEST_F(FileSystemTest, CreateFullPath)
   EXPECT_EQ(m_fs->CreateFullPath(Uid{0x1000}, Gid{1}, "/shared2/wc24/mbox/Readme.txt", 0, modes),
             ResultCode::Success);
 }
+
+TEST_F(FileSystemTest, ReopenAfterChanges)
+{
+  const std::string path = "/tmp/f";
+  const std::array<u8, 4> data{{1, 2, 3, 4}};
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, path, 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, path, Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(data.data(), data.size()).Succeeded());
+  }
+
+  // Closed files must not linger around in a way that keeps them from being deleted or replaced.
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, path), ResultCode::Success);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, path, 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, path, Mode::Read);
+    ASSERT_TRUE(file.Succeeded());
+    const Result<FileStatus> status = file->GetStatus();
+    ASSERT_TRUE(status.Succeeded());
+    EXPECT_EQ(status->size, 0u);
+  }
+
+  // Metadata changes are saved when the file system is flushed.
+  ASSERT_EQ(m_fs->SetMetadata(Uid{0}, path, Uid{0x1000}, Gid{1}, 0, modes), ResultCode::Success);
+  m_fs->Flush();
+  const auto other_fs = IOS::HLE::Kernel{}.GetFS();
+  const Result<Metadata> metadata = other_fs->GetMetadata(Uid{0}, Gid{0}, path);
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->uid, 0x1000u);
+  EXPECT_EQ(metadata->gid, 1);
+}
+
+TEST(PackFileSystem, PersistsChanges)
+{
+  const std::string root = File::CreateTempDir();
+  ASSERT_FALSE(root.empty());
+  const std::array<u8, 4> data{{1, 2, 3, 4}};
+  {
+    PackFileSystem fs(root);
+    ASSERT_EQ(fs.CreateDirectory(Uid{0}, Gid{0}, "/tmp", 0, modes), ResultCode::Success);
+    ASSERT_EQ(fs.CreateFile(Uid{0}, Gid{0}, "/tmp/a", 1, modes), ResultCode::Success);
+    ASSERT_EQ(fs.CreateFile(Uid{0}, Gid{0}, "/tmp/b", 2, modes), ResultCode::Success);
+    const Result<FileHandle> file = fs.OpenFile(Uid{0}, Gid{0}, "/tmp/b", Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(data.data(), data.size()).Succeeded());
+  }
+  {
+    PackFileSystem fs(root);
+    const Result<std::vector<std::string>> children = fs.ReadDirectory(Uid{0}, Gid{0}, "/tmp");
+    ASSERT_TRUE(children.Succeeded());
+    EXPECT_EQ(*children, (std::vector<std::string>{"b", "a"}));
+
+    const Result<Metadata> metadata = fs.GetMetadata(Uid{0}, Gid{0}, "/tmp/b");
+    ASSERT_TRUE(metadata.Succeeded());
+    EXPECT_EQ(metadata->attribute, 2);
+    EXPECT_EQ(metadata->size, data.size());
+
+    std::array<u8, 4> read_data{};
+    const Result<FileHandle> file = fs.OpenFile(Uid{0}, Gid{0}, "/tmp/b", Mode::Read);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Read(read_data.data(), read_data.size()).Succeeded());
+    EXPECT_EQ(read_data, data);
+  }
+  File::DeleteDirRecursively(root);
+}
+
+TEST(PackFileSystem, ImportAndExport)
+{
+  const std::string root = File::CreateTempDir();
+  ASSERT_FALSE(root.empty());
+  {
+    HostFileSystem fs(root);
+    ASSERT_EQ(fs.CreateFullPath(Uid{0}, Gid{0}, "/title/a/b", 0, modes), ResultCode::Success);
+    ASSERT_EQ(fs.CreateFile(Uid{0x1000}, Gid{1}, "/title/a/b/c", 0, modes), ResultCode::Success);
+  }
+  {
+    // A pack that doesn't exist yet is created from the directory.
+    PackFileSystem fs(root);
+    const Result<Metadata> metadata = fs.GetMetadata(Uid{0}, Gid{0}, "/title/a/b/c");
+    ASSERT_TRUE(metadata.Succeeded());
+    EXPECT_EQ(metadata->uid, 0x1000u);
+    EXPECT_EQ(fs.Delete(Uid{0}, Gid{0}, "/title/a/b/c"), ResultCode::Success);
+    ASSERT_EQ(fs.CreateFile(Uid{0}, Gid{0}, "/title/a/b/d", 0, modes), ResultCode::Success);
+  }
+
+  ASSERT_TRUE(PackFileSystem::ExportToDirectory(root));
+  EXPECT_FALSE(File::Exists(PackFileSystem::GetPackPath(root)));
+  {
+    HostFileSystem fs(root);
+    EXPECT_EQ(fs.GetMetadata(Uid{0}, Gid{0}, "/title/a/b/c").Error(), ResultCode::NotFound);
+    EXPECT_TRUE(fs.GetMetadata(Uid{0}, Gid{0}, "/title/a/b/d").Succeeded());
+  }
+  File::DeleteDirRecursively(root);
+}
@@ -138,3 +138,56 @@ TEST_F(MappingTest, ReadWriteComplex)
   EXPECT_TRUE(read_called);
   EXPECT_TRUE(write_called);
 }
+
+TEST_F(MappingTest, ReadWriteFunction)
+{
+  static bool read_called, write_called;
+  read_called = write_called = false;
+
+  m_mapping->Register(0x0C001234, MMIO::FunctionRead<u16>([](Core::System&, u32 addr) -> u16 {
+                        EXPECT_EQ(0x0C001234u, addr);
+                        read_called = true;
+                        return 0x1234;
+                      }),
+                      MMIO::FunctionWrite<u16>([](Core::System&, u32 addr, u16 val) {
+                        EXPECT_EQ(0x0C001234u, addr);
+                        EXPECT_EQ(0x5678, val);
+                        write_called = true;
+                      }));
+
+  u16 val = m_mapping->Read<u16>(*m_system, 0x0C001234);
+  EXPECT_EQ(0x1234, val);
+  m_mapping->Write(*m_system, 0x0C001234, (u16)0x5678);
+
+  EXPECT_TRUE(read_called);
+  EXPECT_TRUE(write_called);
+}
+
+TEST_F(MappingTest, Profiling)
+{
+  u32 target = 0;
+  m_mapping->Register(0x0C001234, MMIO::DirectRead<u32>(&target), MMIO::DirectWrite<u32>(&target));
+  m_mapping->Register(0x0D000010, MMIO::DirectRead<u32>(&target), MMIO::DirectWrite<u32>(&target));
+
+  // Accesses made while profiling is disabled aren't counted.
+  m_mapping->Read<u32>(*m_system, 0x0C001234);
+  EXPECT_FALSE(m_mapping->IsProfilingEnabled());
+  EXPECT_TRUE(m_mapping->GetProfile().empty());
+
+  m_mapping->SetProfilingEnabled(true);
+  for (int i = 0; i < 3; ++i)
+    m_mapping->Read<u32>(*m_system, 0x0C001234);
+  m_mapping->Write<u32>(*m_system, 0x0C001234, 1);
+  m_mapping->Read<u32>(*m_system, 0x0D800010);  // Mirror of 0x0D000010
+
+  const auto profile = m_mapping->GetProfile();
+  ASSERT_EQ(profile.size(), 2u);
+  EXPECT_EQ(profile[0].first, 0x0C001234u);
+  EXPECT_EQ(profile[0].second.reads, 3u);
+  EXPECT_EQ(profile[0].second.writes, 1u);
+  EXPECT_EQ(profile[1].first, 0x0D000010u);
+  EXPECT_EQ(profile[1].second.reads, 1u);
+
+  m_mapping->ClearProfile();
+  EXPECT_TRUE(m_mapping->GetProfile().empty());
+}
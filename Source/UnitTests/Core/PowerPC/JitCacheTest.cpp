@@ -0,0 +1,210 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/System.h"
+
+// include order is important
+#include <gtest/gtest.h>  // NOLINT
+
+namespace
+{
+class TestBlockCache final : public JitBaseBlockCache
+{
+public:
+  explicit TestBlockCache(JitBase& jit) : JitBaseBlockCache(jit) {}
+
+  int links_written = 0;
+
+private:
+  void WriteLinkBlock(const JitBlock::LinkData&, const JitBlock*) override { ++links_written; }
+};
+
+class TestJit final : public JitBase
+{
+public:
+  explicit TestJit(Core::System& system) : JitBase(system) {}
+
+  // CPUCoreBase methods
+  void Init() override {}
+  void Shutdown() override {}
+  void ClearCache() override {}
+  void Run() override {}
+  void SingleStep() override {}
+  const char* GetName() const override { return nullptr; }
+  // JitBase methods
+  JitBaseBlockCache* GetBlockCache() override { return &blocks; }
+  void Jit(u32 em_address) override {}
+  void EraseSingleBlock(const JitBlock&) override {}
+  std::vector<MemoryStats> GetMemoryStats() const override { return {}; }
+  std::size_t DisassembleNearCode(const JitBlock&, std::ostream&) const override { return 0; }
+  std::size_t DisassembleFarCode(const JitBlock&, std::ostream&) const override { return 0; }
+  const CommonAsmRoutinesBase* GetAsmRoutines() override { return nullptr; }
+  bool HandleFault(uintptr_t, SContext*) override { return false; }
+
+  // Adds a fake block covering num_instructions instructions starting at address, which exits to
+  // exit_address.
+  JitBlock* AddBlock(u32 address, u32 num_instructions, u32 exit_address)
+  {
+    JitBlock* block = blocks.AllocateBlock(address);
+    block->normalEntry = m_fake_code.data();
+    block->near_begin = block->near_end = m_fake_code.data();
+    block->far_begin = block->far_end = m_fake_code.data();
+    block->linkData.push_back({.exitPtrs = m_fake_code.data(),
+#ifdef _M_ARM_64
+                               .exitFarcode = m_fake_code.data(),
+#endif
+                               .exitAddress = exit_address,
+                               .linkStatus = false,
+                               .call = false});
+
+    PPCAnalyst::CodeBlock code_block;
+    code_block.m_num_instructions = num_instructions;
+    for (u32 i = 0; i < num_instructions; ++i)
+      code_block.m_physical_addresses.insert(address + i * 4);
+
+    blocks.FinalizeBlock(*block, true, code_block, m_code_buffer);
+    return block;
+  }
+
+  TestBlockCache blocks{*this};
+
+private:
+  std::vector<u8> m_fake_code = std::vector<u8>(16);
+};
+
+class JitCacheTest : public testing::Test
+{
+protected:
+  void SetUp() override { m_jit.blocks.Init(); }
+  void TearDown() override { m_jit.blocks.Shutdown(); }
+
+  TestJit m_jit{Core::System::GetInstance()};
+};
+}  // namespace
+
+TEST_F(JitCacheTest, LookupAndErase)
+{
+  JitBlock* a = m_jit.AddBlock(0x1000, 8, 0x2000);
+  JitBlock* b = m_jit.AddBlock(0x2000, 8, 0x1000);
+  JitBlock* c = m_jit.AddBlock(0x1ff8, 8, 0x1000);  // Crosses a macro block boundary.
+  ASSERT_EQ(m_jit.blocks.GetBlockCount(), 3u);
+
+  const auto flags = a->feature_flags;
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1000, flags), a);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x2000, flags), b);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1ff8, flags), c);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1004, flags), nullptr);
+
+  // Only c covers 0x1ffc.
+  m_jit.blocks.ErasePhysicalRange(0x1ffc, 4);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 2u);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1ff8, flags), nullptr);
+
+  // A range which ends right before a block must not erase it.
+  m_jit.blocks.ErasePhysicalRange(0x1f00, 0x100);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 2u);
+
+  m_jit.blocks.ErasePhysicalRange(0x1000, 0x2000);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 0u);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1000, flags), nullptr);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x2000, flags), nullptr);
+
+  // Freed blocks are reused.
+  const JitBlock* reused = m_jit.AddBlock(0x3000, 4, 0x3000);
+  EXPECT_TRUE(reused == a || reused == b || reused == c);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 1u);
+}
+
+TEST_F(JitCacheTest, EraseSingleBlockUnlinks)
+{
+  JitBlock* a = m_jit.AddBlock(0x1000, 8, 0x2000);
+  m_jit.AddBlock(0x2000, 8, 0x1000);
+  ASSERT_EQ(m_jit.blocks.GetBlockCount(), 2u);
+
+  m_jit.blocks.links_written = 0;
+  m_jit.blocks.EraseSingleBlock(*a);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 1u);
+  // The exit of a and the exit of the other block pointing to a get unlinked.
+  EXPECT_EQ(m_jit.blocks.links_written, 2);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1000, a->feature_flags), nullptr);
+}
+
+TEST_F(JitCacheTest, Statistics)
+{
+  JitBlock* a = m_jit.AddBlock(0x1000, 8, 0x2000);
+  m_jit.AddBlock(0x2000, 8, 0x1000);
+
+  const JitBaseBlockCache::Statistics& statistics = m_jit.blocks.GetStatistics();
+  EXPECT_EQ(statistics.blocks_compiled, 2u);
+  EXPECT_EQ(statistics.blocks_invalidated, 0u);
+  EXPECT_EQ(statistics.links_written, 2u);
+
+  m_jit.blocks.ErasePhysicalRange(0x1000, 4);
+  EXPECT_EQ(statistics.blocks_invalidated, 1u);
+  EXPECT_EQ(statistics.links_removed, 1u);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1000, a->feature_flags), nullptr);
+}
+
+TEST_F(JitCacheTest, EvictOldestBlocks)
+{
+  JitBlock* a = m_jit.AddBlock(0x1000, 8, 0x2000);
+  m_jit.AddBlock(0x2000, 8, 0x3000);
+  JitBlock* c = m_jit.AddBlock(0x3000, 8, 0x1000);
+  const auto flags = a->feature_flags;
+
+  // The older half, rounded up, goes first.
+  EXPECT_EQ(m_jit.blocks.EvictOldestBlocks(), 2u);
+  EXPECT_EQ(m_jit.blocks.GetBlockCount(), 1u);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x1000, flags), nullptr);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x2000, flags), nullptr);
+  EXPECT_EQ(m_jit.blocks.GetBlockFromStartAddress(0x3000, flags), c);
+
+  const JitBaseBlockCache::Statistics& statistics = m_jit.blocks.GetStatistics();
+  EXPECT_EQ(statistics.evictions, 1u);
+  EXPECT_EQ(statistics.blocks_evicted, 2u);
+
+  EXPECT_EQ(m_jit.blocks.EvictOldestBlocks(), 1u);
+  EXPECT_EQ(m_jit.blocks.EvictOldestBlocks(), 0u);
+  EXPECT_EQ(statistics.evictions, 2u);
+}
+
+// Not a correctness test: simulates a game that keeps reloading code, and prints how long the
+// block cache spends on bookkeeping.
+TEST_F(JitCacheTest, InvalidateHeavyBenchmark)
+{
+  constexpr u32 BASE = 0x80000;
+  constexpr u32 NUM_BLOCKS = 4096;
+  constexpr u32 BLOCK_INSTRUCTIONS = 12;
+  constexpr u32 BLOCK_SIZE = BLOCK_INSTRUCTIONS * 4;
+  constexpr int ITERATIONS = 20;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    for (u32 j = 0; j < NUM_BLOCKS; ++j)
+    {
+      const u32 address = BASE + j * BLOCK_SIZE;
+      m_jit.AddBlock(address, BLOCK_INSTRUCTIONS, address + BLOCK_SIZE);
+    }
+
+    // Invalidate one cache line at a time like dcbi/icbi loops do, then everything else.
+    for (u32 j = 0; j < NUM_BLOCKS * BLOCK_SIZE / 2; j += 32)
+      m_jit.blocks.ErasePhysicalRange(BASE + j, 32);
+    m_jit.blocks.ErasePhysicalRange(BASE, NUM_BLOCKS * BLOCK_SIZE);
+    ASSERT_EQ(m_jit.blocks.GetBlockCount(), 0u);
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  fmt::print("block cache invalidation: {} us for {} blocks\n",
+             std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(),
+             ITERATIONS * NUM_BLOCKS);
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/Rewind.h"
+
+namespace
+{
+std::vector<u8> RandomBytes(std::mt19937& rng, size_t size)
+{
+  std::uniform_int_distribution<int> dist(0, 0xFF);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(dist(rng));
+  return bytes;
+}
+}  // namespace
+
+TEST(Rewind, DeltaRoundTrip)
+{
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<size_t> size_dist(0, 0x3000);
+
+  for (int iteration = 0; iteration < 500; ++iteration)
+  {
+    const std::vector<u8> keyframe = RandomBytes(rng, size_dist(rng));
+
+    // Sizes that aren't a multiple of the word size and states bigger or smaller than the
+    // keyframe both have to come back unchanged.
+    std::vector<u8> state = keyframe;
+    state.resize(iteration % 3 == 0 ? size_dist(rng) : keyframe.size());
+    std::uniform_int_distribution<size_t> change_dist(0, 40);
+    const size_t changes = state.empty() ? 0 : change_dist(rng);
+    for (size_t i = 0; i < changes; ++i)
+    {
+      std::uniform_int_distribution<size_t> offset_dist(0, state.size() - 1);
+      const size_t offset = offset_dist(rng);
+      const size_t length = std::min<size_t>(state.size() - offset, change_dist(rng));
+      for (size_t j = offset; j < offset + length; ++j)
+        state[j] ^= static_cast<u8>(rng() | 1);
+    }
+
+    const std::vector<u8> delta = Rewind::EncodeDelta(keyframe, state);
+    std::vector<u8> decoded;
+    ASSERT_TRUE(Rewind::DecodeDelta(keyframe, delta, decoded));
+    ASSERT_EQ(decoded, state);
+  }
+}
+
+TEST(Rewind, UnchangedStateHasSmallDelta)
+{
+  std::mt19937 rng(1);
+  const std::vector<u8> keyframe = RandomBytes(rng, 0x100000);
+  EXPECT_EQ(Rewind::EncodeDelta(keyframe, keyframe).size(), sizeof(u64));
+
+  std::vector<u8> state = keyframe;
+  state[0x1234] ^= 1;
+  state[0x80000] ^= 1;
+  EXPECT_LT(Rewind::EncodeDelta(keyframe, state).size(), 64u);
+}
+
+TEST(Rewind, DecodeRejectsTruncatedDelta)
+{
+  std::mt19937 rng(2);
+  const std::vector<u8> keyframe = RandomBytes(rng, 0x1000);
+  const std::vector<u8> state = RandomBytes(rng, 0x1000);
+
+  std::vector<u8> delta = Rewind::EncodeDelta(keyframe, state);
+  delta.resize(delta.size() - 1);
+  std::vector<u8> decoded;
+  EXPECT_FALSE(Rewind::DecodeDelta(keyframe, delta, decoded));
+}
@@ -0,0 +1,222 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoader.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStateManager.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+constexpr std::array<Primitive, 4> TESTED_PRIMITIVES = {
+    Primitive::GX_DRAW_QUADS,
+    Primitive::GX_DRAW_TRIANGLES,
+    Primitive::GX_DRAW_TRIANGLE_STRIP,
+    Primitive::GX_DRAW_TRIANGLE_FAN,
+};
+
+// The instruction set levels CPUCull picks between at runtime. On x86-64, a level is tested by
+// hiding the CPU features above it from CPUCull::Init. Levels below the minimum the build targets
+// end up using that minimum.
+struct ISALevel
+{
+  std::string_view name;
+  bool supported;
+  void (*apply)(CPUInfo& info);
+};
+
+std::vector<ISALevel> GetISALevels()
+{
+#ifdef _M_X86_64
+  const CPUInfo host = cpu_info;
+  return {
+      {"SSE2", true,
+       [](CPUInfo& info) {
+         info.bSSE3 = info.bSSE4_1 = info.bAVX = info.bFMA = false;
+       }},
+      {"SSE3", host.bSSE3,
+       [](CPUInfo& info) { info.bSSE4_1 = info.bAVX = info.bFMA = false; }},
+      {"SSE4.1", host.bSSE4_1, [](CPUInfo& info) { info.bAVX = info.bFMA = false; }},
+      {"AVX", host.bAVX, [](CPUInfo& info) { info.bFMA = false; }},
+      {"AVX+FMA", host.bAVX && host.bFMA, [](CPUInfo&) {}},
+  };
+#elif defined(_M_ARM_64)
+  return {{"NEON", true, [](CPUInfo&) {}}};
+#else
+  return {{"Scalar", true, [](CPUInfo&) {}}};
+#endif
+}
+
+class CPUCullTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_host_cpu_info = cpu_info;
+
+    TVtxDesc vtx_desc;
+    VAT vtx_attr;
+    vtx_desc.low.Position = VertexComponentFormat::Direct;
+    vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    vtx_attr.g0.PosFormat = ComponentFormat::Float;
+    m_loader = std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+
+    // An identity transform, so that vertices go to clip space unchanged.
+    std::fill(std::begin(xfmem.posMatrices), std::end(xfmem.posMatrices), 0.0f);
+    xfmem.posMatrices[0] = xfmem.posMatrices[5] = xfmem.posMatrices[10] = 1;
+    g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+    xfmem.projection.type = ProjectionType::Orthographic;
+    xfmem.projection.rawProjection = {1, 0, 1, 0, 1, 0};
+    xfmem.viewport.ht = 0;
+    auto& system = Core::System::GetInstance();
+    system.GetVertexShaderManager().Init();
+    system.GetXFStateManager().SetProjectionChanged();
+    bpmem.genMode.cullmode = CullMode::None;
+  }
+
+  void TearDown() override { cpu_info = m_host_cpu_info; }
+
+  void InitForLevel(const ISALevel& level)
+  {
+    cpu_info = m_host_cpu_info;
+    level.apply(cpu_info);
+    m_cull.Init();
+    cpu_info = m_host_cpu_info;
+  }
+
+  // Fills the buffer with count vertices. Visible ones are spread over the screen, the others are
+  // all to the right of it.
+  std::vector<float> MakeVertices(u32 count, bool visible)
+  {
+    std::mt19937 rng(0x1234);
+    std::uniform_real_distribution<float> on_screen(-1, 1);
+    std::uniform_real_distribution<float> off_screen(1.5f, 3);
+    std::vector<float> vertices;
+    vertices.reserve(count * 3);
+    for (u32 i = 0; i < count; ++i)
+    {
+      vertices.push_back(visible ? on_screen(rng) : off_screen(rng));
+      vertices.push_back(on_screen(rng));
+      vertices.push_back(0.5f);
+    }
+    return vertices;
+  }
+
+  bool AreAllVerticesCulled(Primitive primitive, const std::vector<float>& vertices)
+  {
+    return m_cull.AreAllVerticesCulled(m_loader.get(), primitive,
+                                       reinterpret_cast<const u8*>(vertices.data()),
+                                       static_cast<u32>(vertices.size() / 3));
+  }
+
+  CPUInfo m_host_cpu_info;
+  std::unique_ptr<VertexLoader> m_loader;
+  CPUCull m_cull;
+};
+}  // namespace
+
+TEST_F(CPUCullTest, AllISALevelsAgree)
+{
+  const std::vector<float> hidden = MakeVertices(240, false);
+  const std::vector<float> visible = MakeVertices(240, true);
+
+  for (const ISALevel& level : GetISALevels())
+  {
+    if (!level.supported)
+      continue;
+
+    InitForLevel(level);
+    for (Primitive primitive : TESTED_PRIMITIVES)
+    {
+      SCOPED_TRACE(fmt::format("{}, primitive {}", level.name, static_cast<int>(primitive)));
+      EXPECT_TRUE(AreAllVerticesCulled(primitive, hidden));
+      EXPECT_FALSE(AreAllVerticesCulled(primitive, visible));
+    }
+  }
+}
+
+TEST_F(CPUCullTest, CullTrianglesRemovesHiddenTriangles)
+{
+  constexpr u32 NUM_VERTICES = 240;
+
+  // Every other triangle of the list is off-screen.
+  std::vector<float> vertices = MakeVertices(NUM_VERTICES, true);
+  const std::vector<float> hidden = MakeVertices(NUM_VERTICES, false);
+  for (u32 vertex = 3; vertex < NUM_VERTICES; vertex += 6)
+    std::copy_n(hidden.begin() + vertex * 3, 9, vertices.begin() + vertex * 3);
+
+  for (const ISALevel& level : GetISALevels())
+  {
+    if (!level.supported)
+      continue;
+
+    SCOPED_TRACE(level.name);
+    InitForLevel(level);
+    std::vector<u16> indices(NUM_VERTICES * 3);
+    const u32 num_indices =
+        m_cull.CullTriangles(m_loader.get(), Primitive::GX_DRAW_TRIANGLES,
+                             reinterpret_cast<const u8*>(vertices.data()), NUM_VERTICES,
+                             indices.data());
+    ASSERT_EQ(num_indices, NUM_VERTICES / 2);
+    for (u32 i = 0; i < num_indices; ++i)
+    {
+      EXPECT_EQ(indices[i] / 3 % 2, 0);
+      EXPECT_EQ(indices[i] % 3, i % 3);
+    }
+  }
+}
+
+// Not a correctness test: prints how fast each instruction set level transforms and culls a batch
+// that is entirely off-screen, which is the case where every vertex has to be looked at.
+TEST_F(CPUCullTest, ThroughputBenchmark)
+{
+  constexpr u32 VERTS_PER_DRAW = 240;
+  constexpr int ITERATIONS = 20000;
+
+  const std::vector<float> hidden = MakeVertices(VERTS_PER_DRAW, false);
+  fmt::print("{}\n", m_host_cpu_info.Summarize());
+
+  for (const ISALevel& level : GetISALevels())
+  {
+    if (!level.supported)
+    {
+      fmt::print("{}: not supported by this CPU\n", level.name);
+      continue;
+    }
+
+    InitForLevel(level);
+    for (Primitive primitive : TESTED_PRIMITIVES)
+    {
+      int culled = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < ITERATIONS; ++i)
+        culled += AreAllVerticesCulled(primitive, hidden);
+      const auto end = std::chrono::steady_clock::now();
+      EXPECT_EQ(culled, ITERATIONS);
+
+      const double seconds = std::chrono::duration<double>(end - start).count();
+      fmt::print("{}, primitive {}: {:.1f} Mverts/s\n", level.name, static_cast<int>(primitive),
+                 double(ITERATIONS) * VERTS_PER_DRAW / seconds / 1e6);
+    }
+  }
+}
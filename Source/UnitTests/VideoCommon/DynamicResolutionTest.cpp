@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/DynamicResolution.h"
+
+namespace
+{
+constexpr u32 MAX_SCALE = 3;
+
+class DynamicResolutionTest : public testing::Test
+{
+protected:
+  // Lets the given time pass, one frame every 16 ms, at the given maximum speed.
+  void Run(DT duration, double max_speed)
+  {
+    const TimePoint end = m_now + duration;
+    for (; m_now < end; m_now += std::chrono::milliseconds(16))
+      m_resolution.Update(m_now, max_speed, MAX_SCALE);
+  }
+
+  u32 GetScale() const { return m_resolution.GetScale(MAX_SCALE); }
+
+  DynamicResolution m_resolution;
+  TimePoint m_now{std::chrono::seconds(1)};
+};
+}  // namespace
+
+TEST_F(DynamicResolutionTest, KeepsScaleWithHeadroom)
+{
+  Run(std::chrono::seconds(20), 1.2);
+  EXPECT_EQ(GetScale(), MAX_SCALE);
+}
+
+TEST_F(DynamicResolutionTest, LowersScaleWhileItHelps)
+{
+  Run(std::chrono::seconds(4), 0.7);
+  EXPECT_EQ(GetScale(), MAX_SCALE - 1);
+
+  // Faster, but still not fast enough.
+  Run(std::chrono::seconds(6), 0.9);
+  EXPECT_EQ(GetScale(), MAX_SCALE - 2);
+
+  Run(std::chrono::seconds(20), 1.1);
+  EXPECT_EQ(GetScale(), 1u);
+}
+
+TEST_F(DynamicResolutionTest, UndoesReductionThatDoesNotHelp)
+{
+  Run(std::chrono::seconds(4), 0.7);
+  EXPECT_EQ(GetScale(), MAX_SCALE - 1);
+
+  // The emulation is held back by something else, so the reduction is undone and not retried
+  // right away.
+  Run(std::chrono::seconds(10), 0.7);
+  EXPECT_EQ(GetScale(), MAX_SCALE);
+}
+
+TEST_F(DynamicResolutionTest, RaisesScaleWithHeadroom)
+{
+  Run(std::chrono::seconds(4), 0.7);
+  Run(std::chrono::seconds(3), 1.0);
+  EXPECT_EQ(GetScale(), MAX_SCALE - 1);
+
+  // A scale that was too slow is only retried after a while.
+  Run(std::chrono::seconds(10), 2.0);
+  EXPECT_EQ(GetScale(), MAX_SCALE - 1);
+  Run(std::chrono::seconds(30), 2.0);
+  EXPECT_EQ(GetScale(), MAX_SCALE);
+}
+
+TEST_F(DynamicResolutionTest, NeverGoesBelowNative)
+{
+  for (int i = 0; i < 10; ++i)
+  {
+    Run(std::chrono::seconds(3), 0.5 + i * 0.1);
+    EXPECT_GE(GetScale(), 1u);
+  }
+  EXPECT_EQ(m_resolution.GetScale(1), 1u);
+}
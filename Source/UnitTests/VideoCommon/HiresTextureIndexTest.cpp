@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/HiresTextureIndex.h"
+
+using VideoCommon::HiresTextureIndex;
+
+class HiresTextureIndexTest : public testing::Test
+{
+protected:
+  HiresTextureIndexTest()
+      : m_temp_directory(File::CreateTempDir()), m_pack_directory(m_temp_directory + "/pack"),
+        m_index_path(m_temp_directory + "/cache/pack.idx")
+  {
+  }
+
+  ~HiresTextureIndexTest() override
+  {
+    if (!m_temp_directory.empty())
+      File::DeleteDirRecursively(m_temp_directory);
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_temp_directory.empty());
+
+    File::CreateFullPath(m_pack_directory + "/sub/");
+    File::WriteStringToFile(m_pack_directory + "/sub/tex1_64x64_0123456789abcdef_6.png", "");
+    File::WriteStringToFile(m_pack_directory + "/tex1_32x32_fedcba9876543210_14_arb.dds", "");
+    File::WriteStringToFile(m_pack_directory + "/readme.txt", "");
+
+    // Backdate the directories, so that adding a file is guaranteed to change their times.
+    for (const std::string& directory : {m_pack_directory, m_pack_directory + "/sub"})
+    {
+      std::filesystem::last_write_time(
+          StringToPath(directory),
+          std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+    }
+  }
+
+  const std::string m_temp_directory;
+  const std::string m_pack_directory;
+  const std::string m_index_path;
+};
+
+TEST_F(HiresTextureIndexTest, Find)
+{
+  const HiresTextureIndex index = HiresTextureIndex::Build(m_pack_directory);
+  EXPECT_EQ(2u, index.GetTextureCount());
+
+  std::string path;
+  bool arb = true;
+  ASSERT_TRUE(index.Find("tex1_64x64_0123456789abcdef_6", &path, &arb));
+  EXPECT_EQ(m_pack_directory + "/sub/tex1_64x64_0123456789abcdef_6.png", path);
+  EXPECT_FALSE(arb);
+
+  ASSERT_TRUE(index.Find("tex1_32x32_fedcba9876543210_14", &path, &arb));
+  EXPECT_EQ(m_pack_directory + "/tex1_32x32_fedcba9876543210_14_arb.dds", path);
+  EXPECT_TRUE(arb);
+
+  EXPECT_FALSE(index.Find("tex1_32x32_fedcba9876543210_14_arb", &path, &arb));
+  EXPECT_FALSE(index.Find("tex1_64x64_0123456789abcdef_5", &path, &arb));
+  EXPECT_FALSE(index.Find("readme", &path, &arb));
+}
+
+TEST_F(HiresTextureIndexTest, SaveAndLoad)
+{
+  ASSERT_TRUE(HiresTextureIndex::Build(m_pack_directory).Save(m_index_path));
+
+  const auto index = HiresTextureIndex::Load(m_index_path, m_pack_directory);
+  ASSERT_TRUE(index.has_value());
+  EXPECT_EQ(2u, index->GetTextureCount());
+
+  std::string path;
+  bool arb;
+  EXPECT_TRUE(index->Find("tex1_64x64_0123456789abcdef_6", &path, &arb));
+  EXPECT_EQ(m_pack_directory + "/sub/tex1_64x64_0123456789abcdef_6.png", path);
+}
+
+TEST_F(HiresTextureIndexTest, AddedTextureInvalidatesIndex)
+{
+  ASSERT_TRUE(HiresTextureIndex::Build(m_pack_directory).Save(m_index_path));
+
+  File::WriteStringToFile(m_pack_directory + "/sub/tex1_8x8_0000000000000000_0.png", "");
+  EXPECT_FALSE(HiresTextureIndex::Load(m_index_path, m_pack_directory).has_value());
+}
+
+TEST_F(HiresTextureIndexTest, CorruptIndex)
+{
+  ASSERT_TRUE(HiresTextureIndex::Build(m_pack_directory).Save(m_index_path));
+
+  std::string data;
+  ASSERT_TRUE(File::ReadFileToString(m_index_path, data));
+  File::WriteStringToFile(m_index_path, data.substr(0, data.size() - 1));
+  EXPECT_FALSE(HiresTextureIndex::Load(m_index_path, m_pack_directory).has_value());
+}
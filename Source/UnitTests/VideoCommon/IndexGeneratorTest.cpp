@@ -0,0 +1,188 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+constexpr u16 RESTART = UINT16_MAX;
+
+// Straightforward version of what IndexGenerator is expected to output.
+std::vector<u16> ReferenceIndices(Primitive primitive, u32 num_verts, u32 base, bool pr)
+{
+  std::vector<u16> out;
+  const auto triangle = [&](u32 a, u32 b, u32 c) {
+    out.insert(out.end(), {u16(base + a), u16(base + b), u16(base + c)});
+    if (pr)
+      out.push_back(RESTART);
+  };
+
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_QUADS:
+  {
+    u32 i = 0;
+    for (; i + 4 <= num_verts; i += 4)
+    {
+      if (pr)
+      {
+        out.insert(out.end(), {u16(base + i + 1), u16(base + i + 2), u16(base + i),
+                               u16(base + i + 3), RESTART});
+      }
+      else
+      {
+        triangle(i, i + 1, i + 2);
+        triangle(i, i + 2, i + 3);
+      }
+    }
+    if (i + 3 == num_verts)
+      triangle(i, i + 1, i + 2);
+    break;
+  }
+  case Primitive::GX_DRAW_TRIANGLES:
+    for (u32 i = 0; i + 3 <= num_verts; i += 3)
+      triangle(i, i + 1, i + 2);
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+    if (pr)
+    {
+      for (u32 i = 0; i < num_verts; ++i)
+        out.push_back(u16(base + i));
+      out.push_back(RESTART);
+      break;
+    }
+    for (u32 i = 0; i + 3 <= num_verts; ++i)
+    {
+      if (i % 2 == 0)
+        triangle(i, i + 1, i + 2);
+      else
+        triangle(i, i + 2, i + 1);
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+  {
+    u32 i = 2;
+    if (pr)
+    {
+      for (; i + 3 <= num_verts; i += 3)
+      {
+        out.insert(out.end(), {u16(base + i - 1), u16(base + i), u16(base), u16(base + i + 1),
+                               u16(base + i + 2), RESTART});
+      }
+      for (; i + 2 <= num_verts; i += 2)
+      {
+        out.insert(out.end(),
+                   {u16(base + i - 1), u16(base + i), u16(base), u16(base + i + 1), RESTART});
+      }
+    }
+    for (; i < num_verts; ++i)
+      triangle(0, i - 1, i);
+    break;
+  }
+  case Primitive::GX_DRAW_LINES:
+    for (u32 i = 0; i + 2 <= num_verts; i += 2)
+      out.insert(out.end(), {u16(base + i), u16(base + i + 1)});
+    break;
+  case Primitive::GX_DRAW_LINE_STRIP:
+    for (u32 i = 0; i + 2 <= num_verts; ++i)
+      out.insert(out.end(), {u16(base + i), u16(base + i + 1)});
+    break;
+  case Primitive::GX_DRAW_POINTS:
+    for (u32 i = 0; i < num_verts; ++i)
+      out.push_back(u16(base + i));
+    break;
+  default:
+    break;
+  }
+  return out;
+}
+
+constexpr Primitive TESTED_PRIMITIVES[] = {
+    Primitive::GX_DRAW_QUADS,          Primitive::GX_DRAW_TRIANGLES,
+    Primitive::GX_DRAW_TRIANGLE_STRIP, Primitive::GX_DRAW_TRIANGLE_FAN,
+    Primitive::GX_DRAW_LINES,          Primitive::GX_DRAW_LINE_STRIP,
+    Primitive::GX_DRAW_POINTS,
+};
+
+class IndexGeneratorTest : public testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    g_Config.backend_info.bSupportsPrimitiveRestart = GetParam();
+    g_Config.backend_info.bSupportsVSLinePointExpand = false;
+    m_generator.Init();
+  }
+
+  void TearDown() override { g_Config.backend_info.bSupportsPrimitiveRestart = false; }
+
+  IndexGenerator m_generator;
+  // Large enough for the worst case of 3 indices per vertex.
+  std::vector<u16> m_buffer = std::vector<u16>(3 * 65536 + 64);
+};
+}  // namespace
+
+TEST_P(IndexGeneratorTest, MatchesReference)
+{
+  const bool pr = GetParam();
+  for (Primitive primitive : TESTED_PRIMITIVES)
+  {
+    for (u32 num_verts = 0; num_verts < 100; ++num_verts)
+    {
+      // Start at a non-zero base index, like a draw following another one in the same batch.
+      constexpr u32 BASE = 1000;
+      m_generator.Start(m_buffer.data());
+      m_generator.AddIndices(Primitive::GX_DRAW_POINTS, BASE);
+      const u32 start = m_generator.GetIndexLen();
+      m_generator.AddIndices(primitive, num_verts);
+
+      const std::vector<u16> expected = ReferenceIndices(primitive, num_verts, BASE, pr);
+      const std::vector<u16> actual(m_buffer.begin() + start,
+                                    m_buffer.begin() + m_generator.GetIndexLen());
+      EXPECT_EQ(expected, actual) << "primitive " << static_cast<int>(primitive) << ", "
+                                  << num_verts << " vertices";
+      EXPECT_EQ(BASE + num_verts, m_generator.GetNumVerts());
+    }
+  }
+}
+
+// Not a correctness test: prints the index generation throughput for each primitive type.
+TEST_P(IndexGeneratorTest, ThroughputBenchmark)
+{
+  constexpr u32 VERTS_PER_DRAW = 240;
+  constexpr u32 DRAWS_PER_BATCH = 200;
+  constexpr int ITERATIONS = 200;
+
+  for (Primitive primitive : TESTED_PRIMITIVES)
+  {
+    u64 num_indices = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+      m_generator.Start(m_buffer.data());
+      for (u32 j = 0; j < DRAWS_PER_BATCH; ++j)
+        m_generator.AddIndices(primitive, VERTS_PER_DRAW);
+      num_indices += m_generator.GetIndexLen();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double num_verts = double(ITERATIONS) * DRAWS_PER_BATCH * VERTS_PER_DRAW;
+    fmt::print("primitive {}{}: {:.1f} Mverts/s, {:.1f} Mindices/s\n", static_cast<int>(primitive),
+               GetParam() ? " (primitive restart)" : "", num_verts / seconds / 1e6,
+               num_indices / seconds / 1e6);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(IndexGenerator, IndexGeneratorTest, testing::Bool());
@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr TextureFormat TESTED_FORMATS[] = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+constexpr TLUTFormat TLUT_FORMATS[] = {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3};
+
+std::vector<u8> RandomBytes(size_t size, std::mt19937& rng)
+{
+  std::vector<u8> bytes(size);
+  std::uniform_int_distribution<int> dist(0, 0xFF);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(dist(rng));
+  return bytes;
+}
+}  // namespace
+
+// The architecture-specific decoder must produce exactly the same output as the generic one.
+TEST(TextureDecoder, MatchesGeneric)
+{
+  constexpr int WIDTH = 64;
+  constexpr int HEIGHT = 32;
+
+  std::mt19937 rng(0x1234);
+  // C14X2 can index the full 16384 entry palette.
+  const std::vector<u8> tlut = RandomBytes(16384 * 2, rng);
+
+  for (TextureFormat format : TESTED_FORMATS)
+  {
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format), rng);
+    for (TLUTFormat tlut_format : TLUT_FORMATS)
+    {
+      std::vector<u32> expected(WIDTH * HEIGHT, 0xDEADBEEF);
+      std::vector<u32> actual(WIDTH * HEIGHT, 0xDEADBEEF);
+      TexDecoder_DecodeImplGeneric(expected.data(), src.data(), WIDTH, HEIGHT, format,
+                                   tlut.data(), tlut_format);
+      _TexDecoder_DecodeImpl(actual.data(), src.data(), WIDTH, HEIGHT, format, tlut.data(),
+                             tlut_format);
+
+      for (int i = 0; i < WIDTH * HEIGHT; ++i)
+      {
+        ASSERT_EQ(expected[i], actual[i])
+            << fmt::format("{}, TLUT {}, texel ({}, {})", format, tlut_format, i % WIDTH,
+                           i / WIDTH);
+      }
+
+      // The TLUT format doesn't matter for the other formats.
+      if (!IsColorIndexed(format))
+        break;
+    }
+  }
+}
+
+// Not a correctness test: prints the CPU decode throughput for each format. This is the work that
+// GPU texture decoding moves to the compute shaders in TextureConversionShader.cpp.
+TEST(TextureDecoder, ThroughputBenchmark)
+{
+  constexpr int WIDTH = 512;
+  constexpr int HEIGHT = 512;
+  constexpr int ITERATIONS = 20;
+
+  std::mt19937 rng(0x1234);
+  const std::vector<u8> tlut = RandomBytes(16384 * 2, rng);
+  std::vector<u32> dst(WIDTH * HEIGHT);
+
+  for (TextureFormat format : TESTED_FORMATS)
+  {
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format), rng);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+      _TexDecoder_DecodeImpl(dst.data(), src.data(), WIDTH, HEIGHT, format, tlut.data(),
+                             TLUTFormat::RGB5A3);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    fmt::print("{}: {:.1f} Mtexels/s\n", format,
+               double(ITERATIONS) * WIDTH * HEIGHT / seconds / 1e6);
+  }
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/Assets/TextureTranscoder.h"
+
+namespace
+{
+constexpr std::array<std::array<int, 2>, 8> ETC1_MODIFIERS = {
+    {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}}};
+
+constexpr std::array<std::array<int, 8>, 16> EAC_MODIFIERS = {{
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8},
+}};
+
+u64 LoadBigEndian(const u8* src)
+{
+  u64 value = 0;
+  for (int i = 0; i < 8; ++i)
+    value = (value << 8) | src[i];
+  return value;
+}
+
+// A reference decoder for the subset of ETC2 RGBA8 that the encoder produces: the two ETC1 modes
+// for color, and EAC for alpha. Fails the test if a block uses one of the other ETC2 modes.
+std::vector<u8> DecodeETC2(const std::vector<u8>& blocks, u32 width, u32 height)
+{
+  const u32 blocks_wide = (width + 3) / 4;
+  std::vector<u8> rgba(size_t{width} * height * 4);
+  for (u32 block_index = 0; block_index < blocks.size() / 16; ++block_index)
+  {
+    const u32 block_x = block_index % blocks_wide;
+    const u32 block_y = block_index / blocks_wide;
+    const u64 alpha = LoadBigEndian(&blocks[block_index * 16]);
+    const u64 color = LoadBigEndian(&blocks[block_index * 16 + 8]);
+
+    const bool diff = (color >> 33) & 1;
+    const bool flip = (color >> 32) & 1;
+    std::array<std::array<int, 3>, 2> bases;
+    for (u32 c = 0; c < 3; ++c)
+    {
+      if (diff)
+      {
+        const int base0 = (color >> (59 - c * 8)) & 0x1F;
+        const int offset = static_cast<int>((color >> (56 - c * 8)) & 7) << 29 >> 29;
+        const int base1 = base0 + offset;
+        EXPECT_TRUE(base1 >= 0 && base1 < 32) << "ETC2-only mode used";
+        bases[0][c] = (base0 << 3) | (base0 >> 2);
+        bases[1][c] = (base1 << 3) | (base1 >> 2);
+      }
+      else
+      {
+        bases[0][c] = ((color >> (60 - c * 8)) & 0xF) * 17;
+        bases[1][c] = ((color >> (56 - c * 8)) & 0xF) * 17;
+      }
+    }
+    const std::array<u32, 2> tables{static_cast<u32>((color >> 37) & 7),
+                                    static_cast<u32>((color >> 34) & 7)};
+
+    const int alpha_base = static_cast<int>(alpha >> 56);
+    const int alpha_multiplier = (alpha >> 52) & 0xF;
+    const u32 alpha_table = (alpha >> 48) & 0xF;
+
+    for (u32 texel = 0; texel < 16; ++texel)
+    {
+      const u32 x = block_x * 4 + texel / 4;
+      const u32 y = block_y * 4 + texel % 4;
+      if (x >= width || y >= height)
+        continue;
+
+      const u32 subblock = ((flip ? texel % 4 : texel / 4) >= 2) ? 1 : 0;
+      const u32 index = (((color >> (16 + texel)) & 1) << 1) | ((color >> texel) & 1);
+      const int magnitude = ETC1_MODIFIERS[tables[subblock]][index & 1];
+      const int modifier = (index & 2) ? -magnitude : magnitude;
+
+      u8* dst = &rgba[(size_t{y} * width + x) * 4];
+      for (u32 c = 0; c < 3; ++c)
+        dst[c] = static_cast<u8>(std::clamp(bases[subblock][c] + modifier, 0, 255));
+
+      const u32 alpha_index = (alpha >> (45 - texel * 3)) & 7;
+      dst[3] = static_cast<u8>(std::clamp(
+          alpha_base + EAC_MODIFIERS[alpha_table][alpha_index] * alpha_multiplier, 0, 255));
+    }
+  }
+  return rgba;
+}
+
+double GetPSNR(const std::vector<u8>& expected, const std::vector<u8>& actual, u32 channel)
+{
+  double error = 0;
+  for (size_t i = channel; i < expected.size(); i += 4)
+    error += std::pow(double(expected[i]) - double(actual[i]), 2);
+  if (error == 0)
+    return INFINITY;
+  return 10 * std::log10(255.0 * 255.0 / (error / (expected.size() / 4)));
+}
+}  // namespace
+
+TEST(TextureTranscoder, SolidColor)
+{
+  constexpr u32 SIZE = 8;
+  std::vector<u8> rgba;
+  for (u32 i = 0; i < SIZE * SIZE; ++i)
+    rgba.insert(rgba.end(), {0x80, 0x40, 0xC0, 0x7F});
+
+  const std::vector<u8> blocks = VideoCommon::EncodeETC2(rgba.data(), SIZE, SIZE, SIZE);
+  ASSERT_EQ(4u * 16u, blocks.size());
+  const std::vector<u8> decoded = DecodeETC2(blocks, SIZE, SIZE);
+  // Base colors only have 5 bits, and the smallest modifier is 2.
+  for (size_t i = 0; i < rgba.size(); ++i)
+    EXPECT_NEAR(rgba[i], decoded[i], 6) << "byte " << i;
+
+  // Single alpha values are stored exactly.
+  for (size_t i = 3; i < rgba.size(); i += 4)
+    EXPECT_EQ(rgba[i], decoded[i]);
+}
+
+TEST(TextureTranscoder, Gradient)
+{
+  // Not a multiple of the block size, to also cover the clamping at the edges.
+  constexpr u32 WIDTH = 30;
+  constexpr u32 HEIGHT = 18;
+  std::vector<u8> rgba;
+  for (u32 y = 0; y < HEIGHT; ++y)
+  {
+    for (u32 x = 0; x < WIDTH; ++x)
+    {
+      rgba.insert(rgba.end(), {static_cast<u8>(x * 255 / WIDTH), static_cast<u8>(y * 255 / HEIGHT),
+                               static_cast<u8>((x + y) * 4), static_cast<u8>(255 - x * 8)});
+    }
+  }
+
+  const std::vector<u8> blocks = VideoCommon::EncodeETC2(rgba.data(), WIDTH, HEIGHT, WIDTH);
+  ASSERT_EQ(8u * 5u * 16u, blocks.size());
+  const std::vector<u8> decoded = DecodeETC2(blocks, WIDTH, HEIGHT);
+  for (u32 channel = 0; channel < 4; ++channel)
+    EXPECT_GT(GetPSNR(rgba, decoded, channel), 32.0) << "channel " << channel;
+}
+
+TEST(TextureTranscoder, DecodeDXT1)
+{
+  // Red and blue endpoints. Pixel 0 uses red, 1 blue, 2 the color closer to red, 3 the other.
+  const std::array<u8, 8> four_colors{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+  std::vector<u8> rgba = VideoCommon::DecodeS3TC(four_colors.data(), AbstractTextureFormat::DXT1,
+                                                 4, 4, 4);
+  ASSERT_EQ(4u * 4u * 4u, rgba.size());
+  EXPECT_EQ((std::vector<u8>{255, 0, 0, 255, 0, 0, 255, 255, 170, 0, 85, 255, 85, 0, 170, 255}),
+            std::vector<u8>(rgba.begin(), rgba.begin() + 16));
+
+  // With the endpoints swapped, index 3 is transparent black.
+  const std::array<u8, 8> three_colors{0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF};
+  rgba = VideoCommon::DecodeS3TC(three_colors.data(), AbstractTextureFormat::DXT1, 4, 4, 4);
+  EXPECT_EQ((std::vector<u8>{0, 0, 0, 0}), std::vector<u8>(rgba.begin(), rgba.begin() + 4));
+}
+
+TEST(TextureTranscoder, DecodeDXT5)
+{
+  // Alpha endpoints 255 and 0 with eight values, then a white color block.
+  const std::array<u8, 16> block{0xFF, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+                                 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00};
+  const std::vector<u8> rgba =
+      VideoCommon::DecodeS3TC(block.data(), AbstractTextureFormat::DXT5, 4, 4, 4);
+  EXPECT_EQ(255, rgba[0]);
+  EXPECT_EQ(255, rgba[1]);
+  EXPECT_EQ(255, rgba[2]);
+  // The 0x88 bytes repeat the indices 0, 1, 2 and 4.
+  for (size_t texel = 0; texel < 16; ++texel)
+  {
+    const u32 index = (0x888888888888ull >> (texel * 3)) & 7;
+    const int expected = index == 0 ? 255 : index == 1 ? 0 : ((7 - (index - 1)) * 255) / 7;
+    EXPECT_EQ(expected, rgba[texel * 4 + 3]) << "texel " << texel;
+  }
+}
@@ -1,12 +1,15 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <bit>
+#include <chrono>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include <gtest/gtest.h>  // NOLINT
 
@@ -15,6 +18,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoader.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 
@@ -377,6 +381,104 @@ TEST_F(VertexLoaderTest, LargeFloatVertexSpeed)
     RunVertices(100000);
 }
 
+// Not a correctness test: prints the throughput of the reference loader and of the JIT loader for
+// this CPU for a few typical vertex formats.
+TEST_F(VertexLoaderTest, ThroughputBenchmark)
+{
+  constexpr int VERTICES = 100000;
+  constexpr int ITERATIONS = 20;
+
+  struct Format
+  {
+    const char* name;
+    void (*setup)(TVtxDesc& desc, VAT& attr);
+  };
+  static constexpr std::array<Format, 4> formats = {{
+      {"byte position",
+       [](TVtxDesc& desc, VAT& attr) {
+         desc.low.Position = VertexComponentFormat::Direct;
+         attr.g0.PosElements = CoordComponentCount::XYZ;
+         attr.g0.PosFormat = ComponentFormat::Byte;
+       }},
+      {"float position, normal, color, texcoord",
+       [](TVtxDesc& desc, VAT& attr) {
+         desc.low.Position = VertexComponentFormat::Direct;
+         desc.low.Normal = VertexComponentFormat::Direct;
+         desc.low.Color0 = VertexComponentFormat::Direct;
+         desc.high.Tex0Coord = VertexComponentFormat::Direct;
+         attr.g0.PosElements = CoordComponentCount::XYZ;
+         attr.g0.PosFormat = ComponentFormat::Float;
+         attr.g0.NormalFormat = ComponentFormat::Float;
+         attr.g0.Color0Elements = ColorComponentCount::RGBA;
+         attr.g0.Color0Comp = ColorFormat::RGBA8888;
+         attr.g0.Tex0CoordElements = TexComponentCount::ST;
+         attr.g0.Tex0CoordFormat = ComponentFormat::Float;
+       }},
+      {"indexed skinned, short texcoords",
+       [](TVtxDesc& desc, VAT& attr) {
+         desc.low.PosMatIdx = true;
+         desc.low.Position = VertexComponentFormat::Index16;
+         desc.low.Normal = VertexComponentFormat::Index16;
+         desc.low.Color0 = VertexComponentFormat::Index8;
+         desc.high.Tex0Coord = VertexComponentFormat::Index16;
+         desc.high.Tex1Coord = VertexComponentFormat::Index16;
+         attr.g0.PosElements = CoordComponentCount::XYZ;
+         attr.g0.PosFormat = ComponentFormat::Short;
+         attr.g0.PosFrac = 8;
+         attr.g0.NormalFormat = ComponentFormat::Byte;
+         attr.g0.Color0Elements = ColorComponentCount::RGBA;
+         attr.g0.Color0Comp = ColorFormat::RGBA4444;
+         attr.g0.Tex0CoordElements = TexComponentCount::ST;
+         attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+         attr.g0.Tex0Frac = 10;
+         attr.g1.Tex1CoordElements = TexComponentCount::ST;
+         attr.g1.Tex1CoordFormat = ComponentFormat::Short;
+         attr.g1.Tex1Frac = 10;
+       }},
+      {"indexed float NBT",
+       [](TVtxDesc& desc, VAT& attr) {
+         desc.low.Position = VertexComponentFormat::Index16;
+         desc.low.Normal = VertexComponentFormat::Index16;
+         attr.g0.PosElements = CoordComponentCount::XYZ;
+         attr.g0.PosFormat = ComponentFormat::Float;
+         attr.g0.NormalElements = NormalComponentCount::NTB;
+         attr.g0.NormalFormat = ComponentFormat::Float;
+       }},
+  }};
+
+  for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+  {
+    VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = input_memory;
+    g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 129;
+  }
+
+  for (const Format& format : formats)
+  {
+    m_vtx_desc.low.Hex = 0;
+    m_vtx_desc.high.Hex = 0;
+    m_vtx_attr.g0.Hex = 0;
+    m_vtx_attr.g1.Hex = 0;
+    m_vtx_attr.g2.Hex = 0;
+    format.setup(m_vtx_desc, m_vtx_attr);
+
+    const std::array<std::pair<const char*, std::unique_ptr<VertexLoaderBase>>, 2> loaders = {{
+        {"reference", std::make_unique<VertexLoader>(m_vtx_desc, m_vtx_attr)},
+        {"JIT", VertexLoaderBase::CreateVertexLoader(m_vtx_desc, m_vtx_attr)},
+    }};
+    for (const auto& [loader_name, loader] : loaders)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < ITERATIONS; ++i)
+        loader->RunVertices(input_memory, output_memory, VERTICES);
+      const auto end = std::chrono::steady_clock::now();
+
+      const double seconds = std::chrono::duration<double>(end - start).count();
+      fmt::print("{} ({}): {:.1f} Mverts/s\n", format.name, loader_name,
+                 double(ITERATIONS) * VERTICES / seconds / 1e6);
+    }
+  }
+}
+
 TEST_F(VertexLoaderTest, DirectAllComponents)
 {
   m_vtx_desc.low.PosMatIdx = true;